@@ -0,0 +1,146 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__ALLOCATION_TRACKING_HPP_
+#define RCLCPP__ALLOCATION_TRACKING_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+#include "rclcpp/visibility_control.hpp"
+
+namespace rclcpp
+{
+/// Counting of the heap allocations, to check that real-time code doesn't allocate memory.
+/**
+ * Allocations are counted per thread, once the global allocation functions of the program
+ * are replaced by using RCLCPP_TRACK_ALLOCATIONS() in one of its source files.
+ * Otherwise, nothing is counted and no check fails.
+ *
+ * Only the allocations made with operator new, i.e. by C++ code and the allocators using it,
+ * are counted: the allocations made with malloc(), e.g. by rcl and the middleware, are not.
+ *
+ * Executors count the allocations made by each callback in its CallbackStatistics, and throw
+ * rclcpp::exceptions::AllocationInSteadyStateError when their thread allocates memory, waiting
+ * for work or executing a callback, while the program is in steady state.
+ */
+namespace allocation_tracking
+{
+
+/// Count an allocation of the calling thread, called by the replaced allocation functions.
+RCLCPP_PUBLIC
+void
+record_allocation(size_t size) noexcept;
+
+/// Return true if allocations are counted, i.e. if any allocation was recorded yet.
+RCLCPP_PUBLIC
+bool
+is_enabled() noexcept;
+
+/// Get the number of allocations made by the calling thread since it started.
+RCLCPP_PUBLIC
+uint64_t
+get_thread_allocation_count() noexcept;
+
+/// Get the number of bytes allocated by the calling thread since it started.
+RCLCPP_PUBLIC
+uint64_t
+get_thread_allocated_bytes() noexcept;
+
+/// Declare that the program is in steady state, and shouldn't allocate memory anymore.
+/**
+ * \throws std::runtime_error if allocations aren't counted, as nothing could be checked
+ */
+RCLCPP_PUBLIC
+void
+enter_steady_state();
+
+/// Declare that the program isn't in steady state anymore, e.g. before shutting down.
+RCLCPP_PUBLIC
+void
+exit_steady_state() noexcept;
+
+/// Return true if the program is in steady state.
+RCLCPP_PUBLIC
+bool
+is_steady_state() noexcept;
+
+/// Counter of the allocations made by the calling thread since the counter was created.
+class AllocationCounter
+{
+public:
+  AllocationCounter() noexcept
+  : start_count_(get_thread_allocation_count())
+  {}
+
+  /// Get the number of allocations made since the counter was created or reset.
+  uint64_t
+  get_count() const noexcept
+  {
+    return get_thread_allocation_count() - start_count_;
+  }
+
+  /// Restart counting from zero.
+  void
+  reset() noexcept
+  {
+    start_count_ = get_thread_allocation_count();
+  }
+
+private:
+  uint64_t start_count_;
+};
+
+}  // namespace allocation_tracking
+}  // namespace rclcpp
+
+/// Replace the global allocation functions of the program to count the heap allocations.
+/**
+ * To be used once, at namespace scope, in a source file of the executable, e.g. next to main().
+ * \sa rclcpp::allocation_tracking
+ */
+#define RCLCPP_TRACK_ALLOCATIONS() \
+  void * operator new(std::size_t size) \
+  { \
+    rclcpp::allocation_tracking::record_allocation(size); \
+    void * ptr = std::malloc(size ? size : 1); \
+    if (!ptr) { \
+      throw std::bad_alloc(); \
+    } \
+    return ptr; \
+  } \
+  void * operator new[](std::size_t size) \
+  { \
+    return ::operator new(size); \
+  } \
+  void operator delete(void * ptr) noexcept \
+  { \
+    std::free(ptr); \
+  } \
+  void operator delete[](void * ptr) noexcept \
+  { \
+    std::free(ptr); \
+  } \
+  void operator delete(void * ptr, std::size_t) noexcept \
+  { \
+    std::free(ptr); \
+  } \
+  void operator delete[](void * ptr, std::size_t) noexcept \
+  { \
+    std::free(ptr); \
+  }
+
+#endif  // RCLCPP__ALLOCATION_TRACKING_HPP_
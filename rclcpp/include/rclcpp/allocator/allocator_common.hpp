@@ -17,6 +17,8 @@
 
 #include <cstring>
 #include <memory>
+#include <memory_resource>
+#include <type_traits>
 
 #include "rcl/allocator.h"
 
@@ -80,11 +82,19 @@ void * retyped_reallocate(void * untyped_pointer, size_t size, void * untyped_al
 }
 
 
+template<typename Alloc>
+struct is_polymorphic_allocator : std::false_type {};
+
+template<typename T>
+struct is_polymorphic_allocator<std::pmr::polymorphic_allocator<T>> : std::true_type {};
+
 // Convert a std::allocator_traits-formatted Allocator into an rcl allocator
 template<
   typename T,
   typename Alloc,
-  typename std::enable_if<!std::is_same<Alloc, std::allocator<void>>::value>::type * = nullptr>
+  typename std::enable_if<
+    !std::is_same<Alloc, std::allocator<void>>::value &&
+    !is_polymorphic_allocator<Alloc>::value>::type * = nullptr>
 rcl_allocator_t get_rcl_allocator(Alloc & allocator)
 {
   rcl_allocator_t rcl_allocator = rcl_get_default_allocator();
@@ -111,6 +121,17 @@ rcl_allocator_t get_rcl_allocator(Alloc & allocator)
   return rcl_get_default_allocator();
 }
 
+// rcl frees memory without giving its size, which memory resources need
+template<
+  typename T,
+  typename Alloc,
+  typename std::enable_if<is_polymorphic_allocator<Alloc>::value>::type * = nullptr>
+rcl_allocator_t get_rcl_allocator(Alloc & allocator)
+{
+  (void)allocator;
+  return rcl_get_default_allocator();
+}
+
 }  // namespace allocator
 }  // namespace rclcpp
 
@@ -30,14 +30,29 @@
 namespace rclcpp
 {
 
+/// Entity ready to be executed, with the callback group and the node it belongs to.
+/**
+ * Moving an executable leaves the moved from one empty, so that it doesn't reset the callback
+ * group when destroyed, without changing the reference counts of the pointers as copies do.
+ */
 struct AnyExecutable
 {
   RCLCPP_PUBLIC
   AnyExecutable();
 
+  AnyExecutable(const AnyExecutable &) = default;
+  AnyExecutable(AnyExecutable &&) noexcept = default;
+  AnyExecutable & operator=(const AnyExecutable &) = default;
+  AnyExecutable & operator=(AnyExecutable &&) noexcept = default;
+
   RCLCPP_PUBLIC
   virtual ~AnyExecutable();
 
+  /// Get the entity which is set, as a pointer to its base class, or nullptr if none is.
+  RCLCPP_PUBLIC
+  const void *
+  get_entity() const;
+
   // Only one of the following pointers will be set.
   rclcpp::SubscriptionBase::SharedPtr subscription;
   rclcpp::TimerBase::SharedPtr timer;
@@ -15,6 +15,8 @@
 #ifndef RCLCPP__ANY_SUBSCRIPTION_CALLBACK_HPP_
 #define RCLCPP__ANY_SUBSCRIPTION_CALLBACK_HPP_
 
+#include <array>
+#include <cstddef>
 #include <functional>
 #include <memory>
 #include <stdexcept>
@@ -29,8 +31,10 @@
 #include "rclcpp/allocator/allocator_common.hpp"
 #include "rclcpp/detail/subscription_callback_type_helper.hpp"
 #include "rclcpp/function_traits.hpp"
+#include "rclcpp/lazy_message.hpp"
 #include "rclcpp/message_info.hpp"
 #include "rclcpp/serialized_message.hpp"
+#include "rclcpp/tracing.hpp"
 #include "rclcpp/type_adapter.hpp"
 
 
@@ -152,6 +156,11 @@ struct AnySubscriptionCallbackPossibleTypes
     std::function<void (std::shared_ptr<rclcpp::SerializedMessage>)>;
   using SharedPtrSerializedMessageWithInfoCallback =
     std::function<void (std::shared_ptr<rclcpp::SerializedMessage>, const rclcpp::MessageInfo &)>;
+
+  using LazyMessageCallback =
+    std::function<void (const rclcpp::LazyMessage<ROSMessageType> &)>;
+  using LazyMessageWithInfoCallback =
+    std::function<void (const rclcpp::LazyMessage<ROSMessageType> &, const rclcpp::MessageInfo &)>;
 };
 
 /// Template helper to select the variant type based on whether or not MessageT is a TypeAdapter.
@@ -188,7 +197,9 @@ struct AnySubscriptionCallbackHelper<MessageT, AllocatorT, false>
     typename CallbackTypes::SharedPtrCallback,
     typename CallbackTypes::SharedPtrWithInfoCallback,
     typename CallbackTypes::SharedPtrSerializedMessageCallback,
-    typename CallbackTypes::SharedPtrSerializedMessageWithInfoCallback
+    typename CallbackTypes::SharedPtrSerializedMessageWithInfoCallback,
+    typename CallbackTypes::LazyMessageCallback,
+    typename CallbackTypes::LazyMessageWithInfoCallback
   >;
 };
 
@@ -228,7 +239,9 @@ struct AnySubscriptionCallbackHelper<MessageT, AllocatorT, true>
     typename CallbackTypes::SharedPtrWithInfoCallback,
     typename CallbackTypes::SharedPtrWithInfoROSMessageCallback,
     typename CallbackTypes::SharedPtrSerializedMessageCallback,
-    typename CallbackTypes::SharedPtrSerializedMessageWithInfoCallback
+    typename CallbackTypes::SharedPtrSerializedMessageWithInfoCallback,
+    typename CallbackTypes::LazyMessageCallback,
+    typename CallbackTypes::LazyMessageWithInfoCallback
   >;
 };
 
@@ -329,6 +342,10 @@ private:
     typename CallbackTypes::SharedPtrSerializedMessageCallback;
   using SharedPtrSerializedMessageWithInfoCallback =
     typename CallbackTypes::SharedPtrSerializedMessageWithInfoCallback;
+  using LazyMessageCallback =
+    typename CallbackTypes::LazyMessageCallback;
+  using LazyMessageWithInfoCallback =
+    typename CallbackTypes::LazyMessageWithInfoCallback;
 
   template<typename T>
   struct NotNull
@@ -393,6 +410,7 @@ public:
       // Otherwise just assign it.
       callback_variant_ = static_cast<typename scbth::callback_type>(callback);
     }
+    update_dispatch_table();
 
     // Return copy of self for easier testing, normally will be compiled out.
     return *this;
@@ -408,6 +426,7 @@ public:
   set_deprecated(std::function<void(std::shared_ptr<SetT>)> callback)
   {
     callback_variant_ = callback;
+    update_dispatch_table();
   }
 
   /// Function for shared_ptr to non-const MessageT with MessageInfo, which is deprecated.
@@ -422,6 +441,7 @@ public:
   set_deprecated(std::function<void(std::shared_ptr<SetT>, const rclcpp::MessageInfo &)> callback)
   {
     callback_variant_ = callback;
+    update_dispatch_table();
   }
 
   std::unique_ptr<ROSMessageType, ROSMessageTypeDeleter>
@@ -492,98 +512,9 @@ public:
     std::shared_ptr<ROSMessageType> message,
     const rclcpp::MessageInfo & message_info)
   {
-    TRACETOOLS_TRACEPOINT(callback_start, static_cast<const void *>(this), false);
-    // Check if the variant is "unset", throw if it is.
-    if (callback_variant_.index() == 0) {
-      if (std::get<0>(callback_variant_) == nullptr) {
-        // This can happen if it is default initialized, or if it is assigned nullptr.
-        throw std::runtime_error("dispatch called on an unset AnySubscriptionCallback");
-      }
-    }
-    // Dispatch.
-    std::visit(
-      [&message, &message_info, this](auto && callback) {
-        using T = std::decay_t<decltype(callback)>;
-        static constexpr bool is_ta = rclcpp::TypeAdapter<MessageT>::is_specialized::value;
-
-        // conditions for output is custom message
-        if constexpr (is_ta && std::is_same_v<T, ConstRefCallback>) {
-          // TODO(wjwwood): consider avoiding heap allocation for small messages
-          //   maybe something like:
-          // if constexpr (rosidl_generator_traits::has_fixed_size<T> && sizeof(T) < N) {
-          //   ... on stack
-          // }
-          auto local_message = convert_ros_message_to_custom_type_unique_ptr(*message);
-          callback(*local_message);
-        } else if constexpr (is_ta && std::is_same_v<T, ConstRefWithInfoCallback>) {  // NOLINT
-          auto local_message = convert_ros_message_to_custom_type_unique_ptr(*message);
-          callback(*local_message, message_info);
-        } else if constexpr (is_ta && std::is_same_v<T, UniquePtrCallback>) {
-          callback(convert_ros_message_to_custom_type_unique_ptr(*message));
-        } else if constexpr (is_ta && std::is_same_v<T, UniquePtrWithInfoCallback>) {
-          callback(convert_ros_message_to_custom_type_unique_ptr(*message), message_info);
-        } else if constexpr (  // NOLINT[readability/braces]
-          is_ta && (
-            std::is_same_v<T, SharedConstPtrCallback>||
-            std::is_same_v<T, ConstRefSharedConstPtrCallback>||
-            std::is_same_v<T, SharedPtrCallback>
-        ))
-        {
-          callback(convert_ros_message_to_custom_type_unique_ptr(*message));
-        } else if constexpr (  // NOLINT[readability/braces]
-          is_ta && (
-            std::is_same_v<T, SharedConstPtrWithInfoCallback>||
-            std::is_same_v<T, ConstRefSharedConstPtrWithInfoCallback>||
-            std::is_same_v<T, SharedPtrWithInfoCallback>
-        ))
-        {
-          callback(convert_ros_message_to_custom_type_unique_ptr(*message), message_info);
-        }
-        // conditions for output is ros message
-        else if constexpr (std::is_same_v<T, ConstRefROSMessageCallback>) {  // NOLINT
-          callback(*message);
-        } else if constexpr (std::is_same_v<T, ConstRefWithInfoROSMessageCallback>) {
-          callback(*message, message_info);
-        } else if constexpr (std::is_same_v<T, UniquePtrROSMessageCallback>) {
-          callback(create_ros_unique_ptr_from_ros_shared_ptr_message(message));
-        } else if constexpr (std::is_same_v<T, UniquePtrWithInfoROSMessageCallback>) {
-          callback(create_ros_unique_ptr_from_ros_shared_ptr_message(message), message_info);
-        } else if constexpr (  // NOLINT[readability/braces]
-          std::is_same_v<T, SharedConstPtrROSMessageCallback>||
-          std::is_same_v<T, ConstRefSharedConstPtrROSMessageCallback>||
-          std::is_same_v<T, SharedPtrROSMessageCallback>)
-        {
-          callback(message);
-        } else if constexpr (  // NOLINT[readability/braces]
-          std::is_same_v<T, SharedConstPtrWithInfoROSMessageCallback>||
-          std::is_same_v<T, ConstRefSharedConstPtrWithInfoROSMessageCallback>||
-          std::is_same_v<T, SharedPtrWithInfoROSMessageCallback>)
-        {
-          callback(message, message_info);
-        }
-        // condition to catch SerializedMessage types
-        else if constexpr (  // NOLINT[readability/braces]
-          std::is_same_v<T, ConstRefSerializedMessageCallback>||
-          std::is_same_v<T, ConstRefSerializedMessageWithInfoCallback>||
-          std::is_same_v<T, UniquePtrSerializedMessageCallback>||
-          std::is_same_v<T, UniquePtrSerializedMessageWithInfoCallback>||
-          std::is_same_v<T, SharedConstPtrSerializedMessageCallback>||
-          std::is_same_v<T, SharedConstPtrSerializedMessageWithInfoCallback>||
-          std::is_same_v<T, ConstRefSharedConstPtrSerializedMessageCallback>||
-          std::is_same_v<T, ConstRefSharedConstPtrSerializedMessageWithInfoCallback>||
-          std::is_same_v<T, SharedPtrSerializedMessageCallback>||
-          std::is_same_v<T, SharedPtrSerializedMessageWithInfoCallback>)
-        {
-          throw std::runtime_error(
-            "Cannot dispatch std::shared_ptr<ROSMessageType> message "
-            "to rclcpp::SerializedMessage");
-        }
-        // condition to catch unhandled callback types
-        else {  // NOLINT[readability/braces]
-          static_assert(detail::always_false_v<T>, "unhandled callback type");
-        }
-      }, callback_variant_);
-    TRACETOOLS_TRACEPOINT(callback_end, static_cast<const void *>(this));
+    RCLCPP_TRACEPOINT(Callback, callback_start, static_cast<const void *>(this), false);
+    (this->*get_dispatch_table().message)(std::move(message), message_info);
+    RCLCPP_TRACEPOINT(Callback, callback_end, static_cast<const void *>(this));
   }
 
   // Dispatch when input is a serialized message and the output could be anything.
@@ -592,78 +523,9 @@ public:
     std::shared_ptr<rclcpp::SerializedMessage> serialized_message,
     const rclcpp::MessageInfo & message_info)
   {
-    TRACETOOLS_TRACEPOINT(callback_start, static_cast<const void *>(this), false);
-    // Check if the variant is "unset", throw if it is.
-    if (callback_variant_.index() == 0) {
-      if (std::get<0>(callback_variant_) == nullptr) {
-        // This can happen if it is default initialized, or if it is assigned nullptr.
-        throw std::runtime_error("dispatch called on an unset AnySubscriptionCallback");
-      }
-    }
-    // Dispatch.
-    std::visit(
-      [&serialized_message, &message_info, this](auto && callback) {
-        using T = std::decay_t<decltype(callback)>;
-
-        // condition to catch SerializedMessage types
-        if constexpr (std::is_same_v<T, ConstRefSerializedMessageCallback>) {
-          callback(*serialized_message);
-        } else if constexpr (std::is_same_v<T, ConstRefSerializedMessageWithInfoCallback>) {
-          callback(*serialized_message, message_info);
-        } else if constexpr (std::is_same_v<T, UniquePtrSerializedMessageCallback>) {
-          callback(create_serialized_message_unique_ptr_from_shared_ptr(serialized_message));
-        } else if constexpr (std::is_same_v<T, UniquePtrSerializedMessageWithInfoCallback>) {
-          callback(
-            create_serialized_message_unique_ptr_from_shared_ptr(serialized_message),
-            message_info);
-        } else if constexpr (  // NOLINT[readability/braces]
-          std::is_same_v<T, SharedConstPtrSerializedMessageCallback>||
-          std::is_same_v<T, ConstRefSharedConstPtrSerializedMessageCallback>||
-          std::is_same_v<T, SharedPtrSerializedMessageCallback>)
-        {
-          callback(create_serialized_message_unique_ptr_from_shared_ptr(serialized_message));
-        } else if constexpr (  // NOLINT[readability/braces]
-          std::is_same_v<T, SharedConstPtrSerializedMessageWithInfoCallback>||
-          std::is_same_v<T, ConstRefSharedConstPtrSerializedMessageWithInfoCallback>||
-          std::is_same_v<T, SharedPtrSerializedMessageWithInfoCallback>)
-        {
-          callback(
-            create_serialized_message_unique_ptr_from_shared_ptr(serialized_message),
-            message_info);
-        }
-        // conditions for output anything else
-        else if constexpr (  // NOLINT[whitespace/newline]
-          std::is_same_v<T, ConstRefCallback>||
-          std::is_same_v<T, ConstRefROSMessageCallback>||
-          std::is_same_v<T, ConstRefWithInfoCallback>||
-          std::is_same_v<T, ConstRefWithInfoROSMessageCallback>||
-          std::is_same_v<T, UniquePtrCallback>||
-          std::is_same_v<T, UniquePtrROSMessageCallback>||
-          std::is_same_v<T, UniquePtrWithInfoCallback>||
-          std::is_same_v<T, UniquePtrWithInfoROSMessageCallback>||
-          std::is_same_v<T, SharedConstPtrCallback>||
-          std::is_same_v<T, SharedConstPtrROSMessageCallback>||
-          std::is_same_v<T, SharedConstPtrWithInfoCallback>||
-          std::is_same_v<T, SharedConstPtrWithInfoROSMessageCallback>||
-          std::is_same_v<T, ConstRefSharedConstPtrCallback>||
-          std::is_same_v<T, ConstRefSharedConstPtrROSMessageCallback>||
-          std::is_same_v<T, ConstRefSharedConstPtrWithInfoCallback>||
-          std::is_same_v<T, ConstRefSharedConstPtrWithInfoROSMessageCallback>||
-          std::is_same_v<T, SharedPtrCallback>||
-          std::is_same_v<T, SharedPtrROSMessageCallback>||
-          std::is_same_v<T, SharedPtrWithInfoCallback>||
-          std::is_same_v<T, SharedPtrWithInfoROSMessageCallback>)
-        {
-          throw std::runtime_error(
-            "cannot dispatch rclcpp::SerializedMessage to "
-            "non-rclcpp::SerializedMessage callbacks");
-        }
-        // condition to catch unhandled callback types
-        else {  // NOLINT[readability/braces]
-          static_assert(detail::always_false_v<T>, "unhandled callback type");
-        }
-      }, callback_variant_);
-    TRACETOOLS_TRACEPOINT(callback_end, static_cast<const void *>(this));
+    RCLCPP_TRACEPOINT(Callback, callback_start, static_cast<const void *>(this), false);
+    (this->*get_dispatch_table().serialized_message)(std::move(serialized_message), message_info);
+    RCLCPP_TRACEPOINT(Callback, callback_end, static_cast<const void *>(this));
   }
 
   void
@@ -671,129 +533,9 @@ public:
     std::shared_ptr<const SubscribedType> message,
     const rclcpp::MessageInfo & message_info)
   {
-    TRACETOOLS_TRACEPOINT(callback_start, static_cast<const void *>(this), true);
-    // Check if the variant is "unset", throw if it is.
-    if (callback_variant_.index() == 0) {
-      if (std::get<0>(callback_variant_) == nullptr) {
-        // This can happen if it is default initialized, or if it is assigned nullptr.
-        throw std::runtime_error("dispatch called on an unset AnySubscriptionCallback");
-      }
-    }
-    // Dispatch.
-    std::visit(
-      [&message, &message_info, this](auto && callback) {
-        using T = std::decay_t<decltype(callback)>;
-        static constexpr bool is_ta = rclcpp::TypeAdapter<MessageT>::is_specialized::value;
-
-        // conditions for custom type
-        if constexpr (is_ta && std::is_same_v<T, ConstRefCallback>) {
-          callback(*message);
-        } else if constexpr (is_ta && std::is_same_v<T, ConstRefWithInfoCallback>) {  // NOLINT
-          callback(*message, message_info);
-        } else if constexpr (  // NOLINT[readability/braces]
-          is_ta && (
-            std::is_same_v<T, UniquePtrCallback>||
-            std::is_same_v<T, SharedPtrCallback>
-        ))
-        {
-          callback(create_custom_unique_ptr_from_custom_shared_ptr_message(message));
-        } else if constexpr (  // NOLINT[readability/braces]
-          is_ta && (
-            std::is_same_v<T, UniquePtrWithInfoCallback>||
-            std::is_same_v<T, SharedPtrWithInfoCallback>
-        ))
-        {
-          callback(create_custom_unique_ptr_from_custom_shared_ptr_message(message), message_info);
-        } else if constexpr (  // NOLINT[readability/braces]
-          is_ta && (
-            std::is_same_v<T, SharedConstPtrCallback>||
-            std::is_same_v<T, ConstRefSharedConstPtrCallback>
-        ))
-        {
-          callback(message);
-        } else if constexpr (  // NOLINT[readability/braces]
-          is_ta && (
-            std::is_same_v<T, SharedConstPtrWithInfoCallback>||
-            std::is_same_v<T, ConstRefSharedConstPtrWithInfoCallback>
-        ))
-        {
-          callback(message, message_info);
-        }
-        // conditions for ros message type
-        else if constexpr (std::is_same_v<T, ConstRefROSMessageCallback>) {  // NOLINT[readability/braces]
-          if constexpr (is_ta) {
-            auto local = convert_custom_type_to_ros_message_unique_ptr(*message);
-            callback(*local);
-          } else {
-            callback(*message);
-          }
-        } else if constexpr (std::is_same_v<T, ConstRefWithInfoROSMessageCallback>) {  // NOLINT[readability/braces]
-          if constexpr (is_ta) {
-            auto local = convert_custom_type_to_ros_message_unique_ptr(*message);
-            callback(*local, message_info);
-          } else {
-            callback(*message, message_info);
-          }
-        } else if constexpr (  // NOLINT[readability/braces]
-          std::is_same_v<T, UniquePtrROSMessageCallback>||
-          std::is_same_v<T, SharedPtrROSMessageCallback>)
-        {
-          if constexpr (is_ta) {
-            callback(convert_custom_type_to_ros_message_unique_ptr(*message));
-          } else {
-            callback(create_ros_unique_ptr_from_ros_shared_ptr_message(message));
-          }
-        } else if constexpr (  // NOLINT[readability/braces]
-          std::is_same_v<T, UniquePtrWithInfoROSMessageCallback>||
-          std::is_same_v<T, SharedPtrWithInfoROSMessageCallback>)
-        {
-          if constexpr (is_ta) {
-            callback(convert_custom_type_to_ros_message_unique_ptr(*message), message_info);
-          } else {
-            callback(create_ros_unique_ptr_from_ros_shared_ptr_message(message), message_info);
-          }
-        } else if constexpr (  // NOLINT[readability/braces]
-          std::is_same_v<T, SharedConstPtrROSMessageCallback>||
-          std::is_same_v<T, ConstRefSharedConstPtrROSMessageCallback>)
-        {
-          if constexpr (is_ta) {
-            callback(convert_custom_type_to_ros_message_unique_ptr(*message));
-          } else {
-            callback(message);
-          }
-        } else if constexpr (  // NOLINT[readability/braces]
-          std::is_same_v<T, SharedConstPtrWithInfoROSMessageCallback>||
-          std::is_same_v<T, ConstRefSharedConstPtrWithInfoROSMessageCallback>)
-        {
-          if constexpr (is_ta) {
-            callback(convert_custom_type_to_ros_message_unique_ptr(*message), message_info);
-          } else {
-            callback(message, message_info);
-          }
-        }
-        // condition to catch SerializedMessage types
-        else if constexpr (  // NOLINT[readability/braces]
-          std::is_same_v<T, ConstRefSerializedMessageCallback>||
-          std::is_same_v<T, ConstRefSerializedMessageWithInfoCallback>||
-          std::is_same_v<T, UniquePtrSerializedMessageCallback>||
-          std::is_same_v<T, UniquePtrSerializedMessageWithInfoCallback>||
-          std::is_same_v<T, SharedConstPtrSerializedMessageCallback>||
-          std::is_same_v<T, SharedConstPtrSerializedMessageWithInfoCallback>||
-          std::is_same_v<T, ConstRefSharedConstPtrSerializedMessageCallback>||
-          std::is_same_v<T, ConstRefSharedConstPtrSerializedMessageWithInfoCallback>||
-          std::is_same_v<T, SharedPtrSerializedMessageCallback>||
-          std::is_same_v<T, SharedPtrSerializedMessageWithInfoCallback>)
-        {
-          throw std::runtime_error(
-            "Cannot dispatch std::shared_ptr<const ROSMessageType> message "
-            "to rclcpp::SerializedMessage");
-        }
-        // condition to catch unhandled callback types
-        else {  // NOLINT[readability/braces]
-          static_assert(detail::always_false_v<T>, "unhandled callback type");
-        }
-      }, callback_variant_);
-    TRACETOOLS_TRACEPOINT(callback_end, static_cast<const void *>(this));
+    RCLCPP_TRACEPOINT(Callback, callback_start, static_cast<const void *>(this), true);
+    (this->*get_dispatch_table().intra_process_shared_message)(std::move(message), message_info);
+    RCLCPP_TRACEPOINT(Callback, callback_end, static_cast<const void *>(this));
   }
 
   void
@@ -801,133 +543,9 @@ public:
     std::unique_ptr<SubscribedType, SubscribedTypeDeleter> message,
     const rclcpp::MessageInfo & message_info)
   {
-    TRACETOOLS_TRACEPOINT(callback_start, static_cast<const void *>(this), true);
-    // Check if the variant is "unset", throw if it is.
-    if (callback_variant_.index() == 0) {
-      if (std::get<0>(callback_variant_) == nullptr) {
-        // This can happen if it is default initialized, or if it is assigned nullptr.
-        throw std::runtime_error("dispatch called on an unset AnySubscriptionCallback");
-      }
-    }
-    // Dispatch.
-    std::visit(
-      [&message, &message_info, this](auto && callback) {
-        // clang complains that 'this' lambda capture is unused, which is true
-        // in *some* specializations of this template, but not others.  Just
-        // quiet it down.
-        (void)this;
-
-        using T = std::decay_t<decltype(callback)>;
-        static constexpr bool is_ta = rclcpp::TypeAdapter<MessageT>::is_specialized::value;
-
-        // conditions for custom type
-        if constexpr (is_ta && std::is_same_v<T, ConstRefCallback>) {
-          callback(*message);
-        } else if constexpr (is_ta && std::is_same_v<T, ConstRefWithInfoCallback>) {  // NOLINT
-          callback(*message, message_info);
-        } else if constexpr (  // NOLINT[readability/braces]
-          is_ta && (
-            std::is_same_v<T, UniquePtrCallback>||
-            std::is_same_v<T, SharedPtrCallback>))
-        {
-          callback(std::move(message));
-        } else if constexpr (  // NOLINT[readability/braces]
-          is_ta && (
-            std::is_same_v<T, UniquePtrWithInfoCallback>||
-            std::is_same_v<T, SharedPtrWithInfoCallback>
-        ))
-        {
-          callback(std::move(message), message_info);
-        } else if constexpr (  // NOLINT[readability/braces]
-          is_ta && (
-            std::is_same_v<T, SharedConstPtrCallback>||
-            std::is_same_v<T, ConstRefSharedConstPtrCallback>
-        ))
-        {
-          callback(std::move(message));
-        } else if constexpr (  // NOLINT[readability/braces]
-          is_ta && (
-            std::is_same_v<T, SharedConstPtrWithInfoCallback>||
-            std::is_same_v<T, ConstRefSharedConstPtrWithInfoCallback>
-        ))
-        {
-          callback(std::move(message), message_info);
-        }
-        // conditions for ros message type
-        else if constexpr (std::is_same_v<T, ConstRefROSMessageCallback>) {  // NOLINT[readability/braces]
-          if constexpr (is_ta) {
-            auto local = convert_custom_type_to_ros_message_unique_ptr(*message);
-            callback(*local);
-          } else {
-            callback(*message);
-          }
-        } else if constexpr (std::is_same_v<T, ConstRefWithInfoROSMessageCallback>) {  // NOLINT[readability/braces]
-          if constexpr (is_ta) {
-            auto local = convert_custom_type_to_ros_message_unique_ptr(*message);
-            callback(*local, message_info);
-          } else {
-            callback(*message, message_info);
-          }
-        } else if constexpr (  // NOLINT[readability/braces]
-          std::is_same_v<T, UniquePtrROSMessageCallback>||
-          std::is_same_v<T, SharedPtrROSMessageCallback>)
-        {
-          if constexpr (is_ta) {
-            callback(convert_custom_type_to_ros_message_unique_ptr(*message));
-          } else {
-            callback(std::move(message));
-          }
-        } else if constexpr (  // NOLINT[readability/braces]
-          std::is_same_v<T, UniquePtrWithInfoROSMessageCallback>||
-          std::is_same_v<T, SharedPtrWithInfoROSMessageCallback>)
-        {
-          if constexpr (is_ta) {
-            callback(convert_custom_type_to_ros_message_unique_ptr(*message), message_info);
-          } else {
-            callback(std::move(message), message_info);
-          }
-        } else if constexpr (  // NOLINT[readability/braces]
-          std::is_same_v<T, SharedConstPtrROSMessageCallback>||
-          std::is_same_v<T, ConstRefSharedConstPtrROSMessageCallback>)
-        {
-          if constexpr (is_ta) {
-            callback(convert_custom_type_to_ros_message_unique_ptr(*message));
-          } else {
-            callback(std::move(message));
-          }
-        } else if constexpr (  // NOLINT[readability/braces]
-          std::is_same_v<T, SharedConstPtrWithInfoROSMessageCallback>||
-          std::is_same_v<T, ConstRefSharedConstPtrWithInfoROSMessageCallback>)
-        {
-          if constexpr (is_ta) {
-            callback(convert_custom_type_to_ros_message_unique_ptr(*message), message_info);
-          } else {
-            callback(std::move(message), message_info);
-          }
-        }
-        // condition to catch SerializedMessage types
-        else if constexpr (  // NOLINT[readability/braces]
-          std::is_same_v<T, ConstRefSerializedMessageCallback>||
-          std::is_same_v<T, ConstRefSerializedMessageWithInfoCallback>||
-          std::is_same_v<T, UniquePtrSerializedMessageCallback>||
-          std::is_same_v<T, UniquePtrSerializedMessageWithInfoCallback>||
-          std::is_same_v<T, SharedConstPtrSerializedMessageCallback>||
-          std::is_same_v<T, SharedConstPtrSerializedMessageWithInfoCallback>||
-          std::is_same_v<T, ConstRefSharedConstPtrSerializedMessageCallback>||
-          std::is_same_v<T, ConstRefSharedConstPtrSerializedMessageWithInfoCallback>||
-          std::is_same_v<T, SharedPtrSerializedMessageCallback>||
-          std::is_same_v<T, SharedPtrSerializedMessageWithInfoCallback>)
-        {
-          throw std::runtime_error(
-            "Cannot dispatch std::unique_ptr<ROSMessageType, ROSMessageTypeDeleter> message "
-            "to rclcpp::SerializedMessage");
-        }
-        // condition to catch unhandled callback types
-        else {  // NOLINT[readability/braces]
-          static_assert(detail::always_false_v<T>, "unhandled callback type");
-        }
-      }, callback_variant_);
-    TRACETOOLS_TRACEPOINT(callback_end, static_cast<const void *>(this));
+    RCLCPP_TRACEPOINT(Callback, callback_start, static_cast<const void *>(this), true);
+    (this->*get_dispatch_table().intra_process_unique_message)(std::move(message), message_info);
+    RCLCPP_TRACEPOINT(Callback, callback_end, static_cast<const void *>(this));
   }
 
   constexpr
@@ -941,6 +559,50 @@ public:
       std::holds_alternative<ConstRefSharedConstPtrWithInfoCallback>(callback_variant_);
   }
 
+  /// Return true if the callback only reads the message, through a const reference.
+  /**
+   * Such a callback doesn't need a message of its own, so it can be given a message shared with
+   * other subscriptions, or owned, without copying it.
+   * Callbacks taking a LazyMessage only read it too.
+   */
+  constexpr
+  bool
+  use_const_reference_method() const
+  {
+    return
+      std::holds_alternative<ConstRefCallback>(callback_variant_) ||
+      std::holds_alternative<ConstRefWithInfoCallback>(callback_variant_) ||
+      std::holds_alternative<ConstRefROSMessageCallback>(callback_variant_) ||
+      std::holds_alternative<ConstRefWithInfoROSMessageCallback>(callback_variant_) ||
+      is_lazy_message_callback();
+  }
+
+  /// Return true if the callback takes the MessageInfo of the messages.
+  constexpr
+  bool
+  uses_message_info() const
+  {
+    return
+      std::holds_alternative<ConstRefWithInfoCallback>(callback_variant_) ||
+      std::holds_alternative<ConstRefWithInfoROSMessageCallback>(callback_variant_) ||
+      std::holds_alternative<ConstRefSerializedMessageWithInfoCallback>(callback_variant_) ||
+      std::holds_alternative<UniquePtrWithInfoCallback>(callback_variant_) ||
+      std::holds_alternative<UniquePtrWithInfoROSMessageCallback>(callback_variant_) ||
+      std::holds_alternative<UniquePtrSerializedMessageWithInfoCallback>(callback_variant_) ||
+      std::holds_alternative<SharedConstPtrWithInfoCallback>(callback_variant_) ||
+      std::holds_alternative<SharedConstPtrWithInfoROSMessageCallback>(callback_variant_) ||
+      std::holds_alternative<SharedConstPtrSerializedMessageWithInfoCallback>(callback_variant_) ||
+      std::holds_alternative<ConstRefSharedConstPtrWithInfoCallback>(callback_variant_) ||
+      std::holds_alternative<ConstRefSharedConstPtrWithInfoROSMessageCallback>(callback_variant_) ||
+      std::holds_alternative<ConstRefSharedConstPtrSerializedMessageWithInfoCallback>(
+      callback_variant_) ||
+      std::holds_alternative<SharedPtrWithInfoCallback>(callback_variant_) ||
+      std::holds_alternative<SharedPtrWithInfoROSMessageCallback>(callback_variant_) ||
+      std::holds_alternative<SharedPtrSerializedMessageWithInfoCallback>(callback_variant_) ||
+      std::holds_alternative<LazyMessageWithInfoCallback>(callback_variant_);
+  }
+
+  /// Return true if the callback takes serialized messages, including as a LazyMessage.
   constexpr
   bool
   is_serialized_message_callback() const
@@ -956,7 +618,18 @@ public:
       std::holds_alternative<SharedConstPtrSerializedMessageWithInfoCallback>(callback_variant_) ||
       std::holds_alternative<ConstRefSharedConstPtrSerializedMessageWithInfoCallback>(
       callback_variant_) ||
-      std::holds_alternative<SharedPtrSerializedMessageWithInfoCallback>(callback_variant_);
+      std::holds_alternative<SharedPtrSerializedMessageWithInfoCallback>(callback_variant_) ||
+      is_lazy_message_callback();
+  }
+
+  /// Return true if the callback takes a LazyMessage, deserialized when it's accessed.
+  constexpr
+  bool
+  is_lazy_message_callback() const
+  {
+    return
+      std::holds_alternative<LazyMessageCallback>(callback_variant_) ||
+      std::holds_alternative<LazyMessageWithInfoCallback>(callback_variant_);
   }
 
   void
@@ -990,6 +663,535 @@ public:
   }
 
 private:
+  /// Member functions dispatching messages to the callback of one alternative of the variant.
+  struct DispatchTable
+  {
+    void (AnySubscriptionCallback::* message)(
+      std::shared_ptr<ROSMessageType>, const rclcpp::MessageInfo &);
+    void (AnySubscriptionCallback::* serialized_message)(
+      std::shared_ptr<rclcpp::SerializedMessage>, const rclcpp::MessageInfo &);
+    void (AnySubscriptionCallback::* intra_process_shared_message)(
+      std::shared_ptr<const SubscribedType>, const rclcpp::MessageInfo &);
+    void (AnySubscriptionCallback::* intra_process_unique_message)(
+      std::unique_ptr<SubscribedType, SubscribedTypeDeleter>, const rclcpp::MessageInfo &);
+  };
+
+  template<size_t ... Is>
+  static constexpr std::array<DispatchTable, sizeof...(Is)>
+  make_dispatch_tables(std::index_sequence<Is...>)
+  {
+    return {{
+      {
+        &AnySubscriptionCallback::template dispatch_message<Is>,
+        &AnySubscriptionCallback::template dispatch_serialized_message<Is>,
+        &AnySubscriptionCallback::template dispatch_intra_process_shared_message<Is>,
+        &AnySubscriptionCallback::template dispatch_intra_process_unique_message<Is>,
+      }...
+    }};
+  }
+
+  /// Resolve the dispatch table of the alternative held by the variant.
+  void
+  update_dispatch_table()
+  {
+    static constexpr auto dispatch_tables = make_dispatch_tables(
+      std::make_index_sequence<std::variant_size_v<typename HelperT::variant_type>>());
+    if (callback_variant_.valueless_by_exception()) {
+      throw std::bad_variant_access();
+    }
+    dispatch_table_ = &dispatch_tables[callback_variant_.index()];
+    dispatch_table_index_ = callback_variant_.index();
+  }
+
+  /// Get the dispatch table of the alternative held by the variant.
+  const DispatchTable &
+  get_dispatch_table()
+  {
+    // The variant may have been assigned through get_variant() since the last dispatch
+    if (dispatch_table_index_ != callback_variant_.index()) {
+      update_dispatch_table();
+    }
+    return *dispatch_table_;
+  }
+
+  /// Get the callback of the given alternative, which must be the one held by the variant.
+  template<size_t I>
+  std::variant_alternative_t<I, typename HelperT::variant_type> &
+  get_callback()
+  {
+    auto & callback = *std::get_if<I>(&callback_variant_);
+    if constexpr (I == 0) {
+      // Check if the variant is "unset", throw if it is.
+      if (callback == nullptr) {
+        // This can happen if it is default initialized, or if it is assigned nullptr.
+        throw std::runtime_error("dispatch called on an unset AnySubscriptionCallback");
+      }
+    }
+    return callback;
+  }
+
+  /// Dispatch a ros message to the callback of the given alternative.
+  template<size_t I>
+  void
+  dispatch_message(
+    std::shared_ptr<ROSMessageType> message,
+    const rclcpp::MessageInfo & message_info)
+  {
+    using T = std::variant_alternative_t<I, typename HelperT::variant_type>;
+    static constexpr bool is_ta = rclcpp::TypeAdapter<MessageT>::is_specialized::value;
+    T & callback = get_callback<I>();
+    // Not all the callback signatures use all of these
+    (void)callback;
+    (void)message;
+    (void)message_info;
+
+    // conditions for output is custom message
+    if constexpr (is_ta && std::is_same_v<T, ConstRefCallback>) {
+      // TODO(wjwwood): consider avoiding heap allocation for small messages
+      //   maybe something like:
+      // if constexpr (rosidl_generator_traits::has_fixed_size<T> && sizeof(T) < N) {
+      //   ... on stack
+      // }
+      auto local_message = convert_ros_message_to_custom_type_unique_ptr(*message);
+      callback(*local_message);
+    } else if constexpr (is_ta && std::is_same_v<T, ConstRefWithInfoCallback>) {  // NOLINT
+      auto local_message = convert_ros_message_to_custom_type_unique_ptr(*message);
+      callback(*local_message, message_info);
+    } else if constexpr (is_ta && std::is_same_v<T, UniquePtrCallback>) {
+      callback(convert_ros_message_to_custom_type_unique_ptr(*message));
+    } else if constexpr (is_ta && std::is_same_v<T, UniquePtrWithInfoCallback>) {
+      callback(convert_ros_message_to_custom_type_unique_ptr(*message), message_info);
+    } else if constexpr (  // NOLINT[readability/braces]
+      is_ta && (
+        std::is_same_v<T, SharedConstPtrCallback>||
+        std::is_same_v<T, ConstRefSharedConstPtrCallback>||
+        std::is_same_v<T, SharedPtrCallback>
+    ))
+    {
+      callback(convert_ros_message_to_custom_type_unique_ptr(*message));
+    } else if constexpr (  // NOLINT[readability/braces]
+      is_ta && (
+        std::is_same_v<T, SharedConstPtrWithInfoCallback>||
+        std::is_same_v<T, ConstRefSharedConstPtrWithInfoCallback>||
+        std::is_same_v<T, SharedPtrWithInfoCallback>
+    ))
+    {
+      callback(convert_ros_message_to_custom_type_unique_ptr(*message), message_info);
+    }
+    // conditions for output is ros message
+    else if constexpr (std::is_same_v<T, ConstRefROSMessageCallback>) {  // NOLINT
+      callback(*message);
+    } else if constexpr (std::is_same_v<T, ConstRefWithInfoROSMessageCallback>) {
+      callback(*message, message_info);
+    } else if constexpr (std::is_same_v<T, UniquePtrROSMessageCallback>) {
+      callback(create_ros_unique_ptr_from_ros_shared_ptr_message(message));
+    } else if constexpr (std::is_same_v<T, UniquePtrWithInfoROSMessageCallback>) {
+      callback(create_ros_unique_ptr_from_ros_shared_ptr_message(message), message_info);
+    } else if constexpr (  // NOLINT[readability/braces]
+      std::is_same_v<T, SharedConstPtrROSMessageCallback>||
+      std::is_same_v<T, ConstRefSharedConstPtrROSMessageCallback>||
+      std::is_same_v<T, SharedPtrROSMessageCallback>)
+    {
+      callback(std::move(message));
+    } else if constexpr (  // NOLINT[readability/braces]
+      std::is_same_v<T, SharedConstPtrWithInfoROSMessageCallback>||
+      std::is_same_v<T, ConstRefSharedConstPtrWithInfoROSMessageCallback>||
+      std::is_same_v<T, SharedPtrWithInfoROSMessageCallback>)
+    {
+      callback(std::move(message), message_info);
+    }
+    // conditions for output is a lazy message, already deserialized
+    else if constexpr (std::is_same_v<T, LazyMessageCallback>) {  // NOLINT[readability/braces]
+      callback(
+        LazyMessage<ROSMessageType>(std::shared_ptr<const ROSMessageType>(std::move(message))));
+    } else if constexpr (std::is_same_v<T, LazyMessageWithInfoCallback>) {
+      callback(
+        LazyMessage<ROSMessageType>(std::shared_ptr<const ROSMessageType>(std::move(message))),
+        message_info);
+    }
+    // condition to catch SerializedMessage types
+    else if constexpr (  // NOLINT[readability/braces]
+      std::is_same_v<T, ConstRefSerializedMessageCallback>||
+      std::is_same_v<T, ConstRefSerializedMessageWithInfoCallback>||
+      std::is_same_v<T, UniquePtrSerializedMessageCallback>||
+      std::is_same_v<T, UniquePtrSerializedMessageWithInfoCallback>||
+      std::is_same_v<T, SharedConstPtrSerializedMessageCallback>||
+      std::is_same_v<T, SharedConstPtrSerializedMessageWithInfoCallback>||
+      std::is_same_v<T, ConstRefSharedConstPtrSerializedMessageCallback>||
+      std::is_same_v<T, ConstRefSharedConstPtrSerializedMessageWithInfoCallback>||
+      std::is_same_v<T, SharedPtrSerializedMessageCallback>||
+      std::is_same_v<T, SharedPtrSerializedMessageWithInfoCallback>)
+    {
+      throw std::runtime_error(
+        "Cannot dispatch std::shared_ptr<ROSMessageType> message "
+        "to rclcpp::SerializedMessage");
+    }
+    // condition to catch unhandled callback types
+    else {  // NOLINT[readability/braces]
+      static_assert(detail::always_false_v<T>, "unhandled callback type");
+    }
+  }
+
+  /// Dispatch a serialized message to the callback of the given alternative.
+  template<size_t I>
+  void
+  dispatch_serialized_message(
+    std::shared_ptr<rclcpp::SerializedMessage> serialized_message,
+    const rclcpp::MessageInfo & message_info)
+  {
+    using T = std::variant_alternative_t<I, typename HelperT::variant_type>;
+    T & callback = get_callback<I>();
+    // Not all the callback signatures use all of these
+    (void)callback;
+    (void)serialized_message;
+    (void)message_info;
+
+    // condition to catch SerializedMessage types
+    if constexpr (std::is_same_v<T, ConstRefSerializedMessageCallback>) {
+      callback(*serialized_message);
+    } else if constexpr (std::is_same_v<T, ConstRefSerializedMessageWithInfoCallback>) {
+      callback(*serialized_message, message_info);
+    } else if constexpr (std::is_same_v<T, UniquePtrSerializedMessageCallback>) {
+      callback(create_serialized_message_unique_ptr_from_shared_ptr(serialized_message));
+    } else if constexpr (std::is_same_v<T, UniquePtrSerializedMessageWithInfoCallback>) {
+      callback(
+        create_serialized_message_unique_ptr_from_shared_ptr(serialized_message),
+        message_info);
+    } else if constexpr (  // NOLINT[readability/braces]
+      std::is_same_v<T, SharedConstPtrSerializedMessageCallback>||
+      std::is_same_v<T, ConstRefSharedConstPtrSerializedMessageCallback>||
+      std::is_same_v<T, SharedPtrSerializedMessageCallback>)
+    {
+      callback(create_serialized_message_unique_ptr_from_shared_ptr(serialized_message));
+    } else if constexpr (  // NOLINT[readability/braces]
+      std::is_same_v<T, SharedConstPtrSerializedMessageWithInfoCallback>||
+      std::is_same_v<T, ConstRefSharedConstPtrSerializedMessageWithInfoCallback>||
+      std::is_same_v<T, SharedPtrSerializedMessageWithInfoCallback>)
+    {
+      callback(
+        create_serialized_message_unique_ptr_from_shared_ptr(serialized_message),
+        message_info);
+    }
+    // conditions for output is a lazy message, sharing the serialized message
+    else if constexpr (std::is_same_v<T, LazyMessageCallback>) {  // NOLINT[readability/braces]
+      callback(LazyMessage<ROSMessageType>(std::move(serialized_message)));
+    } else if constexpr (std::is_same_v<T, LazyMessageWithInfoCallback>) {
+      callback(LazyMessage<ROSMessageType>(std::move(serialized_message)), message_info);
+    }
+    // conditions for output anything else
+    else if constexpr (  // NOLINT[whitespace/newline]
+      std::is_same_v<T, ConstRefCallback>||
+      std::is_same_v<T, ConstRefROSMessageCallback>||
+      std::is_same_v<T, ConstRefWithInfoCallback>||
+      std::is_same_v<T, ConstRefWithInfoROSMessageCallback>||
+      std::is_same_v<T, UniquePtrCallback>||
+      std::is_same_v<T, UniquePtrROSMessageCallback>||
+      std::is_same_v<T, UniquePtrWithInfoCallback>||
+      std::is_same_v<T, UniquePtrWithInfoROSMessageCallback>||
+      std::is_same_v<T, SharedConstPtrCallback>||
+      std::is_same_v<T, SharedConstPtrROSMessageCallback>||
+      std::is_same_v<T, SharedConstPtrWithInfoCallback>||
+      std::is_same_v<T, SharedConstPtrWithInfoROSMessageCallback>||
+      std::is_same_v<T, ConstRefSharedConstPtrCallback>||
+      std::is_same_v<T, ConstRefSharedConstPtrROSMessageCallback>||
+      std::is_same_v<T, ConstRefSharedConstPtrWithInfoCallback>||
+      std::is_same_v<T, ConstRefSharedConstPtrWithInfoROSMessageCallback>||
+      std::is_same_v<T, SharedPtrCallback>||
+      std::is_same_v<T, SharedPtrROSMessageCallback>||
+      std::is_same_v<T, SharedPtrWithInfoCallback>||
+      std::is_same_v<T, SharedPtrWithInfoROSMessageCallback>)
+    {
+      throw std::runtime_error(
+        "cannot dispatch rclcpp::SerializedMessage to "
+        "non-rclcpp::SerializedMessage callbacks");
+    }
+    // condition to catch unhandled callback types
+    else {  // NOLINT[readability/braces]
+      static_assert(detail::always_false_v<T>, "unhandled callback type");
+    }
+  }
+
+  /// Dispatch a shared intra-process message to the callback of the given alternative.
+  template<size_t I>
+  void
+  dispatch_intra_process_shared_message(
+    std::shared_ptr<const SubscribedType> message,
+    const rclcpp::MessageInfo & message_info)
+  {
+    using T = std::variant_alternative_t<I, typename HelperT::variant_type>;
+    static constexpr bool is_ta = rclcpp::TypeAdapter<MessageT>::is_specialized::value;
+    T & callback = get_callback<I>();
+    // Not all the callback signatures use all of these
+    (void)callback;
+    (void)message;
+    (void)message_info;
+
+    // conditions for custom type
+    if constexpr (is_ta && std::is_same_v<T, ConstRefCallback>) {
+      callback(*message);
+    } else if constexpr (is_ta && std::is_same_v<T, ConstRefWithInfoCallback>) {  // NOLINT
+      callback(*message, message_info);
+    } else if constexpr (  // NOLINT[readability/braces]
+      is_ta && (
+        std::is_same_v<T, UniquePtrCallback>||
+        std::is_same_v<T, SharedPtrCallback>
+    ))
+    {
+      callback(create_custom_unique_ptr_from_custom_shared_ptr_message(message));
+    } else if constexpr (  // NOLINT[readability/braces]
+      is_ta && (
+        std::is_same_v<T, UniquePtrWithInfoCallback>||
+        std::is_same_v<T, SharedPtrWithInfoCallback>
+    ))
+    {
+      callback(create_custom_unique_ptr_from_custom_shared_ptr_message(message), message_info);
+    } else if constexpr (  // NOLINT[readability/braces]
+      is_ta && (
+        std::is_same_v<T, SharedConstPtrCallback>||
+        std::is_same_v<T, ConstRefSharedConstPtrCallback>
+    ))
+    {
+      callback(std::move(message));
+    } else if constexpr (  // NOLINT[readability/braces]
+      is_ta && (
+        std::is_same_v<T, SharedConstPtrWithInfoCallback>||
+        std::is_same_v<T, ConstRefSharedConstPtrWithInfoCallback>
+    ))
+    {
+      callback(std::move(message), message_info);
+    }
+    // conditions for ros message type
+    else if constexpr (std::is_same_v<T, ConstRefROSMessageCallback>) {  // NOLINT[readability/braces]
+      if constexpr (is_ta) {
+        auto local = convert_custom_type_to_ros_message_unique_ptr(*message);
+        callback(*local);
+      } else {
+        callback(*message);
+      }
+    } else if constexpr (std::is_same_v<T, ConstRefWithInfoROSMessageCallback>) {  // NOLINT[readability/braces]
+      if constexpr (is_ta) {
+        auto local = convert_custom_type_to_ros_message_unique_ptr(*message);
+        callback(*local, message_info);
+      } else {
+        callback(*message, message_info);
+      }
+    } else if constexpr (  // NOLINT[readability/braces]
+      std::is_same_v<T, UniquePtrROSMessageCallback>||
+      std::is_same_v<T, SharedPtrROSMessageCallback>)
+    {
+      if constexpr (is_ta) {
+        callback(convert_custom_type_to_ros_message_unique_ptr(*message));
+      } else {
+        callback(create_ros_unique_ptr_from_ros_shared_ptr_message(message));
+      }
+    } else if constexpr (  // NOLINT[readability/braces]
+      std::is_same_v<T, UniquePtrWithInfoROSMessageCallback>||
+      std::is_same_v<T, SharedPtrWithInfoROSMessageCallback>)
+    {
+      if constexpr (is_ta) {
+        callback(convert_custom_type_to_ros_message_unique_ptr(*message), message_info);
+      } else {
+        callback(create_ros_unique_ptr_from_ros_shared_ptr_message(message), message_info);
+      }
+    } else if constexpr (  // NOLINT[readability/braces]
+      std::is_same_v<T, SharedConstPtrROSMessageCallback>||
+      std::is_same_v<T, ConstRefSharedConstPtrROSMessageCallback>)
+    {
+      if constexpr (is_ta) {
+        callback(convert_custom_type_to_ros_message_unique_ptr(*message));
+      } else {
+        callback(std::move(message));
+      }
+    } else if constexpr (  // NOLINT[readability/braces]
+      std::is_same_v<T, SharedConstPtrWithInfoROSMessageCallback>||
+      std::is_same_v<T, ConstRefSharedConstPtrWithInfoROSMessageCallback>)
+    {
+      if constexpr (is_ta) {
+        callback(convert_custom_type_to_ros_message_unique_ptr(*message), message_info);
+      } else {
+        callback(std::move(message), message_info);
+      }
+    }
+    // conditions for output is a lazy message, already deserialized
+    else if constexpr (  // NOLINT[readability/braces]
+      std::is_same_v<T, LazyMessageCallback>||
+      std::is_same_v<T, LazyMessageWithInfoCallback>)
+    {
+      std::shared_ptr<const ROSMessageType> ros_message;
+      if constexpr (is_ta) {
+        ros_message = convert_custom_type_to_ros_message_unique_ptr(*message);
+      } else {
+        ros_message = std::move(message);
+      }
+      if constexpr (std::is_same_v<T, LazyMessageCallback>) {
+        callback(LazyMessage<ROSMessageType>(std::move(ros_message)));
+      } else {
+        callback(LazyMessage<ROSMessageType>(std::move(ros_message)), message_info);
+      }
+    }
+    // condition to catch SerializedMessage types
+    else if constexpr (  // NOLINT[readability/braces]
+      std::is_same_v<T, ConstRefSerializedMessageCallback>||
+      std::is_same_v<T, ConstRefSerializedMessageWithInfoCallback>||
+      std::is_same_v<T, UniquePtrSerializedMessageCallback>||
+      std::is_same_v<T, UniquePtrSerializedMessageWithInfoCallback>||
+      std::is_same_v<T, SharedConstPtrSerializedMessageCallback>||
+      std::is_same_v<T, SharedConstPtrSerializedMessageWithInfoCallback>||
+      std::is_same_v<T, ConstRefSharedConstPtrSerializedMessageCallback>||
+      std::is_same_v<T, ConstRefSharedConstPtrSerializedMessageWithInfoCallback>||
+      std::is_same_v<T, SharedPtrSerializedMessageCallback>||
+      std::is_same_v<T, SharedPtrSerializedMessageWithInfoCallback>)
+    {
+      throw std::runtime_error(
+        "Cannot dispatch std::shared_ptr<const ROSMessageType> message "
+        "to rclcpp::SerializedMessage");
+    }
+    // condition to catch unhandled callback types
+    else {  // NOLINT[readability/braces]
+      static_assert(detail::always_false_v<T>, "unhandled callback type");
+    }
+  }
+
+  /// Dispatch an owned intra-process message to the callback of the given alternative.
+  template<size_t I>
+  void
+  dispatch_intra_process_unique_message(
+    std::unique_ptr<SubscribedType, SubscribedTypeDeleter> message,
+    const rclcpp::MessageInfo & message_info)
+  {
+    using T = std::variant_alternative_t<I, typename HelperT::variant_type>;
+    static constexpr bool is_ta = rclcpp::TypeAdapter<MessageT>::is_specialized::value;
+    T & callback = get_callback<I>();
+    // Not all the callback signatures use all of these
+    (void)callback;
+    (void)message;
+    (void)message_info;
+
+    // conditions for custom type
+    if constexpr (is_ta && std::is_same_v<T, ConstRefCallback>) {
+      callback(*message);
+    } else if constexpr (is_ta && std::is_same_v<T, ConstRefWithInfoCallback>) {  // NOLINT
+      callback(*message, message_info);
+    } else if constexpr (  // NOLINT[readability/braces]
+      is_ta && (
+        std::is_same_v<T, UniquePtrCallback>||
+        std::is_same_v<T, SharedPtrCallback>))
+    {
+      callback(std::move(message));
+    } else if constexpr (  // NOLINT[readability/braces]
+      is_ta && (
+        std::is_same_v<T, UniquePtrWithInfoCallback>||
+        std::is_same_v<T, SharedPtrWithInfoCallback>
+    ))
+    {
+      callback(std::move(message), message_info);
+    } else if constexpr (  // NOLINT[readability/braces]
+      is_ta && (
+        std::is_same_v<T, SharedConstPtrCallback>||
+        std::is_same_v<T, ConstRefSharedConstPtrCallback>
+    ))
+    {
+      callback(std::move(message));
+    } else if constexpr (  // NOLINT[readability/braces]
+      is_ta && (
+        std::is_same_v<T, SharedConstPtrWithInfoCallback>||
+        std::is_same_v<T, ConstRefSharedConstPtrWithInfoCallback>
+    ))
+    {
+      callback(std::move(message), message_info);
+    }
+    // conditions for ros message type
+    else if constexpr (std::is_same_v<T, ConstRefROSMessageCallback>) {  // NOLINT[readability/braces]
+      if constexpr (is_ta) {
+        auto local = convert_custom_type_to_ros_message_unique_ptr(*message);
+        callback(*local);
+      } else {
+        callback(*message);
+      }
+    } else if constexpr (std::is_same_v<T, ConstRefWithInfoROSMessageCallback>) {  // NOLINT[readability/braces]
+      if constexpr (is_ta) {
+        auto local = convert_custom_type_to_ros_message_unique_ptr(*message);
+        callback(*local, message_info);
+      } else {
+        callback(*message, message_info);
+      }
+    } else if constexpr (  // NOLINT[readability/braces]
+      std::is_same_v<T, UniquePtrROSMessageCallback>||
+      std::is_same_v<T, SharedPtrROSMessageCallback>)
+    {
+      if constexpr (is_ta) {
+        callback(convert_custom_type_to_ros_message_unique_ptr(*message));
+      } else {
+        callback(std::move(message));
+      }
+    } else if constexpr (  // NOLINT[readability/braces]
+      std::is_same_v<T, UniquePtrWithInfoROSMessageCallback>||
+      std::is_same_v<T, SharedPtrWithInfoROSMessageCallback>)
+    {
+      if constexpr (is_ta) {
+        callback(convert_custom_type_to_ros_message_unique_ptr(*message), message_info);
+      } else {
+        callback(std::move(message), message_info);
+      }
+    } else if constexpr (  // NOLINT[readability/braces]
+      std::is_same_v<T, SharedConstPtrROSMessageCallback>||
+      std::is_same_v<T, ConstRefSharedConstPtrROSMessageCallback>)
+    {
+      if constexpr (is_ta) {
+        callback(convert_custom_type_to_ros_message_unique_ptr(*message));
+      } else {
+        callback(std::move(message));
+      }
+    } else if constexpr (  // NOLINT[readability/braces]
+      std::is_same_v<T, SharedConstPtrWithInfoROSMessageCallback>||
+      std::is_same_v<T, ConstRefSharedConstPtrWithInfoROSMessageCallback>)
+    {
+      if constexpr (is_ta) {
+        callback(convert_custom_type_to_ros_message_unique_ptr(*message), message_info);
+      } else {
+        callback(std::move(message), message_info);
+      }
+    }
+    // conditions for output is a lazy message, already deserialized
+    else if constexpr (  // NOLINT[readability/braces]
+      std::is_same_v<T, LazyMessageCallback>||
+      std::is_same_v<T, LazyMessageWithInfoCallback>)
+    {
+      std::shared_ptr<const ROSMessageType> ros_message;
+      if constexpr (is_ta) {
+        ros_message = convert_custom_type_to_ros_message_unique_ptr(*message);
+      } else {
+        ros_message = std::move(message);
+      }
+      if constexpr (std::is_same_v<T, LazyMessageCallback>) {
+        callback(LazyMessage<ROSMessageType>(std::move(ros_message)));
+      } else {
+        callback(LazyMessage<ROSMessageType>(std::move(ros_message)), message_info);
+      }
+    }
+    // condition to catch SerializedMessage types
+    else if constexpr (  // NOLINT[readability/braces]
+      std::is_same_v<T, ConstRefSerializedMessageCallback>||
+      std::is_same_v<T, ConstRefSerializedMessageWithInfoCallback>||
+      std::is_same_v<T, UniquePtrSerializedMessageCallback>||
+      std::is_same_v<T, UniquePtrSerializedMessageWithInfoCallback>||
+      std::is_same_v<T, SharedConstPtrSerializedMessageCallback>||
+      std::is_same_v<T, SharedConstPtrSerializedMessageWithInfoCallback>||
+      std::is_same_v<T, ConstRefSharedConstPtrSerializedMessageCallback>||
+      std::is_same_v<T, ConstRefSharedConstPtrSerializedMessageWithInfoCallback>||
+      std::is_same_v<T, SharedPtrSerializedMessageCallback>||
+      std::is_same_v<T, SharedPtrSerializedMessageWithInfoCallback>)
+    {
+      throw std::runtime_error(
+        "Cannot dispatch std::unique_ptr<ROSMessageType, ROSMessageTypeDeleter> message "
+        "to rclcpp::SerializedMessage");
+    }
+    // condition to catch unhandled callback types
+    else {  // NOLINT[readability/braces]
+      static_assert(detail::always_false_v<T>, "unhandled callback type");
+    }
+  }
+
   // TODO(wjwwood): switch to inheriting from std::variant (i.e. HelperT::variant_type) once
   // inheriting from std::variant is realistic (maybe C++23?), see:
   //   http://www.open-std.org/jtc1/sc22/wg21/docs/papers/2020/p2162r0.html
@@ -1002,6 +1204,10 @@ private:
   ROSMessageTypeDeleter ros_message_type_deleter_;
   SerializedMessageAllocator serialized_message_allocator_;
   SerializedMessageDeleter serialized_message_deleter_;
+
+  // Resolved when the callback is set, or on the next dispatch after the variant changed
+  const DispatchTable * dispatch_table_ = nullptr;
+  size_t dispatch_table_index_ = std::variant_npos;
 };
 
 }  // namespace rclcpp
@@ -0,0 +1,56 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__BACKLOG_HPP_
+#define RCLCPP__BACKLOG_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace rclcpp
+{
+
+/// Snapshot of the messages waiting to be executed by a subscription.
+/**
+ * Only the intra-process buffer is observed: the middleware doesn't report how many
+ * messages are waiting in its own queue.
+ */
+struct SubscriptionBacklog
+{
+  /// The topic name of the subscription.
+  std::string topic_name;
+  /// Whether the subscription receives messages from intra-process publishers.
+  bool uses_intra_process = false;
+  /// Number of messages waiting in the intra-process buffer.
+  size_t intra_process_queued = 0;
+  /// Number of messages the intra-process buffer can hold, given by the depth of its QoS.
+  size_t intra_process_capacity = 0;
+  /// Number of messages the intra-process buffer dropped to make room for new ones.
+  uint64_t intra_process_dropped = 0;
+};
+
+/// Snapshot of the work waiting to be executed by an executor.
+struct ExecutorBacklog
+{
+  /// The backlog of each subscription of the callback groups of the executor.
+  std::vector<SubscriptionBacklog> subscriptions;
+  /// Number of events waiting in the events queue, zero for executors without one.
+  size_t events_queue_size = 0;
+};
+
+}  // namespace rclcpp
+
+#endif  // RCLCPP__BACKLOG_HPP_
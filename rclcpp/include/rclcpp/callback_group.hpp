@@ -16,9 +16,12 @@
 #define RCLCPP__CALLBACK_GROUP_HPP_
 
 #include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <unordered_map>
 #include <vector>
 
 #include "rclcpp/client.hpp"
@@ -27,6 +30,7 @@
 #include "rclcpp/publisher_base.hpp"
 #include "rclcpp/service.hpp"
 #include "rclcpp/subscription_base.hpp"
+#include "rclcpp/thread_attributes.hpp"
 #include "rclcpp/timer.hpp"
 #include "rclcpp/visibility_control.hpp"
 #include "rclcpp/waitable.hpp"
@@ -46,10 +50,11 @@ class NodeWaitables;
 enum class CallbackGroupType
 {
   MutuallyExclusive,
-  Reentrant
+  Reentrant,
+  ReaderWriter
 };
 
-class CallbackGroup
+class CallbackGroup : public std::enable_shared_from_this<CallbackGroup>
 {
   friend class rclcpp::node_interfaces::NodeServices;
   friend class rclcpp::node_interfaces::NodeTimers;
@@ -61,8 +66,8 @@ public:
 
   /// Constructor for CallbackGroup.
   /**
-   * Callback Groups have a type, either 'Mutually Exclusive' or 'Reentrant'
-   * and when creating one the type must be specified.
+   * Callback Groups have a type, either 'Mutually Exclusive', 'Reentrant' or
+   * 'Reader Writer' and when creating one the type must be specified.
    *
    * Callbacks in Reentrant Callback Groups must be able to:
    *   - run at the same time as themselves (reentrant)
@@ -74,6 +79,11 @@ public:
    *   - will not be run at the same time as other callbacks in their group
    *   - but must run at the same time as callbacks in other groups
    *
+   * Callbacks in Reader Writer Callback Groups are exclusive, as in Mutually
+   * Exclusive Callback Groups, unless their entity was given shared access
+   * with set_shared_access(): shared callbacks may run at the same time as
+   * themselves and as the other shared callbacks of their group.
+   *
    * Additionally, callback groups have a property which determines whether or
    * not they are added to an executor with their associated node automatically.
    * When creating a callback group the automatically_add_to_executor_with_node
@@ -101,8 +111,8 @@ public:
 
   /// Constructor for CallbackGroup.
   /**
-   * Callback Groups have a type, either 'Mutually Exclusive' or 'Reentrant'
-   * and when creating one the type must be specified.
+   * Callback Groups have a type, either 'Mutually Exclusive', 'Reentrant' or
+   * 'Reader Writer' and when creating one the type must be specified.
    *
    * Callbacks in Reentrant Callback Groups must be able to:
    *   - run at the same time as themselves (reentrant)
@@ -114,6 +124,11 @@ public:
    *   - will not be run at the same time as other callbacks in their group
    *   - but must run at the same time as callbacks in other groups
    *
+   * Callbacks in Reader Writer Callback Groups are exclusive, as in Mutually
+   * Exclusive Callback Groups, unless their entity was given shared access
+   * with set_shared_access(): shared callbacks may run at the same time as
+   * themselves and as the other shared callbacks of their group.
+   *
    * Additionally, callback groups have a property which determines whether or
    * not they are added to an executor with their associated node automatically.
    * When creating a callback group the automatically_add_to_executor_with_node
@@ -195,6 +210,90 @@ public:
   const CallbackGroupType &
   type() const;
 
+  /// Set whether the callbacks of an entity of a ReaderWriter group have shared access.
+  /**
+   * Shared callbacks (readers) may run at the same time as each other, while exclusive
+   * callbacks (writers) don't run at the same time as any other callback of the group.
+   * Entities are exclusive by default.
+   *
+   * Once an exclusive callback is waiting for the shared callbacks which are running,
+   * no other shared callback starts before it, so that readers can't starve writers.
+   *
+   * This has no effect on the entities of other types of callback groups.
+   * It shouldn't be changed while the callbacks of the entity may be running.
+   *
+   * \param[in] subscription_ptr the subscription, which must be in this group
+   * \param[in] shared whether the callbacks of the subscription have shared access
+   * \throws std::invalid_argument if the entity isn't in this callback group
+   */
+  RCLCPP_PUBLIC
+  void
+  set_shared_access(
+    const rclcpp::SubscriptionBase::SharedPtr & subscription_ptr, bool shared = true);
+
+  /// Set whether the callbacks of a timer of a ReaderWriter group have shared access.
+  /**
+   * \sa set_shared_access(const rclcpp::SubscriptionBase::SharedPtr &, bool)
+   */
+  RCLCPP_PUBLIC
+  void
+  set_shared_access(const rclcpp::TimerBase::SharedPtr & timer_ptr, bool shared = true);
+
+  /// Set whether the callbacks of a service of a ReaderWriter group have shared access.
+  /**
+   * \sa set_shared_access(const rclcpp::SubscriptionBase::SharedPtr &, bool)
+   */
+  RCLCPP_PUBLIC
+  void
+  set_shared_access(const rclcpp::ServiceBase::SharedPtr & service_ptr, bool shared = true);
+
+  /// Set whether the callbacks of a client of a ReaderWriter group have shared access.
+  /**
+   * \sa set_shared_access(const rclcpp::SubscriptionBase::SharedPtr &, bool)
+   */
+  RCLCPP_PUBLIC
+  void
+  set_shared_access(const rclcpp::ClientBase::SharedPtr & client_ptr, bool shared = true);
+
+  /// Set whether the callbacks of a waitable of a ReaderWriter group have shared access.
+  /**
+   * \sa set_shared_access(const rclcpp::SubscriptionBase::SharedPtr &, bool)
+   */
+  RCLCPP_PUBLIC
+  void
+  set_shared_access(const rclcpp::Waitable::SharedPtr & waitable_ptr, bool shared = true);
+
+  /// Return true if the callback of an entity of this group can start now.
+  /**
+   * This is used by the executors, which call start_callback() before running the callback
+   * and finish_callback() once it's done.
+   * For groups other than ReaderWriter ones, it's the same as can_be_taken_from().
+   * When it rejects a writer of a ReaderWriter group because readers are running, the group
+   * can't be taken from until the last of them finishes, so that the executors leave the ready
+   * writer out of their waits instead of waking up for it again and again.
+   *
+   * \param[in] entity pointer to the entity, as a pointer to its base class,
+   *   e.g. rclcpp::SubscriptionBase
+   */
+  RCLCPP_PUBLIC
+  bool
+  can_start_callback(const void * entity);
+
+  /// Mark the callback of an entity of this group as running.
+  RCLCPP_PUBLIC
+  void
+  start_callback(const void * entity);
+
+  /// Mark the callback of an entity of this group as done.
+  /**
+   * \return true if the group could not be taken from while the callback was running, so
+   *   that the executors left its entities out of their waits until now, or if it was the last
+   *   reader of a ReaderWriter group holding back a writer
+   */
+  RCLCPP_PUBLIC
+  bool
+  finish_callback(const void * entity);
+
   RCLCPP_PUBLIC
   void collect_all_ptrs(
     std::function<void(const rclcpp::SubscriptionBase::SharedPtr &)> sub_func,
@@ -219,6 +318,79 @@ public:
   std::atomic_bool &
   get_associated_with_executor_atomic();
 
+  /// Set the scheduling priority of the entities in this callback group.
+  /**
+   * Executors created with ExecutorOptions::priority_scheduling enabled always execute
+   * the ready work of the group with the highest priority first.
+   * Other executors ignore it.
+   *
+   * \param[in] priority the new priority, a greater value means a higher priority
+   */
+  RCLCPP_PUBLIC
+  void
+  set_priority(int priority);
+
+  /// Get the scheduling priority of the entities in this callback group.
+  /**
+   * \return the priority of the group, 0 by default
+   */
+  RCLCPP_PUBLIC
+  int
+  get_priority() const;
+
+  /// Set the attributes of the thread dedicated to this callback group.
+  /**
+   * The CallbackGroupThreadedExecutor runs each callback group in its own thread, started
+   * with these attributes, e.g. to pin the group to some CPU cores with a given priority.
+   * Other executors ignore them.
+   * Changes apply to the threads started afterwards, i.e. on the next spin.
+   *
+   * \param[in] attributes the attributes of the thread running this group
+   */
+  RCLCPP_PUBLIC
+  void
+  set_thread_attributes(const rclcpp::ThreadAttributes & attributes);
+
+  /// Get the attributes of the thread dedicated to this callback group.
+  /**
+   * \return the attributes of the thread, default constructed ones unless they were set
+   */
+  RCLCPP_PUBLIC
+  rclcpp::ThreadAttributes
+  get_thread_attributes() const;
+
+  /// Enable or disable the entities of this callback group.
+  /**
+   * The entities of a disabled group are left out of the wait sets of the executors, so
+   * they don't wake them up and their callbacks aren't called.
+   * Messages and requests received in the meantime stay queued, up to the depth of their
+   * QoS, and timers which expired are called once the group is enabled again.
+   *
+   * \param[in] enabled whether the group is enabled, groups are enabled by default
+   */
+  RCLCPP_PUBLIC
+  void
+  set_enabled(bool enabled);
+
+  /// Return true if the entities of this callback group are enabled.
+  RCLCPP_PUBLIC
+  bool
+  is_enabled() const;
+
+  /// Get the version of the entities of this callback group.
+  /**
+   * The version changes whenever entities are added to or removed from the group, or the group
+   * is enabled or disabled, so that executors only collect the entities of the groups which
+   * changed since they last collected them.
+   * The entities which are destroyed are only removed from the group when the next entity is
+   * added to it.
+   *
+   * \return the version of the entities of the group
+   */
+  RCLCPP_PUBLIC
+  uint64_t
+  get_entities_version() const;
+
   /// Return true if this callback group should be automatically added to an executor by the node.
   /**
    * \return boolean true if this callback group should be automatically added
@@ -291,7 +463,20 @@ protected:
   std::vector<rclcpp::ServiceBase::WeakPtr> service_ptrs_;
   std::vector<rclcpp::ClientBase::WeakPtr> client_ptrs_;
   std::vector<rclcpp::Waitable::WeakPtr> waitable_ptrs_;
-  std::atomic_bool can_be_taken_from_;
+  // Written by the executor threads for each callback of a mutually exclusive group, on a
+  // cache line of its own so that it isn't contended with the state read to collect entities
+  alignas(64) std::atomic_bool can_be_taken_from_;
+  alignas(64) std::atomic_int priority_{0};
+  std::atomic_bool enabled_{true};
+  std::atomic<uint64_t> entities_version_{0};
+  // Protected by mutex_
+  rclcpp::ThreadAttributes thread_attributes_;
+  // Entities of a ReaderWriter group with shared access, and the callbacks running in it
+  std::mutex reader_writer_mutex_;
+  std::unordered_map<const void *, std::weak_ptr<const void>> shared_entities_;
+  size_t running_readers_{0};
+  bool writer_running_{false};
+  bool writer_waiting_{false};
   const bool automatically_add_to_executor_with_node_;
   // defer the creation of the guard condition
   std::shared_ptr<rclcpp::GuardCondition> notify_guard_condition_ = nullptr;
@@ -300,6 +485,16 @@ protected:
   std::function<rclcpp::Context::SharedPtr(void)> get_context_;
 
 private:
+  void
+  set_entity_shared_access(
+    const std::shared_ptr<const void> & entity,
+    const CallbackGroup::SharedPtr & entity_group,
+    bool shared);
+
+  // Must be called with reader_writer_mutex_ locked
+  bool
+  has_shared_access(const void * entity);
+
   template<typename TypeT, typename Function>
   typename TypeT::SharedPtr _find_ptrs_if_impl(
     Function func, const std::vector<typename TypeT::WeakPtr> & vect_ptrs) const
@@ -0,0 +1,156 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__CALLBACK_STATISTICS_HPP_
+#define RCLCPP__CALLBACK_STATISTICS_HPP_
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <utility>
+
+#include "rclcpp/macros.hpp"
+#include "rclcpp/visibility_control.hpp"
+
+namespace rclcpp
+{
+
+/// Histogram of durations, with a bounded relative error.
+/**
+ * Values are counted in buckets whose width grows with the value, like in HDR histograms:
+ * values below 64 nanoseconds are counted exactly, and larger values are counted with a
+ * relative error lower than 1/32 (about 3%), up to 2^40 nanoseconds (about 18 minutes).
+ * Larger values are counted in the last bucket.
+ *
+ * Recording values is lock-free and doesn't allocate memory, so it can be done concurrently
+ * from multiple threads, e.g. the threads of an executor.
+ * Reading the histogram while values are recorded gives an approximate snapshot.
+ */
+class LatencyHistogram
+{
+public:
+  RCLCPP_PUBLIC
+  LatencyHistogram();
+
+  /// Count a new value, negative values are counted as zero.
+  RCLCPP_PUBLIC
+  void
+  record(std::chrono::nanoseconds value);
+
+  /// Get the number of recorded values.
+  RCLCPP_PUBLIC
+  uint64_t
+  get_count() const;
+
+  /// Get the smallest recorded value, or zero if no value was recorded.
+  RCLCPP_PUBLIC
+  std::chrono::nanoseconds
+  get_min() const;
+
+  /// Get the largest recorded value, or zero if no value was recorded.
+  RCLCPP_PUBLIC
+  std::chrono::nanoseconds
+  get_max() const;
+
+  /// Get the mean of the recorded values, or zero if no value was recorded.
+  RCLCPP_PUBLIC
+  std::chrono::nanoseconds
+  get_mean() const;
+
+  /// Get the value below which the given percentage of the recorded values fall.
+  /**
+   * \param[in] percentile percentage between 0 and 100
+   * \return the value, within the precision of the histogram, or zero if no value was recorded
+   * \throws std::invalid_argument if percentile is not between 0 and 100
+   */
+  RCLCPP_PUBLIC
+  std::chrono::nanoseconds
+  get_percentile(double percentile) const;
+
+  /// Discard all the recorded values.
+  RCLCPP_PUBLIC
+  void
+  reset();
+
+private:
+  RCLCPP_DISABLE_COPY(LatencyHistogram)
+
+  static constexpr size_t kSubBucketBits = 5;
+  static constexpr size_t kSubBucketCount = 1u << kSubBucketBits;
+  static constexpr size_t kMaxValueBits = 40;
+  static constexpr size_t kBucketCount = kSubBucketCount * (kMaxValueBits - kSubBucketBits + 1);
+
+  /// Get the index of the bucket counting the given value.
+  static size_t
+  get_bucket_index(uint64_t value);
+
+  /// Get the largest value counted by the given bucket.
+  static uint64_t
+  get_bucket_max_value(size_t index);
+
+  std::array<std::atomic<uint64_t>, kBucketCount> buckets_;
+  std::atomic<uint64_t> count_;
+  std::atomic<uint64_t> sum_;
+  std::atomic<uint64_t> min_;
+  std::atomic<uint64_t> max_;
+};
+
+/// Statistics of the callbacks of an entity executed by an executor.
+/**
+ * \sa rclcpp::ExecutorOptions::collect_callback_statistics
+ */
+struct CallbackStatistics
+{
+  RCLCPP_SMART_PTR_DEFINITIONS_NOT_COPYABLE(CallbackStatistics)
+
+  /// Kind of the entity whose callbacks are executed.
+  enum class EntityType
+  {
+    Timer,
+    Subscription,
+    Service,
+    Client,
+    Waitable,
+  };
+
+  CallbackStatistics(EntityType type, std::string name)
+  : entity_type(type), entity_name(std::move(name))
+  {}
+
+  /// Kind of the entity.
+  const EntityType entity_type;
+  /// Topic or service name of the entity, empty for timers and waitables.
+  const std::string entity_name;
+  /// Time between the executor finding the entity ready and starting its execution.
+  LatencyHistogram wait_latency;
+  /// Time spent executing the entity, including taking its data.
+  LatencyHistogram execution_time;
+  /// Time between the scheduled and actual calls of a timer, only recorded for timers.
+  /** \sa rclcpp::TimerBase::get_last_call_info() */
+  LatencyHistogram timer_lateness;
+  /// Number of periods of a timer which got no call, only counted for timers.
+  std::atomic<uint64_t> timer_missed_periods{0};
+  /// Number of heap allocations made executing the entity, including taking its data.
+  /**
+   * Allocations are only counted when tracked.
+   * \sa rclcpp::allocation_tracking
+   */
+  std::atomic<uint64_t> allocation_count{0};
+};
+
+}  // namespace rclcpp
+
+#endif  // RCLCPP__CALLBACK_STATISTICS_HPP_
@@ -15,12 +15,15 @@
 #ifndef RCLCPP__CLIENT_HPP_
 #define RCLCPP__CLIENT_HPP_
 
+#include <algorithm>
+#include <array>
 #include <atomic>
 #include <functional>
 #include <future>
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <set>
 #include <sstream>
 #include <string>
 #include <tuple>
@@ -37,13 +40,20 @@
 
 #include "rclcpp/clock.hpp"
 #include "rclcpp/detail/cpp_callback_trampoline.hpp"
+#include "rclcpp/detail/service_event_publisher.hpp"
+#include "rclcpp/detail/shared_object_pool.hpp"
 #include "rclcpp/exceptions.hpp"
+#include "rclcpp/experimental/intra_process_work_queue.hpp"
+#include "rclcpp/experimental/service_intra_process.hpp"
 #include "rclcpp/expand_topic_or_service_name.hpp"
 #include "rclcpp/function_traits.hpp"
+#include "rclcpp/future_completion.hpp"
+#include "rclcpp/lock_profiling.hpp"
 #include "rclcpp/logging.hpp"
 #include "rclcpp/macros.hpp"
 #include "rclcpp/node_interfaces/node_graph_interface.hpp"
 #include "rclcpp/qos.hpp"
+#include "rclcpp/service_introspection_options.hpp"
 #include "rclcpp/type_support_decl.hpp"
 #include "rclcpp/utilities.hpp"
 #include "rclcpp/visibility_control.hpp"
@@ -55,6 +65,8 @@
 namespace rclcpp
 {
 
+class CallbackGroup;
+
 namespace detail
 {
 template<typename FutureT>
@@ -122,8 +134,19 @@ namespace node_interfaces
 class NodeBaseInterface;
 }  // namespace node_interfaces
 
+namespace experimental
+{
+/**
+ * IntraProcessManager is forward declared here, avoiding a circular inclusion between
+ * `intra_process_manager.hpp` and `client.hpp`.
+ */
+class IntraProcessManager;
+}  // namespace experimental
+
 class ClientBase
 {
+  friend class rclcpp::CallbackGroup;
+
 public:
   RCLCPP_SMART_PTR_DEFINITIONS_NOT_COPYABLE(ClientBase)
 
@@ -190,6 +213,10 @@ public:
 
   /// Wait for a service to be ready.
   /**
+   * The waiting thread is woken up when a server of this service appears in the graph,
+   * rather than by every change of the graph, and checks the service again at least every
+   * 100ms, in case the server is discovered after it appeared in the graph.
+   *
    * \param timeout maximum time to wait
    * \return `true` if the service is ready and the timeout is not over, `false` otherwise
    */
@@ -339,6 +366,69 @@ public:
     }
   }
 
+  /// Set a callback to be called once the service is ready, without waiting for it.
+  /**
+   * The callback is called once, in this thread if the service is already ready, or else
+   * by the graph listener thread after a change of the graph made the service ready.
+   * The callback should therefore be fast and not blocking, it may for instance send a
+   * request or notify an executor.
+   *
+   * Calling it again replaces any previously set callback which wasn't called yet.
+   *
+   * \param[in] callback functor to be called once the service is ready
+   * \throws std::invalid_argument if the callback is not callable
+   * \throws InvalidNodeError if the node of the client was destroyed
+   */
+  RCLCPP_PUBLIC
+  void
+  set_on_service_available_callback(std::function<void()> callback);
+
+  /// Unset the callback set by set_on_service_available_callback(), if any.
+  RCLCPP_PUBLIC
+  void
+  clear_on_service_available_callback();
+
+  /// Get the callback group the client was added to.
+  /**
+   * The callback group keeps a weak pointer to the client, and the client a weak pointer
+   * back to the last callback group it was added to, so that executors find the group of the
+   * client without searching all the groups.
+   *
+   * \return the callback group, or nullptr if none or if it was destroyed
+   */
+  RCLCPP_PUBLIC
+  std::shared_ptr<rclcpp::CallbackGroup>
+  get_callback_group() const;
+
+  /// Send the requests to the services of the process without the middleware.
+  /**
+   * Called by rclcpp::create_client() when the node uses intra-process communication.
+   * The requests are then handed over by pointer to the service of the process with the
+   * same name, if it uses intra-process communication too, and the responses are handled
+   * in the callback group of the client.
+   * Otherwise they are still sent through the middleware.
+   *
+   * The requests are shared with the service, and must not be modified until responded.
+   * Their sequence numbers are negative, so that they don't collide with the ones of the
+   * middleware.
+   *
+   * This must be called before the client is added to a callback group, and the client must
+   * be owned by a std::shared_ptr.
+   *
+   * \throws std::runtime_error if intra-process is already set up for the client
+   */
+  RCLCPP_PUBLIC
+  void
+  setup_intra_process();
+
+  /// Return the waitable receiving the intra-process responses.
+  /**
+   * \return the waitable, or nullptr if intra-process isn't set up for the client.
+   */
+  RCLCPP_PUBLIC
+  rclcpp::Waitable::SharedPtr
+  get_intra_process_waitable() const;
+
 protected:
   RCLCPP_DISABLE_COPY(ClientBase)
 
@@ -358,6 +448,15 @@ protected:
   void
   set_on_new_response_callback(rcl_event_callback_t callback, const void * user_data);
 
+  /// Get the intra-process receiver of the service, if it's in this process.
+  /**
+   * \return the receiver, or nullptr if intra-process isn't set up for the client or if no
+   *   service of the process with its name uses intra-process communication
+   */
+  RCLCPP_PUBLIC
+  rclcpp::experimental::ServiceIntraProcessBase::SharedPtr
+  get_intra_process_service() const;
+
   rclcpp::node_interfaces::NodeGraphInterface::WeakPtr node_graph_;
   std::shared_ptr<rcl_node_t> node_handle_;
   std::shared_ptr<rclcpp::Context> context_;
@@ -373,10 +472,23 @@ protected:
   std::shared_ptr<rcl_client_t> client_handle_;
 
   std::atomic<bool> in_use_by_wait_set_{false};
+
+  std::mutex service_available_mutex_;
+  // Keeps the graph change callback calling the 'on service available' callback registered
+  rclcpp::GraphChangeCallbackHandle::SharedPtr service_available_handle_;
+
+  // Set by the callback group when the client is added to it
+  std::weak_ptr<rclcpp::CallbackGroup> callback_group_;
+
+  rclcpp::experimental::IntraProcessWorkQueue::SharedPtr intra_process_queue_;
+  std::string intra_process_service_name_;
+  std::weak_ptr<rclcpp::experimental::IntraProcessManager> weak_ipm_;
 };
 
 template<typename ServiceT>
-class Client : public ClientBase
+class Client
+  : public ClientBase,
+  public std::enable_shared_from_this<Client<ServiceT>>
 {
 public:
   using Request = typename ServiceT::Request;
@@ -468,14 +580,19 @@ public:
    * \param[in] node_graph The node graph interface of the corresponding node.
    * \param[in] service_name Name of the topic to publish to.
    * \param[in] client_options options for the subscription.
+   * \param[in] pool_size number of request headers and responses reused by the client once
+   *   nobody holds them anymore, allocated in advance.
+   *   If zero, they are allocated for every response.
    */
   Client(
     rclcpp::node_interfaces::NodeBaseInterface * node_base,
     rclcpp::node_interfaces::NodeGraphInterface::SharedPtr node_graph,
     const std::string & service_name,
-    rcl_client_options_t & client_options)
+    rcl_client_options_t & client_options,
+    size_t pool_size = 0)
   : ClientBase(node_base, node_graph),
-    srv_type_support_handle_(rosidl_typesupport_cpp::get_service_type_support_handle<ServiceT>())
+    srv_type_support_handle_(rosidl_typesupport_cpp::get_service_type_support_handle<ServiceT>()),
+    request_header_pool_(pool_size), response_pool_(pool_size)
   {
     rcl_ret_t ret = rcl_client_init(
       this->get_client_handle().get(),
@@ -528,7 +645,7 @@ public:
   std::shared_ptr<void>
   create_response() override
   {
-    return std::shared_ptr<void>(new typename ServiceT::Response());
+    return response_pool_.acquire();
   }
 
   /// Create a shared pointer with a rmw_request_id_t
@@ -540,7 +657,7 @@ public:
   {
     // TODO(wjwwood): This should probably use rmw_request_id's allocator.
     //                (since it is a C type)
-    return std::shared_ptr<rmw_request_id_t>(new rmw_request_id_t);
+    return request_header_pool_.acquire();
   }
 
   /// Handle a server response
@@ -561,6 +678,11 @@ public:
     auto & value = *optional_pending_request;
     auto typed_response = std::static_pointer_cast<typename ServiceT::Response>(
       std::move(response));
+    if (event_publisher_) {
+      event_publisher_->publish(
+        EventInfo::RESPONSE_RECEIVED, client_gid_.data, request_header->sequence_number,
+        nullptr, typed_response.get());
+    }
     if (std::holds_alternative<Promise>(value)) {
       auto & promise = std::get<Promise>(value);
       promise.set_value(std::move(typed_response));
@@ -580,6 +702,8 @@ public:
       promise.set_value(std::make_pair(std::move(request), std::move(typed_response)));
       callback(std::move(future));
     }
+    // Callbacks may have completed futures of their own too
+    rclcpp::notify_future_completion();
   }
 
   /// Send a request to the service server.
@@ -616,7 +740,7 @@ public:
     Promise promise;
     auto future = promise.get_future();
     auto req_id = async_send_request_impl(
-      *request,
+      request,
       std::move(promise));
     return FutureAndRequestId(std::move(future), req_id);
   }
@@ -651,7 +775,7 @@ public:
     Promise promise;
     auto shared_future = promise.get_future().share();
     auto req_id = async_send_request_impl(
-      *request,
+      request,
       std::make_tuple(
         CallbackType{std::forward<CallbackT>(cb)},
         shared_future,
@@ -682,7 +806,7 @@ public:
     PromiseWithRequest promise;
     auto shared_future = promise.get_future().share();
     auto req_id = async_send_request_impl(
-      *request,
+      request,
       std::make_tuple(
         CallbackWithRequestType{std::forward<CallbackT>(cb)},
         request,
@@ -705,8 +829,9 @@ public:
   bool
   remove_pending_request(int64_t request_id)
   {
-    std::lock_guard guard(pending_requests_mutex_);
-    return pending_requests_.erase(request_id) != 0u;
+    auto & shard = get_pending_requests_shard(request_id);
+    rclcpp::lock_profiling::ProfiledLockGuard guard(shard.mutex, shard.mutex_profile);
+    return shard.erase(request_id);
   }
 
   /// Cleanup a pending request.
@@ -752,14 +877,23 @@ public:
   size_t
   prune_pending_requests()
   {
-    std::lock_guard guard(pending_requests_mutex_);
-    auto ret = pending_requests_.size();
-    pending_requests_.clear();
+    size_t ret = 0;
+    for (auto & shard : pending_requests_shards_) {
+      rclcpp::lock_profiling::ProfiledLockGuard guard(shard.mutex, shard.mutex_profile);
+      ret += shard.requests.size();
+      shard.requests.clear();
+      shard.requests_by_time.clear();
+    }
     return ret;
   }
 
   /// Clean all pending requests older than a time_point.
   /**
+   * Pending requests are indexed by the time they were sent, so only the removed requests
+   * are visited.
+   * The send times never go backwards, even if the system clock does: a request sent after
+   * a backward jump gets the send time of the previous request.
+   *
    * \param[in] time_point Requests that were sent before this point are going to be removed.
    * \param[inout] pruned_requests Removed requests id will be pushed to the vector
    *  if a pointer is provided.
@@ -771,19 +905,21 @@ public:
     std::chrono::time_point<std::chrono::system_clock> time_point,
     std::vector<int64_t, AllocatorT> * pruned_requests = nullptr)
   {
-    std::lock_guard guard(pending_requests_mutex_);
-    auto old_size = pending_requests_.size();
-    for (auto it = pending_requests_.begin(), last = pending_requests_.end(); it != last; ) {
-      if (it->second.first < time_point) {
+    size_t ret = 0;
+    for (auto & shard : pending_requests_shards_) {
+      rclcpp::lock_profiling::ProfiledLockGuard guard(shard.mutex, shard.mutex_profile);
+      auto & by_time = shard.requests_by_time;
+      while (!by_time.empty() && by_time.begin()->first < time_point) {
+        const int64_t request_id = by_time.begin()->second;
         if (pruned_requests) {
-          pruned_requests->push_back(it->first);
+          pruned_requests->push_back(request_id);
         }
-        it = pending_requests_.erase(it);
-      } else {
-        ++it;
+        shard.requests.erase(request_id);
+        by_time.erase(by_time.begin());
+        ++ret;
       }
     }
-    return old_size - pending_requests_.size();
+    return ret;
   }
 
   /// Configure client introspection.
@@ -813,6 +949,46 @@ public:
     }
   }
 
+  /// Configure client introspection, with options reducing its cost on the calls.
+  /**
+   * With the default options, this is the same as the overload without options.
+   * Otherwise, the events are published by rclcpp instead of rcl, on the same topic and with
+   * the same contents, sampled and, if asynchronous, by a thread of the client.
+   *
+   * This must not be called while the client sends requests or handles responses.
+   *
+   * \param[in] clock clock to use to generate introspection timestamps
+   * \param[in] qos_service_event_pub QoS settings to use when creating the introspection publisher
+   * \param[in] introspection_state the state to set introspection to
+   * \param[in] options the sampling and the delivery of the events
+   * \throws std::invalid_argument if the sample period or the queue depth is zero
+   */
+  void
+  configure_introspection(
+    Clock::SharedPtr clock, const QoS & qos_service_event_pub,
+    rcl_service_introspection_state_t introspection_state,
+    const ServiceIntrospectionOptions & options)
+  {
+    event_publisher_.reset();
+    if (RCL_SERVICE_INTROSPECTION_OFF == introspection_state ||
+      (options.sample_period == 1 && !options.asynchronous))
+    {
+      configure_introspection(clock, qos_service_event_pub, introspection_state);
+      return;
+    }
+    rmw_ret_t rmw_ret = rmw_get_gid_for_client(
+      rcl_client_get_rmw_handle(client_handle_.get()), &client_gid_);
+    if (RMW_RET_OK != rmw_ret) {
+      rclcpp::exceptions::throw_from_rcl_error(rmw_ret, "failed to get client gid");
+    }
+    // Created first, so that the introspection of rcl is left enabled if this throws
+    auto event_publisher = std::make_unique<detail::ServiceEventPublisher<ServiceT>>(
+      node_handle_, this->get_service_name(), clock, qos_service_event_pub,
+      RCL_SERVICE_INTROSPECTION_CONTENTS == introspection_state, options);
+    configure_introspection(clock, qos_service_event_pub, RCL_SERVICE_INTROSPECTION_OFF);
+    event_publisher_ = std::move(event_publisher);
+  }
+
 protected:
   using CallbackTypeValueVariant = std::tuple<CallbackType, SharedFuture, Promise>;
   using CallbackWithRequestTypeValueVariant = std::tuple<
@@ -823,49 +999,183 @@ protected:
     CallbackTypeValueVariant,
     CallbackWithRequestTypeValueVariant>;
 
+  using PendingRequestTime = std::chrono::time_point<std::chrono::system_clock>;
+
+  /// Pending requests of a subset of the sequence numbers, with their own lock.
+  struct PendingRequestsShard
+  {
+    /// Remove a request, return false if it isn't pending.
+    bool
+    erase(int64_t request_id)
+    {
+      auto it = requests.find(request_id);
+      if (it == requests.end()) {
+        return false;
+      }
+      requests_by_time.erase({it->second.first, request_id});
+      requests.erase(it);
+      return true;
+    }
+
+    std::mutex mutex;
+    const rclcpp::lock_profiling::LockProfile mutex_profile{
+      "rclcpp::Client::PendingRequestsShard::mutex"};
+    std::unordered_map<int64_t, std::pair<PendingRequestTime, CallbackInfoVariant>> requests;
+    std::set<std::pair<PendingRequestTime, int64_t>> requests_by_time;
+  };
+
+  static constexpr size_t kPendingRequestsShardCount = 16;
+
+  PendingRequestsShard &
+  get_pending_requests_shard(int64_t request_id)
+  {
+    return pending_requests_shards_[static_cast<uint64_t>(request_id) % kPendingRequestsShardCount];
+  }
+
   int64_t
-  async_send_request_impl(const Request & request, CallbackInfoVariant value)
+  async_send_request_impl(const SharedRequest & request, CallbackInfoVariant value)
   {
+    if (intra_process_queue_) {
+      auto service = std::dynamic_pointer_cast<IntraProcessService>(
+        this->get_intra_process_service());
+      if (service) {
+        return async_send_intra_process_request(*service, request, std::move(value));
+      }
+    }
     int64_t sequence_number;
-    std::lock_guard<std::mutex> lock(pending_requests_mutex_);
-    rcl_ret_t ret = rcl_send_request(get_client_handle().get(), &request, &sequence_number);
+    // Requests are registered before another one is sent, see get_and_erase_pending_request()
+    rclcpp::lock_profiling::ProfiledLockGuard send_lock(
+      send_request_mutex_, send_request_mutex_profile_);
+    rcl_ret_t ret = rcl_send_request(get_client_handle().get(), request.get(), &sequence_number);
     if (RCL_RET_OK != ret) {
       rclcpp::exceptions::throw_from_rcl_error(ret, "failed to send request");
     }
-    pending_requests_.try_emplace(
-      sequence_number,
-      std::make_pair(std::chrono::system_clock::now(), std::move(value)));
+    // Published before the request is registered, so before the event of its response
+    if (event_publisher_) {
+      event_publisher_->publish(
+        EventInfo::REQUEST_SENT, client_gid_.data, sequence_number, request.get(), nullptr);
+    }
+    register_pending_request(sequence_number, std::move(value));
     return sequence_number;
   }
 
+  /// Register a request sent, send_request_mutex_ must be held.
+  void
+  register_pending_request(int64_t sequence_number, CallbackInfoVariant value)
+  {
+    last_send_time_ = std::max(last_send_time_, std::chrono::system_clock::now());
+    auto & shard = get_pending_requests_shard(sequence_number);
+    rclcpp::lock_profiling::ProfiledLockGuard lock(shard.mutex, shard.mutex_profile);
+    auto inserted = shard.requests.try_emplace(
+      sequence_number, std::make_pair(last_send_time_, std::move(value)));
+    if (inserted.second) {
+      shard.requests_by_time.emplace(last_send_time_, sequence_number);
+    }
+  }
+
   std::optional<CallbackInfoVariant>
   get_and_erase_pending_request(int64_t request_number)
   {
-    std::unique_lock<std::mutex> lock(pending_requests_mutex_);
-    auto it = this->pending_requests_.find(request_number);
-    if (it == this->pending_requests_.end()) {
+    auto & shard = get_pending_requests_shard(request_number);
+    auto value = take_pending_request(shard, request_number);
+    if (!value) {
+      // The response may have been taken before its request was registered,
+      // which happens while the sending thread holds the send lock
+      {
+        rclcpp::lock_profiling::ProfiledLockGuard send_lock(
+          send_request_mutex_, send_request_mutex_profile_);
+      }
+      value = take_pending_request(shard, request_number);
+    }
+    if (!value) {
       RCUTILS_LOG_DEBUG_NAMED(
         "rclcpp",
         "Received invalid sequence number. Ignoring...");
-      return std::nullopt;
     }
-    auto value = std::move(it->second.second);
-    this->pending_requests_.erase(request_number);
     return value;
   }
 
   RCLCPP_DISABLE_COPY(Client)
 
-  std::unordered_map<
-    int64_t,
-    std::pair<
-      std::chrono::time_point<std::chrono::system_clock>,
-      CallbackInfoVariant>>
-  pending_requests_;
-  std::mutex pending_requests_mutex_;
+  std::optional<CallbackInfoVariant>
+  take_pending_request(PendingRequestsShard & shard, int64_t request_number)
+  {
+    rclcpp::lock_profiling::ProfiledLockGuard lock(shard.mutex, shard.mutex_profile);
+    auto it = shard.requests.find(request_number);
+    if (it == shard.requests.end()) {
+      return std::nullopt;
+    }
+    std::optional<CallbackInfoVariant> value(std::move(it->second.second));
+    shard.erase(request_number);
+    return value;
+  }
+
+  // Sharded by sequence number, so that the executor rarely waits for the sending threads
+  std::array<PendingRequestsShard, kPendingRequestsShardCount> pending_requests_shards_;
+  std::mutex send_request_mutex_;
+  const rclcpp::lock_profiling::LockProfile send_request_mutex_profile_{
+    "rclcpp::Client::send_request_mutex_"};
+  PendingRequestTime last_send_time_;
 
 private:
+  using EventInfo = typename detail::ServiceEventPublisher<ServiceT>::EventInfo;
+  using IntraProcessService = rclcpp::experimental::ServiceIntraProcess<ServiceT>;
+
+  int64_t
+  async_send_intra_process_request(
+    IntraProcessService & service, const SharedRequest & request, CallbackInfoVariant value)
+  {
+    int64_t sequence_number;
+    {
+      rclcpp::lock_profiling::ProfiledLockGuard send_lock(
+        send_request_mutex_, send_request_mutex_profile_);
+      sequence_number = next_intra_process_sequence_number_--;
+      if (event_publisher_) {
+        event_publisher_->publish(
+          EventInfo::REQUEST_SENT, client_gid_.data, sequence_number, request.get(), nullptr);
+      }
+      // Registered first, as the service may respond from another thread right away
+      register_pending_request(sequence_number, std::move(value));
+    }
+    std::weak_ptr<Client> weak_this = this->weak_from_this();
+    service.send_request(
+      request,
+      [weak_this, sequence_number](SharedResponse response) {
+        auto client = weak_this.lock();
+        if (client) {
+          client->push_intra_process_response(sequence_number, std::move(response));
+        }
+      });
+    return sequence_number;
+  }
+
+  void
+  push_intra_process_response(int64_t sequence_number, SharedResponse response)
+  {
+    std::weak_ptr<Client> weak_this = this->weak_from_this();
+    intra_process_queue_->push(
+      [weak_this, sequence_number, response = std::move(response)]() mutable {
+        auto client = weak_this.lock();
+        if (!client) {
+          return;
+        }
+        auto request_header = client->create_request_header();
+        request_header->sequence_number = sequence_number;
+        client->handle_response(std::move(request_header), std::move(response));
+      });
+  }
+
   const rosidl_service_type_support_t * srv_type_support_handle_;
+
+  detail::SharedObjectPool<rmw_request_id_t> request_header_pool_;
+  detail::SharedObjectPool<typename ServiceT::Response> response_pool_;
+
+  // Set when the introspection is configured with options, see configure_introspection()
+  std::unique_ptr<detail::ServiceEventPublisher<ServiceT>> event_publisher_;
+  rmw_gid_t client_gid_{};
+
+  // Guarded by send_request_mutex_, the middleware numbers its requests from one
+  int64_t next_intra_process_sequence_number_ = -1;
 };
 
 }  // namespace rclcpp
@@ -72,6 +72,9 @@ public:
   /**
    * Returns current time from the time source specified by clock_type.
    *
+   * The ROS time override is stored atomically by rcl, so this doesn't lock the clock mutex
+   * and doesn't contend with a time source updating the clock.
+   *
    * \return current time.
    * \throws anything rclcpp::exceptions::throw_from_rcl_error can throw.
    */
@@ -219,11 +222,16 @@ public:
    *
    * Function is only applicable if the clock_type is `RCL_ROS_TIME`
    *
+   * Handlers are kept in a list of the clock, dispatched from a single rcl jump callback, so
+   * they are added and removed in constant time, however many handlers the clock has.
+   *
    * \param pre_callback Must be non-throwing
    * \param post_callback Must be non-throwing.
    * \param threshold Callbacks will be triggered if the time jump is greater
    * then the threshold.
    * \throws anything rclcpp::exceptions::throw_from_rcl_error can throw.
+   * \throws std::invalid_argument if the forward threshold is negative, or the backward one
+   * positive.
    * \throws std::bad_alloc if the allocation of the JumpHandler fails.
    * \warning the instance of the clock must remain valid as long as any created
    * JumpHandler.
@@ -250,6 +258,64 @@ private:
   std::shared_ptr<Impl> impl_;
 };
 
+/// Sleeper for repeated sleeps on a clock, such as the ones of a rate loop.
+/**
+ * Clock::sleep_until() registers a callback on the shutdown of the context, and a jump
+ * callback for ROS time, on each call.
+ * The sleeper registers them once when it's constructed and reuses its wait state, with the
+ * same semantics for each sleep.
+ *
+ * A sleeper must not be used by several threads at the same time.
+ */
+class ClockSleeper
+{
+public:
+  RCLCPP_SMART_PTR_DEFINITIONS_NOT_COPYABLE(ClockSleeper)
+
+  /// Constructor
+  /**
+   * \param clock the clock to sleep on
+   * \param context the rclcpp context used to check that ROS is still initialized
+   * \throws std::invalid_argument if the clock or the context is nullptr
+   * \throws anything rclcpp::exceptions::throw_from_rcl_error can throw.
+   */
+  RCLCPP_PUBLIC
+  explicit ClockSleeper(
+    Clock::SharedPtr clock,
+    Context::SharedPtr context = contexts::get_global_default_context());
+
+  RCLCPP_PUBLIC
+  ~ClockSleeper();
+
+  /// Sleep until a time, as Clock::sleep_until() does.
+  /**
+   * \param until absolute time according to the clock type to sleep until.
+   * \return true if `until` is reached or in the past
+   * \return false if time cannot be reached reliably, for example from shutdown or a change
+   *    of time source.
+   * \throws std::runtime_error if the context is invalid
+   * \throws std::runtime_error if `until` has a different clock type from the clock
+   */
+  RCLCPP_PUBLIC
+  bool
+  sleep_until(Time until);
+
+  /// Sleep for a duration, as Clock::sleep_for() does.
+  RCLCPP_PUBLIC
+  bool
+  sleep_for(Duration rel_time);
+
+  /// Get the clock slept on.
+  RCLCPP_PUBLIC
+  Clock::SharedPtr
+  get_clock() const;
+
+private:
+  class Impl;
+
+  std::unique_ptr<Impl> impl_;
+};
+
 }  // namespace rclcpp
 
 #endif  // RCLCPP__CLOCK_HPP_
@@ -0,0 +1,110 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__CONTENT_FILTER_HPP_
+#define RCLCPP__CONTENT_FILTER_HPP_
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "rosidl_runtime_c/message_type_support_struct.h"
+
+#include "rclcpp/macros.hpp"
+#include "rclcpp/serialized_message.hpp"
+#include "rclcpp/visibility_control.hpp"
+
+namespace rclcpp
+{
+
+/// Content filter expression evaluated by rclcpp, for the middlewares which don't filter.
+/**
+ * The expression is compiled once against the introspection type support of the message
+ * type, and can then be evaluated on serialized messages, without deserializing them, or on
+ * messages of the type.
+ *
+ * The supported expressions are a subset of the DDS content filter grammar:
+ * - conditions combined with `AND`, `OR`, `NOT` and parentheses;
+ * - comparisons with `=`, `<>`, `!=`, `<`, `<=`, `>` and `>=`;
+ * - `BETWEEN a AND b`, `NOT BETWEEN a AND b`, and `LIKE` with the `%` and `_` wildcards;
+ * - operands which are fields, e.g. `header.frame_id`, integer, floating point, `TRUE`,
+ *   `FALSE` or 'string' literals, and `%n` expression parameters holding such literals.
+ *
+ * Fields have to be primitives or strings, which aren't in arrays or sequences, as for
+ * rclcpp::SerializedFieldExtractor.
+ * Numbers are compared as double precision floating point values, booleans being 0 or 1.
+ */
+class ContentFilter
+{
+public:
+  RCLCPP_SMART_PTR_DEFINITIONS(ContentFilter)
+
+  /// Compile a filter expression for the message type of the given type support.
+  /**
+   * \param[in] type_support the type support of the message type, providing its
+   *   introspection, which must outlive the filter
+   * \param[in] filter_expression the filter expression, \sa ContentFilterOptions
+   * \param[in] expression_parameters the values of the `%n` parameters of the expression
+   * \throws std::invalid_argument if the expression is empty or isn't supported, if it uses
+   *   missing parameters or fields, or if the type support doesn't provide introspection
+   */
+  RCLCPP_PUBLIC
+  ContentFilter(
+    const rosidl_message_type_support_t * type_support,
+    const std::string & filter_expression,
+    const std::vector<std::string> & expression_parameters = {});
+
+  RCLCPP_PUBLIC
+  ~ContentFilter();
+
+  /// Get the filter expression which was compiled.
+  RCLCPP_PUBLIC
+  const std::string &
+  get_filter_expression() const;
+
+  /// Get the expression parameters which were compiled.
+  RCLCPP_PUBLIC
+  const std::vector<std::string> &
+  get_expression_parameters() const;
+
+  /// Evaluate the filter on a serialized message, only reading the fields it uses.
+  /**
+   * \param[in] message the serialized message, of the message type of the filter
+   * \return true if the message passes the filter
+   * \throws std::runtime_error if the data is truncated or isn't plain CDR
+   */
+  RCLCPP_PUBLIC
+  bool
+  matches(const rclcpp::SerializedMessageView & message) const;
+
+  /// Evaluate the filter on a message.
+  /**
+   * \param[in] message pointer to a message of the message type of the filter
+   * \return true if the message passes the filter
+   */
+  RCLCPP_PUBLIC
+  bool
+  matches_ros_message(const void * message) const;
+
+private:
+  RCLCPP_DISABLE_COPY(ContentFilter)
+
+  struct Impl;
+
+  std::unique_ptr<const Impl> impl_;
+};
+
+}  // namespace rclcpp
+
+#endif  // RCLCPP__CONTENT_FILTER_HPP_
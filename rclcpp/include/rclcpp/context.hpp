@@ -15,6 +15,7 @@
 #ifndef RCLCPP__CONTEXT_HPP_
 #define RCLCPP__CONTEXT_HPP_
 
+#include <atomic>
 #include <condition_variable>
 #include <functional>
 #include <memory>
@@ -49,6 +50,8 @@ public:
 /// Forward declare WeakContextsWrapper
 class WeakContextsWrapper;
 
+class GuardCondition;
+
 class ShutdownCallbackHandle
 {
   friend class Context;
@@ -116,6 +119,10 @@ public:
    * This allows derived entities to hold on to shard pointers to the first
    * context object until they are done.
    *
+   * If the previous init used InitOptions::keep_rcl_context_on_shutdown, its rcl context is
+   * reused when the same arguments and domain id are given with this option again, instead
+   * of initializing a new one.
+   *
    * This function is thread-safe.
    *
    * \param[in] argc number of arguments
@@ -177,7 +184,8 @@ public:
    *
    * - acquires a lock to prevent race conditions with init, on_shutdown, etc.
    * - if the context is not initialized, return false
-   * - rcl_shutdown() is called on the internal rcl_context_t instance
+   * - rcl_shutdown() is called on the internal rcl_context_t instance, unless
+   *   InitOptions::keep_rcl_context_on_shutdown was set
    * - the shutdown reason is set
    * - each on_shutdown callback is called, in the order that they were added
    * - interrupt blocking sleep_for() calls, so they return early due to shutdown
@@ -304,6 +312,31 @@ public:
   std::vector<PreShutdownCallback>
   get_pre_shutdown_callbacks() const;
 
+  /// Trigger a guard condition on shutdown, e.g. to wake up a wait set waiting on it.
+  /**
+   * The guard conditions are triggered after the on_shutdown callbacks.
+   * Unlike an on_shutdown callback triggering the guard condition, adding and removing it
+   * takes a constant time whatever the number of waiters, and doesn't allocate a callback.
+   * Only a weak reference to the guard condition is kept.
+   *
+   * As on_shutdown callbacks, guard conditions may be added before init and after shutdown,
+   * and persist on repeated init's.
+   *
+   * \param[in] guard_condition the guard condition to trigger
+   */
+  RCLCPP_PUBLIC
+  void
+  add_shutdown_guard_condition(const std::shared_ptr<rclcpp::GuardCondition> & guard_condition);
+
+  /// Stop triggering a guard condition on shutdown.
+  /**
+   * \param[in] guard_condition the guard condition added with add_shutdown_guard_condition()
+   * \return true if the guard condition is found and removed, otherwise false.
+   */
+  RCLCPP_PUBLIC
+  bool
+  remove_shutdown_guard_condition(const rclcpp::GuardCondition * guard_condition);
+
   /// Return the internal rcl context.
   RCLCPP_PUBLIC
   std::shared_ptr<rcl_context_t>
@@ -371,6 +404,10 @@ private:
   std::shared_ptr<rcl_context_t> rcl_context_;
   rclcpp::InitOptions init_options_;
   std::string shutdown_reason_;
+  // The arguments of the last init, to know if the kept rcl context can be reused.
+  std::vector<std::string> init_arguments_;
+  // Whether the rcl context was kept initialized by the last shutdown.
+  std::atomic_bool rcl_context_kept_{false};
 
   // Keep shared ownership of the global logging mutex.
   std::shared_ptr<std::recursive_mutex> logging_mutex_;
@@ -386,6 +423,10 @@ private:
   std::vector<std::shared_ptr<PreShutdownCallback>> pre_shutdown_callbacks_;
   mutable std::mutex pre_shutdown_callbacks_mutex_;
 
+  std::unordered_map<const GuardCondition *, std::weak_ptr<GuardCondition>>
+  shutdown_guard_conditions_;
+  std::mutex shutdown_guard_conditions_mutex_;
+
   /// Condition variable for timed sleep (see sleep_for).
   std::condition_variable interrupt_condition_variable_;
   /// Mutex for protecting the global condition variable.
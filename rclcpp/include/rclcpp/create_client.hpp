@@ -15,6 +15,7 @@
 #ifndef RCLCPP__CREATE_CLIENT_HPP_
 #define RCLCPP__CREATE_CLIENT_HPP_
 
+#include <cstddef>
 #include <memory>
 #include <string>
 
@@ -27,6 +28,10 @@ namespace rclcpp
 {
 /// Create a service client with a given type.
 /**
+ * If the node uses intra-process communication, the requests to a service of the process
+ * which uses it too are handed over without the middleware, see
+ * ClientBase::setup_intra_process().
+ *
  * \param[in] node_base NodeBaseInterface implementation of the node on which
  *  to create the client.
  * \param[in] node_graph NodeGraphInterface implementation of the node on which
@@ -36,6 +41,8 @@ namespace rclcpp
  * \param[in] service_name The name on which the service is accessible.
  * \param[in] qos Quality of service profile for client.
  * \param[in] group Callback group to handle the reply to service calls.
+ * \param[in] pool_size Number of response objects reused by the client,
+ *  zero to allocate them for every response.
  * \return Shared pointer to the created client.
  */
 template<typename ServiceT>
@@ -46,13 +53,15 @@ create_client(
   std::shared_ptr<node_interfaces::NodeServicesInterface> node_services,
   const std::string & service_name,
   const rclcpp::QoS & qos = rclcpp::ServicesQoS(),
-  rclcpp::CallbackGroup::SharedPtr group = nullptr)
+  rclcpp::CallbackGroup::SharedPtr group = nullptr,
+  size_t pool_size = 0)
 {
   return create_client<ServiceT>(
     node_base, node_graph, node_services,
     service_name,
     qos.get_rmw_qos_profile(),
-    group);
+    group,
+    pool_size);
 }
 
 /// Create a service client with a given type.
@@ -65,7 +74,8 @@ create_client(
   std::shared_ptr<node_interfaces::NodeServicesInterface> node_services,
   const std::string & service_name,
   const rmw_qos_profile_t & qos_profile,
-  rclcpp::CallbackGroup::SharedPtr group)
+  rclcpp::CallbackGroup::SharedPtr group,
+  size_t pool_size = 0)
 {
   rcl_client_options_t options = rcl_client_get_default_options();
   options.qos = qos_profile;
@@ -74,7 +84,11 @@ create_client(
     node_base.get(),
     node_graph,
     service_name,
-    options);
+    options,
+    pool_size);
+  if (node_base->get_use_intra_process_default()) {
+    cli->setup_intra_process();
+  }
 
   auto cli_base_ptr = std::dynamic_pointer_cast<rclcpp::ClientBase>(cli);
   node_services->add_client(cli_base_ptr, group);
@@ -22,6 +22,7 @@
 
 #include "rcl/subscription.h"
 #include "rclcpp/generic_subscription.hpp"
+#include "rclcpp/message_info.hpp"
 #include "rclcpp/node_interfaces/node_topics_interface.hpp"
 #include "rclcpp/qos.hpp"
 #include "rclcpp/serialized_message.hpp"
@@ -74,6 +75,42 @@ std::shared_ptr<GenericSubscription> create_generic_subscription(
   return subscription;
 }
 
+/// Create and return a GenericSubscription delivering views of the serialized messages.
+/**
+ * The callback receives a view of the serialized data, valid only for the duration of the
+ * callback, and the message info, see the GenericSubscription constructor.
+ * \sa rclcpp::create_generic_subscription() for the other parameters.
+ */
+template<typename AllocatorT = std::allocator<void>>
+std::shared_ptr<GenericSubscription> create_generic_subscription(
+  rclcpp::node_interfaces::NodeTopicsInterface::SharedPtr topics_interface,
+  const std::string & topic_name,
+  const std::string & topic_type,
+  const rclcpp::QoS & qos,
+  std::function<void(
+    const rclcpp::SerializedMessageView &, const rclcpp::MessageInfo &)> view_callback,
+  const rclcpp::SubscriptionOptionsWithAllocator<AllocatorT> & options = (
+    rclcpp::SubscriptionOptionsWithAllocator<AllocatorT>()
+  )
+)
+{
+  auto ts_lib = rclcpp::get_typesupport_library(
+    topic_type, "rosidl_typesupport_cpp");
+
+  auto subscription = std::make_shared<GenericSubscription>(
+    topics_interface->get_node_base_interface(),
+    std::move(ts_lib),
+    topic_name,
+    topic_type,
+    qos,
+    view_callback,
+    options);
+
+  topics_interface->add_subscription(subscription, options.callback_group);
+
+  return subscription;
+}
+
 }  // namespace rclcpp
 
 #endif  // RCLCPP__CREATE_GENERIC_SUBSCRIPTION_HPP_
@@ -26,6 +26,7 @@
 #include "rclcpp/publisher_options.hpp"
 #include "rclcpp/qos.hpp"
 #include "rclcpp/qos_overriding_options.hpp"
+#include "rclcpp/topic_statistics/publisher_topic_statistics.hpp"
 #include "rclcpp/detail/qos_parameters.hpp"
 
 #include "rmw/qos_profiles.h"
@@ -67,6 +68,9 @@ create_publisher(
     rclcpp::create_publisher_factory<MessageT, AllocatorT, PublisherT>(options),
     actual_qos
   );
+  pub->set_topic_statistics(
+    rclcpp::topic_statistics::create_publisher_topic_statistics(
+      node_topics_interface.get(), options));
 
   // Add the publisher to the node topics interface.
   node_topics_interface->add_publisher(pub, options.callback_group);
@@ -15,6 +15,7 @@
 #ifndef RCLCPP__CREATE_SERVICE_HPP_
 #define RCLCPP__CREATE_SERVICE_HPP_
 
+#include <cstddef>
 #include <memory>
 #include <string>
 #include <utility>
@@ -28,6 +29,9 @@ namespace rclcpp
 {
 /// Create a service with a given type.
 /**
+ * If the node uses intra-process communication, the requests of the clients of the process
+ * which use it too are handed over without the middleware, see Service::setup_intra_process().
+ *
  * \param[in] node_base NodeBaseInterface implementation of the node on which
  *  to create the service.
  * \param[in] node_services NodeServicesInterface implementation of the node on
@@ -36,6 +40,8 @@ namespace rclcpp
  * \param[in] callback The callback to call when the service gets a request.
  * \param[in] qos Quality of service profile for the service.
  * \param[in] group Callback group to handle the reply to service calls.
+ * \param[in] pool_size Number of request and response objects reused by the service,
+ *  zero to allocate them for every request.
  * \return Shared pointer to the created service.
  */
 template<typename ServiceT, typename CallbackT>
@@ -46,11 +52,12 @@ create_service(
   const std::string & service_name,
   CallbackT && callback,
   const rclcpp::QoS & qos,
-  rclcpp::CallbackGroup::SharedPtr group)
+  rclcpp::CallbackGroup::SharedPtr group,
+  size_t pool_size = 0)
 {
   return create_service<ServiceT, CallbackT>(
     node_base, node_services, service_name,
-    std::forward<CallbackT>(callback), qos.get_rmw_qos_profile(), group);
+    std::forward<CallbackT>(callback), qos.get_rmw_qos_profile(), group, pool_size);
 }
 
 /// Create a service with a given type.
@@ -63,7 +70,8 @@ create_service(
   const std::string & service_name,
   CallbackT && callback,
   const rmw_qos_profile_t & qos_profile,
-  rclcpp::CallbackGroup::SharedPtr group)
+  rclcpp::CallbackGroup::SharedPtr group,
+  size_t pool_size = 0)
 {
   rclcpp::AnyServiceCallback<ServiceT> any_service_callback;
   any_service_callback.set(std::forward<CallbackT>(callback));
@@ -73,7 +81,10 @@ create_service(
 
   auto serv = Service<ServiceT>::make_shared(
     node_base->get_shared_rcl_node_handle(),
-    service_name, any_service_callback, service_options);
+    service_name, any_service_callback, service_options, pool_size);
+  if (node_base->get_use_intra_process_default()) {
+    serv->setup_intra_process(node_base->get_context());
+  }
   auto serv_base_ptr = std::dynamic_pointer_cast<ServiceBase>(serv);
   node_services->add_service(serv_base_ptr, group);
   return serv;
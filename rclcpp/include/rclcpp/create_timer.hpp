@@ -137,9 +137,11 @@ create_timer(
  * \param node_base node base interface
  * \param node_timers node timer interface
  * \param autostart defines if the timer should start it's countdown on initialization or not.
+ * \param slack how much earlier than its expiration the timer may be executed, to share the
+ * wakeup of another timer, see TimerBase::set_slack()
  * \return shared pointer to a generic timer
  * \throws std::invalid_argument if either clock, node_base or node_timers
- * are nullptr, or period is negative or too large
+ * are nullptr, or period is negative or too large, or slack isn't less than period
  */
 template<typename DurationRepT, typename DurationT, typename CallbackT>
 typename rclcpp::GenericTimer<CallbackT>::SharedPtr
@@ -150,7 +152,8 @@ create_timer(
   rclcpp::CallbackGroup::SharedPtr group,
   node_interfaces::NodeBaseInterface * node_base,
   node_interfaces::NodeTimersInterface * node_timers,
-  bool autostart = true)
+  bool autostart = true,
+  std::chrono::nanoseconds slack = std::chrono::nanoseconds::zero())
 {
   if (clock == nullptr) {
     throw std::invalid_argument{"clock cannot be null"};
@@ -167,6 +170,7 @@ create_timer(
   // Add a new generic timer.
   auto timer = rclcpp::GenericTimer<CallbackT>::make_shared(
     std::move(clock), period_ns, std::move(callback), node_base->get_context(), autostart);
+  timer->set_slack(slack);
   node_timers->add_timer(timer, group);
   return timer;
 }
@@ -182,9 +186,12 @@ create_timer(
  * \param group callback group
  * \param node_base node base interface
  * \param node_timers node timer interface
+ * \param autostart defines if the timer should start it's countdown on initialization or not.
+ * \param slack how much earlier than its expiration the timer may be executed, to share the
+ * wakeup of another timer, see TimerBase::set_slack()
  * \return shared pointer to a wall timer
  * \throws std::invalid_argument if either node_base or node_timers
- * are null, or period is negative or too large
+ * are null, or period is negative or too large, or slack isn't less than period
  */
 template<typename DurationRepT, typename DurationT, typename CallbackT>
 typename rclcpp::WallTimer<CallbackT>::SharedPtr
@@ -194,7 +201,8 @@ create_wall_timer(
   rclcpp::CallbackGroup::SharedPtr group,
   node_interfaces::NodeBaseInterface * node_base,
   node_interfaces::NodeTimersInterface * node_timers,
-  bool autostart = true)
+  bool autostart = true,
+  std::chrono::nanoseconds slack = std::chrono::nanoseconds::zero())
 {
   if (node_base == nullptr) {
     throw std::invalid_argument{"input node_base cannot be null"};
@@ -209,6 +217,7 @@ create_wall_timer(
   // Add a new wall timer.
   auto timer = rclcpp::WallTimer<CallbackT>::make_shared(
     period_ns, std::move(callback), node_base->get_context(), autostart);
+  timer->set_slack(slack);
   node_timers->add_timer(timer, group);
   return timer;
 }
@@ -0,0 +1,165 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__DEADLINE_MONITOR_HPP_
+#define RCLCPP__DEADLINE_MONITOR_HPP_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+
+#include "rclcpp/callback_group.hpp"
+#include "rclcpp/macros.hpp"
+#include "rclcpp/node_interfaces/get_node_base_interface.hpp"
+#include "rclcpp/node_interfaces/get_node_timers_interface.hpp"
+#include "rclcpp/node_interfaces/node_base_interface.hpp"
+#include "rclcpp/node_interfaces/node_timers_interface.hpp"
+#include "rclcpp/subscription_base.hpp"
+#include "rclcpp/timer.hpp"
+#include "rclcpp/visibility_control.hpp"
+
+namespace rclcpp
+{
+
+/// Information given to the callback of a subscription which missed its deadline.
+struct DeadlineMissedInfo
+{
+  /// Name of the topic of the subscription.
+  std::string topic_name;
+  /// Expected maximum period between two messages.
+  std::chrono::nanoseconds period;
+  /// Time elapsed since the last message, or since the watch started if none was received.
+  std::chrono::nanoseconds time_since_last_message;
+  /// Number of deadlines missed since the watch started, this one included.
+  uint64_t total_count;
+};
+
+/// Monitor of the time between the messages received by many subscriptions.
+/**
+ * This is a software alternative to the deadline QoS policy, which isn't supported by all
+ * the middlewares and adds events to wait for to each endpoint.
+ * The executors record a steady timestamp when they take a message of a watched subscription,
+ * and the deadlines of all the watched subscriptions are checked by a single timer, using a
+ * timer wheel: each tick only looks at the subscriptions whose deadline falls in it.
+ *
+ * The timer is added to the given node, so the deadlines are checked by the executor spinning
+ * it: typically one monitor is created per executor, for all the subscriptions it executes.
+ * Deadlines are checked with the resolution of the timer.
+ *
+ * When a deadline is missed, the callback is called and the next deadline is one period
+ * later, so it's called once per period for as long as no message is received.
+ *
+ * Messages delivered with intra-process communication aren't recorded, since they don't
+ * go through the subscription: watched subscriptions should not use it.
+ */
+class DeadlineMonitor
+{
+public:
+  RCLCPP_SMART_PTR_DEFINITIONS_NOT_COPYABLE(DeadlineMonitor)
+
+  using MissedDeadlineCallback = std::function<void (const DeadlineMissedInfo &)>;
+
+  /// Opaque handle of a watched subscription.
+  class Watch;
+  using WatchHandle = std::shared_ptr<Watch>;
+
+  /// Construct a deadline monitor whose timer is added to the given node.
+  /**
+   * \param[in] node the node to which the timer checking the deadlines is added
+   * \param[in] resolution the period of the timer
+   * \param[in] number_of_slots the number of ticks of the timer wheel, after which it wraps
+   * \param[in] group the callback group of the timer, the default one of the node if nullptr
+   * \throws std::invalid_argument if the resolution isn't positive or number_of_slots is zero
+   */
+  template<typename NodeT>
+  explicit DeadlineMonitor(
+    NodeT && node,
+    std::chrono::nanoseconds resolution = std::chrono::milliseconds(10),
+    size_t number_of_slots = 512,
+    rclcpp::CallbackGroup::SharedPtr group = nullptr)
+  : DeadlineMonitor(
+      rclcpp::node_interfaces::get_node_base_interface(node),
+      rclcpp::node_interfaces::get_node_timers_interface(node),
+      resolution, number_of_slots, std::move(group))
+  {}
+
+  RCLCPP_PUBLIC
+  DeadlineMonitor(
+    rclcpp::node_interfaces::NodeBaseInterface::SharedPtr node_base,
+    rclcpp::node_interfaces::NodeTimersInterface::SharedPtr node_timers,
+    std::chrono::nanoseconds resolution,
+    size_t number_of_slots,
+    rclcpp::CallbackGroup::SharedPtr group);
+
+  /// Stop the timer, and stop watching all the subscriptions.
+  RCLCPP_PUBLIC
+  ~DeadlineMonitor();
+
+  /// Start watching a subscription.
+  /**
+   * The first deadline is one period after this call.
+   * The monitor only keeps a weak pointer to the subscription, the watch is dropped once
+   * the subscription is destroyed.
+   *
+   * \param[in] subscription the subscription to watch
+   * \param[in] period the expected maximum period between two messages
+   * \param[in] callback the function called when no message was received for a period
+   * \return a handle to give to unwatch()
+   * \throws std::invalid_argument if subscription or callback is null, or period isn't positive
+   */
+  RCLCPP_PUBLIC
+  WatchHandle
+  watch(
+    const rclcpp::SubscriptionBase::SharedPtr & subscription,
+    std::chrono::nanoseconds period,
+    MissedDeadlineCallback callback);
+
+  /// Stop watching a subscription.
+  /**
+   * \param[in] handle the handle returned by watch()
+   * \throws std::runtime_error if the handle isn't a watch of this monitor
+   */
+  RCLCPP_PUBLIC
+  void
+  unwatch(const WatchHandle & handle);
+
+  /// Get the number of watched subscriptions.
+  RCLCPP_PUBLIC
+  size_t
+  size() const;
+
+  /// Check the deadlines up to the given time, as the timer of the monitor does.
+  /**
+   * The callbacks of the subscriptions which missed their deadline are called in this thread.
+   *
+   * \param[in] now the current time of the steady clock
+   */
+  RCLCPP_PUBLIC
+  void
+  check_deadlines(std::chrono::steady_clock::time_point now);
+
+private:
+  class Wheel;
+
+  // Shared with the timer callback, which can still be executed while the monitor is destroyed
+  std::shared_ptr<Wheel> wheel_;
+  rclcpp::TimerBase::SharedPtr timer_;
+};
+
+}  // namespace rclcpp
+
+#endif  // RCLCPP__DEADLINE_MONITOR_HPP_
@@ -0,0 +1,79 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__DESTROY_NODES_HPP_
+#define RCLCPP__DESTROY_NODES_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace rclcpp
+{
+
+/// Release many nodes concurrently, returning once they are all released.
+/**
+ * Destroying a node finalizes each of its publishers, subscriptions, services, clients and
+ * its rosout publisher through the middleware, which usually announces each of them to the
+ * other participants: destroying hundreds of nodes one after the other takes long.
+ * Here several threads release the nodes at once, so that the middleware works on several of
+ * them at a time.
+ * A node still referenced elsewhere is only released, it's destroyed with its last reference.
+ *
+ * Shutting down the context of the nodes first, e.g. with rclcpp::shutdown(), also stops its
+ * graph listener, so that the nodes are removed from it without interrupting its thread.
+ * The nodes must not be spun by an executor anymore.
+ *
+ * \param[in] nodes the nodes to release, the vector is cleared
+ * \param[in] number_of_threads the number of threads releasing the nodes, including the
+ *   calling thread, or zero for the number of cores
+ */
+template<typename NodeT>
+void
+destroy_nodes(std::vector<std::shared_ptr<NodeT>> && nodes, size_t number_of_threads = 0)
+{
+  if (0u == number_of_threads) {
+    number_of_threads = std::max(1u, std::thread::hardware_concurrency());
+  }
+  number_of_threads = std::min(number_of_threads, nodes.size());
+
+  std::atomic_size_t next_node{0};
+  auto release_nodes = [&nodes, &next_node]() {
+      for (size_t i = next_node++; i < nodes.size(); i = next_node++) {
+        nodes[i].reset();
+      }
+    };
+  std::vector<std::thread> threads;
+  for (size_t i = 1u; i < number_of_threads; ++i) {
+    try {
+      threads.emplace_back(release_nodes);
+    } catch (const std::system_error &) {
+      // Fewer threads release the nodes
+      break;
+    }
+  }
+  release_nodes();
+  for (auto & thread : threads) {
+    thread.join();
+  }
+  nodes.clear();
+}
+
+}  // namespace rclcpp
+
+#endif  // RCLCPP__DESTROY_NODES_HPP_
@@ -0,0 +1,107 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__DETAIL__ASYNC_PUBLISH_QUEUE_HPP_
+#define RCLCPP__DETAIL__ASYNC_PUBLISH_QUEUE_HPP_
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "rclcpp/macros.hpp"
+#include "rclcpp/visibility_control.hpp"
+
+namespace rclcpp
+{
+namespace detail
+{
+
+/// Bounded queue of publications, executed in order by a thread of the queue.
+/**
+ * Publishers use it to serialize and publish their inter-process messages off the thread
+ * calling publish().
+ *
+ * \sa rclcpp::PublisherOptionsBase::async_publish
+ */
+class AsyncPublishQueue
+{
+public:
+  using Publication = std::function<void ()>;
+
+  /// Start the thread of the queue.
+  /**
+   * \param[in] capacity the maximum number of publications waiting to be executed
+   * \param[in] block_when_full whether push() waits when the queue is full, instead of
+   *   dropping the oldest publication
+   * \param[in] topic_name the name of the topic, to log the errors of the publications
+   * \throws std::invalid_argument if capacity is zero
+   */
+  RCLCPP_PUBLIC
+  AsyncPublishQueue(size_t capacity, bool block_when_full, const std::string & topic_name);
+
+  /// Execute the publications which are still queued, and stop the thread.
+  RCLCPP_PUBLIC
+  ~AsyncPublishQueue();
+
+  /// Queue a publication, thread-safe.
+  RCLCPP_PUBLIC
+  void
+  push(Publication publication);
+
+  /// Get the number of publications which were dropped because the queue was full.
+  RCLCPP_PUBLIC
+  uint64_t
+  get_dropped_count() const;
+
+  /// Wait until every queued publication was executed, return false on timeout.
+  /**
+   * \param[in] timeout the maximum time to wait, forever if negative
+   */
+  RCLCPP_PUBLIC
+  bool
+  wait_until_empty(std::chrono::nanoseconds timeout);
+
+private:
+  RCLCPP_DISABLE_COPY(AsyncPublishQueue)
+
+  void
+  run();
+
+  const size_t capacity_;
+  const bool block_when_full_;
+  const std::string topic_name_;
+
+  mutable std::mutex mutex_;
+  // Notified when a publication is queued, or when the queue stops
+  std::condition_variable queued_cv_;
+  // Notified when a publication is taken by the thread, or once it was executed
+  std::condition_variable taken_cv_;
+  std::deque<Publication> publications_;
+  bool executing_{false};
+  bool stop_{false};
+  uint64_t dropped_count_{0};
+
+  std::thread thread_;
+};
+
+}  // namespace detail
+}  // namespace rclcpp
+
+#endif  // RCLCPP__DETAIL__ASYNC_PUBLISH_QUEUE_HPP_
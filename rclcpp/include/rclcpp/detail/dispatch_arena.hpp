@@ -0,0 +1,205 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__DETAIL__DISPATCH_ARENA_HPP_
+#define RCLCPP__DETAIL__DISPATCH_ARENA_HPP_
+
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <new>
+#include <utility>
+
+#include "rclcpp/macros.hpp"
+#include "rclcpp/visibility_control.hpp"
+
+namespace rclcpp
+{
+namespace detail
+{
+
+/// Bump allocator for the short-lived objects of the callbacks dispatched by an executor.
+/**
+ * Memory is allocated from a chunk by bumping an offset, and reset() starts again from the
+ * beginning of the chunk once all its allocations were freed.
+ * If some allocations are still alive at reset(), like messages kept by a callback, the next
+ * allocations are made from a new chunk, and the previous chunk is freed with its last
+ * allocation: nothing has to be freed before reset().
+ * Allocations larger than a quarter of a chunk get a chunk of their own.
+ *
+ * Memory is allocated and the arena reset by a single thread, while it can be freed by any.
+ *
+ * \sa rclcpp::ExecutorOptions::dispatch_arena_chunk_size
+ */
+class DispatchArena
+{
+public:
+  /// Create an arena, which allocates its first chunk when it's first used.
+  /**
+   * \param[in] chunk_size the size in bytes of the chunks
+   * \throws std::invalid_argument if chunk_size is zero
+   */
+  RCLCPP_PUBLIC
+  explicit DispatchArena(size_t chunk_size);
+
+  /// Free the current chunk once all its allocations are freed.
+  RCLCPP_PUBLIC
+  ~DispatchArena();
+
+  /// Allocate memory from the current chunk.
+  /**
+   * \param[in] size the size in bytes of the memory
+   * \param[in] alignment the alignment of the memory, a power of two
+   * \throws std::bad_alloc if a chunk must be allocated and can't be
+   */
+  RCLCPP_PUBLIC
+  void *
+  allocate(size_t size, size_t alignment);
+
+  /// Free memory allocated by any arena.
+  RCLCPP_PUBLIC
+  static
+  void
+  deallocate(void * pointer) noexcept;
+
+  /// Reuse the current chunk if all its allocations were freed, or use a new one.
+  RCLCPP_PUBLIC
+  void
+  reset();
+
+  /// Get the size in bytes of the chunks.
+  RCLCPP_PUBLIC
+  size_t
+  get_chunk_size() const;
+
+private:
+  RCLCPP_DISABLE_COPY(DispatchArena)
+
+  struct Chunk;
+
+  static
+  void
+  release(Chunk * chunk) noexcept;
+
+  const size_t chunk_size_;
+  Chunk * chunk_;
+  size_t offset_;
+};
+
+/// Standard allocator allocating from a DispatchArena.
+template<typename T>
+class DispatchArenaAllocator
+{
+public:
+  using value_type = T;
+
+  explicit DispatchArenaAllocator(DispatchArena * arena) noexcept
+  : arena_(arena)
+  {}
+
+  template<typename U>
+  DispatchArenaAllocator(const DispatchArenaAllocator<U> & other) noexcept
+  : arena_(other.get_arena())
+  {}
+
+  T *
+  allocate(size_t n)
+  {
+    if (n > std::numeric_limits<size_t>::max() / sizeof(T)) {
+      throw std::bad_array_new_length();
+    }
+    return static_cast<T *>(arena_->allocate(n * sizeof(T), alignof(T)));
+  }
+
+  void
+  deallocate(T * pointer, size_t n) noexcept
+  {
+    (void)n;
+    // Doesn't use the arena, which may have been destroyed since
+    DispatchArena::deallocate(pointer);
+  }
+
+  DispatchArena *
+  get_arena() const noexcept
+  {
+    return arena_;
+  }
+
+private:
+  DispatchArena * arena_;
+};
+
+template<typename T, typename U>
+bool
+operator==(const DispatchArenaAllocator<T> & lhs, const DispatchArenaAllocator<U> & rhs) noexcept
+{
+  return lhs.get_arena() == rhs.get_arena();
+}
+
+template<typename T, typename U>
+bool
+operator!=(const DispatchArenaAllocator<T> & lhs, const DispatchArenaAllocator<U> & rhs) noexcept
+{
+  return !(lhs == rhs);
+}
+
+/// Get the arena of the executor dispatching work in the calling thread, nullptr if none.
+RCLCPP_PUBLIC
+DispatchArena *
+get_dispatch_arena();
+
+/// Make the dispatch arena of the calling thread current in this scope.
+/**
+ * Each thread has its own arena, created by the first scope of the thread and kept for the
+ * following scopes, unless they use another chunk size.
+ * The arena isn't reset by the scope, it's up to the executor to reset it once the data
+ * allocated for a callback is released.
+ */
+class DispatchArenaScope
+{
+public:
+  /// Make the arena of the thread current, unless chunk_size is zero.
+  /**
+   * \param[in] chunk_size the size in bytes of the chunks of the arena, zero to disable it
+   */
+  RCLCPP_PUBLIC
+  explicit DispatchArenaScope(size_t chunk_size);
+
+  RCLCPP_PUBLIC
+  ~DispatchArenaScope();
+
+private:
+  RCLCPP_DISABLE_COPY(DispatchArenaScope)
+
+  bool active_;
+  DispatchArena * previous_;
+};
+
+/// Create a shared object in the current dispatch arena, or on the heap if there is none.
+template<typename T, typename ... Args>
+std::shared_ptr<T>
+make_dispatch_shared(Args && ... args)
+{
+  DispatchArena * arena = get_dispatch_arena();
+  if (arena) {
+    return std::allocate_shared<T>(
+      DispatchArenaAllocator<T>(arena), std::forward<Args>(args)...);
+  }
+  return std::make_shared<T>(std::forward<Args>(args)...);
+}
+
+}  // namespace detail
+}  // namespace rclcpp
+
+#endif  // RCLCPP__DETAIL__DISPATCH_ARENA_HPP_
@@ -104,6 +104,22 @@ declare_parameter_or_get(
   }
 }
 
+/// \internal Check the profile with the validation callback of the options, if any.
+inline
+rclcpp::QoS
+validate_qos_overrides(const ::rclcpp::QosOverridingOptions & options, rclcpp::QoS qos)
+{
+  const auto & validation_callback = options.get_validation_callback();
+  if (validation_callback) {
+    auto result = validation_callback(qos);
+    if (!result.successful) {
+      throw rclcpp::exceptions::InvalidQosOverridesException{
+              "validation callback failed: " + result.reason};
+    }
+  }
+  return qos;
+}
+
 #ifdef DOXYGEN_ONLY
 /// \internal Declare QoS parameters for the given entity.
 /**
@@ -154,6 +170,16 @@ declare_qos_parameters(
     oss << ".";
     param_prefix = oss.str();
   }
+  rclcpp::QoS qos = default_qos;
+  const bool declare_only_overridden = options.get_declare_only_overridden();
+  const auto & overrides = parameters_interface.get_parameter_overrides();
+  if (declare_only_overridden) {
+    // The overrides are sorted by name, the ones of this entity follow the prefix
+    auto it = overrides.lower_bound(param_prefix);
+    if (it == overrides.end() || it->first.compare(0, param_prefix.size(), param_prefix) != 0) {
+      return validate_qos_overrides(options, qos);
+    }
+  }
   std::string param_description_suffix;
   {
     std::ostringstream oss{"} for ", std::ios::ate};
@@ -163,33 +189,26 @@ declare_qos_parameters(
     }
     param_description_suffix = oss.str();
   }
-  rclcpp::QoS qos = default_qos;
   for (auto policy : EntityQosParametersTraits::allowed_policies()) {
     if (
       std::count(options.get_policy_kinds().begin(), options.get_policy_kinds().end(), policy))
     {
-      std::ostringstream param_name{param_prefix, std::ios::ate};
-      param_name << qos_policy_kind_to_cstr(policy);
+      std::string param_name = param_prefix + qos_policy_kind_to_cstr(policy);
+      if (declare_only_overridden && overrides.find(param_name) == overrides.end()) {
+        continue;
+      }
       std::ostringstream param_desciption{"qos policy {", std::ios::ate};
       param_desciption << qos_policy_kind_to_cstr(policy) << param_description_suffix;
       rcl_interfaces::msg::ParameterDescriptor descriptor{};
       descriptor.description = param_desciption.str();
       descriptor.read_only = true;
       auto value = declare_parameter_or_get(
-        parameters_interface, param_name.str(),
+        parameters_interface, param_name,
         get_default_qos_param_value(policy, qos), descriptor);
       ::rclcpp::detail::apply_qos_override(policy, value, qos);
     }
   }
-  const auto & validation_callback = options.get_validation_callback();
-  if (validation_callback) {
-    auto result = validation_callback(qos);
-    if (!result.successful) {
-      throw rclcpp::exceptions::InvalidQosOverridesException{
-              "validation callback failed: " + result.reason};
-    }
-  }
-  return qos;
+  return validate_qos_overrides(options, qos);
 }
 
 // TODO(ivanpauno): This overload cannot declare the QoS parameters, as a node parameters interface
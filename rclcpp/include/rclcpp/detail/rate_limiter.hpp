@@ -0,0 +1,98 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__DETAIL__RATE_LIMITER_HPP_
+#define RCLCPP__DETAIL__RATE_LIMITER_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+
+namespace rclcpp
+{
+namespace detail
+{
+
+/// Lock-free limit of the rate at which events are accepted, used to decimate messages.
+/**
+ * Events are accepted at most once per period, on average: an event accepted late moves the
+ * next accepted one earlier, unless the previous one is more than a period late.
+ */
+class RateLimiter
+{
+public:
+  /// Create a limiter accepting events at most at max_rate Hz, or every event if zero.
+  /**
+   * \throws std::invalid_argument if max_rate is negative or not finite
+   */
+  explicit RateLimiter(double max_rate = 0.0)
+  {
+    set_max_rate(max_rate);
+  }
+
+  /// Set the maximum rate of the accepted events in Hz, zero to accept every event.
+  /**
+   * \throws std::invalid_argument if max_rate is negative or not finite
+   */
+  void
+  set_max_rate(double max_rate)
+  {
+    if (!std::isfinite(max_rate) || max_rate < 0.0) {
+      throw std::invalid_argument("max_rate must be zero, or a positive rate in Hz");
+    }
+    max_rate_.store(max_rate);
+    period_ns_.store(max_rate > 0.0 ? static_cast<int64_t>(1e9 / max_rate) : 0);
+  }
+
+  /// Get the maximum rate of the accepted events in Hz, zero if every event is accepted.
+  double
+  get_max_rate() const
+  {
+    return max_rate_.load();
+  }
+
+  /// Return true if an event occurring now is accepted, thread-safe.
+  bool
+  try_accept()
+  {
+    const int64_t period_ns = period_ns_.load(std::memory_order_relaxed);
+    if (0 == period_ns) {
+      return true;
+    }
+    const int64_t now_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now().time_since_epoch()).count();
+    int64_t next_ns = next_ns_.load(std::memory_order_relaxed);
+    while (now_ns >= next_ns) {
+      const int64_t new_next_ns =
+        (now_ns - next_ns < period_ns ? next_ns : now_ns) + period_ns;
+      if (next_ns_.compare_exchange_weak(next_ns, new_next_ns, std::memory_order_relaxed)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+private:
+  std::atomic<double> max_rate_{0.0};
+  std::atomic<int64_t> period_ns_{0};
+  // Steady time from which the next event is accepted
+  std::atomic<int64_t> next_ns_{0};
+};
+
+}  // namespace detail
+}  // namespace rclcpp
+
+#endif  // RCLCPP__DETAIL__RATE_LIMITER_HPP_
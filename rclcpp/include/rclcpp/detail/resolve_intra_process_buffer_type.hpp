@@ -26,7 +26,7 @@ namespace rclcpp
 namespace detail
 {
 
-/// Return the buffer type, resolving the "CallbackDefault" type to an actual type if needed.
+/// Return the buffer type, resolving the "CallbackDefault" types to an actual type if needed.
 template<typename CallbackMessageT, typename AllocatorT>
 rclcpp::IntraProcessBufferType
 resolve_intra_process_buffer_type(
@@ -36,12 +36,28 @@ resolve_intra_process_buffer_type(
   rclcpp::IntraProcessBufferType resolved_buffer_type = buffer_type;
 
   // If the user has not specified a type for the intra-process buffer, use the callback's type.
+  // Callbacks taking a const reference get shared messages, which are never copied for them.
+  const bool use_shared_buffer =
+    any_subscription_callback.use_take_shared_method() ||
+    any_subscription_callback.use_const_reference_method();
   if (resolved_buffer_type == IntraProcessBufferType::CallbackDefault) {
-    if (any_subscription_callback.use_take_shared_method()) {
+    if (use_shared_buffer) {
       resolved_buffer_type = IntraProcessBufferType::SharedPtr;
     } else {
       resolved_buffer_type = IntraProcessBufferType::UniquePtr;
     }
+  } else if (resolved_buffer_type == IntraProcessBufferType::LockFreeCallbackDefault) {
+    if (use_shared_buffer) {
+      resolved_buffer_type = IntraProcessBufferType::LockFreeSharedPtr;
+    } else {
+      resolved_buffer_type = IntraProcessBufferType::LockFreeUniquePtr;
+    }
+  } else if (resolved_buffer_type == IntraProcessBufferType::MailboxCallbackDefault) {
+    if (use_shared_buffer) {
+      resolved_buffer_type = IntraProcessBufferType::MailboxSharedPtr;
+    } else {
+      resolved_buffer_type = IntraProcessBufferType::MailboxUniquePtr;
+    }
   }
 
   return resolved_buffer_type;
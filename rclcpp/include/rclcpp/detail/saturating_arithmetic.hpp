@@ -0,0 +1,57 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__DETAIL__SATURATING_ARITHMETIC_HPP_
+#define RCLCPP__DETAIL__SATURATING_ARITHMETIC_HPP_
+
+#include <cstdint>
+#include <limits>
+
+namespace rclcpp
+{
+namespace detail
+{
+
+/// Add two nanosecond counts, clamping the sum to the range of int64_t.
+constexpr
+int64_t
+saturating_add(int64_t x, int64_t y) noexcept
+{
+  if (y > 0 && x > std::numeric_limits<int64_t>::max() - y) {
+    return std::numeric_limits<int64_t>::max();
+  }
+  if (y < 0 && x < std::numeric_limits<int64_t>::min() - y) {
+    return std::numeric_limits<int64_t>::min();
+  }
+  return x + y;
+}
+
+/// Subtract two nanosecond counts, clamping the difference to the range of int64_t.
+constexpr
+int64_t
+saturating_sub(int64_t x, int64_t y) noexcept
+{
+  if (y < 0 && x > std::numeric_limits<int64_t>::max() + y) {
+    return std::numeric_limits<int64_t>::max();
+  }
+  if (y > 0 && x < std::numeric_limits<int64_t>::min() + y) {
+    return std::numeric_limits<int64_t>::min();
+  }
+  return x - y;
+}
+
+}  // namespace detail
+}  // namespace rclcpp
+
+#endif  // RCLCPP__DETAIL__SATURATING_ARITHMETIC_HPP_
@@ -0,0 +1,213 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__DETAIL__SERVICE_EVENT_PUBLISHER_HPP_
+#define RCLCPP__DETAIL__SERVICE_EVENT_PUBLISHER_HPP_
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+
+#include "rcl/error_handling.h"
+#include "rcl/publisher.h"
+#include "rcl/service_introspection.h"
+
+#include "rclcpp/clock.hpp"
+#include "rclcpp/detail/shared_object_pool.hpp"
+#include "rclcpp/exceptions.hpp"
+#include "rclcpp/get_message_type_support_handle.hpp"
+#include "rclcpp/logging.hpp"
+#include "rclcpp/qos.hpp"
+#include "rclcpp/service_introspection_options.hpp"
+
+namespace rclcpp
+{
+namespace detail
+{
+
+/// Publisher of the introspection events of a client or a service, sampled and pooled.
+/**
+ * This replaces the event publisher of rcl when the introspection is configured with
+ * rclcpp::ServiceIntrospectionOptions.
+ * The events are published on the same topic and with the same contents as rcl does.
+ */
+template<typename ServiceT>
+class ServiceEventPublisher
+{
+public:
+  using Event = typename ServiceT::Event;
+  using EventInfo = decltype(Event::info);
+
+  ServiceEventPublisher(
+    std::shared_ptr<rcl_node_t> node_handle,
+    const std::string & service_name,
+    rclcpp::Clock::SharedPtr clock,
+    const rclcpp::QoS & qos,
+    bool publish_contents,
+    const rclcpp::ServiceIntrospectionOptions & options)
+  : node_handle_(std::move(node_handle)),
+    clock_(std::move(clock)),
+    publish_contents_(publish_contents),
+    options_(options),
+    event_pool_(options.asynchronous ? options.queue_depth + 1 : 1)
+  {
+    if (options_.sample_period == 0) {
+      throw std::invalid_argument("sample_period must be positive");
+    }
+    if (options_.asynchronous && options_.queue_depth == 0) {
+      throw std::invalid_argument("queue_depth must be positive");
+    }
+    rcl_publisher_options_t publisher_options = rcl_publisher_get_default_options();
+    publisher_options.qos = qos.get_rmw_qos_profile();
+    const std::string topic_name = service_name + RCL_SERVICE_INTROSPECTION_TOPIC_POSTFIX;
+    rcl_ret_t ret = rcl_publisher_init(
+      &publisher_, node_handle_.get(),
+      &rclcpp::get_message_type_support_handle<Event>(),
+      topic_name.c_str(), &publisher_options);
+    if (RCL_RET_OK != ret) {
+      rclcpp::exceptions::throw_from_rcl_error(ret, "failed to create service event publisher");
+    }
+    if (options_.asynchronous) {
+      thread_ = std::thread([this]() {run();});
+    }
+  }
+
+  ~ServiceEventPublisher()
+  {
+    if (thread_.joinable()) {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopped_ = true;
+      }
+      condition_.notify_one();
+      thread_.join();
+    }
+    if (RCL_RET_OK != rcl_publisher_fini(&publisher_, node_handle_.get())) {
+      RCLCPP_ERROR(
+        rclcpp::get_logger("rclcpp"), "failed to destroy service event publisher: %s",
+        rcl_get_error_string().str);
+      rcl_reset_error();
+    }
+  }
+
+  /// Publish an event of the given type, if its call is sampled.
+  /**
+   * \param[in] event_type one of the event types of the ServiceEventInfo message
+   * \param[in] client_gid the RMW_GID_STORAGE_SIZE bytes of the gid of the client
+   * \param[in] sequence_number the sequence number of the call
+   * \param[in] request the request of the event, nullptr for a response event
+   * \param[in] response the response of the event, nullptr for a request event
+   */
+  void
+  publish(
+    uint8_t event_type,
+    const void * client_gid,
+    int64_t sequence_number,
+    const typename ServiceT::Request * request,
+    const typename ServiceT::Response * response)
+  {
+    if (static_cast<uint64_t>(sequence_number) % options_.sample_period != 0) {
+      return;
+    }
+    std::shared_ptr<Event> event = event_pool_.acquire();
+    event->info.event_type = event_type;
+    event->info.stamp = clock_->now();
+    std::memcpy(
+      event->info.client_gid.data(), client_gid,
+      std::min(event->info.client_gid.size(), static_cast<size_t>(RMW_GID_STORAGE_SIZE)));
+    event->info.sequence_number = sequence_number;
+    // Assigned in place, so that the pooled event reuses the memory of the previous contents
+    const bool has_request = publish_contents_ && request;
+    const bool has_response = publish_contents_ && response;
+    event->request.resize(has_request ? 1 : 0);
+    event->response.resize(has_response ? 1 : 0);
+    if (has_request) {
+      event->request[0] = *request;
+    }
+    if (has_response) {
+      event->response[0] = *response;
+    }
+
+    if (!options_.asynchronous) {
+      publish_event(*event);
+      return;
+    }
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (queue_.size() >= options_.queue_depth) {
+        return;
+      }
+      queue_.push_back(std::move(event));
+    }
+    condition_.notify_one();
+  }
+
+private:
+  void
+  publish_event(const Event & event)
+  {
+    if (RCL_RET_OK != rcl_publish(&publisher_, &event, nullptr)) {
+      RCLCPP_ERROR(
+        rclcpp::get_logger("rclcpp"), "failed to publish service event: %s",
+        rcl_get_error_string().str);
+      rcl_reset_error();
+    }
+  }
+
+  void
+  run()
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      condition_.wait(lock, [this]() {return stopped_ || !queue_.empty();});
+      if (stopped_) {
+        return;
+      }
+      std::shared_ptr<Event> event = std::move(queue_.front());
+      queue_.pop_front();
+      lock.unlock();
+      publish_event(*event);
+      // Released before locking, so that the event is free in the pool once the queue is
+      event.reset();
+      lock.lock();
+    }
+  }
+
+  std::shared_ptr<rcl_node_t> node_handle_;
+  rcl_publisher_t publisher_ = rcl_get_zero_initialized_publisher();
+  rclcpp::Clock::SharedPtr clock_;
+  const bool publish_contents_;
+  const rclcpp::ServiceIntrospectionOptions options_;
+
+  SharedObjectPool<Event> event_pool_;
+
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  std::deque<std::shared_ptr<Event>> queue_;
+  bool stopped_ = false;
+  std::thread thread_;
+};
+
+}  // namespace detail
+}  // namespace rclcpp
+
+#endif  // RCLCPP__DETAIL__SERVICE_EVENT_PUBLISHER_HPP_
@@ -0,0 +1,84 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__DETAIL__SHARED_OBJECT_POOL_HPP_
+#define RCLCPP__DETAIL__SHARED_OBJECT_POOL_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace rclcpp
+{
+namespace detail
+{
+
+/// Fixed set of shared objects, handed out again once nobody else holds them.
+/**
+ * An object is free when the pool holds the only reference to it, so the objects can be
+ * kept by their users for as long as they want: they are just not reused in the meantime.
+ * When all the objects are in use, a new one is allocated and isn't kept by the pool.
+ *
+ * Reused objects keep their previous contents.
+ * A pool of size zero always allocates new objects, without locking.
+ */
+template<typename T>
+class SharedObjectPool
+{
+public:
+  explicit SharedObjectPool(size_t size = 0)
+  {
+    objects_.reserve(size);
+    for (size_t i = 0; i < size; ++i) {
+      objects_.push_back(std::make_shared<T>());
+    }
+  }
+
+  /// Get a free object of the pool, or a new object if none is free.
+  std::shared_ptr<T>
+  acquire()
+  {
+    if (objects_.empty()) {
+      return std::make_shared<T>();
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto & object : objects_) {
+      // Only the pool can add references, so a free object can't be taken concurrently
+      if (object.use_count() == 1) {
+        // Synchronize with the release of the last user of the object
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return object;
+      }
+    }
+    return std::make_shared<T>();
+  }
+
+  /// Get the number of objects of the pool.
+  size_t
+  size() const
+  {
+    return objects_.size();
+  }
+
+private:
+  std::vector<std::shared_ptr<T>> objects_;
+  std::mutex mutex_;
+};
+
+}  // namespace detail
+}  // namespace rclcpp
+
+#endif  // RCLCPP__DETAIL__SHARED_OBJECT_POOL_HPP_
@@ -19,6 +19,7 @@
 
 #include "builtin_interfaces/msg/duration.hpp"
 #include "rcl/time.h"
+#include "rclcpp/detail/saturating_arithmetic.hpp"
 #include "rclcpp/visibility_control.hpp"
 
 namespace rclcpp
@@ -58,7 +59,7 @@ public:
    */
   explicit Duration(const rcl_duration_t & duration);
 
-  Duration(const Duration & rhs);
+  Duration(const Duration & rhs) = default;
 
   virtual ~Duration() = default;
 
@@ -66,39 +67,83 @@ public:
 
   // cppcheck-suppress operatorEq // this is a false positive from cppcheck
   Duration &
-  operator=(const Duration & rhs);
+  operator=(const Duration & rhs) = default;
 
   Duration &
   operator=(const builtin_interfaces::msg::Duration & duration_msg);
 
   bool
-  operator==(const rclcpp::Duration & rhs) const;
+  operator==(const rclcpp::Duration & rhs) const noexcept
+  {
+    return rcl_duration_.nanoseconds == rhs.rcl_duration_.nanoseconds;
+  }
 
   bool
-  operator!=(const rclcpp::Duration & rhs) const;
+  operator!=(const rclcpp::Duration & rhs) const noexcept
+  {
+    return rcl_duration_.nanoseconds != rhs.rcl_duration_.nanoseconds;
+  }
 
   bool
-  operator<(const rclcpp::Duration & rhs) const;
+  operator<(const rclcpp::Duration & rhs) const noexcept
+  {
+    return rcl_duration_.nanoseconds < rhs.rcl_duration_.nanoseconds;
+  }
 
   bool
-  operator<=(const rclcpp::Duration & rhs) const;
+  operator<=(const rclcpp::Duration & rhs) const noexcept
+  {
+    return rcl_duration_.nanoseconds <= rhs.rcl_duration_.nanoseconds;
+  }
 
   bool
-  operator>=(const rclcpp::Duration & rhs) const;
+  operator>=(const rclcpp::Duration & rhs) const noexcept
+  {
+    return rcl_duration_.nanoseconds >= rhs.rcl_duration_.nanoseconds;
+  }
 
   bool
-  operator>(const rclcpp::Duration & rhs) const;
+  operator>(const rclcpp::Duration & rhs) const noexcept
+  {
+    return rcl_duration_.nanoseconds > rhs.rcl_duration_.nanoseconds;
+  }
 
+  /// Add a duration.
+  /**
+   * \throws std::overflow_error or std::underflow_error if the sum isn't representable
+   * \sa saturating_add() for a variant which doesn't throw
+   */
   Duration
   operator+(const rclcpp::Duration & rhs) const;
 
   Duration & operator+=(const rclcpp::Duration & rhs);
 
+  /// Subtract a duration.
+  /**
+   * \throws std::overflow_error or std::underflow_error if the difference isn't representable
+   * \sa saturating_sub() for a variant which doesn't throw
+   */
   Duration
   operator-(const rclcpp::Duration & rhs) const;
 
   Duration & operator-=(const rclcpp::Duration & rhs);
 
+  /// Add a duration, clamping the sum to the range of rcl_duration_value_t.
+  Duration
+  saturating_add(const rclcpp::Duration & rhs) const noexcept
+  {
+    return from_nanoseconds(
+      detail::saturating_add(rcl_duration_.nanoseconds, rhs.rcl_duration_.nanoseconds));
+  }
+
+  /// Subtract a duration, clamping the difference to the range of rcl_duration_value_t.
+  Duration
+  saturating_sub(const rclcpp::Duration & rhs) const noexcept
+  {
+    return from_nanoseconds(
+      detail::saturating_sub(rcl_duration_.nanoseconds, rhs.rcl_duration_.nanoseconds));
+  }
+
   /// Get the maximum representable value.
   /**
    * \return the maximum representable value
@@ -118,7 +163,10 @@ public:
    * \return the duration in nanoseconds as a rcl_duration_value_t.
    */
   rcl_duration_value_t
-  nanoseconds() const;
+  nanoseconds() const noexcept
+  {
+    return rcl_duration_.nanoseconds;
+  }
 
   /// Get duration in seconds
   /**
@@ -135,7 +183,12 @@ public:
 
   /// Create a duration object from an integer number representing nanoseconds
   static Duration
-  from_nanoseconds(rcl_duration_value_t nanoseconds);
+  from_nanoseconds(rcl_duration_value_t nanoseconds) noexcept
+  {
+    Duration ret;
+    ret.rcl_duration_.nanoseconds = nanoseconds;
+    return ret;
+  }
 
   static Duration
   from_rmw_time(rmw_time_t duration);
@@ -30,6 +30,7 @@
 #include "rcutils/logging_macros.h"
 
 #include "rclcpp/detail/cpp_callback_trampoline.hpp"
+#include "rclcpp/detail/dispatch_arena.hpp"
 #include "rclcpp/exceptions.hpp"
 #include "rclcpp/function_traits.hpp"
 #include "rclcpp/logging.hpp"
@@ -282,7 +283,8 @@ public:
         "Couldn't take event info: %s", rcl_get_error_string().str);
       return nullptr;
     }
-    return std::static_pointer_cast<void>(std::make_shared<EventCallbackInfoT>(callback_info));
+    return std::static_pointer_cast<void>(
+      rclcpp::detail::make_dispatch_shared<EventCallbackInfoT>(callback_info));
   }
 
   std::shared_ptr<void>
@@ -0,0 +1,144 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__EVENT_HANDLER_GROUP_HPP_
+#define RCLCPP__EVENT_HANDLER_GROUP_HPP_
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "rcl/wait.h"
+
+#include "rclcpp/event_handler.hpp"
+#include "rclcpp/macros.hpp"
+#include "rclcpp/visibility_control.hpp"
+#include "rclcpp/waitable.hpp"
+
+namespace rclcpp
+{
+
+/// Waitable executing the QoS event handlers of many endpoints, as a single waitable.
+/**
+ * The event handlers are added to the group instead of being added to a callback group one
+ * by one, so that executors collect, check and execute one waitable for all of them.
+ * All the events of the handlers are still added to the rcl wait set.
+ * One execution of the group executes all the event handlers which were ready.
+ *
+ * The group doesn't own the event handlers, which are owned by their publisher or
+ * subscription, and drops them once they are destroyed.
+ */
+class EventHandlerGroup : public Waitable
+{
+public:
+  RCLCPP_SMART_PTR_DEFINITIONS_NOT_COPYABLE(EventHandlerGroup)
+
+  RCLCPP_PUBLIC
+  EventHandlerGroup() = default;
+
+  RCLCPP_PUBLIC
+  ~EventHandlerGroup() override;
+
+  /// Add an event handler to the group.
+  /**
+   * Executors waiting with a wait set wait for the event from their next wait.
+   *
+   * \param[in] event_handler the event handler to add
+   * \throws std::invalid_argument if the event handler is nullptr
+   */
+  RCLCPP_PUBLIC
+  void
+  add_event_handler(std::shared_ptr<rclcpp::EventHandlerBase> event_handler);
+
+  /// Get the number of event handlers of the group which weren't destroyed.
+  RCLCPP_PUBLIC
+  size_t
+  size() const;
+
+  /// Get the number of events to add to a wait set, i.e. of live event handlers.
+  RCLCPP_PUBLIC
+  size_t
+  get_number_of_ready_events() override;
+
+  /// Add the events of all the live event handlers to a wait set.
+  RCLCPP_PUBLIC
+  void
+  add_to_wait_set(rcl_wait_set_t * wait_set) override;
+
+  /// Check if any event handler is ready, and remember which ones to execute them.
+  RCLCPP_PUBLIC
+  bool
+  is_ready(rcl_wait_set_t * wait_set) override;
+
+  /// Take the events of all the event handlers found ready by is_ready().
+  RCLCPP_PUBLIC
+  std::shared_ptr<void>
+  take_data() override;
+
+  /// Take the event of the event handler with the given identifier.
+  /**
+   * The identifier is the one given to the 'on ready' callback by the event handler.
+   */
+  RCLCPP_PUBLIC
+  std::shared_ptr<void>
+  take_data_by_entity_id(size_t id) override;
+
+  /// Execute the event handlers whose events were taken.
+  RCLCPP_PUBLIC
+  void
+  execute(std::shared_ptr<void> & data) override;
+
+  /// Set the 'on ready' callback of all the event handlers, current and future.
+  /**
+   * The identifier given to the callback is the handler index used by
+   * take_data_by_entity_id().
+   *
+   * \sa rclcpp::EventHandlerBase::set_on_ready_callback
+   */
+  RCLCPP_PUBLIC
+  void
+  set_on_ready_callback(std::function<void(size_t, int)> callback) override;
+
+  /// Unset the 'on ready' callback of all the event handlers.
+  RCLCPP_PUBLIC
+  void
+  clear_on_ready_callback() override;
+
+private:
+  /// Events taken from the ready event handlers, with the handlers executing them.
+  struct TakenEvents
+  {
+    std::vector<std::pair<std::shared_ptr<rclcpp::EventHandlerBase>, std::shared_ptr<void>>>
+    events;
+  };
+
+  /// Set the 'on ready' callback of the event handler at the given index.
+  void
+  set_handler_on_ready_callback(rclcpp::EventHandlerBase & event_handler, size_t index);
+
+  mutable std::mutex mutex_;
+  // Indexes are the identifiers of the 'on ready' callbacks, so destroyed handlers are only
+  // removed when no such callback is set
+  std::vector<std::weak_ptr<rclcpp::EventHandlerBase>> event_handlers_;
+  // The first ones are waited for, counted by the last call to get_number_of_ready_events()
+  size_t number_of_waited_handlers_ = 0;
+  std::vector<std::shared_ptr<rclcpp::EventHandlerBase>> ready_handlers_;
+  std::function<void(size_t, int)> on_ready_callback_;
+};
+
+}  // namespace rclcpp
+
+#endif  // RCLCPP__EVENT_HANDLER_GROUP_HPP_
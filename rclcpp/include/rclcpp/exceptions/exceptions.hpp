@@ -15,6 +15,7 @@
 #ifndef RCLCPP__EXCEPTIONS__EXCEPTIONS_HPP_
 #define RCLCPP__EXCEPTIONS__EXCEPTIONS_HPP_
 
+#include <cstdint>
 #include <stdexcept>
 #include <string>
 #include <vector>
@@ -344,6 +345,31 @@ class QoSCheckCompatibleException : public std::runtime_error
   using std::runtime_error::runtime_error;
 };
 
+/// Thrown if the QoS of a publisher or subscription doesn't allow intra-process comms.
+class IntraProcessQoSIncompatibleError : public std::invalid_argument
+{
+  // Inherit constructors from invalid_argument.
+  using std::invalid_argument::invalid_argument;
+};
+
+/// Thrown if heap memory is allocated where it was declared it shouldn't be anymore.
+/**
+ * \sa rclcpp::allocation_tracking::enter_steady_state()
+ */
+class AllocationInSteadyStateError : public std::runtime_error
+{
+public:
+  AllocationInSteadyStateError(uint64_t allocation_count, const std::string & context)
+  : std::runtime_error(
+      std::to_string(allocation_count) + " heap allocation(s) while " + context +
+      " in steady state"),
+    allocation_count(allocation_count)
+  {}
+
+  /// Number of allocations which were made.
+  const uint64_t allocation_count;
+};
+
 }  // namespace exceptions
 }  // namespace rclcpp
 
@@ -18,12 +18,14 @@
 #include <algorithm>
 #include <cassert>
 #include <chrono>
+#include <cstdint>
 #include <cstdlib>
 #include <iostream>
 #include <list>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -31,16 +33,21 @@
 #include "rcl/wait.h"
 #include "rcpputils/scope_exit.hpp"
 
+#include "rclcpp/backlog.hpp"
+#include "rclcpp/callback_statistics.hpp"
+#include "rclcpp/flight_recorder.hpp"
 #include "rclcpp/context.hpp"
 #include "rclcpp/contexts/default_context.hpp"
 #include "rclcpp/guard_condition.hpp"
 #include "rclcpp/executor_options.hpp"
+#include "rclcpp/future_completion.hpp"
 #include "rclcpp/future_return_code.hpp"
 #include "rclcpp/memory_strategies.hpp"
 #include "rclcpp/memory_strategy.hpp"
 #include "rclcpp/node_interfaces/node_base_interface.hpp"
 #include "rclcpp/utilities.hpp"
 #include "rclcpp/visibility_control.hpp"
+#include "rclcpp/warm_up_options.hpp"
 
 namespace rclcpp
 {
@@ -345,8 +352,30 @@ public:
   virtual void
   spin_once(std::chrono::nanoseconds timeout = std::chrono::nanoseconds(-1));
 
+  /// Prepare the executor to spin without allocating memory or page faulting, before spinning.
+  /**
+   * The entities of the executor are collected, so that its containers and wait set are sized
+   * for them, without executing any work.
+   * The stack and heap are then prefaulted and the memory locked as configured by the options,
+   * the threads started later by the executor also prefault their stack.
+   * Entities added afterwards may still allocate memory when they are first collected.
+   *
+   * \param[in] options what to prepare besides the entities
+   * \throws std::runtime_error if the executor is spinning or an option isn't supported
+   * \throws std::invalid_argument if the stack to prefault isn't smaller than the stack of the
+   *   calling thread
+   */
+  RCLCPP_PUBLIC
+  virtual void
+  warm_up(const rclcpp::WarmUpOptions & options = rclcpp::WarmUpOptions());
+
   /// Spin (blocking) until the future is complete, it times out waiting, or rclcpp is interrupted.
   /**
+   * The futures returned by rclcpp, e.g. by Client::async_send_request(), wake the executor
+   * once completed, even by another thread, so this returns without waiting for other work.
+   * Other futures completed by other threads should be followed by a call to
+   * rclcpp::notify_future_completion() to do the same.
+   *
    * \param[in] future The future to wait on. If this function returns SUCCESS, the future can be
    *   accessed without blocking (though it may still throw an exception).
    * \param[in] timeout Optional timeout parameter, which gets passed to Executor::spin_node_once.
@@ -383,6 +412,13 @@ public:
       throw std::runtime_error("spin_until_future_complete() called while already spinning");
     }
     RCPPUTILS_SCOPE_EXIT(this->spinning.store(false); );
+
+    // Interrupt the wait as soon as the future is completed by another thread, the future
+    // is checked again as it may have been completed before the listener was registered
+    rclcpp::detail::FutureCompletionListener completion_listener(interrupt_guard_condition_);
+    if (future.wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+      return FutureReturnCode::SUCCESS;
+    }
     while (rclcpp::ok(this->context_) && spinning.load()) {
       // Do one item of work.
       spin_once_impl(timeout_left);
@@ -438,6 +474,56 @@ public:
   bool
   is_spinning();
 
+  /// Get the statistics of the callbacks executed so far, one entry per entity.
+  /**
+   * Statistics are only recorded if the executor was created with
+   * ExecutorOptions::collect_callback_statistics set, otherwise the returned vector is empty.
+   * The wait latency is the time between the end of the wait for work which found the entity
+   * ready and the start of its execution.
+   * This function can be called asynchronously from any thread, the returned statistics keep
+   * being updated while the executor spins.
+   * \return the statistics of each entity executed so far
+   */
+  RCLCPP_PUBLIC
+  std::vector<rclcpp::CallbackStatistics::ConstSharedPtr>
+  get_callback_statistics() const;
+
+  /// Get the number of times the executor waited for work on its wait set.
+  /**
+   * This counts the calls of wait_for_work(), by all the threads of the executor.
+   * Executors which don't wait on the wait set of this class, like the events executor,
+   * always return 0.
+   */
+  RCLCPP_PUBLIC
+  uint64_t
+  get_wait_count() const;
+
+  /// Get a snapshot of the work waiting to be executed, one entry per subscription.
+  /**
+   * The subscriptions are the ones of the callback groups returned by
+   * get_all_callback_groups(), their backlog is read with atomic loads only, so this can be
+   * called from any thread while the executor spins.
+   * \sa rclcpp::SubscriptionBase::get_backlog()
+   * \return the backlog of the subscriptions and of the events queue, if any
+   */
+  RCLCPP_PUBLIC
+  virtual rclcpp::ExecutorBacklog
+  get_backlog();
+
+  /// Get the recorder of the last callbacks executed by the threads of the executor.
+  /**
+   * \sa rclcpp::ExecutorOptions::flight_recorder_size
+   * \return the flight recorder, or nullptr if the executor was created without one
+   */
+  RCLCPP_PUBLIC
+  rclcpp::FlightRecorder::SharedPtr
+  get_flight_recorder() const;
+
+  /// Discard the callback statistics recorded so far.
+  RCLCPP_PUBLIC
+  void
+  reset_callback_statistics();
+
 protected:
   /// Add a node to executor, execute the next available unit of work, and remove the node.
   /**
@@ -484,7 +570,7 @@ protected:
   RCLCPP_PUBLIC
   static void
   execute_subscription(
-    rclcpp::SubscriptionBase::SharedPtr subscription);
+    const rclcpp::SubscriptionBase::SharedPtr & subscription);
 
   /// Run timer executable.
   /**
@@ -493,7 +579,7 @@ protected:
    */
   RCLCPP_PUBLIC
   static void
-  execute_timer(rclcpp::TimerBase::SharedPtr timer);
+  execute_timer(const rclcpp::TimerBase::SharedPtr & timer);
 
   /// Run service server executable.
   /**
@@ -502,7 +588,7 @@ protected:
    */
   RCLCPP_PUBLIC
   static void
-  execute_service(rclcpp::ServiceBase::SharedPtr service);
+  execute_service(const rclcpp::ServiceBase::SharedPtr & service);
 
   /// Run service client executable.
   /**
@@ -511,7 +597,7 @@ protected:
    */
   RCLCPP_PUBLIC
   static void
-  execute_client(rclcpp::ClientBase::SharedPtr client);
+  execute_client(const rclcpp::ClientBase::SharedPtr & client);
 
   /// Block until more work becomes avilable or timeout is reached.
   /**
@@ -524,6 +610,23 @@ protected:
   void
   wait_for_work(std::chrono::nanoseconds timeout = std::chrono::nanoseconds(-1));
 
+  /// Collect the entities of the executor and size its containers for them, for warm_up().
+  /**
+   * The default implementation waits for work without blocking, the ready work is executed
+   * by the next spin.
+   */
+  RCLCPP_PUBLIC
+  virtual void
+  prepare_entities();
+
+  /// Prefault the stack of the calling thread as configured by the last warm_up(), if any.
+  /**
+   * To be called by the threads started by the executor before they execute any work.
+   */
+  RCLCPP_PUBLIC
+  void
+  prefault_thread_stack();
+
   /// Find node associated with a callback group
   /**
    * \param[in] weak_groups_to_nodes map of callback groups to nodes
@@ -590,6 +693,33 @@ protected:
   bool
   get_next_ready_executable(AnyExecutable & any_executable);
 
+  /// Take the ready executable whose callback group has the highest priority.
+  /**
+   * All the executables the memory strategy found ready are moved into a local list, so
+   * that they can be compared.
+   * The ones not taken are discarded at the next wait_for_work(), except timers which
+   * have already been called.
+   * Among executables with the same priority, the order of the memory strategy is kept,
+   * unless fair scheduling is enabled: then the one whose entity has credit left and was
+   * executed the longest time ago is taken, see ExecutorOptions::fair_scheduling.
+   * Without priority scheduling, all the callback groups have the same priority here.
+   *
+   * \param[out] any_executable populated union structure of ready executable
+   * \param[in] weak_groups_to_nodes map of callback groups to nodes
+   * \return true if an executable was ready and any_executable was populated,
+   *   otherwise false
+   */
+  RCLCPP_PUBLIC
+  bool
+  get_highest_priority_ready_executable(
+    AnyExecutable & any_executable,
+    const WeakCallbackGroupsToNodesMap & weak_groups_to_nodes) RCPPUTILS_TSA_REQUIRES(mutex_);
+
+  /// Discard the ready executables, other than timers, not taken by the priority scheduling.
+  RCLCPP_PUBLIC
+  void
+  clear_prioritized_ready_executables() RCPPUTILS_TSA_REQUIRES(mutex_);
+
   /// Check for executable in ready state and populate union structure.
   /**
    * This is the implementation of get_next_ready_executable that takes into
@@ -603,6 +733,9 @@ protected:
    *   * Clients
    *   * Waitable
    *
+   * When priority scheduling is enabled in the executor options, the executable of the
+   * callback group with the highest priority is taken instead.
+   *
    * If the next executable is not associated with this executor/node pair,
    * then this method will return false.
    *
@@ -671,6 +804,22 @@ protected:
   /// The context associated with this executor.
   std::shared_ptr<rclcpp::Context> context_;
 
+  /// Attributes of the threads created by multi-threaded executors, see ExecutorOptions.
+  std::vector<rclcpp::ThreadAttributes> thread_attributes_;
+
+  /// If true, ready executables are picked by callback group priority, see ExecutorOptions.
+  const bool priority_scheduling_;
+
+  /// If true, ready entities take turns by callback time, see ExecutorOptions.
+  const bool fair_scheduling_;
+
+  /// How long waiting for work polls before blocking, see ExecutorOptions.
+  const std::chrono::nanoseconds busy_wait_duration_;
+
+  /// Ready executables found while looking for the highest priority one, not executed yet.
+  std::vector<std::unique_ptr<AnyExecutable>>
+  prioritized_ready_executables_ RCPPUTILS_TSA_GUARDED_BY(mutex_);
+
   RCLCPP_DISABLE_COPY(Executor)
 
   RCLCPP_PUBLIC
@@ -708,12 +857,11 @@ protected:
   weak_groups_to_nodes_ RCPPUTILS_TSA_GUARDED_BY(mutex_);
 
   /// nodes that are associated with the executor
-  std::list<rclcpp::node_interfaces::NodeBaseInterface::WeakPtr>
+  std::set<
+    rclcpp::node_interfaces::NodeBaseInterface::WeakPtr,
+    std::owner_less<rclcpp::node_interfaces::NodeBaseInterface::WeakPtr>>
   weak_nodes_ RCPPUTILS_TSA_GUARDED_BY(mutex_);
 
-  /// shutdown callback handle registered to Context
-  rclcpp::OnShutdownCallbackHandle shutdown_callback_handle_;
-
   /// Pointer to implementation
   std::unique_ptr<ExecutorImplementation> impl_;
 };
@@ -15,10 +15,14 @@
 #ifndef RCLCPP__EXECUTOR_OPTIONS_HPP_
 #define RCLCPP__EXECUTOR_OPTIONS_HPP_
 
+#include <chrono>
+#include <vector>
+
 #include "rclcpp/context.hpp"
 #include "rclcpp/contexts/default_context.hpp"
 #include "rclcpp/memory_strategies.hpp"
 #include "rclcpp/memory_strategy.hpp"
+#include "rclcpp/thread_attributes.hpp"
 #include "rclcpp/visibility_control.hpp"
 
 namespace rclcpp
@@ -30,12 +34,116 @@ struct ExecutorOptions
   ExecutorOptions()
   : memory_strategy(rclcpp::memory_strategies::create_default_strategy()),
     context(rclcpp::contexts::get_global_default_context()),
-    max_conditions(0)
+    max_conditions(0),
+    priority_scheduling(false),
+    fair_scheduling(false),
+    fair_scheduling_quantum(std::chrono::milliseconds(1)),
+    collect_callback_statistics(false),
+    dispatch_arena_chunk_size(0),
+    busy_wait_duration(0),
+    flight_recorder_size(0),
+    numa_aware(false)
   {}
 
   rclcpp::memory_strategy::MemoryStrategy::SharedPtr memory_strategy;
   rclcpp::Context::SharedPtr context;
   size_t max_conditions;
+
+  /// If true, the ready work of the callback group with the highest priority is executed first.
+  /**
+   * \sa rclcpp::CallbackGroup::set_priority()
+   * Otherwise, ready work is executed in a fixed order: timers, subscriptions, services,
+   * clients and waitables.
+   */
+  bool priority_scheduling;
+
+  /// If true, the ready entities take turns in a deficit round robin charged by callback time.
+  /**
+   * Each round credits every ready entity with fair_scheduling_quantum, and the time spent
+   * in its callbacks is deducted from its credit.
+   * The ready entity with credit left which was executed the longest time ago runs first, so
+   * an entity with frequent or long callbacks, like a flooding subscription, can't use up the
+   * duration given to spin_some() or spin_all() and delay the others indefinitely.
+   * Entities without ready work aren't credited, and their debt is forgiven.
+   * With priority_scheduling, the turns are taken among the entities of the highest priority.
+   */
+  bool fair_scheduling;
+
+  /// Credit given to every ready entity for each round of the fair scheduling.
+  /**
+   * It must be positive when fair_scheduling is true, otherwise the executor constructor
+   * throws std::invalid_argument.
+   */
+  std::chrono::nanoseconds fair_scheduling_quantum;
+
+  /// Attributes of the threads created by executors that spin in multiple threads.
+  /**
+   * When empty, the executor runs in the thread calling spin() as well as in threads
+   * created with default attributes.
+   * Otherwise, all the threads executing work are created with these attributes, the i-th
+   * thread using the entry at index i modulo the number of entries, and the thread calling
+   * spin() only waits for them to finish.
+   */
+  std::vector<rclcpp::ThreadAttributes> thread_attributes;
+
+  /// If true, the executor records the wait latency and the duration of every callback.
+  /**
+   * \sa rclcpp::Executor::get_callback_statistics()
+   * Statistics are recorded per entity in lock-free histograms, the overhead is two clock
+   * readings and a lookup per executed callback.
+   * They are recorded by the executors running callbacks with
+   * Executor::execute_any_executable(), like the single and multi threaded executors.
+   * The heap allocations made by the callbacks are counted too, when they are tracked.
+   * \sa rclcpp::allocation_tracking
+   */
+  bool collect_callback_statistics;
+
+  /// Size in bytes of the chunks of the arenas of the threads dispatching work, 0 to disable.
+  /**
+   * When positive, each thread of the executor has a rclcpp::detail::DispatchArena, from which
+   * the messages and the other short-lived data taken for a callback are allocated, when they
+   * use the default allocator.
+   * The arena is reset once the callback returns, so that the same chunk is reused by the
+   * following callbacks, instead of allocating and freeing on the heap for each.
+   * The data kept by a callback stays valid, its chunk just isn't reused until it's freed.
+   */
+  size_t dispatch_arena_chunk_size;
+
+  /// How long the executor polls for work before blocking, 0 to block straight away.
+  /**
+   * Waking up from a blocking wait goes through the kernel, which adds tens of microseconds
+   * to the latency of every callback.
+   * Polling instead keeps a core busy while there is no work, so it's meant for the threads
+   * of an executor running on isolated cores.
+   * The executors waiting with Executor::wait_for_work() poll the wait set without timeout,
+   * and the events executor polls its events queue, until work is ready or the duration
+   * elapsed.
+   * It must not be negative, otherwise the executor constructor throws std::invalid_argument.
+   */
+  std::chrono::nanoseconds busy_wait_duration;
+
+  /// Number of callbacks kept per thread in the flight recorder of the executor, 0 to disable.
+  /**
+   * \sa rclcpp::Executor::get_flight_recorder()
+   * When positive, the start and the duration of the last callbacks executed by each thread
+   * are kept in a rclcpp::FlightRecorder, to find out what the executor was doing before a
+   * crash or a hang.
+   * They are recorded by Executor::execute_any_executable() and by the events executor,
+   * except for the timers executed in the thread of its timers manager.
+   */
+  size_t flight_recorder_size;
+
+  /// If true, the threads of the executors spinning in multiple threads stay on NUMA nodes.
+  /**
+   * \sa rclcpp::get_numa_node_cpus()
+   * Without thread_attributes, the threads of the multi-threaded executor are spread evenly
+   * over the NUMA nodes, and each is pinned to the cores of its node.
+   * The callback group threaded executor pins the thread of each callback group without a
+   * CPU affinity of its own to the cores of the node running the fewest groups, for as long
+   * as the group exists, so that the messages taken for the group stay on that node.
+   * It has no effect on machines with a single NUMA node.
+   */
+  bool numa_aware;
 };
 
 }  // namespace rclcpp
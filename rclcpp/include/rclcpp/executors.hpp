@@ -18,9 +18,13 @@
 #include <future>
 #include <memory>
 
+#include "rclcpp/executors/callback_group_threaded_executor.hpp"
+#include "rclcpp/executors/dispatching_executor.hpp"
 #include "rclcpp/executors/multi_threaded_executor.hpp"
 #include "rclcpp/executors/single_threaded_executor.hpp"
 #include "rclcpp/executors/static_single_threaded_executor.hpp"
+#include "rclcpp/executors/typed_static_executor.hpp"
+#include "rclcpp/executors/work_stealing_multi_threaded_executor.hpp"
 #include "rclcpp/experimental/executors/events_executor/events_executor.hpp"
 #include "rclcpp/node.hpp"
 #include "rclcpp/utilities.hpp"
@@ -29,8 +33,12 @@
 namespace rclcpp
 {
 
-/// Create a default single-threaded executor and execute all available work exhaustively.
-/** \param[in] node_ptr Shared pointer to the node to spin. */
+/// Execute all available work of a node exhaustively, with a single-threaded executor.
+/**
+ * The executor is kept by the node and reused by later calls, see
+ * rclcpp::node_interfaces::NodeBase::get_spin_executor().
+ * \param[in] node_ptr Shared pointer to the node to spin.
+ */
 RCLCPP_PUBLIC
 void
 spin_all(
@@ -41,8 +49,12 @@ RCLCPP_PUBLIC
 void
 spin_all(rclcpp::Node::SharedPtr node_ptr, std::chrono::nanoseconds max_duration);
 
-/// Create a default single-threaded executor and execute any immediately available work.
-/** \param[in] node_ptr Shared pointer to the node to spin. */
+/// Execute any immediately available work of a node, with a single-threaded executor.
+/**
+ * The executor is kept by the node and reused by later calls, see
+ * rclcpp::node_interfaces::NodeBase::get_spin_executor().
+ * \param[in] node_ptr Shared pointer to the node to spin.
+ */
 RCLCPP_PUBLIC
 void
 spin_some(rclcpp::node_interfaces::NodeBaseInterface::SharedPtr node_ptr);
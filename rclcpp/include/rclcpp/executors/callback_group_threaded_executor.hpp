@@ -0,0 +1,146 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__EXECUTORS__CALLBACK_GROUP_THREADED_EXECUTOR_HPP_
+#define RCLCPP__EXECUTORS__CALLBACK_GROUP_THREADED_EXECUTOR_HPP_
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "rclcpp/any_executable.hpp"
+#include "rclcpp/callback_group.hpp"
+#include "rclcpp/executor.hpp"
+#include "rclcpp/macros.hpp"
+#include "rclcpp/thread_attributes.hpp"
+#include "rclcpp/visibility_control.hpp"
+
+namespace rclcpp
+{
+namespace executors
+{
+
+/// Executor running each callback group in a dedicated thread.
+/**
+ * Only the thread that calls spin() waits for work, with a single wait set for all the
+ * callback groups.
+ * Every ready executable is handed to the thread of its callback group, which is started
+ * with the attributes of the group, see CallbackGroup::set_thread_attributes(), the first
+ * time the group has work.
+ * This places each group, e.g. a stage of a processing pipeline, on its own thread with its
+ * own CPU affinity and scheduling priority, within a single executor.
+ *
+ * The callbacks of a group are run in order by its thread, so they never run concurrently,
+ * whatever the type of the group.
+ * The threads are joined when spin() returns.
+ */
+class CallbackGroupThreadedExecutor : public rclcpp::Executor
+{
+public:
+  RCLCPP_SMART_PTR_DEFINITIONS(CallbackGroupThreadedExecutor)
+
+  /// Constructor for CallbackGroupThreadedExecutor.
+  /**
+   * \param options common options for all executors
+   * \param timeout maximum time to wait
+   */
+  RCLCPP_PUBLIC
+  explicit CallbackGroupThreadedExecutor(
+    const rclcpp::ExecutorOptions & options = rclcpp::ExecutorOptions(),
+    std::chrono::nanoseconds timeout = std::chrono::nanoseconds(-1));
+
+  RCLCPP_PUBLIC
+  virtual ~CallbackGroupThreadedExecutor();
+
+  /**
+   * \sa rclcpp::Executor:spin() for more details
+   * \throws std::runtime_error when spin() called while already spinning, or if the thread
+   *   of a callback group can't be started with its attributes
+   */
+  RCLCPP_PUBLIC
+  void
+  spin() override;
+
+  /// Get the number of callback group threads started by the current spin() call.
+  RCLCPP_PUBLIC
+  size_t
+  get_number_of_threads();
+
+protected:
+  /// Wait for work and hand the ready executables to the threads of their groups.
+  RCLCPP_PUBLIC
+  void
+  dispatch();
+
+private:
+  RCLCPP_DISABLE_COPY(CallbackGroupThreadedExecutor)
+
+  using AnyExecutablePtr = std::unique_ptr<rclcpp::AnyExecutable>;
+
+  /// Thread running the executables of a single callback group.
+  struct GroupWorker
+  {
+    rclcpp::CallbackGroup::WeakPtr callback_group;
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::deque<AnyExecutablePtr> executables;
+    bool should_stop = false;
+    // Index of the NUMA node the thread is pinned to, if the executor is NUMA aware
+    size_t numa_node = SIZE_MAX;
+    std::unique_ptr<rclcpp::ThreadWithAttributes> thread;
+  };
+
+  /// Run the executables handed to a worker until it is stopped.
+  void
+  run(GroupWorker & worker);
+
+  /// Push a ready executable to the worker of its group, starting the worker if needed.
+  void
+  push_executable(AnyExecutablePtr any_exec);
+
+  /// Stop and join the workers whose callback group was destroyed.
+  void
+  remove_expired_workers();
+
+  /// Get the attributes of the thread of a group, placing it on a NUMA node if needed.
+  rclcpp::ThreadAttributes
+  get_worker_thread_attributes(const rclcpp::CallbackGroup & group, GroupWorker & worker);
+
+  /// Stop and join a worker, dropping any pending work.
+  static void
+  stop_worker(GroupWorker & worker);
+
+  /// Stop and join all the workers.
+  void
+  stop_workers();
+
+  std::chrono::nanoseconds next_exec_timeout_;
+
+  // Cores of each NUMA node when the executor is NUMA aware, empty otherwise
+  std::vector<std::vector<size_t>> numa_node_cpus_;
+
+  // Protects workers_, which is only modified by the thread calling spin()
+  std::mutex workers_mutex_;
+  std::unordered_map<const rclcpp::CallbackGroup *, std::unique_ptr<GroupWorker>> workers_;
+};
+
+}  // namespace executors
+}  // namespace rclcpp
+
+#endif  // RCLCPP__EXECUTORS__CALLBACK_GROUP_THREADED_EXECUTOR_HPP_
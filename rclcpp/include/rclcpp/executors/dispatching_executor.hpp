@@ -0,0 +1,125 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__EXECUTORS__DISPATCHING_EXECUTOR_HPP_
+#define RCLCPP__EXECUTORS__DISPATCHING_EXECUTOR_HPP_
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+
+#include "rclcpp/executor.hpp"
+#include "rclcpp/macros.hpp"
+#include "rclcpp/visibility_control.hpp"
+
+namespace rclcpp
+{
+namespace executors
+{
+
+/// Executor handing the ready callbacks to a user provided thread pool or task system.
+/**
+ * The thread that calls spin() waits for work and finds the ready executables, as the
+ * other executors do, but doesn't run them: each one is wrapped in a task given to the
+ * dispatcher, which decides on which thread the task runs, e.g. by enqueuing it in a TBB
+ * task arena or an application specific scheduler.
+ * Callbacks then share the threads of the application, instead of oversubscribing the
+ * cores with a second thread pool.
+ *
+ * The callback groups are honored like in the MultiThreadedExecutor: an executable is
+ * only dispatched once its group can run it, e.g. callbacks of a mutually exclusive group
+ * are dispatched one at a time, and the next one after the task of the previous one ran.
+ *
+ * Every task must be run, or destroyed without being run, which releases its callback
+ * group.
+ * The tasks may run on any thread, including inside the call to the dispatcher.
+ * An exception thrown by a callback propagates out of its task, to the task system.
+ * spin() doesn't return until all the tasks it dispatched were run or destroyed, and the
+ * tasks run after spinning stopped don't execute their callback.
+ */
+class DispatchingExecutor : public rclcpp::Executor
+{
+public:
+  RCLCPP_SMART_PTR_DEFINITIONS(DispatchingExecutor)
+
+  /// Task running a single ready callback.
+  using Task = std::function<void ()>;
+  /// Function given every task to run, it must not block until the task ran.
+  using Dispatcher = std::function<void (Task)>;
+
+  /// Constructor for DispatchingExecutor.
+  /**
+   * \param dispatcher function given the tasks to run
+   * \param options common options for all executors
+   * \param timeout maximum time to wait
+   * \throws std::invalid_argument if the dispatcher is empty
+   */
+  RCLCPP_PUBLIC
+  explicit DispatchingExecutor(
+    Dispatcher dispatcher,
+    const rclcpp::ExecutorOptions & options = rclcpp::ExecutorOptions(),
+    std::chrono::nanoseconds timeout = std::chrono::nanoseconds(-1));
+
+  RCLCPP_PUBLIC
+  virtual ~DispatchingExecutor();
+
+  /**
+   * \sa rclcpp::Executor:spin() for more details
+   * \throws std::runtime_error when spin() called while already spinning
+   * \throws any exception thrown by the dispatcher, once the tasks already dispatched
+   *   were run or destroyed
+   */
+  RCLCPP_PUBLIC
+  void
+  spin() override;
+
+  /// Get the number of tasks dispatched and not yet run or destroyed.
+  RCLCPP_PUBLIC
+  size_t
+  get_number_of_pending_tasks();
+
+protected:
+  /// Wait for work and hand the ready executables to the dispatcher.
+  RCLCPP_PUBLIC
+  void
+  dispatch();
+
+private:
+  RCLCPP_DISABLE_COPY(DispatchingExecutor)
+
+  /// Ready executable shared by the copies of its task.
+  struct DispatchedExecutable;
+
+  /// Called once the last copy of a dispatched task was destroyed.
+  void
+  task_done();
+
+  /// Wait until all the dispatched tasks were run or destroyed.
+  void
+  wait_for_pending_tasks();
+
+  Dispatcher dispatcher_;
+  std::chrono::nanoseconds next_exec_timeout_;
+
+  std::mutex pending_tasks_mutex_;
+  std::condition_variable pending_tasks_cv_;
+  size_t pending_tasks_ = 0;
+};
+
+}  // namespace executors
+}  // namespace rclcpp
+
+#endif  // RCLCPP__EXECUTORS__DISPATCHING_EXECUTOR_HPP_
@@ -15,8 +15,11 @@
 #ifndef RCLCPP__EXECUTORS__EXECUTOR_ENTITIES_COLLECTION_HPP_
 #define RCLCPP__EXECUTORS__EXECUTOR_ENTITIES_COLLECTION_HPP_
 
+#include <cstdint>
 #include <deque>
 #include <functional>
+#include <map>
+#include <memory>
 #include <unordered_map>
 #include <vector>
 
@@ -94,6 +97,43 @@ void update_entities(
   }
 }
 
+/// Find the entities added and removed between two states of a collection
+/**
+ * An entity whose handle was reused by another entity, once destroyed, is both removed and
+ * added, as the entity of an entry is compared as well as its handle.
+ *
+ * \param[in] previous The collection representing the previous state
+ * \param[in] next The collection representing the next state
+ * \param[inout] added Collection to which the entries of next not in previous are added
+ * \param[inout] removed Collection to which the entries of previous not in next are added
+ */
+template<typename CollectionType>
+void diff_entities(
+  const CollectionType & previous,
+  const CollectionType & next,
+  CollectionType & added,
+  CollectionType & removed)
+{
+  const auto has_same_entry = [](const CollectionType & collection, const auto & entry) {
+      auto it = collection.find(entry.first);
+      if (it == collection.end()) {
+        return false;
+      }
+      const auto & entity = it->second.entity;
+      return !entity.owner_before(entry.second.entity) && !entry.second.entity.owner_before(entity);
+    };
+  for (const auto & entry : previous) {
+    if (!has_same_entry(next, entry)) {
+      removed.insert(entry);
+    }
+  }
+  for (const auto & entry : next) {
+    if (!has_same_entry(previous, entry)) {
+      added.insert(entry);
+    }
+  }
+}
+
 /// A collection of entities, indexed by their corresponding handles
 template<typename EntityKeyType, typename EntityValueType>
 class EntityCollection
@@ -125,6 +165,55 @@ public:
   {
     update_entities(other, *this, on_added, on_removed);
   }
+
+  /// Apply the entities added and removed since the last update to this collection
+  /**
+   * Unlike update(), the cost only depends on the number of changed entities.
+   * An added entity replaces an entity of this collection with the same handle, like a
+   * destroyed entity whose handle was reused, which is removed first.
+   *
+   * \param[in] added Entities to add
+   * \param[in] removed Entities to remove, before adding the added ones
+   * \param[in] on_added Callback for when entities have been added
+   * \param[in] on_removed Callback for when entities have been removed
+   */
+  void apply_changes(
+    const EntityCollection<EntityKeyType, EntityValueType> & added,
+    const EntityCollection<EntityKeyType, EntityValueType> & removed,
+    std::function<void(const EntitySharedPtr &)> on_added,
+    std::function<void(const EntitySharedPtr &)> on_removed)
+  {
+    for (const auto & [key, entry] : removed) {
+      auto it = this->find(key);
+      if (it == this->end()) {
+        continue;
+      }
+      auto entity = it->second.entity.lock();
+      if (entity) {
+        on_removed(entity);
+      }
+      this->erase(it);
+    }
+    for (const auto & [key, entry] : added) {
+      auto it = this->find(key);
+      if (it != this->end()) {
+        const auto & current = it->second.entity;
+        if (!current.owner_before(entry.entity) && !entry.entity.owner_before(current)) {
+          continue;
+        }
+        auto entity = current.lock();
+        if (entity) {
+          on_removed(entity);
+        }
+        this->erase(it);
+      }
+      this->insert({key, entry});
+      auto entity = entry.entity.lock();
+      if (entity) {
+        on_added(entity);
+      }
+    }
+  }
 };
 
 /// Represent the total set of entities for a single executor
@@ -192,6 +281,42 @@ build_entities_collection(
   const std::vector<rclcpp::CallbackGroup::WeakPtr> & callback_groups,
   ExecutorEntitiesCollection & collection);
 
+/// Entities of a callback group, as of a version of the group
+struct CallbackGroupEntities
+{
+  /// Version of the entities of the group when they were collected
+  uint64_t version = 0;
+
+  /// Entities of the group, empty if it was disabled
+  ExecutorEntitiesCollection entities;
+};
+
+/// Entities of each callback group of an executor, as of their last collection
+using CallbackGroupsEntities = std::map<
+  rclcpp::CallbackGroup::WeakPtr,
+  CallbackGroupEntities,
+  std::owner_less<rclcpp::CallbackGroup::WeakPtr>>;
+
+/// Collect the entities added and removed since the callback groups were last collected
+/**
+ * Only the groups whose entities version changed are collected again, and the groups which
+ * are not in callback_groups anymore have all their entities removed, so the cost depends on
+ * the size of the changed groups rather than on the total number of entities.
+ * Unlike build_entities_collection(), the groups which can't be taken from keep their
+ * entities, since it only means that one of their callbacks is running.
+ *
+ * \param[in] callback_groups List of callback groups whose entities are collected
+ * \param[inout] groups_entities Entities of each group of the last collection, updated
+ * \param[inout] added Entities collection to populate with the added entities
+ * \param[inout] removed Entities collection to populate with the removed entities
+ */
+void
+collect_entities_changes(
+  const std::vector<rclcpp::CallbackGroup::WeakPtr> & callback_groups,
+  CallbackGroupsEntities & groups_entities,
+  ExecutorEntitiesCollection & added,
+  ExecutorEntitiesCollection & removed);
+
 /// Build a queue of executables ready to be executed
 /**
  * Iterates a list of entities and adds them to a queue if they are ready.
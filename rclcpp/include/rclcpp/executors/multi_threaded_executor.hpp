@@ -81,10 +81,16 @@ protected:
 private:
   RCLCPP_DISABLE_COPY(MultiThreadedExecutor)
 
-  std::mutex wait_mutex_;
+  /// Run all the threads with the attributes from the executor options, see ExecutorOptions.
+  void
+  spin_with_thread_attributes();
+
   size_t number_of_threads_;
   bool yield_before_execute_;
   std::chrono::nanoseconds next_exec_timeout_;
+  // Taken by all the threads in turns, on a cache line of its own so that reading the
+  // options above doesn't contend with it
+  alignas(64) std::mutex wait_mutex_;
 };
 
 }  // namespace executors
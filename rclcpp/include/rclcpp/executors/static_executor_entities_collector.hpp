@@ -74,6 +74,24 @@ public:
   void
   fini();
 
+  /// Freeze or unfreeze the entities of the executable list.
+  /**
+   * While frozen, the additions and removals of entities aren't applied to the executable list,
+   * which is then neither rebuilt nor resized: the entities it holds are kept alive and the
+   * wait set keeps its size.
+   * The changes made in the meantime are applied when unfreezing.
+   *
+   * \param[in] frozen true to freeze the entities, false to apply the pending changes
+   */
+  RCLCPP_PUBLIC
+  void
+  set_frozen(bool frozen);
+
+  /// Return true if the entities of the executable list are frozen.
+  RCLCPP_PUBLIC
+  bool
+  is_frozen() const {return frozen_;}
+
   /// Execute the waitable.
   RCLCPP_PUBLIC
   void
@@ -244,7 +262,7 @@ public:
    * \throws std::out_of_range if the argument is higher than the size of the structrue.
    */
   RCLCPP_PUBLIC
-  rclcpp::SubscriptionBase::SharedPtr
+  const rclcpp::SubscriptionBase::SharedPtr &
   get_subscription(size_t i) {return exec_list_.subscription[i];}
 
   /** Return a TimerBase Sharedptr by index.
@@ -253,7 +271,7 @@ public:
    * \throws std::out_of_range if the argument is higher than the size.
    */
   RCLCPP_PUBLIC
-  rclcpp::TimerBase::SharedPtr
+  const rclcpp::TimerBase::SharedPtr &
   get_timer(size_t i) {return exec_list_.timer[i];}
 
   /** Return a ServiceBase Sharedptr by index.
@@ -262,7 +280,7 @@ public:
    * \throws std::out_of_range if the argument is higher than the size.
    */
   RCLCPP_PUBLIC
-  rclcpp::ServiceBase::SharedPtr
+  const rclcpp::ServiceBase::SharedPtr &
   get_service(size_t i) {return exec_list_.service[i];}
 
   /** Return a ClientBase Sharedptr by index
@@ -271,7 +289,7 @@ public:
    * \throws std::out_of_range if the argument is higher than the size.
    */
   RCLCPP_PUBLIC
-  rclcpp::ClientBase::SharedPtr
+  const rclcpp::ClientBase::SharedPtr &
   get_client(size_t i) {return exec_list_.client[i];}
 
   /** Return a Waitable Sharedptr by index
@@ -280,7 +298,7 @@ public:
    * \throws std::out_of_range if the argument is higher than the size.
    */
   RCLCPP_PUBLIC
-  rclcpp::Waitable::SharedPtr
+  const rclcpp::Waitable::SharedPtr &
   get_waitable(size_t i) {return exec_list_.waitable[i];}
 
 private:
@@ -349,6 +367,10 @@ private:
 
   /// Bool to check if the entities collector has been initialized
   bool initialized_ = false;
+
+  /// Whether the executable list is frozen, and whether changes were left pending meanwhile
+  bool frozen_ = false;
+  bool refresh_pending_ = false;
 };
 
 }  // namespace executors
@@ -15,6 +15,7 @@
 #ifndef RCLCPP__EXECUTORS__STATIC_SINGLE_THREADED_EXECUTOR_HPP_
 #define RCLCPP__EXECUTORS__STATIC_SINGLE_THREADED_EXECUTOR_HPP_
 
+#include <atomic>
 #include <chrono>
 #include <cassert>
 #include <cstdlib>
@@ -54,6 +55,11 @@ namespace executors
  * exec.add_node(node);
  * exec.spin();
  * exec.remove_node(node);
+ *
+ * For real-time loops, the entities can be frozen while spinning with set_freeze_entities():
+ * the executable list, which holds strong references to the entities, is then neither rebuilt
+ * nor resized, and the ready entities are found by index in the wait set and executed without
+ * copying their shared pointers.
  */
 class StaticSingleThreadedExecutor : public rclcpp::Executor
 {
@@ -116,6 +122,24 @@ public:
   void
   spin_all(std::chrono::nanoseconds max_duration) override;
 
+  /// Freeze the entities of the executor while it's spinning.
+  /**
+   * Once a spin function begins, the entities added to or removed from the executor, its nodes
+   * and its callback groups are only taken into account when it returns.
+   * Until then, the removed entities keep being executed and are kept alive by the executor.
+   *
+   * \param[in] freeze true to freeze the entities while spinning, false by default
+   * \throws std::runtime_error if called while spinning
+   */
+  RCLCPP_PUBLIC
+  void
+  set_freeze_entities(bool freeze);
+
+  /// Return true if the entities of the executor are frozen while it's spinning.
+  RCLCPP_PUBLIC
+  bool
+  get_freeze_entities() const;
+
   /// Add a callback group to an executor.
   /**
    * \sa rclcpp::Executor::add_callback_group
@@ -211,10 +235,21 @@ protected:
   void
   spin_once_impl(std::chrono::nanoseconds timeout) override;
 
+  /// Initialize the entities collector, which prepares the wait set for the entities.
+  RCLCPP_PUBLIC
+  void
+  prepare_entities() override;
+
+  /// Freeze the entities collector if the entities are frozen while spinning.
+  RCLCPP_PUBLIC
+  void
+  freeze_entities_collector();
+
 private:
   RCLCPP_DISABLE_COPY(StaticSingleThreadedExecutor)
 
   StaticExecutorEntitiesCollector::SharedPtr entities_collector_;
+  std::atomic_bool freeze_entities_{false};
 };
 
 }  // namespace executors
@@ -0,0 +1,391 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__EXECUTORS__TYPED_STATIC_EXECUTOR_HPP_
+#define RCLCPP__EXECUTORS__TYPED_STATIC_EXECUTOR_HPP_
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "rcl/wait.h"
+#include "rmw/types.h"
+
+#include "rclcpp/context.hpp"
+#include "rclcpp/contexts/default_context.hpp"
+#include "rclcpp/guard_condition.hpp"
+#include "rclcpp/macros.hpp"
+#include "rclcpp/message_info.hpp"
+#include "rclcpp/service.hpp"
+#include "rclcpp/subscription.hpp"
+#include "rclcpp/timer.hpp"
+#include "rclcpp/utilities.hpp"
+#include "rclcpp/wait_result_kind.hpp"
+#include "rclcpp/wait_set.hpp"
+
+#include "rcpputils/scope_exit.hpp"
+
+namespace rclcpp
+{
+namespace executors
+{
+namespace detail
+{
+
+enum class TypedEntityKind
+{
+  Subscription,
+  Timer,
+  Service
+};
+
+template<typename EntityT>
+constexpr TypedEntityKind
+get_typed_entity_kind()
+{
+  static_assert(
+    !std::is_abstract<EntityT>::value,
+    "the entities of a TypedStaticExecutor must have their concrete type, "
+    "e.g. rclcpp::WallTimer<CallbackT> rather than rclcpp::TimerBase");
+  if constexpr (std::is_base_of<rclcpp::SubscriptionBase, EntityT>::value) {
+    return TypedEntityKind::Subscription;
+  } else if constexpr (std::is_base_of<rclcpp::TimerBase, EntityT>::value) {
+    return TypedEntityKind::Timer;
+  } else {
+    static_assert(
+      std::is_base_of<rclcpp::ServiceBase, EntityT>::value,
+      "the entities of a TypedStaticExecutor must be subscriptions, timers or services");
+    return TypedEntityKind::Service;
+  }
+}
+
+/// Number of entities of a kind.
+template<TypedEntityKind Kind, typename ... EntityTs>
+constexpr size_t
+count_typed_entities()
+{
+  return ((get_typed_entity_kind<EntityTs>() == Kind ? 1u : 0u) + ... + 0u);
+}
+
+/// Index of the entity at Position among the entities of its kind, e.g. in the wait set.
+template<size_t Position, typename ... EntityTs>
+constexpr size_t
+get_index_in_kind()
+{
+  constexpr TypedEntityKind kinds[] = {get_typed_entity_kind<EntityTs>()...};
+  size_t index = 0;
+  for (size_t i = 0; i < Position; ++i) {
+    if (kinds[i] == kinds[Position]) {
+      index++;
+    }
+  }
+  return index;
+}
+
+/// Preallocated storage of an entity, in which its data is taken.
+template<typename EntityT, TypedEntityKind Kind = get_typed_entity_kind<EntityT>()>
+struct TypedEntityStorage
+{};
+
+template<typename EntityT>
+struct TypedEntityStorage<EntityT, TypedEntityKind::Subscription>
+{
+  using MessageT = typename EntityT::ROSMessageType;
+  std::shared_ptr<MessageT> message = std::make_shared<MessageT>();
+};
+
+template<typename ServiceT>
+struct TypedEntityStorage<rclcpp::Service<ServiceT>, TypedEntityKind::Service>
+{
+  using RequestT = typename ServiceT::Request;
+  std::shared_ptr<rmw_request_id_t> request_header = std::make_shared<rmw_request_id_t>();
+  std::shared_ptr<RequestT> request = std::make_shared<RequestT>();
+};
+
+}  // namespace detail
+
+/// Single-threaded executor of a fixed set of entities, whose types are known at compile time.
+/**
+ * For nodes whose topology doesn't change, e.g. real-time control loops, the subscriptions,
+ * timers and services to execute are given to the constructor with their concrete type:
+ *
+ *     rclcpp::executors::TypedStaticExecutor executor(subscription, timer, service);
+ *     executor.spin();
+ *
+ * The wait set is a StaticWaitSet sized from the entity types, and the ready entities are
+ * executed by code generated for each of them: the messages and requests are taken into
+ * preallocated storage of their type and given to the callback without type erasure,
+ * without virtual calls and, as long as the callbacks don't keep them, without allocating.
+ *
+ * Unlike the other executors, there are no nodes or callback groups to add: the entities
+ * are executed in the order they were given, and must not be added to another executor.
+ * Messages published intra-process to the subscriptions aren't received, as they are only
+ * delivered to the executors of the intra-process subscriptions.
+ */
+template<typename ... EntityTs>
+class TypedStaticExecutor
+{
+public:
+  static_assert(sizeof...(EntityTs) > 0, "a TypedStaticExecutor needs at least one entity");
+
+  static constexpr size_t number_of_subscriptions =
+    detail::count_typed_entities<detail::TypedEntityKind::Subscription, EntityTs...>();
+  static constexpr size_t number_of_timers =
+    detail::count_typed_entities<detail::TypedEntityKind::Timer, EntityTs...>();
+  static constexpr size_t number_of_services =
+    detail::count_typed_entities<detail::TypedEntityKind::Service, EntityTs...>();
+
+  /// Construct an executor of the given entities, in the global default context.
+  /**
+   * \param[in] entities the entities to execute, in the order they are executed when ready
+   * \throws std::invalid_argument if any entity is nullptr
+   */
+  explicit TypedStaticExecutor(std::shared_ptr<EntityTs>... entities)
+  : TypedStaticExecutor(rclcpp::contexts::get_global_default_context(), std::move(entities)...)
+  {}
+
+  /// Construct an executor of the given entities.
+  /**
+   * \param[in] context the context of the entities, which interrupts spin() when shut down
+   * \param[in] entities the entities to execute, in the order they are executed when ready
+   * \throws std::invalid_argument if the context or any entity is nullptr
+   */
+  TypedStaticExecutor(rclcpp::Context::SharedPtr context, std::shared_ptr<EntityTs>... entities)
+  : context_(check_context(std::move(context))),
+    entities_(check_entities(std::move(entities)...)),
+    interrupt_guard_condition_(std::make_shared<rclcpp::GuardCondition>(context_)),
+    shutdown_guard_condition_(std::make_shared<rclcpp::GuardCondition>(context_)),
+    wait_set_(
+      EntitiesOfKind<detail::TypedEntityKind::Subscription>{entities_},
+      {interrupt_guard_condition_, shutdown_guard_condition_},
+      EntitiesOfKind<detail::TypedEntityKind::Timer>{entities_},
+      {},
+      EntitiesOfKind<detail::TypedEntityKind::Service>{entities_},
+      {},
+      context_)
+  {
+    context_->add_shutdown_guard_condition(shutdown_guard_condition_);
+  }
+
+  ~TypedStaticExecutor()
+  {
+    context_->remove_shutdown_guard_condition(shutdown_guard_condition_.get());
+  }
+
+  /// Execute the ready entities until the executor is canceled or its context shut down.
+  /**
+   * \throws std::runtime_error when spin() called while already spinning
+   */
+  void
+  spin()
+  {
+    if (spinning_.exchange(true)) {
+      throw std::runtime_error("spin() called while already spinning");
+    }
+    RCPPUTILS_SCOPE_EXIT(this->spinning_.store(false); );
+    while (rclcpp::ok(context_) && spinning_.load()) {
+      (void)wait_and_execute(std::chrono::nanoseconds(-1));
+    }
+  }
+
+  /// Wait for entities to be ready and execute them, once.
+  /**
+   * \param[in] timeout the maximum time to wait, negative to wait until something is ready
+   * \return the number of entities executed
+   * \throws std::runtime_error when spin_once() called while already spinning
+   */
+  size_t
+  spin_once(std::chrono::nanoseconds timeout = std::chrono::nanoseconds(-1))
+  {
+    if (spinning_.exchange(true)) {
+      throw std::runtime_error("spin_once() called while already spinning");
+    }
+    RCPPUTILS_SCOPE_EXIT(this->spinning_.store(false); );
+    if (!rclcpp::ok(context_)) {
+      return 0;
+    }
+    return wait_and_execute(timeout);
+  }
+
+  /// Stop spinning, interrupting the wait for work.
+  void
+  cancel()
+  {
+    spinning_.store(false);
+    interrupt_guard_condition_->trigger();
+  }
+
+private:
+  RCLCPP_DISABLE_COPY(TypedStaticExecutor)
+
+  using WaitSetT = rclcpp::StaticWaitSet<
+    number_of_subscriptions, 2, number_of_timers, 0, number_of_services, 0>;
+  using EntityPositions = std::index_sequence_for<EntityTs...>;
+
+  template<size_t Position>
+  using EntityAt = std::tuple_element_t<Position, std::tuple<EntityTs...>>;
+
+  template<size_t Position>
+  static constexpr detail::TypedEntityKind kind_at =
+    detail::get_typed_entity_kind<EntityAt<Position>>();
+
+  template<size_t Position>
+  static constexpr size_t index_at = detail::get_index_in_kind<Position, EntityTs...>();
+
+  static rclcpp::Context::SharedPtr
+  check_context(rclcpp::Context::SharedPtr context)
+  {
+    if (!context) {
+      throw std::invalid_argument("context cannot be nullptr");
+    }
+    return context;
+  }
+
+  static std::tuple<std::shared_ptr<EntityTs>...>
+  check_entities(std::shared_ptr<EntityTs>... entities)
+  {
+    if (!(static_cast<bool>(entities) && ...)) {
+      throw std::invalid_argument("entities cannot be nullptr");
+    }
+    return std::tuple<std::shared_ptr<EntityTs>...>(std::move(entities)...);
+  }
+
+  /// Converted to the array of the entities of a kind, in the order they were given.
+  /**
+   * The array types of the wait set storage aren't public, they are deduced instead.
+   */
+  template<detail::TypedEntityKind Kind>
+  struct EntitiesOfKind
+  {
+    template<typename ArrayT>
+    operator ArrayT() const
+    {
+      ArrayT array {};
+      set_entities<Kind>(array, entities, EntityPositions{});
+      return array;
+    }
+
+    const std::tuple<std::shared_ptr<EntityTs>...> & entities;
+  };
+
+  template<detail::TypedEntityKind Kind, typename ArrayT, size_t ... Positions>
+  static void
+  set_entities(
+    ArrayT & array,
+    const std::tuple<std::shared_ptr<EntityTs>...> & entities,
+    std::index_sequence<Positions...>)
+  {
+    (set_entity<Kind, Positions>(array, entities), ...);
+  }
+
+  template<detail::TypedEntityKind Kind, size_t Position, typename ArrayT>
+  static void
+  set_entity(ArrayT & array, const std::tuple<std::shared_ptr<EntityTs>...> & entities)
+  {
+    if constexpr (kind_at<Position> == Kind) {
+      array[index_at<Position>] = typename ArrayT::value_type(std::get<Position>(entities));
+    } else {
+      (void)array;
+      (void)entities;
+    }
+  }
+
+  size_t
+  wait_and_execute(std::chrono::nanoseconds timeout)
+  {
+    auto wait_result = wait_set_.wait(timeout);
+    if (wait_result.kind() != rclcpp::WaitResultKind::Ready) {
+      return 0;
+    }
+    return execute_ready(wait_result.get_wait_set().get_rcl_wait_set(), EntityPositions{});
+  }
+
+  template<size_t ... Positions>
+  size_t
+  execute_ready(const rcl_wait_set_t & wait_set, std::index_sequence<Positions...>)
+  {
+    return (execute_if_ready<Positions>(wait_set) + ... + 0u);
+  }
+
+  /// Execute the entity at Position if it's ready, with calls resolved at compile time.
+  template<size_t Position>
+  size_t
+  execute_if_ready(const rcl_wait_set_t & wait_set)
+  {
+    using EntityT = EntityAt<Position>;
+    EntityT & entity = *std::get<Position>(entities_);
+    auto & storage = std::get<Position>(storages_);
+
+    if constexpr (kind_at<Position> == detail::TypedEntityKind::Subscription) {
+      if (!wait_set.subscriptions[index_at<Position>]) {
+        return 0;
+      }
+      rclcpp::MessageInfo message_info;
+      if (!entity.take(*storage.message, message_info)) {
+        return 0;
+      }
+      entity.handle_typed_message(storage.message, message_info);
+      // The callback kept the message, the next one is taken in a new one
+      if (storage.message.use_count() > 1) {
+        storage.message = std::make_shared<typename decltype(storage.message)::element_type>();
+      }
+      return 1;
+    } else if constexpr (kind_at<Position> == detail::TypedEntityKind::Timer) {
+      (void)storage;
+      if (!wait_set.timers[index_at<Position>]) {
+        return 0;
+      }
+      // Qualified calls, which aren't dispatched virtually
+      if (!entity.EntityT::call()) {
+        return 0;
+      }
+      entity.EntityT::execute_callback();
+      return 1;
+    } else {
+      if (!wait_set.services[index_at<Position>]) {
+        return 0;
+      }
+      if (!entity.take_request(*storage.request, *storage.request_header)) {
+        return 0;
+      }
+      entity.handle_typed_request(storage.request_header, storage.request);
+      if (storage.request.use_count() > 1) {
+        storage.request = std::make_shared<typename decltype(storage.request)::element_type>();
+      }
+      if (storage.request_header.use_count() > 1) {
+        storage.request_header = std::make_shared<rmw_request_id_t>();
+      }
+      return 1;
+    }
+  }
+
+  rclcpp::Context::SharedPtr context_;
+  std::tuple<std::shared_ptr<EntityTs>...> entities_;
+  std::tuple<detail::TypedEntityStorage<EntityTs>...> storages_;
+  rclcpp::GuardCondition::SharedPtr interrupt_guard_condition_;
+  rclcpp::GuardCondition::SharedPtr shutdown_guard_condition_;
+  WaitSetT wait_set_;
+  std::atomic_bool spinning_{false};
+};
+
+}  // namespace executors
+}  // namespace rclcpp
+
+#endif  // RCLCPP__EXECUTORS__TYPED_STATIC_EXECUTOR_HPP_
@@ -0,0 +1,145 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__EXECUTORS__WORK_STEALING_MULTI_THREADED_EXECUTOR_HPP_
+#define RCLCPP__EXECUTORS__WORK_STEALING_MULTI_THREADED_EXECUTOR_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "rclcpp/any_executable.hpp"
+#include "rclcpp/executor.hpp"
+#include "rclcpp/macros.hpp"
+#include "rclcpp/memory_strategies.hpp"
+#include "rclcpp/visibility_control.hpp"
+
+namespace rclcpp
+{
+namespace executors
+{
+
+/// Multi-threaded executor with a single waiting thread and per-worker ready queues.
+/**
+ * Unlike MultiThreadedExecutor, where every thread takes turns waiting on the wait set while
+ * holding a shared lock, only the thread that calls spin() waits for work.
+ * It collects every ready executable and distributes them round-robin into per-worker queues.
+ * Workers take work from their own queue and, when it is empty, steal from the other workers'
+ * queues, so they never contend on a single lock to get work.
+ * Each worker sleeps on its own queue, and when work is handed to a worker busy executing, an
+ * idle worker is woken to steal it.
+ *
+ * Mutually exclusive callback groups are still honored: an executable is only dispatched when
+ * its group can be taken from, and the group is released once the executable has been run.
+ */
+class WorkStealingMultiThreadedExecutor : public rclcpp::Executor
+{
+public:
+  RCLCPP_SMART_PTR_DEFINITIONS(WorkStealingMultiThreadedExecutor)
+
+  /// Constructor for WorkStealingMultiThreadedExecutor.
+  /**
+   * \param options common options for all executors
+   * \param number_of_threads number of worker threads to have in the thread pool,
+   *   the default 0 will use the number of cpu cores found (minimum of 2).
+   *   The thread calling spin() is used to wait for work and is not counted.
+   * \param timeout maximum time to wait
+   */
+  RCLCPP_PUBLIC
+  explicit WorkStealingMultiThreadedExecutor(
+    const rclcpp::ExecutorOptions & options = rclcpp::ExecutorOptions(),
+    size_t number_of_threads = 0,
+    std::chrono::nanoseconds timeout = std::chrono::nanoseconds(-1));
+
+  RCLCPP_PUBLIC
+  virtual ~WorkStealingMultiThreadedExecutor();
+
+  /**
+   * \sa rclcpp::Executor:spin() for more details
+   * \throws std::runtime_error when spin() called while already spinning
+   */
+  RCLCPP_PUBLIC
+  void
+  spin() override;
+
+  RCLCPP_PUBLIC
+  size_t
+  get_number_of_threads();
+
+protected:
+  /// Wait for work and distribute the ready executables to the workers.
+  RCLCPP_PUBLIC
+  void
+  dispatch();
+
+  /// Execute work from the worker's own queue, or stolen from the other queues.
+  RCLCPP_PUBLIC
+  void
+  run(size_t this_thread_number);
+
+private:
+  RCLCPP_DISABLE_COPY(WorkStealingMultiThreadedExecutor)
+
+  using AnyExecutablePtr = std::unique_ptr<rclcpp::AnyExecutable>;
+
+  /// Ready queue owned by a single worker, on which the worker sleeps.
+  struct WorkerQueue
+  {
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::deque<AnyExecutablePtr> executables;
+    /// Whether the worker sleeps or is about to, only written with the mutex held.
+    std::atomic_bool waiting{false};
+  };
+
+  /// Push a ready executable into the queue of the next worker, and wake a worker for it.
+  void
+  push_executable(AnyExecutablePtr any_exec);
+
+  /// Wait until there is work in the worker's own queue or to steal, or the workers stop.
+  void
+  wait_for_executable(WorkerQueue & own_queue);
+
+  /// Claim one of the pending executables, return false if there is none left to claim.
+  bool
+  claim_executable();
+
+  /// Pop a claimed executable from the worker's own queue, or steal it from another worker.
+  AnyExecutablePtr
+  pop_or_steal_executable(size_t this_thread_number);
+
+  /// Stop and join all workers, then drop any pending work.
+  void
+  stop_workers(std::vector<std::thread> & threads);
+
+  size_t number_of_threads_;
+  std::chrono::nanoseconds next_exec_timeout_;
+
+  std::vector<std::unique_ptr<WorkerQueue>> worker_queues_;
+  size_t next_worker_{0};
+
+  std::atomic_bool workers_should_stop_{false};
+  /// Number of executables in the queues which no worker has claimed yet.
+  std::atomic_size_t pending_executables_{0};
+};
+
+}  // namespace executors
+}  // namespace rclcpp
+
+#endif  // RCLCPP__EXECUTORS__WORK_STEALING_MULTI_THREADED_EXECUTOR_HPP_
@@ -0,0 +1,359 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__EXPERIMENTAL__BUFFERS__BROADCAST_RING_HPP_
+#define RCLCPP__EXPERIMENTAL__BUFFERS__BROADCAST_RING_HPP_
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+#include "rclcpp/experimental/buffers/buffer_implementation_base.hpp"
+
+namespace rclcpp
+{
+namespace experimental
+{
+namespace buffers
+{
+
+/// Fixed-size ring of the latest elements written, read by each reader at its own pace
+/**
+ * Elements are numbered by a sequence incremented for each write, and each reader keeps the
+ * sequence of the next element it reads, its cursor, so that an element written once is
+ * read by any number of readers.
+ * When a reader falls behind by more than the capacity of the ring, the oldest elements are
+ * overwritten and the reader skips them, as with a "keep last" history.
+ *
+ * Every slot is protected by its own spin lock, held only to move an element in or to copy it
+ * out, so writers never wait for readers to catch up.
+ * All public member functions are thread-safe.
+ */
+template<typename BufferT>
+class BroadcastRing
+{
+public:
+  explicit BroadcastRing(size_t capacity)
+  : capacity_(capacity)
+  {
+    if (capacity == 0) {
+      throw std::invalid_argument("capacity must be a positive, non-zero value");
+    }
+    slots_ = std::make_unique<Slot[]>(capacity_);
+  }
+
+  /// Write an element, overwriting the oldest one if the ring is full
+  /**
+   * \param value the element to write
+   * \return the sequence of the element
+   */
+  uint64_t write(BufferT value)
+  {
+    const uint64_t sequence = end_.fetch_add(1, std::memory_order_relaxed);
+    Slot & slot = slots_[sequence % capacity_];
+    {
+      SlotLock lock(slot);
+      // A writer of the next lap may have been faster, the newest element is kept
+      if (slot.sequence.load(std::memory_order_relaxed) <= sequence) {
+        std::swap(slot.data, value);
+        slot.sequence.store(sequence + 1, std::memory_order_release);
+      }
+    }
+    // The overwritten element is destroyed here, outside of the lock
+    return sequence;
+  }
+
+  /// Read the element at a cursor and move the cursor past it
+  /**
+   * Readers sharing a cursor read each element once.
+   *
+   * \param cursor the sequence of the next element to read, moved past the elements which
+   *   were overwritten before being read
+   * \param value output parameter for the element
+   * \param skipped if not nullptr, incremented by the number of overwritten elements skipped
+   * \return `true` if an element was read, `false` if there is nothing to read
+   */
+  bool read(
+    std::atomic<uint64_t> & cursor, BufferT & value, uint64_t * skipped = nullptr) const
+  {
+    uint64_t position = cursor.load(std::memory_order_acquire);
+    while (true) {
+      const Slot & slot = slots_[position % capacity_];
+      uint64_t slot_sequence = 0;
+      {
+        SlotLock lock(slot);
+        slot_sequence = slot.sequence.load(std::memory_order_relaxed);
+        if (slot_sequence == position + 1) {
+          value = slot.data;
+        }
+      }
+      if (slot_sequence == position + 1) {
+        if (cursor.compare_exchange_strong(position, position + 1, std::memory_order_acq_rel)) {
+          return true;
+        }
+        // Another reader of the cursor took it, position was updated
+        value = BufferT();
+        continue;
+      }
+      if (slot_sequence <= position) {
+        // Not written yet
+        return false;
+      }
+      // Overwritten: skip to the oldest element which can still be read
+      const uint64_t end = end_.load(std::memory_order_acquire);
+      const uint64_t oldest = end > capacity_ ? end - capacity_ : 0;
+      const uint64_t next = std::max(oldest, position + 1);
+      if (!cursor.compare_exchange_strong(position, next, std::memory_order_acq_rel)) {
+        continue;
+      }
+      if (skipped) {
+        *skipped += next - position;
+      }
+      position = next;
+    }
+  }
+
+  /// Get if there's an element to read at a cursor
+  /**
+   * The result is only a snapshot, as writers and readers may run concurrently.
+   */
+  bool has_data(uint64_t cursor) const
+  {
+    return slots_[cursor % capacity_].sequence.load(std::memory_order_acquire) > cursor;
+  }
+
+  /// Get the number of elements not read yet at a cursor, at most the capacity
+  size_t unread(uint64_t cursor) const
+  {
+    const uint64_t end = end_.load(std::memory_order_acquire);
+    return end > cursor ? static_cast<size_t>(std::min<uint64_t>(end - cursor, capacity_)) : 0;
+  }
+
+  /// Get the sequence of the next element to be written
+  uint64_t end() const
+  {
+    return end_.load(std::memory_order_acquire);
+  }
+
+  size_t capacity() const
+  {
+    return capacity_;
+  }
+
+private:
+  struct Slot
+  {
+    mutable std::atomic_flag locked = ATOMIC_FLAG_INIT;
+    // Sequence of the element plus one, 0 if no element was written
+    std::atomic<uint64_t> sequence{0};
+    BufferT data{};
+  };
+
+  class SlotLock
+  {
+public:
+    explicit SlotLock(const Slot & slot)
+    : slot_(slot)
+    {
+      while (slot_.locked.test_and_set(std::memory_order_acquire)) {
+        std::this_thread::yield();
+      }
+    }
+
+    ~SlotLock()
+    {
+      slot_.locked.clear(std::memory_order_release);
+    }
+
+private:
+    const Slot & slot_;
+  };
+
+  const size_t capacity_;
+  std::unique_ptr<Slot[]> slots_;
+  alignas(64) std::atomic<uint64_t> end_{0};
+};
+
+/// Read elements from the broadcast rings of publishers, as well as from a ring of its own
+/**
+ * Elements given to enqueue() are written to the ring of this buffer, while the publishers
+ * writing their elements to their own broadcast ring attach it with attach(), so that the
+ * element is written once for all the buffers reading it.
+ * The rings are read in turns, so the order of elements of different rings isn't kept.
+ *
+ * All public member functions are thread-safe, and lock-free once the rings are attached.
+ */
+template<typename BufferT>
+class BroadcastBufferImplementation : public BufferImplementationBase<BufferT>
+{
+public:
+  /// Maximum number of rings read by a buffer, its own one included.
+  static constexpr size_t max_rings = 8;
+
+  explicit BroadcastBufferImplementation(size_t capacity)
+  : own_ring_(std::make_shared<BroadcastRing<BufferT>>(capacity))
+  {
+    readers_[0].owner = own_ring_;
+    readers_[0].ring.store(own_ring_.get(), std::memory_order_release);
+  }
+
+  virtual ~BroadcastBufferImplementation() {}
+
+  /// Write an element to the ring of this buffer
+  void enqueue(BufferT request)
+  {
+    own_ring_->write(std::move(request));
+  }
+
+  /// Read the elements of a broadcast ring from a sequence on, if it isn't read already
+  /**
+   * \param ring the ring to read
+   * \param owner a pointer owning the ring, kept until this buffer is destroyed
+   * \param sequence the sequence of the first element to read, if the ring isn't read already
+   * \return `true` if the ring is read, `false` if it can't be because max_rings are read
+   */
+  bool attach(
+    const BroadcastRing<BufferT> & ring, const std::shared_ptr<const void> & owner,
+    uint64_t sequence)
+  {
+    if (find_reader(ring)) {
+      return true;
+    }
+    std::lock_guard<std::mutex> lock(attach_mutex_);
+    if (find_reader(ring)) {
+      return true;
+    }
+    for (Reader & reader : readers_) {
+      if (!reader.ring.load(std::memory_order_relaxed)) {
+        reader.owner = owner;
+        reader.cursor.store(sequence, std::memory_order_relaxed);
+        reader.ring.store(&ring, std::memory_order_release);
+        return true;
+      }
+    }
+    return false;
+  }
+
+  BufferT dequeue()
+  {
+    BufferT request{};
+    (void) try_dequeue(request);
+    return request;
+  }
+
+  size_t dequeue_n(BufferT * requests, size_t n)
+  {
+    size_t count = 0;
+    while (count < n && try_dequeue(requests[count])) {
+      ++count;
+    }
+    return count;
+  }
+
+  bool has_data() const
+  {
+    for (const Reader & reader : readers_) {
+      const BroadcastRing<BufferT> * ring = reader.ring.load(std::memory_order_acquire);
+      if (ring && ring->has_data(reader.cursor.load(std::memory_order_acquire))) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  size_t available_capacity() const
+  {
+    size_t unread = 0;
+    for (const Reader & reader : readers_) {
+      const BroadcastRing<BufferT> * ring = reader.ring.load(std::memory_order_acquire);
+      if (ring) {
+        unread += ring->unread(reader.cursor.load(std::memory_order_acquire));
+      }
+    }
+    const size_t capacity = own_ring_->capacity();
+    return unread < capacity ? capacity - unread : 0;
+  }
+
+  /// Get the number of elements overwritten in the rings before being read by this buffer
+  uint64_t get_dropped_count() const
+  {
+    return dropped_count_.load(std::memory_order_relaxed);
+  }
+
+  void clear()
+  {
+    for (Reader & reader : readers_) {
+      const BroadcastRing<BufferT> * ring = reader.ring.load(std::memory_order_acquire);
+      if (ring) {
+        reader.cursor.store(ring->end(), std::memory_order_release);
+      }
+    }
+  }
+
+private:
+  struct Reader
+  {
+    std::atomic<const BroadcastRing<BufferT> *> ring{nullptr};
+    std::atomic<uint64_t> cursor{0};
+    std::shared_ptr<const void> owner;
+  };
+
+  bool find_reader(const BroadcastRing<BufferT> & ring) const
+  {
+    for (const Reader & reader : readers_) {
+      if (reader.ring.load(std::memory_order_acquire) == &ring) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  bool try_dequeue(BufferT & request)
+  {
+    // Start from the next ring at each call, so that a busy ring doesn't starve the others
+    const size_t first = next_reader_.fetch_add(1, std::memory_order_relaxed);
+    for (size_t i = 0; i < max_rings; ++i) {
+      Reader & reader = readers_[(first + i) % max_rings];
+      const BroadcastRing<BufferT> * ring = reader.ring.load(std::memory_order_acquire);
+      uint64_t skipped = 0;
+      const bool read = ring && ring->read(reader.cursor, request, &skipped);
+      if (skipped) {
+        dropped_count_.fetch_add(skipped, std::memory_order_relaxed);
+      }
+      if (read) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  std::shared_ptr<BroadcastRing<BufferT>> own_ring_;
+  std::array<Reader, max_rings> readers_;
+  std::atomic<size_t> next_reader_{0};
+  std::atomic<uint64_t> dropped_count_{0};
+  std::mutex attach_mutex_;
+};
+
+}  // namespace buffers
+}  // namespace experimental
+}  // namespace rclcpp
+
+#endif  // RCLCPP__EXPERIMENTAL__BUFFERS__BROADCAST_RING_HPP_
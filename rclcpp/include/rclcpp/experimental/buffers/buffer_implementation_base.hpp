@@ -15,6 +15,11 @@
 #ifndef RCLCPP__EXPERIMENTAL__BUFFERS__BUFFER_IMPLEMENTATION_BASE_HPP_
 #define RCLCPP__EXPERIMENTAL__BUFFERS__BUFFER_IMPLEMENTATION_BASE_HPP_
 
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+
 namespace rclcpp
 {
 namespace experimental
@@ -31,9 +36,68 @@ public:
   virtual BufferT dequeue() = 0;
   virtual void enqueue(BufferT request) = 0;
 
+  /// Remove up to n of the oldest elements, oldest first.
+  /**
+   * Implementations override it to remove the elements in a single step, the default one
+   * dequeues them one at a time.
+   *
+   * \param requests output array for the removed elements, with room for n elements
+   * \param n the maximum number of elements to remove
+   * \return the number of elements removed, stored at the start of requests
+   */
+  virtual size_t dequeue_n(BufferT * requests, size_t n)
+  {
+    size_t count = 0;
+    while (count < n && has_data()) {
+      requests[count++] = dequeue();
+    }
+    return count;
+  }
+
+  /// Call a function with each stored element, oldest first, without removing them.
+  /**
+   * \param func the function called with each element
+   * \throws std::runtime_error if the buffer can't be read without removing the elements
+   */
+  virtual void for_each_data(const std::function<void(const BufferT &)> & func) const
+  {
+    (void)func;
+    throw std::runtime_error("this buffer can't be read without removing its elements");
+  }
+
+  /// Start recording the time each element is enqueued, returned by dequeue_timed().
+  /**
+   * \return `false` if the implementation doesn't record the enqueue times
+   */
+  virtual bool record_enqueue_times()
+  {
+    return false;
+  }
+
+  /// Remove the oldest element, and get the steady time it was enqueued at.
+  /**
+   * \param enqueue_time set to the time since the epoch of the steady clock, in nanoseconds,
+   * or to zero if it wasn't recorded
+   * \return the removed element
+   */
+  virtual BufferT dequeue_timed(int64_t & enqueue_time)
+  {
+    enqueue_time = 0;
+    return dequeue();
+  }
+
   virtual void clear() = 0;
   virtual bool has_data() const = 0;
   virtual size_t available_capacity() const = 0;
+
+  /// Get the number of elements dropped to make room for new ones since construction.
+  /**
+   * Implementations which never drop elements, or don't count them, return zero.
+   */
+  virtual uint64_t get_dropped_count() const
+  {
+    return 0;
+  }
 };
 
 }  // namespace buffers
@@ -15,13 +15,19 @@
 #ifndef RCLCPP__EXPERIMENTAL__BUFFERS__INTRA_PROCESS_BUFFER_HPP_
 #define RCLCPP__EXPERIMENTAL__BUFFERS__INTRA_PROCESS_BUFFER_HPP_
 
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <memory>
 #include <stdexcept>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "rclcpp/allocator/allocator_common.hpp"
 #include "rclcpp/allocator/allocator_deleter.hpp"
+#include "rclcpp/experimental/buffers/broadcast_ring.hpp"
 #include "rclcpp/experimental/buffers/buffer_implementation_base.hpp"
 #include "rclcpp/macros.hpp"
 #include "tracetools/tracetools.h"
@@ -45,6 +51,8 @@ public:
   virtual bool has_data() const = 0;
   virtual bool use_take_shared_method() const = 0;
   virtual size_t available_capacity() const = 0;
+  /// Get the number of messages dropped to make room for new ones since construction.
+  virtual uint64_t get_dropped_count() const = 0;
 };
 
 template<
@@ -66,6 +74,78 @@ public:
 
   virtual MessageSharedPtr consume_shared() = 0;
   virtual MessageUniquePtr consume_unique() = 0;
+
+  /// Start recording the time each message is added, returned when it's consumed.
+  /**
+   * \return `false` if the buffer doesn't record the times the messages are added
+   */
+  virtual bool record_enqueue_times()
+  {
+    return false;
+  }
+
+  /// Consume the oldest message, and get the steady time it was added at.
+  /**
+   * \param enqueue_time set to the time since the epoch of the steady clock, in nanoseconds,
+   * or to zero if it wasn't recorded
+   */
+  virtual MessageSharedPtr consume_shared_timed(int64_t & enqueue_time)
+  {
+    enqueue_time = 0;
+    return consume_shared();
+  }
+  /// Consume the oldest message, and get the steady time it was added at.
+  /**
+   * \sa consume_shared_timed()
+   */
+  virtual MessageUniquePtr consume_unique_timed(int64_t & enqueue_time)
+  {
+    enqueue_time = 0;
+    return consume_unique();
+  }
+
+  /// Consume up to n of the oldest messages in a single step of the buffer.
+  /**
+   * \param msgs output array for the messages, with room for n messages
+   * \param n the maximum number of messages to consume
+   * \return the number of messages consumed, stored at the start of msgs
+   */
+  virtual size_t consume_shared_n(MessageSharedPtr * msgs, size_t n) = 0;
+  /// Consume up to n of the oldest messages in a single step of the buffer.
+  /**
+   * \sa consume_shared_n()
+   */
+  virtual size_t consume_unique_n(MessageUniquePtr * msgs, size_t n) = 0;
+
+  /// Call a function with each stored message, oldest first, without consuming them.
+  /**
+   * \throws std::runtime_error if the buffer can't be read without consuming the messages
+   */
+  virtual void for_each_message(const std::function<void(const MessageT &)> & func) const = 0;
+
+  /// Get if the buffer reads the messages of publishers from their broadcast ring.
+  virtual bool uses_broadcast_ring() const
+  {
+    return false;
+  }
+
+  /// Read the messages of a broadcast ring from a sequence on, if it isn't read already.
+  /**
+   * \param ring the broadcast ring of a publisher
+   * \param owner a pointer owning the ring, kept as long as the buffer reads it
+   * \param sequence the sequence of the first message to read, if the ring isn't read already
+   * \return `true` if the buffer reads the ring, `false` if the message must be added instead
+   */
+  virtual bool attach_broadcast_ring(
+    const BroadcastRing<MessageSharedPtr> & ring,
+    const std::shared_ptr<const void> & owner,
+    uint64_t sequence)
+  {
+    (void)ring;
+    (void)owner;
+    (void)sequence;
+    return false;
+  }
 };
 
 template<
@@ -95,6 +175,9 @@ public:
     }
 
     buffer_ = std::move(buffer_impl);
+    if constexpr (std::is_same<BufferT, MessageSharedPtr>::value) {
+      broadcast_buffer_ = dynamic_cast<BroadcastBufferImplementation<BufferT> *>(buffer_.get());
+    }
 
     TRACETOOLS_TRACEPOINT(
       rclcpp_buffer_to_ipb,
@@ -121,12 +204,47 @@ public:
 
   MessageSharedPtr consume_shared() override
   {
-    return consume_shared_impl<BufferT>();
+    return consume_shared_impl<BufferT>(nullptr);
   }
 
   MessageUniquePtr consume_unique() override
   {
-    return consume_unique_impl<BufferT>();
+    return consume_unique_impl<BufferT>(nullptr);
+  }
+
+  bool record_enqueue_times() override
+  {
+    return buffer_->record_enqueue_times();
+  }
+
+  MessageSharedPtr consume_shared_timed(int64_t & enqueue_time) override
+  {
+    return consume_shared_impl<BufferT>(&enqueue_time);
+  }
+
+  MessageUniquePtr consume_unique_timed(int64_t & enqueue_time) override
+  {
+    return consume_unique_impl<BufferT>(&enqueue_time);
+  }
+
+  size_t consume_shared_n(MessageSharedPtr * msgs, size_t n) override
+  {
+    return consume_shared_n_impl<BufferT>(msgs, n);
+  }
+
+  size_t consume_unique_n(MessageUniquePtr * msgs, size_t n) override
+  {
+    return consume_unique_n_impl<BufferT>(msgs, n);
+  }
+
+  void for_each_message(const std::function<void(const MessageT &)> & func) const override
+  {
+    buffer_->for_each_data(
+      [&func](const BufferT & msg) {
+        if (msg) {
+          func(*msg);
+        }
+      });
   }
 
   bool has_data() const override
@@ -149,11 +267,45 @@ public:
     return buffer_->available_capacity();
   }
 
+  uint64_t get_dropped_count() const override
+  {
+    return buffer_->get_dropped_count();
+  }
+
+  bool uses_broadcast_ring() const override
+  {
+    return broadcast_buffer_ != nullptr;
+  }
+
+  bool attach_broadcast_ring(
+    const BroadcastRing<MessageSharedPtr> & ring,
+    const std::shared_ptr<const void> & owner,
+    uint64_t sequence) override
+  {
+    if constexpr (std::is_same<BufferT, MessageSharedPtr>::value) {
+      return broadcast_buffer_ && broadcast_buffer_->attach(ring, owner, sequence);
+    } else {
+      (void)ring;
+      (void)owner;
+      (void)sequence;
+      return false;
+    }
+  }
+
 private:
   std::unique_ptr<BufferImplementationBase<BufferT>> buffer_;
+  // The buffer of buffer_ if it reads broadcast rings, cast once
+  BroadcastBufferImplementation<BufferT> * broadcast_buffer_ = nullptr;
 
   std::shared_ptr<MessageAlloc> message_allocator_;
 
+  // Dequeue with the enqueue time if it's requested
+  BufferT
+  dequeue(int64_t * enqueue_time)
+  {
+    return enqueue_time ? buffer_->dequeue_timed(*enqueue_time) : buffer_->dequeue();
+  }
+
   // MessageSharedPtr to MessageSharedPtr
   template<typename DestinationT>
   typename std::enable_if<
@@ -193,9 +345,9 @@ private:
     std::is_same<OriginT, MessageSharedPtr>::value,
     MessageSharedPtr
   >::type
-  consume_shared_impl()
+  consume_shared_impl(int64_t * enqueue_time)
   {
-    return buffer_->dequeue();
+    return dequeue(enqueue_time);
   }
 
   // MessageUniquePtr to MessageSharedPtr
@@ -204,10 +356,10 @@ private:
     (std::is_same<OriginT, MessageUniquePtr>::value),
     MessageSharedPtr
   >::type
-  consume_shared_impl()
+  consume_shared_impl(int64_t * enqueue_time)
   {
     // automatic cast from unique ptr to shared ptr
-    return buffer_->dequeue();
+    return dequeue(enqueue_time);
   }
 
   // MessageSharedPtr to MessageUniquePtr
@@ -216,14 +368,92 @@ private:
     (std::is_same<OriginT, MessageSharedPtr>::value),
     MessageUniquePtr
   >::type
-  consume_unique_impl()
+  consume_unique_impl(int64_t * enqueue_time)
   {
-    MessageSharedPtr buffer_msg = buffer_->dequeue();
+    return shared_to_unique(dequeue(enqueue_time));
+  }
+
+  // MessageUniquePtr to MessageUniquePtr
+  template<typename OriginT>
+  typename std::enable_if<
+    (std::is_same<OriginT, MessageUniquePtr>::value),
+    MessageUniquePtr
+  >::type
+  consume_unique_impl(int64_t * enqueue_time)
+  {
+    return dequeue(enqueue_time);
+  }
+
+  // The buffer type matches the requested type, messages are dequeued in place
+  template<typename OriginT, typename DestinationT>
+  typename std::enable_if<std::is_same<OriginT, DestinationT>::value, size_t>::type
+  consume_n_impl(DestinationT * msgs, size_t n)
+  {
+    return buffer_->dequeue_n(msgs, n);
+  }
+
+  // MessageUniquePtr to MessageSharedPtr
+  template<typename OriginT, typename DestinationT>
+  typename std::enable_if<
+    std::is_same<OriginT, MessageUniquePtr>::value &&
+    std::is_same<DestinationT, MessageSharedPtr>::value, size_t
+  >::type
+  consume_n_impl(DestinationT * msgs, size_t n)
+  {
+    std::vector<BufferT> buffer_msgs(n);
+    const size_t count = buffer_->dequeue_n(buffer_msgs.data(), n);
+    for (size_t i = 0; i < count; ++i) {
+      msgs[i] = std::move(buffer_msgs[i]);
+    }
+    return count;
+  }
 
+  // MessageSharedPtr to MessageUniquePtr
+  template<typename OriginT, typename DestinationT>
+  typename std::enable_if<
+    std::is_same<OriginT, MessageSharedPtr>::value &&
+    std::is_same<DestinationT, MessageUniquePtr>::value, size_t
+  >::type
+  consume_n_impl(DestinationT * msgs, size_t n)
+  {
+    std::vector<BufferT> buffer_msgs(n);
+    const size_t count = buffer_->dequeue_n(buffer_msgs.data(), n);
+    for (size_t i = 0; i < count; ++i) {
+      msgs[i] = shared_to_unique(std::move(buffer_msgs[i]));
+    }
+    return count;
+  }
+
+  template<typename OriginT>
+  size_t
+  consume_shared_n_impl(MessageSharedPtr * msgs, size_t n)
+  {
+    return consume_n_impl<OriginT, MessageSharedPtr>(msgs, n);
+  }
+
+  template<typename OriginT>
+  size_t
+  consume_unique_n_impl(MessageUniquePtr * msgs, size_t n)
+  {
+    return consume_n_impl<OriginT, MessageUniquePtr>(msgs, n);
+  }
+
+  // Copy a shared message, or move its contents if nobody else holds it
+  MessageUniquePtr
+  shared_to_unique(MessageSharedPtr buffer_msg)
+  {
     MessageUniquePtr unique_msg;
     MessageDeleter * deleter = std::get_deleter<MessageDeleter, const MessageT>(buffer_msg);
     auto ptr = MessageAllocTraits::allocate(*message_allocator_.get(), 1);
-    MessageAllocTraits::construct(*message_allocator_.get(), ptr, *buffer_msg);
+    if (buffer_msg && buffer_msg.use_count() == 1) {
+      // Nobody else can see the message anymore, so its contents are moved rather than copied.
+      // Synchronize with the release of the other references, which may have read it.
+      std::atomic_thread_fence(std::memory_order_acquire);
+      MessageAllocTraits::construct(
+        *message_allocator_.get(), ptr, std::move(const_cast<MessageT &>(*buffer_msg)));
+    } else {
+      MessageAllocTraits::construct(*message_allocator_.get(), ptr, *buffer_msg);
+    }
     if (deleter) {
       unique_msg = MessageUniquePtr(ptr, *deleter);
     } else {
@@ -232,17 +462,6 @@ private:
 
     return unique_msg;
   }
-
-  // MessageUniquePtr to MessageUniquePtr
-  template<typename OriginT>
-  typename std::enable_if<
-    (std::is_same<OriginT, MessageUniquePtr>::value),
-    MessageUniquePtr
-  >::type
-  consume_unique_impl()
-  {
-    return buffer_->dequeue();
-  }
 };
 
 }  // namespace buffers
@@ -0,0 +1,292 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__EXPERIMENTAL__BUFFERS__LOCK_FREE_RING_BUFFER_IMPLEMENTATION_HPP_
+#define RCLCPP__EXPERIMENTAL__BUFFERS__LOCK_FREE_RING_BUFFER_IMPLEMENTATION_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#include "rclcpp/experimental/buffers/buffer_implementation_base.hpp"
+#include "rclcpp/macros.hpp"
+#include "rclcpp/tracing.hpp"
+#include "rclcpp/visibility_control.hpp"
+#include "tracetools/tracetools.h"
+
+namespace rclcpp
+{
+namespace experimental
+{
+namespace buffers
+{
+
+/// Store elements in a fixed-size, FIFO buffer without taking a lock
+/**
+ * This is a bounded multi-producer multi-consumer queue where every slot carries a
+ * sequence number, so producers and consumers only synchronize through atomic
+ * head/tail indices and never through a mutex.
+ *
+ * It keeps the same "keep last" semantics of RingBufferImplementation: when the buffer is
+ * full, enqueue() drops the oldest element to make room for the new one, so a publisher is
+ * never blocked by a slow subscription.
+ * Under contention with a concurrent dequeue() more than one old element may be dropped to
+ * make room, but the newest elements are always preserved.
+ *
+ * Elements can't be read without removing them, as a consumer may be moving them out
+ * concurrently: for_each_data() throws.
+ *
+ * All public member functions are thread-safe and lock-free.
+ */
+template<typename BufferT>
+class LockFreeRingBufferImplementation : public BufferImplementationBase<BufferT>
+{
+public:
+  explicit LockFreeRingBufferImplementation(size_t capacity)
+  : capacity_(capacity),
+    enqueue_index_(0),
+    dequeue_index_(0)
+  {
+    if (capacity == 0) {
+      throw std::invalid_argument("capacity must be a positive, non-zero value");
+    }
+    slots_ = std::make_unique<Slot[]>(capacity_);
+    for (size_t i = 0; i < capacity_; ++i) {
+      slots_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    TRACETOOLS_TRACEPOINT(
+      rclcpp_construct_ring_buffer,
+      static_cast<const void *>(this),
+      capacity_);
+  }
+
+  virtual ~LockFreeRingBufferImplementation() {}
+
+  /// Add a new element to store in the ring buffer
+  /**
+   * If the buffer is full, the oldest element is dropped.
+   * This member function is thread-safe.
+   *
+   * \param request the element to be stored in the ring buffer
+   */
+  void enqueue(BufferT request)
+  {
+    while (!try_enqueue(request)) {
+      // The buffer is full: drop the oldest element and try again.
+      BufferT dropped;
+      if (try_dequeue(dropped)) {
+        dropped_count_.fetch_add(1, std::memory_order_relaxed);
+      }
+    }
+  }
+
+  /// Remove the oldest element from ring buffer
+  /**
+   * This member function is thread-safe.
+   *
+   * \return the element that is being removed from the ring buffer, or a default
+   *   constructed element if the buffer is empty
+   */
+  BufferT dequeue()
+  {
+    BufferT request{};
+    (void) try_dequeue(request);
+    return request;
+  }
+
+  /// Remove up to n of the oldest elements from ring buffer
+  /**
+   * The elements are claimed one by one, so concurrent consumers may interleave with this one.
+   * This member function is thread-safe.
+   *
+   * \param requests output array for the removed elements, with room for n elements
+   * \param n the maximum number of elements to remove
+   * \return the number of elements removed, stored at the start of requests
+   */
+  size_t dequeue_n(BufferT * requests, size_t n)
+  {
+    size_t count = 0;
+    while (count < n && try_dequeue(requests[count])) {
+      ++count;
+    }
+    return count;
+  }
+
+  /// Get if the ring buffer has at least one element stored
+  /**
+   * This member function is thread-safe.
+   * The result is only a snapshot, as producers and consumers may run concurrently.
+   *
+   * \return `true` if there is data and `false` otherwise
+   */
+  inline bool has_data() const
+  {
+    return size_() != 0;
+  }
+
+  /// Get if the size of the buffer is equal to its capacity
+  /**
+   * This member function is thread-safe.
+   * The result is only a snapshot, as producers and consumers may run concurrently.
+   *
+   * \return `true` if the size of the buffer is equal is capacity
+   * and `false` otherwise
+   */
+  inline bool is_full() const
+  {
+    return size_() == capacity_;
+  }
+
+  /// Get the remaining capacity to store messages
+  /**
+   * This member function is thread-safe.
+   * The result is only a snapshot, as producers and consumers may run concurrently.
+   *
+   * \return the number of free capacity for new messages
+   */
+  size_t available_capacity() const
+  {
+    return capacity_ - size_();
+  }
+
+  /// Get the number of elements dropped by enqueue() since construction
+  /**
+   * This member function is thread-safe.
+   *
+   * \return the number of dropped elements
+   */
+  uint64_t get_dropped_count() const
+  {
+    return dropped_count_.load(std::memory_order_relaxed);
+  }
+
+  /// Drop all the elements currently stored in the ring buffer
+  /**
+   * This member function is thread-safe.
+   */
+  void clear()
+  {
+    RCLCPP_TRACEPOINT(IntraProcess, rclcpp_ring_buffer_clear, static_cast<const void *>(this));
+    BufferT dropped;
+    while (try_dequeue(dropped)) {
+      dropped = BufferT();
+    }
+  }
+
+  /// Try to add a new element without overwriting, fails if the buffer is full
+  /**
+   * This member function is thread-safe.
+   *
+   * \param request the element to be stored, it is moved from only on success
+   * \return `true` if the element was stored and `false` if the buffer is full
+   */
+  bool try_enqueue(BufferT & request)
+  {
+    size_t index = enqueue_index_.load(std::memory_order_relaxed);
+    while (true) {
+      Slot & slot = slots_[index % capacity_];
+      const size_t sequence = slot.sequence.load(std::memory_order_acquire);
+      const auto diff = static_cast<std::ptrdiff_t>(sequence - index);
+      if (diff == 0) {
+        // The slot is free for this lap, try to claim it.
+        if (enqueue_index_.compare_exchange_weak(
+            index, index + 1, std::memory_order_relaxed))
+        {
+          slot.data = std::move(request);
+          slot.sequence.store(index + 1, std::memory_order_release);
+          return true;
+        }
+      } else if (diff < 0) {
+        // The slot still holds an element of the previous lap: the buffer is full.
+        return false;
+      } else {
+        // Another producer claimed this slot, reload the index.
+        index = enqueue_index_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  /// Try to remove the oldest element, fails if the buffer is empty
+  /**
+   * This member function is thread-safe.
+   *
+   * \param request output parameter for the removed element
+   * \return `true` if an element was removed and `false` if the buffer is empty
+   */
+  bool try_dequeue(BufferT & request)
+  {
+    size_t index = dequeue_index_.load(std::memory_order_relaxed);
+    while (true) {
+      Slot & slot = slots_[index % capacity_];
+      const size_t sequence = slot.sequence.load(std::memory_order_acquire);
+      const auto diff = static_cast<std::ptrdiff_t>(sequence - (index + 1));
+      if (diff == 0) {
+        // The slot holds an element for this lap, try to claim it.
+        if (dequeue_index_.compare_exchange_weak(
+            index, index + 1, std::memory_order_relaxed))
+        {
+          request = std::move(slot.data);
+          slot.data = BufferT();
+          slot.sequence.store(index + capacity_, std::memory_order_release);
+          return true;
+        }
+      } else if (diff < 0) {
+        // The slot has not been written yet: the buffer is empty.
+        return false;
+      } else {
+        // Another consumer claimed this slot, reload the index.
+        index = dequeue_index_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+private:
+  struct Slot
+  {
+    std::atomic<size_t> sequence{0};
+    BufferT data{};
+  };
+
+  /// Get an estimate of the number of stored elements
+  inline size_t size_() const
+  {
+    const size_t dequeue_index = dequeue_index_.load(std::memory_order_acquire);
+    const size_t enqueue_index = enqueue_index_.load(std::memory_order_acquire);
+    if (enqueue_index <= dequeue_index) {
+      return 0;
+    }
+    const size_t size = enqueue_index - dequeue_index;
+    return size > capacity_ ? capacity_ : size;
+  }
+
+  const size_t capacity_;
+
+  std::unique_ptr<Slot[]> slots_;
+
+  // Keep producer and consumer indices on different cache lines to avoid false sharing.
+  alignas(64) std::atomic<size_t> enqueue_index_;
+  alignas(64) std::atomic<size_t> dequeue_index_;
+
+  // Only updated when the buffer overflows, so it can share the line of the consumer index
+  std::atomic<uint64_t> dropped_count_{0};
+};
+
+}  // namespace buffers
+}  // namespace experimental
+}  // namespace rclcpp
+
+#endif  // RCLCPP__EXPERIMENTAL__BUFFERS__LOCK_FREE_RING_BUFFER_IMPLEMENTATION_HPP_
@@ -0,0 +1,188 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__EXPERIMENTAL__BUFFERS__MAILBOX_BUFFER_IMPLEMENTATION_HPP_
+#define RCLCPP__EXPERIMENTAL__BUFFERS__MAILBOX_BUFFER_IMPLEMENTATION_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include "rclcpp/experimental/buffers/buffer_implementation_base.hpp"
+
+namespace rclcpp
+{
+namespace experimental
+{
+namespace buffers
+{
+
+/// Store only the latest element, replaced with atomic pointer swaps
+/**
+ * This is the "keep last" buffer of depth one: enqueue() replaces the stored element, if any,
+ * and dequeue() takes it, so readers always get the newest element.
+ *
+ * Each element is held by a node which is handed over with a single atomic exchange, so a
+ * publisher is never blocked by a subscription, and a replaced element is destroyed by the
+ * thread replacing it, outside of any lock.
+ * The nodes are recycled, so the buffer doesn't allocate once it's used.
+ *
+ * All public member functions are thread-safe and lock-free.
+ */
+template<typename BufferT>
+class MailboxBufferImplementation : public BufferImplementationBase<BufferT>
+{
+public:
+  MailboxBufferImplementation() = default;
+
+  MailboxBufferImplementation(const MailboxBufferImplementation &) = delete;
+  MailboxBufferImplementation & operator=(const MailboxBufferImplementation &) = delete;
+
+  virtual ~MailboxBufferImplementation()
+  {
+    delete slot_.load(std::memory_order_acquire);
+    delete spare_.load(std::memory_order_acquire);
+  }
+
+  /// Store a new element, dropping the stored one if any
+  /**
+   * This member function is thread-safe.
+   *
+   * \param request the element to be stored
+   */
+  void enqueue(BufferT request)
+  {
+    Node * node = spare_.exchange(nullptr, std::memory_order_acquire);
+    if (!node) {
+      node = new Node();
+    }
+    node->data = std::move(request);
+    Node * replaced = slot_.exchange(node, std::memory_order_acq_rel);
+    if (replaced) {
+      dropped_count_.fetch_add(1, std::memory_order_relaxed);
+    }
+    recycle(replaced);
+  }
+
+  /// Take the stored element
+  /**
+   * This member function is thread-safe.
+   *
+   * \return the stored element, or a default constructed element if there is none
+   */
+  BufferT dequeue()
+  {
+    BufferT request{};
+    Node * node = slot_.exchange(nullptr, std::memory_order_acq_rel);
+    if (node) {
+      request = std::move(node->data);
+      recycle(node);
+    }
+    return request;
+  }
+
+  /// Take the stored element, if any and if n is positive
+  /**
+   * This member function is thread-safe.
+   *
+   * \param requests output array for the removed element, with room for n elements
+   * \param n the maximum number of elements to remove
+   * \return 1 if an element was removed, 0 otherwise
+   */
+  size_t dequeue_n(BufferT * requests, size_t n)
+  {
+    if (n == 0) {
+      return 0;
+    }
+    Node * node = slot_.exchange(nullptr, std::memory_order_acq_rel);
+    if (!node) {
+      return 0;
+    }
+    requests[0] = std::move(node->data);
+    recycle(node);
+    return 1;
+  }
+
+  /// Get if an element is stored
+  /**
+   * This member function is thread-safe.
+   * The result is only a snapshot, as producers and consumers may run concurrently.
+   *
+   * \return `true` if there is data and `false` otherwise
+   */
+  bool has_data() const
+  {
+    return slot_.load(std::memory_order_acquire) != nullptr;
+  }
+
+  /// Get the remaining capacity to store messages
+  /**
+   * This member function is thread-safe.
+   * The result is only a snapshot, as producers and consumers may run concurrently.
+   *
+   * \return 1 if no element is stored, 0 otherwise
+   */
+  size_t available_capacity() const
+  {
+    return has_data() ? 0 : 1;
+  }
+
+  /// Get the number of elements replaced by enqueue() before being taken
+  /**
+   * This member function is thread-safe.
+   *
+   * \return the number of dropped elements
+   */
+  uint64_t get_dropped_count() const
+  {
+    return dropped_count_.load(std::memory_order_relaxed);
+  }
+
+  /// Drop the stored element, if any
+  /**
+   * This member function is thread-safe.
+   */
+  void clear()
+  {
+    recycle(slot_.exchange(nullptr, std::memory_order_acq_rel));
+  }
+
+private:
+  struct Node
+  {
+    BufferT data{};
+  };
+
+  /// Destroy the element of a node taken out of the slot, and keep the node for reuse
+  void recycle(Node * node)
+  {
+    if (!node) {
+      return;
+    }
+    node->data = BufferT();
+    // Only one spare node is kept, others are freed
+    delete spare_.exchange(node, std::memory_order_acq_rel);
+  }
+
+  std::atomic<Node *> slot_{nullptr};
+  std::atomic<Node *> spare_{nullptr};
+  std::atomic<uint64_t> dropped_count_{0};
+};
+
+}  // namespace buffers
+}  // namespace experimental
+}  // namespace rclcpp
+
+#endif  // RCLCPP__EXPERIMENTAL__BUFFERS__MAILBOX_BUFFER_IMPLEMENTATION_HPP_
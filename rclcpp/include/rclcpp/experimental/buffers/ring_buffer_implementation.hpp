@@ -15,6 +15,10 @@
 #ifndef RCLCPP__EXPERIMENTAL__BUFFERS__RING_BUFFER_IMPLEMENTATION_HPP_
 #define RCLCPP__EXPERIMENTAL__BUFFERS__RING_BUFFER_IMPLEMENTATION_HPP_
 
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
 #include <mutex>
 #include <stdexcept>
 #include <utility>
@@ -24,6 +28,7 @@
 #include "rclcpp/logger.hpp"
 #include "rclcpp/logging.hpp"
 #include "rclcpp/macros.hpp"
+#include "rclcpp/tracing.hpp"
 #include "rclcpp/visibility_control.hpp"
 #include "tracetools/tracetools.h"
 
@@ -72,7 +77,11 @@ public:
 
     write_index_ = next_(write_index_);
     ring_buffer_[write_index_] = std::move(request);
-    TRACETOOLS_TRACEPOINT(
+    if (!enqueue_times_.empty()) {
+      enqueue_times_[write_index_] = steady_nanoseconds();
+    }
+    RCLCPP_TRACEPOINT(
+      IntraProcess,
       rclcpp_ring_buffer_enqueue,
       static_cast<const void *>(this),
       write_index_,
@@ -81,6 +90,7 @@ public:
 
     if (is_full_()) {
       read_index_ = next_(read_index_);
+      dropped_count_.fetch_add(1, std::memory_order_relaxed);
     } else {
       size_++;
     }
@@ -96,21 +106,80 @@ public:
   {
     std::lock_guard<std::mutex> lock(mutex_);
 
-    if (!has_data_()) {
-      return BufferT();
+    return dequeue_();
+  }
+
+  /// Start recording the time each element is enqueued
+  /**
+   * This member function is thread-safe.
+   *
+   * \return `true`
+   */
+  bool record_enqueue_times()
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    enqueue_times_.resize(capacity_, 0);
+    return true;
+  }
+
+  /// Remove the oldest element from ring buffer, with the steady time it was enqueued at
+  /**
+   * This member function is thread-safe.
+   *
+   * \param enqueue_time set to the time in nanoseconds, zero if it wasn't recorded
+   * \return the element that is being removed from the ring buffer
+   */
+  BufferT dequeue_timed(int64_t & enqueue_time)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    enqueue_time = (enqueue_times_.empty() || !has_data_()) ? 0 : enqueue_times_[read_index_];
+    return dequeue_();
+  }
+
+  /// Remove up to n of the oldest elements from ring buffer, taking the lock once
+  /**
+   * This member function is thread-safe.
+   *
+   * \param requests output array for the removed elements, with room for n elements
+   * \param n the maximum number of elements to remove
+   * \return the number of elements removed, stored at the start of requests
+   */
+  size_t dequeue_n(BufferT * requests, size_t n)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    size_t count = 0;
+    for (; count < n && has_data_(); ++count) {
+      requests[count] = std::move(ring_buffer_[read_index_]);
+      RCLCPP_TRACEPOINT(
+        IntraProcess,
+        rclcpp_ring_buffer_dequeue,
+        static_cast<const void *>(this),
+        read_index_,
+        size_ - 1);
+      read_index_ = next_(read_index_);
+      size_--;
     }
 
-    auto request = std::move(ring_buffer_[read_index_]);
-    TRACETOOLS_TRACEPOINT(
-      rclcpp_ring_buffer_dequeue,
-      static_cast<const void *>(this),
-      read_index_,
-      size_ - 1);
-    read_index_ = next_(read_index_);
+    return count;
+  }
 
-    size_--;
+  /// Call a function with each stored element, oldest first, without removing them
+  /**
+   * This member function is thread-safe, the function is called with the lock held.
+   *
+   * \param func the function called with each element, which must not use the ring buffer
+   */
+  void for_each_data(const std::function<void(const BufferT &)> & func) const
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
 
-    return request;
+    size_t index = read_index_;
+    for (size_t i = 0; i < size_; ++i) {
+      func(ring_buffer_[index]);
+      index = (index + 1) % capacity_;
+    }
   }
 
   /// Get the next index value for the ring buffer
@@ -163,12 +232,56 @@ public:
     return available_capacity_();
   }
 
+  /// Get the number of elements overwritten by newer ones since construction
+  /**
+   * This member function is thread-safe, and doesn't take the lock.
+   *
+   * \return the number of dropped elements
+   */
+  uint64_t get_dropped_count() const
+  {
+    return dropped_count_.load(std::memory_order_relaxed);
+  }
+
   void clear()
   {
-    TRACETOOLS_TRACEPOINT(rclcpp_ring_buffer_clear, static_cast<const void *>(this));
+    RCLCPP_TRACEPOINT(IntraProcess, rclcpp_ring_buffer_clear, static_cast<const void *>(this));
   }
 
 private:
+  /// Remove the oldest element from ring buffer
+  /**
+   * This member function is not thread-safe.
+   *
+   * \return the element that is being removed from the ring buffer
+   */
+  BufferT dequeue_()
+  {
+    if (!has_data_()) {
+      return BufferT();
+    }
+
+    auto request = std::move(ring_buffer_[read_index_]);
+    RCLCPP_TRACEPOINT(
+      IntraProcess,
+      rclcpp_ring_buffer_dequeue,
+      static_cast<const void *>(this),
+      read_index_,
+      size_ - 1);
+    read_index_ = next_(read_index_);
+
+    size_--;
+
+    return request;
+  }
+
+  /// Get the time since the epoch of the steady clock, in nanoseconds
+  static int64_t steady_nanoseconds()
+  {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now().time_since_epoch()).count();
+  }
+
   /// Get the next index value for the ring buffer
   /**
    * This member function is not thread-safe.
@@ -219,11 +332,18 @@ private:
 
   std::vector<BufferT> ring_buffer_;
 
+  // The mutex and the state it protects share a cache line of their own, so that taking the
+  // lock brings them in at once and doesn't invalidate the line of the data read by others
+  alignas(64) mutable std::mutex mutex_;
+
   size_t write_index_;
   size_t read_index_;
   size_t size_;
+  // Enqueue time of each element, empty unless record_enqueue_times() was called
+  std::vector<int64_t> enqueue_times_;
 
-  mutable std::mutex mutex_;
+  // Written under the lock, read without it
+  std::atomic<uint64_t> dropped_count_{0};
 };
 
 }  // namespace buffers
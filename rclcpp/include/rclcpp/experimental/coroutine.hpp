@@ -0,0 +1,465 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__EXPERIMENTAL__COROUTINE_HPP_
+#define RCLCPP__EXPERIMENTAL__COROUTINE_HPP_
+
+#if !defined(__cpp_impl_coroutine)
+#error "rclcpp/experimental/coroutine.hpp requires a compiler with C++20 coroutines enabled"
+#endif
+
+#include <chrono>
+#include <coroutine>
+#include <exception>
+#include <memory>
+#include <optional>
+#include <utility>
+
+#include "rclcpp/callback_group.hpp"
+#include "rclcpp/client.hpp"
+#include "rclcpp/create_timer.hpp"
+#include "rclcpp/node_interfaces/get_node_base_interface.hpp"
+#include "rclcpp/node_interfaces/get_node_timers_interface.hpp"
+#include "rclcpp/node_interfaces/node_base_interface.hpp"
+#include "rclcpp/node_interfaces/node_timers_interface.hpp"
+#include "rclcpp/timer.hpp"
+
+namespace rclcpp
+{
+namespace experimental
+{
+
+template<typename T = void>
+class [[nodiscard]] Task;
+
+namespace detail
+{
+
+/// Promise state common to all the tasks.
+class TaskPromiseBase
+{
+public:
+  /// Resume the coroutine awaiting the task, if any, once the task completes.
+  struct FinalAwaiter
+  {
+    bool
+    await_ready() const noexcept
+    {
+      return false;
+    }
+
+    template<typename PromiseT>
+    std::coroutine_handle<>
+    await_suspend(std::coroutine_handle<PromiseT> handle) noexcept
+    {
+      std::coroutine_handle<> continuation = handle.promise().continuation_;
+      if (continuation) {
+        return continuation;
+      }
+      return std::noop_coroutine();
+    }
+
+    void
+    await_resume() noexcept
+    {}
+  };
+
+  std::suspend_always
+  initial_suspend() noexcept
+  {
+    return {};
+  }
+
+  FinalAwaiter
+  final_suspend() noexcept
+  {
+    return {};
+  }
+
+  void
+  unhandled_exception() noexcept
+  {
+    exception_ = std::current_exception();
+  }
+
+  void
+  set_continuation(std::coroutine_handle<> continuation) noexcept
+  {
+    continuation_ = continuation;
+  }
+
+protected:
+  void
+  rethrow_if_exception()
+  {
+    if (exception_) {
+      std::rethrow_exception(exception_);
+    }
+  }
+
+private:
+  std::coroutine_handle<> continuation_;
+  std::exception_ptr exception_;
+};
+
+template<typename T>
+class TaskPromise : public TaskPromiseBase
+{
+public:
+  Task<T>
+  get_return_object() noexcept
+  {
+    return Task<T>(std::coroutine_handle<TaskPromise>::from_promise(*this));
+  }
+
+  template<typename U>
+  void
+  return_value(U && value)
+  {
+    value_.emplace(std::forward<U>(value));
+  }
+
+  T
+  result()
+  {
+    rethrow_if_exception();
+    return std::move(*value_);
+  }
+
+private:
+  std::optional<T> value_;
+};
+
+template<>
+class TaskPromise<void> : public TaskPromiseBase
+{
+public:
+  Task<void>
+  get_return_object() noexcept;
+
+  void
+  return_void() noexcept
+  {}
+
+  void
+  result()
+  {
+    rethrow_if_exception();
+  }
+};
+
+}  // namespace detail
+
+/// Coroutine producing a value of type T, started when it's awaited.
+/**
+ * A task is started by awaiting it from another coroutine, or with spawn() for a task
+ * not awaited by any coroutine.
+ * Exceptions thrown by the task are rethrown to the awaiting coroutine.
+ *
+ * Destroying a task which is suspended destroys the coroutine: the awaitables of this header
+ * stop waiting then, without resuming it.
+ */
+template<typename T>
+class [[nodiscard]] Task
+{
+public:
+  using promise_type = detail::TaskPromise<T>;
+
+  explicit Task(std::coroutine_handle<promise_type> handle) noexcept
+  : handle_(handle)
+  {}
+
+  Task(Task && other) noexcept
+  : handle_(std::exchange(other.handle_, {}))
+  {}
+
+  Task &
+  operator=(Task && other) noexcept
+  {
+    if (this != &other) {
+      if (handle_) {
+        handle_.destroy();
+      }
+      handle_ = std::exchange(other.handle_, {});
+    }
+    return *this;
+  }
+
+  Task(const Task &) = delete;
+  Task & operator=(const Task &) = delete;
+
+  ~Task()
+  {
+    if (handle_) {
+      handle_.destroy();
+    }
+  }
+
+  bool
+  await_ready() const noexcept
+  {
+    return false;
+  }
+
+  std::coroutine_handle<>
+  await_suspend(std::coroutine_handle<> awaiting) noexcept
+  {
+    handle_.promise().set_continuation(awaiting);
+    return handle_;
+  }
+
+  T
+  await_resume()
+  {
+    return handle_.promise().result();
+  }
+
+private:
+  std::coroutine_handle<promise_type> handle_;
+};
+
+namespace detail
+{
+
+inline Task<void>
+TaskPromise<void>::get_return_object() noexcept
+{
+  return Task<void>(std::coroutine_handle<TaskPromise>::from_promise(*this));
+}
+
+/// Coroutine running a task not awaited by any other coroutine, destroyed once completed.
+struct DetachedTask
+{
+  struct promise_type
+  {
+    DetachedTask
+    get_return_object() noexcept
+    {
+      return {};
+    }
+
+    std::suspend_never
+    initial_suspend() noexcept
+    {
+      return {};
+    }
+
+    std::suspend_never
+    final_suspend() noexcept
+    {
+      return {};
+    }
+
+    void
+    return_void() noexcept
+    {}
+
+    void
+    unhandled_exception()
+    {
+      throw;
+    }
+  };
+};
+
+inline DetachedTask
+run_detached(Task<void> task)
+{
+  co_await std::move(task);
+}
+
+}  // namespace detail
+
+/// Start a task which isn't awaited by any coroutine.
+/**
+ * The task runs in the calling thread until it awaits something, and is then resumed by the
+ * thread which completes what it awaits, typically an executor running a callback.
+ * The task is destroyed once it completes.
+ *
+ * An exception thrown by the task propagates to the thread resuming it, as if it was thrown
+ * by a callback when it is resumed by an executor.
+ */
+inline void
+spawn(Task<void> task)
+{
+  detail::run_detached(std::move(task));
+}
+
+/// Awaitable sending a service request, resumed with the response.
+/**
+ * \sa send_request()
+ */
+template<typename ServiceT>
+class SendRequestAwaitable
+{
+public:
+  using ClientT = rclcpp::Client<ServiceT>;
+
+  SendRequestAwaitable(typename ClientT::SharedPtr client, typename ClientT::SharedRequest request)
+  : client_(std::move(client)), request_(std::move(request))
+  {}
+
+  bool
+  await_ready() const noexcept
+  {
+    return false;
+  }
+
+  void
+  await_suspend(std::coroutine_handle<> handle)
+  {
+    state_ = std::make_shared<State>();
+    state_->handle = handle;
+    std::weak_ptr<State> weak_state = state_;
+    // The coroutine may be resumed before this call returns, nothing is used after it
+    client_->async_send_request(
+      request_,
+      [weak_state](typename ClientT::SharedFuture future) {
+        auto state = weak_state.lock();
+        if (state) {
+          state->response = future.get();
+          state->handle.resume();
+        }
+      });
+  }
+
+  typename ClientT::SharedResponse
+  await_resume()
+  {
+    return std::move(state_->response);
+  }
+
+private:
+  struct State
+  {
+    std::coroutine_handle<> handle;
+    typename ClientT::SharedResponse response;
+  };
+
+  typename ClientT::SharedPtr client_;
+  typename ClientT::SharedRequest request_;
+  // Shared with the response callback, which doesn't resume destroyed coroutines
+  std::shared_ptr<State> state_;
+};
+
+/// Send a service request, and get the response when the returned awaitable is awaited.
+/**
+ * The awaiting coroutine is resumed by the executor handling the response of the client,
+ * in the callback group of the client, instead of blocking a thread on a future.
+ *
+ * If the response is never received, the coroutine isn't resumed: the pending request
+ * should be removed from the client as when using Client::async_send_request().
+ *
+ * \param[in] client the client sending the request
+ * \param[in] request the request to send
+ * \return an awaitable resumed with the response of the service
+ */
+template<typename ServiceT>
+SendRequestAwaitable<ServiceT>
+send_request(
+  std::shared_ptr<rclcpp::Client<ServiceT>> client,
+  typename rclcpp::Client<ServiceT>::SharedRequest request)
+{
+  return SendRequestAwaitable<ServiceT>(std::move(client), std::move(request));
+}
+
+/// Awaitable resumed once a duration has elapsed.
+/**
+ * \sa sleep_for()
+ */
+class SleepAwaitable
+{
+public:
+  SleepAwaitable(
+    rclcpp::node_interfaces::NodeBaseInterface::SharedPtr node_base,
+    rclcpp::node_interfaces::NodeTimersInterface::SharedPtr node_timers,
+    std::chrono::nanoseconds duration,
+    rclcpp::CallbackGroup::SharedPtr group)
+  : node_base_(std::move(node_base)), node_timers_(std::move(node_timers)),
+    duration_(duration), group_(std::move(group))
+  {}
+
+  bool
+  await_ready() const noexcept
+  {
+    return duration_ <= std::chrono::nanoseconds::zero();
+  }
+
+  void
+  await_suspend(std::coroutine_handle<> handle)
+  {
+    // Keep the state alive in this scope, the coroutine may be resumed before it returns
+    auto state = std::make_shared<State>();
+    state->handle = handle;
+    state_ = state;
+    std::weak_ptr<State> weak_state = state;
+    state->timer = rclcpp::create_wall_timer(
+      duration_,
+      [weak_state](rclcpp::TimerBase & timer) {
+        timer.cancel();
+        auto state = weak_state.lock();
+        if (state) {
+          state->handle.resume();
+        }
+      },
+      group_, node_base_.get(), node_timers_.get());
+  }
+
+  void
+  await_resume() noexcept
+  {}
+
+private:
+  struct State
+  {
+    std::coroutine_handle<> handle;
+    // Destroyed with the awaitable, so that a destroyed coroutine isn't resumed
+    rclcpp::TimerBase::SharedPtr timer;
+  };
+
+  rclcpp::node_interfaces::NodeBaseInterface::SharedPtr node_base_;
+  rclcpp::node_interfaces::NodeTimersInterface::SharedPtr node_timers_;
+  std::chrono::nanoseconds duration_;
+  rclcpp::CallbackGroup::SharedPtr group_;
+  std::shared_ptr<State> state_;
+};
+
+/// Wait for a duration without blocking the thread, when the returned awaitable is awaited.
+/**
+ * A one-shot wall timer is added to the node, the awaiting coroutine is resumed by the
+ * executor running it.
+ *
+ * \param[in] node the node to which the timer is added
+ * \param[in] duration how long to wait, the coroutine isn't suspended if it's not positive
+ * \param[in] group the callback group of the timer, the default one of the node if nullptr
+ * \return an awaitable resumed once the duration has elapsed
+ */
+template<typename NodeT, typename DurationRepT, typename DurationT>
+SleepAwaitable
+sleep_for(
+  NodeT && node,
+  std::chrono::duration<DurationRepT, DurationT> duration,
+  rclcpp::CallbackGroup::SharedPtr group = nullptr)
+{
+  return SleepAwaitable(
+    rclcpp::node_interfaces::get_node_base_interface(node),
+    rclcpp::node_interfaces::get_node_timers_interface(node),
+    std::chrono::duration_cast<std::chrono::nanoseconds>(duration),
+    std::move(group));
+}
+
+}  // namespace experimental
+}  // namespace rclcpp
+
+#endif  // RCLCPP__EXPERIMENTAL__COROUTINE_HPP_
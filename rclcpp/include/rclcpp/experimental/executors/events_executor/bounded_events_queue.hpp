@@ -0,0 +1,205 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__EXPERIMENTAL__EXECUTORS__EVENTS_EXECUTOR__BOUNDED_EVENTS_QUEUE_HPP_
+#define RCLCPP__EXPERIMENTAL__EXECUTORS__EVENTS_EXECUTOR__BOUNDED_EVENTS_QUEUE_HPP_
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+
+#include "rclcpp/experimental/executors/events_executor/events_queue.hpp"
+
+namespace rclcpp
+{
+namespace experimental
+{
+namespace executors
+{
+
+/**
+ * @brief This class implements an EventsQueue which coalesces the events of each entity.
+ * An entity has at most one event in the queue, whose `num_events` count grows with each
+ * new event of the entity, up to the `max_events` of the events.
+ * The EventsExecutor sets `max_events` to the history depth of the keep last subscriptions,
+ * so the events of messages which were already overwritten in the history are dropped
+ * instead of being executed as failed takes.
+ * The queue holds at most one event per entity, plus the timer events and the events with no
+ * entity: they are never coalesced, as each of them must be executed.
+ * A coalesced event keeps the position of the first event of the entity.
+ */
+class BoundedEventsQueue : public EventsQueue
+{
+public:
+  RCLCPP_PUBLIC
+  ~BoundedEventsQueue() override = default;
+
+  /**
+   * @brief enqueue event into the queue, or add it to the queued event of its entity
+   * Thread safe
+   * @param event The event to enqueue into the queue
+   */
+  RCLCPP_PUBLIC
+  void
+  enqueue(const rclcpp::experimental::executors::ExecutorEvent & event) override
+  {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      if (!is_coalesced(event)) {
+        event_queue_.push_back(event);
+      } else {
+        auto inserted = pending_events_.emplace(EntityKey(event), 0);
+        size_t & pending = inserted.first->second;
+        pending += event.num_events;
+        if (event.max_events > 0) {
+          pending = std::min<size_t>(pending, event.max_events);
+        }
+        if (!inserted.second) {
+          // Added to the event already queued, nobody needs to be woken up
+          return;
+        }
+        event_queue_.push_back(event);
+      }
+    }
+    events_queue_cv_.notify_one();
+  }
+
+  /**
+   * @brief waits for an event until timeout, gets the event with all the coalesced ones
+   * Thread safe
+   * @return true if event, false if timeout
+   */
+  RCLCPP_PUBLIC
+  bool
+  dequeue(
+    rclcpp::experimental::executors::ExecutorEvent & event,
+    std::chrono::nanoseconds timeout = std::chrono::nanoseconds::max()) override
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    // Initialize to true because it's only needed if we have a valid timeout
+    bool has_data = true;
+    if (timeout != std::chrono::nanoseconds::max()) {
+      has_data =
+        events_queue_cv_.wait_for(lock, timeout, [this]() {return !event_queue_.empty();});
+    } else {
+      events_queue_cv_.wait(lock, [this]() {return !event_queue_.empty();});
+    }
+
+    if (!has_data) {
+      return false;
+    }
+
+    event = event_queue_.front();
+    event_queue_.pop_front();
+    if (is_coalesced(event)) {
+      auto it = pending_events_.find(EntityKey(event));
+      event.num_events = it->second;
+      pending_events_.erase(it);
+    }
+    return true;
+  }
+
+  /**
+   * @brief Test whether queue is empty
+   * Thread safe
+   * @return true if the queue's size is 0, false otherwise.
+   */
+  RCLCPP_PUBLIC
+  bool
+  empty() const override
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    return event_queue_.empty();
+  }
+
+  /**
+   * @brief Returns the number of elements in the queue.
+   * Coalesced events are counted once.
+   * Thread safe
+   * @return the number of elements in the queue.
+   */
+  RCLCPP_PUBLIC
+  size_t
+  size() const override
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    return event_queue_.size();
+  }
+
+private:
+  /// Identifies the entity of an event, the generation tells apart entities reusing a slot
+  struct EntityKey
+  {
+    explicit EntityKey(const rclcpp::experimental::executors::ExecutorEvent & event)
+    : entity_key(event.entity_key),
+      entity_generation(event.entity_generation),
+      waitable_data(event.waitable_data)
+    {}
+
+    bool
+    operator==(const EntityKey & other) const
+    {
+      return entity_key == other.entity_key &&
+             entity_generation == other.entity_generation &&
+             waitable_data == other.waitable_data;
+    }
+
+    const void * entity_key;
+    uint32_t entity_generation;
+    int waitable_data;
+  };
+
+  struct EntityKeyHash
+  {
+    size_t
+    operator()(const EntityKey & key) const
+    {
+      size_t hash = std::hash<const void *>()(key.entity_key);
+      hash ^= std::hash<uint64_t>()(
+        (static_cast<uint64_t>(key.entity_generation) << 32) |
+        static_cast<uint32_t>(key.waitable_data)) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+      return hash;
+    }
+  };
+
+  static
+  bool
+  is_coalesced(const rclcpp::experimental::executors::ExecutorEvent & event)
+  {
+    // A timer is executed once per event, regardless of num_events
+    return event.entity_key != nullptr &&
+           event.type != rclcpp::experimental::executors::ExecutorEventType::TIMER_EVENT;
+  }
+
+  // The queued events, at most one for each coalesced entity
+  std::deque<rclcpp::experimental::executors::ExecutorEvent> event_queue_;
+  // Number of events of each coalesced entity with an event in the queue
+  std::unordered_map<EntityKey, size_t, EntityKeyHash> pending_events_;
+  // Mutex to protect read/write access to the queue
+  mutable std::mutex mutex_;
+  // Variable used to notify when an event is added to the queue
+  std::condition_variable events_queue_cv_;
+};
+
+}  // namespace executors
+}  // namespace experimental
+}  // namespace rclcpp
+
+#endif  // RCLCPP__EXPERIMENTAL__EXECUTORS__EVENTS_EXECUTOR__BOUNDED_EVENTS_QUEUE_HPP_
@@ -17,7 +17,13 @@
 
 #include <atomic>
 #include <chrono>
+#include <cstdint>
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "rclcpp/executor.hpp"
@@ -56,6 +62,13 @@ namespace executors
  * executor.add_node(node);
  * executor.spin();
  * executor.remove_node(node);
+ *
+ * When constructed with more than one thread, spin() dispatches events to a pool of
+ * threads that all consume from the same events queue.
+ * Events of the same entity are never executed concurrently, so they are processed in the
+ * order in which the middleware delivers them, and mutually exclusive and reader writer
+ * callback groups are still honored: an event that can't be executed yet is put aside and
+ * re-enqueued as soon as the entity or callback group that blocked it is released.
  */
 class EventsExecutor : public rclcpp::Executor
 {
@@ -70,13 +83,19 @@ public:
    * \param[in] execute_timers_separate_thread If true, timers are executed in a separate
    * thread. If false, timers are executed in the same thread as all other entities.
    * \param[in] options Options used to configure the executor.
+   * \param[in] number_of_threads Number of threads used by spin() to execute events,
+   * including the calling thread. The default 1 executes all the events in the calling thread,
+   * while 0 uses the number of cpu cores found.
+   * If options.thread_attributes is not empty, all these threads are created with the given
+   * attributes, while the timers manager thread keeps the default ones.
    */
   RCLCPP_PUBLIC
   explicit EventsExecutor(
     rclcpp::experimental::executors::EventsQueue::UniquePtr events_queue = std::make_unique<
       rclcpp::experimental::executors::SimpleEventsQueue>(),
     bool execute_timers_separate_thread = false,
-    const rclcpp::ExecutorOptions & options = rclcpp::ExecutorOptions());
+    const rclcpp::ExecutorOptions & options = rclcpp::ExecutorOptions(),
+    size_t number_of_threads = 1);
 
   /// Default destructor.
   RCLCPP_PUBLIC
@@ -92,6 +111,56 @@ public:
   void
   spin() override;
 
+  /// Get the number of threads used by spin() to execute events.
+  RCLCPP_PUBLIC
+  size_t
+  get_number_of_threads() const;
+
+  /// Set whether spin() waits for the timers itself, instead of using the timers thread.
+  /**
+   * When true, the threads of spin() wait for events until the next timer is ready, and then
+   * push the events of the ready timers to the queue.
+   * This avoids the timers manager thread, and the hop from it to the threads of spin() for
+   * each timer, which reduces the latency and the jitter of the timers callbacks.
+   * Adding, removing or resetting a timer wakes a waiting thread to re-compute its timeout.
+   *
+   * \param[in] wait_for_timers whether spin() waits for the timers itself, false by default
+   * \throws std::invalid_argument if the timers are executed in a separate thread
+   * \throws std::runtime_error if the executor is spinning
+   */
+  RCLCPP_PUBLIC
+  void
+  set_wait_for_timers_in_events_loop(bool wait_for_timers);
+
+  /// Get whether spin() waits for the timers itself, instead of using the timers thread.
+  RCLCPP_PUBLIC
+  bool
+  get_wait_for_timers_in_events_loop() const;
+
+  /// Set how deep intra-process messages can be executed by the thread publishing them.
+  /**
+   * When positive, a message published intra-process to a subscription of this executor, from
+   * a callback executed by this executor, is executed right away by the publishing thread.
+   * It skips the guard condition of the subscription and the round trip through the events
+   * queue, which reduces the latency of pipelines of nodes in the same process.
+   *
+   * The depth bounds the nesting of such executions, e.g. for subscriptions republishing the
+   * messages they receive: messages published deeper are queued as usual.
+   * A single thread must execute the events, so that callback groups are never entered
+   * concurrently.
+   *
+   * \param[in] max_depth maximum nesting of inline executions, 0 (the default) to disable them
+   * \throws std::invalid_argument if max_depth is positive and spin() uses more than one thread
+   */
+  RCLCPP_PUBLIC
+  void
+  set_intra_process_inline_depth(size_t max_depth);
+
+  /// Get how deep intra-process messages can be executed by the thread publishing them.
+  RCLCPP_PUBLIC
+  size_t
+  get_intra_process_inline_depth();
+
   /// Events executor implementation of spin some
   /**
    * This non-blocking function will execute the timers and events
@@ -209,12 +278,25 @@ public:
   std::vector<rclcpp::CallbackGroup::WeakPtr>
   get_automatically_added_callback_groups_from_nodes() override;
 
+  /// Get a snapshot of the work waiting to be executed, including the events queue.
+  /**
+   * \sa rclcpp::Executor::get_backlog()
+   */
+  RCLCPP_PUBLIC
+  rclcpp::ExecutorBacklog
+  get_backlog() override;
+
 protected:
   /// Internal implementation of spin_once
   RCLCPP_PUBLIC
   void
   spin_once_impl(std::chrono::nanoseconds timeout) override;
 
+  /// Refresh the collection of entities, whose events are then queued without being waited on.
+  RCLCPP_PUBLIC
+  void
+  prepare_entities() override;
+
   /// Internal implementation of spin_some
   RCLCPP_PUBLIC
   void
@@ -227,51 +309,129 @@ private:
   void
   execute_event(const ExecutorEvent & event);
 
+  /// Wait for an event, and for the timers if spin() waits for them, see
+  /// set_wait_for_timers_in_events_loop()
+  bool
+  dequeue_event(ExecutorEvent & event);
+
+  /// Dequeue an event, polling the queue for the busy wait duration of the options first
+  bool
+  poll_and_dequeue(
+    ExecutorEvent & event,
+    std::chrono::nanoseconds timeout = std::chrono::nanoseconds::max());
+
+  /// Dequeue and execute events until spinning stops, run by each thread of spin()
+  void
+  run_events_loop();
+
+  /// Run all the threads with the attributes from the executor options, see ExecutorOptions
+  void
+  spin_with_thread_attributes();
+
+  /// Execute the event unless its entity or non reentrant callback group is busy
+  /**
+   * If the event can't be executed now, it is stored and re-enqueued once the entity
+   * or callback group that prevented its execution is released.
+   */
+  void
+  execute_event_exclusively(const ExecutorEvent & event);
+
+  /// Execute an intra-process message inline unless its entity or callback group can't start
+  /**
+   * The message isn't executed when the calling thread doesn't execute an event of this
+   * executor, or executes a callback of the same entity or callback group, so that the message
+   * is never executed nested in a callback it must be mutually exclusive with.
+   *
+   * \return true if execute was called
+   */
+  bool
+  execute_inline_exclusively(
+    const rclcpp::Waitable * waitable,
+    const rclcpp::CallbackGroup::WeakPtr & weak_group,
+    const std::function<void()> & execute);
+
+  /// Release an entity and its callback group after executing one of its callbacks
+  void
+  release_event_entity(
+    const void * entity_key,
+    const rclcpp::CallbackGroup::SharedPtr & group,
+    const void * entity);
+
+  /// Get the entity that generated the event, as a pointer to its base class, if any
+  const void *
+  get_event_entity(const ExecutorEvent & event);
+
+  /// Get the callback group of the entity that generated the event, if any
+  rclcpp::CallbackGroup::SharedPtr
+  get_event_callback_group(const ExecutorEvent & event);
+
   /// Collect entities from callback groups and refresh the current collection with them
   void
   refresh_current_collection_from_callback_groups();
 
-  /// Refresh the current collection using the provided new_collection
+  /// Apply the entities added and removed since the last refresh to the current collection
   void
-  refresh_current_collection(const rclcpp::executors::ExecutorEntitiesCollection & new_collection);
+  refresh_current_collection(
+    const rclcpp::executors::ExecutorEntitiesCollection & added_entities,
+    const rclcpp::executors::ExecutorEntitiesCollection & removed_entities);
 
-  /// Create a listener callback function for the provided entity
+  /// Create a listener callback function pushing copies of the event of an entity
   std::function<void(size_t)>
-  create_entity_callback(void * entity_key, ExecutorEventType type);
+  create_entity_callback(const ExecutorEvent & entity_event);
 
-  /// Create a listener callback function for the provided waitable entity
+  /// Create a listener callback function pushing copies of the event of a waitable entity
   std::function<void(size_t, int)>
-  create_waitable_callback(const rclcpp::Waitable * waitable_id);
+  create_waitable_callback(const ExecutorEvent & waitable_event);
+
+  /// Give a slot to an entity added to the current collection
+  /**
+   * \return the event of the entity, identifying its slot, without any event count
+   */
+  ExecutorEvent
+  acquire_entity_slot(
+    const void * entity_key,
+    ExecutorEventType type,
+    std::shared_ptr<void> entity,
+    rclcpp::CallbackGroup::WeakPtr callback_group);
+
+  /// Release the slots of the removed entities which aren't in the current collection anymore
+  void
+  release_removed_entity_slots(
+    const rclcpp::executors::ExecutorEntitiesCollection & removed_entities);
+
+  /// Let the waitable execute its messages inline if it's an intra-process subscription
+  void
+  set_inline_execution(
+    const rclcpp::Waitable::SharedPtr & waitable,
+    const rclcpp::CallbackGroup::WeakPtr & weak_group,
+    size_t max_depth);
 
   /// Utility to add the notify waitable to an entities collection
   void
   add_notify_waitable_to_collection(
     rclcpp::executors::ExecutorEntitiesCollection::WaitableCollection & collection);
 
-  /// Searches for the provided entity_id in the collection and returns the entity if valid
-  template<typename CollectionType>
-  typename CollectionType::EntitySharedPtr
-  retrieve_entity(typename CollectionType::Key entity_id, CollectionType & collection)
+  /// Get the entity of the slot of the event, or nullptr if it was removed or destroyed
+  template<typename EntityT>
+  std::shared_ptr<EntityT>
+  retrieve_entity(const ExecutorEvent & event)
   {
-    // Check if the entity_id is in the collection
-    auto it = collection.find(entity_id);
-    if (it == collection.end()) {
+    std::shared_lock<std::shared_mutex> lock(slots_mutex_);
+    if (event.entity_slot >= entity_slots_.size()) {
       return nullptr;
     }
-
-    // Check if the entity associated with the entity_id is valid
-    // and remove it from the collection if it isn't
-    auto entity = it->second.entity.lock();
-    if (!entity) {
-      collection.erase(it);
+    // The generation changes when the slot is released, so stale events don't match a new entity
+    const EntitySlot & slot = entity_slots_[event.entity_slot];
+    if (slot.generation != event.entity_generation) {
+      return nullptr;
     }
-
-    // Return the retrieved entity (this can be a nullptr if the entity was not valid)
-    return entity;
+    return std::static_pointer_cast<EntityT>(slot.entity.lock());
   }
 
   /// Queue where entities can push events
   rclcpp::experimental::executors::EventsQueue::UniquePtr events_queue_;
+  /// Recorder of the executor, held here to skip a reference count per event
+  rclcpp::FlightRecorder::SharedPtr flight_recorder_;
 
   std::shared_ptr<rclcpp::executors::ExecutorEntitiesCollector> entities_collector_;
   std::shared_ptr<rclcpp::executors::ExecutorNotifyWaitable> notify_waitable_;
@@ -279,12 +439,57 @@ private:
   /// Mutex to protect the current_entities_collection_
   std::recursive_mutex collection_mutex_;
   std::shared_ptr<rclcpp::executors::ExecutorEntitiesCollection> current_entities_collection_;
+  /// Entities of each callback group when they were last collected, protected by collection_mutex_
+  rclcpp::executors::CallbackGroupsEntities groups_entities_;
 
   /// Flag used to reduce the number of unnecessary waitable events
   std::atomic<bool> notify_waitable_event_pushed_ {false};
 
   /// Timers manager used to track and/or execute associated timers
   std::shared_ptr<rclcpp::experimental::TimersManager> timers_manager_;
+
+  /// Number of threads used by spin()
+  size_t number_of_threads_;
+
+  /// Whether the timers are executed by the timers manager thread rather than by events
+  bool execute_timers_separate_thread_;
+
+  /// Whether spin() waits for the timers instead of the timers manager thread
+  std::atomic<bool> wait_for_timers_in_events_loop_ {false};
+
+  /// Maximum nesting of inline intra-process executions, protected by collection_mutex_
+  size_t intra_process_inline_depth_ {0};
+
+  /// Callback group of each timer, as timer events are identified by the timer itself
+  /// rather than by the rcl handle used as key in the entities collection.
+  /// Only populated when running with multiple threads, protected by collection_mutex_
+  std::unordered_map<const rclcpp::TimerBase *, rclcpp::CallbackGroup::WeakPtr> timer_groups_;
+
+  /// Entity of the current collection, which its events refer to by index
+  struct EntitySlot
+  {
+    /// Incremented when the slot is released, never zero
+    uint32_t generation = 1;
+    ExecutorEventType type = ExecutorEventType::WAITABLE_EVENT;
+    const void * entity_key = nullptr;
+    std::weak_ptr<void> entity;
+    rclcpp::CallbackGroup::WeakPtr callback_group;
+  };
+
+  /// Mutex to protect the slots, only locked exclusively when the collection changes
+  std::shared_mutex slots_mutex_;
+  std::vector<EntitySlot> entity_slots_;
+  /// Indices of the released slots, which are reused first
+  std::vector<uint32_t> free_entity_slots_;
+  /// Slot of each entity of the current collection, protected by collection_mutex_
+  std::unordered_map<const void *, uint32_t> entity_slot_indices_;
+
+  /// Mutex to protect the entities being executed and the deferred events
+  std::mutex dispatch_mutex_;
+  /// Keys of the entities that are currently being executed by a thread
+  std::unordered_set<const void *> busy_entities_;
+  /// Events that couldn't be executed because their entity or group was busy
+  std::vector<ExecutorEvent> deferred_events_;
 };
 
 }  // namespace executors
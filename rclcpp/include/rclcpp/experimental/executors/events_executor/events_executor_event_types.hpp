@@ -15,6 +15,9 @@
 #ifndef RCLCPP__EXPERIMENTAL__EXECUTORS__EVENTS_EXECUTOR__EVENTS_EXECUTOR_EVENT_TYPES_HPP_
 #define RCLCPP__EXPERIMENTAL__EXECUTORS__EVENTS_EXECUTOR__EVENTS_EXECUTOR_EVENT_TYPES_HPP_
 
+#include <cstddef>
+#include <cstdint>
+
 namespace rclcpp
 {
 namespace experimental
@@ -37,6 +40,12 @@ struct ExecutorEvent
   int waitable_data;
   ExecutorEventType type;
   size_t num_events;
+  /// Index of the slot of the entity in the executor, to find it without a hash lookup
+  uint32_t entity_slot;
+  /// Generation of the slot when the event was created, zero if the event has no slot
+  uint32_t entity_generation;
+  /// Number of events of the entity worth keeping queued, e.g. its history depth, 0 for any
+  uint32_t max_events;
 };
 
 }  // namespace executors
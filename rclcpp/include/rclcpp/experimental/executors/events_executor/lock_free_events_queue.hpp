@@ -0,0 +1,206 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__EXPERIMENTAL__EXECUTORS__EVENTS_EXECUTOR__LOCK_FREE_EVENTS_QUEUE_HPP_
+#define RCLCPP__EXPERIMENTAL__EXECUTORS__EVENTS_EXECUTOR__LOCK_FREE_EVENTS_QUEUE_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+
+#include "rclcpp/experimental/buffers/lock_free_ring_buffer_implementation.hpp"
+#include "rclcpp/experimental/executors/events_executor/events_queue.hpp"
+
+namespace rclcpp
+{
+namespace experimental
+{
+namespace executors
+{
+
+/**
+ * @brief This class implements an EventsQueue on top of a bounded lock-free ring.
+ * Producers (usually middleware listener threads) push events without taking a lock,
+ * and each event is stored once together with its `num_events` count instead of being
+ * split into single events.
+ * Consumers are only woken up through a mutex and condition variable when they are actually
+ * sleeping, so producers don't pay for a notification while the executor is busy.
+ * If the ring is full, events are stored in an overflow queue protected by a mutex until
+ * the ring has been drained, so no event is ever lost.
+ */
+class LockFreeEventsQueue : public EventsQueue
+{
+public:
+  RCLCPP_PUBLIC
+  explicit LockFreeEventsQueue(size_t capacity = 4096)
+  : ring_(capacity),
+    ring_capacity_(capacity)
+  {}
+
+  RCLCPP_PUBLIC
+  ~LockFreeEventsQueue() override = default;
+
+  /**
+   * @brief enqueue event into the queue
+   * Thread safe
+   * @param event The event to enqueue into the queue
+   */
+  RCLCPP_PUBLIC
+  void
+  enqueue(const rclcpp::experimental::executors::ExecutorEvent & event) override
+  {
+    rclcpp::experimental::executors::ExecutorEvent queued_event = event;
+    // Once events started overflowing they must keep going to the overflow queue,
+    // otherwise they would be dequeued before the ones that are already waiting there.
+    if (overflow_active_.load(std::memory_order_acquire) || !ring_.try_enqueue(queued_event)) {
+      std::lock_guard<std::mutex> lock(overflow_mutex_);
+      overflow_queue_.push_back(queued_event);
+      overflow_size_.store(overflow_queue_.size(), std::memory_order_relaxed);
+      overflow_active_.store(true, std::memory_order_release);
+    }
+    notify_if_sleeping();
+  }
+
+  /**
+   * @brief waits for an event until timeout, gets a single event
+   * Thread safe
+   * @return true if event, false if timeout
+   */
+  RCLCPP_PUBLIC
+  bool
+  dequeue(
+    rclcpp::experimental::executors::ExecutorEvent & event,
+    std::chrono::nanoseconds timeout = std::chrono::nanoseconds::max()) override
+  {
+    if (try_dequeue(event)) {
+      return true;
+    }
+    if (timeout == std::chrono::nanoseconds::zero()) {
+      return false;
+    }
+
+    std::unique_lock<std::mutex> lock(wakeup_mutex_);
+    sleeping_consumers_.fetch_add(1, std::memory_order_seq_cst);
+    // Pairs with the fence in notify_if_sleeping(): either the producer sees this consumer
+    // sleeping, or this consumer sees the event the producer pushed.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    bool has_data = false;
+    auto predicate = [this, &event, &has_data]() {
+        has_data = try_dequeue(event);
+        return has_data;
+      };
+    if (timeout != std::chrono::nanoseconds::max()) {
+      wakeup_cv_.wait_for(lock, timeout, predicate);
+    } else {
+      wakeup_cv_.wait(lock, predicate);
+    }
+    sleeping_consumers_.fetch_sub(1, std::memory_order_relaxed);
+    return has_data;
+  }
+
+  /**
+   * @brief Test whether queue is empty
+   * Thread safe
+   * @return true if the queue's size is 0, false otherwise.
+   */
+  RCLCPP_PUBLIC
+  bool
+  empty() const override
+  {
+    return size() == 0;
+  }
+
+  /**
+   * @brief Returns the number of elements in the queue.
+   * Events carrying more than one `num_events` are counted once.
+   * Thread safe
+   * @return the number of elements in the queue.
+   */
+  RCLCPP_PUBLIC
+  size_t
+  size() const override
+  {
+    return overflow_size_.load(std::memory_order_relaxed) +
+           (ring_capacity_ - ring_.available_capacity());
+  }
+
+private:
+  bool
+  try_dequeue(rclcpp::experimental::executors::ExecutorEvent & event)
+  {
+    // The ring always holds the oldest events, as new ones go to the overflow queue
+    // while it is in use.
+    if (ring_.try_dequeue(event)) {
+      return true;
+    }
+    if (!overflow_active_.load(std::memory_order_acquire)) {
+      return false;
+    }
+    std::lock_guard<std::mutex> lock(overflow_mutex_);
+    // A producer may have pushed to the ring just before the overflow was activated.
+    if (ring_.try_dequeue(event)) {
+      return true;
+    }
+    if (overflow_queue_.empty()) {
+      overflow_active_.store(false, std::memory_order_release);
+      return false;
+    }
+    event = overflow_queue_.front();
+    overflow_queue_.pop_front();
+    overflow_size_.store(overflow_queue_.size(), std::memory_order_relaxed);
+    if (overflow_queue_.empty()) {
+      overflow_active_.store(false, std::memory_order_release);
+    }
+    return true;
+  }
+
+  void
+  notify_if_sleeping()
+  {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (sleeping_consumers_.load(std::memory_order_relaxed) == 0) {
+      return;
+    }
+    {
+      // Taking the lock guarantees that a consumer which has just checked the queue
+      // is now waiting on the condition variable and will receive the notification.
+      std::lock_guard<std::mutex> lock(wakeup_mutex_);
+    }
+    wakeup_cv_.notify_one();
+  }
+
+  // The bounded lock-free ring where events are normally stored
+  rclcpp::experimental::buffers::LockFreeRingBufferImplementation<
+    rclcpp::experimental::executors::ExecutorEvent> ring_;
+  const size_t ring_capacity_;
+
+  // Slow path used only when the ring is full
+  std::deque<rclcpp::experimental::executors::ExecutorEvent> overflow_queue_;
+  std::atomic_bool overflow_active_{false};
+  std::atomic_size_t overflow_size_{0};
+  std::mutex overflow_mutex_;
+
+  // Used to put consumers to sleep when there are no events
+  std::atomic_size_t sleeping_consumers_{0};
+  std::mutex wakeup_mutex_;
+  std::condition_variable wakeup_cv_;
+};
+
+}  // namespace executors
+}  // namespace experimental
+}  // namespace rclcpp
+
+#endif  // RCLCPP__EXPERIMENTAL__EXECUTORS__EVENTS_EXECUTOR__LOCK_FREE_EVENTS_QUEUE_HPP_
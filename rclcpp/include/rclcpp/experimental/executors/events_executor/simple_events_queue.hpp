@@ -123,8 +123,10 @@ private:
   std::queue<rclcpp::experimental::executors::ExecutorEvent> event_queue_;
   // Mutex to protect read/write access to the queue
   mutable std::mutex mutex_;
-  // Variable used to notify when an event is added to the queue
-  std::condition_variable events_queue_cv_;
+  // Variable used to notify when an event is added to the queue.
+  // It's notified without holding the mutex, so it's kept off the cache line of the mutex,
+  // which a consumer may be holding.
+  alignas(64) std::condition_variable events_queue_cv_;
 };
 
 }  // namespace executors
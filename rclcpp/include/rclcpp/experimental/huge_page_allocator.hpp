@@ -0,0 +1,222 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__EXPERIMENTAL__HUGE_PAGE_ALLOCATOR_HPP_
+#define RCLCPP__EXPERIMENTAL__HUGE_PAGE_ALLOCATOR_HPP_
+
+#include <cstddef>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "rclcpp/macros.hpp"
+#include "rclcpp/visibility_control.hpp"
+
+namespace rclcpp
+{
+namespace experimental
+{
+
+/// Memory pool mapping large blocks on huge pages, and reusing them on the same NUMA node.
+/**
+ * Blocks of at least the mapping threshold are mapped directly.
+ * Explicit huge pages are used when some are reserved on the system, transparent huge pages
+ * are requested otherwise.
+ * Freed blocks are kept, up to the cache limit, and reused for the allocations of the same
+ * size, rounded up to the page size, from the threads running on the NUMA node of the thread
+ * which allocated them first.
+ * As the pages of a new block are only backed when they're first written, typically by the
+ * thread filling the message, the block stays local to that node.
+ * Smaller blocks are allocated with the global operator new.
+ *
+ * Mapping is only supported on Linux, on other platforms all the blocks are allocated with
+ * the global operator new.
+ *
+ * All the member functions are thread-safe.
+ */
+class HugePageMemoryPool
+{
+public:
+  RCLCPP_SMART_PTR_DEFINITIONS(HugePageMemoryPool)
+
+  /// Create a memory pool.
+  /**
+   * \param[in] mapping_threshold blocks of this size and above are mapped on huge pages,
+   *   half the huge page size if zero
+   * \param[in] max_cached_size the maximum total size in bytes of the freed blocks kept
+   */
+  RCLCPP_PUBLIC
+  explicit HugePageMemoryPool(
+    size_t mapping_threshold = 0,
+    size_t max_cached_size = 256 * 1024 * 1024);
+
+  /// Unmap the cached blocks, the blocks still in use are unmapped when they're freed.
+  RCLCPP_PUBLIC
+  virtual ~HugePageMemoryPool();
+
+  /// Allocate a block of at least the given size, aligned for any fundamental type.
+  /**
+   * \param[in] size the size in bytes of the block
+   * \return the address of the block
+   * \throws std::bad_alloc if the block can't be allocated
+   */
+  RCLCPP_PUBLIC
+  void *
+  allocate(size_t size);
+
+  /// Free a block allocated by this pool.
+  /**
+   * The size of the block isn't needed, as some users, like the rcl allocators, don't know it.
+   *
+   * \param[in] pointer the address of the block, nothing is done if nullptr
+   */
+  RCLCPP_PUBLIC
+  void
+  deallocate(void * pointer) noexcept;
+
+  /// Get the size in bytes of the huge pages used for the mapped blocks.
+  RCLCPP_PUBLIC
+  size_t
+  get_huge_page_size() const;
+
+  /// Get the size in bytes from which blocks are mapped.
+  RCLCPP_PUBLIC
+  size_t
+  get_mapping_threshold() const;
+
+  /// Get the total size in bytes of the freed blocks kept for reuse.
+  RCLCPP_PUBLIC
+  size_t
+  get_cached_size() const;
+
+  /// Get the pool used by default constructed allocators.
+  RCLCPP_PUBLIC
+  static
+  SharedPtr
+  get_default();
+
+private:
+  RCLCPP_DISABLE_COPY(HugePageMemoryPool)
+
+  struct BlockHeader;
+
+  void
+  cache_or_unmap(BlockHeader * header) noexcept;
+
+  const size_t page_size_;
+  const size_t huge_page_size_;
+  const size_t mapping_threshold_;
+  const size_t max_cached_size_;
+
+  mutable std::mutex mutex_;
+  // Freed blocks, by NUMA node and size rounded up to the page size
+  std::map<std::pair<unsigned int, size_t>, std::vector<BlockHeader *>> cached_blocks_;
+  size_t cached_size_;
+};
+
+/// Allocator using a HugePageMemoryPool, for the large messages passed intra-process.
+/**
+ * It can be used as the allocator of the publisher and subscription options, to allocate
+ * the messages published and copied intra-process, for instance:
+ *
+ * \code
+ * rclcpp::PublisherOptionsWithAllocator<HugePageAllocator<void>> options;
+ * options.allocator = std::make_shared<HugePageAllocator<void>>();
+ * \endcode
+ *
+ * Only the messages themselves are allocated with it: the variable size fields of a message
+ * are allocated with the allocator of the message type, like
+ * `sensor_msgs::msg::Image_<HugePageAllocator<void>>`.
+ *
+ * Copies and rebound allocators share the same pool, and compare equal.
+ */
+template<typename T>
+class HugePageAllocator
+{
+public:
+  using value_type = T;
+
+  /// Create an allocator using the default pool.
+  HugePageAllocator()
+  : pool_(HugePageMemoryPool::get_default())
+  {}
+
+  /// Create an allocator using the given pool.
+  /**
+   * \throws std::invalid_argument if the pool is nullptr
+   */
+  explicit HugePageAllocator(HugePageMemoryPool::SharedPtr pool)
+  : pool_(std::move(pool))
+  {
+    if (!pool_) {
+      throw std::invalid_argument("pool must not be nullptr");
+    }
+  }
+
+  template<typename U>
+  HugePageAllocator(const HugePageAllocator<U> & other) noexcept
+  : pool_(other.get_pool())
+  {}
+
+  T *
+  allocate(size_t n)
+  {
+    static_assert(alignof(T) <= alignof(std::max_align_t), "over-aligned types not supported");
+    if (n > std::numeric_limits<size_t>::max() / sizeof(T)) {
+      throw std::bad_array_new_length();
+    }
+    return static_cast<T *>(pool_->allocate(n * sizeof(T)));
+  }
+
+  void
+  deallocate(T * pointer, size_t n) noexcept
+  {
+    (void)n;
+    pool_->deallocate(pointer);
+  }
+
+  /// Get the pool of the allocator.
+  const HugePageMemoryPool::SharedPtr &
+  get_pool() const noexcept
+  {
+    return pool_;
+  }
+
+private:
+  HugePageMemoryPool::SharedPtr pool_;
+};
+
+template<typename T, typename U>
+bool
+operator==(const HugePageAllocator<T> & lhs, const HugePageAllocator<U> & rhs) noexcept
+{
+  return lhs.get_pool() == rhs.get_pool();
+}
+
+template<typename T, typename U>
+bool
+operator!=(const HugePageAllocator<T> & lhs, const HugePageAllocator<U> & rhs) noexcept
+{
+  return !(lhs == rhs);
+}
+
+}  // namespace experimental
+}  // namespace rclcpp
+
+#endif  // RCLCPP__EXPERIMENTAL__HUGE_PAGE_ALLOCATOR_HPP_
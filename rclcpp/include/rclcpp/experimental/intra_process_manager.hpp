@@ -19,19 +19,29 @@
 
 #include <shared_mutex>
 
+#include <atomic>
+#include <cstdint>
 #include <iterator>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
+#include <string>
+#include <type_traits>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 #include <typeinfo>
 
 #include "rclcpp/allocator/allocator_deleter.hpp"
+#include "rclcpp/context.hpp"
+#include "rclcpp/experimental/buffers/broadcast_ring.hpp"
 #include "rclcpp/experimental/ros_message_intra_process_buffer.hpp"
+#include "rclcpp/experimental/service_intra_process.hpp"
 #include "rclcpp/experimental/subscription_intra_process.hpp"
 #include "rclcpp/experimental/subscription_intra_process_base.hpp"
 #include "rclcpp/experimental/subscription_intra_process_buffer.hpp"
+#include "rclcpp/lock_profiling.hpp"
 #include "rclcpp/logger.hpp"
 #include "rclcpp/logging.hpp"
 #include "rclcpp/macros.hpp"
@@ -51,7 +61,9 @@ namespace experimental
  * A singleton instance of this class is owned by a rclcpp::Context and a
  * rclcpp::Node can use an associated Context to get an instance of this class.
  * Nodes which do not have a common Context will not exchange intra process
- * messages because they do not share access to the same instance of this class.
+ * messages because they do not share access to the same instance of this class,
+ * unless they have the same domain id and share_intra_process_across_contexts set
+ * in their rclcpp::InitOptions, see get_instance().
  *
  * When a Node creates a subscription, it can also create a helper class,
  * called SubscriptionIntraProcess, meant to receive intra process messages.
@@ -102,6 +114,21 @@ public:
   RCLCPP_PUBLIC
   virtual ~IntraProcessManager();
 
+  /// Get the intra process manager of the publishers and subscriptions of a context.
+  /**
+   * This is the manager owned by the context, or, if the context was initialized with
+   * rclcpp::InitOptions::share_intra_process_across_contexts, a manager shared by all
+   * the contexts of the process with the same domain id and this option set.
+   * It's kept alive as long as one of these contexts exists.
+   *
+   * \param context the context of the publishers or subscriptions.
+   * \return the intra process manager.
+   */
+  RCLCPP_PUBLIC
+  static
+  SharedPtr
+  get_instance(rclcpp::Context & context);
+
   /// Register a subscription with the manager, returns subscriptions unique id.
   /**
    * This method stores the subscription intra process object, together with
@@ -150,6 +177,37 @@ public:
   void
   remove_publisher(uint64_t intra_process_publisher_id);
 
+  /// Register the intra-process receiver of a service, returns its unique id.
+  /**
+   * Clients of the process find it with get_service() by the name of the service.
+   *
+   * \param service the ServiceIntraProcess to register.
+   * \return an unsigned 64-bit integer which is the service's unique id.
+   */
+  RCLCPP_PUBLIC
+  uint64_t
+  add_service(rclcpp::experimental::ServiceIntraProcessBase::SharedPtr service);
+
+  /// Unregister the intra-process receiver of a service using its unique id.
+  /**
+   * \param intra_process_service_id id of the service to remove.
+   */
+  RCLCPP_PUBLIC
+  void
+  remove_service(uint64_t intra_process_service_id);
+
+  /// Get the intra-process receiver of a service by the name of the service.
+  /**
+   * If several services of the process have the same name, the first one registered
+   * is returned, as requests are handled by a single service.
+   *
+   * \param service_name the fully qualified name of the service.
+   * \return the receiver of the service, or nullptr if no service of the process has this name.
+   */
+  RCLCPP_PUBLIC
+  rclcpp::experimental::ServiceIntraProcessBase::SharedPtr
+  get_service(const std::string & service_name) const;
+
   /// Publishes an intra-process message, passed as a unique pointer.
   /**
    * This is one of the two methods for publishing intra-process.
@@ -173,6 +231,9 @@ public:
    * \param intra_process_publisher_id the id of the publisher of this message.
    * \param message the message that is being stored.
    * \param allocator for allocations when buffering messages.
+   * \param ros_message the message already converted to its ROS message type, if the
+   *   publisher had to convert it (e.g. for inter-process subscriptions), to avoid converting
+   *   it again for intra-process subscriptions taking the ROS message type.
    */
   template<
     typename MessageT,
@@ -184,56 +245,53 @@ public:
   do_intra_process_publish(
     uint64_t intra_process_publisher_id,
     std::unique_ptr<MessageT, Deleter> message,
-    typename allocator::AllocRebind<MessageT, Alloc>::allocator_type & allocator)
+    typename allocator::AllocRebind<MessageT, Alloc>::allocator_type & allocator,
+    std::shared_ptr<const ROSMessageType> ros_message = nullptr)
   {
     using MessageAllocTraits = allocator::AllocRebind<MessageT, Alloc>;
     using MessageAllocatorT = typename MessageAllocTraits::allocator_type;
 
-    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
-
-    auto publisher_it = pub_to_subs_.find(intra_process_publisher_id);
-    if (publisher_it == pub_to_subs_.end()) {
+    auto plan = get_delivery_plan(intra_process_publisher_id);
+    if (!plan) {
       // Publisher is either invalid or no longer exists.
       RCLCPP_WARN(
         rclcpp::get_logger("rclcpp"),
         "Calling do_intra_process_publish for invalid or no longer existing publisher id");
       return;
     }
-    const auto & sub_ids = publisher_it->second;
+    plan = this->template filter_delivery_plan<MessageT, ROSMessageType>(
+      std::move(plan), *message, ros_message.get());
 
-    if (sub_ids.take_ownership_subscriptions.empty()) {
+    if (plan->take_ownership_subscriptions.empty()) {
       // None of the buffers require ownership, so we promote the pointer
       std::shared_ptr<MessageT> msg = std::move(message);
 
       this->template add_shared_msg_to_buffers<MessageT, Alloc, Deleter, ROSMessageType>(
-        msg, sub_ids.take_shared_subscriptions);
-    } else if (!sub_ids.take_ownership_subscriptions.empty() && // NOLINT
-      sub_ids.take_shared_subscriptions.size() <= 1)
+        msg, plan->take_shared_subscriptions, plan->broadcast.get(), ros_message);
+    } else if (!plan->take_ownership_subscriptions.empty() && // NOLINT
+      plan->take_shared_subscriptions.size() <= 1)
     {
       // There is at maximum 1 buffer that does not require ownership.
       // So this case is equivalent to all the buffers requiring ownership
 
-      // Merge the two vector of ids into a unique one
-      std::vector<uint64_t> concatenated_vector(sub_ids.take_shared_subscriptions);
-      concatenated_vector.insert(
-        concatenated_vector.end(),
-        sub_ids.take_ownership_subscriptions.begin(),
-        sub_ids.take_ownership_subscriptions.end());
       this->template add_owned_msg_to_buffers<MessageT, Alloc, Deleter, ROSMessageType>(
         std::move(message),
-        concatenated_vector,
-        allocator);
-    } else if (!sub_ids.take_ownership_subscriptions.empty() && // NOLINT
-      sub_ids.take_shared_subscriptions.size() > 1)
+        plan->all_subscriptions,
+        allocator,
+        ros_message);
+    } else if (!plan->take_ownership_subscriptions.empty() && // NOLINT
+      plan->take_shared_subscriptions.size() > 1)
     {
       // Construct a new shared pointer from the message
       // for the buffers that do not require ownership
       auto shared_msg = std::allocate_shared<MessageT, MessageAllocatorT>(allocator, *message);
 
-      this->template add_shared_msg_to_buffers<MessageT, Alloc, Deleter, ROSMessageType>(
-        shared_msg, sub_ids.take_shared_subscriptions);
+      // The message converted for the shared subscriptions, if any, is reused for the others
+      ros_message =
+        this->template add_shared_msg_to_buffers<MessageT, Alloc, Deleter, ROSMessageType>(
+        shared_msg, plan->take_shared_subscriptions, plan->broadcast.get(), ros_message);
       this->template add_owned_msg_to_buffers<MessageT, Alloc, Deleter, ROSMessageType>(
-        std::move(message), sub_ids.take_ownership_subscriptions, allocator);
+        std::move(message), plan->take_ownership_subscriptions, allocator, ros_message);
     }
   }
 
@@ -252,24 +310,23 @@ public:
     using MessageAllocTraits = allocator::AllocRebind<MessageT, Alloc>;
     using MessageAllocatorT = typename MessageAllocTraits::allocator_type;
 
-    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
-
-    auto publisher_it = pub_to_subs_.find(intra_process_publisher_id);
-    if (publisher_it == pub_to_subs_.end()) {
+    auto plan = get_delivery_plan(intra_process_publisher_id);
+    if (!plan) {
       // Publisher is either invalid or no longer exists.
       RCLCPP_WARN(
         rclcpp::get_logger("rclcpp"),
         "Calling do_intra_process_publish for invalid or no longer existing publisher id");
       return nullptr;
     }
-    const auto & sub_ids = publisher_it->second;
+    plan = this->template filter_delivery_plan<MessageT, ROSMessageType>(
+      std::move(plan), *message);
 
-    if (sub_ids.take_ownership_subscriptions.empty()) {
+    if (plan->take_ownership_subscriptions.empty()) {
       // If there are no owning, just convert to shared.
       std::shared_ptr<MessageT> shared_msg = std::move(message);
-      if (!sub_ids.take_shared_subscriptions.empty()) {
+      if (!plan->take_shared_subscriptions.empty()) {
         this->template add_shared_msg_to_buffers<MessageT, Alloc, Deleter, ROSMessageType>(
-          shared_msg, sub_ids.take_shared_subscriptions);
+          shared_msg, plan->take_shared_subscriptions, plan->broadcast.get());
       }
       return shared_msg;
     } else {
@@ -277,25 +334,90 @@ public:
       // do not require ownership and to return.
       auto shared_msg = std::allocate_shared<MessageT, MessageAllocatorT>(allocator, *message);
 
-      if (!sub_ids.take_shared_subscriptions.empty()) {
-        this->template add_shared_msg_to_buffers<MessageT, Alloc, Deleter, ROSMessageType>(
+      std::shared_ptr<const ROSMessageType> ros_message;
+      if (!plan->take_shared_subscriptions.empty()) {
+        ros_message =
+          this->template add_shared_msg_to_buffers<MessageT, Alloc, Deleter, ROSMessageType>(
           shared_msg,
-          sub_ids.take_shared_subscriptions);
+          plan->take_shared_subscriptions,
+          plan->broadcast.get());
       }
-      if (!sub_ids.take_ownership_subscriptions.empty()) {
+      if (!plan->take_ownership_subscriptions.empty()) {
         this->template add_owned_msg_to_buffers<MessageT, Alloc, Deleter, ROSMessageType>(
           std::move(message),
-          sub_ids.take_ownership_subscriptions,
-          allocator);
+          plan->take_ownership_subscriptions,
+          allocator,
+          ros_message);
       }
       return shared_msg;
     }
   }
 
+  /// Publishes an intra-process message, passed as a shared pointer.
+  /**
+   * This is used when the publisher doesn't give up the ownership of the message,
+   * e.g. because it returns to a pool once released.
+   * The message is shared with the subscriptions that don't require ownership,
+   * while the other ones receive a copy.
+   *
+   * \param intra_process_publisher_id the id of the publisher of this message.
+   * \param message the message that is being stored.
+   * \param allocator for allocations when buffering messages.
+   */
+  template<
+    typename MessageT,
+    typename ROSMessageType,
+    typename Alloc,
+    typename Deleter = std::default_delete<MessageT>
+  >
+  void
+  do_intra_process_publish_shared(
+    uint64_t intra_process_publisher_id,
+    std::shared_ptr<const MessageT> message,
+    typename allocator::AllocRebind<MessageT, Alloc>::allocator_type & allocator)
+  {
+    using MessageAllocTraits = allocator::AllocRebind<MessageT, Alloc>;
+
+    auto plan = get_delivery_plan(intra_process_publisher_id);
+    if (!plan) {
+      // Publisher is either invalid or no longer exists.
+      RCLCPP_WARN(
+        rclcpp::get_logger("rclcpp"),
+        "Calling do_intra_process_publish for invalid or no longer existing publisher id");
+      return;
+    }
+    plan = this->template filter_delivery_plan<MessageT, ROSMessageType>(
+      std::move(plan), *message);
+
+    std::shared_ptr<const ROSMessageType> ros_message;
+    if (!plan->take_shared_subscriptions.empty()) {
+      ros_message =
+        this->template add_shared_msg_to_buffers<MessageT, Alloc, Deleter, ROSMessageType>(
+        message, plan->take_shared_subscriptions, plan->broadcast.get());
+    }
+    if (!plan->take_ownership_subscriptions.empty()) {
+      auto ptr = MessageAllocTraits::allocate(allocator, 1);
+      MessageAllocTraits::construct(allocator, ptr, *message);
+      Deleter deleter;
+      allocator::set_allocator_for_deleter(&deleter, &allocator);
+      this->template add_owned_msg_to_buffers<MessageT, Alloc, Deleter, ROSMessageType>(
+        std::unique_ptr<MessageT, Deleter>(ptr, deleter),
+        plan->take_ownership_subscriptions,
+        allocator,
+        ros_message);
+    }
+  }
+
   /// Return true if the given rmw_gid_t matches any stored Publishers.
+  /**
+   * \param id the gid of the publisher.
+   * \param serialized whether to consider the publishers of serialized messages,
+   *   which only deliver intra-process messages to subscriptions to serialized messages,
+   *   rather than the publishers of typed messages.
+   */
   RCLCPP_PUBLIC
   bool
-  matches_any_publishers(const rmw_gid_t * id) const;
+  matches_any_publishers(const rmw_gid_t * id, bool serialized = false) const;
 
   /// Return the number of intraprocess subscriptions that are matched with a given publisher id.
   RCLCPP_PUBLIC
@@ -312,10 +434,147 @@ public:
   lowest_available_capacity(const uint64_t intra_process_publisher_id) const;
 
 private:
-  struct SplittedSubscriptions
+  /// Subscription receiving the messages of a publisher.
+  /**
+   * The subscription is cast to the buffer types requested by the publisher the first
+   * time it receives a message of each type, and the result is cached, so that delivering
+   * the following messages doesn't need any dynamic cast.
+   */
+  class DeliveryTarget
   {
-    std::vector<uint64_t> take_shared_subscriptions;
-    std::vector<uint64_t> take_ownership_subscriptions;
+public:
+    DeliveryTarget(
+      uint64_t id,
+      rclcpp::experimental::SubscriptionIntraProcessBase::WeakPtr weak_subscription)
+    : subscription_id(id), subscription(std::move(weak_subscription))
+    {}
+
+    ~DeliveryTarget()
+    {
+      auto node = resolved_buffers_.load(std::memory_order_acquire);
+      while (node) {
+        auto next = node->next;
+        delete node;
+        node = next;
+      }
+    }
+
+    /// Get the subscription as a BufferT, or nullptr if it isn't one.
+    template<typename BufferT>
+    BufferT *
+    get_buffer(rclcpp::experimental::SubscriptionIntraProcessBase * subscription_base) const
+    {
+      const void * type_tag = get_type_tag<BufferT>();
+      auto head = resolved_buffers_.load(std::memory_order_acquire);
+      for (auto node = head; node; node = node->next) {
+        if (node->type_tag == type_tag) {
+          return static_cast<BufferT *>(node->buffer);
+        }
+      }
+      // Publishers use a couple of buffer types at most, so the list stays short.
+      // Concurrent publishers may resolve the same type twice, which is harmless.
+      BufferT * buffer = dynamic_cast<BufferT *>(subscription_base);
+      auto node = new ResolvedBuffer{type_tag, buffer, head};
+      while (!resolved_buffers_.compare_exchange_weak(
+          node->next, node, std::memory_order_release, std::memory_order_acquire))
+      {
+      }
+      return buffer;
+    }
+
+    const uint64_t subscription_id;
+    const rclcpp::experimental::SubscriptionIntraProcessBase::WeakPtr subscription;
+
+private:
+    RCLCPP_DISABLE_COPY(DeliveryTarget)
+
+    struct ResolvedBuffer
+    {
+      const void * type_tag;
+      void * buffer;
+      ResolvedBuffer * next;
+    };
+
+    template<typename BufferT>
+    static const void *
+    get_type_tag()
+    {
+      static const char tag = 0;
+      return &tag;
+    }
+
+    mutable std::atomic<ResolvedBuffer *> resolved_buffers_ {nullptr};
+  };
+
+  using DeliveryTargets = std::vector<std::shared_ptr<const DeliveryTarget>>;
+
+  /// Broadcast ring of a publisher, written once for all its broadcast subscriptions.
+  /**
+   * The ring is created when the first message is delivered to a broadcast subscription,
+   * as its type is only known then.
+   */
+  class BroadcastState
+  {
+public:
+    explicit BroadcastState(size_t depth)
+    : depth_(depth)
+    {}
+
+    /// Get the ring of the publisher, or nullptr if it was created for another message type.
+    template<typename MessageT>
+    rclcpp::experimental::buffers::BroadcastRing<std::shared_ptr<const MessageT>> *
+    get_ring()
+    {
+      using RingT = rclcpp::experimental::buffers::BroadcastRing<std::shared_ptr<const MessageT>>;
+      std::call_once(
+        created_, [this]() {
+          ring_ = std::make_shared<RingT>(depth_);
+          type_tag_ = get_type_tag<MessageT>();
+        });
+      if (type_tag_ != get_type_tag<MessageT>()) {
+        return nullptr;
+      }
+      return static_cast<RingT *>(ring_.get());
+    }
+
+    /// Get a pointer owning the ring, kept by the subscriptions reading it.
+    std::shared_ptr<const void>
+    get_ring_owner() const
+    {
+      return ring_;
+    }
+
+private:
+    RCLCPP_DISABLE_COPY(BroadcastState)
+
+    template<typename MessageT>
+    static const void *
+    get_type_tag()
+    {
+      static const char tag = 0;
+      return &tag;
+    }
+
+    const size_t depth_;
+    std::once_flag created_;
+    std::shared_ptr<void> ring_;
+    const void * type_tag_ = nullptr;
+  };
+
+  /// Subscriptions receiving the messages of a publisher.
+  /**
+   * Plans are immutable: when subscriptions are added or removed a new plan is built,
+   * so that publishing only needs to get the current plan of the publisher, and can
+   * deliver the message without holding the lock of the intra process manager.
+   */
+  struct DeliveryPlan
+  {
+    DeliveryTargets take_shared_subscriptions;
+    DeliveryTargets take_ownership_subscriptions;
+    /// The take shared subscriptions followed by the take ownership ones.
+    DeliveryTargets all_subscriptions;
+    /// Broadcast ring of the publisher, kept by the following plans.
+    std::shared_ptr<BroadcastState> broadcast;
   };
 
   using SubscriptionMap =
@@ -325,7 +584,11 @@ private:
     std::unordered_map<uint64_t, rclcpp::PublisherBase::WeakPtr>;
 
   using PublisherToSubscriptionIdsMap =
-    std::unordered_map<uint64_t, SplittedSubscriptions>;
+    std::unordered_map<uint64_t, std::shared_ptr<const DeliveryPlan>>;
+
+  // Ordered by id, so that the first service registered with a name handles its requests
+  using ServiceMap = std::unordered_map<
+    std::string, std::map<uint64_t, rclcpp::experimental::ServiceIntraProcessBase::WeakPtr>>;
 
   RCLCPP_PUBLIC
   static
@@ -334,7 +597,20 @@ private:
 
   RCLCPP_PUBLIC
   void
-  insert_sub_id_for_pub(uint64_t sub_id, uint64_t pub_id, bool use_take_shared_method);
+  insert_sub_id_for_pub(
+    uint64_t sub_id,
+    rclcpp::experimental::SubscriptionIntraProcessBase::SharedPtr subscription,
+    uint64_t pub_id);
+
+  /// Update the intra-process subscription count cached by the publisher, if it still exists.
+  RCLCPP_PUBLIC
+  void
+  update_subscription_count(uint64_t pub_id);
+
+  /// Get the current delivery plan of a publisher, or nullptr if the publisher doesn't exist.
+  RCLCPP_PUBLIC
+  std::shared_ptr<const DeliveryPlan>
+  get_delivery_plan(uint64_t intra_process_publisher_id) const;
 
   RCLCPP_PUBLIC
   bool
@@ -342,15 +618,73 @@ private:
     rclcpp::PublisherBase::SharedPtr pub,
     rclcpp::experimental::SubscriptionIntraProcessBase::SharedPtr sub) const;
 
+  /// Get the plan without the subscriptions whose content filter rejects the message.
+  /**
+   * Filters are evaluated on ROS messages, so messages of an adapted type are only filtered
+   * when the publisher already converted them.
+   *
+   * \param plan the delivery plan of the publisher
+   * \param message the published message
+   * \param ros_message the message converted to its ROS message type, if any
+   */
+  template<typename MessageT, typename ROSMessageType>
+  std::shared_ptr<const DeliveryPlan>
+  filter_delivery_plan(
+    std::shared_ptr<const DeliveryPlan> plan,
+    const MessageT & message,
+    const ROSMessageType * ros_message = nullptr) const
+  {
+    if (!rclcpp::experimental::SubscriptionIntraProcessBase::has_any_content_filter()) {
+      return plan;
+    }
+    if constexpr (std::is_same<MessageT, ROSMessageType>::value) {
+      ros_message = &message;
+    } else {
+      (void)message;
+    }
+    if (!ros_message) {
+      return plan;
+    }
+    bool filtered = false;
+    auto filter = [ros_message, &filtered](const DeliveryTargets & targets) {
+        DeliveryTargets kept;
+        kept.reserve(targets.size());
+        for (const auto & target : targets) {
+          auto subscription = target->subscription.lock();
+          if (subscription && subscription->matches_content_filter(ros_message)) {
+            kept.push_back(target);
+          } else {
+            filtered = true;
+          }
+        }
+        return kept;
+      };
+    auto filtered_plan = std::make_shared<DeliveryPlan>();
+    filtered_plan->broadcast = plan->broadcast;
+    filtered_plan->take_shared_subscriptions = filter(plan->take_shared_subscriptions);
+    filtered_plan->take_ownership_subscriptions = filter(plan->take_ownership_subscriptions);
+    if (!filtered) {
+      return plan;
+    }
+    filtered_plan->all_subscriptions = filtered_plan->take_shared_subscriptions;
+    filtered_plan->all_subscriptions.insert(
+      filtered_plan->all_subscriptions.end(),
+      filtered_plan->take_ownership_subscriptions.begin(),
+      filtered_plan->take_ownership_subscriptions.end());
+    return filtered_plan;
+  }
+
   template<
     typename MessageT,
     typename Alloc,
     typename Deleter,
     typename ROSMessageType>
-  void
+  std::shared_ptr<const ROSMessageType>
   add_shared_msg_to_buffers(
     std::shared_ptr<const MessageT> message,
-    std::vector<uint64_t> subscription_ids)
+    const DeliveryTargets & subscriptions,
+    BroadcastState * broadcast,
+    std::shared_ptr<const ROSMessageType> ros_message = nullptr)
   {
     using ROSMessageTypeAllocatorTraits = allocator::AllocRebind<ROSMessageType, Alloc>;
     using ROSMessageTypeAllocator = typename ROSMessageTypeAllocatorTraits::allocator_type;
@@ -361,30 +695,48 @@ private:
     using PublishedTypeAllocator = typename PublishedTypeAllocatorTraits::allocator_type;
     using PublishedTypeDeleter = allocator::Deleter<PublishedTypeAllocator, PublishedType>;
 
-    for (auto id : subscription_ids) {
-      auto subscription_it = subscriptions_.find(id);
-      if (subscription_it == subscriptions_.end()) {
-        throw std::runtime_error("subscription has unexpectedly gone out of scope");
-      }
-      auto subscription_base = subscription_it->second.lock();
+    rclcpp::experimental::buffers::BroadcastRing<std::shared_ptr<const PublishedType>> * ring =
+      nullptr;
+    uint64_t sequence = 0;
+    std::shared_ptr<const void> ring_owner;
+
+    for (const auto & target : subscriptions) {
+      auto subscription_base = target->subscription.lock();
       if (subscription_base == nullptr) {
-        subscriptions_.erase(id);
         continue;
       }
 
-      auto subscription = std::dynamic_pointer_cast<
+      auto subscription = target->template get_buffer<
         rclcpp::experimental::SubscriptionIntraProcessBuffer<PublishedType,
         PublishedTypeAllocator, PublishedTypeDeleter, ROSMessageType>
-        >(subscription_base);
+        >(subscription_base.get());
       if (subscription != nullptr) {
+        if (broadcast && subscription->uses_broadcast_ring()) {
+          // The message is written once to the ring, and read by all the broadcast subscriptions
+          if (!ring) {
+            ring = broadcast->template get_ring<PublishedType>();
+          }
+          if (!ring) {
+            // Another message type is published, which can't use the ring
+            broadcast = nullptr;
+          } else {
+            if (!ring_owner) {
+              ring_owner = broadcast->get_ring_owner();
+              sequence = ring->write(message);
+            }
+            if (subscription->provide_intra_process_broadcast(*ring, ring_owner, sequence)) {
+              continue;
+            }
+          }
+        }
         subscription->provide_intra_process_data(message);
         continue;
       }
 
-      auto ros_message_subscription = std::dynamic_pointer_cast<
+      auto ros_message_subscription = target->template get_buffer<
         rclcpp::experimental::SubscriptionROSMsgIntraProcessBuffer<ROSMessageType,
         ROSMessageTypeAllocator, ROSMessageTypeDeleter>
-        >(subscription_base);
+        >(subscription_base.get());
       if (nullptr == ros_message_subscription) {
         throw std::runtime_error(
                 "failed to dynamic cast SubscriptionIntraProcessBase to "
@@ -394,27 +746,24 @@ private:
                 "subscription use different allocator types, which is not supported");
       }
 
-      if constexpr (rclcpp::TypeAdapter<MessageT>::is_specialized::value) {
-        ROSMessageType ros_msg;
-        rclcpp::TypeAdapter<MessageT>::convert_to_ros_message(*message, ros_msg);
-        ros_message_subscription->provide_intra_process_message(
-          std::make_shared<ROSMessageType>(ros_msg));
+      if constexpr (std::is_same<MessageT, ROSMessageType>::value) {
+        ros_message_subscription->provide_intra_process_message(message);
       } else {
-        if constexpr (std::is_same<MessageT, ROSMessageType>::value) {
-          ros_message_subscription->provide_intra_process_message(message);
-        } else {
-          if constexpr (std::is_same<typename rclcpp::TypeAdapter<MessageT,
-            ROSMessageType>::ros_message_type, ROSMessageType>::value)
-          {
-            ROSMessageType ros_msg;
+        if constexpr (std::is_same<typename rclcpp::TypeAdapter<MessageT,
+          ROSMessageType>::ros_message_type, ROSMessageType>::value)
+        {
+          // The message is converted once, and then shared by all the subscriptions
+          if (!ros_message) {
+            auto converted_message = std::make_shared<ROSMessageType>();
             rclcpp::TypeAdapter<MessageT, ROSMessageType>::convert_to_ros_message(
-              *message, ros_msg);
-            ros_message_subscription->provide_intra_process_message(
-              std::make_shared<ROSMessageType>(ros_msg));
+              *message, *converted_message);
+            ros_message = std::move(converted_message);
           }
+          ros_message_subscription->provide_intra_process_message(ros_message);
         }
       }
     }
+    return ros_message;
   }
 
   template<
@@ -425,8 +774,9 @@ private:
   void
   add_owned_msg_to_buffers(
     std::unique_ptr<MessageT, Deleter> message,
-    std::vector<uint64_t> subscription_ids,
-    typename allocator::AllocRebind<MessageT, Alloc>::allocator_type & allocator)
+    const DeliveryTargets & subscriptions,
+    typename allocator::AllocRebind<MessageT, Alloc>::allocator_type & allocator,
+    std::shared_ptr<const ROSMessageType> ros_message = nullptr)
   {
     using MessageAllocTraits = allocator::AllocRebind<MessageT, Alloc>;
     using MessageUniquePtr = std::unique_ptr<MessageT, Deleter>;
@@ -440,23 +790,27 @@ private:
     using PublishedTypeAllocator = typename PublishedTypeAllocatorTraits::allocator_type;
     using PublishedTypeDeleter = allocator::Deleter<PublishedTypeAllocator, PublishedType>;
 
-    for (auto it = subscription_ids.begin(); it != subscription_ids.end(); it++) {
-      auto subscription_it = subscriptions_.find(*it);
-      if (subscription_it == subscriptions_.end()) {
-        throw std::runtime_error("subscription has unexpectedly gone out of scope");
-      }
-      auto subscription_base = subscription_it->second.lock();
+    using ROSMessageSubscription = rclcpp::experimental::SubscriptionROSMsgIntraProcessBuffer<
+      ROSMessageType, ROSMessageTypeAllocator, ROSMessageTypeDeleter>;
+    // Without a message converted by the publisher, the message is converted once for all the
+    // subscriptions taking the ROS message type: the last one of them gets the conversion, and
+    // the previous ones a copy of it.
+    std::unique_ptr<ROSMessageType, ROSMessageTypeDeleter> converted_message;
+    rclcpp::experimental::SubscriptionIntraProcessBase::SharedPtr last_ros_subscription_base;
+    ROSMessageSubscription * last_ros_subscription = nullptr;
+
+    for (auto it = subscriptions.begin(); it != subscriptions.end(); it++) {
+      auto subscription_base = (*it)->subscription.lock();
       if (subscription_base == nullptr) {
-        subscriptions_.erase(subscription_it);
         continue;
       }
 
-      auto subscription = std::dynamic_pointer_cast<
+      auto subscription = (*it)->template get_buffer<
         rclcpp::experimental::SubscriptionIntraProcessBuffer<PublishedType,
         PublishedTypeAllocator, PublishedTypeDeleter, ROSMessageType>
-        >(subscription_base);
+        >(subscription_base.get());
       if (subscription != nullptr) {
-        if (std::next(it) == subscription_ids.end()) {
+        if (std::next(it) == subscriptions.end()) {
           // If this is the last subscription, give up ownership
           subscription->provide_intra_process_data(std::move(message));
           // Last message delivered, break from for loop
@@ -473,10 +827,8 @@ private:
         continue;
       }
 
-      auto ros_message_subscription = std::dynamic_pointer_cast<
-        rclcpp::experimental::SubscriptionROSMsgIntraProcessBuffer<ROSMessageType,
-        ROSMessageTypeAllocator, ROSMessageTypeDeleter>
-        >(subscription_base);
+      auto ros_message_subscription =
+        (*it)->template get_buffer<ROSMessageSubscription>(subscription_base.get());
       if (nullptr == ros_message_subscription) {
         throw std::runtime_error(
                 "failed to dynamic cast SubscriptionIntraProcessBase to "
@@ -487,17 +839,30 @@ private:
       }
 
       if constexpr (rclcpp::TypeAdapter<MessageT, ROSMessageType>::is_specialized::value) {
-        ROSMessageTypeAllocator ros_message_alloc(allocator);
-        auto ptr = ROSMessageTypeAllocatorTraits::allocate(ros_message_alloc, 1);
-        ROSMessageTypeAllocatorTraits::construct(ros_message_alloc, ptr);
-        ROSMessageTypeDeleter deleter;
-        allocator::set_allocator_for_deleter(&deleter, &allocator);
-        rclcpp::TypeAdapter<MessageT, ROSMessageType>::convert_to_ros_message(*message, *ptr);
-        auto ros_msg = std::unique_ptr<ROSMessageType, ROSMessageTypeDeleter>(ptr, deleter);
-        ros_message_subscription->provide_intra_process_message(std::move(ros_msg));
+        if (ros_message) {
+          // Copy the message converted by the publisher rather than converting it again
+          ros_message_subscription->provide_intra_process_message(
+            this->template copy_ros_message<ROSMessageType, Alloc>(*ros_message, allocator));
+          continue;
+        }
+        if (last_ros_subscription) {
+          last_ros_subscription->provide_intra_process_message(
+            this->template copy_ros_message<ROSMessageType, Alloc>(
+              *converted_message, allocator));
+        } else {
+          ROSMessageTypeAllocator ros_message_alloc(allocator);
+          auto ptr = ROSMessageTypeAllocatorTraits::allocate(ros_message_alloc, 1);
+          ROSMessageTypeAllocatorTraits::construct(ros_message_alloc, ptr);
+          rclcpp::TypeAdapter<MessageT, ROSMessageType>::convert_to_ros_message(*message, *ptr);
+          ROSMessageTypeDeleter deleter;
+          allocator::set_allocator_for_deleter(&deleter, &allocator);
+          converted_message = std::unique_ptr<ROSMessageType, ROSMessageTypeDeleter>(ptr, deleter);
+        }
+        last_ros_subscription_base = std::move(subscription_base);
+        last_ros_subscription = ros_message_subscription;
       } else {
         if constexpr (std::is_same<MessageT, ROSMessageType>::value) {
-          if (std::next(it) == subscription_ids.end()) {
+          if (std::next(it) == subscriptions.end()) {
             // If this is the last subscription, give up ownership
             ros_message_subscription->provide_intra_process_message(std::move(message));
             // Last message delivered, break from for loop
@@ -515,13 +880,44 @@ private:
         }
       }
     }
+
+    if (last_ros_subscription) {
+      last_ros_subscription->provide_intra_process_message(std::move(converted_message));
+    }
+  }
+
+  /// Copy a ROS message into a new message, for a subscription taking its ownership.
+  template<
+    typename ROSMessageType,
+    typename Alloc,
+    typename AllocatorT>
+  static
+  std::unique_ptr<
+    ROSMessageType,
+    allocator::Deleter<
+      typename allocator::AllocRebind<ROSMessageType, Alloc>::allocator_type, ROSMessageType>>
+  copy_ros_message(const ROSMessageType & message, AllocatorT & allocator)
+  {
+    using ROSMessageTypeAllocatorTraits = allocator::AllocRebind<ROSMessageType, Alloc>;
+    using ROSMessageTypeAllocator = typename ROSMessageTypeAllocatorTraits::allocator_type;
+    using ROSMessageTypeDeleter = allocator::Deleter<ROSMessageTypeAllocator, ROSMessageType>;
+
+    ROSMessageTypeAllocator ros_message_alloc(allocator);
+    auto ptr = ROSMessageTypeAllocatorTraits::allocate(ros_message_alloc, 1);
+    ROSMessageTypeAllocatorTraits::construct(ros_message_alloc, ptr, message);
+    ROSMessageTypeDeleter deleter;
+    allocator::set_allocator_for_deleter(&deleter, &allocator);
+    return std::unique_ptr<ROSMessageType, ROSMessageTypeDeleter>(ptr, deleter);
   }
 
   PublisherToSubscriptionIdsMap pub_to_subs_;
   SubscriptionMap subscriptions_;
   PublisherMap publishers_;
+  ServiceMap services_;
+  std::unordered_map<uint64_t, std::string> service_names_;
 
-  mutable std::shared_timed_mutex mutex_;
+  mutable rclcpp::lock_profiling::ProfiledMutex<std::shared_timed_mutex> mutex_{
+    "rclcpp::experimental::IntraProcessManager::mutex_"};
 };
 
 }  // namespace experimental
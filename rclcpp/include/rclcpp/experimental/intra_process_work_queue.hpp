@@ -0,0 +1,134 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__EXPERIMENTAL__INTRA_PROCESS_WORK_QUEUE_HPP_
+#define RCLCPP__EXPERIMENTAL__INTRA_PROCESS_WORK_QUEUE_HPP_
+
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+#include "rcl/wait.h"
+
+#include "rclcpp/context.hpp"
+#include "rclcpp/guard_condition.hpp"
+#include "rclcpp/macros.hpp"
+#include "rclcpp/visibility_control.hpp"
+#include "rclcpp/waitable.hpp"
+
+namespace rclcpp
+{
+namespace experimental
+{
+
+/// Waitable executing work handed over by other entities of the process.
+/**
+ * Work is pushed from any thread and executed by the executor of the callback group the
+ * queue was added to, one item each time the queue is ready, in the order it was pushed.
+ * Intra-process services and clients use it to run the requests and the responses they
+ * receive in their own callback group.
+ */
+class IntraProcessWorkQueue : public rclcpp::Waitable
+{
+public:
+  RCLCPP_SMART_PTR_ALIASES_ONLY(IntraProcessWorkQueue)
+
+  using Work = std::function<void ()>;
+
+  enum class EntityType : std::size_t
+  {
+    Work,
+  };
+
+  RCLCPP_PUBLIC
+  explicit IntraProcessWorkQueue(rclcpp::Context::SharedPtr context);
+
+  RCLCPP_PUBLIC
+  virtual ~IntraProcessWorkQueue();
+
+  /// Add work to execute, and notify the executor about it.
+  /**
+   * This is thread-safe, and may be called from the work being executed.
+   *
+   * \param[in] work the function to call
+   */
+  RCLCPP_PUBLIC
+  void
+  push(Work work);
+
+  /// Get the number of items pushed and not taken by the executor yet.
+  RCLCPP_PUBLIC
+  size_t
+  size() const;
+
+  RCLCPP_PUBLIC
+  size_t
+  get_number_of_ready_guard_conditions() override {return 1;}
+
+  RCLCPP_PUBLIC
+  void
+  add_to_wait_set(rcl_wait_set_t * wait_set) override;
+
+  RCLCPP_PUBLIC
+  bool
+  is_ready(rcl_wait_set_t * wait_set) override;
+
+  RCLCPP_PUBLIC
+  std::shared_ptr<void>
+  take_data() override;
+
+  RCLCPP_PUBLIC
+  std::shared_ptr<void>
+  take_data_by_entity_id(size_t id) override;
+
+  RCLCPP_PUBLIC
+  void
+  execute(std::shared_ptr<void> & data) override;
+
+  /// Set a callback to be called for each item pushed to the queue.
+  /**
+   * The callback receives the number of items pushed since it was last called, and the
+   * identifier of the queue entity.
+   * Items pushed before the callback was set are reported when it's set.
+   *
+   * \param[in] callback functor to be called when work is pushed
+   * \throws std::invalid_argument if the callback isn't callable
+   */
+  RCLCPP_PUBLIC
+  void
+  set_on_ready_callback(std::function<void(size_t, int)> callback) override;
+
+  /// Unset the callback set with set_on_ready_callback(), if any.
+  RCLCPP_PUBLIC
+  void
+  clear_on_ready_callback() override;
+
+private:
+  RCLCPP_DISABLE_COPY(IntraProcessWorkQueue)
+
+  rclcpp::GuardCondition gc_;
+
+  mutable std::mutex queue_mutex_;
+  std::deque<Work> queue_;
+
+  std::recursive_mutex callback_mutex_;
+  std::function<void(size_t)> on_ready_callback_{nullptr};
+  size_t unread_count_{0};
+};
+
+}  // namespace experimental
+}  // namespace rclcpp
+
+#endif  // RCLCPP__EXPERIMENTAL__INTRA_PROCESS_WORK_QUEUE_HPP_
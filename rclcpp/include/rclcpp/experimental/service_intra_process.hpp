@@ -0,0 +1,108 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__EXPERIMENTAL__SERVICE_INTRA_PROCESS_HPP_
+#define RCLCPP__EXPERIMENTAL__SERVICE_INTRA_PROCESS_HPP_
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "rclcpp/context.hpp"
+#include "rclcpp/experimental/intra_process_work_queue.hpp"
+#include "rclcpp/macros.hpp"
+
+namespace rclcpp
+{
+namespace experimental
+{
+
+/// Receiver of the requests that the clients of the process send to a service.
+/**
+ * Clients using intra-process communication find it in the IntraProcessManager by the name
+ * of the service, and hand their requests over to it without the middleware.
+ */
+class ServiceIntraProcessBase : public IntraProcessWorkQueue
+{
+public:
+  RCLCPP_SMART_PTR_ALIASES_ONLY(ServiceIntraProcessBase)
+
+  ServiceIntraProcessBase(rclcpp::Context::SharedPtr context, const std::string & service_name)
+  : IntraProcessWorkQueue(std::move(context)), service_name_(service_name)
+  {}
+
+  /// Get the fully qualified name of the service.
+  const std::string &
+  get_service_name() const
+  {
+    return service_name_;
+  }
+
+private:
+  std::string service_name_;
+};
+
+/// Receiver of the requests sent to a service of type ServiceT within the process.
+template<typename ServiceT>
+class ServiceIntraProcess : public ServiceIntraProcessBase
+{
+public:
+  RCLCPP_SMART_PTR_DEFINITIONS(ServiceIntraProcess)
+
+  using SharedRequest = std::shared_ptr<typename ServiceT::Request>;
+  using SharedResponse = std::shared_ptr<typename ServiceT::Response>;
+  using ResponseCallback = std::function<void (SharedResponse)>;
+  using RequestHandler = std::function<void (SharedRequest, ResponseCallback)>;
+
+  /// Constructor.
+  /**
+   * \param[in] context the context of the service
+   * \param[in] service_name the fully qualified name of the service
+   * \param[in] handler called by the executor of the service for each request, with the
+   *   callback to call with its response
+   */
+  ServiceIntraProcess(
+    rclcpp::Context::SharedPtr context,
+    const std::string & service_name,
+    RequestHandler handler)
+  : ServiceIntraProcessBase(std::move(context), service_name), handler_(std::move(handler))
+  {}
+
+  /// Hand a request over to the service, to be handled by its executor.
+  /**
+   * The request is shared with the service, and must not be modified until it has responded.
+   * The respond callback may be called by any thread, if the service defers its response,
+   * and isn't called if the service never responds.
+   *
+   * \param[in] request the request, which isn't copied
+   * \param[in] respond the callback called with the response
+   */
+  void
+  send_request(SharedRequest request, ResponseCallback respond)
+  {
+    this->push(
+      [this, request = std::move(request), respond = std::move(respond)]() mutable {
+        handler_(std::move(request), std::move(respond));
+      });
+  }
+
+private:
+  RequestHandler handler_;
+};
+
+}  // namespace experimental
+}  // namespace rclcpp
+
+#endif  // RCLCPP__EXPERIMENTAL__SERVICE_INTRA_PROCESS_HPP_
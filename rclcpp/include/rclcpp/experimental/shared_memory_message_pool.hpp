@@ -0,0 +1,356 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__EXPERIMENTAL__SHARED_MEMORY_MESSAGE_POOL_HPP_
+#define RCLCPP__EXPERIMENTAL__SHARED_MEMORY_MESSAGE_POOL_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "rclcpp/experimental/shared_memory_segment.hpp"
+#include "rclcpp/macros.hpp"
+
+namespace rclcpp
+{
+namespace experimental
+{
+
+/// Pool of fixed-size messages stored in a shared memory segment.
+/**
+ * This pool lets publishers and subscribers running in different processes on the same host
+ * exchange messages without copying or serializing them, even when the middleware can't
+ * loan messages.
+ * A publisher borrows a slot of the pool, fills the message in place and publishes it.
+ * A subscriber takes the published messages in order and gets a pointer to the message
+ * stored in the shared memory, which stays valid as long as the returned pointer is alive.
+ *
+ * Only messages which are trivially copyable (i.e. fixed-size messages without
+ * sequences or strings) can be placed in shared memory.
+ *
+ * The pool keeps the "keep last" semantics of a ring buffer: when a publisher borrows a
+ * message, the free slot holding the oldest message is reused, and slots currently held by
+ * subscribers are never overwritten.
+ * All the operations are lock-free.
+ */
+template<typename MessageT>
+class SharedMemoryMessagePool
+{
+  static_assert(
+    std::is_trivially_copyable<MessageT>::value,
+    "SharedMemoryMessagePool requires fixed-size, trivially copyable messages");
+  static_assert(
+    std::atomic<uint64_t>::is_always_lock_free && std::atomic<uint32_t>::is_always_lock_free,
+    "SharedMemoryMessagePool requires lock-free atomics to share them between processes");
+
+  struct PoolHeader
+  {
+    std::atomic<uint64_t> magic;
+    uint64_t capacity;
+    uint64_t message_size;
+    std::atomic<uint64_t> last_sequence;
+  };
+
+  struct Slot
+  {
+    // Number of subscribers holding the slot, or writing_flag while a publisher holds it.
+    std::atomic<uint32_t> state;
+    // Sequence number of the stored message, 0 if the slot doesn't hold a published message.
+    std::atomic<uint64_t> sequence;
+    alignas(MessageT) unsigned char storage[sizeof(MessageT)];
+  };
+
+  static constexpr uint64_t pool_magic = 0x72636c6370707368;
+  static constexpr uint32_t writing_flag = 0x80000000u;
+
+public:
+  RCLCPP_SMART_PTR_DEFINITIONS(SharedMemoryMessagePool<MessageT>)
+
+  /// A message borrowed from the pool, to be filled in place and then published.
+  /**
+   * Like rclcpp::LoanedMessage, the memory of the message is valid as long as the loan is
+   * alive, and the slot is returned to the pool if the loan is destroyed without being
+   * published.
+   */
+  class Loan
+  {
+public:
+    Loan()
+    : pool_(nullptr), slot_(nullptr)
+    {}
+
+    Loan(Loan && other)
+    : pool_(other.pool_), slot_(other.slot_)
+    {
+      other.slot_ = nullptr;
+    }
+
+    Loan &
+    operator=(Loan && other)
+    {
+      if (this != &other) {
+        release_slot();
+        pool_ = other.pool_;
+        slot_ = other.slot_;
+        other.slot_ = nullptr;
+      }
+      return *this;
+    }
+
+    ~Loan()
+    {
+      release_slot();
+    }
+
+    /// Return true if a slot of the pool was borrowed.
+    bool
+    is_valid() const
+    {
+      return slot_ != nullptr;
+    }
+
+    /// Access the message stored in the shared memory.
+    MessageT &
+    get() const
+    {
+      return *reinterpret_cast<MessageT *>(slot_->storage);
+    }
+
+private:
+    friend class SharedMemoryMessagePool<MessageT>;
+
+    Loan(SharedMemoryMessagePool<MessageT> * pool, Slot * slot)
+    : pool_(pool), slot_(slot)
+    {}
+
+    void
+    release_slot()
+    {
+      if (slot_) {
+        slot_->state.store(0, std::memory_order_release);
+        slot_ = nullptr;
+      }
+    }
+
+    SharedMemoryMessagePool<MessageT> * pool_;
+    Slot * slot_;
+
+    Loan(const Loan &) = delete;
+    Loan & operator=(const Loan &) = delete;
+  };
+
+  /// Create the pool in a new segment, or open the pool already created by another process.
+  /**
+   * \param[in] name name of the shared memory segment, usually derived from the topic name
+   * \param[in] capacity number of messages stored in the pool, it must match the capacity of
+   *   the existing pool when opening it
+   * \throws std::invalid_argument if the capacity is zero
+   * \throws std::runtime_error if the segment can't be mapped, or if it holds a different pool
+   */
+  SharedMemoryMessagePool(const std::string & name, size_t capacity)
+  : capacity_(capacity)
+  {
+    if (capacity == 0) {
+      throw std::invalid_argument("capacity must be a positive, non-zero value");
+    }
+    segment_ = std::make_shared<SharedMemorySegment>(
+      name, sizeof(PoolHeader) + capacity * sizeof(Slot));
+    header_ = static_cast<PoolHeader *>(segment_->get_address());
+    slots_ = reinterpret_cast<Slot *>(header_ + 1);
+
+    if (segment_->is_owner()) {
+      header_->capacity = capacity;
+      header_->message_size = sizeof(MessageT);
+      new (&header_->last_sequence) std::atomic<uint64_t>(0);
+      for (size_t i = 0; i < capacity_; ++i) {
+        new (&slots_[i].state) std::atomic<uint32_t>(0);
+        new (&slots_[i].sequence) std::atomic<uint64_t>(0);
+      }
+      // Other processes only use the pool once the magic number has been written.
+      new (&header_->magic) std::atomic<uint64_t>(0);
+      header_->magic.store(pool_magic, std::memory_order_release);
+      return;
+    }
+
+    // The creator may still be initializing the pool.
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+    while (header_->magic.load(std::memory_order_acquire) != pool_magic) {
+      if (std::chrono::steady_clock::now() > deadline) {
+        throw std::runtime_error(
+                "shared memory segment '" + segment_->get_name() + "' doesn't hold a message pool");
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    if (header_->capacity != capacity || header_->message_size != sizeof(MessageT)) {
+      throw std::runtime_error(
+              "shared memory segment '" + segment_->get_name() +
+              "' holds a pool with a different capacity or message type");
+    }
+  }
+
+  virtual ~SharedMemoryMessagePool() {}
+
+  /// Borrow a message from the pool.
+  /**
+   * The message is default constructed.
+   * \return a valid loan, or an invalid one if all the slots are held by subscribers
+   *   or by other loans
+   */
+  Loan
+  borrow()
+  {
+    while (true) {
+      // Reuse the free slot holding the oldest message.
+      Slot * oldest = nullptr;
+      uint64_t oldest_sequence = UINT64_MAX;
+      for (size_t i = 0; i < capacity_; ++i) {
+        Slot & slot = slots_[i];
+        if (slot.state.load(std::memory_order_relaxed) != 0) {
+          continue;
+        }
+        uint64_t sequence = slot.sequence.load(std::memory_order_relaxed);
+        if (sequence < oldest_sequence) {
+          oldest = &slot;
+          oldest_sequence = sequence;
+        }
+      }
+      if (!oldest) {
+        return Loan();
+      }
+      uint32_t expected = 0;
+      if (oldest->state.compare_exchange_strong(
+          expected, writing_flag, std::memory_order_acquire))
+      {
+        // The previous message is gone, and the slot isn't taken again until it's published.
+        oldest->sequence.store(0, std::memory_order_release);
+        new (oldest->storage) MessageT();
+        return Loan(this, oldest);
+      }
+      // Another publisher or a subscriber got the slot first, look again.
+    }
+  }
+
+  /// Publish a borrowed message, making it available to the subscribers.
+  /**
+   * The loan is no longer valid after this call.
+   * \throws std::runtime_error if the loan is not valid or belongs to another pool
+   */
+  void
+  publish(Loan && loan)
+  {
+    if (!loan.is_valid() || loan.pool_ != this) {
+      throw std::runtime_error("loaned message is not valid");
+    }
+    Slot * slot = loan.slot_;
+    loan.slot_ = nullptr;
+    uint64_t sequence = header_->last_sequence.fetch_add(1, std::memory_order_acq_rel) + 1;
+    slot->sequence.store(sequence, std::memory_order_relaxed);
+    slot->state.store(0, std::memory_order_release);
+  }
+
+  /// Take the oldest message published after the given sequence number.
+  /**
+   * The returned message points to the shared memory, and its slot is not reused by
+   * publishers until the pointer is destroyed.
+   * \param[inout] last_sequence sequence number of the last message taken by the caller,
+   *   updated with the sequence number of the returned message
+   * \return the message, or nullptr if no newer message is available
+   */
+  std::shared_ptr<const MessageT>
+  take(uint64_t & last_sequence)
+  {
+    // Messages up to this sequence number are taken, or are being overwritten by publishers.
+    uint64_t skipped_sequence = last_sequence;
+    while (true) {
+      Slot * next = nullptr;
+      uint64_t next_sequence = UINT64_MAX;
+      for (size_t i = 0; i < capacity_; ++i) {
+        Slot & slot = slots_[i];
+        if (slot.state.load(std::memory_order_relaxed) & writing_flag) {
+          continue;
+        }
+        uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+        if (sequence > skipped_sequence && sequence < next_sequence) {
+          next = &slot;
+          next_sequence = sequence;
+        }
+      }
+      if (!next) {
+        return nullptr;
+      }
+
+      uint32_t state = next->state.load(std::memory_order_relaxed);
+      bool acquired = false;
+      while (!(state & writing_flag)) {
+        if (next->state.compare_exchange_weak(state, state + 1, std::memory_order_acquire)) {
+          acquired = true;
+          break;
+        }
+      }
+      if (!acquired) {
+        // A publisher is overwriting the slot, so this message is gone, try the next one.
+        skipped_sequence = next_sequence;
+        continue;
+      }
+      if (next->sequence.load(std::memory_order_acquire) != next_sequence) {
+        // The slot was reused before it could be acquired.
+        next->state.fetch_sub(1, std::memory_order_release);
+        continue;
+      }
+
+      last_sequence = next_sequence;
+      // The segment is kept mapped until all the taken messages are released.
+      auto segment = segment_;
+      return std::shared_ptr<const MessageT>(
+        reinterpret_cast<const MessageT *>(next->storage),
+        [segment, next](const MessageT *) {
+          next->state.fetch_sub(1, std::memory_order_release);
+        });
+    }
+  }
+
+  /// Get the sequence number of the last published message, 0 if none.
+  uint64_t
+  get_last_sequence() const
+  {
+    return header_->last_sequence.load(std::memory_order_acquire);
+  }
+
+  /// Get the number of messages stored in the pool.
+  size_t
+  get_capacity() const
+  {
+    return capacity_;
+  }
+
+private:
+  RCLCPP_DISABLE_COPY(SharedMemoryMessagePool<MessageT>)
+
+  size_t capacity_;
+  SharedMemorySegment::SharedPtr segment_;
+  PoolHeader * header_;
+  Slot * slots_;
+};
+
+}  // namespace experimental
+}  // namespace rclcpp
+
+#endif  // RCLCPP__EXPERIMENTAL__SHARED_MEMORY_MESSAGE_POOL_HPP_
@@ -0,0 +1,89 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__EXPERIMENTAL__SHARED_MEMORY_SEGMENT_HPP_
+#define RCLCPP__EXPERIMENTAL__SHARED_MEMORY_SEGMENT_HPP_
+
+#include <cstddef>
+#include <string>
+
+#include "rclcpp/macros.hpp"
+#include "rclcpp/visibility_control.hpp"
+
+namespace rclcpp
+{
+namespace experimental
+{
+
+/// A named memory segment that can be mapped by several processes on the same host.
+/**
+ * The first instance created with a given name creates the segment and is its owner:
+ * the segment name is removed from the system when the owner is destroyed, while the memory
+ * stays valid for the other processes until they unmap it.
+ * Other instances open the existing segment, which must have the same size, after waiting
+ * briefly for its creator to resize it if it hasn't yet.
+ *
+ * Only POSIX systems are supported, on other platforms the constructor throws.
+ */
+class SharedMemorySegment
+{
+public:
+  RCLCPP_SMART_PTR_DEFINITIONS(SharedMemorySegment)
+
+  /// Create or open the segment with the given name.
+  /**
+   * \param[in] name name of the segment, it must not contain any '/'
+   * \param[in] size size in bytes of the segment
+   * \throws std::invalid_argument if the name is empty or the size is zero
+   * \throws std::runtime_error if the segment can't be created, opened or mapped
+   */
+  RCLCPP_PUBLIC
+  SharedMemorySegment(const std::string & name, size_t size);
+
+  RCLCPP_PUBLIC
+  virtual ~SharedMemorySegment();
+
+  /// Get the address where the segment is mapped in this process.
+  RCLCPP_PUBLIC
+  void *
+  get_address() const;
+
+  /// Get the size in bytes of the segment.
+  RCLCPP_PUBLIC
+  size_t
+  get_size() const;
+
+  /// Return true if this instance created the segment.
+  RCLCPP_PUBLIC
+  bool
+  is_owner() const;
+
+  /// Get the name of the segment.
+  RCLCPP_PUBLIC
+  const std::string &
+  get_name() const;
+
+private:
+  RCLCPP_DISABLE_COPY(SharedMemorySegment)
+
+  std::string name_;
+  size_t size_;
+  void * address_;
+  bool owner_;
+};
+
+}  // namespace experimental
+}  // namespace rclcpp
+
+#endif  // RCLCPP__EXPERIMENTAL__SHARED_MEMORY_SEGMENT_HPP_
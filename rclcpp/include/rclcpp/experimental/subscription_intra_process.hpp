@@ -17,6 +17,9 @@
 
 #include <rmw/types.h>
 
+#include <chrono>
+#include <cstdint>
+#include <functional>
 #include <memory>
 #include <stdexcept>
 #include <string>
@@ -27,6 +30,7 @@
 
 #include "rclcpp/any_subscription_callback.hpp"
 #include "rclcpp/context.hpp"
+#include "rclcpp/detail/dispatch_arena.hpp"
 #include "rclcpp/experimental/buffers/intra_process_buffer.hpp"
 #include "rclcpp/experimental/subscription_intra_process_buffer.hpp"
 #include "rclcpp/qos.hpp"
@@ -85,7 +89,11 @@ public:
       topic_name,
       qos_profile,
       buffer_type),
-    any_callback_(callback)
+    any_callback_(callback),
+    // Callbacks taking a const reference are given messages as stored, without copying them
+    take_shared_method_(
+      any_callback_.use_take_shared_method() ||
+      (any_callback_.use_const_reference_method() && this->buffer_->use_take_shared_method()))
   {
     TRACETOOLS_TRACEPOINT(
       rclcpp_subscription_callback_added,
@@ -101,23 +109,54 @@ public:
 
   virtual ~SubscriptionIntraProcess() = default;
 
+  /// Callback called with the time each message waited in the buffer.
+  using BufferDwellTimeCallback = std::function<void (std::chrono::nanoseconds)>;
+
+  /// Measure the time the messages wait in the buffer, from when they're added to it.
+  /**
+   * The buffer records the time the messages are added only once this is called, so that
+   * nothing is measured otherwise.
+   * This must be called before messages are delivered to the subscription.
+   *
+   * \param callback called when a message is taken, or nullptr to stop measuring
+   * \return `false` if the buffer can't record the time the messages are added
+   */
+  bool
+  set_buffer_dwell_time_callback(BufferDwellTimeCallback callback)
+  {
+    if (callback && !this->buffer_->record_enqueue_times()) {
+      return false;
+    }
+    buffer_dwell_time_callback_ = std::move(callback);
+    return true;
+  }
+
   std::shared_ptr<void>
   take_data() override
   {
     ConstMessageSharedPtr shared_msg;
     MessageUniquePtr unique_msg;
 
-    if (any_callback_.use_take_shared_method()) {
-      shared_msg = this->buffer_->consume_shared();
+    int64_t enqueue_time = 0;
+    if (take_shared_method_) {
+      shared_msg = buffer_dwell_time_callback_ ?
+        this->buffer_->consume_shared_timed(enqueue_time) : this->buffer_->consume_shared();
       if (!shared_msg) {
         return nullptr;
       }
     } else {
-      unique_msg = this->buffer_->consume_unique();
+      unique_msg = buffer_dwell_time_callback_ ?
+        this->buffer_->consume_unique_timed(enqueue_time) : this->buffer_->consume_unique();
       if (!unique_msg) {
         return nullptr;
       }
     }
+    // Messages read from a broadcast ring weren't added to the buffer, nor timed
+    if (enqueue_time != 0) {
+      buffer_dwell_time_callback_(
+        std::chrono::steady_clock::now().time_since_epoch() -
+        std::chrono::nanoseconds(enqueue_time));
+    }
 
     if (this->buffer_->has_data()) {
       // If there is data still to be processed, indicate to the
@@ -126,10 +165,8 @@ public:
     }
 
     return std::static_pointer_cast<void>(
-      std::make_shared<std::pair<ConstMessageSharedPtr, MessageUniquePtr>>(
-        std::pair<ConstMessageSharedPtr, MessageUniquePtr>(
-          shared_msg, std::move(unique_msg)))
-    );
+      rclcpp::detail::make_dispatch_shared<std::pair<ConstMessageSharedPtr, MessageUniquePtr>>(
+        shared_msg, std::move(unique_msg)));
   }
 
   void execute(std::shared_ptr<void> & data) override
@@ -161,7 +198,7 @@ protected:
     auto shared_ptr = std::static_pointer_cast<std::pair<ConstMessageSharedPtr, MessageUniquePtr>>(
       data);
 
-    if (any_callback_.use_take_shared_method()) {
+    if (take_shared_method_) {
       ConstMessageSharedPtr shared_msg = shared_ptr->first;
       any_callback_.dispatch_intra_process(shared_msg, msg_info);
     } else {
@@ -172,6 +209,9 @@ protected:
   }
 
   AnySubscriptionCallback<MessageT, Alloc> any_callback_;
+  // Whether messages are taken from the buffer as shared or unique pointers
+  const bool take_shared_method_;
+  BufferDwellTimeCallback buffer_dwell_time_callback_;
 };
 
 }  // namespace experimental
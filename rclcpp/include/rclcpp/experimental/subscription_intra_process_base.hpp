@@ -16,6 +16,9 @@
 #define RCLCPP__EXPERIMENTAL__SUBSCRIPTION_INTRA_PROCESS_BASE_HPP_
 
 #include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -23,6 +26,7 @@
 #include "rcl/wait.h"
 #include "rmw/impl/cpp/demangle.hpp"
 
+#include "rclcpp/content_filter.hpp"
 #include "rclcpp/guard_condition.hpp"
 #include "rclcpp/logging.hpp"
 #include "rclcpp/qos.hpp"
@@ -49,10 +53,13 @@ public:
     const std::string & topic_name,
     const rclcpp::QoS & qos_profile)
   : gc_(context), topic_name_(topic_name), qos_profile_(qos_profile)
-  {}
+  {
+    // Messages received before the next wait need a single trigger
+    gc_.set_trigger_coalescing(true);
+  }
 
   RCLCPP_PUBLIC
-  virtual ~SubscriptionIntraProcessBase() = default;
+  virtual ~SubscriptionIntraProcessBase();
 
   RCLCPP_PUBLIC
   size_t
@@ -67,6 +74,15 @@ public:
   size_t
   available_capacity() const = 0;
 
+  /// Get the number of messages the buffer dropped to make room for new ones.
+  RCLCPP_PUBLIC
+  virtual
+  uint64_t
+  get_dropped_count() const
+  {
+    return 0;
+  }
+
   bool
   is_ready(rcl_wait_set_t * wait_set) override = 0;
 
@@ -87,6 +103,15 @@ public:
   bool
   use_take_shared_method() const = 0;
 
+  /// Return true if the subscription takes serialized messages, e.g. for a GenericSubscription.
+  RCLCPP_PUBLIC
+  virtual
+  bool
+  is_serialized() const
+  {
+    return false;
+  }
+
   RCLCPP_PUBLIC
   const char *
   get_topic_name() const;
@@ -95,6 +120,58 @@ public:
   QoS
   get_actual_qos() const;
 
+  /// Set the content filter of the messages delivered to the subscription, nullptr for none.
+  /**
+   * The filter is evaluated by the intra process manager on the ROS messages published,
+   * before they are copied or shared with the subscription.
+   *
+   * This function is thread-safe.
+   */
+  RCLCPP_PUBLIC
+  void
+  set_content_filter(std::shared_ptr<const rclcpp::ContentFilter> content_filter);
+
+  /// Return true if the subscription has no content filter, or if the message passes it.
+  /**
+   * \param[in] ros_message pointer to a ROS message of the type of the subscription
+   */
+  RCLCPP_PUBLIC
+  bool
+  matches_content_filter(const void * ros_message) const;
+
+  /// Return true if any intra-process subscription of the process has a content filter.
+  /**
+   * Publishers check this first, so that they only evaluate filters when there are some.
+   */
+  RCLCPP_PUBLIC
+  static
+  bool
+  has_any_content_filter();
+
+  /// Let the subscription execute its new messages in the thread providing them.
+  /**
+   * For each new message, inline_executor is called in the thread providing it with a function
+   * executing the message. When it calls that function and returns true, the message was
+   * executed right away, before the publish call returns, instead of notifying the guard
+   * condition and the on ready callback of the subscription.
+   * The executor owning the subscription only calls it when the publishing thread is one of its
+   * own and executing the message there can't break the callback groups guarantees, starting
+   * and finishing the callback group of the subscription around the execution.
+   *
+   * A thread executing max_depth messages inline, e.g. because subscriptions republish the
+   * messages they receive, notifies the executor about the next ones instead.
+   * Exceptions thrown by the callback of the subscription then propagate to the publisher.
+   *
+   * This function is thread-safe.
+   *
+   * \param[in] inline_executor called for each new message, nullptr to disable it
+   * \param[in] max_depth maximum nesting of inline executions in a thread
+   */
+  RCLCPP_PUBLIC
+  void
+  set_inline_execution(
+    std::function<bool(const std::function<void()> &)> inline_executor, size_t max_depth);
+
   /// Set a callback to be called when each new message arrives.
   /**
    * The callback receives a size_t which is the number of messages received
@@ -185,6 +262,25 @@ protected:
   virtual void
   trigger_guard_condition() = 0;
 
+  /// Execute a new message inline if possible, see set_inline_execution().
+  /**
+   * \return false if the message wasn't executed, and the executor must be notified about it
+   */
+  RCLCPP_PUBLIC
+  bool
+  execute_inline();
+
+  /// Notify the executor about a new message added to the buffer, unless executed inline.
+  void
+  notify_new_message()
+  {
+    if (this->execute_inline()) {
+      return;
+    }
+    this->trigger_guard_condition();
+    this->invoke_on_new_message();
+  }
+
   void
   invoke_on_new_message()
   {
@@ -199,6 +295,12 @@ protected:
 private:
   std::string topic_name_;
   QoS qos_profile_;
+  // Whether inline_executor_ is set, to not lock callback_mutex_ for each message otherwise
+  std::atomic_bool inline_execution_enabled_{false};
+  std::function<bool(const std::function<void()> &)> inline_executor_;
+  size_t max_inline_depth_{0};
+  // Accessed with the atomic functions of shared pointers, as it can be set while publishing
+  std::shared_ptr<const rclcpp::ContentFilter> content_filter_;
 };
 
 }  // namespace experimental
@@ -15,6 +15,7 @@
 #ifndef RCLCPP__EXPERIMENTAL__SUBSCRIPTION_INTRA_PROCESS_BUFFER_HPP_
 #define RCLCPP__EXPERIMENTAL__SUBSCRIPTION_INTRA_PROCESS_BUFFER_HPP_
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <stdexcept>
@@ -126,12 +127,10 @@ public:
   {
     if constexpr (std::is_same<SubscribedType, ROSMessageType>::value) {
       buffer_->add_shared(std::move(message));
-      trigger_guard_condition();
     } else {
       buffer_->add_shared(convert_ros_message_to_subscribed_type_unique_ptr(*message));
-      trigger_guard_condition();
     }
-    this->invoke_on_new_message();
+    this->notify_new_message();
   }
 
   void
@@ -139,28 +138,51 @@ public:
   {
     if constexpr (std::is_same<SubscribedType, ROSMessageType>::value) {
       buffer_->add_unique(std::move(message));
-      trigger_guard_condition();
     } else {
       buffer_->add_unique(convert_ros_message_to_subscribed_type_unique_ptr(*message));
-      trigger_guard_condition();
     }
-    this->invoke_on_new_message();
+    this->notify_new_message();
   }
 
   void
   provide_intra_process_data(ConstDataSharedPtr message)
   {
     buffer_->add_shared(std::move(message));
-    trigger_guard_condition();
-    this->invoke_on_new_message();
+    this->notify_new_message();
   }
 
   void
   provide_intra_process_data(SubscribedTypeUniquePtr message)
   {
     buffer_->add_unique(std::move(message));
-    trigger_guard_condition();
-    this->invoke_on_new_message();
+    this->notify_new_message();
+  }
+
+  /// Get if the messages of publishers are read from their broadcast ring.
+  bool
+  uses_broadcast_ring() const
+  {
+    return buffer_->uses_broadcast_ring();
+  }
+
+  /// Notify a message written to the broadcast ring of a publisher, reading the ring if needed.
+  /**
+   * \param ring the broadcast ring of the publisher
+   * \param owner a pointer owning the ring
+   * \param sequence the sequence of the message in the ring
+   * \return `false` if the ring can't be read, the message must be provided instead
+   */
+  bool
+  provide_intra_process_broadcast(
+    const rclcpp::experimental::buffers::BroadcastRing<ConstDataSharedPtr> & ring,
+    const std::shared_ptr<const void> & owner,
+    uint64_t sequence)
+  {
+    if (!buffer_->attach_broadcast_ring(ring, owner, sequence)) {
+      return false;
+    }
+    this->notify_new_message();
+    return true;
   }
 
   bool
@@ -174,6 +196,11 @@ public:
     return buffer_->available_capacity();
   }
 
+  uint64_t get_dropped_count() const override
+  {
+    return buffer_->get_dropped_count();
+  }
+
 protected:
   void
   trigger_guard_condition() override
@@ -0,0 +1,151 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__EXPERIMENTAL__SUBSCRIPTION_INTRA_PROCESS_SERIALIZED_HPP_
+#define RCLCPP__EXPERIMENTAL__SUBSCRIPTION_INTRA_PROCESS_SERIALIZED_HPP_
+
+#include <rmw/types.h>
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "rclcpp/context.hpp"
+#include "rclcpp/detail/dispatch_arena.hpp"
+#include "rclcpp/experimental/subscription_intra_process_buffer.hpp"
+#include "rclcpp/message_info.hpp"
+#include "rclcpp/qos.hpp"
+#include "rclcpp/serialized_message.hpp"
+
+namespace rclcpp
+{
+namespace experimental
+{
+
+/// Intra-process subscription to serialized messages, used by rclcpp::GenericSubscription.
+/**
+ * It receives the serialized messages published by rclcpp::GenericPublisher in the same
+ * process, without going through the middleware.
+ * Callbacks taking views of the messages share them with the other subscriptions, while
+ * callbacks taking shared pointers to (mutable) messages get a message of their own.
+ */
+class SubscriptionIntraProcessSerialized
+  : public SubscriptionIntraProcessBuffer<
+    rclcpp::SerializedMessage,
+    std::allocator<rclcpp::SerializedMessage>,
+    std::default_delete<rclcpp::SerializedMessage>
+  >
+{
+  using SubscriptionIntraProcessBufferT = SubscriptionIntraProcessBuffer<
+    rclcpp::SerializedMessage,
+    std::allocator<rclcpp::SerializedMessage>,
+    std::default_delete<rclcpp::SerializedMessage>
+  >;
+
+public:
+  RCLCPP_SMART_PTR_DEFINITIONS(SubscriptionIntraProcessSerialized)
+
+  using ConstMessageSharedPtr = typename SubscriptionIntraProcessBufferT::ConstDataSharedPtr;
+  using MessageUniquePtr = typename SubscriptionIntraProcessBufferT::SubscribedTypeUniquePtr;
+
+  using Callback = std::function<void (std::shared_ptr<rclcpp::SerializedMessage>)>;
+  using ViewCallback = std::function<
+    void (const rclcpp::SerializedMessageView &, const rclcpp::MessageInfo &)>;
+
+  /// Constructor, exactly one of the callbacks is expected to be set.
+  SubscriptionIntraProcessSerialized(
+    Callback callback,
+    ViewCallback view_callback,
+    rclcpp::Context::SharedPtr context,
+    const std::string & topic_name,
+    const rclcpp::QoS & qos_profile,
+    rclcpp::IntraProcessBufferType buffer_type)
+  : SubscriptionIntraProcessBufferT(
+      std::make_shared<std::allocator<rclcpp::SerializedMessage>>(),
+      context,
+      topic_name,
+      qos_profile,
+      buffer_type),
+    callback_(std::move(callback)),
+    view_callback_(std::move(view_callback))
+  {}
+
+  virtual ~SubscriptionIntraProcessSerialized() = default;
+
+  bool
+  is_serialized() const override
+  {
+    return true;
+  }
+
+  std::shared_ptr<void>
+  take_data() override
+  {
+    ConstMessageSharedPtr shared_msg;
+    MessageUniquePtr unique_msg;
+
+    if (view_callback_) {
+      shared_msg = this->buffer_->consume_shared();
+      if (!shared_msg) {
+        return nullptr;
+      }
+    } else {
+      unique_msg = this->buffer_->consume_unique();
+      if (!unique_msg) {
+        return nullptr;
+      }
+    }
+
+    if (this->buffer_->has_data()) {
+      // If there is data still to be processed, indicate to the
+      // executor or waitset by triggering the guard condition.
+      this->trigger_guard_condition();
+    }
+
+    return std::static_pointer_cast<void>(
+      rclcpp::detail::make_dispatch_shared<std::pair<ConstMessageSharedPtr, MessageUniquePtr>>(
+        std::move(shared_msg), std::move(unique_msg)));
+  }
+
+  void
+  execute(std::shared_ptr<void> & data) override
+  {
+    if (!data) {
+      return;
+    }
+
+    rmw_message_info_t msg_info;
+    msg_info.publisher_gid = {0, {0}};
+    msg_info.from_intra_process = true;
+
+    auto messages =
+      std::static_pointer_cast<std::pair<ConstMessageSharedPtr, MessageUniquePtr>>(data);
+
+    if (view_callback_) {
+      view_callback_(rclcpp::SerializedMessageView(*messages->first), msg_info);
+    } else {
+      callback_(std::shared_ptr<rclcpp::SerializedMessage>(std::move(messages->second)));
+    }
+  }
+
+private:
+  Callback callback_;
+  ViewCallback view_callback_;
+};
+
+}  // namespace experimental
+}  // namespace rclcpp
+
+#endif  // RCLCPP__EXPERIMENTAL__SUBSCRIPTION_INTRA_PROCESS_SERIALIZED_HPP_
@@ -0,0 +1,282 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__EXPERIMENTAL__SYNCHRONIZED_SUBSCRIPTION_HPP_
+#define RCLCPP__EXPERIMENTAL__SYNCHRONIZED_SUBSCRIPTION_HPP_
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "rclcpp/create_subscription.hpp"
+#include "rclcpp/macros.hpp"
+#include "rclcpp/qos.hpp"
+#include "rclcpp/subscription.hpp"
+#include "rclcpp/subscription_options.hpp"
+#include "rclcpp/time.hpp"
+#include "rclcpp/visibility_control.hpp"
+
+namespace rclcpp
+{
+namespace experimental
+{
+
+/// How the messages of the topics of a SynchronizedSubscription are matched.
+enum class SyncPolicy
+{
+  /// Match messages which have the same stamp.
+  ExactTime,
+  /// Match the messages closest to the latest stamp among the oldest messages of the topics.
+  ApproximateTime,
+};
+
+/// Options of a SynchronizedSubscription.
+struct SynchronizedSubscriptionOptions
+{
+  SyncPolicy policy = SyncPolicy::ApproximateTime;
+
+  /// Maximum number of unmatched messages kept for each topic, the oldest are dropped first.
+  size_t queue_size = 10;
+
+  /// Maximum difference between the stamps of matched messages, for ApproximateTime only.
+  std::chrono::nanoseconds max_interval = std::chrono::nanoseconds::max();
+
+  /// Options of the subscriptions to each topic.
+  rclcpp::SubscriptionOptions subscription_options;
+};
+
+/// Get the stamp used to synchronize a message, the stamp of its header by default.
+/**
+ * Specialize it for message types without header, with a static `get()` function returning
+ * the stamp as a rclcpp::Time.
+ */
+template<typename MessageT, typename Enable = void>
+struct MessageStamp
+{
+  static rclcpp::Time
+  get(const MessageT & message)
+  {
+    return rclcpp::Time(message.header.stamp);
+  }
+};
+
+namespace detail
+{
+
+/// Type erased matching of the messages of a SynchronizedSubscription, not thread-safe.
+class StampMatcher
+{
+public:
+  /// Messages of a match, in topic order.
+  using Match = std::vector<std::shared_ptr<const void>>;
+
+  /**
+   * \throws std::invalid_argument if there are less than two topics, if the queue size is
+   *   zero, or if the maximum interval is negative
+   */
+  RCLCPP_PUBLIC
+  StampMatcher(size_t number_of_topics, const SynchronizedSubscriptionOptions & options);
+
+  /// Queue a message, and return the matches it completes, oldest first.
+  /**
+   * A message older than the previous message of its topic is dropped.
+   */
+  RCLCPP_PUBLIC
+  std::vector<Match>
+  add(size_t topic, int64_t stamp, std::shared_ptr<const void> message);
+
+  /// Get the number of messages dropped without being part of a match.
+  RCLCPP_PUBLIC
+  uint64_t
+  get_dropped_count() const;
+
+private:
+  struct Entry
+  {
+    int64_t stamp;
+    std::shared_ptr<const void> message;
+  };
+
+  bool
+  match_exact_time(Match & match);
+
+  bool
+  match_approximate_time(Match & match);
+
+  // Drop the given number of oldest messages of a topic
+  void
+  drop(size_t topic, size_t count);
+
+  // Move the oldest message of each topic into the match
+  void
+  take_oldest(Match & match);
+
+  const SyncPolicy policy_;
+  const size_t queue_size_;
+  const int64_t max_interval_ns_;
+  std::vector<std::deque<Entry>> queues_;
+  uint64_t dropped_count_{0};
+};
+
+}  // namespace detail
+
+/// Subscription to several topics, calling a single callback with their matching messages.
+/**
+ * Messages are matched by stamp, see MessageStamp, as soon as they're received: they are
+ * kept as shared pointers, so intra-process messages aren't copied, and each match is
+ * delivered with one call of the callback.
+ *
+ * Messages are expected in stamp order on each topic.
+ * Matches are delivered in order, unless the subscriptions are in a reentrant callback group.
+ */
+template<typename ... MessageTs>
+class SynchronizedSubscription
+{
+  static_assert(sizeof...(MessageTs) >= 2, "at least two topics must be synchronized");
+
+public:
+  RCLCPP_SMART_PTR_DEFINITIONS_NOT_COPYABLE(SynchronizedSubscription)
+
+  static constexpr size_t number_of_topics = sizeof...(MessageTs);
+
+  using Callback = std::function<void (std::shared_ptr<const MessageTs>...)>;
+
+  /// Subscribe to the topics.
+  /**
+   * \param[in] node the node creating the subscriptions
+   * \param[in] topic_names the topic of each message type
+   * \param[in] qos the QoS of the subscriptions
+   * \param[in] callback the callback called with each match
+   * \param[in] options the options of the synchronization and of the subscriptions
+   * \throws std::invalid_argument if the options are invalid
+   */
+  template<typename NodeT>
+  SynchronizedSubscription(
+    NodeT && node,
+    const std::array<std::string, number_of_topics> & topic_names,
+    const rclcpp::QoS & qos,
+    Callback callback,
+    const SynchronizedSubscriptionOptions & options = SynchronizedSubscriptionOptions())
+  : state_(std::make_shared<State>(options, std::move(callback)))
+  {
+    create_subscriptions(
+      node, topic_names, qos, options.subscription_options,
+      std::index_sequence_for<MessageTs...>());
+  }
+
+  /// Get the subscriptions, in topic order.
+  const std::array<rclcpp::SubscriptionBase::SharedPtr, number_of_topics> &
+  get_subscriptions() const
+  {
+    return subscriptions_;
+  }
+
+  /// Get the number of messages dropped without being matched.
+  uint64_t
+  get_dropped_count() const
+  {
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    return state_->matcher.get_dropped_count();
+  }
+
+private:
+  // Shared with the subscription callbacks, which may still run after this is destroyed
+  struct State
+  {
+    State(const SynchronizedSubscriptionOptions & options, Callback callback)
+    : matcher(number_of_topics, options), callback(std::move(callback))
+    {}
+
+    std::mutex mutex;
+    detail::StampMatcher matcher;
+    Callback callback;
+  };
+
+  template<typename NodeT, size_t ... Is>
+  void
+  create_subscriptions(
+    NodeT & node,
+    const std::array<std::string, number_of_topics> & topic_names,
+    const rclcpp::QoS & qos,
+    const rclcpp::SubscriptionOptions & options,
+    std::index_sequence<Is...>)
+  {
+    ((subscriptions_[Is] = create_topic_subscription<Is, MessageTs>(
+      node, topic_names[Is], qos, options)), ...);
+  }
+
+  template<size_t TopicIndex, typename MessageT, typename NodeT>
+  rclcpp::SubscriptionBase::SharedPtr
+  create_topic_subscription(
+    NodeT & node,
+    const std::string & topic_name,
+    const rclcpp::QoS & qos,
+    const rclcpp::SubscriptionOptions & options)
+  {
+    return rclcpp::create_subscription<MessageT>(
+      node, topic_name, qos,
+      [state = state_](std::shared_ptr<const MessageT> message) {
+        const int64_t stamp = MessageStamp<MessageT>::get(*message).nanoseconds();
+        std::vector<detail::StampMatcher::Match> matches;
+        {
+          std::lock_guard<std::mutex> lock(state->mutex);
+          matches = state->matcher.add(TopicIndex, stamp, std::move(message));
+        }
+        for (const auto & match : matches) {
+          call(state->callback, match, std::index_sequence_for<MessageTs...>());
+        }
+      },
+      options);
+  }
+
+  template<size_t ... Is>
+  static void
+  call(
+    const Callback & callback,
+    const detail::StampMatcher::Match & match,
+    std::index_sequence<Is...>)
+  {
+    callback(std::static_pointer_cast<const MessageTs>(match[Is])...);
+  }
+
+  std::shared_ptr<State> state_;
+  std::array<rclcpp::SubscriptionBase::SharedPtr, number_of_topics> subscriptions_;
+};
+
+/// Create a SynchronizedSubscription, see its constructor.
+template<typename ... MessageTs, typename NodeT>
+typename SynchronizedSubscription<MessageTs...>::SharedPtr
+create_synchronized_subscription(
+  NodeT && node,
+  const std::array<std::string, sizeof...(MessageTs)> & topic_names,
+  const rclcpp::QoS & qos,
+  typename SynchronizedSubscription<MessageTs...>::Callback callback,
+  const SynchronizedSubscriptionOptions & options = SynchronizedSubscriptionOptions())
+{
+  return std::make_shared<SynchronizedSubscription<MessageTs...>>(
+    std::forward<NodeT>(node), topic_names, qos, std::move(callback), options);
+}
+
+}  // namespace experimental
+}  // namespace rclcpp
+
+#endif  // RCLCPP__EXPERIMENTAL__SYNCHRONIZED_SUBSCRIPTION_HPP_
@@ -27,6 +27,7 @@
 #include <vector>
 
 #include "rclcpp/context.hpp"
+#include "rclcpp/experimental/timing_wheel.hpp"
 #include "rclcpp/timer.hpp"
 
 namespace rclcpp
@@ -34,6 +35,17 @@ namespace rclcpp
 namespace experimental
 {
 
+/// Data structure used by the TimersManager to keep timers ordered by trigger time.
+enum class TimersStorageType
+{
+  /// Binary heap, inserting, removing and resetting a timer require to reorder the heap.
+  Heap,
+  /// Hierarchical timing wheel, see rclcpp::experimental::TimingWheel.
+  /// Inserting, removing and resetting a timer are constant time operations, which scales
+  /// better with thousands of timers, at the cost of detecting timers up to 1ms late.
+  TimingWheel,
+};
+
 /**
  * @brief This class provides a way for storing and executing timer objects.
  * It provides APIs to suit the needs of different applications and execution models.
@@ -43,10 +55,12 @@ namespace experimental
  * This class provides APIs to add/remove timers to/from an internal storage.
  * It keeps a list of weak pointers from added timers, and locks them only when
  * they need to be executed or modified.
- * Timers are kept ordered in a binary-heap priority queue.
+ * Timers are kept ordered in a binary-heap priority queue by default.
  * Calls to add/remove APIs will temporarily block the execution of the timers and
  * will require to reorder the internal priority queue.
  * Because of this, they have a not-negligible impact on the performance.
+ * Applications with many timers can store them in a timing wheel instead, see
+ * TimersStorageType.
  *
  * Timers execution
  * The most efficient use of this class consists in letting a TimersManager object
@@ -82,11 +96,13 @@ public:
    * or `execute_ready_timer`) without the TimersManager being `running`, i.e.
    * without actually explicitly waiting for the timer to become ready, will ignore this
    * callback.
+   * @param storage_type The data structure used to store the timers.
    */
   RCLCPP_PUBLIC
   TimersManager(
     std::shared_ptr<rclcpp::Context> context,
-    std::function<void(const rclcpp::TimerBase *)> on_ready_callback = nullptr);
+    std::function<void(const rclcpp::TimerBase *)> on_ready_callback = nullptr,
+    TimersStorageType storage_type = TimersStorageType::Heap);
 
   /**
    * @brief Destruct the TimersManager object making sure to stop thread and release memory.
@@ -157,6 +173,17 @@ public:
   RCLCPP_PUBLIC
   bool execute_head_timer();
 
+  /**
+   * @brief Executes the timers that are ready, or calls the on_ready_callback for them.
+   * This function is thread safe.
+   * This allows a thread waiting for the head timeout to handle the timers, instead of the
+   * timers thread.
+   *
+   * @throws std::runtime_error if the timers thread was already running.
+   */
+  RCLCPP_PUBLIC
+  void execute_ready_timers();
+
   /**
    * @brief Executes timer identified by its ID.
    * This function is thread safe.
@@ -180,6 +207,17 @@ public:
   RCLCPP_PUBLIC
   std::chrono::nanoseconds get_head_timeout();
 
+  /**
+   * @brief Set a callback invoked when the head timeout may have changed.
+   * It's invoked when a timer is added, removed or reset, so that a thread waiting for the
+   * head timeout without the timers thread can re-compute it.
+   * The callback is invoked without holding the internal mutex, and must not block.
+   *
+   * @param callback the callback, or nullptr to remove it.
+   */
+  RCLCPP_PUBLIC
+  void set_on_timers_updated_callback(std::function<void()> callback);
+
 private:
   RCLCPP_DISABLE_COPY(TimersManager)
 
@@ -441,6 +479,23 @@ public:
       return ready_timers;
     }
 
+    /**
+     * @brief Get the timers which aren't ready, but expire within their slack.
+     * @return the timers, in heap order.
+     */
+    std::vector<TimerPtr> get_timers_within_slack() const
+    {
+      std::vector<TimerPtr> timers;
+      for (const TimerPtr & t : owned_heap_) {
+        if (t->get_slack() > std::chrono::nanoseconds::zero() && !t->is_ready() &&
+          t->is_ready_within_slack())
+        {
+          timers.push_back(t);
+        }
+      }
+      return timers;
+    }
+
     /**
     * @brief Restore a valid heap after the root value has been replaced (e.g. timer triggered).
     */
@@ -526,6 +581,21 @@ private:
    */
   void execute_ready_timers_unsafe();
 
+  /**
+   * @brief Executes the ready timers stored in the timing wheel.
+   * @param max_timers maximum number of timers to execute.
+   * @param use_on_ready_callback whether to call the on_ready_callback instead of the timers.
+   * @return size_t number of executed timers.
+   * This function is not thread safe, acquire the timers_mutex_ before calling it.
+   */
+  size_t execute_timing_wheel_timers_unsafe(size_t max_timers, bool use_on_ready_callback);
+
+  /**
+   * @brief Wake the timers thread and invoke the on_timers_updated_callback, if any.
+   * Don't hold the timers_mutex_ when calling it.
+   */
+  void notify_timers_updated();
+
   // Callback to be called when timer is ready
   std::function<void(const rclcpp::TimerBase *)> on_ready_callback_;
 
@@ -537,6 +607,8 @@ private:
   std::mutex stop_mutex_;
   // Notifies the timers thread whenever timers are added/removed
   std::condition_variable timers_cv_;
+  // Callback invoked whenever timers are added/removed/reset, protected by timers_mutex_
+  std::function<void()> on_timers_updated_callback_;
   // Flag used as predicate by timers_cv_ that denotes one or more timers being added/removed
   bool timers_updated_ {false};
   // Indicates whether the timers thread is currently running or not
@@ -545,6 +617,8 @@ private:
   std::shared_ptr<rclcpp::Context> context_;
   // Timers heap storage with weak ownership
   WeakTimersHeap weak_timers_heap_;
+  // Timing wheel storage with weak ownership, used instead of the heap if not null
+  std::unique_ptr<TimingWheel> timing_wheel_;
 };
 
 }  // namespace experimental
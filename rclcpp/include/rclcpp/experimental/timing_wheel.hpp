@@ -0,0 +1,197 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__EXPERIMENTAL__TIMING_WHEEL_HPP_
+#define RCLCPP__EXPERIMENTAL__TIMING_WHEEL_HPP_
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+#include "rclcpp/macros.hpp"
+#include "rclcpp/timer.hpp"
+#include "rclcpp/visibility_control.hpp"
+
+namespace rclcpp
+{
+namespace experimental
+{
+
+/**
+ * @brief This class stores weak pointers to timers in a hierarchical timing wheel.
+ * Time is divided in ticks of a fixed resolution, and each timer is stored in the slot of the
+ * tick when it's expected to trigger.
+ * Slots are organized in levels of increasing granularity: the first level covers the
+ * next 256 ticks, each of the following levels covers 256 times the range of the previous one,
+ * and its slots are moved to the lower levels as time advances.
+ *
+ * Adding, removing and re-scheduling a timer (e.g. after it has been reset or called) are
+ * constant time operations, while a binary heap requires to reorder the timers.
+ * The trigger time of the timers is always double checked against the timers themselves
+ * before reporting them as ready, so timers using a clock other than the steady clock are
+ * still handled correctly, but they may be re-scheduled multiple times.
+ *
+ * This class is not thread safe and requires external mutexes to protect its usage.
+ */
+class TimingWheel
+{
+public:
+  RCLCPP_SMART_PTR_DEFINITIONS_NOT_COPYABLE(TimingWheel)
+
+  using TimerPtr = rclcpp::TimerBase::SharedPtr;
+
+  /**
+   * @brief Construct a new empty timing wheel.
+   * @param resolution duration of a tick, timers are never reported as ready before their
+   * trigger time, but they may be reported up to a tick late.
+   * @throws std::invalid_argument if resolution is not positive.
+   */
+  RCLCPP_PUBLIC
+  explicit TimingWheel(
+    std::chrono::nanoseconds resolution = std::chrono::milliseconds(1));
+
+  /**
+   * @brief Add a new timer, scheduling it according to its time until trigger.
+   * @param timer new timer to add.
+   * @return true if timer has been added, false if it was already there.
+   */
+  RCLCPP_PUBLIC
+  bool add_timer(const TimerPtr & timer);
+
+  /**
+   * @brief Remove a timer.
+   * @param timer_id the ID of the timer to remove.
+   * @return true if timer has been removed, false if it was not there.
+   */
+  RCLCPP_PUBLIC
+  bool remove_timer(const rclcpp::TimerBase * timer_id);
+
+  /**
+   * @brief Schedule again a timer whose trigger time changed, e.g. after it has been reset,
+   * or after it has been called if it was returned by take_ready_timers().
+   * Does nothing if the timer is not stored here.
+   * @param timer_id the ID of the timer to schedule.
+   */
+  RCLCPP_PUBLIC
+  void reschedule(const rclcpp::TimerBase * timer_id);
+
+  /**
+   * @brief Retrieve the timer identified by the key
+   * @param timer_id The ID of the timer to retrieve.
+   * @return TimerPtr if there's a timer associated with the ID, nullptr otherwise
+   */
+  RCLCPP_PUBLIC
+  TimerPtr get_timer(const rclcpp::TimerBase * timer_id) const;
+
+  /**
+   * @brief Take the timers that are ready, in trigger order.
+   * Taken timers are not scheduled anymore until reschedule() is called for them,
+   * which is usually done after calling them.
+   * Timers that went out of scope are removed.
+   * @param max_timers maximum number of timers to take.
+   * @return the ready timers.
+   */
+  RCLCPP_PUBLIC
+  std::vector<TimerPtr> take_ready_timers(
+    size_t max_timers = std::numeric_limits<size_t>::max());
+
+  /**
+   * @brief Get the amount of time before the next timer may trigger.
+   * The returned value is a lower bound, if it expires no timer may be ready yet.
+   * @return std::chrono::nanoseconds to wait, zero if some timers are already expired
+   * or std::chrono::nanoseconds::max() if no timer is scheduled.
+   */
+  RCLCPP_PUBLIC
+  std::chrono::nanoseconds get_head_timeout();
+
+  /**
+   * @brief Get the number of timers that are currently ready.
+   * @return size_t number of ready timers.
+   */
+  RCLCPP_PUBLIC
+  size_t get_number_ready_timers() const;
+
+  /**
+   * @brief Get all the stored timers that are still valid.
+   */
+  RCLCPP_PUBLIC
+  std::vector<TimerPtr> get_timers() const;
+
+  /**
+   * @brief Returns the number of stored timers.
+   */
+  RCLCPP_PUBLIC
+  size_t size() const;
+
+  /**
+   * @brief Remove all timers.
+   */
+  RCLCPP_PUBLIC
+  void clear();
+
+private:
+  static constexpr size_t kSlotBits = 8;
+  static constexpr size_t kSlotsPerLevel = 1u << kSlotBits;
+  static constexpr size_t kNumberOfLevels = 4;
+
+  using Slot = std::list<const rclcpp::TimerBase *>;
+
+  struct Entry
+  {
+    rclcpp::TimerBase::WeakPtr timer;
+    uint64_t expiry_tick = 0;
+    // The slot holding the timer, nullptr if the timer is not scheduled
+    Slot * slot = nullptr;
+    Slot::iterator position;
+  };
+
+  /// Get the tick corresponding to the current time
+  uint64_t now_tick() const;
+
+  /// Schedule the timer according to its time until trigger, at least min_ticks from now
+  void schedule(const rclcpp::TimerBase * timer_id, Entry & entry, uint64_t min_ticks = 0);
+
+  /// Store the timer in the slot of the given tick
+  void place(const rclcpp::TimerBase * timer_id, Entry & entry, uint64_t expiry_tick);
+
+  /// Remove the timer from its slot, if any
+  void unlink(Entry & entry);
+
+  /// Move time forward, up to the given tick, moving the expired timers into expired_
+  void advance(uint64_t target_tick);
+
+  /// Move the timers of a slot of a higher level to the lower levels
+  void cascade(size_t level, size_t index);
+
+  std::chrono::steady_clock::time_point start_time_;
+  std::chrono::nanoseconds resolution_;
+  uint64_t current_tick_ {0};
+
+  std::array<std::array<Slot, kSlotsPerLevel>, kNumberOfLevels> levels_;
+  // Number of timers stored in levels_
+  size_t timers_in_levels_ {0};
+  // Timers whose tick has already passed, in trigger order
+  Slot expired_;
+
+  std::unordered_map<const rclcpp::TimerBase *, Entry> entries_;
+};
+
+}  // namespace experimental
+}  // namespace rclcpp
+
+#endif  // RCLCPP__EXPERIMENTAL__TIMING_WHEEL_HPP_
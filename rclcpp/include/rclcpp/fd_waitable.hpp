@@ -0,0 +1,181 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__FD_WAITABLE_HPP_
+#define RCLCPP__FD_WAITABLE_HPP_
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "rcl/wait.h"
+
+#include "rclcpp/context.hpp"
+#include "rclcpp/guard_condition.hpp"
+#include "rclcpp/macros.hpp"
+#include "rclcpp/visibility_control.hpp"
+#include "rclcpp/waitable.hpp"
+
+namespace rclcpp
+{
+
+/// Waitable executing a callback when a POSIX file descriptor is ready.
+/**
+ * It lets device I/O, e.g. on sockets, CAN or serial ports, be done by the executor threads:
+ * the callback is called by the executor of the callback group the waitable was added to,
+ * with the file descriptor, which it reads or writes itself.
+ *
+ * rcl wait sets can't wait on file descriptors, so the readiness is polled by a thread of
+ * the waitable, which only notifies the executor.
+ * Readiness isn't polled again until the callback is called, so the callback should read
+ * or write until the file descriptor would block, or the callback is called right away again.
+ *
+ * The waitable must be destroyed before the file descriptor is closed.
+ * It isn't supported on Windows, where the constructor throws.
+ *
+ * It's added to a node with:
+ *
+ * ```cpp
+ * auto waitable = std::make_shared<rclcpp::FdWaitable>(
+ *   node->get_node_base_interface()->get_context(), fd, rclcpp::FdWaitable::Direction::Read,
+ *   [](int fd) {...});
+ * node->get_node_waitables_interface()->add_waitable(waitable, callback_group);
+ * ```
+ */
+class FdWaitable : public rclcpp::Waitable
+{
+public:
+  RCLCPP_SMART_PTR_DEFINITIONS_NOT_COPYABLE(FdWaitable)
+
+  using Callback = std::function<void (int fd)>;
+
+  /// Readiness of the file descriptor for which the callback is called.
+  enum class Direction
+  {
+    /// Data can be read, or the peer closed the file descriptor.
+    Read,
+    /// Data can be written.
+    Write,
+  };
+
+  enum class EntityType : std::size_t
+  {
+    FileDescriptor,
+  };
+
+  /// Constructor.
+  /**
+   * \param[in] context the context of the executors the waitable is added to
+   * \param[in] fd the file descriptor, which isn't closed by the waitable
+   * \param[in] direction the readiness for which the callback is called
+   * \param[in] callback called by the executor with the file descriptor once it's ready
+   * \throws std::invalid_argument if fd is negative or the callback isn't callable
+   * \throws std::runtime_error if the polling thread can't be started, or on Windows
+   */
+  RCLCPP_PUBLIC
+  FdWaitable(
+    rclcpp::Context::SharedPtr context,
+    int fd,
+    Direction direction,
+    Callback callback);
+
+  RCLCPP_PUBLIC
+  virtual ~FdWaitable();
+
+  /// Get the file descriptor.
+  RCLCPP_PUBLIC
+  int
+  get_fd() const;
+
+  RCLCPP_PUBLIC
+  size_t
+  get_number_of_ready_guard_conditions() override {return 1;}
+
+  RCLCPP_PUBLIC
+  void
+  add_to_wait_set(rcl_wait_set_t * wait_set) override;
+
+  RCLCPP_PUBLIC
+  bool
+  is_ready(rcl_wait_set_t * wait_set) override;
+
+  RCLCPP_PUBLIC
+  std::shared_ptr<void>
+  take_data() override;
+
+  RCLCPP_PUBLIC
+  std::shared_ptr<void>
+  take_data_by_entity_id(size_t id) override;
+
+  RCLCPP_PUBLIC
+  void
+  execute(std::shared_ptr<void> & data) override;
+
+  /// Set a callback to be called each time the file descriptor becomes ready.
+  /**
+   * The callback receives the number of times the file descriptor became ready since it was
+   * last called, and the identifier of the file descriptor entity.
+   * Readiness before the callback was set is reported when it's set.
+   *
+   * \param[in] callback functor to be called when the file descriptor is ready
+   * \throws std::invalid_argument if the callback isn't callable
+   */
+  RCLCPP_PUBLIC
+  void
+  set_on_ready_callback(std::function<void(size_t, int)> callback) override;
+
+  /// Unset the callback set with set_on_ready_callback(), if any.
+  RCLCPP_PUBLIC
+  void
+  clear_on_ready_callback() override;
+
+private:
+  /// Poll the file descriptor each time it's armed, until the waitable is destroyed.
+  void
+  watch();
+
+  /// Poll the file descriptor again, once the callback was called.
+  void
+  arm();
+
+  int fd_;
+  Direction direction_;
+  Callback callback_;
+
+  rclcpp::GuardCondition gc_;
+  // Set by the polling thread when the file descriptor is ready, reset when it's taken
+  std::atomic_bool ready_{false};
+  // Returned by take_data(), so that nothing is allocated for each readiness
+  std::shared_ptr<int> fd_data_;
+
+  // Lock for the members below, waited on by the polling thread
+  std::mutex mutex_;
+  std::condition_variable armed_cv_;
+  bool armed_{true};
+  bool stop_{false};
+  // Pipe waking the polling thread up when the waitable is destroyed
+  int wake_fds_[2]{-1, -1};
+  std::thread thread_;
+
+  std::recursive_mutex callback_mutex_;
+  std::function<void(size_t)> on_ready_callback_{nullptr};
+  size_t unread_count_{0};
+};
+
+}  // namespace rclcpp
+
+#endif  // RCLCPP__FD_WAITABLE_HPP_
@@ -0,0 +1,164 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__FLIGHT_RECORDER_HPP_
+#define RCLCPP__FLIGHT_RECORDER_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "rclcpp/callback_statistics.hpp"
+#include "rclcpp/macros.hpp"
+#include "rclcpp/visibility_control.hpp"
+
+namespace rclcpp
+{
+
+/// Record of the last callbacks executed by each thread of an executor.
+/**
+ * Each thread starting callbacks gets a ring of records the first time it records one,
+ * in which the oldest records are overwritten, so that the recorder keeps the recent history
+ * of the executor for post-mortem analysis at a constant memory cost.
+ * Recording doesn't lock nor allocate once the ring of the thread exists: it's a clock
+ * reading and a few relaxed stores when the callback starts, and again when it returns.
+ *
+ * Callbacks are recorded when they start, so that the one which was executing when the
+ * process crashed or hung is part of the records, with a negative duration.
+ * The records can be read at any time with get_records(), or written to a file descriptor
+ * with write(), which is async-signal-safe.
+ * \sa rclcpp::ExecutorOptions::flight_recorder_size
+ * \sa write_on_signal()
+ */
+class FlightRecorder
+{
+  struct ThreadRing;
+
+public:
+  RCLCPP_SMART_PTR_DEFINITIONS_NOT_COPYABLE(FlightRecorder)
+
+  using EntityType = rclcpp::CallbackStatistics::EntityType;
+
+  /// One callback started by one of the threads.
+  struct Record
+  {
+    /// Kind of the entity whose callback was executed.
+    EntityType entity_type;
+    /// Address of the entity, e.g. of a rclcpp::SubscriptionBase, to tell entities apart.
+    const void * entity;
+    /// Index of the thread, in the order in which the threads recorded their first callback.
+    size_t thread_index;
+    /// Time when the callback started.
+    std::chrono::steady_clock::time_point start_time;
+    /// Time spent in the callback, negative if it didn't return (yet).
+    std::chrono::nanoseconds duration;
+  };
+
+  /// Callback started with start(), to pass to end() once it returns.
+  class Token
+  {
+    friend class FlightRecorder;
+
+    ThreadRing * ring_ = nullptr;
+    uint64_t index_ = 0;
+    int64_t start_ns_ = 0;
+  };
+
+  /// Create a recorder keeping the given number of records per thread.
+  /**
+   * \param[in] records_per_thread size of the ring of each thread
+   * \throws std::invalid_argument if records_per_thread is 0
+   */
+  RCLCPP_PUBLIC
+  explicit FlightRecorder(size_t records_per_thread);
+
+  RCLCPP_PUBLIC
+  ~FlightRecorder();
+
+  /// Record the start of a callback in the ring of the calling thread.
+  /**
+   * The first call in a thread allocates its ring, which may throw std::bad_alloc.
+   * \param[in] entity_type kind of the entity whose callback starts
+   * \param[in] entity address of the entity
+   * \return the token to pass to end() once the callback returns
+   */
+  RCLCPP_PUBLIC
+  Token
+  start(EntityType entity_type, const void * entity);
+
+  /// Record the duration of a callback, from the thread which started it.
+  /**
+   * Nothing is recorded for a default constructed token, or if the record was overwritten
+   * meanwhile, e.g. by the callbacks of a nested spin.
+   */
+  RCLCPP_PUBLIC
+  void
+  end(const Token & token) noexcept;
+
+  /// Get a copy of the records of all the threads, sorted by start time.
+  /**
+   * Records being overwritten while they are copied are left out.
+   */
+  RCLCPP_PUBLIC
+  std::vector<Record>
+  get_records() const;
+
+  /// Get the number of records kept per thread.
+  RCLCPP_PUBLIC
+  size_t
+  get_records_per_thread() const;
+
+  /// Write the records in text, one line per record, from the oldest to the newest per thread.
+  /**
+   * This doesn't lock nor allocate, so it can be called from a signal handler.
+   * \param[in] fd file descriptor to write to
+   * \return false if writing failed
+   */
+  RCLCPP_PUBLIC
+  bool
+  write(int fd) const noexcept;
+
+  /// Write the records of all the existing recorders to a file descriptor on a signal.
+  /**
+   * The handler of the signal is replaced.
+   * For the signals of a crash, i.e. SIGSEGV, SIGBUS, SIGILL, SIGFPE and SIGABRT, the records
+   * are written and the signal is raised again with its default action.
+   * Other signals, e.g. SIGUSR1, write the records on demand and the process continues.
+   * At most 16 recorders are written, the first ones created among the existing ones.
+   *
+   * \param[in] signal the signal on which to write the records
+   * \param[in] fd the file descriptor to write to, the same for all the signals
+   * \return false if the handler couldn't be installed, always on Windows
+   */
+  RCLCPP_PUBLIC
+  static bool
+  write_on_signal(int signal, int fd = 2);
+
+private:
+  ThreadRing *
+  get_thread_ring();
+
+  /// Unique among all the recorders ever created, to find the rings of the thread.
+  const uint64_t id_;
+  const size_t records_per_thread_;
+  /// Rings of the threads, only ever pushed to until destruction.
+  std::atomic<ThreadRing *> rings_ {nullptr};
+  std::atomic<size_t> thread_count_ {0};
+};
+
+}  // namespace rclcpp
+
+#endif  // RCLCPP__FLIGHT_RECORDER_HPP_
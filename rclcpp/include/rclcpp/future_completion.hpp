@@ -0,0 +1,63 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__FUTURE_COMPLETION_HPP_
+#define RCLCPP__FUTURE_COMPLETION_HPP_
+
+#include <memory>
+
+#include "rclcpp/guard_condition.hpp"
+#include "rclcpp/visibility_control.hpp"
+
+namespace rclcpp
+{
+
+/// Wake the executors waiting for a future in spin_until_future_complete().
+/**
+ * This is called by rclcpp once it completed the futures it returned, e.g. the responses
+ * of a Client, so that an executor spinning until such a future completes returns right
+ * away, even if the future was completed by another thread.
+ * Code completing its own promises may call it too, right after setting their value.
+ *
+ * Every executor waiting in spin_until_future_complete() checks its future again, so this
+ * is cheap while none is, but shouldn't be called when no future was completed.
+ */
+RCLCPP_PUBLIC
+void
+notify_future_completion();
+
+namespace detail
+{
+
+/// Trigger a guard condition on notify_future_completion(), while this object exists.
+class FutureCompletionListener
+{
+public:
+  RCLCPP_PUBLIC
+  explicit FutureCompletionListener(std::shared_ptr<rclcpp::GuardCondition> guard_condition);
+
+  RCLCPP_PUBLIC
+  ~FutureCompletionListener();
+
+  FutureCompletionListener(const FutureCompletionListener &) = delete;
+  FutureCompletionListener & operator=(const FutureCompletionListener &) = delete;
+
+private:
+  std::shared_ptr<rclcpp::GuardCondition> guard_condition_;
+};
+
+}  // namespace detail
+}  // namespace rclcpp
+
+#endif  // RCLCPP__FUTURE_COMPLETION_HPP_
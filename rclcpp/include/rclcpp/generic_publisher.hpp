@@ -18,16 +18,20 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "rcpputils/shared_library.hpp"
 
 #include "rclcpp/callback_group.hpp"
+#include "rclcpp/detail/resolve_use_intra_process.hpp"
 #include "rclcpp/macros.hpp"
 #include "rclcpp/node_interfaces/node_base_interface.hpp"
 #include "rclcpp/node_interfaces/node_topics_interface.hpp"
 #include "rclcpp/publisher_base.hpp"
 #include "rclcpp/qos.hpp"
 #include "rclcpp/serialized_message.hpp"
+#include "rclcpp/serialized_message_codec.hpp"
+#include "rclcpp/serialized_message_pool.hpp"
 #include "rclcpp/typesupport_helpers.hpp"
 #include "rclcpp/visibility_control.hpp"
 
@@ -41,7 +45,8 @@ namespace rclcpp
  * Since the type is not known at compile time, this is not a template, and the dynamic library
  * containing type support information has to be identified and loaded based on the type name.
  *
- * It does not support intra-process handling.
+ * Intra-process communication is only done with rclcpp::GenericSubscription, and only when
+ * the %QoS settings allow it, otherwise the messages go through the middleware.
  */
 class GenericPublisher : public rclcpp::PublisherBase
 {
@@ -64,7 +69,8 @@ public:
    * \param qos %QoS settings
    * \param options %Publisher options.
    * Not all publisher options are currently respected, the only relevant options for this
-   * publisher are `event_callbacks`, `use_default_callbacks`, and `%callback_group`.
+   * publisher are `event_callbacks`, `use_default_callbacks`, `use_intra_process_comm`,
+   * `topic_stats_options`, `payload_codec` and `%callback_group`.
    */
   template<typename AllocatorT = std::allocator<void>>
   GenericPublisher(
@@ -82,28 +88,98 @@ public:
       // NOTE(methylDragon): Passing these args separately is necessary for event binding
       options.event_callbacks,
       options.use_default_callbacks),
-    ts_lib_(ts_lib)
-  {}
+    ts_lib_(ts_lib),
+    payload_codec_(options.payload_codec),
+    serialized_message_pool_(std::make_shared<rclcpp::SerializedMessagePool>())
+  {
+    if (payload_codec_) {
+      // Messages are released right after being published, so a single one is usually enough
+      encoded_message_pool_ = std::make_shared<rclcpp::SerializedMessagePool>(1);
+    }
+  }
 
   RCLCPP_PUBLIC
   virtual ~GenericPublisher() = default;
 
+  /// Called post construction, so that construction may continue after shared_from_this() works.
+  template<typename AllocatorT = std::allocator<void>>
+  void
+  post_init_setup(
+    rclcpp::node_interfaces::NodeBaseInterface * node_base,
+    const rclcpp::PublisherOptionsWithAllocator<AllocatorT> & options)
+  {
+    if (rclcpp::detail::resolve_use_intra_process(options, *node_base)) {
+      setup_serialized_intra_process(node_base);
+    }
+  }
+
+  /// Return true, the messages of this publisher are serialized.
+  RCLCPP_PUBLIC
+  bool
+  is_serialized() const override;
+
   /// Publish a rclcpp::SerializedMessage.
+  /**
+   * With a `payload_codec` in the options, the message is encoded before being published to
+   * the middleware, into a pooled buffer, while intra-process subscriptions receive it as is.
+   *
+   * \param message a serialized message
+   * \throws anything rclcpp::exceptions::throw_from_rcl_error can show, or the codec throws
+   */
   RCLCPP_PUBLIC
   void publish(const rclcpp::SerializedMessage & message);
 
+  /// Publish a batch of rclcpp::SerializedMessage, in order.
+  /**
+   * The publisher handle is looked up once for the whole batch.
+   *
+   * \param messages the serialized messages to publish
+   * \throws anything rclcpp::exceptions::throw_from_rcl_error can show, messages preceding the
+   *   one that failed have already been published
+   */
+  RCLCPP_PUBLIC
+  void publish_batch(const std::vector<rclcpp::SerializedMessage> & messages);
+
   /**
    * Publish a rclcpp::SerializedMessage via loaned message after de-serialization.
    *
+   * The middleware interface only loans messages in their deserialized form, so this pays a
+   * deserialization per message to use the zero-copy transport of the middleware.
+   * Publishing serialized data with publish() only copies it, see borrow_serialized_message().
+   *
    * \param message a serialized message
    * \throws anything rclcpp::exceptions::throw_from_rcl_error can show
    */
   RCLCPP_PUBLIC
   void publish_as_loaned_msg(const rclcpp::SerializedMessage & message);
 
+  /// Borrow an empty serialized message, to write serialized data into it and publish it.
+  /**
+   * The messages are taken from a pool of the publisher and returned to it once released,
+   * so that writing each message, e.g. when playing back recorded data, doesn't allocate
+   * memory once the pool is warm.
+   * The message is published with publish(), without being deserialized.
+   *
+   * \param capacity the capacity reserved in the message, for the data about to be written
+   * \return a message whose size is zero and capacity is at least the given one
+   */
+  RCLCPP_PUBLIC
+  std::shared_ptr<rclcpp::SerializedMessage>
+  borrow_serialized_message(size_t capacity = 0);
+
 private:
   // The type support library should stay loaded, so it is stored in the GenericPublisher
   std::shared_ptr<rcpputils::SharedLibrary> ts_lib_;
+  // Codec of the messages published inter-process, nullptr to publish them as is
+  rclcpp::SerializedMessageCodec::SharedPtr payload_codec_;
+  rclcpp::SerializedMessagePool::SharedPtr encoded_message_pool_;
+  // Messages borrowed with borrow_serialized_message()
+  rclcpp::SerializedMessagePool::SharedPtr serialized_message_pool_;
+
+  RCLCPP_PUBLIC
+  void setup_serialized_intra_process(rclcpp::node_interfaces::NodeBaseInterface * node_base);
+
+  void publish_inter_process(const rclcpp::SerializedMessage & message);
 
   void * borrow_loaned_message();
   void deserialize_message(
@@ -23,11 +23,15 @@
 #include "rcpputils/shared_library.hpp"
 
 #include "rclcpp/callback_group.hpp"
+#include "rclcpp/detail/resolve_use_intra_process.hpp"
+#include "rclcpp/intra_process_buffer_type.hpp"
 #include "rclcpp/macros.hpp"
 #include "rclcpp/node_interfaces/node_base_interface.hpp"
 #include "rclcpp/node_interfaces/node_topics_interface.hpp"
 #include "rclcpp/qos.hpp"
 #include "rclcpp/serialized_message.hpp"
+#include "rclcpp/serialized_message_codec.hpp"
+#include "rclcpp/serialized_message_pool.hpp"
 #include "rclcpp/subscription_base.hpp"
 #include "rclcpp/typesupport_helpers.hpp"
 #include "rclcpp/visibility_control.hpp"
@@ -40,7 +44,8 @@ namespace rclcpp
  * Since the type is not known at compile time, this is not a template, and the dynamic library
  * containing type support information has to be identified and loaded based on the type name.
  *
- * It does not support intra-process handling.
+ * Intra-process communication is only done with rclcpp::GenericPublisher, and only when
+ * the %QoS settings allow it, otherwise the messages go through the middleware.
  */
 class GenericSubscription : public rclcpp::SubscriptionBase
 {
@@ -64,7 +69,9 @@ public:
    * \param callback Callback for new messages of serialized form
    * \param options %Subscription options.
    * Not all subscription options are currently respected, the only relevant options for this
-   * subscription are `event_callbacks`, `use_default_callbacks`, `ignore_local_publications`, and
+   * subscription are `event_callbacks`, `use_default_callbacks`, `ignore_local_publications`,
+   * `max_batch_size`, `max_rate`, `capture_receive_stamp`, `serialized_message_pool_size`,
+   * `payload_codec`, `use_intra_process_comm`, `intra_process_buffer_type` and
    * `%callback_group`.
    */
   template<typename AllocatorT = std::allocator<void>>
@@ -86,8 +93,68 @@ public:
       options.use_default_callbacks,
       DeliveredMessageKind::SERIALIZED_MESSAGE),
     callback_(callback),
+    payload_codec_(options.payload_codec),
     ts_lib_(ts_lib)
-  {}
+  {
+    this->set_max_batch_size(options.max_batch_size);
+    this->set_max_rate(options.max_rate);
+    // The shared pointer callback doesn't take the message info
+    this->set_message_info_usage(false, options.capture_receive_stamp);
+    if (options.serialized_message_pool_size > 0) {
+      serialized_message_pool_ = std::make_shared<rclcpp::SerializedMessagePool>(
+        options.serialized_message_pool_size);
+    }
+    if (payload_codec_) {
+      // The taken messages are released once decoded, only the decoded ones are delivered
+      decoded_message_pool_ = std::make_shared<rclcpp::SerializedMessagePool>(
+        options.serialized_message_pool_size > 0 ? options.serialized_message_pool_size : 1);
+      if (!serialized_message_pool_) {
+        serialized_message_pool_ = std::make_shared<rclcpp::SerializedMessagePool>(1);
+      }
+    }
+    // The constructor taking a view callback sets up intra-process itself
+    if (callback_ && rclcpp::detail::resolve_use_intra_process(options, *node_base)) {
+      setup_serialized_intra_process(node_base, options.intra_process_buffer_type);
+    }
+  }
+
+  /// Constructor for a subscription delivering views of the serialized messages.
+  /**
+   * Instead of a shared pointer to a serialized message owned by the callback, the callback
+   * receives a view of the serialized data, valid only for the duration of the callback,
+   * along with the message info.
+   * Since the callback can't keep the message, the taken messages are always stored in a
+   * pool and their buffers are reused, so no memory is allocated for each message once the
+   * pool has grown to fit the largest message.
+   *
+   * \sa GenericSubscription() for the other parameters.
+   * Message loaning is not supported for serialized messages by the middleware interface,
+   * so the data is still copied once out of the middleware, into the pooled buffer.
+   */
+  template<typename AllocatorT = std::allocator<void>>
+  GenericSubscription(
+    rclcpp::node_interfaces::NodeBaseInterface * node_base,
+    const std::shared_ptr<rcpputils::SharedLibrary> ts_lib,
+    const std::string & topic_name,
+    const std::string & topic_type,
+    const rclcpp::QoS & qos,
+    std::function<void(
+      const rclcpp::SerializedMessageView &, const rclcpp::MessageInfo &)> view_callback,
+    const rclcpp::SubscriptionOptionsWithAllocator<AllocatorT> & options)
+  : GenericSubscription(
+      node_base, ts_lib, topic_name, topic_type, qos,
+      std::function<void(std::shared_ptr<rclcpp::SerializedMessage>)>(), options)
+  {
+    view_callback_ = view_callback;
+    this->set_message_info_usage(true, options.capture_receive_stamp);
+    if (!serialized_message_pool_) {
+      // Messages are released right after the callback, so a single one is usually enough
+      serialized_message_pool_ = std::make_shared<rclcpp::SerializedMessagePool>(1);
+    }
+    if (rclcpp::detail::resolve_use_intra_process(options, *node_base)) {
+      setup_serialized_intra_process(node_base, options.intra_process_buffer_type);
+    }
+  }
 
   RCLCPP_PUBLIC
   virtual ~GenericSubscription() = default;
@@ -105,6 +172,11 @@ public:
     std::shared_ptr<void> & message, const rclcpp::MessageInfo & message_info) override;
 
   /// Handle dispatching rclcpp::SerializedMessage to user callback.
+  /**
+   * With a `payload_codec` in the options, the message is decoded first, into a pooled buffer.
+   *
+   * \throws anything the codec throws when the message can't be decoded
+   */
   RCLCPP_PUBLIC
   void
   handle_serialized_message(
@@ -151,7 +223,19 @@ public:
 private:
   RCLCPP_DISABLE_COPY(GenericSubscription)
 
+  RCLCPP_PUBLIC
+  void setup_serialized_intra_process(
+    rclcpp::node_interfaces::NodeBaseInterface * node_base,
+    rclcpp::IntraProcessBufferType buffer_type);
+
   std::function<void(std::shared_ptr<rclcpp::SerializedMessage>)> callback_;
+  std::function<void(
+      const rclcpp::SerializedMessageView &, const rclcpp::MessageInfo &)> view_callback_;
+  // Pool of serialized messages, nullptr to allocate a new message for every take
+  rclcpp::SerializedMessagePool::SharedPtr serialized_message_pool_;
+  // Codec of the messages taken from the middleware, nullptr to deliver them as is
+  rclcpp::SerializedMessageCodec::SharedPtr payload_codec_;
+  rclcpp::SerializedMessagePool::SharedPtr decoded_message_pool_;
   // The type support library should stay loaded, so it is stored in the GenericSubscription
   std::shared_ptr<rcpputils::SharedLibrary> ts_lib_;
 };
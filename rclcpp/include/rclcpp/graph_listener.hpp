@@ -192,6 +192,10 @@ private:
   mutable std::mutex node_graph_interfaces_barrier_mutex_;
   mutable std::mutex node_graph_interfaces_mutex_;
   std::vector<rclcpp::node_interfaces::NodeGraphInterface *> node_graph_interfaces_;
+  /// Graph guard conditions of the nodes, in the order of node_graph_interfaces_.
+  std::vector<const rcl_guard_condition_t *> graph_guard_conditions_;
+  /// Wait set indexes of the graph guard conditions, reused by each loop.
+  std::vector<size_t> graph_gc_indexes_;
 
   rclcpp::GuardCondition interrupt_guard_condition_;
   rcl_wait_set_t wait_set_ = rcl_get_zero_initialized_wait_set();
@@ -84,6 +84,35 @@ public:
   void
   trigger();
 
+  /// Set whether the triggers happening until this guard condition is waited on are coalesced.
+  /**
+   * When enabled, only the first call to trigger() since the guard condition was last
+   * added to a wait set reaches the middleware, the following ones are pure overhead as
+   * the guard condition is already triggered.
+   * A wait set which already consumed the first trigger is triggered again by
+   * prepare_for_wait(), so that the following ones aren't lost.
+   *
+   * Triggers are never coalesced while an on trigger callback is set, as the callback is
+   * expected to be called for every trigger.
+   *
+   * This must only be enabled for guard conditions which are added to wait sets by rclcpp,
+   * which calls prepare_for_wait() every time, and not directly through the rcl handle.
+   *
+   * \param[in] coalesce whether to coalesce the triggers, false by default
+   */
+  RCLCPP_PUBLIC
+  void
+  set_trigger_coalescing(bool coalesce);
+
+  /// Let the next trigger reach the middleware, called before adding it to a wait set.
+  /**
+   * This is a no-op unless trigger coalescing is enabled.
+   * It's const as it's called wherever the guard condition is added to a wait set.
+   */
+  RCLCPP_PUBLIC
+  void
+  prepare_for_wait() const;
+
   /// Exchange the "in use by wait set" state for this guard condition.
   /**
    * This is used to ensure this guard condition is not used by multiple
@@ -135,6 +164,10 @@ protected:
   std::function<void(size_t)> on_trigger_callback_{nullptr};
   size_t unread_count_{0};
   rcl_wait_set_t * wait_set_{nullptr};
+  std::atomic_bool coalesce_triggers_{false};
+  std::atomic_bool has_on_trigger_callback_{false};
+  // Whether a trigger reached the middleware, or was coalesced, since the last wait
+  mutable std::atomic_int trigger_state_{0};
 };
 
 }  // namespace rclcpp
@@ -15,6 +15,7 @@
 #ifndef RCLCPP__INIT_OPTIONS_HPP_
 #define RCLCPP__INIT_OPTIONS_HPP_
 
+#include <cstddef>
 #include <memory>
 #include <mutex>
 
@@ -24,6 +25,17 @@
 namespace rclcpp
 {
 
+/// What to do with a log message when the queue of asynchronous logging is full.
+enum class LogQueueOverflowPolicy
+{
+  /// Drop the new message.
+  DropNewest,
+  /// Drop the oldest queued message, to queue the new one.
+  DropOldest,
+  /// Output the new message in the calling thread, as without asynchronous logging.
+  OutputSynchronously,
+};
+
 /// Encapsulation of options for initializing rclcpp.
 class InitOptions
 {
@@ -31,6 +43,46 @@ public:
   /// If true, the context will be shutdown on SIGINT by the signal handler (if it was installed).
   bool shutdown_on_signal = true;
 
+  /// If true, intra-process communication spans the contexts with the same domain id.
+  /**
+   * The publishers and subscriptions of the contexts with this option set and the same domain
+   * id, in the same process, share an intra process manager, so they exchange messages without
+   * going through the middleware, like nodes of the same context do.
+   * Otherwise, each context has its own intra process manager.
+   */
+  bool share_intra_process_across_contexts = false;
+
+  /// If true, shutting down the context keeps its rcl context, and the middleware, initialized.
+  /**
+   * The next init of the same Context then reuses the rcl context, instead of initializing
+   * the middleware again, if it is given the same arguments and domain id and also sets this
+   * option.
+   * Otherwise the kept rcl context is shutdown then, or when the Context is destroyed.
+   *
+   * The shutdown callbacks are called and the context is not valid after shutdown, as usual,
+   * but the entities created in the context are not invalidated by the middleware.
+   * This is meant for test suites which init and shutdown many times.
+   */
+  bool keep_rcl_context_on_shutdown = false;
+
+  /// If greater than zero, log messages are queued and output by a background thread.
+  /**
+   * Log messages are then formatted in the calling thread, but written to the console, rosout
+   * and the external logger by a background thread, so that logging doesn't wait for them.
+   * This is the maximum number of queued messages.
+   *
+   * This only applies to the context which configures logging, i.e. the first one initialized
+   * with auto_initialize_logging(), and the queued messages are output before logging is
+   * finalized, when the last of these contexts is shutdown.
+   */
+  size_t async_logging_queue_size = 0;
+
+  /// What to do with a log message when the queue of asynchronous logging is full.
+  /**
+   * The number of dropped messages is logged by the background thread.
+   */
+  LogQueueOverflowPolicy async_logging_overflow_policy = LogQueueOverflowPolicy::DropNewest;
+
   /// Constructor
   /**
    * It allows you to specify the allocator used within the init options.
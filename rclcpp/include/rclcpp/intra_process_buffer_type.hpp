@@ -23,11 +23,47 @@ namespace rclcpp
 enum class IntraProcessBufferType
 {
   /// Set the data type used in the intra-process buffer as std::shared_ptr<MessageT>
+  /**
+   * Messages are shared with the other subscriptions instead of being copied when published.
+   * If the callback takes ownership of the message, it's copied when the message is taken,
+   * or moved if no other subscription holds it anymore, which makes the delivery copy-on-write.
+   */
   SharedPtr,
   /// Set the data type used in the intra-process buffer as std::unique_ptr<MessageT>
   UniquePtr,
   /// Set the data type used in the intra-process buffer as the same used in the callback
-  CallbackDefault
+  /**
+   * Callbacks taking the message by const reference use std::shared_ptr<MessageT>, so that the
+   * message isn't copied for them when other subscriptions receive it too.
+   */
+  CallbackDefault,
+  /// Same as SharedPtr, but stored in a lock-free ring buffer
+  LockFreeSharedPtr,
+  /// Same as UniquePtr, but stored in a lock-free ring buffer
+  LockFreeUniquePtr,
+  /// Same as CallbackDefault, but stored in a lock-free ring buffer
+  LockFreeCallbackDefault,
+  /// Same as SharedPtr, but only the latest message is stored, whatever the depth
+  /**
+   * The message is replaced with an atomic pointer swap, which suits subscriptions of depth
+   * one to state or configuration topics: the publisher never blocks and the callback always
+   * gets the newest message.
+   */
+  MailboxSharedPtr,
+  /// Same as UniquePtr, but only the latest message is stored, whatever the depth
+  MailboxUniquePtr,
+  /// Same as CallbackDefault, but only the latest message is stored, whatever the depth
+  MailboxCallbackDefault,
+  /// Same as SharedPtr, but reading the messages from a ring shared with other subscriptions
+  /**
+   * Each intra-process publisher writes its messages once to a broadcast ring, of the depth of
+   * the publisher, which all the subscriptions using this type read from their own position.
+   * A broadcast subscription falling behind by more than that depth skips the oldest messages,
+   * as with a "keep last" history.
+   * Messages which aren't published by an intra-process publisher are stored in a ring of the
+   * depth of the subscription.
+   */
+  BroadcastSharedPtr
 };
 
 }  // namespace rclcpp
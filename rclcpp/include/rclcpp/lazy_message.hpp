@@ -0,0 +1,153 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__LAZY_MESSAGE_HPP_
+#define RCLCPP__LAZY_MESSAGE_HPP_
+
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#include "rclcpp/serialization.hpp"
+#include "rclcpp/serialized_field_extractor.hpp"
+#include "rclcpp/serialized_message.hpp"
+
+namespace rclcpp
+{
+
+/// Message received by a subscription, deserialized the first time it's accessed.
+/**
+ * A subscription with a callback taking a LazyMessage takes the serialized messages from the
+ * middleware, and only pays for their deserialization when the callback gets the message.
+ * Callbacks discarding most of the messages, e.g. rate limiting or routing them on the value
+ * of a field, can read single fields with peek() instead, without deserializing the message.
+ *
+ * Messages delivered by intra-process communication are already deserialized, and get()
+ * returns them without copying.
+ *
+ * A LazyMessage isn't thread-safe: copies share the serialized data and a message already
+ * deserialized, but a copy deserializes again for a message first accessed after the copy.
+ *
+ * \tparam MessageT the ROS message type of the subscription
+ */
+template<typename MessageT>
+class LazyMessage
+{
+public:
+  /// Create a lazy message from serialized data, which must not be modified afterwards.
+  explicit LazyMessage(std::shared_ptr<const rclcpp::SerializedMessage> serialized_message)
+  : serialized_message_(std::move(serialized_message))
+  {
+    if (!serialized_message_) {
+      throw std::invalid_argument("serialized message is nullptr");
+    }
+  }
+
+  /// Create a lazy message from a message already deserialized.
+  explicit LazyMessage(std::shared_ptr<const MessageT> message)
+  : message_(std::move(message))
+  {
+    if (!message_) {
+      throw std::invalid_argument("message is nullptr");
+    }
+  }
+
+  /// Get the message, deserializing it on the first call.
+  /**
+   * \return the message, valid for the lifetime of the lazy message
+   * \throws rclcpp::exceptions::RCLError if the serialized data can't be deserialized
+   */
+  const MessageT &
+  get() const
+  {
+    return *get_shared();
+  }
+
+  /// Get the message as a shared pointer, deserializing it on the first call.
+  /**
+   * \sa get()
+   */
+  std::shared_ptr<const MessageT>
+  get_shared() const
+  {
+    if (!message_) {
+      auto message = std::make_shared<MessageT>();
+      rclcpp::Serialization<MessageT>().deserialize_message(
+        serialized_message_.get(), message.get());
+      message_ = std::move(message);
+    }
+    return message_;
+  }
+
+  const MessageT &
+  operator*() const
+  {
+    return get();
+  }
+
+  const MessageT *
+  operator->() const
+  {
+    return &get();
+  }
+
+  /// Return true if the message was deserialized, or was delivered deserialized.
+  bool
+  is_deserialized() const
+  {
+    return message_ != nullptr;
+  }
+
+  /// Get the serialized data of the message, serializing it if it was delivered deserialized.
+  /**
+   * \return the serialized message, valid for the lifetime of the lazy message
+   * \throws rclcpp::exceptions::RCLError if the message can't be serialized
+   */
+  const rclcpp::SerializedMessage &
+  get_serialized_message() const
+  {
+    if (!serialized_message_) {
+      auto serialized_message = std::make_shared<rclcpp::SerializedMessage>();
+      rclcpp::Serialization<MessageT>().serialize_message(message_.get(), serialized_message.get());
+      serialized_message_ = std::move(serialized_message);
+    }
+    return *serialized_message_;
+  }
+
+  /// Read a single field of the message, without deserializing it.
+  /**
+   * Once the message is deserialized, reading its field directly is cheaper.
+   *
+   * \param[in] extractor the extractor of the field, created for the type support of MessageT,
+   *   e.g. with rosidl_typesupport_cpp::get_message_type_support_handle<MessageT>()
+   * \return the value of the field
+   * \throws std::invalid_argument if T doesn't match the type of the field
+   * \throws std::runtime_error if the serialized data is truncated or isn't plain CDR
+   * \sa SerializedFieldExtractor::extract()
+   */
+  template<typename T>
+  T
+  peek(const rclcpp::SerializedFieldExtractor & extractor) const
+  {
+    return extractor.extract<T>(get_serialized_message());
+  }
+
+private:
+  mutable std::shared_ptr<const rclcpp::SerializedMessage> serialized_message_;
+  mutable std::shared_ptr<const MessageT> message_;
+};
+
+}  // namespace rclcpp
+
+#endif  // RCLCPP__LAZY_MESSAGE_HPP_
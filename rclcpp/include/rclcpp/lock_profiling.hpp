@@ -0,0 +1,350 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__LOCK_PROFILING_HPP_
+#define RCLCPP__LOCK_PROFILING_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "rcpputils/thread_safety_annotations.hpp"
+
+#include "rclcpp/visibility_control.hpp"
+
+namespace rclcpp
+{
+/// Measurement of the contention on the internal mutexes of rclcpp.
+/**
+ * The mutexes of rclcpp on which threads are known to contend, e.g. the ones of the executors,
+ * of the intra-process manager, of the parameters of a node and of the pending requests of a
+ * client, are named after the member they are, and are either ProfiledMutex wrappers or,
+ * when they are accessible to derived classes, locked with a ProfiledLockGuard.
+ * Once profiling is enabled, their acquisitions, the time spent waiting for them and the time
+ * they are held are accumulated per name, i.e. for all the instances of a member together.
+ *
+ * Profiling is disabled by default, the wrappers then only cost a relaxed load and a branch
+ * predicted as not taken per lock.
+ */
+namespace lock_profiling
+{
+
+/// Statistics of the mutexes of a name, since profiling was enabled or the last reset.
+struct LockStatistics
+{
+  /// The name of the mutexes.
+  std::string name;
+  /// Number of times the mutexes were locked, shared locks included.
+  uint64_t acquisitions = 0;
+  /// Number of times the mutexes were already locked when they had to be locked.
+  uint64_t contended_acquisitions = 0;
+  /// Total time spent waiting to lock the mutexes.
+  std::chrono::nanoseconds wait_time{0};
+  /// Longest time spent waiting to lock the mutexes.
+  std::chrono::nanoseconds max_wait_time{0};
+  /// Total time the mutexes were held exclusively, from the outermost lock to its unlock.
+  std::chrono::nanoseconds hold_time{0};
+};
+
+namespace detail
+{
+
+/// Whether profiling is enabled, only to be used through is_enabled().
+RCLCPP_PUBLIC
+extern std::atomic<bool> enabled;
+
+/// Measurements accumulated for the mutexes of a name.
+struct LockCounters
+{
+  /// Count an acquisition of a mutex, after waiting for it if it was contended.
+  void
+  record_acquisition(bool contended, int64_t wait_ns) noexcept
+  {
+    acquisitions.fetch_add(1, std::memory_order_relaxed);
+    if (contended) {
+      contended_acquisitions.fetch_add(1, std::memory_order_relaxed);
+      wait_time_ns.fetch_add(wait_ns, std::memory_order_relaxed);
+      int64_t max = max_wait_time_ns.load(std::memory_order_relaxed);
+      while (wait_ns > max &&
+        !max_wait_time_ns.compare_exchange_weak(max, wait_ns, std::memory_order_relaxed))
+      {
+      }
+    }
+  }
+
+  std::atomic<uint64_t> acquisitions{0};
+  std::atomic<uint64_t> contended_acquisitions{0};
+  std::atomic<int64_t> wait_time_ns{0};
+  std::atomic<int64_t> max_wait_time_ns{0};
+  std::atomic<int64_t> hold_time_ns{0};
+};
+
+/// Get the counters of a name, which live until the end of the process.
+RCLCPP_PUBLIC
+LockCounters &
+get_lock_counters(const char * name);
+
+/// Get the current time, in nanoseconds of the steady clock.
+inline int64_t
+now_ns() noexcept
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+}  // namespace detail
+
+/// Return true if the ProfiledMutex wrappers measure their use.
+inline bool
+is_enabled() noexcept
+{
+  return detail::enabled.load(std::memory_order_relaxed);
+}
+
+/// Enable or disable the measurements of the ProfiledMutex wrappers.
+/**
+ * Mutexes held when profiling is enabled aren't measured until they are locked again.
+ */
+RCLCPP_PUBLIC
+void
+set_enabled(bool enabled) noexcept;
+
+/// Get the statistics of each name of mutex locked since profiling was enabled.
+/**
+ * The statistics are read while the mutexes keep being used, so the fields of a name may
+ * not be consistent with each other.
+ */
+RCLCPP_PUBLIC
+std::vector<LockStatistics>
+get_statistics();
+
+/// Discard the statistics measured so far.
+RCLCPP_PUBLIC
+void
+reset_statistics();
+
+namespace detail
+{
+
+/// Lock a mutex, returning the time it was acquired at, or zero if it isn't measured.
+template<typename MutexT>
+int64_t
+lock_and_record(MutexT & mutex, LockCounters & counters)
+{
+  if (!is_enabled()) {
+    mutex.lock();
+    return 0;
+  }
+  if (mutex.try_lock()) {
+    counters.record_acquisition(false, 0);
+    return now_ns();
+  }
+  const int64_t start = now_ns();
+  mutex.lock();
+  const int64_t acquired = now_ns();
+  counters.record_acquisition(true, acquired - start);
+  return acquired;
+}
+
+/// Count the time a mutex was held, if the time it was acquired at was measured.
+inline void
+record_hold(LockCounters & counters, int64_t acquired_ns) noexcept
+{
+  if (acquired_ns != 0) {
+    counters.hold_time_ns.fetch_add(now_ns() - acquired_ns, std::memory_order_relaxed);
+  }
+}
+
+}  // namespace detail
+
+/// Name under which the statistics of mutexes locked with a ProfiledLockGuard are accumulated.
+class LockProfile
+{
+public:
+  /// Constructor.
+  /**
+   * \param name the name of the statistics, it must outlive the profile, e.g. a string literal
+   */
+  explicit LockProfile(const char * name)
+  : counters_(detail::get_lock_counters(name))
+  {}
+
+  LockProfile(const LockProfile &) = delete;
+  LockProfile & operator=(const LockProfile &) = delete;
+
+private:
+  template<typename MutexT>
+  friend class ProfiledLockGuard;
+
+  detail::LockCounters & counters_;
+};
+
+/// Lock guard measuring the acquisition, wait time and hold time of a mutex it doesn't own.
+/**
+ * It profiles a mutex which has to keep its type, e.g. a protected member of a class which
+ * derived classes lock with their own lock guards, those acquisitions not being measured.
+ * The mutex must not be recursive, since each guard measures the time it is held itself.
+ *
+ * \tparam MutexT the type of the locked mutex, e.g. std::mutex
+ */
+template<typename MutexT>
+class RCPPUTILS_TSA_SCOPED_CAPABILITY ProfiledLockGuard
+{
+public:
+  /// Lock the mutex.
+  /**
+   * \param mutex the mutex to lock
+   * \param profile the name under which the acquisition of the mutex is accumulated
+   */
+  ProfiledLockGuard(MutexT & mutex, const LockProfile & profile) RCPPUTILS_TSA_ACQUIRE(mutex)
+  : mutex_(mutex),
+    counters_(profile.counters_),
+    acquired_ns_(detail::lock_and_record(mutex, counters_))
+  {}
+
+  /// Unlock the mutex.
+  ~ProfiledLockGuard() RCPPUTILS_TSA_RELEASE()
+  {
+    detail::record_hold(counters_, acquired_ns_);
+    mutex_.unlock();
+  }
+
+  ProfiledLockGuard(const ProfiledLockGuard &) = delete;
+  ProfiledLockGuard & operator=(const ProfiledLockGuard &) = delete;
+
+private:
+  MutexT & mutex_;
+  detail::LockCounters & counters_;
+  const int64_t acquired_ns_;
+};
+
+/// Lockable wrapper measuring the acquisitions, wait time and hold time of a mutex.
+/**
+ * It meets the requirements of the mutex it wraps, so it is used with the usual lock guards,
+ * and the shared lock functions are only available if the wrapped mutex has them.
+ * It can't be used with std::condition_variable, which requires a std::mutex.
+ *
+ * The hold time is measured from the outermost lock to the matching unlock for recursive
+ * mutexes, and isn't measured for shared locks, which can be held by several threads.
+ *
+ * \tparam MutexT the wrapped mutex type, e.g. std::mutex or std::shared_timed_mutex
+ */
+template<typename MutexT>
+class RCPPUTILS_TSA_CAPABILITY("mutex") ProfiledMutex
+{
+public:
+  /// Constructor.
+  /**
+   * \param name the name under which the statistics of the mutex are accumulated, it must
+   *   outlive the mutex, e.g. a string literal
+   */
+  explicit ProfiledMutex(const char * name)
+  : counters_(detail::get_lock_counters(name))
+  {}
+
+  ProfiledMutex(const ProfiledMutex &) = delete;
+  ProfiledMutex & operator=(const ProfiledMutex &) = delete;
+
+  void
+  lock() RCPPUTILS_TSA_ACQUIRE()
+  {
+    enter(detail::lock_and_record(mutex_, counters_));
+  }
+
+  bool
+  try_lock() RCPPUTILS_TSA_TRY_ACQUIRE(true)
+  {
+    if (!mutex_.try_lock()) {
+      return false;
+    }
+    if (is_enabled()) {
+      counters_.record_acquisition(false, 0);
+      enter(detail::now_ns());
+    } else {
+      enter(0);
+    }
+    return true;
+  }
+
+  void
+  unlock() RCPPUTILS_TSA_RELEASE()
+  {
+    if (--depth_ == 0) {
+      detail::record_hold(counters_, acquired_ns_);
+    }
+    mutex_.unlock();
+  }
+
+  template<typename M = MutexT, typename = decltype(std::declval<M &>().lock_shared())>
+  void
+  lock_shared() RCPPUTILS_TSA_ACQUIRE_SHARED()
+  {
+    if (!is_enabled()) {
+      mutex_.lock_shared();
+      return;
+    }
+    if (mutex_.try_lock_shared()) {
+      counters_.record_acquisition(false, 0);
+      return;
+    }
+    const int64_t start = detail::now_ns();
+    mutex_.lock_shared();
+    counters_.record_acquisition(true, detail::now_ns() - start);
+  }
+
+  template<typename M = MutexT, typename = decltype(std::declval<M &>().try_lock_shared())>
+  bool
+  try_lock_shared() RCPPUTILS_TSA_TRY_ACQUIRE_SHARED(true)
+  {
+    if (!mutex_.try_lock_shared()) {
+      return false;
+    }
+    if (is_enabled()) {
+      counters_.record_acquisition(false, 0);
+    }
+    return true;
+  }
+
+  template<typename M = MutexT, typename = decltype(std::declval<M &>().unlock_shared())>
+  void
+  unlock_shared() RCPPUTILS_TSA_RELEASE_SHARED()
+  {
+    mutex_.unlock_shared();
+  }
+
+private:
+  /// Record the start of an exclusive hold, the time being zero if it isn't measured.
+  void
+  enter(int64_t acquired_ns) noexcept
+  {
+    // Only the holder of the mutex accesses these members
+    if (depth_++ == 0) {
+      acquired_ns_ = acquired_ns;
+    }
+  }
+
+  MutexT mutex_;
+  detail::LockCounters & counters_;
+  size_t depth_ = 0;
+  int64_t acquired_ns_ = 0;
+};
+
+}  // namespace lock_profiling
+}  // namespace rclcpp
+
+#endif  // RCLCPP__LOCK_PROFILING_HPP_
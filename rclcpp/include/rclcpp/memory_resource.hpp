@@ -0,0 +1,121 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__MEMORY_RESOURCE_HPP_
+#define RCLCPP__MEMORY_RESOURCE_HPP_
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+
+#include "rclcpp/publisher.hpp"
+#include "rclcpp/publisher_options.hpp"
+#include "rclcpp/subscription.hpp"
+#include "rclcpp/subscription_options.hpp"
+#include "rclcpp/visibility_control.hpp"
+
+namespace rclcpp
+{
+namespace pmr
+{
+
+/// Allocator of the endpoints allocating from a memory resource chosen at runtime.
+/**
+ * All the endpoints using it have the same type whatever their memory resource, so a node
+ * or an executor can get its own resource, like an arena, without changing the types of its
+ * endpoints, and the intra-process communication works between endpoints using different
+ * resources.
+ *
+ * Messages are freed by the resource which allocated them, which must outlive them.
+ * The rcl entities of the endpoints are allocated with the default rcl allocator, since rcl
+ * frees memory without giving its size, which memory resources need.
+ */
+using Allocator = std::pmr::polymorphic_allocator<void>;
+
+using PublisherOptions = rclcpp::PublisherOptionsWithAllocator<Allocator>;
+using SubscriptionOptions = rclcpp::SubscriptionOptionsWithAllocator<Allocator>;
+
+template<typename MessageT>
+using Publisher = rclcpp::Publisher<MessageT, Allocator>;
+
+template<typename MessageT>
+using Subscription = rclcpp::Subscription<MessageT, Allocator>;
+
+/// Create an allocator of the endpoint options allocating from the given resource.
+/**
+ * For instance:
+ *
+ * \code
+ * std::pmr::unsynchronized_pool_resource resource;
+ * rclcpp::pmr::PublisherOptions options;
+ * options.allocator = rclcpp::pmr::make_allocator(&resource);
+ * auto publisher = node->create_publisher<MessageT>("topic", 10, options);
+ * \endcode
+ *
+ * \param[in] resource the memory resource, which must outlive the endpoints and messages
+ * \return the allocator
+ * \throws std::invalid_argument if resource is nullptr
+ */
+RCLCPP_PUBLIC
+std::shared_ptr<Allocator>
+make_allocator(std::pmr::memory_resource * resource);
+
+/// Memory resource serializing the use of another one, which isn't thread-safe.
+/**
+ * The monotonic and unsynchronized pool resources of the standard library can't be used by
+ * several threads at once, while callbacks may be executed by several threads, and messages
+ * freed by other threads than the allocating ones.
+ */
+class SynchronizedMemoryResource : public std::pmr::memory_resource
+{
+public:
+  /// Create a resource using the given one.
+  /**
+   * \param[in] upstream the resource used, which must outlive this one
+   * \throws std::invalid_argument if upstream is nullptr
+   */
+  RCLCPP_PUBLIC
+  explicit SynchronizedMemoryResource(std::pmr::memory_resource * upstream);
+
+  RCLCPP_PUBLIC
+  virtual ~SynchronizedMemoryResource();
+
+  /// Get the resource used.
+  RCLCPP_PUBLIC
+  std::pmr::memory_resource *
+  upstream_resource() const;
+
+protected:
+  RCLCPP_PUBLIC
+  void *
+  do_allocate(size_t bytes, size_t alignment) override;
+
+  RCLCPP_PUBLIC
+  void
+  do_deallocate(void * pointer, size_t bytes, size_t alignment) override;
+
+  RCLCPP_PUBLIC
+  bool
+  do_is_equal(const std::pmr::memory_resource & other) const noexcept override;
+
+private:
+  std::pmr::memory_resource * upstream_;
+  std::mutex mutex_;
+};
+
+}  // namespace pmr
+}  // namespace rclcpp
+
+#endif  // RCLCPP__MEMORY_RESOURCE_HPP_
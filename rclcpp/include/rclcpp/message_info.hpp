@@ -15,6 +15,8 @@
 #ifndef RCLCPP__MESSAGE_INFO_HPP_
 #define RCLCPP__MESSAGE_INFO_HPP_
 
+#include <chrono>
+
 #include "rmw/types.h"
 
 #include "rclcpp/visibility_control.hpp"
@@ -46,8 +48,22 @@ public:
   rmw_message_info_t &
   get_rmw_message_info();
 
+  /// Return the steady time at which the message was taken from the middleware.
+  /**
+   * It's only captured for subscriptions with the capture_receive_stamp option, and not for
+   * messages delivered with intra-process communication: it's the epoch of the steady clock
+   * otherwise.
+   */
+  std::chrono::steady_clock::time_point
+  get_receive_stamp() const;
+
+  /// Set the steady time at which the message was taken from the middleware.
+  void
+  set_receive_stamp(std::chrono::steady_clock::time_point receive_stamp);
+
 private:
   rmw_message_info_t rmw_message_info_;
+  std::chrono::steady_clock::time_point receive_stamp_;
 };
 
 }  // namespace rclcpp
@@ -17,10 +17,12 @@
 
 #include <memory>
 #include <stdexcept>
+#include <type_traits>
 
 #include "rcl/types.h"
 
 #include "rclcpp/allocator/allocator_common.hpp"
+#include "rclcpp/detail/dispatch_arena.hpp"
 #include "rclcpp/exceptions.hpp"
 #include "rclcpp/macros.hpp"
 #include "rclcpp/serialized_message.hpp"
@@ -84,6 +86,10 @@ public:
   /** \return Shared pointer to the new message. */
   virtual std::shared_ptr<MessageT> borrow_message()
   {
+    if constexpr (std::is_same_v<MessageAlloc, std::allocator<MessageT>>) {
+      // The message is usually released once its callback returns
+      return rclcpp::detail::make_dispatch_shared<MessageT>();
+    }
     return std::allocate_shared<MessageT, MessageAlloc>(*message_allocator_.get());
   }
 
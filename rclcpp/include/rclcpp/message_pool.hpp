@@ -0,0 +1,277 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__MESSAGE_POOL_HPP_
+#define RCLCPP__MESSAGE_POOL_HPP_
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+#include "rclcpp/allocator/allocator_common.hpp"
+#include "rclcpp/macros.hpp"
+
+namespace rclcpp
+{
+
+/// Bounded pool of preallocated messages, returned to the pool instead of being destroyed.
+/**
+ * Messages acquired from the pool return to it when they are released, keeping their
+ * contents, so the memory of their dynamically sized fields is reused as well.
+ * Messages can be shared with share(): the shared pointer control blocks are recycled by the
+ * pool too, so that once the pool is warmed up, acquiring, sharing and releasing messages
+ * doesn't allocate memory.
+ *
+ * If all the messages are in use, acquire() allocates a new one, which is kept by the pool
+ * when released only if the pool holds less than its size of free messages.
+ *
+ * All the methods are thread safe, and acquired messages may outlive the pool.
+ */
+template<typename MessageT, typename Alloc = std::allocator<void>>
+class MessagePool
+{
+  struct State;
+
+public:
+  RCLCPP_SMART_PTR_DEFINITIONS_NOT_COPYABLE(MessagePool)
+
+  /// Deleter returning messages to the pool they were acquired from.
+  class Deleter
+  {
+public:
+    Deleter() = default;
+
+    explicit Deleter(std::shared_ptr<State> state)
+    : state_(std::move(state))
+    {}
+
+    void operator()(MessageT * msg) const
+    {
+      if (msg) {
+        state_->put_message(msg);
+      }
+    }
+
+private:
+    std::shared_ptr<State> state_;
+  };
+
+  using MessageUniquePtr = std::unique_ptr<MessageT, Deleter>;
+
+  /// Create a new pool, preallocating its messages.
+  /**
+   * \param[in] size number of messages allocated in advance, and maximum number of free
+   *   messages kept by the pool
+   * \param[in] allocator allocator used for the messages
+   */
+  explicit MessagePool(size_t size, const Alloc & allocator = Alloc())
+  : state_(std::make_shared<State>(size, allocator))
+  {}
+
+  /// Get a message from the pool, allocating a new one if none is free.
+  /**
+   * The message keeps the contents it had when it was returned to the pool.
+   */
+  MessageUniquePtr
+  acquire()
+  {
+    return MessageUniquePtr(state_->get_message(), Deleter(state_));
+  }
+
+  /// Convert an acquired message into a shared pointer, returning it to the pool when released.
+  /**
+   * Unlike converting the unique pointer directly, the control block of the shared pointer
+   * is allocated from the pool.
+   */
+  std::shared_ptr<const MessageT>
+  share(MessageUniquePtr message)
+  {
+    Deleter deleter = message.get_deleter();
+    return std::shared_ptr<const MessageT>(
+      message.release(), std::move(deleter), ControlBlockAllocator<MessageT>(state_));
+  }
+
+  /// Get the number of unused messages currently kept by the pool.
+  size_t
+  get_number_of_free_messages() const
+  {
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    return state_->free_messages.size();
+  }
+
+  /// Get the size of the pool.
+  size_t
+  size() const
+  {
+    return state_->size;
+  }
+
+private:
+  using MessageAllocTraits = allocator::AllocRebind<MessageT, Alloc>;
+  using MessageAlloc = typename MessageAllocTraits::allocator_type;
+
+  // The state is shared with the acquired messages, so they can be returned
+  // even if they outlive the pool.
+  struct State
+  {
+    State(size_t pool_size, const Alloc & alloc)
+    : size(pool_size), allocator(alloc)
+    {
+      free_messages.reserve(size);
+      free_blocks.reserve(size);
+      for (size_t i = 0; i < size; ++i) {
+        free_messages.push_back(allocate_message());
+      }
+    }
+
+    ~State()
+    {
+      for (MessageT * msg : free_messages) {
+        MessageAllocTraits::destroy(allocator, msg);
+        MessageAllocTraits::deallocate(allocator, msg, 1);
+      }
+      for (void * block : free_blocks) {
+        ::operator delete(block);
+      }
+    }
+
+    MessageT *
+    allocate_message()
+    {
+      MessageT * msg = MessageAllocTraits::allocate(allocator, 1);
+      try {
+        MessageAllocTraits::construct(allocator, msg);
+      } catch (...) {
+        MessageAllocTraits::deallocate(allocator, msg, 1);
+        throw;
+      }
+      return msg;
+    }
+
+    MessageT *
+    get_message()
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      if (free_messages.empty()) {
+        return allocate_message();
+      }
+      MessageT * msg = free_messages.back();
+      free_messages.pop_back();
+      return msg;
+    }
+
+    void
+    put_message(MessageT * msg)
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      if (free_messages.size() < size) {
+        free_messages.push_back(msg);
+        return;
+      }
+      MessageAllocTraits::destroy(allocator, msg);
+      MessageAllocTraits::deallocate(allocator, msg, 1);
+    }
+
+    void *
+    get_block(size_t bytes)
+    {
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        // All the control blocks have the same size, as they have the same type
+        if (bytes == block_size && !free_blocks.empty()) {
+          void * block = free_blocks.back();
+          free_blocks.pop_back();
+          return block;
+        }
+      }
+      return ::operator new(bytes);
+    }
+
+    void
+    put_block(void * block, size_t bytes)
+    {
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (block_size == 0) {
+          block_size = bytes;
+        }
+        if (bytes == block_size && free_blocks.size() < size) {
+          free_blocks.push_back(block);
+          return;
+        }
+      }
+      ::operator delete(block);
+    }
+
+    const size_t size;
+    std::mutex mutex;
+    MessageAlloc allocator;
+    std::vector<MessageT *> free_messages;
+    size_t block_size = 0;
+    std::vector<void *> free_blocks;
+  };
+
+  // Allocator of the shared pointer control blocks, recycling them through the pool state.
+  template<typename T>
+  struct ControlBlockAllocator
+  {
+    using value_type = T;
+
+    explicit ControlBlockAllocator(std::shared_ptr<State> pool_state)
+    : state(std::move(pool_state))
+    {}
+
+    template<typename U>
+    ControlBlockAllocator(const ControlBlockAllocator<U> & other)  // NOLINT(runtime/explicit)
+    : state(other.state)
+    {}
+
+    T *
+    allocate(size_t n)
+    {
+      return static_cast<T *>(state->get_block(n * sizeof(T)));
+    }
+
+    void
+    deallocate(T * ptr, size_t n)
+    {
+      state->put_block(ptr, n * sizeof(T));
+    }
+
+    template<typename U>
+    bool
+    operator==(const ControlBlockAllocator<U> & other) const
+    {
+      return state == other.state;
+    }
+
+    template<typename U>
+    bool
+    operator!=(const ControlBlockAllocator<U> & other) const
+    {
+      return state != other.state;
+    }
+
+    std::shared_ptr<State> state;
+  };
+
+  std::shared_ptr<State> state_;
+};
+
+}  // namespace rclcpp
+
+#endif  // RCLCPP__MESSAGE_POOL_HPP_
@@ -0,0 +1,245 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__MULTIPLEXED_PARAMETER_CLIENT_HPP_
+#define RCLCPP__MULTIPLEXED_PARAMETER_CLIENT_HPP_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <ratio>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "rcl_interfaces/msg/list_parameters_result.hpp"
+#include "rcl_interfaces/msg/parameter_descriptor.hpp"
+#include "rcl_interfaces/msg/set_parameters_result.hpp"
+#include "rcl_interfaces/srv/describe_parameters.hpp"
+#include "rcl_interfaces/srv/get_parameters.hpp"
+#include "rcl_interfaces/srv/list_parameters.hpp"
+#include "rcl_interfaces/srv/set_parameters.hpp"
+#include "rclcpp/callback_group.hpp"
+#include "rclcpp/client.hpp"
+#include "rclcpp/macros.hpp"
+#include "rclcpp/node_interfaces/get_node_base_interface.hpp"
+#include "rclcpp/node_interfaces/get_node_graph_interface.hpp"
+#include "rclcpp/node_interfaces/get_node_services_interface.hpp"
+#include "rclcpp/node_interfaces/node_base_interface.hpp"
+#include "rclcpp/node_interfaces/node_graph_interface.hpp"
+#include "rclcpp/node_interfaces/node_services_interface.hpp"
+#include "rclcpp/parameter.hpp"
+#include "rclcpp/qos.hpp"
+#include "rclcpp/visibility_control.hpp"
+
+namespace rclcpp
+{
+
+/// Asynchronous parameter client for the parameters of many remote nodes.
+/**
+ * Unlike AsyncParametersClient, which creates the six parameter service clients of a single
+ * remote node, the service clients are created when a request is first sent to a node, only
+ * for the services used, and are kept in a pool of bounded size: the clients of the least
+ * recently used node are destroyed when more nodes are queried, unless they have
+ * requests in flight.
+ * This bounds the number of clients to discover and to wait for when querying the
+ * parameters of a whole fleet.
+ *
+ * Parameters requested from a node while a get_parameters() request to it is in flight are
+ * batched into a single request, sent once the response is received.
+ * As with AsyncParametersClient, no parameters are returned if any parameter of the request
+ * isn't declared, which applies to all the requests of a batch.
+ *
+ * The requests in flight are held by the clients of their node: they are dropped, with
+ * their futures failing with std::future_error, when this object is destroyed.
+ * This class is thread-safe.
+ */
+class MultiplexedParameterClient
+{
+public:
+  RCLCPP_SMART_PTR_DEFINITIONS(MultiplexedParameterClient)
+
+  /// Create a parameter client for many remote nodes.
+  /**
+   * \param[in] node_base the base interface of the node creating the service clients
+   * \param[in] node_graph the graph interface of the node creating the service clients
+   * \param[in] node_services the services interface of the node creating the service clients
+   * \param[in] max_remote_nodes the number of remote nodes whose clients are kept
+   * \param[in] qos_profile the QoS of the service clients
+   * \param[in] group the callback group of the service clients, or nullptr for the default
+   * \throws std::invalid_argument if max_remote_nodes is zero
+   */
+  RCLCPP_PUBLIC
+  MultiplexedParameterClient(
+    const rclcpp::node_interfaces::NodeBaseInterface::SharedPtr node_base,
+    const rclcpp::node_interfaces::NodeGraphInterface::SharedPtr node_graph,
+    const rclcpp::node_interfaces::NodeServicesInterface::SharedPtr node_services,
+    size_t max_remote_nodes = 32,
+    const rclcpp::QoS & qos_profile = rclcpp::ParametersQoS(),
+    rclcpp::CallbackGroup::SharedPtr group = nullptr);
+
+  /// Create a parameter client for many remote nodes on the given node.
+  /**
+   * \sa MultiplexedParameterClient()
+   */
+  template<typename NodeT>
+  explicit MultiplexedParameterClient(
+    NodeT && node,
+    size_t max_remote_nodes = 32,
+    const rclcpp::QoS & qos_profile = rclcpp::ParametersQoS(),
+    rclcpp::CallbackGroup::SharedPtr group = nullptr)
+  : MultiplexedParameterClient(
+      rclcpp::node_interfaces::get_node_base_interface(node),
+      rclcpp::node_interfaces::get_node_graph_interface(node),
+      rclcpp::node_interfaces::get_node_services_interface(node),
+      max_remote_nodes,
+      qos_profile,
+      group)
+  {}
+
+  RCLCPP_PUBLIC
+  ~MultiplexedParameterClient();
+
+  /// Get parameters of a remote node, batched with the other requests to the node.
+  /**
+   * \param[in] remote_node_name the fully qualified name of the remote node
+   * \param[in] names the names of the parameters
+   * \param[in] callback (optional) called with the future once it's ready
+   * \return the future of the parameters, empty if any parameter of the batch isn't declared
+   */
+  RCLCPP_PUBLIC
+  std::shared_future<std::vector<rclcpp::Parameter>>
+  get_parameters(
+    const std::string & remote_node_name,
+    const std::vector<std::string> & names,
+    std::function<
+      void(std::shared_future<std::vector<rclcpp::Parameter>>)
+    > callback = nullptr);
+
+  RCLCPP_PUBLIC
+  std::shared_future<std::vector<rcl_interfaces::msg::ParameterDescriptor>>
+  describe_parameters(
+    const std::string & remote_node_name,
+    const std::vector<std::string> & names,
+    std::function<
+      void(std::shared_future<std::vector<rcl_interfaces::msg::ParameterDescriptor>>)
+    > callback = nullptr);
+
+  RCLCPP_PUBLIC
+  std::shared_future<std::vector<rcl_interfaces::msg::SetParametersResult>>
+  set_parameters(
+    const std::string & remote_node_name,
+    const std::vector<rclcpp::Parameter> & parameters,
+    std::function<
+      void(std::shared_future<std::vector<rcl_interfaces::msg::SetParametersResult>>)
+    > callback = nullptr);
+
+  RCLCPP_PUBLIC
+  std::shared_future<rcl_interfaces::msg::ListParametersResult>
+  list_parameters(
+    const std::string & remote_node_name,
+    const std::vector<std::string> & prefixes,
+    uint64_t depth,
+    std::function<
+      void(std::shared_future<rcl_interfaces::msg::ListParametersResult>)
+    > callback = nullptr);
+
+  /// Return true if the parameter services of the remote node used by this class are ready.
+  /**
+   * The clients of the services are created if needed, so that they are discovered.
+   * Requests sent before their service is discovered may be lost with some middlewares, so
+   * this or wait_for_service() should be used before the first request to a node.
+   */
+  RCLCPP_PUBLIC
+  bool
+  service_is_ready(const std::string & remote_node_name);
+
+  /// Wait for the parameter services of the remote node used by this class to be ready.
+  /**
+   * \param[in] remote_node_name the fully qualified name of the remote node
+   * \param[in] timeout maximum time to wait, negative to wait forever
+   * \return `true` if the services are ready and the timeout is not over, `false` otherwise
+   */
+  template<typename RepT = int64_t, typename RatioT = std::milli>
+  bool
+  wait_for_service(
+    const std::string & remote_node_name,
+    std::chrono::duration<RepT, RatioT> timeout = std::chrono::duration<RepT, RatioT>(-1))
+  {
+    return wait_for_service_nanoseconds(
+      remote_node_name, std::chrono::duration_cast<std::chrono::nanoseconds>(timeout));
+  }
+
+  /// Get the number of remote nodes whose clients are currently kept.
+  RCLCPP_PUBLIC
+  size_t
+  get_number_of_remote_nodes() const;
+
+protected:
+  RCLCPP_PUBLIC
+  bool
+  wait_for_service_nanoseconds(
+    const std::string & remote_node_name, std::chrono::nanoseconds timeout);
+
+private:
+  RCLCPP_DISABLE_COPY(MultiplexedParameterClient)
+
+  /// Get the clients of all the services of the remote node, creating them if needed.
+  std::vector<rclcpp::ClientBase::SharedPtr>
+  get_all_clients(const std::string & remote_node_name);
+
+  struct RemoteNode;
+  struct GetParametersBatch;
+
+  /// Get the clients of a remote node, most recently used, evicting others if needed.
+  std::shared_ptr<RemoteNode>
+  get_remote_node(const std::string & remote_node_name);
+
+  /// Create the service client of the remote node if needed.
+  template<typename ServiceT>
+  typename rclcpp::Client<ServiceT>::SharedPtr
+  get_client(
+    RemoteNode & remote_node,
+    typename rclcpp::Client<ServiceT>::SharedPtr & client,
+    const char * service_name);
+
+  /// Send the batch queued for the remote node, if any. Requires mutex_.
+  void
+  send_queued_batch(const std::shared_ptr<RemoteNode> & remote_node);
+
+  /// Note that a request of the remote node completed.
+  void
+  finish_request(const std::weak_ptr<RemoteNode> & remote_node);
+
+  rclcpp::node_interfaces::NodeBaseInterface::SharedPtr node_base_;
+  rclcpp::node_interfaces::NodeGraphInterface::SharedPtr node_graph_;
+  rclcpp::node_interfaces::NodeServicesInterface::SharedPtr node_services_;
+  const size_t max_remote_nodes_;
+  const rclcpp::QoS qos_profile_;
+  rclcpp::CallbackGroup::SharedPtr group_;
+
+  mutable std::mutex mutex_;
+  // Most recently used first, the map indexes it by fully qualified name
+  std::list<std::shared_ptr<RemoteNode>> lru_;
+  std::unordered_map<std::string, std::list<std::shared_ptr<RemoteNode>>::iterator> remote_nodes_;
+};
+
+}  // namespace rclcpp
+
+#endif  // RCLCPP__MULTIPLEXED_PARAMETER_CLIENT_HPP_
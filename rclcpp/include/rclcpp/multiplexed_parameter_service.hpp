@@ -0,0 +1,132 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef RCLCPP__MULTIPLEXED_PARAMETER_SERVICE_HPP_
+#define RCLCPP__MULTIPLEXED_PARAMETER_SERVICE_HPP_
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+
+#include "rcl_interfaces/srv/describe_parameters.hpp"
+#include "rcl_interfaces/srv/get_parameter_types.hpp"
+#include "rcl_interfaces/srv/get_parameters.hpp"
+#include "rcl_interfaces/srv/list_parameters.hpp"
+#include "rcl_interfaces/srv/set_parameters.hpp"
+#include "rcl_interfaces/srv/set_parameters_atomically.hpp"
+#include "rclcpp/macros.hpp"
+#include "rclcpp/node_interfaces/get_node_base_interface.hpp"
+#include "rclcpp/node_interfaces/get_node_parameters_interface.hpp"
+#include "rclcpp/node_interfaces/node_base_interface.hpp"
+#include "rclcpp/node_interfaces/node_parameters_interface.hpp"
+#include "rclcpp/node_interfaces/node_services_interface.hpp"
+#include "rclcpp/qos.hpp"
+#include "rclcpp/service.hpp"
+#include "rclcpp/visibility_control.hpp"
+
+namespace rclcpp
+{
+
+/// Parameter services of a single node serving the parameters of many nodes.
+/**
+ * The six parameter services of a node are created once, on the node given to the constructor,
+ * instead of for each node of the process, which reduces the number of endpoints to discover.
+ * The nodes added to it would typically be created with
+ * rclcpp::NodeOptions::start_parameter_services() set to false.
+ *
+ * The parameters of an added node are named after the fully qualified name of the node and
+ * the name of the parameter, separated with a colon, e.g. "/ns/node:use_sim_time".
+ * Setting parameters atomically is only possible for parameters of the same node.
+ *
+ * The nodes are held weakly, and are no longer served once destroyed.
+ */
+class MultiplexedParameterService
+{
+public:
+  RCLCPP_SMART_PTR_DEFINITIONS(MultiplexedParameterService)
+
+  /// Separator between the name of a node and the names of its parameters.
+  static constexpr char separator = ':';
+
+  /// Create the parameter services on the given node.
+  /**
+   * The parameters of this node are only served if it's added as the other nodes.
+   *
+   * \param[in] node_base the base interface of the node hosting the services
+   * \param[in] node_services the services interface of the node hosting the services
+   * \param[in] qos_profile the QoS of the services
+   */
+  RCLCPP_PUBLIC
+  MultiplexedParameterService(
+    const std::shared_ptr<node_interfaces::NodeBaseInterface> node_base,
+    const std::shared_ptr<node_interfaces::NodeServicesInterface> node_services,
+    const rclcpp::QoS & qos_profile = rclcpp::ParametersQoS());
+
+  /// Serve the parameters of a node.
+  /**
+   * \param[in] node the node, or its interfaces, whose parameters are served
+   * \throws std::invalid_argument if a node with the same fully qualified name was added
+   */
+  template<typename NodeT>
+  void
+  add_node(NodeT && node)
+  {
+    this->add_node(
+      rclcpp::node_interfaces::get_node_base_interface(node)->get_fully_qualified_name(),
+      rclcpp::node_interfaces::get_node_parameters_interface(node));
+  }
+
+  /// Serve the parameters of a node, named after the given fully qualified name.
+  /**
+   * \throws std::invalid_argument if a node with the same fully qualified name was added
+   */
+  RCLCPP_PUBLIC
+  void
+  add_node(
+    const std::string & fully_qualified_name,
+    node_interfaces::NodeParametersInterface::SharedPtr node_parameters);
+
+  /// Stop serving the parameters of a node.
+  /**
+   * \return true if the node was served, otherwise false
+   */
+  RCLCPP_PUBLIC
+  bool
+  remove_node(const std::string & fully_qualified_name);
+
+private:
+  /// Return the node owning the parameter and set name to the name of the parameter in it.
+  node_interfaces::NodeParametersInterface::SharedPtr
+  find_node(std::string & name);
+
+  std::mutex nodes_mutex_;
+  std::map<std::string, node_interfaces::NodeParametersInterface::WeakPtr> nodes_;
+
+  rclcpp::Service<rcl_interfaces::srv::GetParameters>::SharedPtr get_parameters_service_;
+  rclcpp::Service<rcl_interfaces::srv::GetParameterTypes>::SharedPtr
+    get_parameter_types_service_;
+  rclcpp::Service<rcl_interfaces::srv::SetParameters>::SharedPtr set_parameters_service_;
+  rclcpp::Service<rcl_interfaces::srv::SetParametersAtomically>::SharedPtr
+    set_parameters_atomically_service_;
+  rclcpp::Service<rcl_interfaces::srv::DescribeParameters>::SharedPtr
+    describe_parameters_service_;
+  rclcpp::Service<rcl_interfaces::srv::ListParameters>::SharedPtr list_parameters_service_;
+};
+
+}  // namespace rclcpp
+
+#endif  // RCLCPP__MULTIPLEXED_PARAMETER_SERVICE_HPP_
@@ -0,0 +1,167 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__NAMESPACE_VIEW_HPP_
+#define RCLCPP__NAMESPACE_VIEW_HPP_
+
+#include <string>
+#include <utility>
+
+#include "rclcpp/node.hpp"
+#include "rclcpp/visibility_control.hpp"
+
+namespace rclcpp
+{
+
+/// View of a node extending the namespace of the entities created with it, as a sub-node.
+/**
+ * Unlike Node::create_sub_node(), no node is created: the view only holds the node and its
+ * sub-namespace, and the entities are created by the node, with their names extended.
+ * Views are cheap to create and to copy, and keep the node alive.
+ *
+ * Only entities with names are created through a view, the node is used for the others.
+ *
+ * \sa Node::create_namespace_view()
+ */
+class NamespaceView
+{
+public:
+  /// Get the node of the view.
+  RCLCPP_PUBLIC
+  const rclcpp::Node::SharedPtr &
+  get_node() const;
+
+  /// Get the sub-namespace of the entities created with this view.
+  /**
+   * It includes the sub-namespace of the node, if it's a sub-node.
+   *
+   * \sa Node::get_sub_namespace()
+   */
+  RCLCPP_PUBLIC
+  std::string
+  get_sub_namespace() const;
+
+  /// Get the namespace of the entities created with this view.
+  /**
+   * \sa Node::get_effective_namespace()
+   */
+  RCLCPP_PUBLIC
+  std::string
+  get_effective_namespace() const;
+
+  /// Create a view further extending the namespace of this view.
+  /**
+   * \param[in] sub_namespace the sub-namespace extending the one of this view
+   * \return the view of the node with the extended sub-namespace
+   * \throws NameValidationError if the sub-namespace is empty or absolute
+   * \throws InvalidNamespaceError if the extended namespace is invalid
+   */
+  RCLCPP_PUBLIC
+  NamespaceView
+  create_namespace_view(const std::string & sub_namespace) const;
+
+  /// Get a name extended with the sub-namespace of this view, relative to the node.
+  /**
+   * Absolute and private names are not extended.
+   */
+  RCLCPP_PUBLIC
+  std::string
+  extend_name(const std::string & name) const;
+
+  /// Create a publisher in the namespace of this view.
+  /**
+   * \sa Node::create_publisher()
+   */
+  template<typename MessageT, typename ... Args>
+  auto
+  create_publisher(const std::string & topic_name, Args && ... args) const
+  {
+    return node_->template create_publisher<MessageT>(
+      extend_name(topic_name), std::forward<Args>(args)...);
+  }
+
+  /// Create a subscription in the namespace of this view.
+  /**
+   * \sa Node::create_subscription()
+   */
+  template<typename MessageT, typename ... Args>
+  auto
+  create_subscription(const std::string & topic_name, Args && ... args) const
+  {
+    return node_->template create_subscription<MessageT>(
+      extend_name(topic_name), std::forward<Args>(args)...);
+  }
+
+  /// Create a client in the namespace of this view.
+  /**
+   * \sa Node::create_client()
+   */
+  template<typename ServiceT, typename ... Args>
+  auto
+  create_client(const std::string & service_name, Args && ... args) const
+  {
+    return node_->template create_client<ServiceT>(
+      extend_name(service_name), std::forward<Args>(args)...);
+  }
+
+  /// Create a service in the namespace of this view.
+  /**
+   * \sa Node::create_service()
+   */
+  template<typename ServiceT, typename ... Args>
+  auto
+  create_service(const std::string & service_name, Args && ... args) const
+  {
+    return node_->template create_service<ServiceT>(
+      extend_name(service_name), std::forward<Args>(args)...);
+  }
+
+  /// Create a generic publisher in the namespace of this view.
+  /**
+   * \sa Node::create_generic_publisher()
+   */
+  template<typename ... Args>
+  auto
+  create_generic_publisher(const std::string & topic_name, Args && ... args) const
+  {
+    return node_->create_generic_publisher(extend_name(topic_name), std::forward<Args>(args)...);
+  }
+
+  /// Create a generic subscription in the namespace of this view.
+  /**
+   * \sa Node::create_generic_subscription()
+   */
+  template<typename ... Args>
+  auto
+  create_generic_subscription(const std::string & topic_name, Args && ... args) const
+  {
+    return node_->create_generic_subscription(
+      extend_name(topic_name), std::forward<Args>(args)...);
+  }
+
+private:
+  friend class rclcpp::Node;
+
+  /// Construct a view, with a sub-namespace which was validated.
+  RCLCPP_LOCAL
+  NamespaceView(rclcpp::Node::SharedPtr node, std::string sub_namespace);
+
+  rclcpp::Node::SharedPtr node_;
+  // Relative to the sub-namespace of the node, which extends the names again
+  std::string sub_namespace_;
+};
+
+}  // namespace rclcpp
+
+#endif  // RCLCPP__NAMESPACE_VIEW_HPP_
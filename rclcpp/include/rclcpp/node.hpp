@@ -74,6 +74,8 @@
 namespace rclcpp
 {
 
+class NamespaceView;
+
 /// Node is the single point of entry for creating publishers and subscribers.
 class Node : public std::enable_shared_from_this<Node>
 {
@@ -277,6 +279,8 @@ public:
    * \param[in] service_name The name on which the service is accessible.
    * \param[in] qos Quality of service profile for client.
    * \param[in] group Callback group to handle the reply to service calls.
+   * \param[in] pool_size Number of response objects reused by the client,
+   *   zero to allocate them for every response.
    * \return Shared pointer to the created client.
    */
   template<typename ServiceT>
@@ -284,7 +288,8 @@ public:
   create_client(
     const std::string & service_name,
     const rclcpp::QoS & qos = rclcpp::ServicesQoS(),
-    rclcpp::CallbackGroup::SharedPtr group = nullptr);
+    rclcpp::CallbackGroup::SharedPtr group = nullptr,
+    size_t pool_size = 0);
 
   /// Create and return a Service.
   /**
@@ -310,6 +315,8 @@ public:
    * \param[in] callback User-defined callback function.
    * \param[in] qos Quality of service profile for the service.
    * \param[in] group Callback group to call the service.
+   * \param[in] pool_size Number of request and response objects reused by the service,
+   *   zero to allocate them for every request.
    * \return Shared pointer to the created service.
    */
   template<typename ServiceT, typename CallbackT>
@@ -318,7 +325,8 @@ public:
     const std::string & service_name,
     CallbackT && callback,
     const rclcpp::QoS & qos = rclcpp::ServicesQoS(),
-    rclcpp::CallbackGroup::SharedPtr group = nullptr);
+    rclcpp::CallbackGroup::SharedPtr group = nullptr,
+    size_t pool_size = 0);
 
   /// Create and return a GenericPublisher.
   /**
@@ -369,6 +377,24 @@ public:
     )
   );
 
+  /// Create and return a GenericSubscription delivering views of the serialized messages.
+  /**
+   * The callback receives a view of the serialized data, valid only for the duration of the
+   * callback, and the message info.
+   * \sa rclcpp::Node::create_generic_subscription() for the other parameters.
+   */
+  template<typename AllocatorT = std::allocator<void>>
+  std::shared_ptr<rclcpp::GenericSubscription> create_generic_subscription(
+    const std::string & topic_name,
+    const std::string & topic_type,
+    const rclcpp::QoS & qos,
+    std::function<void(
+      const rclcpp::SerializedMessageView &, const rclcpp::MessageInfo &)> view_callback,
+    const rclcpp::SubscriptionOptionsWithAllocator<AllocatorT> & options = (
+      rclcpp::SubscriptionOptionsWithAllocator<AllocatorT>()
+    )
+  );
+
   /// Declare and initialize a parameter, return the effective value.
   /**
    * This method is used to declare that a parameter exists on this node.
@@ -839,6 +865,31 @@ public:
     const std::string & name,
     const ParameterT & alternative_value) const;
 
+  /// Return a handle to read the value of a declared parameter without locking.
+  /**
+   * Getting the value of a parameter by its name looks it up while holding the
+   * lock of the node's parameters.
+   * The returned handle is meant to be obtained once, e.g. right after the
+   * parameter was declared, and then to be used where the value is read often,
+   * e.g. in a control loop: reading from it neither looks the parameter up nor
+   * takes the lock of the node's parameters.
+   *
+   * The value of the handle is updated whenever the parameter is successfully
+   * set, after the callbacks registered with `add_on_set_parameters_callback`
+   * accepted it.
+   * If the parameter is undeclared, the handle is invalidated, see
+   * rclcpp::node_interfaces::ParameterHandle::is_valid().
+   *
+   * \param[in] name The name of the parameter.
+   * \return The handle to the parameter, the same one for every call until the
+   *   parameter is undeclared.
+   * \throws rclcpp::exceptions::ParameterNotDeclaredException if the parameter
+   *   has not been declared.
+   */
+  RCLCPP_PUBLIC
+  rclcpp::node_interfaces::ParameterHandle::SharedPtr
+  get_parameter_handle(const std::string & name);
+
   /// Return the parameters by the given parameter names.
   /**
    * Like get_parameter(const std::string &), this method may throw the
@@ -1593,6 +1644,24 @@ public:
   rclcpp::Node::SharedPtr
   create_sub_node(const std::string & sub_namespace);
 
+  /// Create a view of this node, which extends the namespace of the entities created with it.
+  /**
+   * The view extends the namespace of entities as a sub-node created with create_sub_node()
+   * would, but it only holds this node and the sub-namespace, instead of being another node.
+   * This suits a large number of sub-namespaces, e.g. one for each channel of a driver.
+   *
+   * This node must be owned by a shared pointer.
+   *
+   * \sa rclcpp::NamespaceView
+   * \param[in] sub_namespace sub-namespace of the view, relative to the one of this node
+   * \return the view of this node
+   * \throws NameValidationError if the sub-namespace is empty or absolute
+   * \throws InvalidNamespaceError if the extended namespace is invalid
+   */
+  RCLCPP_PUBLIC
+  rclcpp::NamespaceView
+  create_namespace_view(const std::string & sub_namespace);
+
   /// Return the NodeOptions used when creating this node.
   RCLCPP_PUBLIC
   const rclcpp::NodeOptions &
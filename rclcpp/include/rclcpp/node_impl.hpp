@@ -143,7 +143,8 @@ typename Client<ServiceT>::SharedPtr
 Node::create_client(
   const std::string & service_name,
   const rclcpp::QoS & qos,
-  rclcpp::CallbackGroup::SharedPtr group)
+  rclcpp::CallbackGroup::SharedPtr group,
+  size_t pool_size)
 {
   return rclcpp::create_client<ServiceT>(
     node_base_,
@@ -151,7 +152,8 @@ Node::create_client(
     node_services_,
     extend_name_with_sub_namespace(service_name, this->get_sub_namespace()),
     qos,
-    group);
+    group,
+    pool_size);
 }
 
 template<typename ServiceT>
@@ -176,7 +178,8 @@ Node::create_service(
   const std::string & service_name,
   CallbackT && callback,
   const rclcpp::QoS & qos,
-  rclcpp::CallbackGroup::SharedPtr group)
+  rclcpp::CallbackGroup::SharedPtr group,
+  size_t pool_size)
 {
   return rclcpp::create_service<ServiceT, CallbackT>(
     node_base_,
@@ -184,7 +187,8 @@ Node::create_service(
     extend_name_with_sub_namespace(service_name, this->get_sub_namespace()),
     std::forward<CallbackT>(callback),
     qos,
-    group);
+    group,
+    pool_size);
 }
 
 template<typename ServiceT, typename CallbackT>
@@ -240,6 +244,26 @@ Node::create_generic_subscription(
   );
 }
 
+template<typename AllocatorT>
+std::shared_ptr<rclcpp::GenericSubscription>
+Node::create_generic_subscription(
+  const std::string & topic_name,
+  const std::string & topic_type,
+  const rclcpp::QoS & qos,
+  std::function<void(
+    const rclcpp::SerializedMessageView &, const rclcpp::MessageInfo &)> view_callback,
+  const rclcpp::SubscriptionOptionsWithAllocator<AllocatorT> & options)
+{
+  return rclcpp::create_generic_subscription(
+    node_topics_,
+    extend_name_with_sub_namespace(topic_name, this->get_sub_namespace()),
+    topic_type,
+    qos,
+    std::move(view_callback),
+    options
+  );
+}
+
 
 template<typename ParameterT>
 auto
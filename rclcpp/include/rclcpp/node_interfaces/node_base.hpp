@@ -15,10 +15,12 @@
 #ifndef RCLCPP__NODE_INTERFACES__NODE_BASE_HPP_
 #define RCLCPP__NODE_INTERFACES__NODE_BASE_HPP_
 
+#include <array>
 #include <atomic>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "rcl/node.h"
@@ -30,6 +32,11 @@
 
 namespace rclcpp
 {
+namespace executors
+{
+class SingleThreadedExecutor;
+}  // namespace executors
+
 namespace node_interfaces
 {
 
@@ -141,10 +148,35 @@ public:
   bool
   get_enable_topic_statistics_default() const override;
 
+  /// Expand and remap a given topic or service name, caching the result.
+  /**
+   * Once resolved, a name is looked up in a cache of the node instead of being expanded and
+   * remapped again, e.g. for the many endpoints with the same name created by a bridge.
+   * \sa clear_resolved_names()
+   */
   std::string
   resolve_topic_or_service_name(
     const std::string & name, bool is_service, bool only_expand = false) const override;
 
+  /// Drop the names cached by resolve_topic_or_service_name().
+  /**
+   * The cached names are only valid as long as the name, the namespace and the remap rules of
+   * the node are unchanged, this must be called after changing them through its rcl handle.
+   */
+  RCLCPP_PUBLIC
+  void
+  clear_resolved_names();
+
+  /// Return the executor spinning this node in rclcpp::spin_some() and rclcpp::spin_all().
+  /**
+   * The executor is created on first use and kept by the node, so that repeated calls reuse
+   * its wait set and entity collections instead of setting up a new executor every time.
+   * It's created again if the global default context, which it uses, was initialized again.
+   */
+  RCLCPP_PUBLIC
+  std::shared_ptr<rclcpp::executors::SingleThreadedExecutor>
+  get_spin_executor();
+
 private:
   RCLCPP_DISABLE_COPY(NodeBase)
 
@@ -164,6 +196,15 @@ private:
   mutable std::recursive_mutex notify_guard_condition_mutex_;
   std::shared_ptr<rclcpp::GuardCondition> notify_guard_condition_;
   bool notify_guard_condition_is_valid_;
+
+  /// Names resolved so far, by input name, indexed by is_service + 2 * only_expand.
+  mutable std::mutex resolved_names_mutex_;
+  mutable std::array<std::unordered_map<std::string, std::string>, 4> resolved_names_;
+
+  /// Executor of the spin helpers, and the rcl context of the global default context it uses.
+  std::mutex spin_executor_mutex_;
+  std::weak_ptr<rcl_context_t> spin_executor_rcl_context_;
+  std::shared_ptr<rclcpp::executors::SingleThreadedExecutor> spin_executor_;
 };
 
 }  // namespace node_interfaces
@@ -18,11 +18,14 @@
 #include <atomic>
 #include <chrono>
 #include <condition_variable>
+#include <list>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <string>
 #include <tuple>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -147,6 +150,18 @@ public:
   size_t
   count_graph_users() const override;
 
+  RCLCPP_PUBLIC
+  void
+  set_graph_cache_enabled(bool enabled) override;
+
+  RCLCPP_PUBLIC
+  bool
+  is_graph_cache_enabled() const override;
+
+  RCLCPP_PUBLIC
+  uint64_t
+  get_graph_generation() const override;
+
   RCLCPP_PUBLIC
   std::vector<rclcpp::TopicEndpointInfo>
   get_publishers_info_by_topic(
@@ -159,6 +174,15 @@ public:
     const std::string & topic_name,
     bool no_mangle = false) const override;
 
+  RCLCPP_PUBLIC
+  rclcpp::GraphChangeCallbackHandle::SharedPtr
+  add_graph_change_callback(
+    rclcpp::GraphChangeCallbackHandle::GraphChangeCallbackType callback) override;
+
+  RCLCPP_PUBLIC
+  void
+  remove_graph_change_callback(const rclcpp::GraphChangeCallbackHandle * const handle) override;
+
 private:
   RCLCPP_DISABLE_COPY(NodeGraph)
 
@@ -179,6 +203,59 @@ private:
   /// Number of graph events out on loan, used to determine if the graph should be monitored.
   /** graph_users_count_ is atomic so that it can be accessed without acquiring the graph_mutex_ */
   std::atomic_size_t graph_users_count_;
+
+  /// Snapshot of the results of the graph queries, valid for a given graph generation.
+  struct GraphCache
+  {
+    uint64_t generation = 0;
+    /// Topic names and types, indexed by the no_demangle argument.
+    std::optional<std::map<std::string, std::vector<std::string>>> topic_names_and_types[2];
+    std::optional<std::vector<std::pair<std::string, std::string>>> node_names_and_namespaces;
+    /// Number of publishers and subscribers, indexed by fully qualified topic name.
+    std::unordered_map<std::string, size_t> publisher_counts;
+    std::unordered_map<std::string, size_t> subscriber_counts;
+  };
+
+  /// Drop the cached queries if the graph changed since they were cached.
+  /** This function requires the graph_cache_mutex_ to be locked. */
+  void
+  validate_graph_cache() const;
+
+  /// Number of graph changes notified by the graph listener.
+  std::atomic_uint64_t graph_generation_;
+  /// Whether or not the graph queries are cached.
+  std::atomic_bool graph_cache_enabled_;
+  /// Mutex to guard the graph cache.
+  mutable std::mutex graph_cache_mutex_;
+  /// Cached graph queries, filled lazily.
+  mutable GraphCache graph_cache_;
+  /// Graph event keeping this node monitored by the graph listener while caching.
+  rclcpp::Event::SharedPtr graph_cache_event_;
+
+  /// Nodes, topics and services of the graph, compared to find the graph changes.
+  struct GraphSnapshot
+  {
+    std::map<std::string, std::vector<std::string>> nodes;
+    std::map<std::string, std::vector<std::string>> topics;
+    std::map<std::string, std::vector<std::string>> services;
+  };
+
+  /// Query the nodes, topics and services of the graph.
+  GraphSnapshot
+  take_graph_snapshot() const;
+
+  /// Give the changes of the graph since the last snapshot to the graph change callbacks.
+  void
+  dispatch_graph_changes();
+
+  /// Mutex to guard the graph change callbacks and the last snapshot.
+  std::mutex graph_change_mutex_;
+  /// Callbacks registered with add_graph_change_callback().
+  std::list<rclcpp::GraphChangeCallbackHandle::WeakPtr> graph_change_callbacks_;
+  /// Graph when the changes were last dispatched.
+  GraphSnapshot graph_snapshot_;
+  /// Graph event keeping this node monitored by the graph listener while callbacks are set.
+  rclcpp::Event::SharedPtr graph_change_event_;
 };
 
 }  // namespace node_interfaces
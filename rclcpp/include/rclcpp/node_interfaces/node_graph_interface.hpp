@@ -18,6 +18,8 @@
 #include <algorithm>
 #include <array>
 #include <chrono>
+#include <cstdint>
+#include <functional>
 #include <map>
 #include <string>
 #include <tuple>
@@ -143,6 +145,42 @@ private:
   rosidl_type_hash_t topic_type_hash_;
 };
 
+/// A change of the ROS graph, found by comparing two snapshots of the graph.
+struct GraphChange
+{
+  enum class Kind
+  {
+    NodeAdded,
+    NodeRemoved,
+    TopicAdded,
+    TopicRemoved,
+    ServiceAdded,
+    ServiceRemoved,
+  };
+
+  /// What changed.
+  Kind kind;
+  /// Fully qualified name of the node, topic or service.
+  std::string name;
+  /// Types of the topic or service, empty for a node.
+  /**
+   * A topic or service whose types change is removed with its previous types, then added
+   * with its new ones.
+   */
+  std::vector<std::string> types;
+};
+
+/// Handle of a callback registered with NodeGraphInterface::add_graph_change_callback().
+struct GraphChangeCallbackHandle
+{
+  RCLCPP_SMART_PTR_DEFINITIONS(GraphChangeCallbackHandle)
+
+  using GraphChangeCallbackType =
+    std::function<void (const std::vector<rclcpp::GraphChange> &)>;
+
+  GraphChangeCallbackType callback;
+};
+
 namespace node_interfaces
 {
 
@@ -385,6 +423,43 @@ public:
   size_t
   count_graph_users() const = 0;
 
+  /// Enable or disable caching the results of the most common graph queries.
+  /**
+   * When enabled, get_topic_names_and_types(), get_node_names(),
+   * get_node_names_and_namespaces(), count_publishers() and count_subscribers() are
+   * served from a snapshot of the graph taken the first time they are called, until the
+   * graph listener notifies a graph change, see get_graph_generation().
+   * The cache holds a graph event, so this node is monitored by the graph listener as
+   * long as the cache is enabled.
+   *
+   * Graph changes are delivered asynchronously by the graph listener thread, so cached
+   * queries may not reflect changes that happened immediately before the call.
+   *
+   * \param[in] enabled true to enable the cache, false to disable it and drop the snapshot.
+   */
+  RCLCPP_PUBLIC
+  virtual
+  void
+  set_graph_cache_enabled(bool enabled) = 0;
+
+  /// Return true if the graph queries are cached, see set_graph_cache_enabled().
+  RCLCPP_PUBLIC
+  virtual
+  bool
+  is_graph_cache_enabled() const = 0;
+
+  /// Return a counter incremented every time a graph change is notified.
+  /**
+   * Callers can compare this value with the one returned by a previous call to cheaply
+   * check whether the graph changed in the meantime, without querying the graph.
+   * This counter is only updated while this node is monitored by the graph listener, i.e.
+   * while graph events are out on loan or the graph cache is enabled.
+   */
+  RCLCPP_PUBLIC
+  virtual
+  uint64_t
+  get_graph_generation() const = 0;
+
   /// Return the topic endpoint information about publishers on a given topic.
   /**
    * \param[in] topic_name the actual topic name used; it will not be automatically remapped.
@@ -408,6 +483,36 @@ public:
   virtual
   std::vector<rclcpp::TopicEndpointInfo>
   get_subscriptions_info_by_topic(const std::string & topic_name, bool no_mangle = false) const = 0;
+
+  /// Add a callback called with the changes of the graph, as they are notified.
+  /**
+   * On each graph change notified by the graph listener, the nodes, topics and services of
+   * the graph are queried once, and their differences with the previous query are given to
+   * all the callbacks, rather than each user querying the whole graph again.
+   * Changes which are undone before the graph listener notifies them aren't reported, and
+   * the endpoints of the topics and services aren't compared, only their names and types.
+   *
+   * The callbacks are called by the graph listener thread, so they should return quickly.
+   * The node is monitored by the graph listener as long as a callback is registered.
+   *
+   * \param[in] callback the callback to call with the changes of the graph
+   * \return the handle of the callback, which must be kept to keep the callback registered
+   */
+  RCLCPP_PUBLIC
+  virtual
+  rclcpp::GraphChangeCallbackHandle::SharedPtr
+  add_graph_change_callback(
+    rclcpp::GraphChangeCallbackHandle::GraphChangeCallbackType callback) = 0;
+
+  /// Remove a callback registered with add_graph_change_callback().
+  /**
+   * \param[in] handle the handle returned by add_graph_change_callback()
+   * \throws std::runtime_error if the callback isn't registered
+   */
+  RCLCPP_PUBLIC
+  virtual
+  void
+  remove_graph_change_callback(const rclcpp::GraphChangeCallbackHandle * const handle) = 0;
 };
 
 }  // namespace node_interfaces
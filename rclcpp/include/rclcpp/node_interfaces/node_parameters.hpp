@@ -15,11 +15,13 @@
 #ifndef RCLCPP__NODE_INTERFACES__NODE_PARAMETERS_HPP_
 #define RCLCPP__NODE_INTERFACES__NODE_PARAMETERS_HPP_
 
+#include <chrono>
 #include <list>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "rcutils/macros.h"
@@ -29,15 +31,18 @@
 #include "rcl_interfaces/msg/parameter_event.hpp"
 #include "rcl_interfaces/msg/set_parameters_result.hpp"
 
+#include "rclcpp/lock_profiling.hpp"
 #include "rclcpp/macros.hpp"
 #include "rclcpp/node_interfaces/node_base_interface.hpp"
 #include "rclcpp/node_interfaces/node_logging_interface.hpp"
 #include "rclcpp/node_interfaces/node_parameters_interface.hpp"
 #include "rclcpp/node_interfaces/node_services_interface.hpp"
+#include "rclcpp/node_interfaces/node_timers_interface.hpp"
 #include "rclcpp/node_interfaces/node_topics_interface.hpp"
 #include "rclcpp/parameter.hpp"
 #include "rclcpp/parameter_service.hpp"
 #include "rclcpp/publisher.hpp"
+#include "rclcpp/timer.hpp"
 #include "rclcpp/visibility_control.hpp"
 
 namespace rclcpp
@@ -110,6 +115,32 @@ public:
     bool allow_undeclared_parameters,
     bool automatically_declare_parameters_from_overrides);
 
+  /// Constructor, coalescing the parameter events over the given period.
+  /**
+   * If parameter_event_coalescing_period is greater than zero, the parameter changes
+   * made within that period are published as a single event, by a timer created with
+   * node_timers.
+   *
+   * \sa rclcpp::NodeOptions::parameter_event_coalescing_period
+   * \throws std::invalid_argument if events are coalesced and node_timers is nullptr
+   */
+  RCLCPP_PUBLIC
+  NodeParameters(
+    const node_interfaces::NodeBaseInterface::SharedPtr node_base,
+    const node_interfaces::NodeLoggingInterface::SharedPtr node_logging,
+    const node_interfaces::NodeTopicsInterface::SharedPtr node_topics,
+    const node_interfaces::NodeServicesInterface::SharedPtr node_services,
+    const node_interfaces::NodeClockInterface::SharedPtr node_clock,
+    const std::vector<Parameter> & parameter_overrides,
+    bool start_parameter_services,
+    bool start_parameter_event_publisher,
+    const rclcpp::QoS & parameter_event_qos,
+    const rclcpp::PublisherOptionsBase & parameter_event_publisher_options,
+    bool allow_undeclared_parameters,
+    bool automatically_declare_parameters_from_overrides,
+    const node_interfaces::NodeTimersInterface::SharedPtr node_timers,
+    std::chrono::milliseconds parameter_event_coalescing_period);
+
   RCLCPP_PUBLIC
   virtual
   ~NodeParameters();
@@ -132,6 +163,14 @@ public:
     rcl_interfaces::msg::ParameterDescriptor(),
     bool ignore_override = false) override;
 
+  RCLCPP_PUBLIC
+  std::vector<rclcpp::ParameterValue>
+  declare_parameters(
+    const std::vector<
+      std::pair<rclcpp::Parameter, rcl_interfaces::msg::ParameterDescriptor>
+    > & parameters,
+    bool ignore_override = false) override;
+
   RCLCPP_PUBLIC
   void
   undeclare_parameter(const std::string & name) override;
@@ -170,6 +209,10 @@ public:
     const std::string & prefix,
     std::map<std::string, rclcpp::Parameter> & parameters) const override;
 
+  RCLCPP_PUBLIC
+  ParameterHandle::SharedPtr
+  get_parameter_handle(const std::string & name) override;
+
   RCLCPP_PUBLIC
   std::vector<rcl_interfaces::msg::ParameterDescriptor>
   describe_parameters(const std::vector<std::string> & names) const override;
@@ -228,7 +271,23 @@ protected:
 private:
   RCLCPP_DISABLE_COPY(NodeParameters)
 
-  mutable std::recursive_mutex mutex_;
+  /// Update the handles of the given parameters, after they were set or undeclared.
+  void
+  update_parameter_handles(const std::vector<rclcpp::Parameter> & parameters);
+
+  /// Publish the given event, or merge it with the pending one if events are coalesced.
+  /**
+   * The values of the event are moved from, rather than copied.
+   */
+  void
+  publish_parameter_event(rcl_interfaces::msg::ParameterEvent & parameter_event);
+
+  /// Publish the changes merged since the coalescing period started.
+  void
+  publish_pending_parameter_event();
+
+  mutable rclcpp::lock_profiling::ProfiledMutex<std::recursive_mutex> mutex_{
+    "rclcpp::node_interfaces::NodeParameters::mutex_"};
 
   // There are times when we don't want to allow modifications to parameters
   // (particularly when a set_parameter callback tries to call set_parameter,
@@ -243,12 +302,23 @@ private:
 
   std::map<std::string, ParameterInfo> parameters_;
 
+  // Handles given out for the declared parameters, updated whenever their value changes.
+  std::map<std::string, ParameterHandle::SharedPtr> parameter_handles_;
+
   std::map<std::string, rclcpp::ParameterValue> parameter_overrides_;
 
   bool allow_undeclared_ = false;
 
   Publisher<rcl_interfaces::msg::ParameterEvent>::SharedPtr events_publisher_;
 
+  // Only set if the parameter events are coalesced.
+  rclcpp::TimerBase::SharedPtr parameter_event_coalescing_timer_;
+
+  // Changes merged since the coalescing period started, published when it expires.
+  rcl_interfaces::msg::ParameterEvent pending_parameter_event_;
+
+  bool parameter_event_pending_ = false;
+
   std::shared_ptr<ParameterService> parameter_service_;
 
   std::string combined_name_;
@@ -15,9 +15,12 @@
 #ifndef RCLCPP__NODE_INTERFACES__NODE_PARAMETERS_INTERFACE_HPP_
 #define RCLCPP__NODE_INTERFACES__NODE_PARAMETERS_INTERFACE_HPP_
 
+#include <atomic>
 #include <functional>
 #include <map>
+#include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "rcl_interfaces/msg/list_parameters_result.hpp"
@@ -68,6 +71,89 @@ struct PostSetParametersCallbackHandle
   PostSetParametersCallbackType callback;
 };
 
+class NodeParameters;
+
+/// Handle to a declared parameter, used to read its current value without locking.
+/**
+ * The value is held as an immutable snapshot, which is swapped atomically whenever the
+ * parameter is successfully set, so readers never block writers nor each other on the
+ * node's parameter lock, and never observe a partially updated value.
+ * A value read from the handle stays valid for as long as the reader holds it.
+ *
+ * Once the parameter is undeclared, the handle is invalidated and keeps its last value.
+ * Declaring the parameter again requires getting a new handle.
+ *
+ * \sa rclcpp::Node::get_parameter_handle
+ */
+class ParameterHandle
+{
+public:
+  RCLCPP_SMART_PTR_DEFINITIONS_NOT_COPYABLE(ParameterHandle)
+
+  ParameterHandle(const std::string & name, const rclcpp::ParameterValue & value)
+  : name_(name), value_(std::make_shared<const rclcpp::ParameterValue>(value))
+  {}
+
+  /// Return the name of the parameter.
+  const std::string &
+  get_name() const
+  {
+    return name_;
+  }
+
+  /// Return a snapshot of the current value of the parameter.
+  std::shared_ptr<const rclcpp::ParameterValue>
+  get_value() const
+  {
+    return std::atomic_load_explicit(&value_, std::memory_order_acquire);
+  }
+
+  /// Return the current value of the parameter, converted to the given type.
+  /**
+   * \throws rclcpp::ParameterTypeException if the type doesn't match
+   */
+  template<typename ValueT>
+  ValueT
+  get_value_as() const
+  {
+    return get_value()->get<ValueT>();
+  }
+
+  /// Return the current value of the parameter, as a rclcpp::Parameter.
+  rclcpp::Parameter
+  get_parameter() const
+  {
+    return rclcpp::Parameter(name_, *get_value());
+  }
+
+  /// Return false if the parameter has been undeclared since the handle was obtained.
+  bool
+  is_valid() const
+  {
+    return valid_.load(std::memory_order_acquire);
+  }
+
+private:
+  friend NodeParameters;
+
+  void
+  set_value(const rclcpp::ParameterValue & value)
+  {
+    std::atomic_store_explicit(
+      &value_, std::make_shared<const rclcpp::ParameterValue>(value), std::memory_order_release);
+  }
+
+  void
+  invalidate()
+  {
+    valid_.store(false, std::memory_order_release);
+  }
+
+  const std::string name_;
+  std::shared_ptr<const rclcpp::ParameterValue> value_;
+  std::atomic<bool> valid_{true};
+};
+
 /// Pure virtual interface class for the NodeParameters part of the Node API.
 class NodeParametersInterface
 {
@@ -106,6 +192,41 @@ public:
     rcl_interfaces::msg::ParameterDescriptor(),
     bool ignore_override = false) = 0;
 
+  /// Declare and initialize several parameters at once.
+  /**
+   * Each parameter is given with its default value and its descriptor.
+   * Like declare_parameter(), the parameter overrides are used as initial values unless
+   * ignore_override is true, and a parameter without a value must be dynamically typed.
+   *
+   * All of the parameters are validated before any of them is declared, and they are
+   * either all declared or none is.
+   * The callbacks registered with `add_on_set_parameters_callback` and
+   * `add_post_set_parameters_callback` are called once with all of the initialized
+   * parameters, rather than once per parameter, and a single parameter event is
+   * published for all of them.
+   *
+   * \param[in] parameters The parameters to declare, with their descriptors.
+   * \param[in] ignore_override When `true`, the parameters overrides are ignored.
+   * \return The values of the declared parameters, in the given order.
+   * \throws rclcpp::exceptions::ParameterAlreadyDeclaredException if a parameter
+   *   has already been declared, or is given more than once.
+   * \throws rclcpp::exceptions::InvalidParametersException if a parameter
+   *   name is invalid.
+   * \throws rclcpp::exceptions::InvalidParameterTypeException if a statically
+   *   typed parameter has no value, or the type of its initial value is wrong.
+   * \throws rclcpp::exceptions::InvalidParameterValueException if an initial
+   *   value fails to be set.
+   * \sa rclcpp::Node::declare_parameter
+   */
+  RCLCPP_PUBLIC
+  virtual
+  std::vector<rclcpp::ParameterValue>
+  declare_parameters(
+    const std::vector<
+      std::pair<rclcpp::Parameter, rcl_interfaces::msg::ParameterDescriptor>
+    > & parameters,
+    bool ignore_override = false) = 0;
+
   /// Undeclare a parameter.
   /**
    * \sa rclcpp::Node::undeclare_parameter
@@ -193,6 +314,15 @@ public:
     const std::string & prefix,
     std::map<std::string, rclcpp::Parameter> & parameters) const = 0;
 
+  /// Get a handle to read the value of a declared parameter without locking.
+  /**
+   * \sa rclcpp::Node::get_parameter_handle
+   */
+  RCLCPP_PUBLIC
+  virtual
+  ParameterHandle::SharedPtr
+  get_parameter_handle(const std::string & name) = 0;
+
   RCLCPP_PUBLIC
   virtual
   std::vector<rcl_interfaces::msg::ParameterDescriptor>
@@ -15,12 +15,16 @@
 #ifndef RCLCPP__NODE_INTERFACES__NODE_TOPICS_HPP_
 #define RCLCPP__NODE_INTERFACES__NODE_TOPICS_HPP_
 
+#include <map>
+#include <memory>
+#include <mutex>
 #include <string>
 
 #include "rcl/publisher.h"
 #include "rcl/subscription.h"
 
 #include "rclcpp/callback_group.hpp"
+#include "rclcpp/event_handler_group.hpp"
 #include "rclcpp/macros.hpp"
 #include "rclcpp/node_interfaces/node_base_interface.hpp"
 #include "rclcpp/node_interfaces/node_timers_interface.hpp"
@@ -43,10 +47,18 @@ class NodeTopics : public NodeTopicsInterface
 public:
   RCLCPP_SMART_PTR_ALIASES_ONLY(NodeTopicsInterface)
 
+  /// Constructor.
+  /**
+   * \param[in] node_base the base interface of the node
+   * \param[in] node_timers the timers interface of the node
+   * \param[in] aggregate_event_handlers whether the event handlers of the endpoints are
+   *   added to an rclcpp::EventHandlerGroup per callback group
+   */
   RCLCPP_PUBLIC
   NodeTopics(
     rclcpp::node_interfaces::NodeBaseInterface * node_base,
-    rclcpp::node_interfaces::NodeTimersInterface * node_timers);
+    rclcpp::node_interfaces::NodeTimersInterface * node_timers,
+    bool aggregate_event_handlers = false);
 
   RCLCPP_PUBLIC
   ~NodeTopics() override;
@@ -92,8 +104,21 @@ public:
 private:
   RCLCPP_DISABLE_COPY(NodeTopics)
 
+  /// Add an event handler to its callback group, or to the event handler group of it.
+  void
+  add_event_handler(
+    const std::shared_ptr<rclcpp::EventHandlerBase> & event_handler,
+    const rclcpp::CallbackGroup::SharedPtr & callback_group);
+
   rclcpp::node_interfaces::NodeBaseInterface * node_base_;
   rclcpp::node_interfaces::NodeTimersInterface * node_timers_;
+
+  bool aggregate_event_handlers_;
+  std::mutex event_handler_groups_mutex_;
+  std::map<
+    rclcpp::CallbackGroup::WeakPtr,
+    rclcpp::EventHandlerGroup::SharedPtr,
+    std::owner_less<rclcpp::CallbackGroup::WeakPtr>> event_handler_groups_;
 };
 
 }  // namespace node_interfaces
@@ -42,7 +42,9 @@ public:
     NodeBaseInterface::SharedPtr node_base,
     NodeLoggingInterface::SharedPtr node_logging,
     NodeParametersInterface::SharedPtr node_parameters,
-    NodeServicesInterface::SharedPtr node_services);
+    NodeServicesInterface::SharedPtr node_services,
+    bool start_type_description_service = true,
+    bool share_type_description_service = false);
 
   RCLCPP_PUBLIC
   virtual
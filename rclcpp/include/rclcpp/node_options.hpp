@@ -15,6 +15,7 @@
 #ifndef RCLCPP__NODE_OPTIONS_HPP_
 #define RCLCPP__NODE_OPTIONS_HPP_
 
+#include <chrono>
 #include <memory>
 #include <string>
 #include <vector>
@@ -51,11 +52,15 @@ public:
    *   - clock_type = RCL_ROS_TIME
    *   - clock_qos = rclcpp::ClockQoS()
    *   - use_clock_thread = true
+   *   - use_shared_clock_subscription = false
+   *   - aggregate_event_handlers = false
    *   - enable_logger_service = false
+   *   - start_type_description_service = true
    *   - rosout_qos = rclcpp::RosoutQoS()
    *   - parameter_event_qos = rclcpp::ParameterEventQoS
    *     - with history setting and depth from rmw_qos_profile_parameter_events
    *   - parameter_event_publisher_options = rclcpp::PublisherOptionsBase
+   *   - parameter_event_coalescing_period = 0 ms
    *   - allow_undeclared_parameters = false
    *   - automatically_declare_parameters_from_overrides = false
    *   - allocator = rcl_get_default_allocator()
@@ -252,6 +257,59 @@ public:
   NodeOptions &
   enable_logger_service(bool enable_log_service);
 
+  /// Return the start_type_description_service flag.
+  RCLCPP_PUBLIC
+  bool
+  start_type_description_service() const;
+
+  /// Set the start_type_description_service flag, return this for parameter idiom.
+  /**
+   * This is the default value of the "start_type_description_service" parameter of the node,
+   * which can still be overridden, e.g. from the command line.
+   * If the parameter is true, the ~/get_type_description service is created.
+   */
+  RCLCPP_PUBLIC
+  NodeOptions &
+  start_type_description_service(bool start_type_description_service);
+
+  /// Return the share_type_description_service flag.
+  RCLCPP_PUBLIC
+  bool
+  share_type_description_service() const;
+
+  /// Set the share_type_description_service flag, return this for parameter idiom.
+  /**
+   * If true, and the "start_type_description_service" parameter of the node is true, the node
+   * doesn't create its own ~/get_type_description service.
+   * A single service is created for all the nodes of the context sharing it instead, which
+   * answers with the type descriptions of any of them.
+   * It's the ~/get_type_description service of the first one of these nodes which exists,
+   * so the services of the other nodes can't be found by their name.
+   *
+   * This is meant for processes creating many nodes, which would otherwise have as many
+   * services giving the same answers.
+   */
+  RCLCPP_PUBLIC
+  NodeOptions &
+  share_type_description_service(bool share_type_description_service);
+
+  /// Disable the optional entities of the node which are costly to create, return this.
+  /**
+   * This is meant for processes creating many nodes, and is the same as:
+   *
+   *   - start_parameter_services(false)
+   *   - start_parameter_event_publisher(false)
+   *   - enable_logger_service(false)
+   *   - start_type_description_service(false)
+   *   - use_shared_clock_subscription(true)
+   *
+   * The parameters of the node can then only be used from within the process.
+   * Disabling rosout with enable_rosout(false) further avoids a publisher per node.
+   */
+  RCLCPP_PUBLIC
+  NodeOptions &
+  lightweight();
+
   /// Return the start_parameter_event_publisher flag.
   RCLCPP_PUBLIC
   bool
@@ -308,6 +366,35 @@ public:
   NodeOptions &
   use_clock_thread(bool use_clock_thread);
 
+  /// Return the use_shared_clock_subscription flag.
+  RCLCPP_PUBLIC
+  bool
+  use_shared_clock_subscription() const;
+
+  /// Set the use_shared_clock_subscription flag, return this for parameter idiom.
+  /**
+   * If true, the time source of the node uses the "/clock" subscription shared by the nodes
+   * of its context which set this flag, with a single thread updating all their clocks.
+   */
+  RCLCPP_PUBLIC
+  NodeOptions &
+  use_shared_clock_subscription(bool use_shared_clock_subscription);
+
+  /// Return the aggregate_event_handlers flag.
+  RCLCPP_PUBLIC
+  bool
+  aggregate_event_handlers() const;
+
+  /// Set the aggregate_event_handlers flag, return this for parameter idiom.
+  /**
+   * If true, the QoS event handlers of the publishers and subscriptions of the node are
+   * added to one rclcpp::EventHandlerGroup per callback group, rather than each being a
+   * waitable of the callback group, so that executors handle one waitable for all of them.
+   */
+  RCLCPP_PUBLIC
+  NodeOptions &
+  aggregate_event_handlers(bool aggregate_event_handlers);
+
   /// Return a reference to the parameter_event_qos QoS.
   RCLCPP_PUBLIC
   const rclcpp::QoS &
@@ -321,6 +408,27 @@ public:
   NodeOptions &
   parameter_event_qos(const rclcpp::QoS & parameter_event_qos);
 
+  /// Return the period over which parameter events are coalesced.
+  RCLCPP_PUBLIC
+  std::chrono::milliseconds
+  parameter_event_coalescing_period() const;
+
+  /// Set the period over which parameter events are coalesced, return this for parameter idiom.
+  /**
+   * If greater than zero, the parameter changes made within this period are merged
+   * and published as a single event when it expires, instead of publishing an event
+   * for each change.
+   * The period starts with the first change after an event was published, and the
+   * event is published by a timer of the node, so only while the node is spun.
+   *
+   * If zero, an event is published for each change.
+   *
+   * \throws std::invalid_argument if the period is negative
+   */
+  RCLCPP_PUBLIC
+  NodeOptions &
+  parameter_event_coalescing_period(std::chrono::milliseconds parameter_event_coalescing_period);
+
   /// Return a reference to the rosout QoS.
   RCLCPP_PUBLIC
   const rclcpp::QoS &
@@ -441,8 +549,16 @@ private:
 
   bool use_clock_thread_ {true};
 
+  bool use_shared_clock_subscription_ {false};
+
+  bool aggregate_event_handlers_ {false};
+
   bool enable_logger_service_ {false};
 
+  bool start_type_description_service_ {true};
+
+  bool share_type_description_service_ {false};
+
   rclcpp::QoS parameter_event_qos_ = rclcpp::ParameterEventsQoS(
     rclcpp::QoSInitialization::from_rmw(rmw_qos_profile_parameter_events)
   );
@@ -451,6 +567,8 @@ private:
 
   rclcpp::PublisherOptionsBase parameter_event_publisher_options_ = rclcpp::PublisherOptionsBase();
 
+  std::chrono::milliseconds parameter_event_coalescing_period_ {0};
+
   bool allow_undeclared_parameters_ {false};
 
   bool automatically_declare_parameters_from_overrides_ {false};
@@ -0,0 +1,196 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__PARAMETER_BLACKBOARD_HPP_
+#define RCLCPP__PARAMETER_BLACKBOARD_HPP_
+
+#include <functional>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+
+#include "rclcpp/context.hpp"
+#include "rclcpp/macros.hpp"
+#include "rclcpp/node_interfaces/node_parameters_interface.hpp"
+#include "rclcpp/parameter_value.hpp"
+#include "rclcpp/visibility_control.hpp"
+
+namespace rclcpp
+{
+
+struct BlackboardCallbackHandle
+{
+  RCLCPP_SMART_PTR_DEFINITIONS(BlackboardCallbackHandle)
+
+  using BlackboardCallbackType =
+    std::function<void (
+      const std::string &, const std::shared_ptr<const rclcpp::ParameterValue> &)>;
+
+  std::string key;
+  BlackboardCallbackType callback;
+};
+
+/// Process-local store of values shared by the nodes of a context.
+/**
+ * Components of the same process often need the same, possibly large, configuration.
+ * Instead of declaring it as a parameter of each node, it can be put once on the blackboard
+ * of their context, from which every component reads the same immutable value, without
+ * copies nor inter-process communication.
+ *
+ * The values are immutable snapshots, replaced as a whole when a key is set again, so that a
+ * value read from the blackboard stays valid and unchanged for as long as the reader holds it.
+ * All the methods are thread-safe.
+ *
+ * A parameter of a node can be kept in sync with a key of the blackboard with
+ * share_parameter(), so that it's still configured and introspected as a parameter.
+ * The blackboard of a context is obtained with get_instance().
+ */
+class ParameterBlackboard : public std::enable_shared_from_this<ParameterBlackboard>
+{
+public:
+  RCLCPP_SMART_PTR_ALIASES_ONLY(ParameterBlackboard)
+
+  using ValueSharedPtr = std::shared_ptr<const rclcpp::ParameterValue>;
+  using Snapshot = std::map<std::string, ValueSharedPtr>;
+  using BlackboardCallbackType = BlackboardCallbackHandle::BlackboardCallbackType;
+
+  RCLCPP_PUBLIC
+  ParameterBlackboard() = default;
+
+  /// Return the blackboard of the given context, creating it if necessary.
+  RCLCPP_PUBLIC
+  static
+  SharedPtr
+  get_instance(rclcpp::Context & context);
+
+  /// Return the value of a key, or nullptr if the key isn't set.
+  RCLCPP_PUBLIC
+  ValueSharedPtr
+  get(const std::string & key) const;
+
+  /// Return the value of a key, converted to the given type.
+  /**
+   * \throws std::out_of_range if the key isn't set
+   * \throws rclcpp::ParameterTypeException if the type doesn't match
+   */
+  template<typename ValueT>
+  ValueT
+  get_as(const std::string & key) const
+  {
+    auto value = get(key);
+    if (!value) {
+      throw std::out_of_range("blackboard key '" + key + "' is not set");
+    }
+    return value->get<ValueT>();
+  }
+
+  /// Return whether a key is set.
+  RCLCPP_PUBLIC
+  bool
+  has(const std::string & key) const;
+
+  /// Return a consistent snapshot of all the keys and their values.
+  RCLCPP_PUBLIC
+  Snapshot
+  snapshot() const;
+
+  /// Set the value of a key, replacing its previous value if any.
+  /**
+   * The callbacks of the key are called with the new value in the calling thread,
+   * after the value is visible to the readers.
+   *
+   * \param[in] key the key to set
+   * \param[in] value the new value of the key, which is moved into the blackboard
+   * \throws std::invalid_argument if the value isn't set
+   */
+  RCLCPP_PUBLIC
+  void
+  set(const std::string & key, rclcpp::ParameterValue value);
+
+  /// Set the value of a key to an already shared value, which is stored without copy.
+  /**
+   * \sa set(const std::string &, rclcpp::ParameterValue)
+   * \throws std::invalid_argument if the value is nullptr or isn't set
+   */
+  RCLCPP_PUBLIC
+  void
+  set(const std::string & key, ValueSharedPtr value);
+
+  /// Remove a key, return false if it wasn't set.
+  /**
+   * The callbacks of the key are called with nullptr if it was set.
+   */
+  RCLCPP_PUBLIC
+  bool
+  erase(const std::string & key);
+
+  /// Add a callback called when a key is set or erased.
+  /**
+   * The callback is called with the key and its new value, nullptr if the key was erased.
+   * Callbacks are called in the order of the changes, and may themselves change the blackboard.
+   *
+   * \param[in] callback the callback to call
+   * \param[in] key the key to watch, all the keys if empty
+   * \return a handle which must be held to keep the callback registered
+   */
+  RCLCPP_PUBLIC
+  BlackboardCallbackHandle::SharedPtr
+  add_callback(BlackboardCallbackType callback, const std::string & key = "");
+
+  /// Remove a callback registered with add_callback().
+  RCLCPP_PUBLIC
+  void
+  remove_callback(const BlackboardCallbackHandle * const handle);
+
+  /// Keep a key of the blackboard in sync with a declared parameter of a node.
+  /**
+   * The key is set to the current value of the parameter, and then every time the parameter
+   * is successfully set, from the post set parameters callback of the node.
+   * The key is erased if the parameter is undeclared by setting it to an unset value, while it
+   * keeps its last value if the parameter is undeclared with undeclare_parameter(), which
+   * doesn't call the post set parameters callbacks.
+   *
+   * \param[in] node_parameters the parameters interface of the node owning the parameter
+   * \param[in] name the name of the parameter
+   * \param[in] key the key to set, the name of the parameter if empty
+   * \return the post set parameters callback handle, which must be held to keep the key in sync
+   * \throws rclcpp::exceptions::ParameterNotDeclaredException if the parameter isn't declared
+   */
+  RCLCPP_PUBLIC
+  rclcpp::node_interfaces::PostSetParametersCallbackHandle::SharedPtr
+  share_parameter(
+    rclcpp::node_interfaces::NodeParametersInterface::SharedPtr node_parameters,
+    const std::string & name,
+    const std::string & key = "");
+
+private:
+  RCLCPP_DISABLE_COPY(ParameterBlackboard)
+
+  void
+  call_callbacks(const std::string & key, const ValueSharedPtr & value);
+
+  mutable std::mutex mutex_;
+  Snapshot values_;
+  // Held while changing a value and calling the callbacks, so that they're called in the order
+  // of the changes, without blocking the readers.
+  std::recursive_mutex callbacks_mutex_;
+  std::list<BlackboardCallbackHandle::WeakPtr> callbacks_;
+};
+
+}  // namespace rclcpp
+
+#endif  // RCLCPP__PARAMETER_BLACKBOARD_HPP_
@@ -15,6 +15,7 @@
 #ifndef RCLCPP__PARAMETER_EVENT_HANDLER_HPP_
 #define RCLCPP__PARAMETER_EVENT_HANDLER_HPP_
 
+#include <algorithm>
 #include <list>
 #include <memory>
 #include <string>
@@ -30,6 +31,8 @@
 #include "rclcpp/parameter.hpp"
 #include "rclcpp/qos.hpp"
 #include "rclcpp/subscription.hpp"
+#include "rclcpp/subscription_content_filter_options.hpp"
+#include "rclcpp/subscription_options.hpp"
 #include "rclcpp/visibility_control.hpp"
 #include "rcl_interfaces/msg/parameter_event.hpp"
 
@@ -175,17 +178,56 @@ public:
     NodeT node,
     const rclcpp::QoS & qos =
     rclcpp::QoS(rclcpp::QoSInitialization::from_rmw(rmw_qos_profile_parameter_events)))
+  : ParameterEventHandler(node, std::vector<std::string>(), qos)
+  {}
+
+  /// Construct a parameter events monitor of the given nodes only.
+  /**
+   * The events of the other nodes are filtered out by the middleware, with a content
+   * filter, so they are not even delivered to this process.
+   * If the middleware doesn't support content filtering, they are filtered out on reception.
+   *
+   * \param[in] node The node to use to create any required subscribers.
+   * \param[in] node_names The names of the nodes whose events are monitored, relative
+   *   names are resolved against the namespace of node. If empty, all nodes are monitored.
+   * \param[in] qos The QoS settings to use for any subscriptions.
+   */
+  template<typename NodeT>
+  ParameterEventHandler(
+    NodeT node,
+    const std::vector<std::string> & node_names,
+    const rclcpp::QoS & qos =
+    rclcpp::QoS(rclcpp::QoSInitialization::from_rmw(rmw_qos_profile_parameter_events)))
   : node_base_(rclcpp::node_interfaces::get_node_base_interface(node))
   {
     auto node_topics = rclcpp::node_interfaces::get_node_topics_interface(node);
 
     callbacks_ = std::make_shared<Callbacks>();
 
+    std::vector<std::string> full_node_names;
+    full_node_names.reserve(node_names.size());
+    for (const auto & node_name : node_names) {
+      full_node_names.push_back(resolve_path(node_name));
+    }
+    rclcpp::SubscriptionOptions options;
+    options.content_filter_options = make_node_names_content_filter(full_node_names);
+    node_names_ = full_node_names;
+
     event_subscription_ = rclcpp::create_subscription<rcl_interfaces::msg::ParameterEvent>(
       node_topics, "/parameter_events", qos,
-      [callbacks = callbacks_](const rcl_interfaces::msg::ParameterEvent & event) {
+      [callbacks = callbacks_, full_node_names](
+        const rcl_interfaces::msg::ParameterEvent & event)
+      {
+        if (
+          !full_node_names.empty() &&
+          std::find(full_node_names.begin(), full_node_names.end(), event.node) ==
+          full_node_names.end())
+        {
+          return;
+        }
         callbacks->event_callback(event);
-      });
+      },
+      options);
   }
 
   using ParameterEventCallbackType =
@@ -221,6 +263,12 @@ public:
   /// Add a callback for a specified parameter.
   /**
    * If a node_name is not provided, defaults to the current node.
+   * A node name whose last token is `*`, e.g. `/ns/*`, matches all of the nodes of that
+   * namespace, e.g. `/ns/node` but not `/ns/sub_ns/node`.
+   *
+   * Unless callbacks for all parameter events are set, the subscription only receives
+   * the events of the nodes of the parameter callbacks, if the middleware supports
+   * content filtering and no namespace wildcard is used.
    *
    * Note: if the returned callback handle smart pointer is not captured, the callback
    * is immediately unregistered. A compiler warning should be generated to warn
@@ -352,10 +400,27 @@ protected:
   // Utility function for resolving node path.
   std::string resolve_path(const std::string & path);
 
+  // Utility function for creating a content filter matching the events of the given nodes.
+  RCLCPP_PUBLIC
+  static rclcpp::ContentFilterOptions
+  make_node_names_content_filter(const std::vector<std::string> & node_names);
+
+  // Update the content filter of the subscription, with the nodes of the parameter callbacks.
+  RCLCPP_PUBLIC
+  void
+  update_content_filter();
+
   // Node interface used for base functionality
   std::shared_ptr<rclcpp::node_interfaces::NodeBaseInterface> node_base_;
 
   rclcpp::Subscription<rcl_interfaces::msg::ParameterEvent>::SharedPtr event_subscription_;
+
+  // The nodes given to the constructor, otherwise the content filter follows the callbacks.
+  std::vector<std::string> node_names_;
+
+  // The content filter set on the subscription, and whether the middleware supports it.
+  rclcpp::ContentFilterOptions content_filter_;
+  bool content_filter_supported_ = true;
 };
 
 }  // namespace rclcpp
@@ -20,6 +20,7 @@
 #include <ostream>
 #include <sstream>
 #include <string>
+#include <variant>
 #include <vector>
 
 #include "rcl_interfaces/msg/parameter_type.hpp"
@@ -148,10 +149,11 @@ public:
   typename std::enable_if<type == ParameterType::PARAMETER_BOOL, const bool &>::type
   get() const
   {
-    if (value_.type != rcl_interfaces::msg::ParameterType::PARAMETER_BOOL) {
+    const auto * value = std::get_if<ParameterType::PARAMETER_BOOL>(&value_);
+    if (!value) {
       throw ParameterTypeException(ParameterType::PARAMETER_BOOL, get_type());
     }
-    return value_.bool_value;
+    return *value;
   }
 
   template<ParameterType type>
@@ -159,10 +161,11 @@ public:
   typename std::enable_if<type == ParameterType::PARAMETER_INTEGER, const int64_t &>::type
   get() const
   {
-    if (value_.type != rcl_interfaces::msg::ParameterType::PARAMETER_INTEGER) {
+    const auto * value = std::get_if<ParameterType::PARAMETER_INTEGER>(&value_);
+    if (!value) {
       throw ParameterTypeException(ParameterType::PARAMETER_INTEGER, get_type());
     }
-    return value_.integer_value;
+    return *value;
   }
 
   template<ParameterType type>
@@ -170,10 +173,11 @@ public:
   typename std::enable_if<type == ParameterType::PARAMETER_DOUBLE, const double &>::type
   get() const
   {
-    if (value_.type != rcl_interfaces::msg::ParameterType::PARAMETER_DOUBLE) {
+    const auto * value = std::get_if<ParameterType::PARAMETER_DOUBLE>(&value_);
+    if (!value) {
       throw ParameterTypeException(ParameterType::PARAMETER_DOUBLE, get_type());
     }
-    return value_.double_value;
+    return *value;
   }
 
   template<ParameterType type>
@@ -181,10 +185,11 @@ public:
   typename std::enable_if<type == ParameterType::PARAMETER_STRING, const std::string &>::type
   get() const
   {
-    if (value_.type != rcl_interfaces::msg::ParameterType::PARAMETER_STRING) {
+    const auto * value = std::get_if<ParameterType::PARAMETER_STRING>(&value_);
+    if (!value) {
       throw ParameterTypeException(ParameterType::PARAMETER_STRING, get_type());
     }
-    return value_.string_value;
+    return *value;
   }
 
   template<ParameterType type>
@@ -193,10 +198,11 @@ public:
     type == ParameterType::PARAMETER_BYTE_ARRAY, const std::vector<uint8_t> &>::type
   get() const
   {
-    if (value_.type != rcl_interfaces::msg::ParameterType::PARAMETER_BYTE_ARRAY) {
+    const auto * value = std::get_if<ParameterType::PARAMETER_BYTE_ARRAY>(&value_);
+    if (!value) {
       throw ParameterTypeException(ParameterType::PARAMETER_BYTE_ARRAY, get_type());
     }
-    return value_.byte_array_value;
+    return *value;
   }
 
   template<ParameterType type>
@@ -205,10 +211,11 @@ public:
     type == ParameterType::PARAMETER_BOOL_ARRAY, const std::vector<bool> &>::type
   get() const
   {
-    if (value_.type != rcl_interfaces::msg::ParameterType::PARAMETER_BOOL_ARRAY) {
+    const auto * value = std::get_if<ParameterType::PARAMETER_BOOL_ARRAY>(&value_);
+    if (!value) {
       throw ParameterTypeException(ParameterType::PARAMETER_BOOL_ARRAY, get_type());
     }
-    return value_.bool_array_value;
+    return *value;
   }
 
   template<ParameterType type>
@@ -217,10 +224,11 @@ public:
     type == ParameterType::PARAMETER_INTEGER_ARRAY, const std::vector<int64_t> &>::type
   get() const
   {
-    if (value_.type != rcl_interfaces::msg::ParameterType::PARAMETER_INTEGER_ARRAY) {
+    const auto * value = std::get_if<ParameterType::PARAMETER_INTEGER_ARRAY>(&value_);
+    if (!value) {
       throw ParameterTypeException(ParameterType::PARAMETER_INTEGER_ARRAY, get_type());
     }
-    return value_.integer_array_value;
+    return *value;
   }
 
   template<ParameterType type>
@@ -229,10 +237,11 @@ public:
     type == ParameterType::PARAMETER_DOUBLE_ARRAY, const std::vector<double> &>::type
   get() const
   {
-    if (value_.type != rcl_interfaces::msg::ParameterType::PARAMETER_DOUBLE_ARRAY) {
+    const auto * value = std::get_if<ParameterType::PARAMETER_DOUBLE_ARRAY>(&value_);
+    if (!value) {
       throw ParameterTypeException(ParameterType::PARAMETER_DOUBLE_ARRAY, get_type());
     }
-    return value_.double_array_value;
+    return *value;
   }
 
   template<ParameterType type>
@@ -241,10 +250,11 @@ public:
     type == ParameterType::PARAMETER_STRING_ARRAY, const std::vector<std::string> &>::type
   get() const
   {
-    if (value_.type != rcl_interfaces::msg::ParameterType::PARAMETER_STRING_ARRAY) {
+    const auto * value = std::get_if<ParameterType::PARAMETER_STRING_ARRAY>(&value_);
+    if (!value) {
       throw ParameterTypeException(ParameterType::PARAMETER_STRING_ARRAY, get_type());
     }
-    return value_.string_array_value;
+    return *value;
   }
 
   // The following get() variants allow the use of primitive types
@@ -353,7 +363,21 @@ public:
   }
 
 private:
-  rcl_interfaces::msg::ParameterValue value_;
+  // Only the value of the set type is stored, the message is built when it's requested.
+  // The alternatives are in the order of ParameterType, so that the index is the type.
+  using Storage = std::variant<
+    std::monostate,
+    bool,
+    int64_t,
+    double,
+    std::string,
+    std::vector<uint8_t>,
+    std::vector<bool>,
+    std::vector<int64_t>,
+    std::vector<double>,
+    std::vector<std::string>>;
+
+  Storage value_;
 };
 
 /// Return the value of a parameter as a string
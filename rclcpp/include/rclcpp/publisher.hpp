@@ -15,6 +15,8 @@
 #ifndef RCLCPP__PUBLISHER_HPP_
 #define RCLCPP__PUBLISHER_HPP_
 
+#include <chrono>
+#include <cstdint>
 #include <functional>
 #include <iostream>
 #include <memory>
@@ -22,6 +24,7 @@
 #include <string>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "rcl/error_handling.h"
 #include "rcl/publisher.h"
@@ -31,21 +34,26 @@
 
 #include "rclcpp/allocator/allocator_common.hpp"
 #include "rclcpp/allocator/allocator_deleter.hpp"
+#include "rclcpp/detail/async_publish_queue.hpp"
+#include "rclcpp/detail/rate_limiter.hpp"
 #include "rclcpp/detail/resolve_use_intra_process.hpp"
+#include "rclcpp/exceptions.hpp"
 #include "rclcpp/experimental/intra_process_manager.hpp"
 #include "rclcpp/get_message_type_support_handle.hpp"
 #include "rclcpp/is_ros_compatible_type.hpp"
 #include "rclcpp/loaned_message.hpp"
 #include "rclcpp/macros.hpp"
+#include "rclcpp/message_pool.hpp"
 #include "rclcpp/node_interfaces/node_base_interface.hpp"
 #include "rclcpp/publisher_base.hpp"
 #include "rclcpp/publisher_options.hpp"
+#include "rclcpp/serialized_message.hpp"
+#include "rclcpp/topic_statistics/publisher_topic_statistics.hpp"
+#include "rclcpp/tracing.hpp"
 #include "rclcpp/type_adapter.hpp"
 #include "rclcpp/type_support_decl.hpp"
 #include "rclcpp/visibility_control.hpp"
 
-#include "tracetools/tracetools.h"
-
 namespace rclcpp
 {
 
@@ -93,6 +101,11 @@ public:
   using ROSMessageTypeAllocator = typename ROSMessageTypeAllocatorTraits::allocator_type;
   using ROSMessageTypeDeleter = allocator::Deleter<ROSMessageTypeAllocator, ROSMessageType>;
 
+  using ROSMessagePool = rclcpp::MessagePool<ROSMessageType, AllocatorT>;
+  using PooledMessageUniquePtr = typename ROSMessagePool::MessageUniquePtr;
+
+  using PublishStatisticsScope = rclcpp::topic_statistics::PublisherTopicStatistics::PublishScope;
+
   using MessageAllocatorTraits
   [[deprecated("use PublishedTypeAllocatorTraits")]] =
     PublishedTypeAllocatorTraits;
@@ -137,10 +150,22 @@ public:
       options.use_default_callbacks),
     options_(options),
     published_type_allocator_(*options.get_allocator()),
-    ros_message_type_allocator_(*options.get_allocator())
+    ros_message_type_allocator_(*options.get_allocator()),
+    inter_process_rate_limiter_(options.max_rate)
   {
     allocator::set_allocator_for_deleter(&published_type_deleter_, &published_type_allocator_);
     allocator::set_allocator_for_deleter(&ros_message_type_deleter_, &ros_message_type_allocator_);
+    if (options.message_pool_size > 0) {
+      message_pool_ = std::make_shared<ROSMessagePool>(
+        options.message_pool_size, *options.get_allocator());
+    }
+    if (options.async_publish.queue_size > 0) {
+      async_publish_queue_ = std::make_unique<rclcpp::detail::AsyncPublishQueue>(
+        options.async_publish.queue_size,
+        PublisherOptionsBase::AsyncPublishOptions::OverflowPolicy::Block ==
+        options.async_publish.overflow_policy,
+        this->get_topic_name());
+    }
     // Setup continues in the post construction method, post_init_setup().
   }
 
@@ -161,18 +186,18 @@ public:
     if (rclcpp::detail::resolve_use_intra_process(options_, *node_base)) {
       auto context = node_base->get_context();
       // Get the intra process manager instance for this context.
-      auto ipm = context->get_sub_context<rclcpp::experimental::IntraProcessManager>();
+      auto ipm = rclcpp::experimental::IntraProcessManager::get_instance(*context);
       // Register the publisher with the intra process manager.
       if (qos.history() != rclcpp::HistoryPolicy::KeepLast) {
-        throw std::invalid_argument(
+        throw rclcpp::exceptions::IntraProcessQoSIncompatibleError(
                 "intraprocess communication allowed only with keep last history qos policy");
       }
       if (qos.depth() == 0) {
-        throw std::invalid_argument(
+        throw rclcpp::exceptions::IntraProcessQoSIncompatibleError(
                 "intraprocess communication is not allowed with a zero qos history depth value");
       }
       if (qos.durability() != rclcpp::DurabilityPolicy::Volatile) {
-        throw std::invalid_argument(
+        throw rclcpp::exceptions::IntraProcessQoSIncompatibleError(
                 "intraprocess communication allowed only with volatile durability");
       }
       uint64_t intra_process_publisher_id = ipm->add_publisher(this->shared_from_this());
@@ -226,8 +251,13 @@ public:
   >
   publish(std::unique_ptr<T, ROSMessageTypeDeleter> msg)
   {
+    PublishStatisticsScope statistics_scope(topic_statistics_.get());
     if (!intra_process_is_enabled_) {
-      this->do_inter_process_publish(*msg);
+      if (async_publish_queue_) {
+        this->do_inter_process_publish_shared(std::move(msg));
+      } else {
+        this->do_inter_process_publish(*msg);
+      }
       return;
     }
     // If an interprocess subscription exist, then the unique_ptr is promoted
@@ -236,16 +266,9 @@ public:
     // interprocess publish, resulting in lower publish-to-subscribe latency.
     // It's not possible to do that with an unique_ptr,
     // as do_intra_process_publish takes the ownership of the message.
-    bool inter_process_publish_needed =
-      get_subscription_count() > get_intra_process_subscription_count();
+    bool inter_process_publish_needed = this->has_inter_process_subscriptions();
 
-    if (inter_process_publish_needed) {
-      auto shared_msg =
-        this->do_intra_process_ros_message_publish_and_return_shared(std::move(msg));
-      this->do_inter_process_publish(*shared_msg);
-    } else {
-      this->do_intra_process_ros_message_publish(std::move(msg));
-    }
+    this->do_ros_message_publish(std::move(msg), inter_process_publish_needed);
   }
 
   /// Publish a message on the topic.
@@ -267,11 +290,19 @@ public:
   >
   publish(const T & msg)
   {
+    PublishStatisticsScope statistics_scope(topic_statistics_.get());
     // Avoid allocating when not using intra process.
     if (!intra_process_is_enabled_) {
       // In this case we're not using intra process.
       return this->do_inter_process_publish(msg);
     }
+    // Nor when there are no intra-process subscriptions to give a copy to.
+    if (intra_process_subscription_count_.load() == 0) {
+      if (this->has_inter_process_subscriptions()) {
+        this->do_inter_process_publish(msg);
+      }
+      return;
+    }
     // Otherwise we have to allocate memory in a unique_ptr and pass it along.
     // As the message is not const, a copy should be made.
     // A shared_ptr<const MessageT> could also be constructed here.
@@ -297,25 +328,35 @@ public:
   >
   publish(std::unique_ptr<T, PublishedTypeDeleter> msg)
   {
+    PublishStatisticsScope statistics_scope(topic_statistics_.get());
     // Avoid allocating when not using intra process.
     if (!intra_process_is_enabled_) {
+      if (!inter_process_rate_limiter_.try_accept()) {
+        return;
+      }
+      if (async_publish_queue_) {
+        // The message is converted by the publisher thread as well
+        std::shared_ptr<const PublishedType> shared_msg = std::move(msg);
+        async_publish_queue_->push(
+          [this, shared_msg]() {
+            this->do_type_adapted_inter_process_publish_now(*shared_msg);
+          });
+        return;
+      }
       // In this case we're not using intra process.
-      ROSMessageType ros_msg;
-      rclcpp::TypeAdapter<MessageT>::convert_to_ros_message(*msg, ros_msg);
-      return this->do_inter_process_publish(ros_msg);
+      return this->do_type_adapted_inter_process_publish_now(*msg);
     }
 
-    bool inter_process_publish_needed =
-      get_subscription_count() > get_intra_process_subscription_count();
+    bool inter_process_publish_needed = this->has_inter_process_subscriptions();
 
     if (inter_process_publish_needed) {
-      ROSMessageType ros_msg;
-      // TODO(clalancette): This is unnecessarily doing an additional conversion
-      // that may have already been done in do_intra_process_publish_and_return_shared().
-      // We should just reuse that effort.
-      rclcpp::TypeAdapter<MessageT>::convert_to_ros_message(*msg, ros_msg);
-      this->do_intra_process_publish(std::move(msg));
-      this->do_inter_process_publish(ros_msg);
+      // Convert the message only once: the converted message is published inter-process,
+      // and it's shared with the intra-process subscriptions taking the ROS message type.
+      auto ros_msg = std::allocate_shared<ROSMessageType, ROSMessageTypeAllocator>(
+        ros_message_type_allocator_);
+      rclcpp::TypeAdapter<MessageT>::convert_to_ros_message(*msg, *ros_msg);
+      this->do_intra_process_publish(std::move(msg), ros_msg);
+      this->do_inter_process_publish_shared(std::move(ros_msg));
     } else {
       this->do_intra_process_publish(std::move(msg));
     }
@@ -339,13 +380,14 @@ public:
   >
   publish(const T & msg)
   {
-    // Avoid double allocating when not using intra process.
-    if (!intra_process_is_enabled_) {
-      // Convert to the ROS message equivalent and publish it.
-      ROSMessageType ros_msg;
-      rclcpp::TypeAdapter<MessageT>::convert_to_ros_message(msg, ros_msg);
+    PublishStatisticsScope statistics_scope(topic_statistics_.get());
+    // Avoid double allocating when not using intra process, nor publishing asynchronously.
+    if (!intra_process_is_enabled_ && !async_publish_queue_) {
+      if (!inter_process_rate_limiter_.try_accept()) {
+        return;
+      }
       // In this case we're not using intra process.
-      return this->do_inter_process_publish(ros_msg);
+      return this->do_type_adapted_inter_process_publish_now(msg);
     }
 
     // Otherwise we have to allocate memory in a unique_ptr and pass it along.
@@ -355,15 +397,143 @@ public:
     this->publish(std::move(unique_msg));
   }
 
+  /// Publish a batch of messages on the topic, in order.
+  /**
+   * This is equivalent to publishing each message, but the routing decision between
+   * intra-process and inter-process delivery is taken once for the whole batch.
+   *
+   * This signature is enabled if the element_type of the std::unique_ptr is
+   * a ROS message type and that type matches the type given when creating the publisher.
+   * Ownership of the messages is given to rclcpp, allowing for more efficient
+   * intra-process communication optimizations.
+   *
+   * \param[in] msgs Unique pointers to the messages to send, they are all moved from.
+   */
+  template<typename T>
+  typename std::enable_if_t<
+    rosidl_generator_traits::is_message<T>::value &&
+    std::is_same<T, ROSMessageType>::value
+  >
+  publish_batch(std::vector<std::unique_ptr<T, ROSMessageTypeDeleter>> msgs)
+  {
+    PublishStatisticsScope statistics_scope(topic_statistics_.get());
+    if (!intra_process_is_enabled_) {
+      for (auto & msg : msgs) {
+        if (async_publish_queue_) {
+          this->do_inter_process_publish_shared(std::move(msg));
+        } else {
+          this->do_inter_process_publish(*msg);
+        }
+      }
+      return;
+    }
+    const bool inter_process_publish_needed = this->has_inter_process_subscriptions();
+    for (auto & msg : msgs) {
+      this->do_ros_message_publish(std::move(msg), inter_process_publish_needed);
+    }
+  }
+
+  /// Publish a batch of messages on the topic, in order.
+  /**
+   * This is equivalent to publishing each message, but the routing decision between
+   * intra-process and inter-process delivery is taken once for the whole batch.
+   *
+   * This signature is enabled if the messages are of the ROS message type given when
+   * creating the publisher.
+   * The messages are only copied if intra-process communication is enabled.
+   *
+   * \param[in] msgs The messages to send.
+   */
+  template<typename T>
+  typename std::enable_if_t<
+    rosidl_generator_traits::is_message<T>::value &&
+    std::is_same<T, ROSMessageType>::value
+  >
+  publish_batch(const std::vector<T> & msgs)
+  {
+    PublishStatisticsScope statistics_scope(topic_statistics_.get());
+    if (!intra_process_is_enabled_) {
+      for (const auto & msg : msgs) {
+        this->do_inter_process_publish(msg);
+      }
+      return;
+    }
+    const bool inter_process_publish_needed = this->has_inter_process_subscriptions();
+    for (const auto & msg : msgs) {
+      this->do_ros_message_publish(
+        this->duplicate_ros_message_as_unique_ptr(msg), inter_process_publish_needed);
+    }
+  }
+
+  /// Get a message from the message pool of the publisher.
+  /**
+   * The publisher must have been created with a non zero
+   * PublisherOptions::message_pool_size.
+   * The message keeps the contents it had when it was returned to the pool, so the memory
+   * of its dynamically sized fields is reused.
+   * If all the messages of the pool are in use, a new one is allocated.
+   *
+   * \return the pooled message, which returns to the pool when released
+   * \throws std::runtime_error if the publisher has no message pool
+   */
+  PooledMessageUniquePtr
+  acquire()
+  {
+    if (!message_pool_) {
+      throw std::runtime_error(
+              "publisher has no message pool, set PublisherOptions::message_pool_size to use it");
+    }
+    return message_pool_->acquire();
+  }
+
+  /// Publish a message acquired from the message pool of the publisher.
+  /**
+   * The message is shared with the intra-process subscriptions that don't require ownership,
+   * and it returns to the pool once all of them release it, while the intra-process
+   * subscriptions taking ownership receive a copy.
+   * Once the pool is warmed up, publishing to inter-process subscriptions and to shared
+   * intra-process subscriptions doesn't allocate memory in rclcpp.
+   *
+   * \param[in] msg A message acquired with acquire().
+   */
+  void
+  publish(PooledMessageUniquePtr msg)
+  {
+    PublishStatisticsScope statistics_scope(topic_statistics_.get());
+    if (!msg) {
+      throw std::runtime_error("cannot publish msg which is a null pointer");
+    }
+    if (!intra_process_is_enabled_) {
+      if (async_publish_queue_) {
+        // Returns to the pool once published by the publisher thread
+        this->do_inter_process_publish_shared(message_pool_->share(std::move(msg)));
+      } else {
+        this->do_inter_process_publish(*msg);
+      }
+      return;
+    }
+
+    bool inter_process_publish_needed = this->has_inter_process_subscriptions();
+
+    // The pool recycles the shared pointer control block as well
+    auto shared_msg = message_pool_->share(std::move(msg));
+    this->do_intra_process_ros_message_publish_shared(shared_msg);
+    if (inter_process_publish_needed) {
+      this->do_inter_process_publish_shared(std::move(shared_msg));
+    }
+  }
+
   void
   publish(const rcl_serialized_message_t & serialized_msg)
   {
+    PublishStatisticsScope statistics_scope(topic_statistics_.get());
     return this->do_serialized_publish(&serialized_msg);
   }
 
   void
   publish(const SerializedMessage & serialized_msg)
   {
+    PublishStatisticsScope statistics_scope(topic_statistics_.get());
     return this->do_serialized_publish(&serialized_msg.get_rcl_serialized_message());
   }
 
@@ -378,6 +548,7 @@ public:
   void
   publish(rclcpp::LoanedMessage<ROSMessageType, AllocatorT> && loaned_msg)
   {
+    PublishStatisticsScope statistics_scope(topic_statistics_.get());
     if (!loaned_msg.is_valid()) {
       throw std::runtime_error("loaned message is not valid");
     }
@@ -398,6 +569,31 @@ public:
     }
   }
 
+  /// Wait until the messages queued for asynchronous publication were published.
+  /**
+   * \param[in] timeout the maximum time to wait, forever if negative
+   * \return false on timeout, true if all the queued messages were published or if
+   *   PublisherOptions::async_publish is disabled
+   */
+  template<typename RepT = int64_t, typename RatioT = std::milli>
+  bool
+  wait_for_async_publish(
+    std::chrono::duration<RepT, RatioT> timeout = std::chrono::duration<RepT, RatioT>(-1))
+  {
+    if (!async_publish_queue_) {
+      return true;
+    }
+    return async_publish_queue_->wait_until_empty(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(timeout));
+  }
+
+  /// Get the number of messages dropped because the asynchronous publish queue was full.
+  uint64_t
+  get_async_publish_dropped_count() const
+  {
+    return async_publish_queue_ ? async_publish_queue_->get_dropped_count() : 0u;
+  }
+
   [[deprecated("use get_published_type_allocator() or get_ros_message_type_allocator() instead")]]
   std::shared_ptr<PublishedTypeAllocator>
   get_allocator() const
@@ -418,10 +614,50 @@ public:
   }
 
 protected:
+  /// Publish a message inter-process, from the publisher thread if asynchronous publication is on.
   void
   do_inter_process_publish(const ROSMessageType & msg)
   {
-    TRACETOOLS_TRACEPOINT(rclcpp_publish, nullptr, static_cast<const void *>(&msg));
+    if (!inter_process_rate_limiter_.try_accept()) {
+      return;
+    }
+    if (!async_publish_queue_) {
+      this->do_inter_process_publish_now(msg);
+      return;
+    }
+    this->push_inter_process_publish(
+      std::allocate_shared<ROSMessageType, ROSMessageTypeAllocator>(
+        ros_message_type_allocator_, msg));
+  }
+
+  /// Publish a shared message inter-process, without copying it if it's published asynchronously.
+  void
+  do_inter_process_publish_shared(std::shared_ptr<const ROSMessageType> msg)
+  {
+    if (!inter_process_rate_limiter_.try_accept()) {
+      return;
+    }
+    if (!async_publish_queue_) {
+      this->do_inter_process_publish_now(*msg);
+      return;
+    }
+    this->push_inter_process_publish(std::move(msg));
+  }
+
+  /// Queue a shared message accepted by the rate limiter, for the publisher thread.
+  void
+  push_inter_process_publish(std::shared_ptr<const ROSMessageType> msg)
+  {
+    async_publish_queue_->push(
+      [this, msg = std::move(msg)]() {
+        this->do_inter_process_publish_now(*msg);
+      });
+  }
+
+  void
+  do_inter_process_publish_now(const ROSMessageType & msg)
+  {
+    RCLCPP_TRACEPOINT(Publisher, rclcpp_publish, nullptr, static_cast<const void *>(&msg));
     auto status = rcl_publish(publisher_handle_.get(), &msg, nullptr);
 
     if (RCL_RET_PUBLISHER_INVALID == status) {
@@ -437,6 +673,29 @@ protected:
     if (RCL_RET_OK != status) {
       rclcpp::exceptions::throw_from_rcl_error(status, "failed to publish message");
     }
+    if (topic_statistics_) {
+      topic_statistics_->record_inter_process_publication();
+    }
+  }
+
+  /// Publish a type adapted message inter-process, serializing it directly if possible.
+  /**
+   * \sa rclcpp::TypeAdapter for the optional serialize_to() function of the adapter.
+   */
+  void
+  do_type_adapted_inter_process_publish_now(const PublishedType & msg)
+  {
+    using TypeAdapterT = rclcpp::TypeAdapter<MessageT>;
+    if constexpr (rclcpp::detail::has_serialize_to<TypeAdapterT>::value) {
+      rclcpp::SerializedMessage serialized_msg;
+      TypeAdapterT::serialize_to(msg, serialized_msg);
+      this->do_serialized_publish(&serialized_msg.get_rcl_serialized_message());
+    } else {
+      // Convert to the ROS message equivalent and publish it.
+      ROSMessageType ros_msg;
+      TypeAdapterT::convert_to_ros_message(msg, ros_msg);
+      this->do_inter_process_publish_now(ros_msg);
+    }
   }
 
   void
@@ -450,13 +709,17 @@ protected:
     if (RCL_RET_OK != status) {
       rclcpp::exceptions::throw_from_rcl_error(status, "failed to publish serialized message");
     }
+    if (topic_statistics_) {
+      topic_statistics_->record_inter_process_publication();
+      topic_statistics_->record_published_bytes(serialized_msg->buffer_length);
+    }
   }
 
   void
   do_loaned_message_publish(
     std::unique_ptr<ROSMessageType, std::function<void(ROSMessageType *)>> msg)
   {
-    TRACETOOLS_TRACEPOINT(rclcpp_publish, nullptr, static_cast<const void *>(msg.get()));
+    RCLCPP_TRACEPOINT(Publisher, rclcpp_publish, nullptr, static_cast<const void *>(msg.get()));
     auto status = rcl_publish_loaned_message(publisher_handle_.get(), msg.get(), nullptr);
 
     if (RCL_RET_PUBLISHER_INVALID == status) {
@@ -472,10 +735,15 @@ protected:
     if (RCL_RET_OK != status) {
       rclcpp::exceptions::throw_from_rcl_error(status, "failed to publish message");
     }
+    if (topic_statistics_) {
+      topic_statistics_->record_inter_process_publication(true);
+    }
   }
 
   void
-  do_intra_process_publish(std::unique_ptr<PublishedType, PublishedTypeDeleter> msg)
+  do_intra_process_publish(
+    std::unique_ptr<PublishedType, PublishedTypeDeleter> msg,
+    std::shared_ptr<const ROSMessageType> ros_msg = nullptr)
   {
     auto ipm = weak_ipm_.lock();
     if (!ipm) {
@@ -485,15 +753,20 @@ protected:
     if (!msg) {
       throw std::runtime_error("cannot publish msg which is a null pointer");
     }
-    TRACETOOLS_TRACEPOINT(
+    RCLCPP_TRACEPOINT(
+      IntraProcess,
       rclcpp_intra_publish,
       static_cast<const void *>(publisher_handle_.get()),
       msg.get());
+    if (topic_statistics_) {
+      topic_statistics_->record_intra_process_publication();
+    }
 
     ipm->template do_intra_process_publish<PublishedType, ROSMessageType, AllocatorT>(
       intra_process_publisher_id_,
       std::move(msg),
-      published_type_allocator_);
+      published_type_allocator_,
+      std::move(ros_msg));
   }
 
   void
@@ -507,10 +780,14 @@ protected:
     if (!msg) {
       throw std::runtime_error("cannot publish msg which is a null pointer");
     }
-    TRACETOOLS_TRACEPOINT(
+    RCLCPP_TRACEPOINT(
+      IntraProcess,
       rclcpp_intra_publish,
       static_cast<const void *>(publisher_handle_.get()),
       msg.get());
+    if (topic_statistics_) {
+      topic_statistics_->record_intra_process_publication();
+    }
 
     ipm->template do_intra_process_publish<ROSMessageType, ROSMessageType, AllocatorT>(
       intra_process_publisher_id_,
@@ -530,10 +807,14 @@ protected:
     if (!msg) {
       throw std::runtime_error("cannot publish msg which is a null pointer");
     }
-    TRACETOOLS_TRACEPOINT(
+    RCLCPP_TRACEPOINT(
+      IntraProcess,
       rclcpp_intra_publish,
       static_cast<const void *>(publisher_handle_.get()),
       msg.get());
+    if (topic_statistics_) {
+      topic_statistics_->record_intra_process_publication();
+    }
 
     return ipm->template do_intra_process_publish_and_return_shared<ROSMessageType, ROSMessageType,
              AllocatorT>(
@@ -543,6 +824,45 @@ protected:
   }
 
 
+  void
+  do_intra_process_ros_message_publish_shared(std::shared_ptr<const ROSMessageType> msg)
+  {
+    auto ipm = weak_ipm_.lock();
+    if (!ipm) {
+      throw std::runtime_error(
+              "intra process publish called after destruction of intra process manager");
+    }
+    RCLCPP_TRACEPOINT(
+      IntraProcess,
+      rclcpp_intra_publish,
+      static_cast<const void *>(publisher_handle_.get()),
+      msg.get());
+    if (topic_statistics_) {
+      topic_statistics_->record_intra_process_publication();
+    }
+
+    ipm->template do_intra_process_publish_shared<ROSMessageType, ROSMessageType, AllocatorT,
+      ROSMessageTypeDeleter>(
+      intra_process_publisher_id_,
+      std::move(msg),
+      ros_message_type_allocator_);
+  }
+
+  /// Publish a ROS message intra-process, and inter-process if needed.
+  void
+  do_ros_message_publish(
+    std::unique_ptr<ROSMessageType, ROSMessageTypeDeleter> msg,
+    bool inter_process_publish_needed)
+  {
+    if (inter_process_publish_needed) {
+      auto shared_msg =
+        this->do_intra_process_ros_message_publish_and_return_shared(std::move(msg));
+      this->do_inter_process_publish_shared(std::move(shared_msg));
+    } else {
+      this->do_intra_process_ros_message_publish(std::move(msg));
+    }
+  }
+
   /// Return a new unique_ptr using the ROSMessageType of the publisher.
   std::unique_ptr<ROSMessageType, ROSMessageTypeDeleter>
   create_ros_message_unique_ptr()
@@ -581,6 +901,19 @@ protected:
   PublishedTypeDeleter published_type_deleter_;
   ROSMessageTypeAllocator ros_message_type_allocator_;
   ROSMessageTypeDeleter ros_message_type_deleter_;
+
+  /// Pool of the messages returned by acquire(), nullptr if disabled.
+  std::shared_ptr<ROSMessagePool> message_pool_;
+
+  /// Decimation of the inter-process publications, see PublisherOptionsBase::max_rate.
+  rclcpp::detail::RateLimiter inter_process_rate_limiter_;
+
+  /// Queue of the asynchronous inter-process publications, nullptr if disabled.
+  /**
+   * Declared last so that it's destroyed first, publishing what's still queued while the
+   * rest of the publisher is alive.
+   */
+  std::unique_ptr<rclcpp::detail::AsyncPublishQueue> async_publish_queue_;
 };
 
 }  // namespace rclcpp
@@ -18,6 +18,7 @@
 #include <rmw/error_handling.h>
 #include <rmw/rmw.h>
 
+#include <atomic>
 #include <chrono>
 #include <functional>
 #include <iostream>
@@ -57,6 +58,11 @@ namespace experimental
 class IntraProcessManager;
 }  // namespace experimental
 
+namespace topic_statistics
+{
+class PublisherTopicStatistics;
+}  // namespace topic_statistics
+
 class PublisherBase : public std::enable_shared_from_this<PublisherBase>
 {
   friend ::rclcpp::node_interfaces::NodeTopicsInterface;
@@ -139,6 +145,20 @@ public:
   size_t
   get_intra_process_subscription_count() const;
 
+  /// Return true if any subscription, intra-process or not, is matched with this publisher.
+  /**
+   * This is cheap enough to be called before building each message, e.g. to only fill in
+   * debug or visualization messages when somebody listens to them.
+   * The number of matched subscriptions is cached, the middleware is only asked for it again
+   * after subscriptions were matched or unmatched, or on each call if the middleware
+   * doesn't support matched events or if a matched callback was given in the event callbacks.
+   *
+   * \return true if at least one subscription is matched
+   */
+  RCLCPP_PUBLIC
+  bool
+  has_any_subscribers() const;
+
   /// Manually assert that this Publisher is alive (for RMW_QOS_POLICY_LIVELINESS_MANUAL_BY_TOPIC).
   /**
    * If the rmw Liveliness policy is set to RMW_QOS_POLICY_LIVELINESS_MANUAL_BY_TOPIC, the creator
@@ -167,6 +187,16 @@ public:
   rclcpp::QoS
   get_actual_qos() const;
 
+  /// Return true if the publisher publishes serialized messages, e.g. a GenericPublisher.
+  /**
+   * Intra-process communication only connects publishers and subscriptions which both use
+   * serialized messages, or which both use typed messages.
+   */
+  RCLCPP_PUBLIC
+  virtual
+  bool
+  is_serialized() const;
+
   /// Check if publisher instance can loan messages.
   /**
    * Depending on the middleware and the message type, this will return true if the middleware
@@ -206,6 +236,24 @@ public:
     uint64_t intra_process_publisher_id,
     IntraProcessManagerSharedPtr ipm);
 
+  /// Implementation utility function used by the intra process manager to cache the count.
+  /**
+   * \param count the number of intra-process subscriptions matched with this publisher
+   */
+  RCLCPP_PUBLIC
+  void
+  set_intra_process_subscription_count(size_t count);
+
+  /// Implementation utility function used to setup topic statistics after creation.
+  /**
+   * \param topic_statistics the statistics measuring this publisher, or nullptr to disable them
+   * \sa rclcpp::PublisherOptionsBase::topic_stats_options
+   */
+  RCLCPP_PUBLIC
+  void
+  set_topic_statistics(
+    std::shared_ptr<rclcpp::topic_statistics::PublisherTopicStatistics> topic_statistics);
+
   /// Get network flow endpoints
   /**
    * Describes network flow endpoints that this publisher is sending messages out on
@@ -347,6 +395,25 @@ protected:
     event_handlers_.insert(std::make_pair(event_type, handler));
   }
 
+  /// Return true if some matched subscriptions aren't intra-process ones.
+  /**
+   * Both counts are cached, as for has_any_subscribers(): the number of intra-process
+   * subscriptions is kept up to date by the intra process manager.
+   */
+  RCLCPP_PUBLIC
+  bool
+  has_inter_process_subscriptions() const;
+
+  /// Get the number of matched subscriptions, only asking the middleware if it changed.
+  RCLCPP_PUBLIC
+  size_t
+  get_cached_subscription_count() const;
+
+  /// Set up the matched event invalidating the cached subscription count, if possible.
+  RCLCPP_PUBLIC
+  void
+  cache_subscription_count();
+
   RCLCPP_PUBLIC
   void default_incompatible_qos_callback(QOSOfferedIncompatibleQoSInfo & info) const;
 
@@ -365,6 +432,14 @@ protected:
   bool intra_process_is_enabled_;
   IntraProcessManagerWeakPtr weak_ipm_;
   uint64_t intra_process_publisher_id_;
+  std::atomic<size_t> intra_process_subscription_count_{0};
+
+  // Matched event which isn't given to executors, only used to invalidate the cached count
+  std::shared_ptr<rclcpp::EventHandlerBase> matched_event_handler_;
+  mutable std::atomic_bool subscription_count_outdated_{true};
+  mutable std::atomic<size_t> subscription_count_{0};
+
+  std::shared_ptr<rclcpp::topic_statistics::PublisherTopicStatistics> topic_statistics_;
 
   rmw_gid_t rmw_gid_;
 
@@ -15,6 +15,7 @@
 #ifndef RCLCPP__PUBLISHER_OPTIONS_HPP_
 #define RCLCPP__PUBLISHER_OPTIONS_HPP_
 
+#include <chrono>
 #include <memory>
 #include <string>
 #include <type_traits>
@@ -28,6 +29,8 @@
 #include "rclcpp/qos.hpp"
 #include "rclcpp/event_handler.hpp"
 #include "rclcpp/qos_overriding_options.hpp"
+#include "rclcpp/serialized_message_codec.hpp"
+#include "rclcpp/topic_statistics_state.hpp"
 
 namespace rclcpp
 {
@@ -59,6 +62,83 @@ struct PublisherOptionsBase
   rmw_implementation_payload = nullptr;
 
   QosOverridingOptions qos_overriding_options;
+
+  /// Number of messages preallocated in a pool for Publisher::acquire(), 0 to disable the pool.
+  /**
+   * Messages acquired from the pool and published return to it once they are released by the
+   * middleware and by the intra-process subscriptions, instead of being destroyed.
+   */
+  size_t message_pool_size = 0;
+
+  /// Maximum rate in Hz of the messages published inter-process, 0 to publish them all.
+  /**
+   * Messages published faster are not sent to the inter-process subscriptions, they are
+   * dropped before being serialized, or converted from a type adapted message.
+   * Intra-process subscriptions still receive every message.
+   */
+  double max_rate = 0.0;
+
+  /// Codec encoding the messages published inter-process, e.g. compressing them, or nullptr.
+  /**
+   * Only used by publishers of serialized messages, e.g. GenericPublisher.
+   * The subscriptions to the topic have to decode the messages with the same codec.
+   *
+   * \sa rclcpp::SerializedMessageCodec
+   */
+  std::shared_ptr<rclcpp::SerializedMessageCodec> payload_codec;
+
+  /// Options to publish the inter-process messages from a thread of the publisher.
+  struct AsyncPublishOptions
+  {
+    /// What publish() does when the queue of the publisher is full.
+    enum class OverflowPolicy
+    {
+      /// Drop the oldest queued message, which is never published.
+      DropOldest,
+      /// Wait until the publisher thread took a message from the queue.
+      Block,
+    };
+
+    /// Number of messages which can wait to be published, 0 to publish synchronously.
+    /**
+     * When greater than zero, publish() only queues the inter-process publication of the
+     * message, and the publisher thread serializes and publishes it.
+     * The intra-process subscriptions still receive the message before publish() returns.
+     *
+     * Serialized and loaned messages are always published synchronously.
+     */
+    size_t queue_size = 0;
+
+    /// What publish() does when queue_size messages are already waiting to be published.
+    OverflowPolicy overflow_policy = OverflowPolicy::DropOldest;
+  };
+
+  AsyncPublishOptions async_publish;
+
+  /// Options to configure the topic statistics of the publisher.
+  /**
+   * \sa rclcpp::topic_statistics::PublisherTopicStatistics for the published metrics.
+   */
+  struct TopicStatisticsOptions
+  {
+    /// Enable and disable topic statistics calculation and publication.
+    /**
+     * Unlike for subscriptions, this defaults to disabled instead of following the node,
+     * set it to NodeDefault to enable them with NodeOptions::enable_topic_statistics().
+     */
+    TopicStatisticsState state = TopicStatisticsState::Disable;
+
+    /// Topic to which topic statistics get published when enabled.
+    std::string publish_topic = "/statistics";
+
+    /// Topic statistics publication period, only values greater than zero are allowed.
+    std::chrono::milliseconds publish_period{std::chrono::seconds(1)};
+
+    /// QoS of the topic statistics publisher.
+    rclcpp::QoS qos = SystemDefaultsQoS();
+  };
+
+  TopicStatisticsOptions topic_stats_options;
 };
 
 /// Structure containing optional configuration for Publishers.
@@ -129,6 +129,27 @@ public:
   const QosCallback &
   get_validation_callback() const;
 
+  /// Only declare the parameters of the policies given a parameter override.
+  /**
+   * The parameters are read-only, so those without an override can only have the value of
+   * the default profile.
+   * Not declaring them saves a parameter declaration per policy when creating the entity,
+   * which adds up for nodes with hundreds of publishers and subscriptions, but they are
+   * not listed among the parameters of the node then.
+   * Defaults to false, all the policies of the options are declared.
+   *
+   * \param[in] declare_only_overridden whether to only declare the overridden policies
+   * \return a reference to this object
+   */
+  RCLCPP_PUBLIC
+  QosOverridingOptions &
+  declare_only_overridden(bool declare_only_overridden = true);
+
+  /// Return true if only the parameters of the overridden policies are declared.
+  RCLCPP_PUBLIC
+  bool
+  get_declare_only_overridden() const;
+
   /// Construct passing a list of QoS policies and a verification callback.
   /**
    * Same as `QosOverridingOptions` constructor, but only declares the default policies:
@@ -147,6 +168,8 @@ private:
   std::vector<QosPolicyKind> policy_kinds_;
   /// \internal Validation callback that will be called to verify the profile.
   QosCallback validation_callback_;
+  /// \internal If true, only the policies with a parameter override are declared.
+  bool declare_only_overridden_ = false;
 };
 
 }  // namespace rclcpp
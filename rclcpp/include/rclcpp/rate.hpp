@@ -15,7 +15,9 @@
 #ifndef RCLCPP__RATE_HPP_
 #define RCLCPP__RATE_HPP_
 
+#include <array>
 #include <chrono>
+#include <cstdint>
 #include <memory>
 #include <thread>
 
@@ -130,11 +132,44 @@ private:
   std::chrono::time_point<Clock, ClockDurationNano> last_interval_;
 };
 
+/// Statistics of the cycles of a Rate.
+struct RateStatistics
+{
+  /// Number of buckets of the lateness histogram.
+  static constexpr size_t lateness_histogram_size = 16;
+
+  /// Number of calls of sleep().
+  uint64_t cycle_count = 0;
+  /// Number of calls of sleep() made after the end of their cycle.
+  uint64_t overrun_count = 0;
+  /// Total number of cycles skipped because of overruns.
+  uint64_t missed_cycles = 0;
+  /// Largest lateness of the end of a cycle.
+  std::chrono::nanoseconds max_lateness{0};
+  /// Number of cycles by lateness of their end.
+  /**
+   * The lateness is how long after the end of its cycle sleep() returned, or was called for
+   * an overrun.
+   * The first bucket counts the lateness below 1us, the bucket i the lateness from 2^(i-1)us
+   * to 2^i us, and the last bucket all the larger ones.
+   */
+  std::array<uint64_t, lateness_histogram_size> lateness_histogram{};
+};
+
 class Rate : public RateBase
 {
 public:
   RCLCPP_SMART_PTR_DEFINITIONS(Rate)
 
+  /// How the cycles are scheduled after an overrun, when sleep() is called after a cycle end.
+  enum class OverrunPolicy
+  {
+    /// Restart the cycles from the time of the overrun, if a whole cycle was missed.
+    Reset,
+    /// Keep the cycles ends at whole periods from the start, skipping the missed ones.
+    KeepPhase
+  };
+
   RCLCPP_PUBLIC
   explicit Rate(
     const double rate,
@@ -166,12 +201,46 @@ public:
   std::chrono::nanoseconds
   period() const;
 
+  /// Set how the cycles are scheduled after an overrun, OverrunPolicy::Reset by default.
+  /**
+   * With OverrunPolicy::KeepPhase, the cycles end at whole periods after the start or the
+   * last reset(), so that a control loop stays phase-locked, and sleep() sleeps until these
+   * absolute times rather than for a duration.
+   * A backwards jump of the time restarts the cycles from the current time.
+   */
+  RCLCPP_PUBLIC
+  void
+  set_overrun_policy(OverrunPolicy policy);
+
+  RCLCPP_PUBLIC
+  OverrunPolicy
+  get_overrun_policy() const;
+
+  /// Get the statistics of the cycles since the rate was created or they were reset.
+  RCLCPP_PUBLIC
+  RateStatistics
+  get_statistics() const;
+
+  RCLCPP_PUBLIC
+  void
+  reset_statistics();
+
 private:
   RCLCPP_DISABLE_COPY(Rate)
 
+  bool
+  sleep_keeping_phase();
+
+  void
+  record_cycle(const Time & cycle_end, const Time & now, bool overrun, uint64_t missed_cycles);
+
   Clock::SharedPtr clock_;
+  // Reused by every sleep, instead of registering callbacks on the clock each time
+  ClockSleeper sleeper_;
   Duration period_;
   Time last_interval_;
+  OverrunPolicy overrun_policy_ = OverrunPolicy::Reset;
+  RateStatistics statistics_;
 };
 
 class WallRate : public Rate
@@ -19,7 +19,9 @@
  *
  * - Node
  *   - rclcpp::Node
+ *   - rclcpp::destroy_nodes()
  *   - rclcpp/node.hpp
+ *   - rclcpp/destroy_nodes.hpp
  * - Publisher
  *   - rclcpp::Node::create_publisher()
  *   - rclcpp::Publisher
@@ -54,11 +56,14 @@
  *   - rclcpp::ParameterValue
  *   - rclcpp::AsyncParametersClient
  *   - rclcpp::SyncParametersClient
+ *   - rclcpp::MultiplexedParameterService
  *   - rclcpp::copy_all_parameter_values()
  *   - rclcpp/parameter.hpp
  *   - rclcpp/parameter_value.hpp
  *   - rclcpp/parameter_client.hpp
  *   - rclcpp/parameter_service.hpp
+ *   - rclcpp/multiplexed_parameter_client.hpp
+ *   - rclcpp/multiplexed_parameter_service.hpp
  * - Rate:
  *   - rclcpp::Rate
  *   - rclcpp::WallRate
@@ -169,13 +174,18 @@
 #include <memory>
 
 #include "rclcpp/copy_all_parameter_values.hpp"
+#include "rclcpp/destroy_nodes.hpp"
 #include "rclcpp/executors.hpp"
 #include "rclcpp/guard_condition.hpp"
 #include "rclcpp/logging.hpp"
+#include "rclcpp/multiplexed_parameter_client.hpp"
+#include "rclcpp/multiplexed_parameter_service.hpp"
+#include "rclcpp/namespace_view.hpp"
 #include "rclcpp/node.hpp"
 #include "rclcpp/parameter_client.hpp"
 #include "rclcpp/parameter_event_handler.hpp"
 #include "rclcpp/parameter.hpp"
+#include "rclcpp/parameter_blackboard.hpp"
 #include "rclcpp/parameter_service.hpp"
 #include "rclcpp/rate.hpp"
 #include "rclcpp/time.hpp"
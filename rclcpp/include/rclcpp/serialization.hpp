@@ -15,16 +15,20 @@
 #ifndef RCLCPP__SERIALIZATION_HPP_
 #define RCLCPP__SERIALIZATION_HPP_
 
+#include <atomic>
+#include <cstddef>
 #include <memory>
 #include <stdexcept>
 #include <string>
 
+#include "rclcpp/serialized_message.hpp"
 #include "rclcpp/visibility_control.hpp"
 
 #include "rcl/types.h"
 
 #include "rosidl_runtime_c/message_type_support_struct.h"
 
+#include "rosidl_runtime_cpp/traits.hpp"
 #include "rosidl_typesupport_cpp/message_type_support.hpp"
 
 namespace rclcpp
@@ -79,6 +83,13 @@ private:
 };
 
 /// Default implementation to (de)serialize a message by using rmw_(de)serialize
+/**
+ * Messages of fixed size, as given by rosidl_generator_traits::has_fixed_size, are always
+ * serialized to the same number of bytes.
+ * That size is remembered per message type once a message was serialized, so that the
+ * following serializations reserve exactly that capacity upfront, instead of letting the
+ * middleware grow the buffer.
+ */
 template<typename MessageT>
 class Serialization : public SerializationBase
 {
@@ -91,6 +102,52 @@ public:
       !serialization_traits::is_serialized_message_class<MessageT>::value,
       "Serialization of serialized message to serialized message is not possible.");
   }
+
+  /// Serialize a ROS2 message to a serialized stream
+  /**
+   * \param[in] ros_message The ROS2 message which is read and serialized by rmw.
+   * \param[out] serialized_message The serialized message.
+   */
+  void serialize_message(
+    const void * ros_message, SerializedMessage * serialized_message) const
+  {
+    if constexpr (rosidl_generator_traits::has_fixed_size<MessageT>::value) {
+      std::atomic<size_t> & fixed_size = fixed_serialized_size();
+      const size_t size = fixed_size.load(std::memory_order_relaxed);
+      if (size != 0 && nullptr != serialized_message && serialized_message->capacity() < size) {
+        serialized_message->reserve(size);
+      }
+      SerializationBase::serialize_message(ros_message, serialized_message);
+      if (0u == size) {
+        fixed_size.store(serialized_message->size(), std::memory_order_relaxed);
+      }
+    } else {
+      SerializationBase::serialize_message(ros_message, serialized_message);
+    }
+  }
+
+  /// Get the serialized size of the messages of fixed size, once it's known.
+  /**
+   * \return the size in bytes of the serialized messages, or 0 if the messages don't have a
+   *   fixed size or none was serialized yet
+   */
+  static size_t
+  get_fixed_serialized_size()
+  {
+    if constexpr (rosidl_generator_traits::has_fixed_size<MessageT>::value) {
+      return fixed_serialized_size().load(std::memory_order_relaxed);
+    } else {
+      return 0u;
+    }
+  }
+
+private:
+  static std::atomic<size_t> &
+  fixed_serialized_size()
+  {
+    static std::atomic<size_t> size{0};
+    return size;
+  }
 };
 
 }  // namespace rclcpp
@@ -0,0 +1,202 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef RCLCPP__SERIALIZED_FIELD_EXTRACTOR_HPP_
+#define RCLCPP__SERIALIZED_FIELD_EXTRACTOR_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "rcpputils/shared_library.hpp"
+#include "rosidl_runtime_c/message_type_support_struct.h"
+#include "rosidl_typesupport_introspection_cpp/field_types.hpp"
+#include "rosidl_typesupport_introspection_cpp/message_introspection.hpp"
+
+#include "rclcpp/macros.hpp"
+#include "rclcpp/serialized_message.hpp"
+#include "rclcpp/visibility_control.hpp"
+
+namespace rclcpp
+{
+
+/// Read a single field of serialized messages, without deserializing them.
+/**
+ * The path to the field, e.g. "header.stamp.sec", is resolved once against the introspection
+ * type support of the message type.
+ * Extracting the field then walks the CDR data up to it, only reading the lengths of the
+ * strings and sequences preceding it, e.g. in the callback of a rclcpp::GenericSubscription.
+ *
+ * The field has to be a primitive or a string, which isn't in an array or a sequence.
+ * The members preceding it can't be wide strings, wide characters or long doubles, and the
+ * messages have to be serialized with plain (XCDR1) CDR, as done by the ROS middlewares.
+ */
+class SerializedFieldExtractor
+{
+public:
+  RCLCPP_SMART_PTR_DEFINITIONS(SerializedFieldExtractor)
+
+  /// Create an extractor for a field of the given message type.
+  /**
+   * The introspection type support library of the type is loaded, and kept loaded for the
+   * lifetime of the extractor.
+   *
+   * \param[in] type the message type, e.g. "std_msgs/msg/Header"
+   * \param[in] field_path the names of the nested fields leading to the field, joined by dots
+   * \throws std::runtime_error if the type support of the type can't be loaded
+   * \throws std::invalid_argument if the field doesn't exist or can't be extracted
+   */
+  RCLCPP_PUBLIC
+  SerializedFieldExtractor(const std::string & type, const std::string & field_path);
+
+  /// Create an extractor for a field of the message type of the given type support.
+  /**
+   * \param[in] type_support the introspection type support of the message type, or a type
+   *   support providing it, which must outlive the extractor
+   * \param[in] field_path the names of the nested fields leading to the field, joined by dots
+   * \throws std::invalid_argument if the type support doesn't provide introspection, or if
+   *   the field doesn't exist or can't be extracted
+   */
+  RCLCPP_PUBLIC
+  SerializedFieldExtractor(
+    const rosidl_message_type_support_t * type_support,
+    const std::string & field_path);
+
+  /// Get the path of the extracted field.
+  RCLCPP_PUBLIC
+  const std::string &
+  get_field_path() const;
+
+  /// Get the introspection type id of the extracted field.
+  /**
+   * \return one of the rosidl_typesupport_introspection_cpp::ROS_TYPE_* values
+   */
+  RCLCPP_PUBLIC
+  uint8_t
+  get_field_type_id() const;
+
+  /// Extract the value of the field from a serialized message.
+  /**
+   * \tparam T the type of the field, std::string for a string field
+   * \param[in] message the serialized message, of the message type of the extractor
+   * \return the value of the field
+   * \throws std::invalid_argument if T doesn't match the type of the field
+   * \throws std::runtime_error if the data is truncated or isn't plain CDR
+   */
+  template<typename T>
+  T
+  extract(const rclcpp::SerializedMessageView & message) const
+  {
+    if constexpr (std::is_same_v<T, std::string>) {
+      return extract_string(message);
+    } else {
+      static_assert(
+        std::is_arithmetic_v<T>, "a field can only be extracted as an arithmetic type or a string");
+      if (!matches_field_type<T>(field_type_id_)) {
+        throw std::invalid_argument(
+                "the type requested doesn't match the type of field '" + field_path_ + "'");
+      }
+      bool swap = false;
+      const uint8_t * data = find_field(message, sizeof(T), swap);
+      uint8_t bytes[sizeof(T)];
+      for (size_t i = 0; i < sizeof(T); ++i) {
+        bytes[i] = data[swap ? sizeof(T) - 1 - i : i];
+      }
+      T value;
+      std::memcpy(&value, bytes, sizeof(T));
+      return value;
+    }
+  }
+
+  /// Extract the value of the field from a serialized message.
+  /**
+   * \sa extract(const rclcpp::SerializedMessageView &) const
+   */
+  template<typename T>
+  T
+  extract(const rclcpp::SerializedMessage & message) const
+  {
+    return extract<T>(rclcpp::SerializedMessageView(message));
+  }
+
+private:
+  /// Members to skip in a message of the path, before the next field of the path.
+  struct Step
+  {
+    const rosidl_typesupport_introspection_cpp::MessageMembers * members;
+    uint32_t field_index;
+  };
+
+  void
+  compile(const rosidl_message_type_support_t * type_support);
+
+  /// Find the field in the message, checking that size bytes can be read from it.
+  RCLCPP_PUBLIC
+  const uint8_t *
+  find_field(const rclcpp::SerializedMessageView & message, size_t size, bool & swap) const;
+
+  RCLCPP_PUBLIC
+  std::string
+  extract_string(const rclcpp::SerializedMessageView & message) const;
+
+  template<typename T>
+  static
+  bool
+  matches_field_type(uint8_t type_id)
+  {
+    namespace introspection = rosidl_typesupport_introspection_cpp;
+    if constexpr (std::is_same_v<T, bool>) {
+      return type_id == introspection::ROS_TYPE_BOOLEAN;
+    } else if constexpr (std::is_same_v<T, float>) {
+      return type_id == introspection::ROS_TYPE_FLOAT;
+    } else if constexpr (std::is_same_v<T, double>) {
+      return type_id == introspection::ROS_TYPE_DOUBLE;
+    } else if constexpr (std::is_same_v<T, int8_t>) {
+      return type_id == introspection::ROS_TYPE_INT8;
+    } else if constexpr (std::is_same_v<T, uint8_t>) {
+      return type_id == introspection::ROS_TYPE_UINT8 ||
+             type_id == introspection::ROS_TYPE_OCTET ||
+             type_id == introspection::ROS_TYPE_CHAR;
+    } else if constexpr (std::is_same_v<T, int16_t>) {
+      return type_id == introspection::ROS_TYPE_INT16;
+    } else if constexpr (std::is_same_v<T, uint16_t>) {
+      return type_id == introspection::ROS_TYPE_UINT16;
+    } else if constexpr (std::is_same_v<T, int32_t>) {
+      return type_id == introspection::ROS_TYPE_INT32;
+    } else if constexpr (std::is_same_v<T, uint32_t>) {
+      return type_id == introspection::ROS_TYPE_UINT32;
+    } else if constexpr (std::is_same_v<T, int64_t>) {
+      return type_id == introspection::ROS_TYPE_INT64;
+    } else if constexpr (std::is_same_v<T, uint64_t>) {
+      return type_id == introspection::ROS_TYPE_UINT64;
+    } else {
+      return false;
+    }
+  }
+
+  std::shared_ptr<rcpputils::SharedLibrary> library_;
+  std::string field_path_;
+  std::vector<Step> steps_;
+  uint8_t field_type_id_;
+};
+
+}  // namespace rclcpp
+
+#endif  // RCLCPP__SERIALIZED_FIELD_EXTRACTOR_HPP_
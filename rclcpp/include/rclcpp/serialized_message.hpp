@@ -15,6 +15,9 @@
 #ifndef RCLCPP__SERIALIZED_MESSAGE_HPP_
 #define RCLCPP__SERIALIZED_MESSAGE_HPP_
 
+#include <cstddef>
+#include <cstdint>
+
 #include "rcl/allocator.h"
 #include "rcl/types.h"
 
@@ -116,6 +119,39 @@ private:
   rcl_serialized_message_t serialized_message_;
 };
 
+/// Non-owning view of the data of a serialized message.
+/**
+ * The view doesn't copy the data, so it's only valid as long as the viewed buffer is alive,
+ * e.g. for the duration of the subscription callback it's given to.
+ */
+class SerializedMessageView
+{
+public:
+  /// Create a view of the given buffer.
+  SerializedMessageView(const uint8_t * data, size_t size)
+  : data_(data), size_(size)
+  {}
+
+  /// Create a view of the data of the given serialized message.
+  explicit SerializedMessageView(const SerializedMessage & serialized_message)
+  : SerializedMessageView(
+      serialized_message.get_rcl_serialized_message().buffer, serialized_message.size())
+  {}
+
+  /// Get a pointer to the first byte of the serialized data.
+  const uint8_t * data() const {return data_;}
+
+  /// Get the size of the serialized data, in bytes.
+  size_t size() const {return size_;}
+
+  /// Return true if the viewed data is empty.
+  bool empty() const {return size_ == 0u;}
+
+private:
+  const uint8_t * data_;
+  size_t size_;
+};
+
 }  // namespace rclcpp
 
 #endif  // RCLCPP__SERIALIZED_MESSAGE_HPP_
@@ -0,0 +1,71 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__SERIALIZED_MESSAGE_CODEC_HPP_
+#define RCLCPP__SERIALIZED_MESSAGE_CODEC_HPP_
+
+#include <memory>
+
+#include "rcl/types.h"
+
+#include "rclcpp/macros.hpp"
+#include "rclcpp/serialized_message.hpp"
+
+namespace rclcpp
+{
+
+/// Interface of the codecs transforming the payload of serialized messages, e.g. compressing it.
+/**
+ * A codec set in the options of a GenericPublisher encodes every message before it's published
+ * to the middleware, and the same codec set in the options of a GenericSubscription decodes
+ * every message taken from the middleware before it's delivered, so that the callbacks still
+ * receive the original serialized message.
+ * This saves bandwidth for large and compressible messages, e.g. point clouds or images,
+ * by plugging in a general purpose compression library such as LZ4 or zstd.
+ *
+ * Encoded messages are not valid serialized messages of the topic type anymore: all the
+ * subscriptions to the topic have to use a generic subscription with a matching codec.
+ * Messages published intra-process are not encoded.
+ *
+ * The methods may be called concurrently from several threads, and report errors, e.g. a
+ * corrupted input, by throwing an exception.
+ */
+class SerializedMessageCodec
+{
+public:
+  RCLCPP_SMART_PTR_DEFINITIONS_NOT_COPYABLE(SerializedMessageCodec)
+
+  virtual ~SerializedMessageCodec() = default;
+
+  /// Encode a serialized message.
+  /**
+   * \param[in] input the serialized message to encode
+   * \param[out] output an empty message, which may already have some capacity, reserve() it
+   *   as needed and set the length of its buffer to the size of the encoded message
+   */
+  virtual void
+  encode(const rcl_serialized_message_t & input, rclcpp::SerializedMessage & output) = 0;
+
+  /// Decode a serialized message encoded by encode().
+  /**
+   * \param[in] input the encoded message
+   * \param[out] output an empty message, filled as in encode()
+   */
+  virtual void
+  decode(const rcl_serialized_message_t & input, rclcpp::SerializedMessage & output) = 0;
+};
+
+}  // namespace rclcpp
+
+#endif  // RCLCPP__SERIALIZED_MESSAGE_CODEC_HPP_
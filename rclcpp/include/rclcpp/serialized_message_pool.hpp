@@ -0,0 +1,92 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__SERIALIZED_MESSAGE_POOL_HPP_
+#define RCLCPP__SERIALIZED_MESSAGE_POOL_HPP_
+
+#include <memory>
+
+#include "rcl/allocator.h"
+
+#include "rclcpp/macros.hpp"
+#include "rclcpp/serialized_message.hpp"
+#include "rclcpp/visibility_control.hpp"
+
+namespace rclcpp
+{
+
+/// Pool of serialized messages whose buffers are reused across messages.
+/**
+ * Serializing or taking a message into a new rclcpp::SerializedMessage allocates its buffer
+ * and grows it several times to fit the message.
+ * Messages acquired from this pool are returned to it when the last reference to them is
+ * dropped, keeping their buffer, so that high-rate serialized pipelines (e.g. recording or
+ * bridging) don't allocate memory for every message.
+ *
+ * The pool tracks the largest message returned to it (the high-water mark), and messages
+ * are acquired with at least that capacity, so buffers don't need to be grown even when
+ * message sizes vary.
+ *
+ * All the methods are thread safe, and acquired messages may outlive the pool.
+ */
+class SerializedMessagePool
+{
+public:
+  RCLCPP_SMART_PTR_DEFINITIONS(SerializedMessagePool)
+
+  /// Create a new, empty pool.
+  /**
+   * \param[in] max_free_messages maximum number of unused messages kept by the pool,
+   *   messages returned when the pool is full are destroyed
+   * \param[in] allocator allocator used for the buffers of the messages
+   */
+  RCLCPP_PUBLIC
+  explicit SerializedMessagePool(
+    size_t max_free_messages = 16,
+    const rcl_allocator_t & allocator = rcl_get_default_allocator());
+
+  RCLCPP_PUBLIC
+  virtual ~SerializedMessagePool();
+
+  /// Get an empty serialized message from the pool, allocating a new one if none is free.
+  /**
+   * The message is returned to the pool when the last copy of the shared pointer is destroyed.
+   * Its size is zero, and its capacity is at least the current high-water mark.
+   */
+  RCLCPP_PUBLIC
+  std::shared_ptr<rclcpp::SerializedMessage>
+  acquire();
+
+  /// Get the size of the largest message returned to the pool so far.
+  RCLCPP_PUBLIC
+  size_t
+  get_high_water_mark() const;
+
+  /// Get the number of unused messages currently kept by the pool.
+  RCLCPP_PUBLIC
+  size_t
+  get_number_of_free_messages() const;
+
+private:
+  RCLCPP_DISABLE_COPY(SerializedMessagePool)
+
+  // The state is shared with the acquired messages, so they can be returned
+  // even if they outlive the pool.
+  struct State;
+  std::shared_ptr<State> state_;
+};
+
+}  // namespace rclcpp
+
+#endif  // RCLCPP__SERIALIZED_MESSAGE_POOL_HPP_
@@ -22,6 +22,8 @@
 #include <mutex>
 #include <sstream>
 #include <string>
+#include <unordered_map>
+#include <utility>
 
 #include "rcl/error_handling.h"
 #include "rcl/event_callback.h"
@@ -37,19 +39,36 @@
 #include "rclcpp/any_service_callback.hpp"
 #include "rclcpp/clock.hpp"
 #include "rclcpp/detail/cpp_callback_trampoline.hpp"
+#include "rclcpp/detail/service_event_publisher.hpp"
+#include "rclcpp/detail/shared_object_pool.hpp"
 #include "rclcpp/exceptions.hpp"
+#include "rclcpp/experimental/service_intra_process.hpp"
 #include "rclcpp/expand_topic_or_service_name.hpp"
 #include "rclcpp/logging.hpp"
 #include "rclcpp/macros.hpp"
 #include "rclcpp/qos.hpp"
+#include "rclcpp/service_introspection_options.hpp"
 #include "rclcpp/type_support_decl.hpp"
 #include "rclcpp/visibility_control.hpp"
 
 namespace rclcpp
 {
 
+class CallbackGroup;
+
+namespace experimental
+{
+/**
+ * IntraProcessManager is forward declared here, avoiding a circular inclusion between
+ * `intra_process_manager.hpp` and `service.hpp`.
+ */
+class IntraProcessManager;
+}  // namespace experimental
+
 class ServiceBase
 {
+  friend class rclcpp::CallbackGroup;
+
 public:
   RCLCPP_SMART_PTR_DEFINITIONS_NOT_COPYABLE(ServiceBase)
 
@@ -57,7 +76,7 @@ public:
   explicit ServiceBase(std::shared_ptr<rcl_node_t> node_handle);
 
   RCLCPP_PUBLIC
-  virtual ~ServiceBase() = default;
+  virtual ~ServiceBase();
 
   /// Return the name of the service.
   /** \return The name of the service. */
@@ -83,6 +102,24 @@ public:
   std::shared_ptr<const rcl_service_t>
   get_service_handle() const;
 
+  /// Set the maximum number of requests the executor takes each time the service is ready.
+  /**
+   * Taking all the requests of a burst at once avoids waiting again for each of them.
+   * Requests can also be answered later and out of order, from other threads, by using a
+   * callback deferring the response and calling Service::send_response().
+   *
+   * \param[in] max_batch_size the maximum number of requests, it must be greater than zero
+   * \throws std::invalid_argument if max_batch_size is zero
+   */
+  RCLCPP_PUBLIC
+  void
+  set_max_batch_size(size_t max_batch_size);
+
+  /// Get the maximum number of requests the executor takes each time the service is ready.
+  RCLCPP_PUBLIC
+  size_t
+  get_max_batch_size() const;
+
   /// Take the next request from the service as a type erased pointer.
   /**
    * This type erased version of \sa Service::take_request() is useful when
@@ -248,6 +285,26 @@ public:
     }
   }
 
+  /// Get the callback group the service was added to.
+  /**
+   * The callback group keeps a weak pointer to the service, and the service a weak pointer
+   * back to the last callback group it was added to, so that executors find the group of the
+   * service without searching all the groups.
+   *
+   * \return the callback group, or nullptr if none or if it was destroyed
+   */
+  RCLCPP_PUBLIC
+  std::shared_ptr<rclcpp::CallbackGroup>
+  get_callback_group() const;
+
+  /// Return the waitable receiving the requests of the clients of the process.
+  /**
+   * \return the waitable, or nullptr if intra-process isn't set up for the service.
+   */
+  RCLCPP_PUBLIC
+  rclcpp::Waitable::SharedPtr
+  get_intra_process_waitable() const;
+
 protected:
   RCLCPP_DISABLE_COPY(ServiceBase)
 
@@ -263,6 +320,16 @@ protected:
   void
   set_on_new_request_callback(rcl_event_callback_t callback, const void * user_data);
 
+  /// Register the intra-process receiver of the service with the manager of the context.
+  /**
+   * \throws std::runtime_error if intra-process is already set up for the service
+   */
+  RCLCPP_PUBLIC
+  void
+  add_intra_process_service(
+    rclcpp::experimental::ServiceIntraProcessBase::SharedPtr service_intra_process,
+    rclcpp::Context & context);
+
   std::shared_ptr<rcl_node_t> node_handle_;
 
   std::recursive_mutex callback_mutex_;
@@ -278,6 +345,15 @@ protected:
   rclcpp::Logger node_logger_;
 
   std::atomic<bool> in_use_by_wait_set_{false};
+
+  std::atomic<size_t> max_batch_size_{1};
+
+  // Set by the callback group when the service is added to it
+  std::weak_ptr<rclcpp::CallbackGroup> callback_group_;
+
+  rclcpp::experimental::ServiceIntraProcessBase::SharedPtr service_intra_process_;
+  uint64_t intra_process_service_id_ = 0;
+  std::weak_ptr<rclcpp::experimental::IntraProcessManager> weak_ipm_;
 };
 
 template<typename ServiceT>
@@ -308,14 +384,19 @@ public:
    * \param[in] service_name Name of the topic to publish to.
    * \param[in] any_callback User defined callback to call when a client request is received.
    * \param[in] service_options options for the subscription.
+   * \param[in] pool_size number of request headers, requests and responses reused by the
+   *   service once the callback doesn't hold them anymore, allocated in advance.
+   *   If zero, they are allocated for every request.
    */
   Service(
     std::shared_ptr<rcl_node_t> node_handle,
     const std::string & service_name,
     AnyServiceCallback<ServiceT> any_callback,
-    rcl_service_options_t & service_options)
+    rcl_service_options_t & service_options,
+    size_t pool_size = 0)
   : ServiceBase(node_handle), any_callback_(any_callback),
-    srv_type_support_handle_(rosidl_typesupport_cpp::get_service_type_support_handle<ServiceT>())
+    srv_type_support_handle_(rosidl_typesupport_cpp::get_service_type_support_handle<ServiceT>()),
+    request_header_pool_(pool_size), request_pool_(pool_size), response_pool_(pool_size)
   {
     // rcl does the static memory allocation here
     service_handle_ = std::shared_ptr<rcl_service_t>(
@@ -460,13 +541,48 @@ public:
   std::shared_ptr<void>
   create_request() override
   {
-    return std::make_shared<typename ServiceT::Request>();
+    return request_pool_.acquire();
   }
 
   std::shared_ptr<rmw_request_id_t>
   create_request_header() override
   {
-    return std::make_shared<rmw_request_id_t>();
+    return request_header_pool_.acquire();
+  }
+
+  /// Let the clients of the process send their requests without the middleware.
+  /**
+   * Called by rclcpp::create_service() when the node uses intra-process communication.
+   * The requests of the clients of the process which use intra-process communication too
+   * are then handed over by pointer, and handled in the callback group of the service.
+   * The middleware service still handles the requests of the other clients.
+   *
+   * These requests are shared with their client, and must not be modified by the callback.
+   * Their header has a negative sequence number and a zero writer guid, and they are
+   * responded with send_response() as the other requests, the response being handed over
+   * by pointer too when the callback doesn't defer it.
+   *
+   * This must be called before the service is added to a callback group.
+   *
+   * \param[in] context the context of the node of the service
+   * \throws std::runtime_error if intra-process is already set up for the service
+   */
+  void
+  setup_intra_process(rclcpp::Context::SharedPtr context)
+  {
+    std::weak_ptr<Service> weak_this = this->shared_from_this();
+    auto service_intra_process = std::make_shared<IntraProcessService>(
+      context, this->get_service_name(),
+      [weak_this](
+        std::shared_ptr<typename ServiceT::Request> request,
+        IntraProcessResponseCallback respond)
+      {
+        auto service = weak_this.lock();
+        if (service) {
+          service->handle_intra_process_request(std::move(request), std::move(respond));
+        }
+      });
+    this->add_intra_process_service(std::move(service_intra_process), *context);
   }
 
   void
@@ -474,9 +590,41 @@ public:
     std::shared_ptr<rmw_request_id_t> request_header,
     std::shared_ptr<void> request) override
   {
-    auto typed_request = std::static_pointer_cast<typename ServiceT::Request>(request);
-    auto response = any_callback_.dispatch(this->shared_from_this(), request_header, typed_request);
-    if (response) {
+    handle_typed_request(
+      std::move(request_header),
+      std::static_pointer_cast<typename ServiceT::Request>(request));
+  }
+
+  /// Execute the callback with a request taken by the caller, without type erasure.
+  /**
+   * \param[in] request_header the header of the request taken with take_request()
+   * \param[in] typed_request the request taken with take_request()
+   */
+  void
+  handle_typed_request(
+    std::shared_ptr<rmw_request_id_t> request_header,
+    std::shared_ptr<typename ServiceT::Request> typed_request)
+  {
+    if (event_publisher_) {
+      event_publisher_->publish(
+        EventInfo::REQUEST_RECEIVED, request_header->writer_guid,
+        request_header->sequence_number, typed_request.get(), nullptr);
+    }
+    std::shared_ptr<typename ServiceT::Response> pooled_response;
+    if (response_pool_.size() > 0) {
+      // Callbacks expect a default response, not the one of a previous request
+      pooled_response = response_pool_.acquire();
+      *pooled_response = typename ServiceT::Response();
+    }
+    auto response = any_callback_.dispatch(
+      this->shared_from_this(), request_header, typed_request, std::move(pooled_response));
+    if (!response) {
+      return;
+    }
+    if (is_intra_process_request(*request_header)) {
+      // Not deferred, so the client can take the response itself
+      send_intra_process_response(*request_header, std::move(response));
+    } else {
       send_response(*request_header, *response);
     }
   }
@@ -484,6 +632,12 @@ public:
   void
   send_response(rmw_request_id_t & req_id, typename ServiceT::Response & response)
   {
+    if (is_intra_process_request(req_id)) {
+      // The response is owned by the caller
+      send_intra_process_response(
+        req_id, std::make_shared<typename ServiceT::Response>(response));
+      return;
+    }
     rcl_ret_t ret = rcl_send_response(get_service_handle().get(), &req_id, &response);
 
     if (ret == RCL_RET_TIMEOUT) {
@@ -497,6 +651,11 @@ public:
     if (ret != RCL_RET_OK) {
       rclcpp::exceptions::throw_from_rcl_error(ret, "failed to send response");
     }
+    if (event_publisher_) {
+      event_publisher_->publish(
+        EventInfo::RESPONSE_SENT, req_id.writer_guid, req_id.sequence_number, nullptr,
+        &response);
+    }
   }
 
   /// Configure client introspection.
@@ -526,12 +685,112 @@ public:
     }
   }
 
+  /// Configure service introspection, with options reducing its cost on the calls.
+  /**
+   * With the default options, this is the same as the overload without options.
+   * Otherwise, the events are published by rclcpp instead of rcl, on the same topic and with
+   * the same contents, sampled and, if asynchronous, by a thread of the service.
+   *
+   * This must not be called while the service handles requests.
+   *
+   * \param[in] clock clock to use to generate introspection timestamps
+   * \param[in] qos_service_event_pub QoS settings to use when creating the introspection publisher
+   * \param[in] introspection_state the state to set introspection to
+   * \param[in] options the sampling and the delivery of the events
+   * \throws std::invalid_argument if the sample period or the queue depth is zero
+   */
+  void
+  configure_introspection(
+    Clock::SharedPtr clock, const QoS & qos_service_event_pub,
+    rcl_service_introspection_state_t introspection_state,
+    const ServiceIntrospectionOptions & options)
+  {
+    event_publisher_.reset();
+    if (RCL_SERVICE_INTROSPECTION_OFF == introspection_state ||
+      (options.sample_period == 1 && !options.asynchronous))
+    {
+      configure_introspection(clock, qos_service_event_pub, introspection_state);
+      return;
+    }
+    // Created first, so that the introspection of rcl is left enabled if this throws
+    auto event_publisher = std::make_unique<detail::ServiceEventPublisher<ServiceT>>(
+      node_handle_, this->get_service_name(), clock, qos_service_event_pub,
+      RCL_SERVICE_INTROSPECTION_CONTENTS == introspection_state, options);
+    configure_introspection(clock, qos_service_event_pub, RCL_SERVICE_INTROSPECTION_OFF);
+    event_publisher_ = std::move(event_publisher);
+  }
+
 private:
   RCLCPP_DISABLE_COPY(Service)
 
+  using EventInfo = typename detail::ServiceEventPublisher<ServiceT>::EventInfo;
+  using IntraProcessService = rclcpp::experimental::ServiceIntraProcess<ServiceT>;
+  using IntraProcessResponseCallback = typename IntraProcessService::ResponseCallback;
+
+  bool
+  is_intra_process_request(const rmw_request_id_t & request_header) const
+  {
+    // The middleware numbers its requests from one
+    return request_header.sequence_number < 0 && service_intra_process_;
+  }
+
+  void
+  handle_intra_process_request(
+    std::shared_ptr<typename ServiceT::Request> request,
+    IntraProcessResponseCallback respond)
+  {
+    auto request_header = request_header_pool_.acquire();
+    *request_header = rmw_request_id_t();
+    {
+      std::lock_guard<std::mutex> lock(intra_process_mutex_);
+      request_header->sequence_number = next_intra_process_sequence_number_--;
+      intra_process_responses_.emplace(request_header->sequence_number, std::move(respond));
+    }
+    handle_typed_request(std::move(request_header), std::move(request));
+  }
+
+  void
+  send_intra_process_response(
+    const rmw_request_id_t & req_id,
+    std::shared_ptr<typename ServiceT::Response> response)
+  {
+    IntraProcessResponseCallback respond;
+    {
+      std::lock_guard<std::mutex> lock(intra_process_mutex_);
+      auto it = intra_process_responses_.find(req_id.sequence_number);
+      if (it == intra_process_responses_.end()) {
+        RCLCPP_WARN(
+          node_logger_.get_child("rclcpp"),
+          "failed to send response to %s (unknown intra-process request)",
+          this->get_service_name());
+        return;
+      }
+      respond = std::move(it->second);
+      intra_process_responses_.erase(it);
+    }
+    if (event_publisher_) {
+      event_publisher_->publish(
+        EventInfo::RESPONSE_SENT, req_id.writer_guid, req_id.sequence_number, nullptr,
+        response.get());
+    }
+    respond(std::move(response));
+  }
+
   AnyServiceCallback<ServiceT> any_callback_;
 
   const rosidl_service_type_support_t * srv_type_support_handle_;
+
+  detail::SharedObjectPool<rmw_request_id_t> request_header_pool_;
+  detail::SharedObjectPool<typename ServiceT::Request> request_pool_;
+  detail::SharedObjectPool<typename ServiceT::Response> response_pool_;
+
+  // Set when the introspection is configured with options, see configure_introspection()
+  std::unique_ptr<detail::ServiceEventPublisher<ServiceT>> event_publisher_;
+
+  // Responses of the intra-process requests, by their sequence number
+  std::mutex intra_process_mutex_;
+  std::unordered_map<int64_t, IntraProcessResponseCallback> intra_process_responses_;
+  int64_t next_intra_process_sequence_number_ = -1;
 };
 
 }  // namespace rclcpp
@@ -0,0 +1,49 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__SERVICE_INTROSPECTION_OPTIONS_HPP_
+#define RCLCPP__SERVICE_INTROSPECTION_OPTIONS_HPP_
+
+#include <cstddef>
+
+namespace rclcpp
+{
+
+/// Options reducing the cost of the service introspection on the calls of clients and services.
+/**
+ * \sa rclcpp::Client::configure_introspection()
+ * \sa rclcpp::Service::configure_introspection()
+ */
+struct ServiceIntrospectionOptions
+{
+  /// Publish the events of one call in this number of calls, 1 to publish all of them.
+  /**
+   * Calls are sampled by sequence number, so that the client and the service of a call
+   * publish its four events, or none of them.
+   */
+  size_t sample_period = 1;
+
+  /// If true, the events are published by a thread of the client or the service.
+  /**
+   * The calls then only copy the event into a pooled message, instead of also publishing it.
+   */
+  bool asynchronous = false;
+
+  /// Number of events which can wait to be published asynchronously, newer ones are dropped.
+  size_t queue_depth = 64;
+};
+
+}  // namespace rclcpp
+
+#endif  // RCLCPP__SERVICE_INTROSPECTION_OPTIONS_HPP_
@@ -15,7 +15,9 @@
 #ifndef RCLCPP__STRATEGIES__ALLOCATOR_MEMORY_STRATEGY_HPP_
 #define RCLCPP__STRATEGIES__ALLOCATOR_MEMORY_STRATEGY_HPP_
 
+#include <algorithm>
 #include <memory>
+#include <unordered_map>
 #include <vector>
 #include <utility>
 
@@ -26,6 +28,7 @@
 #include "rclcpp/memory_strategy.hpp"
 #include "rclcpp/node.hpp"
 #include "rclcpp/visibility_control.hpp"
+#include "rclcpp/wait_result.hpp"
 
 #include "rcutils/logging_macros.h"
 
@@ -63,24 +66,64 @@ public:
     allocator_ = std::make_shared<VoidAlloc>();
   }
 
+  /// Number of entities of each kind for which memory is reserved up front.
+  struct HandleCapacities
+  {
+    size_t subscriptions = 0;
+    size_t services = 0;
+    size_t clients = 0;
+    size_t timers = 0;
+    size_t waitables = 0;
+    size_t guard_conditions = 0;
+  };
+
+  /// Reserve memory for the handles of the entities.
+  /**
+   * The handles are collected again before each wait of the executor, in vectors keeping their
+   * capacity, and the indices of the ready handles are then collected in vectors keeping theirs.
+   * So no memory is allocated by the strategy once it holds as many entities as it ever will:
+   * reserving memory for the expected number of entities avoids allocating it during the first
+   * waits too.
+   *
+   * \param[in] capacities the number of entities of each kind to reserve memory for
+   */
+  void reserve_handles(const HandleCapacities & capacities)
+  {
+    subscription_handles_.reserve(capacities.subscriptions);
+    service_handles_.reserve(capacities.services);
+    client_handles_.reserve(capacities.clients);
+    timer_handles_.reserve(capacities.timers);
+    ready_indices_.subscriptions.reserve(capacities.subscriptions);
+    ready_indices_.services.reserve(capacities.services);
+    ready_indices_.clients.reserve(capacities.clients);
+    ready_indices_.timers.reserve(capacities.timers);
+    waitable_handles_.reserve(capacities.waitables);
+    waitable_triggered_handles_.reserve(capacities.waitables);
+    guard_conditions_.reserve(capacities.guard_conditions);
+    guard_condition_indices_.reserve(capacities.guard_conditions);
+  }
+
   void add_guard_condition(const rclcpp::GuardCondition & guard_condition) override
   {
-    for (const auto & existing_guard_condition : guard_conditions_) {
-      if (existing_guard_condition == &guard_condition) {
-        return;
-      }
+    if (guard_condition_indices_.emplace(&guard_condition, guard_conditions_.size()).second) {
+      guard_conditions_.push_back(&guard_condition);
     }
-    guard_conditions_.push_back(&guard_condition);
   }
 
   void remove_guard_condition(const rclcpp::GuardCondition * guard_condition) override
   {
-    for (auto it = guard_conditions_.begin(); it != guard_conditions_.end(); ++it) {
-      if (*it == guard_condition) {
-        guard_conditions_.erase(it);
-        break;
-      }
+    auto it = guard_condition_indices_.find(guard_condition);
+    if (it == guard_condition_indices_.end()) {
+      return;
+    }
+    // The order of the guard conditions doesn't matter, move the last one in place of this one
+    const size_t index = it->second;
+    guard_condition_indices_.erase(it);
+    if (index + 1 != guard_conditions_.size()) {
+      guard_conditions_[index] = guard_conditions_.back();
+      guard_condition_indices_[guard_conditions_[index]] = index;
     }
+    guard_conditions_.pop_back();
   }
 
   void clear_handles() override
@@ -90,6 +133,10 @@ public:
     client_handles_.clear();
     timer_handles_.clear();
     waitable_handles_.clear();
+    ready_indices_.subscriptions.clear();
+    ready_indices_.services.clear();
+    ready_indices_.clients.clear();
+    ready_indices_.timers.clear();
   }
 
   void remove_null_handles(rcl_wait_set_t * wait_set) override
@@ -100,52 +147,37 @@ public:
     // Important to use subscription_handles_.size() instead of wait set's size since
     // there may be more subscriptions in the wait set due to Waitables added to the end.
     // The same logic applies for other entities.
-    for (size_t i = 0; i < subscription_handles_.size(); ++i) {
-      if (!wait_set->subscriptions[i]) {
-        subscription_handles_[i].reset();
-      }
-    }
-    for (size_t i = 0; i < service_handles_.size(); ++i) {
-      if (!wait_set->services[i]) {
-        service_handles_[i].reset();
-      }
-    }
-    for (size_t i = 0; i < client_handles_.size(); ++i) {
-      if (!wait_set->clients[i]) {
-        client_handles_[i].reset();
-      }
-    }
+    // rcl doesn't report which entities are ready, so the wait set is scanned once here, and
+    // the indices of the ready handles are kept so that the get_next_*() functions only visit
+    // the ready entities, instead of all the entities waited on.
+    collect_ready_indices(
+      wait_set->subscriptions, subscription_handles_.size(), ready_indices_.subscriptions);
+    collect_ready_indices(wait_set->services, service_handles_.size(), ready_indices_.services);
+    collect_ready_indices(wait_set->clients, client_handles_.size(), ready_indices_.clients);
+    // Timers expiring within their slack share this wakeup, instead of waking up again.
+    // Only the timers with a slack are checked, with a binary search in their sorted handles.
+    rclcpp::TimerBase::get_timers_with_slack(timers_with_slack_);
+    std::sort(timers_with_slack_.begin(), timers_with_slack_.end());
+    ready_indices_.timers.clear();
     for (size_t i = 0; i < timer_handles_.size(); ++i) {
-      if (!wait_set->timers[i]) {
-        timer_handles_[i].reset();
+      if (wait_set->timers[i] || is_ready_within_slack(timer_handles_[i])) {
+        ready_indices_.timers.push_back(i);
       }
     }
+
+    // Drop the waitables taken since the previous wait, only moving the remaining ones
+    waitable_triggered_handles_.erase(
+      std::remove_if(
+        waitable_triggered_handles_.begin(), waitable_triggered_handles_.end(),
+        [](const CollectedWaitable & collected) {return !collected.waitable;}),
+      waitable_triggered_handles_.end()
+    );
     for (size_t i = 0; i < waitable_handles_.size(); ++i) {
-      if (waitable_handles_[i]->is_ready(wait_set)) {
+      if (waitable_handles_[i].waitable->is_ready(wait_set)) {
         waitable_triggered_handles_.emplace_back(std::move(waitable_handles_[i]));
       }
     }
 
-    subscription_handles_.erase(
-      std::remove(subscription_handles_.begin(), subscription_handles_.end(), nullptr),
-      subscription_handles_.end()
-    );
-
-    service_handles_.erase(
-      std::remove(service_handles_.begin(), service_handles_.end(), nullptr),
-      service_handles_.end()
-    );
-
-    client_handles_.erase(
-      std::remove(client_handles_.begin(), client_handles_.end(), nullptr),
-      client_handles_.end()
-    );
-
-    timer_handles_.erase(
-      std::remove(timer_handles_.begin(), timer_handles_.end(), nullptr),
-      timer_handles_.end()
-    );
-
     waitable_handles_.clear();
   }
 
@@ -159,25 +191,34 @@ public:
         has_invalid_weak_groups_or_nodes = true;
         continue;
       }
-      if (!group || !group->can_be_taken_from().load()) {
+      if (!group || !group->can_be_taken_from().load() || !group->is_enabled()) {
         continue;
       }
 
+      // The entities are kept with their group, so that they can be dispatched without
+      // searching them in all the groups. They are all candidates to be dispatched until
+      // remove_null_handles() only keeps the ready ones.
+      const rclcpp::CallbackGroup::WeakPtr & weak_group = pair.first;
       group->collect_all_ptrs(
-        [this](const rclcpp::SubscriptionBase::SharedPtr & subscription) {
-          subscription_handles_.push_back(subscription->get_subscription_handle());
+        [this, &weak_group](const rclcpp::SubscriptionBase::SharedPtr & subscription) {
+          ready_indices_.subscriptions.push_back(subscription_handles_.size());
+          subscription_handles_.push_back(
+            {subscription->get_subscription_handle(), subscription, weak_group});
         },
-        [this](const rclcpp::ServiceBase::SharedPtr & service) {
-          service_handles_.push_back(service->get_service_handle());
+        [this, &weak_group](const rclcpp::ServiceBase::SharedPtr & service) {
+          ready_indices_.services.push_back(service_handles_.size());
+          service_handles_.push_back({service->get_service_handle(), service, weak_group});
         },
-        [this](const rclcpp::ClientBase::SharedPtr & client) {
-          client_handles_.push_back(client->get_client_handle());
+        [this, &weak_group](const rclcpp::ClientBase::SharedPtr & client) {
+          ready_indices_.clients.push_back(client_handles_.size());
+          client_handles_.push_back({client->get_client_handle(), client, weak_group});
         },
-        [this](const rclcpp::TimerBase::SharedPtr & timer) {
-          timer_handles_.push_back(timer->get_timer_handle());
+        [this, &weak_group](const rclcpp::TimerBase::SharedPtr & timer) {
+          ready_indices_.timers.push_back(timer_handles_.size());
+          timer_handles_.push_back({timer->get_timer_handle(), timer, weak_group});
         },
-        [this](const rclcpp::Waitable::SharedPtr & waitable) {
-          waitable_handles_.push_back(waitable);
+        [this, &weak_group](const rclcpp::Waitable::SharedPtr & waitable) {
+          waitable_handles_.push_back({waitable, weak_group});
         });
     }
 
@@ -189,13 +230,14 @@ public:
     if (nullptr == waitable) {
       throw std::runtime_error("waitable object unexpectedly nullptr");
     }
-    waitable_handles_.push_back(waitable);
+    // The group is searched when the waitable is dispatched
+    waitable_handles_.push_back({waitable, {}});
   }
 
   bool add_handles_to_wait_set(rcl_wait_set_t * wait_set) override
   {
-    for (const std::shared_ptr<const rcl_subscription_t> & subscription : subscription_handles_) {
-      if (rcl_wait_set_add_subscription(wait_set, subscription.get(), NULL) != RCL_RET_OK) {
+    for (const auto & subscription : subscription_handles_) {
+      if (rcl_wait_set_add_subscription(wait_set, subscription.handle.get(), NULL) != RCL_RET_OK) {
         RCUTILS_LOG_ERROR_NAMED(
           "rclcpp",
           "Couldn't add subscription to wait set: %s", rcl_get_error_string().str);
@@ -203,8 +245,8 @@ public:
       }
     }
 
-    for (const std::shared_ptr<const rcl_client_t> & client : client_handles_) {
-      if (rcl_wait_set_add_client(wait_set, client.get(), NULL) != RCL_RET_OK) {
+    for (const auto & client : client_handles_) {
+      if (rcl_wait_set_add_client(wait_set, client.handle.get(), NULL) != RCL_RET_OK) {
         RCUTILS_LOG_ERROR_NAMED(
           "rclcpp",
           "Couldn't add client to wait set: %s", rcl_get_error_string().str);
@@ -212,8 +254,8 @@ public:
       }
     }
 
-    for (const std::shared_ptr<const rcl_service_t> & service : service_handles_) {
-      if (rcl_wait_set_add_service(wait_set, service.get(), NULL) != RCL_RET_OK) {
+    for (const auto & service : service_handles_) {
+      if (rcl_wait_set_add_service(wait_set, service.handle.get(), NULL) != RCL_RET_OK) {
         RCUTILS_LOG_ERROR_NAMED(
           "rclcpp",
           "Couldn't add service to wait set: %s", rcl_get_error_string().str);
@@ -221,8 +263,8 @@ public:
       }
     }
 
-    for (const std::shared_ptr<const rcl_timer_t> & timer : timer_handles_) {
-      if (rcl_wait_set_add_timer(wait_set, timer.get(), NULL) != RCL_RET_OK) {
+    for (const auto & timer : timer_handles_) {
+      if (rcl_wait_set_add_timer(wait_set, timer.handle.get(), NULL) != RCL_RET_OK) {
         RCUTILS_LOG_ERROR_NAMED(
           "rclcpp",
           "Couldn't add timer to wait set: %s", rcl_get_error_string().str);
@@ -234,8 +276,8 @@ public:
       detail::add_guard_condition_to_rcl_wait_set(*wait_set, *guard_condition);
     }
 
-    for (const std::shared_ptr<Waitable> & waitable : waitable_handles_) {
-      waitable->add_to_wait_set(wait_set);
+    for (const auto & waitable : waitable_handles_) {
+      waitable.waitable->add_to_wait_set(wait_set);
     }
     return true;
   }
@@ -245,34 +287,10 @@ public:
     rclcpp::AnyExecutable & any_exec,
     const WeakCallbackGroupsToNodesMap & weak_groups_to_nodes) override
   {
-    auto it = subscription_handles_.begin();
-    while (it != subscription_handles_.end()) {
-      auto subscription = get_subscription_by_handle(*it, weak_groups_to_nodes);
-      if (subscription) {
-        // Find the group for this handle and see if it can be serviced
-        auto group = get_group_by_subscription(subscription, weak_groups_to_nodes);
-        if (!group) {
-          // Group was not found, meaning the subscription is not valid...
-          // Remove it from the ready list and continue looking
-          it = subscription_handles_.erase(it);
-          continue;
-        }
-        if (!group->can_be_taken_from().load()) {
-          // Group is mutually exclusive and is being used, so skip it for now
-          // Leave it to be checked next time, but continue searching
-          ++it;
-          continue;
-        }
-        // Otherwise it is safe to set and return the any_exec
-        any_exec.subscription = subscription;
-        any_exec.callback_group = group;
-        any_exec.node_base = get_node_by_group(group, weak_groups_to_nodes);
-        subscription_handles_.erase(it);
-        return;
-      }
-      // Else, the subscription is no longer valid, remove it and continue
-      it = subscription_handles_.erase(it);
-    }
+    get_next_entity(
+      subscription_handles_, ready_indices_.subscriptions, any_exec, any_exec.subscription,
+      weak_groups_to_nodes,
+      [](const rclcpp::SubscriptionBase::SharedPtr &) {return true;});
   }
 
   void
@@ -280,34 +298,10 @@ public:
     rclcpp::AnyExecutable & any_exec,
     const WeakCallbackGroupsToNodesMap & weak_groups_to_nodes) override
   {
-    auto it = service_handles_.begin();
-    while (it != service_handles_.end()) {
-      auto service = get_service_by_handle(*it, weak_groups_to_nodes);
-      if (service) {
-        // Find the group for this handle and see if it can be serviced
-        auto group = get_group_by_service(service, weak_groups_to_nodes);
-        if (!group) {
-          // Group was not found, meaning the service is not valid...
-          // Remove it from the ready list and continue looking
-          it = service_handles_.erase(it);
-          continue;
-        }
-        if (!group->can_be_taken_from().load()) {
-          // Group is mutually exclusive and is being used, so skip it for now
-          // Leave it to be checked next time, but continue searching
-          ++it;
-          continue;
-        }
-        // Otherwise it is safe to set and return the any_exec
-        any_exec.service = service;
-        any_exec.callback_group = group;
-        any_exec.node_base = get_node_by_group(group, weak_groups_to_nodes);
-        service_handles_.erase(it);
-        return;
-      }
-      // Else, the service is no longer valid, remove it and continue
-      it = service_handles_.erase(it);
-    }
+    get_next_entity(
+      service_handles_, ready_indices_.services, any_exec, any_exec.service,
+      weak_groups_to_nodes,
+      [](const rclcpp::ServiceBase::SharedPtr &) {return true;});
   }
 
   void
@@ -315,34 +309,10 @@ public:
     rclcpp::AnyExecutable & any_exec,
     const WeakCallbackGroupsToNodesMap & weak_groups_to_nodes) override
   {
-    auto it = client_handles_.begin();
-    while (it != client_handles_.end()) {
-      auto client = get_client_by_handle(*it, weak_groups_to_nodes);
-      if (client) {
-        // Find the group for this handle and see if it can be serviced
-        auto group = get_group_by_client(client, weak_groups_to_nodes);
-        if (!group) {
-          // Group was not found, meaning the service is not valid...
-          // Remove it from the ready list and continue looking
-          it = client_handles_.erase(it);
-          continue;
-        }
-        if (!group->can_be_taken_from().load()) {
-          // Group is mutually exclusive and is being used, so skip it for now
-          // Leave it to be checked next time, but continue searching
-          ++it;
-          continue;
-        }
-        // Otherwise it is safe to set and return the any_exec
-        any_exec.client = client;
-        any_exec.callback_group = group;
-        any_exec.node_base = get_node_by_group(group, weak_groups_to_nodes);
-        client_handles_.erase(it);
-        return;
-      }
-      // Else, the service is no longer valid, remove it and continue
-      it = client_handles_.erase(it);
-    }
+    get_next_entity(
+      client_handles_, ready_indices_.clients, any_exec, any_exec.client,
+      weak_groups_to_nodes,
+      [](const rclcpp::ClientBase::SharedPtr &) {return true;});
   }
 
   void
@@ -350,39 +320,11 @@ public:
     rclcpp::AnyExecutable & any_exec,
     const WeakCallbackGroupsToNodesMap & weak_groups_to_nodes) override
   {
-    auto it = timer_handles_.begin();
-    while (it != timer_handles_.end()) {
-      auto timer = get_timer_by_handle(*it, weak_groups_to_nodes);
-      if (timer) {
-        // Find the group for this handle and see if it can be serviced
-        auto group = get_group_by_timer(timer, weak_groups_to_nodes);
-        if (!group) {
-          // Group was not found, meaning the timer is not valid...
-          // Remove it from the ready list and continue looking
-          it = timer_handles_.erase(it);
-          continue;
-        }
-        if (!group->can_be_taken_from().load()) {
-          // Group is mutually exclusive and is being used, so skip it for now
-          // Leave it to be checked next time, but continue searching
-          ++it;
-          continue;
-        }
-        if (!timer->call()) {
-          // timer was cancelled, skip it.
-          ++it;
-          continue;
-        }
-        // Otherwise it is safe to set and return the any_exec
-        any_exec.timer = timer;
-        any_exec.callback_group = group;
-        any_exec.node_base = get_node_by_group(group, weak_groups_to_nodes);
-        timer_handles_.erase(it);
-        return;
-      }
-      // Else, the timer is no longer valid, remove it and continue
-      it = timer_handles_.erase(it);
-    }
+    // A timer which was cancelled is skipped
+    get_next_entity(
+      timer_handles_, ready_indices_.timers, any_exec, any_exec.timer,
+      weak_groups_to_nodes,
+      [](const rclcpp::TimerBase::SharedPtr & timer) {return timer->call();});
   }
 
   void
@@ -390,34 +332,35 @@ public:
     rclcpp::AnyExecutable & any_exec,
     const WeakCallbackGroupsToNodesMap & weak_groups_to_nodes) override
   {
-    auto & waitable_handles = waitable_triggered_handles_;
-    auto it = waitable_handles.begin();
-    while (it != waitable_handles.end()) {
-      std::shared_ptr<Waitable> & waitable = *it;
-      if (waitable) {
-        // Find the group for this handle and see if it can be serviced
-        auto group = get_group_by_waitable(waitable, weak_groups_to_nodes);
-        if (!group) {
-          // Group was not found, meaning the waitable is not valid...
-          // Remove it from the ready list and continue looking
-          it = waitable_handles.erase(it);
-          continue;
-        }
-        if (!group->can_be_taken_from().load()) {
-          // Group is mutually exclusive and is being used, so skip it for now
-          // Leave it to be checked next time, but continue searching
-          ++it;
-          continue;
-        }
-        // Otherwise it is safe to set and return the any_exec
-        any_exec.waitable = waitable;
-        any_exec.callback_group = group;
-        any_exec.node_base = get_node_by_group(group, weak_groups_to_nodes);
-        waitable_handles.erase(it);
-        return;
+    for (auto & collected : waitable_triggered_handles_) {
+      if (!collected.waitable) {
+        // Already taken
+        continue;
+      }
+      // Find the group for this handle and see if it can be serviced
+      rclcpp::CallbackGroup::SharedPtr group;
+      rclcpp::node_interfaces::NodeBaseInterface::SharedPtr node;
+      if (!find_group_and_node(collected.group, weak_groups_to_nodes, group, node)) {
+        // Waitables added with add_waitable_handle() have no known group
+        group = get_group_by_waitable(collected.waitable, weak_groups_to_nodes);
+        node = get_node_by_group(group, weak_groups_to_nodes);
+      }
+      if (!group || !node) {
+        // Group was not found, meaning the waitable is not valid...
+        // Remove it from the ready list and continue looking
+        collected.waitable.reset();
+        continue;
       }
-      // Else, the waitable is no longer valid, remove it and continue
-      it = waitable_handles.erase(it);
+      if (!group->can_start_callback(collected.waitable.get())) {
+        // Group is exclusive and is being used, so skip it for now
+        // Leave it to be checked next time, but continue searching
+        continue;
+      }
+      // Otherwise it is safe to set and return the any_exec
+      any_exec.waitable = std::move(collected.waitable);
+      any_exec.callback_group = std::move(group);
+      any_exec.node_base = std::move(node);
+      return;
     }
   }
 
@@ -429,8 +372,8 @@ public:
   size_t number_of_ready_subscriptions() const override
   {
     size_t number_of_subscriptions = subscription_handles_.size();
-    for (const std::shared_ptr<Waitable> & waitable : waitable_handles_) {
-      number_of_subscriptions += waitable->get_number_of_ready_subscriptions();
+    for (const auto & collected : waitable_handles_) {
+      number_of_subscriptions += collected.waitable->get_number_of_ready_subscriptions();
     }
     return number_of_subscriptions;
   }
@@ -438,8 +381,8 @@ public:
   size_t number_of_ready_services() const override
   {
     size_t number_of_services = service_handles_.size();
-    for (const std::shared_ptr<Waitable> & waitable : waitable_handles_) {
-      number_of_services += waitable->get_number_of_ready_services();
+    for (const auto & collected : waitable_handles_) {
+      number_of_services += collected.waitable->get_number_of_ready_services();
     }
     return number_of_services;
   }
@@ -447,8 +390,8 @@ public:
   size_t number_of_ready_events() const override
   {
     size_t number_of_events = 0;
-    for (const std::shared_ptr<Waitable> & waitable : waitable_handles_) {
-      number_of_events += waitable->get_number_of_ready_events();
+    for (const auto & collected : waitable_handles_) {
+      number_of_events += collected.waitable->get_number_of_ready_events();
     }
     return number_of_events;
   }
@@ -456,8 +399,8 @@ public:
   size_t number_of_ready_clients() const override
   {
     size_t number_of_clients = client_handles_.size();
-    for (const std::shared_ptr<Waitable> & waitable : waitable_handles_) {
-      number_of_clients += waitable->get_number_of_ready_clients();
+    for (const auto & collected : waitable_handles_) {
+      number_of_clients += collected.waitable->get_number_of_ready_clients();
     }
     return number_of_clients;
   }
@@ -465,8 +408,8 @@ public:
   size_t number_of_guard_conditions() const override
   {
     size_t number_of_guard_conditions = guard_conditions_.size();
-    for (const std::shared_ptr<Waitable> & waitable : waitable_handles_) {
-      number_of_guard_conditions += waitable->get_number_of_ready_guard_conditions();
+    for (const auto & collected : waitable_handles_) {
+      number_of_guard_conditions += collected.waitable->get_number_of_ready_guard_conditions();
     }
     return number_of_guard_conditions;
   }
@@ -474,8 +417,8 @@ public:
   size_t number_of_ready_timers() const override
   {
     size_t number_of_timers = timer_handles_.size();
-    for (const std::shared_ptr<Waitable> & waitable : waitable_handles_) {
-      number_of_timers += waitable->get_number_of_ready_timers();
+    for (const auto & collected : waitable_handles_) {
+      number_of_timers += collected.waitable->get_number_of_ready_timers();
     }
     return number_of_timers;
   }
@@ -490,15 +433,143 @@ private:
   using VectorRebind =
     std::vector<T, typename std::allocator_traits<Alloc>::template rebind_alloc<T>>;
 
-  VectorRebind<const rclcpp::GuardCondition *> guard_conditions_;
+  /// Handle of an entity waited on, with the entity and its callback group.
+  template<typename HandleT, typename EntityT>
+  struct CollectedEntity
+  {
+    // Reset once the entity was taken, or isn't valid anymore
+    std::shared_ptr<const HandleT> handle;
+    std::weak_ptr<EntityT> entity;
+    rclcpp::CallbackGroup::WeakPtr group;
+  };
+
+  /// Waitable waited on, with its callback group if known.
+  struct CollectedWaitable
+  {
+    std::shared_ptr<Waitable> waitable;
+    rclcpp::CallbackGroup::WeakPtr group;
+  };
+
+  /// Check if the collected timer has a slack, and expires within it.
+  bool
+  is_ready_within_slack(const CollectedEntity<rcl_timer_t, rclcpp::TimerBase> & collected) const
+  {
+    if (!collected.handle ||
+      !std::binary_search(
+        timers_with_slack_.begin(), timers_with_slack_.end(), collected.handle.get()))
+    {
+      return false;
+    }
+    auto timer = collected.entity.lock();
+    return timer && timer->is_ready_within_slack();
+  }
+
+  /// Collect the indices of the handles which are ready in the given entities of a wait set.
+  template<typename HandleT>
+  static void
+  collect_ready_indices(
+    const HandleT * const * wait_set_entities, size_t size, std::vector<size_t> & ready_indices)
+  {
+    ready_indices.clear();
+    for (size_t i = 0; i < size; ++i) {
+      if (wait_set_entities[i]) {
+        ready_indices.push_back(i);
+      }
+    }
+  }
+
+  /// Find the given group among the groups of the executor, and lock it and its node.
+  static bool
+  find_group_and_node(
+    const rclcpp::CallbackGroup::WeakPtr & weak_group,
+    const WeakCallbackGroupsToNodesMap & weak_groups_to_nodes,
+    rclcpp::CallbackGroup::SharedPtr & group,
+    rclcpp::node_interfaces::NodeBaseInterface::SharedPtr & node)
+  {
+    const auto it = weak_groups_to_nodes.find(weak_group);
+    if (it == weak_groups_to_nodes.end()) {
+      return false;
+    }
+    group = it->first.lock();
+    node = it->second.lock();
+    return true;
+  }
 
-  VectorRebind<std::shared_ptr<const rcl_subscription_t>> subscription_handles_;
-  VectorRebind<std::shared_ptr<const rcl_service_t>> service_handles_;
-  VectorRebind<std::shared_ptr<const rcl_client_t>> client_handles_;
-  VectorRebind<std::shared_ptr<const rcl_timer_t>> timer_handles_;
-  VectorRebind<std::shared_ptr<Waitable>> waitable_handles_;
+  /// Take the first ready entity whose group can be taken from, and which can be taken.
+  /**
+   * Only the entities at the given ready indices are visited.
+   * The entity and its group are known from the collection, so only the group of the ready
+   * entity is searched among the groups of the executor, and only that group and its node are
+   * locked, instead of searching the entity in all the groups.
+   */
+  template<typename HandleT, typename EntityT, typename CanTakeFunction>
+  static void
+  get_next_entity(
+    VectorRebind<CollectedEntity<HandleT, EntityT>> & collected_entities,
+    const std::vector<size_t> & ready_indices,
+    rclcpp::AnyExecutable & any_exec,
+    std::shared_ptr<EntityT> & any_exec_entity,
+    const WeakCallbackGroupsToNodesMap & weak_groups_to_nodes,
+    CanTakeFunction can_take)
+  {
+    for (size_t index : ready_indices) {
+      auto & collected = collected_entities[index];
+      if (!collected.handle) {
+        // Already taken
+        continue;
+      }
+      auto entity = collected.entity.lock();
+      if (!entity) {
+        // The entity is no longer valid, remove it and continue
+        collected.handle.reset();
+        continue;
+      }
+      // Find the group for this handle and see if it can be serviced
+      rclcpp::CallbackGroup::SharedPtr group;
+      rclcpp::node_interfaces::NodeBaseInterface::SharedPtr node;
+      if (!find_group_and_node(collected.group, weak_groups_to_nodes, group, node) ||
+        !group || !node)
+      {
+        // Group was not found, meaning the entity is not valid...
+        // Remove it from the ready list and continue looking
+        collected.handle.reset();
+        continue;
+      }
+      if (!group->can_start_callback(entity.get())) {
+        // Group is exclusive and is being used, so skip it for now
+        // Leave it to be checked next time, but continue searching
+        continue;
+      }
+      if (!can_take(entity)) {
+        continue;
+      }
+      // Otherwise it is safe to set and return the any_exec
+      any_exec_entity = std::move(entity);
+      any_exec.callback_group = std::move(group);
+      any_exec.node_base = std::move(node);
+      collected.handle.reset();
+      return;
+    }
+  }
 
-  VectorRebind<std::shared_ptr<Waitable>> waitable_triggered_handles_;
+  VectorRebind<const rclcpp::GuardCondition *> guard_conditions_;
+  // Index of each guard condition in guard_conditions_, so that nodes are added and removed
+  // in constant time by the executors
+  std::unordered_map<const rclcpp::GuardCondition *, size_t> guard_condition_indices_;
+
+  VectorRebind<CollectedEntity<rcl_subscription_t, rclcpp::SubscriptionBase>>
+  subscription_handles_;
+  VectorRebind<CollectedEntity<rcl_service_t, rclcpp::ServiceBase>> service_handles_;
+  VectorRebind<CollectedEntity<rcl_client_t, rclcpp::ClientBase>> client_handles_;
+  VectorRebind<CollectedEntity<rcl_timer_t, rclcpp::TimerBase>> timer_handles_;
+  VectorRebind<CollectedWaitable> waitable_handles_;
+
+  VectorRebind<CollectedWaitable> waitable_triggered_handles_;
+  // Sorted handles of the timers with a slack, refilled after each wait
+  std::vector<const rcl_timer_t *> timers_with_slack_;
+  // Indices of the handles above which can be dispatched, all the collected ones until they
+  // are refilled with the ready ones after each wait
+  rclcpp::ReadyEntityIndices ready_indices_;
 
   std::shared_ptr<VoidAlloc> allocator_;
 };
@@ -16,9 +16,11 @@
 #define RCLCPP__STRATEGIES__MESSAGE_POOL_MEMORY_STRATEGY_HPP_
 
 #include <array>
+#include <atomic>
+#include <cstdint>
 #include <cstring>
+#include <limits>
 #include <memory>
-#include <mutex>
 #include <stdexcept>
 #include <type_traits>
 
@@ -43,13 +45,16 @@ namespace message_pool_memory_strategy
  * Templating allows the program to determine the memory required for this object at compile time.
  * The size of the message pool should be at least the largest number of concurrent accesses to
  * the subscription (usually the number of threads).
+ *
+ * Messages with dynamically sized fields (strings and sequences) are constructed once, when the
+ * pool is created, and they are reset rather than destroyed when returned to the pool.
+ * Resetting them keeps the capacity of their strings and sequences, so subscriptions receiving
+ * messages of similar sizes don't need to allocate memory for them again.
+ * Note that the elements of sequences of messages are destroyed when resetting.
  */
 template<
   typename MessageT,
-  size_t Size,
-  typename std::enable_if<
-    rosidl_generator_traits::has_fixed_size<MessageT>::value
-  >::type * = nullptr
+  size_t Size
 >
 class MessagePoolMemoryStrategy
   : public message_memory_strategy::MessageMemoryStrategy<MessageT>
@@ -59,52 +64,65 @@ public:
 
   MessagePoolMemoryStrategy()
   {
-    pool_mutex_ = std::make_shared<std::mutex>();
-
     pool_ = std::shared_ptr<std::array<MessageT *, Size>>(
       new std::array<MessageT *, Size>,
       [](std::array<MessageT *, Size> * arr) {
         for (size_t i = 0; i < Size; ++i) {
+          if constexpr (!kHasFixedSize) {
+            // Dynamic size messages always stay constructed while in the pool
+            (*arr)[i]->~MessageT();
+          }
           free((*arr)[i]);
         }
         delete arr;
       });
 
-    free_list_ = std::make_shared<CircularArray<Size>>();
+    free_list_ = std::make_shared<IndexStack<Size>>();
 
     for (size_t i = 0; i < Size; ++i) {
       (*pool_)[i] = static_cast<MessageT *>(malloc(sizeof(MessageT)));
-      free_list_->push_back(i);
+      if constexpr (!kHasFixedSize) {
+        new((*pool_)[i]) MessageT();
+      }
+      free_list_->push(i);
+    }
+
+    if constexpr (!kHasFixedSize) {
+      empty_message_ = std::make_shared<const MessageT>();
     }
   }
 
   /// Borrow a message from the message pool.
   /**
-   * Manage the message pool ring buffer.
+   * Manage the message pool free list, which is lock-free, so that threads borrowing and
+   * returning messages concurrently don't block each other.
    * Throw an exception if the next message was not available.
    * \return Shared pointer to the borrowed message.
    */
   std::shared_ptr<MessageT> borrow_message()
   {
-    std::lock_guard<std::mutex> lock(*pool_mutex_);
-    if (free_list_->size() == 0) {
+    size_t current_index = 0;
+    if (!free_list_->pop(current_index)) {
       throw std::runtime_error("No more free slots in the pool");
     }
 
-    size_t current_index = free_list_->pop_front();
+    MessageT * message = (*pool_)[current_index];
+    if constexpr (kHasFixedSize) {
+      message = new(message) MessageT();
+    }
 
     return std::shared_ptr<MessageT>(
-      new((*pool_)[current_index]) MessageT(),
-      [pool = this->pool_, pool_mutex = this->pool_mutex_,
-      free_list = this->free_list_](MessageT * p) {
-        std::lock_guard<std::mutex> lock(*pool_mutex);
-        for (size_t i = 0; i < Size; ++i) {
-          if ((*pool)[i] == p) {
-            p->~MessageT();
-            free_list->push_back(i);
-            break;
-          }
+      message,
+      [pool = this->pool_, free_list = this->free_list_, empty_message = this->empty_message_,
+      current_index](MessageT * p) {
+        if constexpr (kHasFixedSize) {
+          p->~MessageT();
+        } else {
+          // Copy assigning keeps the capacity of strings and sequences,
+          // while destroying the message would free their memory.
+          *p = *empty_message;
         }
+        free_list->push(current_index);
       });
   }
 
@@ -120,51 +138,76 @@ public:
   }
 
 protected:
+  static constexpr bool kHasFixedSize = rosidl_generator_traits::has_fixed_size<MessageT>::value;
+  static constexpr uint32_t kEmpty = std::numeric_limits<uint32_t>::max();
+
+  /// Lock-free stack of the indices of the free messages.
+  /**
+   * The head of the stack is stored together with a counter incremented at every change,
+   * so that a concurrent pop can't succeed if the head was popped and pushed again meanwhile
+   * (the ABA problem).
+   */
   template<size_t N>
-  class CircularArray
+  class IndexStack
   {
 public:
-    void push_back(const size_t v)
+    static_assert(N < kEmpty, "Too many items for the index stack");
+
+    IndexStack()
     {
-      if (size_ + 1 > N) {
-        throw std::runtime_error("Tried to push too many items into the array");
+      for (auto & next : next_) {
+        next.store(kEmpty, std::memory_order_relaxed);
       }
-      array_[(front_ + size_) % N] = v;
-      ++size_;
     }
 
-    size_t pop_front()
+    void push(const size_t v)
     {
-      if (size_ < 1) {
-        throw std::runtime_error("Tried to pop item from empty array");
-      }
-
-      size_t val = array_[front_];
-
-      front_ = (front_ + 1) % N;
-      --size_;
-
-      return val;
+      uint64_t head = head_.load(std::memory_order_relaxed);
+      uint64_t new_head = 0;
+      do {
+        next_[v].store(static_cast<uint32_t>(head), std::memory_order_relaxed);
+        new_head = next_head(head, static_cast<uint32_t>(v));
+      } while (!head_.compare_exchange_weak(
+        head, new_head, std::memory_order_release, std::memory_order_relaxed));
     }
 
-    size_t size() const
+    bool pop(size_t & v)
     {
-      return size_;
+      uint64_t head = head_.load(std::memory_order_acquire);
+      uint32_t top = 0;
+      uint64_t new_head = 0;
+      do {
+        top = static_cast<uint32_t>(head);
+        if (top == kEmpty) {
+          return false;
+        }
+        new_head = next_head(head, next_[top].load(std::memory_order_relaxed));
+      } while (!head_.compare_exchange_weak(
+        head, new_head, std::memory_order_acquire, std::memory_order_acquire));
+      v = top;
+      return true;
     }
 
 private:
-    size_t front_ = 0;
-    size_t size_ = 0;
-    std::array<size_t, N> array_;
+    static uint64_t next_head(uint64_t head, uint32_t index)
+    {
+      // The higher 32 bits are the counter, the lower ones the index of the top item
+      return (((head >> 32) + 1) << 32) | index;
+    }
+
+    std::atomic<uint64_t> head_ {kEmpty};
+    std::array<std::atomic<uint32_t>, N> next_;
   };
 
+
   // It's very important that these are shared_ptrs, since users of this class might hold a
   // reference to a pool item longer than the lifetime of the class.  In that scenario, the
   // shared_ptr ensures that the lifetime of these variables outlives this class, and hence ensures
   // the custom destructor for each pool item can successfully run.
-  std::shared_ptr<std::mutex> pool_mutex_;
   std::shared_ptr<std::array<MessageT *, Size>> pool_;
-  std::shared_ptr<CircularArray<Size>> free_list_;
+  std::shared_ptr<IndexStack<Size>> free_list_;
+  // Default constructed message, used to reset dynamic size messages returned to the pool.
+  std::shared_ptr<const MessageT> empty_message_;
 };
 
 }  // namespace message_pool_memory_strategy
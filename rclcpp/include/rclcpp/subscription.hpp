@@ -149,6 +149,10 @@ public:
     options_(options),
     message_memory_strategy_(message_memory_strategy)
   {
+    this->set_max_batch_size(options_.max_batch_size);
+    this->set_deserialize_after_take(options_.deserialize_after_take);
+    this->set_max_rate(options_.max_rate);
+
     // Setup intra process publishing if requested.
     if (rclcpp::detail::resolve_use_intra_process(options_, *node_base)) {
       using rclcpp::detail::resolve_intra_process_buffer_type;
@@ -156,15 +160,15 @@ public:
       // Check if the QoS is compatible with intra-process.
       auto qos_profile = get_actual_qos();
       if (qos_profile.history() != rclcpp::HistoryPolicy::KeepLast) {
-        throw std::invalid_argument(
+        throw rclcpp::exceptions::IntraProcessQoSIncompatibleError(
                 "intraprocess communication allowed only with keep last history qos policy");
       }
       if (qos_profile.depth() == 0) {
-        throw std::invalid_argument(
+        throw rclcpp::exceptions::IntraProcessQoSIncompatibleError(
                 "intraprocess communication is not allowed with 0 depth qos policy");
       }
       if (qos_profile.durability() != rclcpp::DurabilityPolicy::Volatile) {
-        throw std::invalid_argument(
+        throw rclcpp::exceptions::IntraProcessQoSIncompatibleError(
                 "intraprocess communication allowed only with volatile durability");
       }
 
@@ -190,9 +194,25 @@ public:
         static_cast<const void *>(get_subscription_handle().get()),
         static_cast<const void *>(subscription_intra_process_.get()));
 
+      // The middleware doesn't filter intra-process messages, the manager does before delivering
+      subscription_intra_process_->set_content_filter(std::atomic_load(&this->content_filter_));
+
+      // Messages delivered intra-process don't reach handle_message(), their buffer is timed
+      if (subscription_topic_statistics != nullptr) {
+        auto & typed_subscription_intra_process =
+          static_cast<SubscriptionIntraProcessT &>(*subscription_intra_process_);
+        bool timed = typed_subscription_intra_process.set_buffer_dwell_time_callback(
+          [statistics = subscription_topic_statistics](std::chrono::nanoseconds dwell_time) {
+            statistics->handle_buffer_dwell_time(dwell_time);
+          });
+        if (timed) {
+          subscription_topic_statistics->enable_buffer_dwell_time();
+        }
+      }
+
       // Add it to the intra process manager.
       using rclcpp::experimental::IntraProcessManager;
-      auto ipm = context->get_sub_context<IntraProcessManager>();
+      auto ipm = IntraProcessManager::get_instance(*context);
       uint64_t intra_process_subscription_id = ipm->add_subscription(subscription_intra_process_);
       this->setup_intra_process(intra_process_subscription_id, ipm);
     }
@@ -201,6 +221,11 @@ public:
       this->subscription_topic_statistics_ = std::move(subscription_topic_statistics);
     }
 
+    // Topic statistics read the timestamps of the message info
+    this->set_message_info_usage(
+      any_callback_.uses_message_info() || subscription_topic_statistics_ != nullptr,
+      options_.capture_receive_stamp);
+
     TRACETOOLS_TRACEPOINT(
       rclcpp_subscription_init,
       static_cast<const void *>(get_subscription_handle().get()),
@@ -325,6 +350,12 @@ public:
     const std::shared_ptr<rclcpp::SerializedMessage> & serialized_message,
     const rclcpp::MessageInfo & message_info) override
   {
+    if (any_callback_.is_lazy_message_callback() &&
+      matches_any_intra_process_publishers(&message_info.get_rmw_message_info().publisher_gid))
+    {
+      // Lazy messages are delivered deserialized via intra process, ignore this copy
+      return;
+    }
     std::chrono::time_point<std::chrono::system_clock> now;
     if (subscription_topic_statistics_) {
       // get current time before executing callback to
@@ -356,21 +387,43 @@ public:
     // message is loaned, so we have to make sure that the deleter does not deallocate the message
     auto sptr = std::shared_ptr<ROSMessageType>(
       typed_message, [](ROSMessageType * msg) {(void) msg;});
+    dispatch_message(std::move(sptr), message_info);
+  }
 
-    std::chrono::time_point<std::chrono::system_clock> now;
-    if (subscription_topic_statistics_) {
-      // get current time before executing callback to
-      // exclude callback duration from topic statistics result.
-      now = std::chrono::system_clock::now();
+  void
+  handle_shared_loaned_message(
+    const std::shared_ptr<void> & loaned_message,
+    const rclcpp::MessageInfo & message_info) override
+  {
+    if (matches_any_intra_process_publishers(&message_info.get_rmw_message_info().publisher_gid)) {
+      // In this case, the message will be delivered via intra process and
+      // we should ignore this copy of the message.
+      return;
     }
 
-    any_callback_.dispatch(sptr, message_info);
+    // Shares the ownership of the loan, so the callback can keep the message without a copy
+    dispatch_message(std::static_pointer_cast<ROSMessageType>(loaned_message), message_info);
+  }
 
-    if (subscription_topic_statistics_) {
-      const auto nanos = std::chrono::time_point_cast<std::chrono::nanoseconds>(now);
-      const auto time = rclcpp::Time(nanos.time_since_epoch().count());
-      subscription_topic_statistics_->handle_message(message_info.get_rmw_message_info(), time);
+  /// Execute the callback with a message taken by the caller, without type erasure.
+  /**
+   * This is what handle_message() does, for callers which know the type of the
+   * subscription and take the message themselves, as the TypedStaticExecutor does.
+   *
+   * \param[in] message the message taken with take()
+   * \param[in] message_info the message info for the taken message
+   */
+  void
+  handle_typed_message(
+    std::shared_ptr<ROSMessageType> message,
+    const rclcpp::MessageInfo & message_info)
+  {
+    if (matches_any_intra_process_publishers(&message_info.get_rmw_message_info().publisher_gid)) {
+      // In this case, the message will be delivered via intra process and
+      // we should ignore this copy of the message.
+      return;
     }
+    dispatch_message(std::move(message), message_info);
   }
 
   /// Return the borrowed message.
@@ -454,6 +507,28 @@ public:
 private:
   RCLCPP_DISABLE_COPY(Subscription)
 
+  /// Execute the callback with a message, and update the topic statistics.
+  void
+  dispatch_message(
+    std::shared_ptr<ROSMessageType> message,
+    const rclcpp::MessageInfo & message_info)
+  {
+    std::chrono::time_point<std::chrono::system_clock> now;
+    if (subscription_topic_statistics_) {
+      // get current time before executing callback to
+      // exclude callback duration from topic statistics result.
+      now = std::chrono::system_clock::now();
+    }
+
+    any_callback_.dispatch(std::move(message), message_info);
+
+    if (subscription_topic_statistics_) {
+      const auto nanos = std::chrono::time_point_cast<std::chrono::nanoseconds>(now);
+      const auto time = rclcpp::Time(nanos.time_since_epoch().count());
+      subscription_topic_statistics_->handle_message(message_info.get_rmw_message_info(), time);
+    }
+  }
+
   AnySubscriptionCallback<MessageT, AllocatorT> any_callback_;
   /// Copy of original options passed during construction.
   /**
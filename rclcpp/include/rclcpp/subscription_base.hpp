@@ -16,6 +16,8 @@
 #define RCLCPP__SUBSCRIPTION_BASE_HPP_
 
 #include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -30,7 +32,10 @@
 #include "rmw/rmw.h"
 
 #include "rclcpp/any_subscription_callback.hpp"
+#include "rclcpp/backlog.hpp"
+#include "rclcpp/content_filter.hpp"
 #include "rclcpp/detail/cpp_callback_trampoline.hpp"
+#include "rclcpp/detail/rate_limiter.hpp"
 #include "rclcpp/dynamic_typesupport/dynamic_message.hpp"
 #include "rclcpp/dynamic_typesupport/dynamic_message_type.hpp"
 #include "rclcpp/dynamic_typesupport/dynamic_serialization_support.hpp"
@@ -49,6 +54,8 @@
 namespace rclcpp
 {
 
+class CallbackGroup;
+
 namespace node_interfaces
 {
 class NodeBaseInterface;
@@ -88,6 +95,8 @@ enum class DeliveredMessageKind : uint8_t
 /// specializations of Subscription, among other things.
 class SubscriptionBase : public std::enable_shared_from_this<SubscriptionBase>
 {
+  friend class rclcpp::CallbackGroup;
+
 public:
   RCLCPP_SMART_PTR_DEFINITIONS_NOT_COPYABLE(SubscriptionBase)
 
@@ -173,12 +182,34 @@ public:
    * \param[out] message_out The type erased message pointer into which take
    *   will copy the data.
    * \param[out] message_info_out The message info for the taken message.
+   * \param[in] fill_message_info if false, the message info is only filled when
+   *   needs_message_info() returns true, as done by the executors.
    * \returns true if data was taken and is valid, otherwise false
    * \throws any rcl errors from rcl_take, \sa rclcpp::exceptions::throw_from_rcl_error()
    */
   RCLCPP_PUBLIC
   bool
-  take_type_erased(void * message_out, rclcpp::MessageInfo & message_info_out);
+  take_type_erased(
+    void * message_out,
+    rclcpp::MessageInfo & message_info_out,
+    bool fill_message_info = true);
+
+  /// Take the next inter-process message loaned by the middleware.
+  /**
+   * The loan is returned to the middleware by the deleter of the returned pointer, once the
+   * last reference to the message is released, from any thread.
+   * Middlewares lend a limited number of messages, so keeping them delays the next loans.
+   *
+   * \param[out] message_info_out The message info for the taken message.
+   * \param[in] fill_message_info if false, the message info is only filled when
+   *   needs_message_info() returns true, as done by the executors.
+   * \returns the loaned message, or nullptr if no message was taken
+   * \throws any rcl errors from rcl_take_loaned_message,
+   *   \sa rclcpp::exceptions::throw_from_rcl_error()
+   */
+  RCLCPP_PUBLIC
+  std::shared_ptr<void>
+  take_loaned_message(rclcpp::MessageInfo & message_info_out, bool fill_message_info = true);
 
   /// Take the next inter-process message, in its serialized form, from the subscription.
   /**
@@ -191,12 +222,17 @@ public:
    * \param[out] message_out The serialized message data structure used to
    *   store the taken message.
    * \param[out] message_info_out The message info for the taken message.
+   * \param[in] fill_message_info if false, the message info is only filled when
+   *   needs_message_info() returns true, as done by the executors.
    * \returns true if data was taken and is valid, otherwise false
    * \throws any rcl errors from rcl_take, \sa rclcpp::exceptions::throw_from_rcl_error()
    */
   RCLCPP_PUBLIC
   bool
-  take_serialized(rclcpp::SerializedMessage & message_out, rclcpp::MessageInfo & message_info_out);
+  take_serialized(
+    rclcpp::SerializedMessage & message_out,
+    rclcpp::MessageInfo & message_info_out,
+    bool fill_message_info = true);
 
   /// Borrow a new message.
   /** \return Shared pointer to the fresh message. */
@@ -234,6 +270,22 @@ public:
   void
   handle_loaned_message(void * loaned_message, const rclcpp::MessageInfo & message_info) = 0;
 
+  /// Check if we need to handle the loaned message, and execute the callback if we do.
+  /**
+   * Unlike handle_loaned_message(), the callback may keep the message without copying it,
+   * since the loan is only returned once the last reference to the message is released.
+   * The default implementation calls handle_loaned_message().
+   *
+   * \param[in] loaned_message The message returned by take_loaned_message().
+   * \param[in] message_info Metadata associated with this message.
+   */
+  RCLCPP_PUBLIC
+  virtual
+  void
+  handle_shared_loaned_message(
+    const std::shared_ptr<void> & loaned_message,
+    const rclcpp::MessageInfo & message_info);
+
   /// Return the message borrowed in create_message.
   /** \param[in] message Shared pointer to the returned message. */
   RCLCPP_PUBLIC
@@ -268,6 +320,117 @@ public:
   DeliveredMessageKind
   get_delivered_message_kind() const;
 
+  /// Set the maximum number of messages the executor takes each time the subscription is ready.
+  /**
+   * \sa rclcpp::SubscriptionOptionsBase::max_batch_size
+   * \param[in] max_batch_size the maximum number of messages, it must be greater than zero
+   * \throws std::invalid_argument if max_batch_size is zero
+   */
+  RCLCPP_PUBLIC
+  void
+  set_max_batch_size(size_t max_batch_size);
+
+  /// Get the maximum number of messages the executor takes each time the subscription is ready.
+  RCLCPP_PUBLIC
+  size_t
+  get_max_batch_size() const;
+
+  /// Set whether the executor takes the messages serialized and deserializes them afterwards.
+  /**
+   * \sa rclcpp::SubscriptionOptionsBase::deserialize_after_take
+   */
+  RCLCPP_PUBLIC
+  void
+  set_deserialize_after_take(bool deserialize_after_take);
+
+  /// Return true if the executor takes the messages serialized and deserializes them afterwards.
+  RCLCPP_PUBLIC
+  bool
+  get_deserialize_after_take() const;
+
+  /// Set the maximum rate in Hz of the messages taken from the middleware and delivered.
+  /**
+   * \sa rclcpp::SubscriptionOptionsBase::max_rate
+   * \param[in] max_rate the maximum rate, 0 to deliver every message
+   * \throws std::invalid_argument if max_rate is negative or not finite
+   */
+  RCLCPP_PUBLIC
+  void
+  set_max_rate(double max_rate);
+
+  /// Get the maximum rate in Hz of the messages taken from the middleware and delivered.
+  RCLCPP_PUBLIC
+  double
+  get_max_rate() const;
+
+  /// Return false if the next message taken from the middleware must be dropped, thread-safe.
+  /**
+   * Used by the executors before taking a message, a message accepted counts towards the
+   * maximum rate even if nothing is taken.
+   */
+  RCLCPP_PUBLIC
+  bool
+  try_accept_message_at_max_rate();
+
+  /// Get a snapshot of the messages waiting in the intra-process buffer of the subscription.
+  /**
+   * This doesn't lock the intra-process buffer, so it can be called while messages are
+   * published and taken, and the result is only a snapshot.
+   */
+  RCLCPP_PUBLIC
+  SubscriptionBacklog
+  get_backlog() const;
+
+  /// Return true if the message info is filled when a message is taken.
+  /**
+   * Callbacks without a MessageInfo parameter don't need it, so it's not requested from the
+   * middleware then, unless rclcpp uses it for intra-process communication or topic statistics.
+   */
+  RCLCPP_PUBLIC
+  bool
+  needs_message_info() const;
+
+  /// Return true if a receive stamp is captured when a message is taken.
+  /** \sa rclcpp::SubscriptionOptionsBase::capture_receive_stamp */
+  RCLCPP_PUBLIC
+  bool
+  captures_receive_stamp() const;
+
+  /// Record the reception of a message, if a deadline monitor watches the subscription.
+  /**
+   * Called by the executors each time they take a message from the middleware.
+   * It's a single relaxed atomic load when the subscription isn't watched.
+   */
+  void
+  record_message_received() noexcept
+  {
+    if (deadline_watchers_.load(std::memory_order_relaxed) > 0) {
+      last_message_received_ns_.store(
+        std::chrono::steady_clock::now().time_since_epoch().count(), std::memory_order_relaxed);
+    }
+  }
+
+  /// Get the steady time at which the last message was received.
+  /**
+   * Receptions are only recorded while at least one deadline monitor watches the subscription.
+   *
+   * \sa rclcpp::DeadlineMonitor
+   * \return the time of the last recorded reception, or the epoch of the steady clock if none
+   */
+  RCLCPP_PUBLIC
+  std::chrono::steady_clock::time_point
+  get_last_message_received_time() const;
+
+  /// Start recording the reception of messages, for a deadline monitor watching the subscription.
+  RCLCPP_PUBLIC
+  void
+  add_deadline_watcher();
+
+  /// Stop recording the reception of messages, once no deadline monitor watches it anymore.
+  RCLCPP_PUBLIC
+  void
+  remove_deadline_watcher();
+
   /// Get matching publisher count.
   /** \return The number of publishers on this topic. */
   RCLCPP_PUBLIC
@@ -544,6 +707,9 @@ public:
 
   /// Set the filter expression and expression parameters for the subscription.
   /**
+   * The filter is also compiled by rclcpp for the intra-process messages, which the middleware
+   * doesn't filter, \sa get_fallback_content_filter().
+   *
    * \param[in] filter_expression A filter expression to set.
    *   \sa ContentFilterOptions::filter_expression
    *   An empty string ("") will clear the content filter setting of the subscription.
@@ -568,6 +734,28 @@ public:
   rclcpp::ContentFilterOptions
   get_content_filter() const;
 
+  /// Get the content filter evaluated by rclcpp on the messages taken from the middleware.
+  /**
+   * When the subscription is created with a filter expression, see
+   * SubscriptionOptions::content_filter_options, and the middleware doesn't support content
+   * filtering, the expression is compiled and evaluated by rclcpp instead.
+   * The executor evaluates it on the serialized messages it takes, before deserializing them,
+   * and drops the ones which don't pass it.
+   * Messages taken with take() aren't filtered.
+   *
+   * Messages of intra-process publishers are filtered by rclcpp too, before they are copied,
+   * even when the middleware supports content filtering.
+   *
+   * Expressions which can't be compiled by rclcpp, see rclcpp::ContentFilter, are only
+   * evaluated by the middleware, if it supports content filtering.
+   *
+   * \return the content filter, or nullptr if the middleware filters the messages, or if
+   *   there is no filter rclcpp can evaluate
+   */
+  RCLCPP_PUBLIC
+  std::shared_ptr<const rclcpp::ContentFilter>
+  get_fallback_content_filter() const;
+
   // DYNAMIC TYPE ==================================================================================
   // TODO(methylDragon): Reorder later
   RCLCPP_PUBLIC
@@ -611,6 +799,18 @@ public:
     rclcpp::MessageInfo & message_info_out);
   // ===============================================================================================
 
+  /// Get the callback group the subscription was added to.
+  /**
+   * The callback group keeps a weak pointer to the subscription, and the subscription a weak
+   * pointer back to the last callback group it was added to, so that executors find the group
+   * of the subscription without searching all the groups.
+   *
+   * \return the callback group, or nullptr if none or if it was destroyed
+   */
+  RCLCPP_PUBLIC
+  std::shared_ptr<rclcpp::CallbackGroup>
+  get_callback_group() const;
+
 protected:
   template<typename EventCallbackT>
   void
@@ -642,6 +842,29 @@ protected:
   void
   set_on_new_message_callback(rcl_event_callback_t callback, const void * user_data);
 
+  /// Set what the messages taken are delivered with, by the derived class once constructed.
+  /**
+   * By default, the message info is always filled and no receive stamp is captured.
+   *
+   * \param[in] needs_message_info whether the callback or rclcpp use the message info
+   * \param[in] capture_receive_stamp whether the receive stamp of the messages is captured
+   */
+  RCLCPP_PUBLIC
+  void
+  set_message_info_usage(bool needs_message_info, bool capture_receive_stamp);
+
+  /// Get the message info to give to rcl when taking a message, nullptr if it's not needed.
+  /**
+   * The receive stamp is captured by capture_receive_stamp(), once a message was taken.
+   */
+  RCLCPP_PUBLIC
+  rmw_message_info_t *
+  message_info_to_take(rclcpp::MessageInfo & message_info, bool fill_message_info);
+
+  RCLCPP_PUBLIC
+  void
+  capture_receive_stamp(rclcpp::MessageInfo & message_info) const;
+
   rclcpp::node_interfaces::NodeBaseInterface * const node_base_;
 
   std::shared_ptr<rcl_node_t> node_handle_;
@@ -667,16 +890,39 @@ protected:
 
   const SubscriptionEventCallbacks event_callbacks_;
 
+  // The filter compiled by rclcpp, if any, and the same filter if the middleware doesn't filter.
+  // Both are accessed with the atomic functions of shared pointers.
+  std::shared_ptr<const rclcpp::ContentFilter> content_filter_;
+  std::shared_ptr<const rclcpp::ContentFilter> fallback_content_filter_;
+
 private:
   RCLCPP_DISABLE_COPY(SubscriptionBase)
 
+  /// Compile the content filter evaluated by rclcpp, and give it to the intra-process subscription.
+  void
+  update_content_filter(
+    const std::string & filter_expression,
+    const std::vector<std::string> & expression_parameters);
+
   rosidl_message_type_support_t type_support_;
   DeliveredMessageKind delivered_message_kind_;
+  std::atomic<size_t> max_batch_size_{1};
+  std::atomic<bool> deserialize_after_take_{false};
+  rclcpp::detail::RateLimiter rate_limiter_;
+  bool needs_message_info_{true};
+  bool capture_receive_stamp_{false};
+
+  // Number of deadline monitors watching the subscription, and the last steady time recorded
+  std::atomic<size_t> deadline_watchers_{0};
+  std::atomic<int64_t> last_message_received_ns_{0};
 
   std::atomic<bool> subscription_in_use_by_wait_set_{false};
   std::atomic<bool> intra_process_subscription_waitable_in_use_by_wait_set_{false};
   std::unordered_map<rclcpp::EventHandlerBase *,
     std::atomic<bool>> qos_events_in_use_by_wait_set_;
+
+  // Set by the callback group when the subscription is added to it
+  std::weak_ptr<rclcpp::CallbackGroup> callback_group_;
 };
 
 }  // namespace rclcpp
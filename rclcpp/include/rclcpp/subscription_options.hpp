@@ -28,6 +28,7 @@
 #include "rclcpp/qos.hpp"
 #include "rclcpp/event_handler.hpp"
 #include "rclcpp/qos_overriding_options.hpp"
+#include "rclcpp/serialized_message_codec.hpp"
 #include "rclcpp/subscription_content_filter_options.hpp"
 #include "rclcpp/topic_statistics_state.hpp"
 #include "rclcpp/visibility_control.hpp"
@@ -58,7 +59,68 @@ struct SubscriptionOptionsBase
   /// Setting to explicitly set intraprocess communications.
   IntraProcessSetting use_intra_process_comm = IntraProcessSetting::NodeDefault;
 
+  /// Maximum number of messages taken and delivered each time the subscription is ready.
+  /**
+   * With the default value of 1, the executor takes a single message and then waits again.
+   * With a greater value, the executor keeps taking messages, up to this number, as long as
+   * the middleware has some available, which saves a wait for each message during bursts.
+   */
+  size_t max_batch_size = 1;
+
+  /// Take the messages serialized, and deserialize them once they were taken.
+  /**
+   * Middlewares usually deserialize the messages while taking them, under a lock of the
+   * subscription, so the messages of a subscription are deserialized one at a time.
+   * With this option, taking a message only copies its serialized data, and the executor
+   * thread which took it deserializes it afterwards, without holding any lock.
+   * With a multi-threaded executor and a reentrant callback group, large messages like point
+   * clouds are then deserialized in parallel by the threads taking them.
+   *
+   * It costs an extra copy of the serialized data, so it's only worth it for large messages.
+   * It has no effect for loaned messages, and for subscriptions to serialized messages.
+   */
+  bool deserialize_after_take = false;
+
+  /// Maximum rate in Hz of the messages taken from the middleware and delivered, 0 for all.
+  /**
+   * Messages received faster are taken serialized and dropped, without being deserialized,
+   * nor filtered or delivered to the callback.
+   * Messages received intra-process are not decimated.
+   */
+  double max_rate = 0.0;
+
+  /// Capture the steady time at which each message is taken, see MessageInfo::get_receive_stamp.
+  /**
+   * The stamp is captured as soon as the message is taken from the middleware, before it's
+   * deserialized or delivered, so that the latency of the delivery can be measured.
+   */
+  bool capture_receive_stamp = false;
+
+  /// Number of serialized messages kept for reuse by subscriptions to serialized messages.
+  /**
+   * Only used by subscriptions delivering rclcpp::SerializedMessage, e.g. GenericSubscription.
+   * With the default value of 0, a new serialized message is allocated for every message taken.
+   * Otherwise, messages are acquired from a rclcpp::SerializedMessagePool keeping up to this
+   * number of unused messages, and their buffers are reused once the callback releases them.
+   */
+  size_t serialized_message_pool_size = 0;
+
+  /// Codec decoding the messages taken from the middleware, e.g. decompressing them, or nullptr.
+  /**
+   * Only used by subscriptions delivering rclcpp::SerializedMessage, e.g. GenericSubscription,
+   * to decode the messages encoded by publishers using the same codec.
+   * The decoded messages are acquired from a rclcpp::SerializedMessagePool.
+   *
+   * \sa rclcpp::SerializedMessageCodec
+   */
+  std::shared_ptr<rclcpp::SerializedMessageCodec> payload_codec;
+
   /// Setting the data-type stored in the intraprocess buffer
+  /**
+   * Use IntraProcessBufferType::SharedPtr with a callback taking ownership of the messages
+   * to avoid copying them for each subscription when they are published: the copy is then
+   * made only when the message is taken, and skipped if no other subscription shares it.
+   */
   IntraProcessBufferType intra_process_buffer_type = IntraProcessBufferType::CallbackDefault;
 
   /// Optional RMW implementation specific payload to be used during creation of the subscription.
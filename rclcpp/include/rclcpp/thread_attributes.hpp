@@ -0,0 +1,136 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__THREAD_ATTRIBUTES_HPP_
+#define RCLCPP__THREAD_ATTRIBUTES_HPP_
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "rclcpp/macros.hpp"
+#include "rclcpp/visibility_control.hpp"
+
+namespace rclcpp
+{
+
+/// Scheduling policy of a thread.
+enum class ThreadSchedulingPolicy
+{
+  /// Keep the policy and priority of the thread creating the new thread.
+  Inherit,
+  /// Default time-sharing policy (SCHED_OTHER).
+  Other,
+  /// Real-time first-in first-out policy (SCHED_FIFO).
+  Fifo,
+  /// Real-time round-robin policy (SCHED_RR).
+  RoundRobin,
+};
+
+/// Attributes of a thread created by an executor.
+/**
+ * Default constructed attributes leave every setting to the operating system defaults.
+ * Real-time policies usually require special privileges: if the attributes can't be applied,
+ * the thread is not created and an exception is thrown.
+ *
+ * CPU affinity and scheduling policies are only supported on Linux and other POSIX systems
+ * respectively; on other platforms they are ignored.
+ */
+struct ThreadAttributes
+{
+  /// Indices of the CPU cores the thread is allowed to run on, empty to run on any core.
+  std::vector<size_t> cpu_affinity;
+  /// Scheduling policy of the thread.
+  ThreadSchedulingPolicy scheduling_policy = ThreadSchedulingPolicy::Inherit;
+  /// Scheduling priority, only used with the Fifo and RoundRobin policies.
+  int priority = 0;
+  /// Stack size in bytes, 0 to use the default stack size.
+  size_t stack_size = 0;
+  /// Name of the thread, it may be truncated by the operating system (e.g. 15 characters).
+  std::string name;
+};
+
+/// A thread of execution started with the provided attributes.
+/**
+ * This is used instead of std::thread, which can't set attributes like the stack size or
+ * the scheduling policy before the thread starts running.
+ * Like std::thread, it must be joined before being destroyed, otherwise the destructor
+ * joins it.
+ */
+class ThreadWithAttributes
+{
+public:
+  /// Start a new thread running the given function.
+  /**
+   * \param[in] attributes attributes of the new thread
+   * \param[in] function function run by the new thread
+   * \throws std::runtime_error if the thread can't be created with the given attributes
+   */
+  RCLCPP_PUBLIC
+  ThreadWithAttributes(const ThreadAttributes & attributes, std::function<void()> function);
+
+  RCLCPP_PUBLIC
+  ThreadWithAttributes(ThreadWithAttributes && other);
+
+  RCLCPP_PUBLIC
+  ThreadWithAttributes &
+  operator=(ThreadWithAttributes && other);
+
+  RCLCPP_PUBLIC
+  ~ThreadWithAttributes();
+
+  /// Block until the thread finishes.
+  RCLCPP_PUBLIC
+  void
+  join();
+
+  /// Return true if the thread has not been joined yet.
+  RCLCPP_PUBLIC
+  bool
+  joinable() const;
+
+private:
+  RCLCPP_DISABLE_COPY(ThreadWithAttributes)
+
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+/// Get the indices of the CPU cores of each NUMA node of the machine, in node order.
+/**
+ * On Linux, the topology is read from sysfs, and the nodes without CPU cores are left out.
+ * On other platforms, or if the topology can't be read, a single node with all the cores
+ * reported by std::thread::hardware_concurrency() is returned.
+ */
+RCLCPP_PUBLIC
+std::vector<std::vector<size_t>>
+get_numa_node_cpus();
+
+/// Make the attributes of threads spread evenly over NUMA nodes, in node order.
+/**
+ * \param[in] number_of_threads the number of attributes to make
+ * \param[in] numa_node_cpus the cores of each NUMA node, as returned by get_numa_node_cpus()
+ * \return attributes pinning the i-th thread to the cores of the node at index i modulo the
+ *   number of nodes, or default attributes if there are no nodes
+ */
+RCLCPP_PUBLIC
+std::vector<ThreadAttributes>
+make_numa_thread_attributes(
+  size_t number_of_threads,
+  const std::vector<std::vector<size_t>> & numa_node_cpus);
+
+}  // namespace rclcpp
+
+#endif  // RCLCPP__THREAD_ATTRIBUTES_HPP_
@@ -21,6 +21,7 @@
 
 #include "rcl/time.h"
 
+#include "rclcpp/detail/saturating_arithmetic.hpp"
 #include "rclcpp/duration.hpp"
 
 namespace rclcpp
@@ -54,8 +55,7 @@ public:
   explicit Time(int64_t nanoseconds = 0, rcl_clock_type_t clock_type = RCL_SYSTEM_TIME);
 
   /// Copy constructor
-  RCLCPP_PUBLIC
-  Time(const Time & rhs);
+  Time(const Time & rhs) = default;
 
   /// Time constructor
   /**
@@ -86,9 +86,8 @@ public:
   /**
    * \throws std::runtime_error if seconds are negative
    */
-  RCLCPP_PUBLIC
   Time &
-  operator=(const Time & rhs);
+  operator=(const Time & rhs) = default;
 
   /**
    * Assign Time from a builtin_interfaces::msg::Time instance.
@@ -103,41 +102,58 @@ public:
   /**
    * \throws std::runtime_error if the time sources are different
    */
-  RCLCPP_PUBLIC
   bool
-  operator==(const rclcpp::Time & rhs) const;
+  operator==(const rclcpp::Time & rhs) const
+  {
+    check_same_clock_type(rhs);
+    return rcl_time_.nanoseconds == rhs.rcl_time_.nanoseconds;
+  }
 
-  RCLCPP_PUBLIC
   bool
-  operator!=(const rclcpp::Time & rhs) const;
+  operator!=(const rclcpp::Time & rhs) const
+  {
+    return !(*this == rhs);
+  }
 
   /**
    * \throws std::runtime_error if the time sources are different
    */
-  RCLCPP_PUBLIC
   bool
-  operator<(const rclcpp::Time & rhs) const;
+  operator<(const rclcpp::Time & rhs) const
+  {
+    check_same_clock_type(rhs);
+    return rcl_time_.nanoseconds < rhs.rcl_time_.nanoseconds;
+  }
 
   /**
    * \throws std::runtime_error if the time sources are different
    */
-  RCLCPP_PUBLIC
   bool
-  operator<=(const rclcpp::Time & rhs) const;
+  operator<=(const rclcpp::Time & rhs) const
+  {
+    check_same_clock_type(rhs);
+    return rcl_time_.nanoseconds <= rhs.rcl_time_.nanoseconds;
+  }
 
   /**
    * \throws std::runtime_error if the time sources are different
    */
-  RCLCPP_PUBLIC
   bool
-  operator>=(const rclcpp::Time & rhs) const;
+  operator>=(const rclcpp::Time & rhs) const
+  {
+    check_same_clock_type(rhs);
+    return rcl_time_.nanoseconds >= rhs.rcl_time_.nanoseconds;
+  }
 
   /**
    * \throws std::runtime_error if the time sources are different
    */
-  RCLCPP_PUBLIC
   bool
-  operator>(const rclcpp::Time & rhs) const;
+  operator>(const rclcpp::Time & rhs) const
+  {
+    check_same_clock_type(rhs);
+    return rcl_time_.nanoseconds > rhs.rcl_time_.nanoseconds;
+  }
 
   /**
    * \throws std::overflow_error if addition leads to overflow
@@ -175,13 +191,45 @@ public:
   Time &
   operator-=(const rclcpp::Duration & rhs);
 
+  /// Add a duration, clamping the time to the range of rcl_time_point_value_t.
+  Time
+  saturating_add(const rclcpp::Duration & rhs) const noexcept
+  {
+    Time result(*this);
+    result.rcl_time_.nanoseconds = detail::saturating_add(rcl_time_.nanoseconds, rhs.nanoseconds());
+    return result;
+  }
+
+  /// Subtract a duration, clamping the time to the range of rcl_time_point_value_t.
+  Time
+  saturating_sub(const rclcpp::Duration & rhs) const noexcept
+  {
+    Time result(*this);
+    result.rcl_time_.nanoseconds = detail::saturating_sub(rcl_time_.nanoseconds, rhs.nanoseconds());
+    return result;
+  }
+
+  /// Get the duration since a time of the same clock type, clamped to the range of a duration.
+  /**
+   * Unlike operator-(), the clock types aren't checked, the result is meaningless if they
+   * differ.
+   */
+  Duration
+  saturating_sub(const rclcpp::Time & rhs) const noexcept
+  {
+    return Duration::from_nanoseconds(
+      detail::saturating_sub(rcl_time_.nanoseconds, rhs.rcl_time_.nanoseconds));
+  }
+
   /// Get the nanoseconds since epoch
   /**
    * \return the nanoseconds since epoch as a rcl_time_point_value_t structure.
    */
-  RCLCPP_PUBLIC
   rcl_time_point_value_t
-  nanoseconds() const;
+  nanoseconds() const noexcept
+  {
+    return rcl_time_.nanoseconds;
+  }
 
   /// Get the maximum representable value.
   /**
@@ -206,11 +254,28 @@ public:
   /**
    * \return the clock type
    */
-  RCLCPP_PUBLIC
   rcl_clock_type_t
-  get_clock_type() const;
+  get_clock_type() const noexcept
+  {
+    return rcl_time_.clock_type;
+  }
 
 private:
+  void
+  check_same_clock_type(const rclcpp::Time & rhs) const
+  {
+    if (rcl_time_.clock_type != rhs.rcl_time_.clock_type) {
+      throw_different_time_sources();
+    }
+  }
+
+  // Out of line, so that the comparisons inlined by the callers stay small
+  [[noreturn]]
+  RCLCPP_PUBLIC
+  static
+  void
+  throw_different_time_sources();
+
   rcl_time_point_t rcl_time_;
   friend Clock;  // Allow clock to manipulate internal data
 };
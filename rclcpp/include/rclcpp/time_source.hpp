@@ -46,6 +46,9 @@ class Clock;
  * - qos_overrides./clock.durability
  * - qos_overrides./clock.history
  * - qos_overrides./clock.reliability
+ *
+ * The time sources of a context can instead share a single subscription to the clock topic,
+ * spun by a single thread, see set_use_shared_clock_subscription().
  */
 class TimeSource
 {
@@ -138,6 +141,21 @@ public:
   RCLCPP_PUBLIC
   void set_use_clock_thread(bool use_clock_thread);
 
+  /// Get whether the clock subscription is shared with the other time sources of the context
+  RCLCPP_PUBLIC
+  bool get_use_shared_clock_subscription();
+
+  /// Set whether to share the clock subscription with the other time sources of the context
+  /**
+   * The shared subscription is created with the QoS of the first time source using it, and
+   * is spun by its own thread, whatever the use_clock_thread flag.
+   * Its QoS can't be reconfigured with the parameter overrides of the nodes.
+   *
+   * The flag is used when the subscription is created, when `use_sim_time` becomes `true`.
+   */
+  RCLCPP_PUBLIC
+  void set_use_shared_clock_subscription(bool use_shared_clock_subscription);
+
   /// Check if the clock thread is joinable
   RCLCPP_PUBLIC
   bool clock_thread_is_joinable();
@@ -17,18 +17,22 @@
 
 #include <atomic>
 #include <chrono>
+#include <cstdint>
 #include <functional>
+#include <limits>
 #include <memory>
 #include <sstream>
 #include <thread>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "rclcpp/clock.hpp"
 #include "rclcpp/context.hpp"
 #include "rclcpp/function_traits.hpp"
 #include "rclcpp/macros.hpp"
 #include "rclcpp/rate.hpp"
+#include "rclcpp/tracing.hpp"
 #include "rclcpp/utilities.hpp"
 #include "rclcpp/visibility_control.hpp"
 #include "tracetools/tracetools.h"
@@ -43,8 +47,36 @@
 namespace rclcpp
 {
 
+class CallbackGroup;
+
+/// Information about a call of a timer.
+struct TimerInfo
+{
+  /// Time at which the call was scheduled.
+  Time expected_call_time;
+  /// Time at which the timer was called, its callback is executed right after it.
+  Time actual_call_time;
+  /// Time between the expected and actual call times.
+  std::chrono::nanoseconds lateness;
+  /// Number of whole periods elapsed since the expected call time, which got no call.
+  uint64_t missed_periods;
+};
+
+/// Statistics of the calls of a timer.
+struct TimerStatistics
+{
+  /// Number of calls of the timer.
+  uint64_t call_count;
+  /// Total number of periods which got no call.
+  uint64_t missed_periods;
+  /// Largest lateness of a call.
+  std::chrono::nanoseconds max_lateness;
+};
+
 class TimerBase
 {
+  friend class rclcpp::CallbackGroup;
+
 public:
   RCLCPP_SMART_PTR_DEFINITIONS_NOT_COPYABLE(TimerBase)
 
@@ -96,12 +128,26 @@ public:
   void
   reset();
 
+  /// Postpone the next expiration of the timer to one period from now, without resetting it.
+  /**
+   * This is meant for watchdog timers, which are postponed on every message received.
+   * Unlike reset(), only the time of the touch is stored: the executors aren't notified,
+   * and the timer is rescheduled when it next expires, instead of being executed then.
+   * The timer is then executed one period after its last touch, unless it's touched again.
+   *
+   * \throws std::runtime_error if the current time of the clock of the timer can't be read
+   */
+  RCLCPP_PUBLIC
+  void
+  touch();
+
   /// Indicate that we're about to execute the callback.
   /**
    * The multithreaded executor takes advantage of this to avoid scheduling
    * the callback multiple times.
    *
-   * \return `true` if the callback should be executed, `false` if the timer was canceled.
+   * \return `true` if the callback should be executed, `false` if the timer was canceled,
+   *   or postponed because it was touched less than a period ago.
    */
   RCLCPP_PUBLIC
   virtual bool
@@ -140,6 +186,48 @@ public:
   RCLCPP_PUBLIC
   bool is_ready();
 
+  /// Set how much earlier than its expiration the timer may be executed.
+  /**
+   * When an executor wakes up shortly before the timer expires, e.g. for another timer,
+   * it executes this timer in the same wakeup if it expires within its slack, instead of
+   * waking up again for it.
+   * Timers with related periods then share their wakeups, at the cost of their jitter.
+   * The next expirations aren't moved by an early execution, they stay one period apart.
+   *
+   * The slack is used by the wait set based executors and by the timers manager, unless
+   * it uses a timing wheel.
+   *
+   * \param[in] slack how early the timer may be executed, zero by default
+   * \throws std::invalid_argument if slack is negative, or not less than the period
+   */
+  RCLCPP_PUBLIC
+  void
+  set_slack(std::chrono::nanoseconds slack);
+
+  /// Get how much earlier than its expiration the timer may be executed.
+  RCLCPP_PUBLIC
+  std::chrono::nanoseconds
+  get_slack() const;
+
+  /// Get the handles of all the timers of the process whose slack isn't zero.
+  /**
+   * This lets executors check the few timers with a slack, rather than all their timers.
+   *
+   * \param[out] handles cleared, then filled with the handles, reusing its capacity
+   */
+  RCLCPP_PUBLIC
+  static void
+  get_timers_with_slack(std::vector<const rcl_timer_t *> & handles);
+
+  /// Check if the timer is ready, or expires within its slack.
+  /**
+   * \return True if the timer may be executed now.
+   * \throws std::runtime_error if it failed to check timer
+   */
+  RCLCPP_PUBLIC
+  bool
+  is_ready_within_slack();
+
   /// Exchange the "in use by wait set" state for this timer.
   /**
    * This is used to ensure this timer is not used by multiple
@@ -179,6 +267,42 @@ public:
   void
   clear_on_reset_callback();
 
+  /// Get information about the last call of the timer.
+  /**
+   * The information is updated by call(), so it describes the current call when read from
+   * the callback of the timer.
+   * The times are zero if the timer was never called.
+   *
+   * This function is thread-safe, but the information may mix two calls when read while the
+   * timer is called from another thread.
+   */
+  RCLCPP_PUBLIC
+  TimerInfo
+  get_last_call_info() const;
+
+  /// Get the statistics of the calls of the timer since it was created or they were reset.
+  /** This function is thread-safe and lock-free. */
+  RCLCPP_PUBLIC
+  TimerStatistics
+  get_statistics() const;
+
+  /// Reset the statistics of the calls of the timer.
+  RCLCPP_PUBLIC
+  void
+  reset_statistics();
+
+  /// Get the callback group the timer was added to.
+  /**
+   * The callback group keeps a weak pointer to the timer, and the timer a weak pointer
+   * back to the last callback group it was added to, so that executors find the group of the
+   * timer without searching all the groups.
+   *
+   * \return the callback group, or nullptr if none or if it was destroyed
+   */
+  RCLCPP_PUBLIC
+  std::shared_ptr<rclcpp::CallbackGroup>
+  get_callback_group() const;
+
 protected:
   std::recursive_mutex callback_mutex_;
   // Declare callback before timer_handle_, so on destruction
@@ -196,18 +320,57 @@ protected:
   RCLCPP_PUBLIC
   void
   set_on_reset_callback(rcl_event_callback_t callback, const void * user_data);
+
+  /// Update the call information and statistics for a call which just happened.
+  /**
+   * \param[in] time_until_call time until the call, as given by time_until_trigger() right
+   *   before the timer was called, negative when the call is late
+   */
+  RCLCPP_PUBLIC
+  void
+  record_call(std::chrono::nanoseconds time_until_call);
+
+  /// Move the next expiration to one period after the last touch, if it's not due yet.
+  /**
+   * \param[in] time_until_call time until the call, as given by time_until_trigger() right
+   *   before the timer is called
+   * \return true if the timer was rescheduled, and mustn't be executed now
+   */
+  RCLCPP_PUBLIC
+  bool
+  postpone_to_last_touch(std::chrono::nanoseconds time_until_call);
+
+private:
+  // Last call, in nanoseconds of the clock of the timer
+  std::atomic<int64_t> last_expected_call_time_{0};
+  std::atomic<int64_t> last_actual_call_time_{0};
+  std::atomic<uint64_t> last_missed_periods_{0};
+  std::atomic<uint64_t> call_count_{0};
+  std::atomic<uint64_t> missed_periods_{0};
+  std::atomic<int64_t> max_lateness_{0};
+
+  std::atomic<int64_t> slack_{0};
+
+  // Time of the last touch() not handled yet, in nanoseconds of the clock of the timer
+  static constexpr int64_t not_touched = std::numeric_limits<int64_t>::min();
+  std::atomic<int64_t> last_touch_time_{not_touched};
+
+  // Set by the callback group when the timer is added to it
+  std::weak_ptr<rclcpp::CallbackGroup> callback_group_;
 };
 
 
 using VoidCallbackType = std::function<void ()>;
 using TimerCallbackType = std::function<void (TimerBase &)>;
+using TimerInfoCallbackType = std::function<void (const TimerInfo &)>;
 
 /// Generic timer. Periodically executes a user-specified callback.
 template<
   typename FunctorT,
   typename std::enable_if<
     rclcpp::function_traits::same_arguments<FunctorT, VoidCallbackType>::value ||
-    rclcpp::function_traits::same_arguments<FunctorT, TimerCallbackType>::value
+    rclcpp::function_traits::same_arguments<FunctorT, TimerCallbackType>::value ||
+    rclcpp::function_traits::same_arguments<FunctorT, TimerInfoCallbackType>::value
   >::type * = nullptr
 >
 class GenericTimer : public TimerBase
@@ -259,6 +422,11 @@ public:
   bool
   call() override
   {
+    // Read before the call, which schedules the next one
+    const std::chrono::nanoseconds time_until_call = time_until_trigger();
+    if (postpone_to_last_touch(time_until_call)) {
+      return false;
+    }
     rcl_ret_t ret = rcl_timer_call(timer_handle_.get());
     if (ret == RCL_RET_TIMER_CANCELED) {
       return false;
@@ -266,6 +434,7 @@ public:
     if (ret != RCL_RET_OK) {
       throw std::runtime_error("Failed to notify timer that callback occurred");
     }
+    record_call(time_until_call);
     return true;
   }
 
@@ -275,9 +444,9 @@ public:
   void
   execute_callback() override
   {
-    TRACETOOLS_TRACEPOINT(callback_start, reinterpret_cast<const void *>(&callback_), false);
+    RCLCPP_TRACEPOINT(Callback, callback_start, reinterpret_cast<const void *>(&callback_), false);
     execute_callback_delegate<>();
-    TRACETOOLS_TRACEPOINT(callback_end, reinterpret_cast<const void *>(&callback_));
+    RCLCPP_TRACEPOINT(Callback, callback_end, reinterpret_cast<const void *>(&callback_));
   }
 
   // void specialization
@@ -305,6 +474,18 @@ public:
     callback_(*this);
   }
 
+  template<
+    typename CallbackT = FunctorT,
+    typename std::enable_if<
+      rclcpp::function_traits::same_arguments<CallbackT, TimerInfoCallbackType>::value
+    >::type * = nullptr
+  >
+  void
+  execute_callback_delegate()
+  {
+    callback_(get_last_call_info());
+  }
+
   /// Is the clock steady (i.e. is the time between ticks constant?)
   /** \return True if the clock used by this timer is steady. */
   bool
@@ -323,7 +504,8 @@ template<
   typename FunctorT,
   typename std::enable_if<
     rclcpp::function_traits::same_arguments<FunctorT, VoidCallbackType>::value ||
-    rclcpp::function_traits::same_arguments<FunctorT, TimerCallbackType>::value
+    rclcpp::function_traits::same_arguments<FunctorT, TimerCallbackType>::value ||
+    rclcpp::function_traits::same_arguments<FunctorT, TimerInfoCallbackType>::value
   >::type * = nullptr
 >
 class WallTimer : public GenericTimer<FunctorT>
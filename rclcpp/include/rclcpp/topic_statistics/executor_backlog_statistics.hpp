@@ -0,0 +1,127 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__TOPIC_STATISTICS__EXECUTOR_BACKLOG_STATISTICS_HPP_
+#define RCLCPP__TOPIC_STATISTICS__EXECUTOR_BACKLOG_STATISTICS_HPP_
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "rclcpp/executor.hpp"
+#include "rclcpp/macros.hpp"
+#include "rclcpp/publisher_base.hpp"
+#include "rclcpp/qos.hpp"
+#include "rclcpp/timer.hpp"
+#include "rclcpp/visibility_control.hpp"
+
+#include "statistics_msgs/msg/metrics_message.hpp"
+
+namespace rclcpp
+{
+namespace node_interfaces
+{
+class NodeTopicsInterface;
+}  // namespace node_interfaces
+
+namespace topic_statistics
+{
+
+/// Names of the metrics published by rclcpp::topic_statistics::ExecutorBacklogStatistics.
+constexpr const char kIntraProcessQueuedMetricName[]{"intra_process_queued"};
+constexpr const char kIntraProcessDroppedMetricName[]{"intra_process_dropped"};
+constexpr const char kEventsQueueSizeMetricName[]{"events_queue_size"};
+
+/// Class used to publish the backlog of an executor periodically.
+/**
+ * The following metrics are published for every period, from rclcpp::Executor::get_backlog():
+ *  - `intra_process_queued`, for each subscription using intra-process communication, with
+ *    its topic name as measurement source: the number of messages in its buffer, as the
+ *    average, min and max of a single sample.
+ *  - `intra_process_dropped`, for the same subscriptions: the number of messages the buffer
+ *    dropped since it was created, as the sample count of the statistics.
+ *  - `events_queue_size`, with the name of the node as measurement source: the number of
+ *    events waiting in the queue of the executor, as the average, min and max of a single
+ *    sample.
+ */
+class ExecutorBacklogStatistics
+{
+public:
+  RCLCPP_SMART_PTR_DEFINITIONS_NOT_COPYABLE(ExecutorBacklogStatistics)
+
+  /// Constructor.
+  /**
+   * \param node_name the name of the node publishing the statistics
+   * \param executor the observed executor, which must outlive this object
+   * \param publisher the publisher of statistics_msgs::msg::MetricsMessage, owned by this class
+   * \throws std::invalid_argument if publisher is nullptr or publishes another type
+   */
+  RCLCPP_PUBLIC
+  ExecutorBacklogStatistics(
+    const std::string & node_name,
+    rclcpp::Executor & executor,
+    rclcpp::PublisherBase::SharedPtr publisher);
+
+  RCLCPP_PUBLIC
+  virtual ~ExecutorBacklogStatistics();
+
+  /// Set the timer used to publish statistics messages.
+  RCLCPP_PUBLIC
+  void
+  set_publisher_timer(rclcpp::TimerBase::SharedPtr publisher_timer);
+
+  /// Publish the current backlog of the executor.
+  RCLCPP_PUBLIC
+  virtual void
+  publish_message();
+
+  /// Compute the statistics messages of the current backlog of the executor.
+  RCLCPP_PUBLIC
+  std::vector<statistics_msgs::msg::MetricsMessage>
+  generate_messages();
+
+private:
+  const std::string node_name_;
+  rclcpp::Executor & executor_;
+  rclcpp::PublisherBase::SharedPtr publisher_;
+  rclcpp::TimerBase::SharedPtr publisher_timer_;
+};
+
+/// Publish the backlog of an executor periodically.
+/**
+ * The statistics publisher and the timer publishing them are added to the node.
+ * The node is typically added to the observed executor, so that the backlog is read by one of
+ * its threads, but it doesn't have to be.
+ *
+ * \param node_topics the topics interface of the node publishing the statistics
+ * \param executor the observed executor, which must outlive the returned object
+ * \param publish_period the period of the statistics
+ * \param publish_topic the topic of the statistics
+ * \param qos the QoS of the statistics publisher
+ * \return the statistics, which stop being published once destroyed
+ * \throws std::invalid_argument if the publish period is not greater than zero
+ */
+RCLCPP_PUBLIC
+ExecutorBacklogStatistics::SharedPtr
+create_executor_backlog_statistics(
+  rclcpp::node_interfaces::NodeTopicsInterface * node_topics,
+  rclcpp::Executor & executor,
+  std::chrono::milliseconds publish_period = std::chrono::seconds(1),
+  const std::string & publish_topic = "/executor_backlog",
+  const rclcpp::QoS & qos = rclcpp::SystemDefaultsQoS());
+
+}  // namespace topic_statistics
+}  // namespace rclcpp
+
+#endif  // RCLCPP__TOPIC_STATISTICS__EXECUTOR_BACKLOG_STATISTICS_HPP_
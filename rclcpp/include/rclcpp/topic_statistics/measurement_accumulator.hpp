@@ -0,0 +1,136 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__TOPIC_STATISTICS__MEASUREMENT_ACCUMULATOR_HPP_
+#define RCLCPP__TOPIC_STATISTICS__MEASUREMENT_ACCUMULATOR_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+#include "libstatistics_collector/moving_average_statistics/types.hpp"
+
+namespace rclcpp
+{
+namespace topic_statistics
+{
+
+using libstatistics_collector::moving_average_statistics::StatisticData;
+
+/// Accumulator of measurements, which can be updated concurrently without locks.
+/**
+ * The statistics are computed from the count, the sum and the sum of squares of the
+ * measurements, plus their extrema.
+ * A measurement added while the accumulator is reset may be split between two windows.
+ */
+class MeasurementAccumulator
+{
+public:
+  MeasurementAccumulator()
+  {
+    reset();
+  }
+
+  /// Add a measurement, it can be called concurrently from multiple threads.
+  void add(double value)
+  {
+    atomic_add(sum_, value);
+    atomic_add(sum_of_squares_, value * value);
+    atomic_update(min_, value, [](double a, double b) {return a < b;});
+    atomic_update(max_, value, [](double a, double b) {return a > b;});
+    count_.fetch_add(1, std::memory_order_release);
+  }
+
+  /// Compute the statistics of the current measurements.
+  StatisticData get() const
+  {
+    const uint64_t count = count_.load(std::memory_order_acquire);
+    return to_statistic_data(
+      count,
+      sum_.load(std::memory_order_relaxed),
+      sum_of_squares_.load(std::memory_order_relaxed),
+      min_.load(std::memory_order_relaxed),
+      max_.load(std::memory_order_relaxed));
+  }
+
+  /// Compute the statistics of the current measurements and discard them.
+  StatisticData get_and_reset()
+  {
+    const uint64_t count = count_.exchange(0, std::memory_order_acquire);
+    return to_statistic_data(
+      count,
+      sum_.exchange(0.0, std::memory_order_relaxed),
+      sum_of_squares_.exchange(0.0, std::memory_order_relaxed),
+      min_.exchange(std::numeric_limits<double>::infinity(), std::memory_order_relaxed),
+      max_.exchange(-std::numeric_limits<double>::infinity(), std::memory_order_relaxed));
+  }
+
+  /// Discard the current measurements.
+  void reset()
+  {
+    (void)get_and_reset();
+  }
+
+private:
+  static void atomic_add(std::atomic<double> & target, double value)
+  {
+    double current = target.load(std::memory_order_relaxed);
+    while (!target.compare_exchange_weak(current, current + value, std::memory_order_relaxed)) {
+    }
+  }
+
+  template<typename ReplaceT>
+  static void atomic_update(std::atomic<double> & target, double value, ReplaceT replace)
+  {
+    double current = target.load(std::memory_order_relaxed);
+    while (replace(value, current) &&
+      !target.compare_exchange_weak(current, value, std::memory_order_relaxed))
+    {
+    }
+  }
+
+  static StatisticData to_statistic_data(
+    uint64_t count, double sum, double sum_of_squares, double min, double max)
+  {
+    StatisticData data;
+    data.sample_count = count;
+    if (count == 0) {
+      data.average = std::nan("");
+      data.min = std::nan("");
+      data.max = std::nan("");
+      data.standard_deviation = std::nan("");
+      return data;
+    }
+    data.average = sum / static_cast<double>(count);
+    data.min = min;
+    data.max = max;
+    const double variance =
+      sum_of_squares / static_cast<double>(count) - data.average * data.average;
+    data.standard_deviation = std::sqrt(std::max(0.0, variance));
+    return data;
+  }
+
+  std::atomic<uint64_t> count_{0};
+  std::atomic<double> sum_{0.0};
+  std::atomic<double> sum_of_squares_{0.0};
+  std::atomic<double> min_{0.0};
+  std::atomic<double> max_{0.0};
+};
+
+}  // namespace topic_statistics
+}  // namespace rclcpp
+
+#endif  // RCLCPP__TOPIC_STATISTICS__MEASUREMENT_ACCUMULATOR_HPP_
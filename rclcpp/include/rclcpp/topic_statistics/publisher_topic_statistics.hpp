@@ -0,0 +1,210 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__TOPIC_STATISTICS__PUBLISHER_TOPIC_STATISTICS_HPP_
+#define RCLCPP__TOPIC_STATISTICS__PUBLISHER_TOPIC_STATISTICS_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "rclcpp/macros.hpp"
+#include "rclcpp/publisher_base.hpp"
+#include "rclcpp/publisher_options.hpp"
+#include "rclcpp/time.hpp"
+#include "rclcpp/timer.hpp"
+#include "rclcpp/topic_statistics/measurement_accumulator.hpp"
+#include "rclcpp/visibility_control.hpp"
+
+#include "statistics_msgs/msg/metrics_message.hpp"
+
+namespace rclcpp
+{
+namespace node_interfaces
+{
+class NodeTopicsInterface;
+}  // namespace node_interfaces
+
+namespace topic_statistics
+{
+
+/// Names of the metrics published by rclcpp::topic_statistics::PublisherTopicStatistics.
+constexpr const char kPublishDurationMetricName[]{"publish_duration"};
+constexpr const char kIntraProcessPublicationsMetricName[]{"intra_process_publications"};
+constexpr const char kInterProcessPublicationsMetricName[]{"inter_process_publications"};
+constexpr const char kLoanedPublicationsMetricName[]{"loaned_message_publications"};
+constexpr const char kPublishedBytesRateMetricName[]{"published_bytes_rate"};
+
+/// Class used to measure and publish the statistics of a publisher.
+/**
+ * The following metrics are published for every window, with the name of the node as
+ * measurement source:
+ *  - `publish_duration`, in milliseconds: the duration of the publish calls.
+ *  - `intra_process_publications`: the number of messages delivered intra-process,
+ *    as the sample count of the statistics.
+ *  - `inter_process_publications`: the number of messages given to the middleware,
+ *    as the sample count of the statistics.
+ *  - `loaned_message_publications`: the number of inter-process publications which used a
+ *    message loaned by the middleware, as the sample count of the statistics.
+ *    The loan hit rate is this count divided by the inter-process publications count.
+ *  - `published_bytes_rate`, in bytes per second: the average throughput of the publications
+ *    whose size is known, i.e. serialized messages, which are counted by the sample count.
+ *
+ * Measurements are accumulated without locking, the statistics are only computed when they
+ * are published.
+ *
+ * \sa rclcpp::PublisherOptionsBase::topic_stats_options
+ */
+class PublisherTopicStatistics
+{
+public:
+  RCLCPP_SMART_PTR_DEFINITIONS_NOT_COPYABLE(PublisherTopicStatistics)
+
+  /// Measure the duration of a publish call, for the lifetime of this object.
+  /**
+   * Publish calls made while another one is measured in the same thread are part of it,
+   * so that a message is only measured once when publish overloads call each other.
+   */
+  class PublishScope
+  {
+public:
+    explicit PublishScope(PublisherTopicStatistics * statistics)
+    : statistics_(statistics)
+    {
+      if (statistics_ && enter()) {
+        start_ = std::chrono::steady_clock::now();
+      } else {
+        statistics_ = nullptr;
+      }
+    }
+
+    ~PublishScope()
+    {
+      if (statistics_) {
+        statistics_->publish_duration_.add(
+          std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - start_).count());
+        leave();
+      }
+    }
+
+private:
+    RCLCPP_DISABLE_COPY(PublishScope)
+
+    /// Start measuring in the current thread, return false if it's already measuring.
+    RCLCPP_PUBLIC
+    static bool enter();
+
+    /// Stop measuring in the current thread, after enter() returned true.
+    RCLCPP_PUBLIC
+    static void leave();
+
+    PublisherTopicStatistics * statistics_;
+    std::chrono::steady_clock::time_point start_;
+  };
+
+  /// Constructor.
+  /**
+   * \param node_name the name of the node which created the measured publisher
+   * \param publisher the publisher of statistics_msgs::msg::MetricsMessage, owned by this class
+   * \throws std::invalid_argument if publisher is nullptr or publishes another type
+   */
+  RCLCPP_PUBLIC
+  PublisherTopicStatistics(
+    const std::string & node_name,
+    rclcpp::PublisherBase::SharedPtr publisher);
+
+  RCLCPP_PUBLIC
+  virtual ~PublisherTopicStatistics();
+
+  /// Count a message delivered to the intra-process subscriptions.
+  void
+  record_intra_process_publication()
+  {
+    intra_process_publications_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  /// Count a message given to the middleware.
+  /**
+   * \param loaned whether the message was loaned by the middleware
+   */
+  void
+  record_inter_process_publication(bool loaned = false)
+  {
+    inter_process_publications_.fetch_add(1, std::memory_order_relaxed);
+    if (loaned) {
+      loaned_publications_.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+
+  /// Count the size of a published message, when it's known.
+  void
+  record_published_bytes(size_t bytes)
+  {
+    published_bytes_.fetch_add(bytes, std::memory_order_relaxed);
+    sized_publications_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  /// Set the timer used to publish statistics messages.
+  RCLCPP_PUBLIC
+  void
+  set_publisher_timer(rclcpp::TimerBase::SharedPtr publisher_timer);
+
+  /// Publish the statistics of the current window, and start a new window.
+  RCLCPP_PUBLIC
+  virtual void
+  publish_message_and_reset_measurements();
+
+protected:
+  /// Compute the statistics messages of the current window, and start a new window.
+  RCLCPP_PUBLIC
+  std::vector<statistics_msgs::msg::MetricsMessage>
+  generate_messages_and_reset_measurements();
+
+private:
+  const std::string node_name_;
+  rclcpp::PublisherBase::SharedPtr publisher_;
+  rclcpp::TimerBase::SharedPtr publisher_timer_;
+  rclcpp::Time window_start_;
+
+  MeasurementAccumulator publish_duration_;
+  std::atomic<uint64_t> intra_process_publications_{0};
+  std::atomic<uint64_t> inter_process_publications_{0};
+  std::atomic<uint64_t> loaned_publications_{0};
+  std::atomic<uint64_t> published_bytes_{0};
+  std::atomic<uint64_t> sized_publications_{0};
+};
+
+/// Create the statistics of a publisher, if enabled by its options.
+/**
+ * The statistics publisher and the timer publishing them are added to the node.
+ *
+ * \param node_topics the topics interface of the node of the measured publisher
+ * \param options the options of the measured publisher
+ * \return the statistics, or nullptr if they are disabled in the options
+ * \throws std::invalid_argument if the publish period is not greater than zero
+ */
+RCLCPP_PUBLIC
+PublisherTopicStatistics::SharedPtr
+create_publisher_topic_statistics(
+  rclcpp::node_interfaces::NodeTopicsInterface * node_topics,
+  const rclcpp::PublisherOptionsBase & options);
+
+}  // namespace topic_statistics
+}  // namespace rclcpp
+
+#endif  // RCLCPP__TOPIC_STATISTICS__PUBLISHER_TOPIC_STATISTICS_HPP_
@@ -15,6 +15,10 @@
 #ifndef RCLCPP__TOPIC_STATISTICS__SUBSCRIPTION_TOPIC_STATISTICS_HPP_
 #define RCLCPP__TOPIC_STATISTICS__SUBSCRIPTION_TOPIC_STATISTICS_HPP_
 
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <limits>
 #include <memory>
 #include <string>
 #include <utility>
@@ -23,13 +27,12 @@
 #include "libstatistics_collector/collector/generate_statistics_message.hpp"
 #include "libstatistics_collector/moving_average_statistics/types.hpp"
 #include "libstatistics_collector/topic_statistics_collector/constants.hpp"
-#include "libstatistics_collector/topic_statistics_collector/received_message_age.hpp"
-#include "libstatistics_collector/topic_statistics_collector/received_message_period.hpp"
 
 #include "rcl/time.h"
 #include "rclcpp/time.hpp"
 #include "rclcpp/publisher.hpp"
 #include "rclcpp/timer.hpp"
+#include "rclcpp/topic_statistics/measurement_accumulator.hpp"
 
 #include "statistics_msgs/msg/metrics_message.hpp"
 
@@ -40,6 +43,7 @@ namespace topic_statistics
 
 constexpr const char kDefaultPublishTopicName[]{"/statistics"};
 constexpr const std::chrono::milliseconds kDefaultPublishingPeriod{std::chrono::seconds(1)};
+constexpr const char kBufferDwellTimeStatName[]{"intra_process_buffer_dwell_time"};
 
 using libstatistics_collector::collector::GenerateStatisticMessage;
 using statistics_msgs::msg::MetricsMessage;
@@ -47,14 +51,15 @@ using libstatistics_collector::moving_average_statistics::StatisticData;
 
 /**
  * Class used to collect, measure, and publish topic statistics data. Current statistics
- * supported for subscribers are received message age and received message period.
+ * supported for subscribers are received message age and received message period, and
+ * the time the messages delivered intra-process wait in the buffer of the subscription.
+ *
+ * Received messages are measured without locking, in atomic accumulators, and the
+ * statistics are only computed when they are published, so that collecting them barely
+ * adds to the latency of the subscription.
   */
 class SubscriptionTopicStatistics
 {
-  using TopicStatsCollector = libstatistics_collector::TopicStatisticsCollector;
-  using ReceivedMessageAge = libstatistics_collector::ReceivedMessageAgeCollector;
-  using ReceivedMessagePeriod = libstatistics_collector::ReceivedMessagePeriodCollector;
-
 public:
   /// Construct a SubscriptionTopicStatistics object.
   /**
@@ -90,7 +95,7 @@ public:
 
   /// Handle a message received by the subscription to collect statistics.
   /**
-   * This method acquires a lock to prevent race conditions to collectors list.
+   * This method doesn't lock, it can be called concurrently from multiple threads.
    *
    * \param message_info the message info corresponding to the received message
    * \param now_nanoseconds current time in nanoseconds
@@ -99,12 +104,50 @@ public:
     const rmw_message_info_t & message_info,
     const rclcpp::Time now_nanoseconds) const
   {
-    std::lock_guard<std::mutex> lock(mutex_);
-    for (const auto & collector : subscriber_statistics_collectors_) {
-      collector->OnMessageReceived(message_info, now_nanoseconds.nanoseconds());
+    if (!started_.load(std::memory_order_relaxed)) {
+      return;
+    }
+    const int64_t now = now_nanoseconds.nanoseconds();
+
+    // The message age is unknown when the middleware doesn't set the source timestamp
+    if (now > 0 && message_info.source_timestamp > 0) {
+      received_message_age_.add(to_milliseconds(now - message_info.source_timestamp));
+    }
+
+    const int64_t last_message_received =
+      last_message_received_nanoseconds_.exchange(now, std::memory_order_relaxed);
+    // Messages handled concurrently by other threads may have been received earlier
+    if (last_message_received != kNoMessageReceived && now >= last_message_received) {
+      received_message_period_.add(to_milliseconds(now - last_message_received));
     }
   }
 
+  /// Publish the statistics of the time messages wait in the intra-process buffer.
+  /**
+   * This is called when the subscription measures it, messages delivered intra-process
+   * otherwise bypassing handle_message().
+   */
+  void enable_buffer_dwell_time()
+  {
+    buffer_dwell_time_enabled_.store(true, std::memory_order_relaxed);
+  }
+
+  /// Handle the time a message delivered intra-process waited in the buffer of the subscription.
+  /**
+   * The time is measured from when the message is added to the buffer to when the executor
+   * takes it, so that it tells the latency added by the scheduling of the executor.
+   * This method doesn't lock, it can be called concurrently from multiple threads.
+   *
+   * \param dwell_time the time the message waited in the buffer
+   */
+  virtual void handle_buffer_dwell_time(std::chrono::nanoseconds dwell_time) const
+  {
+    if (!started_.load(std::memory_order_relaxed)) {
+      return;
+    }
+    buffer_dwell_time_.add(to_milliseconds(dwell_time.count()));
+  }
+
   /// Set the timer used to publish statistics messages.
   /**
    * \param publisher_timer the timer to fire the publisher, created by the node
@@ -116,32 +159,40 @@ public:
 
   /// Publish a populated MetricsStatisticsMessage.
   /**
-   * This method acquires a lock to prevent race conditions to collectors list.
+   * The statistics of the current window are computed here, from the measurements
+   * accumulated since the last call, which are then discarded.
    */
   virtual void publish_message_and_reset_measurements()
   {
-    std::vector<MetricsMessage> msgs;
+    namespace constants = libstatistics_collector::topic_statistics_constants;
     rclcpp::Time window_end{get_current_nanoseconds_since_epoch()};
 
-    {
-      std::lock_guard<std::mutex> lock(mutex_);
-      for (auto & collector : subscriber_statistics_collectors_) {
-        const auto collected_stats = collector->GetStatisticsResults();
-        collector->ClearCurrentMeasurements();
+    const auto message_age = libstatistics_collector::collector::GenerateStatisticMessage(
+      node_name_,
+      constants::kMsgAgeStatName,
+      constants::kMillisecondUnitName,
+      window_start_,
+      window_end,
+      received_message_age_.get_and_reset());
+    const auto message_period = libstatistics_collector::collector::GenerateStatisticMessage(
+      node_name_,
+      constants::kMsgPeriodStatName,
+      constants::kMillisecondUnitName,
+      window_start_,
+      window_end,
+      received_message_period_.get_and_reset());
 
-        auto message = libstatistics_collector::collector::GenerateStatisticMessage(
+    publisher_->publish(message_age);
+    publisher_->publish(message_period);
+    if (buffer_dwell_time_enabled_.load(std::memory_order_relaxed)) {
+      publisher_->publish(
+        libstatistics_collector::collector::GenerateStatisticMessage(
           node_name_,
-          collector->GetMetricName(),
-          collector->GetMetricUnit(),
+          kBufferDwellTimeStatName,
+          constants::kMillisecondUnitName,
           window_start_,
           window_end,
-          collected_stats);
-        msgs.push_back(message);
-      }
-    }
-
-    for (auto & msg : msgs) {
-      publisher_->publish(msg);
+          buffer_dwell_time_.get_and_reset()));
     }
     window_start_ = window_end;
   }
@@ -149,55 +200,38 @@ public:
 protected:
   /// Return a vector of all the currently collected data.
   /**
-   * This method acquires a lock to prevent race conditions to collectors list.
-   *
-   * \return a vector of all the collected data
+   * \return the statistics of the received message age and of the received message period,
+   * then of the buffer dwell time if enable_buffer_dwell_time() was called
    */
   std::vector<StatisticData> get_current_collector_data() const
   {
-    std::vector<StatisticData> data;
-    std::lock_guard<std::mutex> lock(mutex_);
-    for (const auto & collector : subscriber_statistics_collectors_) {
-      data.push_back(collector->GetStatisticsResults());
+    if (buffer_dwell_time_enabled_.load(std::memory_order_relaxed)) {
+      return {received_message_age_.get(), received_message_period_.get(),
+        buffer_dwell_time_.get()};
     }
-    return data;
+    return {received_message_age_.get(), received_message_period_.get()};
   }
 
 private:
-  /// Construct and start all collectors and set window_start_.
-  /**
-   * This method acquires a lock to prevent race conditions to collectors list.
-   */
+  /// Marker of the last message received time, when no message was received yet.
+  static constexpr int64_t kNoMessageReceived = std::numeric_limits<int64_t>::min();
+
+  /// Start collecting statistics and set window_start_.
   void bring_up()
   {
-    auto received_message_age = std::make_unique<ReceivedMessageAge>();
-    received_message_age->Start();
-    subscriber_statistics_collectors_.emplace_back(std::move(received_message_age));
-
-    auto received_message_period = std::make_unique<ReceivedMessagePeriod>();
-    received_message_period->Start();
-    {
-      std::lock_guard<std::mutex> lock(mutex_);
-      subscriber_statistics_collectors_.emplace_back(std::move(received_message_period));
-    }
+    last_message_received_nanoseconds_.store(kNoMessageReceived);
+    started_.store(true);
 
     window_start_ = rclcpp::Time(get_current_nanoseconds_since_epoch());
   }
 
-  /// Stop all collectors, clear measurements, stop publishing timer, and reset publisher.
-  /**
-   * This method acquires a lock to prevent race conditions to collectors list.
-   */
+  /// Stop collecting statistics, clear measurements, stop publishing timer, and reset publisher.
   void tear_down()
   {
-    {
-      std::lock_guard<std::mutex> lock(mutex_);
-      for (auto & collector : subscriber_statistics_collectors_) {
-        collector->Stop();
-      }
-
-      subscriber_statistics_collectors_.clear();
-    }
+    started_.store(false);
+    received_message_age_.reset();
+    received_message_period_.reset();
+    buffer_dwell_time_.reset();
 
     if (publisher_timer_) {
       publisher_timer_->cancel();
@@ -217,10 +251,24 @@ private:
     return std::chrono::duration_cast<std::chrono::nanoseconds>(now.time_since_epoch()).count();
   }
 
-  /// Mutex to protect the subsequence vectors
-  mutable std::mutex mutex_;
-  /// Collection of statistics collectors
-  std::vector<std::unique_ptr<TopicStatsCollector>> subscriber_statistics_collectors_{};
+  /// Convert a duration in nanoseconds to milliseconds, the unit of the statistics.
+  static double to_milliseconds(int64_t nanoseconds)
+  {
+    return std::chrono::duration<double, std::milli>(std::chrono::nanoseconds(nanoseconds)).count();
+  }
+
+  /// Whether statistics are collected, between bring_up() and tear_down()
+  std::atomic<bool> started_{false};
+  /// Age of the received messages, in milliseconds
+  mutable MeasurementAccumulator received_message_age_;
+  /// Period between the received messages, in milliseconds
+  mutable MeasurementAccumulator received_message_period_;
+  /// Whether the buffer dwell time is measured and published
+  std::atomic<bool> buffer_dwell_time_enabled_{false};
+  /// Time the messages delivered intra-process waited in the buffer, in milliseconds
+  mutable MeasurementAccumulator buffer_dwell_time_;
+  /// Time the last message was received, in nanoseconds
+  mutable std::atomic<int64_t> last_message_received_nanoseconds_{kNoMessageReceived};
   /// Node name used to generate topic statistics messages to be published
   const std::string node_name_;
   /// Publisher, created by the node, used to publish topic statistics messages
@@ -0,0 +1,124 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__TRACING_HPP_
+#define RCLCPP__TRACING_HPP_
+
+#include <atomic>
+#include <cstdint>
+
+#include "tracetools/tracetools.h"
+
+#include "rclcpp/visibility_control.hpp"
+
+namespace rclcpp
+{
+/// Runtime selection of the tracepoints of the hot paths, per subsystem.
+/**
+ * The tracepoints called for each message or callback are guarded by a mask of the enabled
+ * subsystems, so that a binary built with tracing support only pays for a relaxed load and a
+ * branch predicted as not taken when a subsystem is disabled, rather than for the check of
+ * the tracer on every message.
+ *
+ * All the subsystems are enabled by default, the tracer then deciding as before whether the
+ * events are recorded.
+ * The tracepoints called once, e.g. when an entity is created, are never masked, since the
+ * events of the hot paths can't be analyzed without them.
+ */
+namespace tracing
+{
+
+/// Subsystems whose tracepoints can be enabled or disabled at runtime.
+enum class Subsystem : uint32_t
+{
+  /// Waiting for work and executing it, in the executors.
+  Executor = 1u << 0,
+  /// Publishing messages.
+  Publisher = 1u << 1,
+  /// Taking messages from the middleware.
+  Subscription = 1u << 2,
+  /// Intra-process buffers.
+  IntraProcess = 1u << 3,
+  /// Start and end of the subscription, service and timer callbacks.
+  Callback = 1u << 4,
+  All = 0xffffffffu,
+};
+
+namespace detail
+{
+
+/// Mask of the enabled subsystems, only to be used through is_enabled().
+RCLCPP_PUBLIC
+extern std::atomic<uint32_t> enabled_subsystems;
+
+}  // namespace detail
+
+/// Return true if the tracepoints of the subsystem are enabled.
+inline bool
+is_enabled(Subsystem subsystem) noexcept
+{
+  return 0u != (
+    detail::enabled_subsystems.load(std::memory_order_relaxed) &
+    static_cast<uint32_t>(subsystem));
+}
+
+/// Get the mask of the enabled subsystems.
+RCLCPP_PUBLIC
+uint32_t
+get_enabled_subsystems() noexcept;
+
+/// Set the mask of the enabled subsystems, a bitwise or of Subsystem values.
+RCLCPP_PUBLIC
+void
+set_enabled_subsystems(uint32_t mask) noexcept;
+
+/// Enable the tracepoints of a subsystem, keeping the other subsystems as they are.
+RCLCPP_PUBLIC
+void
+enable(Subsystem subsystem) noexcept;
+
+/// Disable the tracepoints of a subsystem, keeping the other subsystems as they are.
+RCLCPP_PUBLIC
+void
+disable(Subsystem subsystem) noexcept;
+
+}  // namespace tracing
+}  // namespace rclcpp
+
+#if defined(__GNUC__) || defined(__clang__)
+#define RCLCPP_TRACING_UNLIKELY(condition) __builtin_expect(!!(condition), 0)
+#else
+#define RCLCPP_TRACING_UNLIKELY(condition) (condition)
+#endif
+
+#ifndef TRACETOOLS_DISABLED
+/// Call a tracepoint of tracetools if its rclcpp subsystem is enabled.
+/**
+ * \param subsystem the name of a value of rclcpp::tracing::Subsystem
+ * \param ... the name of the tracepoint followed by its arguments, as for
+ *   TRACETOOLS_TRACEPOINT()
+ */
+#define RCLCPP_TRACEPOINT(subsystem, ...) \
+  do { \
+    if (RCLCPP_TRACING_UNLIKELY( \
+        rclcpp::tracing::is_enabled(rclcpp::tracing::Subsystem::subsystem))) \
+    { \
+      TRACETOOLS_TRACEPOINT(__VA_ARGS__); \
+    } \
+  } while (0)
+#else
+#define RCLCPP_TRACEPOINT(subsystem, ...) ((void) (0))
+#endif
+
+#endif  // RCLCPP__TRACING_HPP_
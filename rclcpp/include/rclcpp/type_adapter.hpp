@@ -16,10 +16,13 @@
 #define RCLCPP__TYPE_ADAPTER_HPP_
 
 #include <type_traits>
+#include <utility>
 
 namespace rclcpp
 {
 
+class SerializedMessage;
+
 /// Template structure used to adapt custom, user-defined types to ROS types.
 /**
  * Adapting a custom, user-defined type to a ROS type allows that custom type
@@ -38,6 +41,16 @@ namespace rclcpp
  *
  * The convert functions must convert from one type to the other.
  *
+ * The specialization may also provide a static function serializing the custom type
+ * directly, as the ROS type would be serialized by the middleware:
+ *
+ *   - static void serialize_to(const custom_type &, rclcpp::SerializedMessage &)
+ *
+ * Publishers then use it for inter-process publications, instead of converting the custom
+ * type to a temporary ROS message which is serialized afterwards, which saves a copy of
+ * large messages like images.
+ * Intra-process publications still use convert_to_ros_message() when they need a ROS message.
+ *
  * For example, here is a theoretical example for adapting `std::string` to the
  * `std_msgs::msg::String` ROS message type:
  *
@@ -128,6 +141,17 @@ struct assert_type_pair_is_specialized_type_adapter
     "No type adapter for this custom type/ros message type pair");
 };
 
+/// Helper template to determine if a TypeAdapter serializes its custom type directly.
+template<typename TypeAdapterT, typename = void>
+struct has_serialize_to : std::false_type {};
+
+template<typename TypeAdapterT>
+struct has_serialize_to<
+  TypeAdapterT,
+  std::void_t<decltype(TypeAdapterT::serialize_to(
+    std::declval<const typename TypeAdapterT::custom_type &>(),
+    std::declval<rclcpp::SerializedMessage &>()))>>: std::true_type {};
+
 }  // namespace detail
 
 /// Template metafunction that can make the type being adapted explicit.
@@ -30,6 +30,11 @@ namespace rclcpp
 {
 /// Load the type support library for the given type.
 /**
+ * The libraries are cached process-wide: while a library returned for a package and type
+ * support identifier is in use, it's returned again without searching or loading it.
+ * The type support handles extracted from a cached library are cached too.
+ * This function is thread-safe.
+ *
  * \param[in] type The topic type, e.g. "std_msgs/msg/String"
  * \param[in] typesupport_identifier Type support identifier, typically "rosidl_typesupport_cpp"
  * \return A shared library
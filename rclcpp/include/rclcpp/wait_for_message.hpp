@@ -15,21 +15,148 @@
 #ifndef RCLCPP__WAIT_FOR_MESSAGE_HPP_
 #define RCLCPP__WAIT_FOR_MESSAGE_HPP_
 
+#include <algorithm>
+#include <chrono>
 #include <memory>
 #include <string>
+#include <vector>
 
-#include "rcpputils/scope_exit.hpp"
-
+#include "rclcpp/macros.hpp"
 #include "rclcpp/node.hpp"
 #include "rclcpp/visibility_control.hpp"
 #include "rclcpp/wait_set.hpp"
 
 namespace rclcpp
 {
+/// Wait for the messages of a subscription, reusing the same wait set for every wait.
+/**
+ * The wait set, holding the subscription and a guard condition triggered on shutdown, is
+ * built once when the waiter is constructed, rather than on each wait, so that a waiter can
+ * be kept to wait for messages repeatedly without allocating.
+ *
+ * The subscription shouldn't be used by an executor while it is waited for, which could take
+ * the messages first.
+ * A waiter isn't thread-safe, each thread waiting for messages should use its own.
+ */
+template<class MsgT>
+class MessageWaiter
+{
+public:
+  RCLCPP_SMART_PTR_DEFINITIONS_NOT_COPYABLE(MessageWaiter)
+
+  /// Construct a waiter for the messages of a subscription.
+  /**
+   * \param[in] subscription shared pointer to a previously initialized subscription.
+   * \param[in] context shared pointer to a context to watch for SIGINT requests.
+   */
+  MessageWaiter(
+    std::shared_ptr<rclcpp::Subscription<MsgT>> subscription,
+    rclcpp::Context::SharedPtr context)
+  : subscription_(subscription),
+    context_(context),
+    shutdown_guard_condition_(std::make_shared<rclcpp::GuardCondition>(context)),
+    wait_set_({{{subscription}}}, {shutdown_guard_condition_}, {}, {}, {}, {}, context)
+  {
+    context_->add_shutdown_guard_condition(shutdown_guard_condition_);
+  }
+
+  ~MessageWaiter()
+  {
+    context_->remove_shutdown_guard_condition(shutdown_guard_condition_.get());
+  }
+
+  /// Wait for the next incoming message.
+  /**
+   * \param[out] out is the message to be filled when a new message is arriving.
+   * \param[in] time_to_wait parameter specifying the timeout before returning.
+   * \return true if a message was successfully received, false if message could not
+   * be obtained or shutdown was triggered asynchronously on the context.
+   */
+  template<class Rep = int64_t, class Period = std::milli>
+  bool
+  wait_for_message(
+    MsgT & out,
+    std::chrono::duration<Rep, Period> time_to_wait = std::chrono::duration<Rep, Period>(-1))
+  {
+    if (!wait_until_ready(time_to_wait)) {
+      return false;
+    }
+    rclcpp::MessageInfo info;
+    return subscription_->take(out, info);
+  }
+
+  /// Wait for the next incoming messages, until enough of them are received.
+  /**
+   * The messages already received by the subscription are taken without waiting.
+   *
+   * \param[out] out the vector to which the received messages are appended.
+   * \param[in] count the number of messages to receive.
+   * \param[in] time_to_wait parameter specifying the timeout for all the messages.
+   * \return the number of messages appended to `out`, less than `count` if the timeout
+   * expired or shutdown was triggered asynchronously on the context.
+   */
+  template<class Rep = int64_t, class Period = std::milli>
+  size_t
+  wait_for_messages(
+    std::vector<MsgT> & out,
+    size_t count,
+    std::chrono::duration<Rep, Period> time_to_wait = std::chrono::duration<Rep, Period>(-1))
+  {
+    const auto timeout = std::chrono::duration_cast<std::chrono::nanoseconds>(time_to_wait);
+    const auto start = std::chrono::steady_clock::now();
+    size_t received = 0;
+    rclcpp::MessageInfo info;
+    while (received < count) {
+      // A negative timeout waits forever, else each wait gets the time left
+      std::chrono::nanoseconds time_left = timeout;
+      if (timeout >= std::chrono::nanoseconds::zero()) {
+        time_left = std::max(
+          std::chrono::nanoseconds::zero(), timeout - (std::chrono::steady_clock::now() - start));
+      }
+      if (!wait_until_ready(time_left)) {
+        break;
+      }
+      // Take all the messages available, without waiting again between them
+      while (received < count) {
+        out.emplace_back();
+        if (!subscription_->take(out.back(), info)) {
+          out.pop_back();
+          break;
+        }
+        received++;
+      }
+    }
+    return received;
+  }
+
+private:
+  RCLCPP_DISABLE_COPY(MessageWaiter)
+
+  /// Wait for the subscription to be ready, return false on timeout or shutdown.
+  bool
+  wait_until_ready(std::chrono::nanoseconds time_to_wait)
+  {
+    if (!rclcpp::ok(context_)) {
+      return false;
+    }
+    auto ret = wait_set_.wait(time_to_wait);
+    if (ret.kind() != rclcpp::WaitResultKind::Ready) {
+      return false;
+    }
+    return !wait_set_.get_rcl_wait_set().guard_conditions[0];
+  }
+
+  std::shared_ptr<rclcpp::Subscription<MsgT>> subscription_;
+  rclcpp::Context::SharedPtr context_;
+  rclcpp::GuardCondition::SharedPtr shutdown_guard_condition_;
+  rclcpp::StaticWaitSet<1, 1, 0, 0, 0, 0> wait_set_;
+};
+
 /// Wait for the next incoming message.
 /**
  * Given an already initialized subscription,
  * wait for the next incoming message to arrive before the specified timeout.
+ * To wait for messages repeatedly, a MessageWaiter should be kept instead.
  *
  * \param[out] out is the message to be filled when a new message is arriving.
  * \param[in] subscription shared pointer to a previously initialized subscription.
@@ -45,34 +172,8 @@ bool wait_for_message(
   std::shared_ptr<rclcpp::Context> context,
   std::chrono::duration<Rep, Period> time_to_wait = std::chrono::duration<Rep, Period>(-1))
 {
-  auto gc = std::make_shared<rclcpp::GuardCondition>(context);
-  auto shutdown_callback_handle = context->add_on_shutdown_callback(
-    [weak_gc = std::weak_ptr<rclcpp::GuardCondition>{gc}]() {
-      auto strong_gc = weak_gc.lock();
-      if (strong_gc) {
-        strong_gc->trigger();
-      }
-    });
-
-  rclcpp::WaitSet wait_set;
-  wait_set.add_subscription(subscription);
-  RCPPUTILS_SCOPE_EXIT(wait_set.remove_subscription(subscription); );
-  wait_set.add_guard_condition(gc);
-  auto ret = wait_set.wait(time_to_wait);
-  if (ret.kind() != rclcpp::WaitResultKind::Ready) {
-    return false;
-  }
-
-  if (wait_set.get_rcl_wait_set().guard_conditions[0]) {
-    return false;
-  }
-
-  rclcpp::MessageInfo info;
-  if (!subscription->take(out, info)) {
-    return false;
-  }
-
-  return true;
+  MessageWaiter<MsgT> waiter(subscription, context);
+  return waiter.wait_for_message(out, time_to_wait);
 }
 
 /// Wait for the next incoming message.
@@ -17,7 +17,10 @@
 
 #include <cassert>
 #include <functional>
+#include <optional>
 #include <stdexcept>
+#include <utility>
+#include <vector>
 
 #include "rcl/wait.h"
 
@@ -27,6 +30,17 @@
 namespace rclcpp
 {
 
+/// Indices of the entities which are ready in an rcl wait set, for each kind of entity.
+struct ReadyEntityIndices
+{
+  std::vector<size_t> subscriptions;
+  std::vector<size_t> guard_conditions;
+  std::vector<size_t> timers;
+  std::vector<size_t> clients;
+  std::vector<size_t> services;
+  std::vector<size_t> events;
+};
+
 // TODO(wjwwood): the union-like design of this class could be replaced with
 //   std::variant, when we have access to that...
 /// Interface for introspecting a wait set after waiting on it.
@@ -122,9 +136,29 @@ public:
     return *wait_set_pointer_;
   }
 
+  /// Return the indices of the ready entities in the rcl wait set.
+  /**
+   * The rcl wait set is scanned once, on the first call, so that the ready entities can then
+   * be dispatched without going over all the entities of the wait set again.
+   *
+   * \return the indices of the ready entities, e.g. in the subscriptions of the rcl wait set.
+   * \throws std::runtime_error if the result was not ready
+   */
+  const ReadyEntityIndices &
+  get_ready_indices() const
+  {
+    const WaitSetT & wait_set = this->get_wait_set();
+    if (!ready_indices_) {
+      ready_indices_.emplace();
+      wait_set.get_ready_indices(*ready_indices_);
+    }
+    return *ready_indices_;
+  }
+
   WaitResult(WaitResult && other) noexcept
   : wait_result_kind_(other.wait_result_kind_),
-    wait_set_pointer_(std::exchange(other.wait_set_pointer_, nullptr))
+    wait_set_pointer_(std::exchange(other.wait_set_pointer_, nullptr)),
+    ready_indices_(std::move(other.ready_indices_))
   {}
 
   ~WaitResult()
@@ -157,6 +191,8 @@ private:
   const WaitResultKind wait_result_kind_;
 
   WaitSetT * wait_set_pointer_ = nullptr;
+
+  mutable std::optional<ReadyEntityIndices> ready_indices_;
 };
 
 }  // namespace rclcpp
@@ -18,6 +18,7 @@
 #include <memory>
 #include <stdexcept>
 #include <utility>
+#include <vector>
 
 #include "rcl/wait.h"
 
@@ -25,6 +26,7 @@
 #include "rclcpp/logging.hpp"
 #include "rclcpp/macros.hpp"
 #include "rclcpp/visibility_control.hpp"
+#include "rclcpp/wait_result.hpp"
 #include "rclcpp/waitable.hpp"
 
 namespace rclcpp
@@ -283,6 +285,7 @@ protected:
             needs_pruning_ = true;
             continue;
           }
+          guard_condition_ptr_pair.second->prepare_for_wait();
           rcl_ret_t ret = rcl_wait_set_add_guard_condition(
             &rcl_wait_set_,
             &guard_condition_ptr_pair.second->get_rcl_guard_condition(),
@@ -387,6 +390,29 @@ protected:
     }
   }
 
+  /// Collect the indices of the ready entities in the rcl wait set, in a single pass.
+  void
+  storage_get_ready_indices(rclcpp::ReadyEntityIndices & indices) const
+  {
+    auto collect =
+      [](auto entities, size_t size, std::vector<size_t> & ready) {
+        for (size_t i = 0; i < size; ++i) {
+          if (nullptr != entities[i]) {
+            ready.push_back(i);
+          }
+        }
+      };
+    collect(
+      rcl_wait_set_.subscriptions, rcl_wait_set_.size_of_subscriptions, indices.subscriptions);
+    collect(
+      rcl_wait_set_.guard_conditions, rcl_wait_set_.size_of_guard_conditions,
+      indices.guard_conditions);
+    collect(rcl_wait_set_.timers, rcl_wait_set_.size_of_timers, indices.timers);
+    collect(rcl_wait_set_.clients, rcl_wait_set_.size_of_clients, indices.clients);
+    collect(rcl_wait_set_.services, rcl_wait_set_.size_of_services, indices.services);
+    collect(rcl_wait_set_.events, rcl_wait_set_.size_of_events, indices.events);
+  }
+
   const rcl_wait_set_t &
   storage_get_rcl_wait_set() const
   {
@@ -234,6 +234,20 @@ protected:
     prune_deleted_entities_function();
   }
 
+  /// Begin a batch of modifications, which is a no-op since there is no lock to hold.
+  void
+  sync_begin_modifications()
+  {
+    // Explicitly no thread synchronization.
+  }
+
+  /// Commit a batch of modifications, which is a no-op since there is no lock to release.
+  void
+  sync_commit_modifications()
+  {
+    // Explicitly no thread synchronization.
+  }
+
   /// Implements wait without any thread-safety.
   template<class WaitResultT>
   WaitResultT
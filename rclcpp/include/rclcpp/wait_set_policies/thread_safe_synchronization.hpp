@@ -15,9 +15,13 @@
 #ifndef RCLCPP__WAIT_SET_POLICIES__THREAD_SAFE_SYNCHRONIZATION_HPP_
 #define RCLCPP__WAIT_SET_POLICIES__THREAD_SAFE_SYNCHRONIZATION_HPP_
 
+#include <atomic>
 #include <chrono>
 #include <functional>
 #include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
 #include <utility>
 
 #include "rclcpp/client.hpp"
@@ -94,6 +98,49 @@ protected:
     extra_guard_conditions_[0]->trigger();
   }
 
+  /// Begin a batch of modifications, holding the write lock until they are committed.
+  /**
+   * The waiting wait set is interrupted once, when the lock is acquired, and the rcl wait set
+   * is rebuilt once the modifications are committed, instead of for each of them.
+   *
+   * \throws std::runtime_error if this thread already began modifications.
+   */
+  void
+  sync_begin_modifications()
+  {
+    if (modifying_thread_.load() == std::this_thread::get_id()) {
+      throw std::runtime_error("modifications of the wait set were already begun");
+    }
+    wprw_lock_.get_write_mutex().lock();
+    modifying_thread_.store(std::this_thread::get_id());
+  }
+
+  /// Commit the modifications begun by this thread, releasing the write lock.
+  /**
+   * \throws std::runtime_error if this thread didn't begin modifications.
+   */
+  void
+  sync_commit_modifications()
+  {
+    if (modifying_thread_.load() != std::this_thread::get_id()) {
+      throw std::runtime_error("modifications of the wait set weren't begun by this thread");
+    }
+    modifying_thread_.store(std::thread::id());
+    wprw_lock_.get_write_mutex().unlock();
+  }
+
+  /// Acquire the write lock, unless this thread holds it for a batch of modifications.
+  std::unique_lock<detail::WritePreferringReadWriteLock::WriteMutex>
+  lock_for_modification()
+  {
+    if (modifying_thread_.load() == std::this_thread::get_id()) {
+      return std::unique_lock<detail::WritePreferringReadWriteLock::WriteMutex>(
+        wprw_lock_.get_write_mutex(), std::defer_lock);
+    }
+    return std::unique_lock<detail::WritePreferringReadWriteLock::WriteMutex>(
+      wprw_lock_.get_write_mutex());
+  }
+
   /// Add subscription.
   void
   sync_add_subscription(
@@ -103,8 +150,7 @@ protected:
       void(std::shared_ptr<rclcpp::SubscriptionBase>&&, const rclcpp::SubscriptionWaitSetMask &)
     > add_subscription_function)
   {
-    using rclcpp::wait_set_policies::detail::WritePreferringReadWriteLock;
-    std::lock_guard<WritePreferringReadWriteLock::WriteMutex> lock(wprw_lock_.get_write_mutex());
+    auto lock = this->lock_for_modification();
     add_subscription_function(std::move(subscription), mask);
   }
 
@@ -117,8 +163,7 @@ protected:
       void(std::shared_ptr<rclcpp::SubscriptionBase>&&, const rclcpp::SubscriptionWaitSetMask &)
     > remove_subscription_function)
   {
-    using rclcpp::wait_set_policies::detail::WritePreferringReadWriteLock;
-    std::lock_guard<WritePreferringReadWriteLock::WriteMutex> lock(wprw_lock_.get_write_mutex());
+    auto lock = this->lock_for_modification();
     remove_subscription_function(std::move(subscription), mask);
   }
 
@@ -128,8 +173,7 @@ protected:
     std::shared_ptr<rclcpp::GuardCondition> && guard_condition,
     std::function<void(std::shared_ptr<rclcpp::GuardCondition>&&)> add_guard_condition_function)
   {
-    using rclcpp::wait_set_policies::detail::WritePreferringReadWriteLock;
-    std::lock_guard<WritePreferringReadWriteLock::WriteMutex> lock(wprw_lock_.get_write_mutex());
+    auto lock = this->lock_for_modification();
     add_guard_condition_function(std::move(guard_condition));
   }
 
@@ -139,8 +183,7 @@ protected:
     std::shared_ptr<rclcpp::GuardCondition> && guard_condition,
     std::function<void(std::shared_ptr<rclcpp::GuardCondition>&&)> remove_guard_condition_function)
   {
-    using rclcpp::wait_set_policies::detail::WritePreferringReadWriteLock;
-    std::lock_guard<WritePreferringReadWriteLock::WriteMutex> lock(wprw_lock_.get_write_mutex());
+    auto lock = this->lock_for_modification();
     remove_guard_condition_function(std::move(guard_condition));
   }
 
@@ -150,8 +193,7 @@ protected:
     std::shared_ptr<rclcpp::TimerBase> && timer,
     std::function<void(std::shared_ptr<rclcpp::TimerBase>&&)> add_timer_function)
   {
-    using rclcpp::wait_set_policies::detail::WritePreferringReadWriteLock;
-    std::lock_guard<WritePreferringReadWriteLock::WriteMutex> lock(wprw_lock_.get_write_mutex());
+    auto lock = this->lock_for_modification();
     add_timer_function(std::move(timer));
   }
 
@@ -161,8 +203,7 @@ protected:
     std::shared_ptr<rclcpp::TimerBase> && timer,
     std::function<void(std::shared_ptr<rclcpp::TimerBase>&&)> remove_timer_function)
   {
-    using rclcpp::wait_set_policies::detail::WritePreferringReadWriteLock;
-    std::lock_guard<WritePreferringReadWriteLock::WriteMutex> lock(wprw_lock_.get_write_mutex());
+    auto lock = this->lock_for_modification();
     remove_timer_function(std::move(timer));
   }
 
@@ -172,8 +213,7 @@ protected:
     std::shared_ptr<rclcpp::ClientBase> && client,
     std::function<void(std::shared_ptr<rclcpp::ClientBase>&&)> add_client_function)
   {
-    using rclcpp::wait_set_policies::detail::WritePreferringReadWriteLock;
-    std::lock_guard<WritePreferringReadWriteLock::WriteMutex> lock(wprw_lock_.get_write_mutex());
+    auto lock = this->lock_for_modification();
     add_client_function(std::move(client));
   }
 
@@ -183,8 +223,7 @@ protected:
     std::shared_ptr<rclcpp::ClientBase> && client,
     std::function<void(std::shared_ptr<rclcpp::ClientBase>&&)> remove_client_function)
   {
-    using rclcpp::wait_set_policies::detail::WritePreferringReadWriteLock;
-    std::lock_guard<WritePreferringReadWriteLock::WriteMutex> lock(wprw_lock_.get_write_mutex());
+    auto lock = this->lock_for_modification();
     remove_client_function(std::move(client));
   }
 
@@ -194,8 +233,7 @@ protected:
     std::shared_ptr<rclcpp::ServiceBase> && service,
     std::function<void(std::shared_ptr<rclcpp::ServiceBase>&&)> add_service_function)
   {
-    using rclcpp::wait_set_policies::detail::WritePreferringReadWriteLock;
-    std::lock_guard<WritePreferringReadWriteLock::WriteMutex> lock(wprw_lock_.get_write_mutex());
+    auto lock = this->lock_for_modification();
     add_service_function(std::move(service));
   }
 
@@ -205,8 +243,7 @@ protected:
     std::shared_ptr<rclcpp::ServiceBase> && service,
     std::function<void(std::shared_ptr<rclcpp::ServiceBase>&&)> remove_service_function)
   {
-    using rclcpp::wait_set_policies::detail::WritePreferringReadWriteLock;
-    std::lock_guard<WritePreferringReadWriteLock::WriteMutex> lock(wprw_lock_.get_write_mutex());
+    auto lock = this->lock_for_modification();
     remove_service_function(std::move(service));
   }
 
@@ -219,8 +256,7 @@ protected:
       void(std::shared_ptr<rclcpp::Waitable>&&, std::shared_ptr<void> &&)
     > add_waitable_function)
   {
-    using rclcpp::wait_set_policies::detail::WritePreferringReadWriteLock;
-    std::lock_guard<WritePreferringReadWriteLock::WriteMutex> lock(wprw_lock_.get_write_mutex());
+    auto lock = this->lock_for_modification();
     add_waitable_function(std::move(waitable), std::move(associated_entity));
   }
 
@@ -230,8 +266,7 @@ protected:
     std::shared_ptr<rclcpp::Waitable> && waitable,
     std::function<void(std::shared_ptr<rclcpp::Waitable>&&)> remove_waitable_function)
   {
-    using rclcpp::wait_set_policies::detail::WritePreferringReadWriteLock;
-    std::lock_guard<WritePreferringReadWriteLock::WriteMutex> lock(wprw_lock_.get_write_mutex());
+    auto lock = this->lock_for_modification();
     remove_waitable_function(std::move(waitable));
   }
 
@@ -239,8 +274,7 @@ protected:
   void
   sync_prune_deleted_entities(std::function<void()> prune_deleted_entities_function)
   {
-    using rclcpp::wait_set_policies::detail::WritePreferringReadWriteLock;
-    std::lock_guard<WritePreferringReadWriteLock::WriteMutex> lock(wprw_lock_.get_write_mutex());
+    auto lock = this->lock_for_modification();
     prune_deleted_entities_function();
   }
 
@@ -262,6 +296,11 @@ protected:
     // which calls this function, by acquiring shared ownership of the entites
     // for the duration of this function.
 
+    if (modifying_thread_.load() == std::this_thread::get_id()) {
+      // The read lock could never be acquired
+      throw std::runtime_error("cannot wait before committing the modifications of the wait set");
+    }
+
     // Setup looping predicate.
     auto start = std::chrono::steady_clock::now();
     std::function<bool()> should_loop = this->create_loop_predicate(time_to_wait_ns, start);
@@ -371,6 +410,8 @@ protected:
 protected:
   std::array<std::shared_ptr<rclcpp::GuardCondition>, 1> extra_guard_conditions_;
   rclcpp::wait_set_policies::detail::WritePreferringReadWriteLock wprw_lock_;
+  // Thread holding the write lock for a batch of modifications, if any
+  std::atomic<std::thread::id> modifying_thread_{std::thread::id()};
 };
 
 }  // namespace wait_set_policies
@@ -609,6 +609,34 @@ public:
       });
   }
 
+  /// Begin a batch of modifications of the wait set, ended by commit_modifications().
+  /**
+   * Adding and removing entities between these calls is equivalent to doing it separately,
+   * but with the ThreadSafeSynchronization policy, a waiting wait() is interrupted once for
+   * the entire batch, and doesn't wait again until the modifications are committed.
+   * The thread beginning the modifications must commit them, and can't wait or hold a
+   * WaitResult in the meantime, since other threads waiting are blocked until then.
+   *
+   * \throws exceptions based on the policies used.
+   */
+  void
+  begin_modifications()
+  {
+    // this method comes from the SynchronizationPolicy
+    this->sync_begin_modifications();
+  }
+
+  /// Commit the modifications begun with begin_modifications().
+  /**
+   * \throws exceptions based on the policies used.
+   */
+  void
+  commit_modifications()
+  {
+    // this method comes from the SynchronizationPolicy
+    this->sync_commit_modifications();
+  }
+
   /// Wait for any of the entities in the wait set to be ready, or a period of time to pass.
   /**
    * This function will return when either one of the entities within this wait
@@ -740,6 +768,14 @@ private:
     this->sync_wait_result_release();
   }
 
+  /// Called by the WaitResult to get the indices of the ready entities.
+  void
+  get_ready_indices(ReadyEntityIndices & indices) const
+  {
+    // this method comes from the StoragePolicy
+    this->storage_get_ready_indices(indices);
+  }
+
   bool wait_result_holding_ = false;
 };
 
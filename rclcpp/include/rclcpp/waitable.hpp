@@ -27,8 +27,12 @@
 namespace rclcpp
 {
 
+class CallbackGroup;
+
 class Waitable
 {
+  friend class rclcpp::CallbackGroup;
+
 public:
   RCLCPP_SMART_PTR_DEFINITIONS_NOT_COPYABLE(Waitable)
 
@@ -258,8 +262,23 @@ public:
   void
   clear_on_ready_callback();
 
+  /// Get the callback group the waitable was added to.
+  /**
+   * The callback group keeps a weak pointer to the waitable, and the waitable a weak pointer
+   * back to the last callback group it was added to, so that executors find the group of the
+   * waitable without searching all the groups.
+   *
+   * \return the callback group, or nullptr if none or if it was destroyed
+   */
+  RCLCPP_PUBLIC
+  std::shared_ptr<rclcpp::CallbackGroup>
+  get_callback_group() const;
+
 private:
   std::atomic<bool> in_use_by_wait_set_{false};
+
+  // Set by the callback group when the waitable is added to it
+  std::weak_ptr<rclcpp::CallbackGroup> callback_group_;
 };  // class Waitable
 
 }  // namespace rclcpp
@@ -0,0 +1,58 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__WARM_UP_OPTIONS_HPP_
+#define RCLCPP__WARM_UP_OPTIONS_HPP_
+
+#include <cstddef>
+
+namespace rclcpp
+{
+
+/// Options of Executor::warm_up(), preparing an executor to spin without page faults.
+/**
+ * Everything but the collection of the entities is disabled by default.
+ */
+struct WarmUpOptions
+{
+  /// Size of the stack touched by the thread calling warm_up() and by the executor threads.
+  /**
+   * The pages of the stack are faulted in once, so that the callbacks don't page fault when
+   * they use up to this much stack.
+   * Not supported on platforms other than Linux if not 0.
+   */
+  size_t stack_prefault_size = 0;
+
+  /// Size of the heap allocated, touched and released so that later allocations reuse it.
+  /**
+   * The heap isn't trimmed and large allocations aren't mapped separately anymore afterwards,
+   * as the released memory would be given back to the system otherwise.
+   * Only supported with glibc if not 0.
+   */
+  size_t heap_prefault_size = 0;
+
+  /// Whether to lock all the current and future pages of the process in memory (mlockall()).
+  /**
+   * This usually requires the CAP_IPC_LOCK capability or a large enough RLIMIT_MEMLOCK.
+   * Only supported on Linux.
+   */
+  bool lock_memory = false;
+
+  /// Whether to enter steady state once warmed up, see allocation_tracking::enter_steady_state().
+  bool enter_steady_state = false;
+};
+
+}  // namespace rclcpp
+
+#endif  // RCLCPP__WARM_UP_OPTIONS_HPP_
@@ -70,7 +70,8 @@ stream_arg = 'stream_arg'
 for combinations, feature in list(rclcpp_feature_combinations.items()):
     combinations = ('stream', ) + combinations
     feature = deepcopy(feature)
-    feature.params[stream_arg] = 'The argument << into a stringstream'
+    feature.params[stream_arg] = (
+        'The argument << into a stringstream, only evaluated if the message is logged')
     rclcpp_feature_combinations[combinations] = feature
 
 def get_rclcpp_suffix_from_features(features):
@@ -139,10 +140,6 @@ def get_rclcpp_suffix_from_features(features):
         return RCUTILS_RET_OK; \
     }; \
 @[ end if] \
-@[ if 'stream' in feature_combination]@
-    std::stringstream rclcpp_stream_ss_; \
-    rclcpp_stream_ss_ << @(stream_arg); \
-@[ end if]@
     RCUTILS_LOG_@(severity)@(get_suffix_from_features(feature_combination))_NAMED( \
 @{params = ['get_time_point' if p == 'clock' and 'throttle' in feature_combination else p for p in params]}@
 @[ if params]@
@@ -152,7 +149,12 @@ def get_rclcpp_suffix_from_features(features):
 @[ if 'stream' not in feature_combination]@
       __VA_ARGS__); \
 @[ else]@
-      "%s", rclcpp_stream_ss_.str().c_str()); \
+      "%s", \
+      [&]() { \
+        std::stringstream rclcpp_stream_ss_; \
+        rclcpp_stream_ss_ << @(stream_arg); \
+        return rclcpp_stream_ss_.str(); \
+      } ().c_str()); \
 @[ end if]@
   } while (0)
 
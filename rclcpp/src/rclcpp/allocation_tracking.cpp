@@ -0,0 +1,88 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rclcpp/allocation_tracking.hpp"
+
+#include <atomic>
+#include <stdexcept>
+
+namespace
+{
+
+// Plain thread local integers, so that counting neither allocates nor needs initialization
+thread_local uint64_t thread_allocation_count = 0;
+thread_local uint64_t thread_allocated_bytes = 0;
+
+std::atomic_bool tracking_enabled{false};
+std::atomic_bool steady_state{false};
+
+}  // namespace
+
+namespace rclcpp
+{
+namespace allocation_tracking
+{
+
+void
+record_allocation(size_t size) noexcept
+{
+  ++thread_allocation_count;
+  thread_allocated_bytes += size;
+  if (!tracking_enabled.load(std::memory_order_relaxed)) {
+    tracking_enabled.store(true, std::memory_order_relaxed);
+  }
+}
+
+bool
+is_enabled() noexcept
+{
+  return tracking_enabled.load(std::memory_order_relaxed);
+}
+
+uint64_t
+get_thread_allocation_count() noexcept
+{
+  return thread_allocation_count;
+}
+
+uint64_t
+get_thread_allocated_bytes() noexcept
+{
+  return thread_allocated_bytes;
+}
+
+void
+enter_steady_state()
+{
+  if (!is_enabled()) {
+    throw std::runtime_error(
+            "allocations aren't counted, RCLCPP_TRACK_ALLOCATIONS() must be used in the program");
+  }
+  steady_state.store(true);
+}
+
+void
+exit_steady_state() noexcept
+{
+  steady_state.store(false);
+}
+
+bool
+is_steady_state() noexcept
+{
+  return steady_state.load(std::memory_order_relaxed);
+}
+
+}  // namespace allocation_tracking
+}  // namespace rclcpp
@@ -31,6 +31,24 @@ AnyExecutable::~AnyExecutable()
   // their callback groups reset. This can happen when an executor is canceled
   // between taking an AnyExecutable and executing it.
   if (callback_group) {
-    callback_group->can_be_taken_from().store(true);
+    callback_group->finish_callback(get_entity());
   }
 }
+
+const void *
+AnyExecutable::get_entity() const
+{
+  if (subscription) {
+    return subscription.get();
+  }
+  if (timer) {
+    return timer.get();
+  }
+  if (service) {
+    return service.get();
+  }
+  if (client) {
+    return client.get();
+  }
+  return waitable.get();
+}
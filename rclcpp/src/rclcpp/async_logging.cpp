@@ -0,0 +1,238 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <condition_variable>
+#include <cstdarg>
+#include <cstdio>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+
+#include "rcl/logging.h"
+#include "rcutils/logging.h"
+#include "rcutils/time.h"
+
+#include "./async_logging.hpp"
+#include "./logging_mutex.hpp"
+
+namespace
+{
+
+struct LogMessage
+{
+  bool has_location;
+  std::string function_name;
+  std::string file_name;
+  size_t line_number;
+  int severity;
+  std::string name;
+  rcutils_time_point_value_t timestamp;
+  std::string message;
+};
+
+void
+output_log_message(
+  const rcutils_log_location_t * location,
+  int severity, const char * name, rcutils_time_point_value_t timestamp,
+  const char * format, ...)
+{
+  va_list args;
+  va_start(args, format);
+  rcl_logging_multiple_output_handler(location, severity, name, timestamp, format, &args);
+  va_end(args);
+}
+
+class AsyncLogSink
+{
+public:
+  AsyncLogSink(size_t queue_size, rclcpp::LogQueueOverflowPolicy overflow_policy)
+  : queue_size_(queue_size), overflow_policy_(overflow_policy),
+    logging_mutex_(get_global_logging_mutex())
+  {
+    thread_ = std::thread([this]() {this->run();});
+  }
+
+  ~AsyncLogSink()
+  {
+    this->stop();
+  }
+
+  /// Queue the message, return false if it must be output in the calling thread.
+  bool
+  push(LogMessage && message)
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (stopping_) {
+        return false;
+      }
+      if (queue_.size() < queue_size_) {
+        queue_.push_back(std::move(message));
+      } else if (rclcpp::LogQueueOverflowPolicy::DropOldest == overflow_policy_) {
+        queue_.pop_front();
+        queue_.push_back(std::move(message));
+        ++dropped_;
+      } else if (rclcpp::LogQueueOverflowPolicy::DropNewest == overflow_policy_) {
+        ++dropped_;
+      } else {
+        return false;
+      }
+    }
+    condition_variable_.notify_one();
+    return true;
+  }
+
+  /// Output the queued messages and join the thread.
+  void
+  stop()
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stopping_ = true;
+    }
+    condition_variable_.notify_one();
+    if (thread_.joinable()) {
+      thread_.join();
+    }
+  }
+
+private:
+  void
+  run()
+  {
+    std::deque<LogMessage> messages;
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      condition_variable_.wait(
+        lock, [this]() {return stopping_ || !queue_.empty() || dropped_ > 0;});
+      if (queue_.empty() && 0 == dropped_) {
+        return;
+      }
+      messages.swap(queue_);
+      const size_t dropped = std::exchange(dropped_, 0);
+      lock.unlock();
+      {
+        // Output as the synchronous output handler does, which is serialized with logging
+        // configuration and the creation of rosout publishers
+        std::lock_guard<std::recursive_mutex> logging_lock(*logging_mutex_);
+        for (const LogMessage & message : messages) {
+          rcutils_log_location_t location{
+            message.function_name.c_str(), message.file_name.c_str(), message.line_number};
+          output_log_message(
+            message.has_location ? &location : nullptr, message.severity,
+            message.name.c_str(), message.timestamp, "%s", message.message.c_str());
+        }
+        if (dropped > 0) {
+          rcutils_time_point_value_t now = 0;
+          if (RCUTILS_RET_OK != rcutils_system_time_now(&now)) {
+            now = messages.empty() ? 0 : messages.back().timestamp;
+          }
+          output_log_message(
+            nullptr, RCUTILS_LOG_SEVERITY_WARN, "rclcpp", now,
+            "%zu log messages were dropped, the asynchronous logging queue was full", dropped);
+        }
+      }
+      messages.clear();
+      lock.lock();
+    }
+  }
+
+  const size_t queue_size_;
+  const rclcpp::LogQueueOverflowPolicy overflow_policy_;
+  // Kept alive for the thread, see get_global_logging_mutex()
+  std::shared_ptr<std::recursive_mutex> logging_mutex_;
+
+  std::mutex mutex_;
+  std::condition_variable condition_variable_;
+  std::deque<LogMessage> queue_;
+  size_t dropped_ = 0;
+  bool stopping_ = false;
+  std::thread thread_;
+};
+
+std::shared_ptr<AsyncLogSink> &
+get_global_async_log_sink()
+{
+  static std::shared_ptr<AsyncLogSink> sink;
+  return sink;
+}
+
+}  // namespace
+
+void
+start_async_logging(size_t queue_size, rclcpp::LogQueueOverflowPolicy overflow_policy)
+{
+  auto & sink = get_global_async_log_sink();
+  if (!std::atomic_load(&sink)) {
+    std::atomic_store(&sink, std::make_shared<AsyncLogSink>(queue_size, overflow_policy));
+  }
+}
+
+void
+stop_async_logging()
+{
+  auto sink = std::atomic_exchange(&get_global_async_log_sink(), std::shared_ptr<AsyncLogSink>());
+  if (sink) {
+    // Messages logged concurrently by threads still holding the sink are output synchronously
+    sink->stop();
+  }
+}
+
+bool
+async_log(
+  const rcutils_log_location_t * location,
+  int severity, const char * name, rcutils_time_point_value_t timestamp,
+  const char * format, va_list * args)
+{
+  auto sink = std::atomic_load(&get_global_async_log_sink());
+  if (!sink) {
+    return false;
+  }
+
+  // Format the message here, the arguments are only valid in this call
+  LogMessage message;
+  char buffer[1024];
+  va_list args_copy;
+  va_copy(args_copy, *args);
+  const int length = std::vsnprintf(buffer, sizeof(buffer), format, args_copy);
+  va_end(args_copy);
+  if (length < 0) {
+    return false;
+  }
+  if (static_cast<size_t>(length) < sizeof(buffer)) {
+    message.message.assign(buffer, static_cast<size_t>(length));
+  } else {
+    message.message.resize(static_cast<size_t>(length));
+    va_copy(args_copy, *args);
+    std::vsnprintf(&message.message[0], message.message.size() + 1, format, args_copy);
+    va_end(args_copy);
+  }
+
+  message.has_location = nullptr != location;
+  if (location) {
+    message.function_name = location->function_name ? location->function_name : "";
+    message.file_name = location->file_name ? location->file_name : "";
+    message.line_number = location->line_number;
+  } else {
+    message.line_number = 0;
+  }
+  message.severity = severity;
+  message.name = name ? name : "";
+  message.timestamp = timestamp;
+  return sink->push(std::move(message));
+}
@@ -0,0 +1,60 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef RCLCPP__ASYNC_LOGGING_HPP_
+#define RCLCPP__ASYNC_LOGGING_HPP_
+
+#include <cstdarg>
+#include <cstddef>
+
+#include "rclcpp/init_options.hpp"
+#include "rclcpp/visibility_control.hpp"
+#include "rcutils/logging.h"
+#include "rcutils/time.h"
+
+/// Start outputting the log messages from a background thread, if not started yet.
+/**
+ * \param[in] queue_size the maximum number of queued log messages
+ * \param[in] overflow_policy what to do with a log message when the queue is full
+ */
+RCLCPP_LOCAL
+void
+start_async_logging(size_t queue_size, rclcpp::LogQueueOverflowPolicy overflow_policy);
+
+/// Output the queued log messages and stop the background thread, if it was started.
+/**
+ * This must not be called with the global logging mutex locked, which the background thread
+ * locks to output the messages.
+ */
+RCLCPP_LOCAL
+void
+stop_async_logging();
+
+/// Queue a log message for the background thread.
+/**
+ * The arguments are those of the rcl logging output handler, the message is formatted before
+ * this function returns.
+ *
+ * \return false if the message must be output in the calling thread instead, e.g. because
+ *   asynchronous logging isn't started
+ */
+RCLCPP_LOCAL
+bool
+async_log(
+  const rcutils_log_location_t * location,
+  int severity, const char * name, rcutils_time_point_value_t timestamp,
+  const char * format, va_list * args);
+
+#endif  // RCLCPP__ASYNC_LOGGING_HPP_
@@ -50,12 +50,198 @@ CallbackGroup::can_be_taken_from()
   return can_be_taken_from_;
 }
 
+void
+CallbackGroup::set_priority(int priority)
+{
+  priority_.store(priority);
+}
+
+int
+CallbackGroup::get_priority() const
+{
+  return priority_.load();
+}
+
+void
+CallbackGroup::set_thread_attributes(const rclcpp::ThreadAttributes & attributes)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  thread_attributes_ = attributes;
+}
+
+rclcpp::ThreadAttributes
+CallbackGroup::get_thread_attributes() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return thread_attributes_;
+}
+
+void
+CallbackGroup::set_enabled(bool enabled)
+{
+  if (enabled_.exchange(enabled) != enabled) {
+    // Executors collect their entities again
+    entities_version_.fetch_add(1);
+    trigger_notify_guard_condition();
+  }
+}
+
+bool
+CallbackGroup::is_enabled() const
+{
+  return enabled_.load();
+}
+
+uint64_t
+CallbackGroup::get_entities_version() const
+{
+  return entities_version_.load();
+}
+
 const CallbackGroupType &
 CallbackGroup::type() const
 {
   return type_;
 }
 
+void
+CallbackGroup::set_shared_access(
+  const rclcpp::SubscriptionBase::SharedPtr & subscription_ptr, bool shared)
+{
+  set_entity_shared_access(subscription_ptr, subscription_ptr->get_callback_group(), shared);
+}
+
+void
+CallbackGroup::set_shared_access(const rclcpp::TimerBase::SharedPtr & timer_ptr, bool shared)
+{
+  set_entity_shared_access(timer_ptr, timer_ptr->get_callback_group(), shared);
+}
+
+void
+CallbackGroup::set_shared_access(const rclcpp::ServiceBase::SharedPtr & service_ptr, bool shared)
+{
+  set_entity_shared_access(service_ptr, service_ptr->get_callback_group(), shared);
+}
+
+void
+CallbackGroup::set_shared_access(const rclcpp::ClientBase::SharedPtr & client_ptr, bool shared)
+{
+  set_entity_shared_access(client_ptr, client_ptr->get_callback_group(), shared);
+}
+
+void
+CallbackGroup::set_shared_access(const rclcpp::Waitable::SharedPtr & waitable_ptr, bool shared)
+{
+  set_entity_shared_access(waitable_ptr, waitable_ptr->get_callback_group(), shared);
+}
+
+void
+CallbackGroup::set_entity_shared_access(
+  const std::shared_ptr<const void> & entity,
+  const CallbackGroup::SharedPtr & entity_group,
+  bool shared)
+{
+  if (entity_group.get() != this) {
+    throw std::invalid_argument("entity is not in this callback group");
+  }
+  std::lock_guard<std::mutex> lock(reader_writer_mutex_);
+  // Forget the entities which were destroyed, a new entity may reuse their address
+  for (auto it = shared_entities_.begin(); it != shared_entities_.end(); ) {
+    if (it->second.expired()) {
+      it = shared_entities_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  if (shared) {
+    shared_entities_[entity.get()] = entity;
+  } else {
+    shared_entities_.erase(entity.get());
+  }
+}
+
+bool
+CallbackGroup::has_shared_access(const void * entity)
+{
+  auto it = shared_entities_.find(entity);
+  if (it == shared_entities_.end()) {
+    return false;
+  }
+  if (it->second.expired()) {
+    shared_entities_.erase(it);
+    return false;
+  }
+  return true;
+}
+
+bool
+CallbackGroup::can_start_callback(const void * entity)
+{
+  if (type_ != CallbackGroupType::ReaderWriter) {
+    return can_be_taken_from_.load();
+  }
+  std::lock_guard<std::mutex> lock(reader_writer_mutex_);
+  if (writer_running_) {
+    return false;
+  }
+  if (has_shared_access(entity)) {
+    return !writer_waiting_;
+  }
+  if (running_readers_ > 0) {
+    // Hold back new readers until the running ones are done, and leave the entities of the
+    // group out of the waits meanwhile, as the ready writer would end each wait right away
+    writer_waiting_ = true;
+    can_be_taken_from_.store(false);
+    return false;
+  }
+  return true;
+}
+
+void
+CallbackGroup::start_callback(const void * entity)
+{
+  if (type_ == CallbackGroupType::MutuallyExclusive) {
+    // Reset to true either when the callback is done or when the executable is discarded
+    can_be_taken_from_.store(false);
+    return;
+  }
+  if (type_ != CallbackGroupType::ReaderWriter) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(reader_writer_mutex_);
+  if (has_shared_access(entity)) {
+    running_readers_++;
+    return;
+  }
+  writer_running_ = true;
+  writer_waiting_ = false;
+  // No other callback of the group can start, the executors can skip the whole group
+  can_be_taken_from_.store(false);
+}
+
+bool
+CallbackGroup::finish_callback(const void * entity)
+{
+  if (type_ != CallbackGroupType::ReaderWriter) {
+    return !can_be_taken_from_.exchange(true);
+  }
+  std::lock_guard<std::mutex> lock(reader_writer_mutex_);
+  if (has_shared_access(entity)) {
+    // Discarded executables are finished without having been started
+    if (running_readers_ > 0 && --running_readers_ == 0 && writer_waiting_) {
+      // The entities of the group are waited on again, and the writer held back until now may
+      // be ready from a wait which already returned, e.g. triggered by a guard condition, so the
+      // wait is woken for it
+      writer_waiting_ = false;
+      can_be_taken_from_.store(true);
+      return true;
+    }
+    return false;
+  }
+  writer_running_ = false;
+  return !can_be_taken_from_.exchange(true);
+}
+
 size_t
 CallbackGroup::size() const
 {
@@ -179,6 +365,7 @@ CallbackGroup::add_subscription(
   const rclcpp::SubscriptionBase::SharedPtr subscription_ptr)
 {
   std::lock_guard<std::mutex> lock(mutex_);
+  subscription_ptr->callback_group_ = weak_from_this();
   subscription_ptrs_.push_back(subscription_ptr);
   subscription_ptrs_.erase(
     std::remove_if(
@@ -186,12 +373,14 @@ CallbackGroup::add_subscription(
       subscription_ptrs_.end(),
       [](rclcpp::SubscriptionBase::WeakPtr x) {return x.expired();}),
     subscription_ptrs_.end());
+  entities_version_.fetch_add(1);
 }
 
 void
 CallbackGroup::add_timer(const rclcpp::TimerBase::SharedPtr timer_ptr)
 {
   std::lock_guard<std::mutex> lock(mutex_);
+  timer_ptr->callback_group_ = weak_from_this();
   timer_ptrs_.push_back(timer_ptr);
   timer_ptrs_.erase(
     std::remove_if(
@@ -199,12 +388,14 @@ CallbackGroup::add_timer(const rclcpp::TimerBase::SharedPtr timer_ptr)
       timer_ptrs_.end(),
       [](rclcpp::TimerBase::WeakPtr x) {return x.expired();}),
     timer_ptrs_.end());
+  entities_version_.fetch_add(1);
 }
 
 void
 CallbackGroup::add_service(const rclcpp::ServiceBase::SharedPtr service_ptr)
 {
   std::lock_guard<std::mutex> lock(mutex_);
+  service_ptr->callback_group_ = weak_from_this();
   service_ptrs_.push_back(service_ptr);
   service_ptrs_.erase(
     std::remove_if(
@@ -212,12 +403,14 @@ CallbackGroup::add_service(const rclcpp::ServiceBase::SharedPtr service_ptr)
       service_ptrs_.end(),
       [](rclcpp::ServiceBase::WeakPtr x) {return x.expired();}),
     service_ptrs_.end());
+  entities_version_.fetch_add(1);
 }
 
 void
 CallbackGroup::add_client(const rclcpp::ClientBase::SharedPtr client_ptr)
 {
   std::lock_guard<std::mutex> lock(mutex_);
+  client_ptr->callback_group_ = weak_from_this();
   client_ptrs_.push_back(client_ptr);
   client_ptrs_.erase(
     std::remove_if(
@@ -225,12 +418,14 @@ CallbackGroup::add_client(const rclcpp::ClientBase::SharedPtr client_ptr)
       client_ptrs_.end(),
       [](rclcpp::ClientBase::WeakPtr x) {return x.expired();}),
     client_ptrs_.end());
+  entities_version_.fetch_add(1);
 }
 
 void
 CallbackGroup::add_waitable(const rclcpp::Waitable::SharedPtr waitable_ptr)
 {
   std::lock_guard<std::mutex> lock(mutex_);
+  waitable_ptr->callback_group_ = weak_from_this();
   waitable_ptrs_.push_back(waitable_ptr);
   waitable_ptrs_.erase(
     std::remove_if(
@@ -238,6 +433,7 @@ CallbackGroup::add_waitable(const rclcpp::Waitable::SharedPtr waitable_ptr)
       waitable_ptrs_.end(),
       [](rclcpp::Waitable::WeakPtr x) {return x.expired();}),
     waitable_ptrs_.end());
+  entities_version_.fetch_add(1);
 }
 
 void
@@ -248,6 +444,7 @@ CallbackGroup::remove_waitable(const rclcpp::Waitable::SharedPtr waitable_ptr) n
     const auto shared_ptr = iter->lock();
     if (shared_ptr.get() == waitable_ptr.get()) {
       waitable_ptrs_.erase(iter);
+      entities_version_.fetch_add(1);
       break;
     }
   }
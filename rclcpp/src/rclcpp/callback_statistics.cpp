@@ -0,0 +1,145 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rclcpp/callback_statistics.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+using rclcpp::LatencyHistogram;
+
+LatencyHistogram::LatencyHistogram()
+{
+  this->reset();
+}
+
+void
+LatencyHistogram::record(std::chrono::nanoseconds value)
+{
+  const uint64_t v = static_cast<uint64_t>(std::max<int64_t>(value.count(), 0));
+  buckets_[get_bucket_index(v)].fetch_add(1, std::memory_order_relaxed);
+  count_.fetch_add(1, std::memory_order_relaxed);
+  sum_.fetch_add(v, std::memory_order_relaxed);
+
+  uint64_t current = min_.load(std::memory_order_relaxed);
+  while (v < current && !min_.compare_exchange_weak(current, v, std::memory_order_relaxed)) {}
+  current = max_.load(std::memory_order_relaxed);
+  while (v > current && !max_.compare_exchange_weak(current, v, std::memory_order_relaxed)) {}
+}
+
+uint64_t
+LatencyHistogram::get_count() const
+{
+  return count_.load(std::memory_order_relaxed);
+}
+
+std::chrono::nanoseconds
+LatencyHistogram::get_min() const
+{
+  if (get_count() == 0) {
+    return std::chrono::nanoseconds::zero();
+  }
+  return std::chrono::nanoseconds(min_.load(std::memory_order_relaxed));
+}
+
+std::chrono::nanoseconds
+LatencyHistogram::get_max() const
+{
+  return std::chrono::nanoseconds(max_.load(std::memory_order_relaxed));
+}
+
+std::chrono::nanoseconds
+LatencyHistogram::get_mean() const
+{
+  const uint64_t count = get_count();
+  if (count == 0) {
+    return std::chrono::nanoseconds::zero();
+  }
+  return std::chrono::nanoseconds(sum_.load(std::memory_order_relaxed) / count);
+}
+
+std::chrono::nanoseconds
+LatencyHistogram::get_percentile(double percentile) const
+{
+  if (!(percentile >= 0.0 && percentile <= 100.0)) {
+    throw std::invalid_argument("percentile must be between 0 and 100");
+  }
+  const uint64_t count = get_count();
+  if (count == 0) {
+    return std::chrono::nanoseconds::zero();
+  }
+  const uint64_t target = std::max<uint64_t>(
+    1, static_cast<uint64_t>(std::ceil(percentile / 100.0 * static_cast<double>(count))));
+
+  uint64_t accumulated = 0;
+  for (size_t i = 0; i < kBucketCount; ++i) {
+    accumulated += buckets_[i].load(std::memory_order_relaxed);
+    if (accumulated >= target) {
+      // The value is reported as the largest one of its bucket, but never beyond the max
+      return std::chrono::nanoseconds(
+        std::min(get_bucket_max_value(i), max_.load(std::memory_order_relaxed)));
+    }
+  }
+  return get_max();
+}
+
+void
+LatencyHistogram::reset()
+{
+  for (auto & bucket : buckets_) {
+    bucket.store(0, std::memory_order_relaxed);
+  }
+  count_.store(0, std::memory_order_relaxed);
+  sum_.store(0, std::memory_order_relaxed);
+  min_.store(std::numeric_limits<uint64_t>::max(), std::memory_order_relaxed);
+  max_.store(0, std::memory_order_relaxed);
+}
+
+size_t
+LatencyHistogram::get_bucket_index(uint64_t value)
+{
+  if (value < 2 * kSubBucketCount) {
+    return static_cast<size_t>(value);
+  }
+  // Find the most significant bit of the value
+  size_t msb = 0;
+  for (size_t shift = 32; shift > 0; shift /= 2) {
+    if (value >> (msb + shift)) {
+      msb += shift;
+    }
+  }
+  if (msb >= kMaxValueBits) {
+    return kBucketCount - 1;
+  }
+  // Keep kSubBucketBits bits after the most significant one
+  const size_t shift = msb - kSubBucketBits;
+  return kSubBucketCount * shift + static_cast<size_t>(value >> shift);
+}
+
+uint64_t
+LatencyHistogram::get_bucket_max_value(size_t index)
+{
+  if (index < 2 * kSubBucketCount) {
+    return index;
+  }
+  if (index == kBucketCount - 1) {
+    return std::numeric_limits<uint64_t>::max();
+  }
+  const size_t shift = index / kSubBucketCount - 1;
+  const uint64_t mantissa = index - kSubBucketCount * shift;
+  return ((mantissa + 1) << shift) - 1;
+}
@@ -15,21 +15,28 @@
 #include "rclcpp/client.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <condition_variable>
 #include <cstdio>
 #include <memory>
+#include <mutex>
+#include <stdexcept>
 #include <string>
+#include <vector>
 
 #include "rcl/graph.h"
 #include "rcl/node.h"
 #include "rcl/wait.h"
 
 #include "rclcpp/exceptions.hpp"
+#include "rclcpp/experimental/intra_process_manager.hpp"
 #include "rclcpp/node_interfaces/node_base_interface.hpp"
 #include "rclcpp/node_interfaces/node_graph_interface.hpp"
 #include "rclcpp/qos.hpp"
 #include "rclcpp/utilities.hpp"
 #include "rclcpp/logging.hpp"
+#include "rcpputils/scope_exit.hpp"
 
 using rclcpp::ClientBase;
 using rclcpp::exceptions::InvalidNodeError;
@@ -100,16 +107,13 @@ ClientBase::get_client_handle() const
   return client_handle_;
 }
 
+static
 bool
-ClientBase::service_is_ready() const
+service_server_is_available(const rcl_node_t * node_handle, const rcl_client_t * client_handle)
 {
   bool is_ready;
-  rcl_ret_t ret = rcl_service_server_is_available(
-    this->get_rcl_node_handle(),
-    this->get_client_handle().get(),
-    &is_ready);
+  rcl_ret_t ret = rcl_service_server_is_available(node_handle, client_handle, &is_ready);
   if (RCL_RET_NODE_INVALID == ret) {
-    const rcl_node_t * node_handle = this->get_rcl_node_handle();
     if (node_handle && !rcl_context_is_valid(node_handle->context)) {
       // context is shutdown, do a soft failure
       return false;
@@ -121,6 +125,37 @@ ClientBase::service_is_ready() const
   return is_ready;
 }
 
+bool
+ClientBase::service_is_ready() const
+{
+  return service_server_is_available(
+    this->get_rcl_node_handle(), this->get_client_handle().get());
+}
+
+static
+bool
+has_service_added(const std::vector<rclcpp::GraphChange> & changes, const std::string & name)
+{
+  return std::any_of(
+    changes.begin(), changes.end(),
+    [&name](const rclcpp::GraphChange & change) {
+      return rclcpp::GraphChange::Kind::ServiceAdded == change.kind && name == change.name;
+    });
+}
+
+namespace
+{
+
+/// State shared by a thread waiting for a service and its graph change callback.
+struct ServiceWaitState
+{
+  std::mutex mutex;
+  std::condition_variable cv;
+  bool service_added = false;
+};
+
+}  // namespace
+
 bool
 ClientBase::wait_for_service_nanoseconds(std::chrono::nanoseconds timeout)
 {
@@ -137,8 +172,25 @@ ClientBase::wait_for_service_nanoseconds(std::chrono::nanoseconds timeout)
     // check was non-blocking, return immediately
     return false;
   }
-  // make an event to reuse, rather than create a new one each time
-  auto event = node_ptr->get_graph_event();
+  // Only wake up when a server of this service appears, not on every change of the graph
+  auto state = std::make_shared<ServiceWaitState>();
+  auto handle = node_ptr->add_graph_change_callback(
+    [state, service_name = std::string(this->get_service_name())](
+      const std::vector<rclcpp::GraphChange> & changes)
+    {
+      if (has_service_added(changes, service_name)) {
+        {
+          std::lock_guard<std::mutex> lock(state->mutex);
+          state->service_added = true;
+        }
+        state->cv.notify_all();
+      }
+    });
+  RCPPUTILS_SCOPE_EXIT(node_ptr->remove_graph_change_callback(handle.get()); );
+  // the server may have appeared while the callback was added
+  if (this->service_is_ready()) {
+    return true;
+  }
   // update the time even on the first loop to account for time spent in the first call
   // to this->server_is_ready()
   std::chrono::nanoseconds time_to_wait =
@@ -160,12 +212,16 @@ ClientBase::wait_for_service_nanoseconds(std::chrono::nanoseconds timeout)
     // (see https://github.com/ros2/rmw_connext/issues/201)
     // If no other graph events occur, the wait set will not be triggered again until the timeout
     // has been reached, despite the service being available, so we artificially limit the wait
-    // time to limit the delay.
-    node_ptr->wait_for_graph_change(
-      event, std::min(time_to_wait, std::chrono::nanoseconds(RCL_MS_TO_NS(100))));
+    // time to limit the delay. This also bounds the delay to notice a shutdown.
+    {
+      std::unique_lock<std::mutex> lock(state->mutex);
+      state->cv.wait_for(
+        lock, std::min(time_to_wait, std::chrono::nanoseconds(RCL_MS_TO_NS(100))),
+        [&state]() {return state->service_added;});
+      state->service_added = false;
+    }
     // Because of the aforementioned race condition, we check if the service is ready even if the
-    // graph event wasn't triggered.
-    event->check_and_clear();
+    // service wasn't added to the graph.
     if (this->service_is_ready()) {
       return true;
     }
@@ -178,6 +234,71 @@ ClientBase::wait_for_service_nanoseconds(std::chrono::nanoseconds timeout)
   return false;  // timeout exceeded while waiting for the server to be ready
 }
 
+void
+ClientBase::set_on_service_available_callback(std::function<void()> callback)
+{
+  if (!callback) {
+    throw std::invalid_argument(
+            "The callback passed to set_on_service_available_callback "
+            "is not callable.");
+  }
+  auto node_ptr = node_graph_.lock();
+  if (!node_ptr) {
+    throw InvalidNodeError();
+  }
+  clear_on_service_available_callback();
+
+  // The client may be destroyed while the graph listener calls the callback, so it isn't used
+  auto called = std::make_shared<std::atomic_bool>(false);
+  auto call_once = [called, callback]() {
+      if (!called->exchange(true)) {
+        callback();
+      }
+    };
+  std::weak_ptr<rcl_node_t> weak_node_handle = node_handle_;
+  std::weak_ptr<rcl_client_t> weak_client_handle = client_handle_;
+  // Checked on any change of the graph, the server may be matched after it appeared in the
+  // graph, this is done by the graph listener thread and doesn't wake up any other thread
+  auto handle = node_ptr->add_graph_change_callback(
+    [call_once, called, weak_node_handle, weak_client_handle](
+      const std::vector<rclcpp::GraphChange> &)
+    {
+      if (called->load()) {
+        return;
+      }
+      auto node_handle = weak_node_handle.lock();
+      auto client_handle = weak_client_handle.lock();
+      if (node_handle && client_handle &&
+        service_server_is_available(node_handle.get(), client_handle.get()))
+      {
+        call_once();
+      }
+    });
+  {
+    std::lock_guard<std::mutex> lock(service_available_mutex_);
+    service_available_handle_ = handle;
+  }
+  // the server may have appeared before the callback was added
+  if (this->service_is_ready()) {
+    call_once();
+  }
+}
+
+void
+ClientBase::clear_on_service_available_callback()
+{
+  rclcpp::GraphChangeCallbackHandle::SharedPtr handle;
+  {
+    std::lock_guard<std::mutex> lock(service_available_mutex_);
+    handle = std::move(service_available_handle_);
+    service_available_handle_.reset();
+  }
+  auto node_ptr = node_graph_.lock();
+  if (handle && node_ptr) {
+    node_ptr->remove_graph_change_callback(handle.get());
+  }
+}
+
 rcl_node_t *
 ClientBase::get_rcl_node_handle()
 {
@@ -246,3 +367,36 @@ ClientBase::set_on_new_response_callback(rcl_event_callback_t callback, const vo
     throw_from_rcl_error(ret, "failed to set the on new response callback for client");
   }
 }
+
+std::shared_ptr<rclcpp::CallbackGroup>
+ClientBase::get_callback_group() const
+{
+  return callback_group_.lock();
+}
+
+void
+ClientBase::setup_intra_process()
+{
+  if (intra_process_queue_) {
+    throw std::runtime_error("intra-process is already set up for the client");
+  }
+  weak_ipm_ = rclcpp::experimental::IntraProcessManager::get_instance(*context_);
+  intra_process_service_name_ = this->get_service_name();
+  intra_process_queue_ = std::make_shared<rclcpp::experimental::IntraProcessWorkQueue>(context_);
+}
+
+rclcpp::Waitable::SharedPtr
+ClientBase::get_intra_process_waitable() const
+{
+  return intra_process_queue_;
+}
+
+rclcpp::experimental::ServiceIntraProcessBase::SharedPtr
+ClientBase::get_intra_process_service() const
+{
+  auto ipm = weak_ipm_.lock();
+  if (!ipm) {
+    return nullptr;
+  }
+  return ipm->get_service(intra_process_service_name_);
+}
@@ -14,9 +14,17 @@
 
 #include "rclcpp/clock.hpp"
 
+#ifdef __linux__
+#include <time.h>
+#endif
+
+#include <cerrno>
+#include <chrono>
 #include <condition_variable>
 #include <memory>
+#include <stdexcept>
 #include <thread>
+#include <utility>
 
 #include "rclcpp/exceptions.hpp"
 #include "rclcpp/utilities.hpp"
@@ -27,9 +35,70 @@
 namespace rclcpp
 {
 
+namespace
+{
+
+// Smallest jump thresholds, exceeded by every change of time or of time source
+rcl_jump_threshold_t
+any_jump_threshold()
+{
+  rcl_jump_threshold_t threshold;
+  threshold.on_clock_change = true;
+  // 0 is disable, so -1 and 1 are smallest possible time changes
+  threshold.min_backward.nanoseconds = -1;
+  threshold.min_forward.nanoseconds = 1;
+  return threshold;
+}
+
+// Same check as rcl does for each of its jump callbacks
+bool
+exceeds_threshold(const rcl_jump_threshold_t & threshold, const rcl_time_jump_t & time_jump)
+{
+  const bool is_clock_change = time_jump.clock_change == RCL_ROS_TIME_ACTIVATED ||
+    time_jump.clock_change == RCL_ROS_TIME_DEACTIVATED;
+  return (is_clock_change && threshold.on_clock_change) ||
+         (threshold.min_forward.nanoseconds > 0 &&
+         time_jump.delta.nanoseconds >= threshold.min_forward.nanoseconds) ||
+         (threshold.min_backward.nanoseconds < 0 &&
+         time_jump.delta.nanoseconds <= threshold.min_backward.nanoseconds);
+}
+
+}  // namespace
+
 class Clock::Impl
 {
 public:
+  /// Jump handler linked in the list of the handlers of a clock, removed when destroyed.
+  /**
+   * Registrations live in the same allocation as the shared pointer returned by
+   * create_jump_callback(), or on the stack of a sleeping thread.
+   */
+  struct JumpRegistration
+  {
+    JumpRegistration(
+      JumpHandler::pre_callback_t pre_callback,
+      JumpHandler::post_callback_t post_callback,
+      const rcl_jump_threshold_t & threshold)
+    : handler(std::move(pre_callback), std::move(post_callback), threshold)
+    {}
+
+    ~JumpRegistration()
+    {
+      // The clock may have been destroyed first
+      auto impl = weak_impl.lock();
+      if (impl) {
+        std::lock_guard<std::mutex> clock_guard(impl->clock_mutex_);
+        impl->remove_jump_registration(*this);
+      }
+    }
+
+    JumpHandler handler;
+    JumpRegistration * prev = nullptr;
+    JumpRegistration * next = nullptr;
+    // Set once the registration was added to the clock
+    std::weak_ptr<Impl> weak_impl;
+  };
+
   explicit Impl(rcl_clock_type_t clock_type)
   : allocator_{rcl_get_default_allocator()}
   {
@@ -47,11 +116,192 @@ public:
     }
   }
 
+  /// Add a jump handler in constant time, with the clock mutex locked.
+  void
+  add_jump_registration(JumpRegistration & registration)
+  {
+    // A single rcl jump callback dispatches the jumps to all the handlers, so that adding and
+    // removing a handler doesn't reallocate and search the array of rcl callbacks
+    if (!jump_callback_added_) {
+      rcl_ret_t ret = rcl_clock_add_jump_callback(
+        &rcl_clock_, any_jump_threshold(), &Impl::dispatch_time_jump, this);
+      if (RCL_RET_OK != ret) {
+        exceptions::throw_from_rcl_error(ret, "Failed to add time jump callback");
+      }
+      jump_callback_added_ = true;
+    }
+    // Appended, so that handlers are called in the order they were added
+    registration.prev = last_jump_registration_;
+    registration.next = nullptr;
+    if (last_jump_registration_) {
+      last_jump_registration_->next = &registration;
+    } else {
+      first_jump_registration_ = &registration;
+    }
+    last_jump_registration_ = &registration;
+  }
+
+  /// Remove a jump handler in constant time, with the clock mutex locked.
+  void
+  remove_jump_registration(JumpRegistration & registration) noexcept
+  {
+    if (registration.prev) {
+      registration.prev->next = registration.next;
+    } else {
+      first_jump_registration_ = registration.next;
+    }
+    if (registration.next) {
+      registration.next->prev = registration.prev;
+    } else {
+      last_jump_registration_ = registration.prev;
+    }
+    registration.prev = nullptr;
+    registration.next = nullptr;
+  }
+
   rcl_clock_t rcl_clock_;
   rcl_allocator_t allocator_;
   std::mutex clock_mutex_;
+
+private:
+  // Called by rcl with the clock mutex locked by whoever changes the time
+  static void
+  dispatch_time_jump(const rcl_time_jump_t * time_jump, bool before_jump, void * user_data)
+  {
+    const auto * impl = static_cast<const Impl *>(user_data);
+    for (JumpRegistration * registration = impl->first_jump_registration_;
+      nullptr != registration; registration = registration->next)
+    {
+      if (exceeds_threshold(registration->handler.notice_threshold, *time_jump)) {
+        Clock::on_time_jump(time_jump, before_jump, &registration->handler);
+      }
+    }
+  }
+
+  bool jump_callback_added_ = false;
+  JumpRegistration * first_jump_registration_ = nullptr;
+  JumpRegistration * last_jump_registration_ = nullptr;
 };
 
+namespace
+{
+
+#ifdef __linux__
+// Final part of a steady or system time sleep, slept until its absolute time
+constexpr std::chrono::nanoseconds kAbsoluteSleepMargin = std::chrono::milliseconds(1);
+
+// Sleep until an absolute time, using the system clock which rcutils reads for the type
+void
+absolute_sleep_until(rcl_clock_type_t clock_type, rcl_time_point_value_t until_ns)
+{
+  constexpr rcl_time_point_value_t kNanosecondsPerSecond = 1000000000;
+  const clockid_t clock_id = clock_type == RCL_STEADY_TIME ? CLOCK_MONOTONIC : CLOCK_REALTIME;
+  struct timespec deadline;
+  deadline.tv_sec = static_cast<time_t>(until_ns / kNanosecondsPerSecond);
+  deadline.tv_nsec = static_cast<long>(until_ns % kNanosecondsPerSecond);  // NOLINT
+  while (EINTR == clock_nanosleep(clock_id, TIMER_ABSTIME, &deadline, nullptr)) {
+  }
+}
+#endif
+
+// Wait for a steady or system time, which is chrono_until for the matching chrono clock
+template<typename ChronoTimePointT>
+void
+wait_for_wall_time(
+  Clock & clock,
+  const Time & until,
+  const ChronoTimePointT & chrono_until,
+  const Context::SharedPtr & context,
+  std::condition_variable & cv)
+{
+  // loop over spurious wakeups but notice shutdown
+  std::unique_lock lock(clock.get_clock_mutex());
+#ifdef __linux__
+  // The end is slept with clock_nanosleep(), which doesn't depend on the conversion to the
+  // chrono clock, and only this last millisecond isn't interrupted by a shutdown
+  const rcl_time_point_value_t cv_until_ns = until.nanoseconds() - kAbsoluteSleepMargin.count();
+  const auto chrono_cv_until = chrono_until - kAbsoluteSleepMargin;
+  while (clock.now().nanoseconds() < cv_until_ns && context->is_valid()) {
+    cv.wait_until(lock, chrono_cv_until);
+  }
+  lock.unlock();
+  while (context->is_valid() && clock.now() < until) {
+    absolute_sleep_until(clock.get_clock_type(), until.nanoseconds());
+  }
+#else
+  while (clock.now() < until && context->is_valid()) {
+    cv.wait_until(lock, chrono_until);
+  }
+#endif
+}
+
+// Jump threshold used to wake ROS time sleeps on every clock sample
+rcl_jump_threshold_t
+sleep_jump_threshold()
+{
+  // Install jump handler for any amount of time change, for two purposes:
+  // - if ROS time is active, check if time reached on each new clock sample
+  // - Trigger via on_clock_change to detect if time source changes, to invalidate sleep
+  return any_jump_threshold();
+}
+
+// Sleep on the clock, woken through cv by the shutdown of the context and, for ROS time,
+// by a jump callback that sets time_source_changed on a change of time source
+bool
+wait_until(
+  Clock & clock,
+  const Time & until,
+  const Context::SharedPtr & context,
+  std::condition_variable & cv,
+  const bool & time_source_changed)
+{
+  const auto this_clock_type = clock.get_clock_type();
+  if (this_clock_type == RCL_STEADY_TIME) {
+    // Synchronize because RCL steady clock epoch might differ from chrono::steady_clock epoch
+    const Time rcl_entry = clock.now();
+    const std::chrono::steady_clock::time_point chrono_entry = std::chrono::steady_clock::now();
+    const Duration delta_t = until - rcl_entry;
+    const std::chrono::steady_clock::time_point chrono_until =
+      chrono_entry + std::chrono::nanoseconds(delta_t.nanoseconds());
+    wait_for_wall_time(clock, until, chrono_until, context, cv);
+  } else if (this_clock_type == RCL_SYSTEM_TIME) {
+    auto system_time = std::chrono::system_clock::time_point(
+      // Cast because system clock resolution is too big for nanoseconds on some systems
+      std::chrono::duration_cast<std::chrono::system_clock::duration>(
+        std::chrono::nanoseconds(until.nanoseconds())));
+    wait_for_wall_time(clock, until, system_time, context, cv);
+  } else if (this_clock_type == RCL_ROS_TIME) {
+    if (!clock.ros_time_is_active()) {
+      auto system_time = std::chrono::system_clock::time_point(
+        // Cast because system clock resolution is too big for nanoseconds on some systems
+        std::chrono::duration_cast<std::chrono::system_clock::duration>(
+          std::chrono::nanoseconds(until.nanoseconds())));
+
+      // loop over spurious wakeups but notice shutdown or time source change
+      std::unique_lock lock(clock.get_clock_mutex());
+      while (clock.now() < until && context->is_valid() && !time_source_changed) {
+        cv.wait_until(lock, system_time);
+      }
+    } else {
+      // RCL_ROS_TIME with ros_time_is_active.
+      // Just wait without "until" because installed
+      // jump callbacks wake the cv on every new sample.
+      std::unique_lock lock(clock.get_clock_mutex());
+      while (clock.now() < until && context->is_valid() && !time_source_changed) {
+        cv.wait(lock);
+      }
+    }
+  }
+
+  if (!context->is_valid() || time_source_changed) {
+    return false;
+  }
+
+  return clock.now() >= until;
+}
+
+}  // namespace
+
 JumpHandler::JumpHandler(
   pre_callback_t pre_callback,
   post_callback_t post_callback,
@@ -104,76 +354,28 @@ Clock::sleep_until(Time until, Context::SharedPtr context)
       context->remove_on_shutdown_callback(shutdown_cb_handle);
     });
 
-  if (this_clock_type == RCL_STEADY_TIME) {
-    // Synchronize because RCL steady clock epoch might differ from chrono::steady_clock epoch
-    const Time rcl_entry = now();
-    const std::chrono::steady_clock::time_point chrono_entry = std::chrono::steady_clock::now();
-    const Duration delta_t = until - rcl_entry;
-    const std::chrono::steady_clock::time_point chrono_until =
-      chrono_entry + std::chrono::nanoseconds(delta_t.nanoseconds());
-
-    // loop over spurious wakeups but notice shutdown
-    std::unique_lock lock(impl_->clock_mutex_);
-    while (now() < until && context->is_valid()) {
-      cv.wait_until(lock, chrono_until);
-    }
-  } else if (this_clock_type == RCL_SYSTEM_TIME) {
-    auto system_time = std::chrono::system_clock::time_point(
-      // Cast because system clock resolution is too big for nanoseconds on some systems
-      std::chrono::duration_cast<std::chrono::system_clock::duration>(
-        std::chrono::nanoseconds(until.nanoseconds())));
-
-    // loop over spurious wakeups but notice shutdown
-    std::unique_lock lock(impl_->clock_mutex_);
-    while (now() < until && context->is_valid()) {
-      cv.wait_until(lock, system_time);
-    }
-  } else if (this_clock_type == RCL_ROS_TIME) {
-    // Install jump handler for any amount of time change, for two purposes:
-    // - if ROS time is active, check if time reached on each new clock sample
-    // - Trigger via on_clock_change to detect if time source changes, to invalidate sleep
-    rcl_jump_threshold_t threshold;
-    threshold.on_clock_change = true;
-    // 0 is disable, so -1 and 1 are smallest possible time changes
-    threshold.min_backward.nanoseconds = -1;
-    threshold.min_forward.nanoseconds = 1;
-    auto clock_handler = create_jump_callback(
-      nullptr,
-      [&cv, &time_source_changed](const rcl_time_jump_t & jump) {
-        if (jump.clock_change != RCL_ROS_TIME_NO_CHANGE) {
-          time_source_changed = true;
-        }
-        cv.notify_one();
-      },
-      threshold);
-
-    if (!ros_time_is_active()) {
-      auto system_time = std::chrono::system_clock::time_point(
-        // Cast because system clock resolution is too big for nanoseconds on some systems
-        std::chrono::duration_cast<std::chrono::system_clock::duration>(
-          std::chrono::nanoseconds(until.nanoseconds())));
-
-      // loop over spurious wakeups but notice shutdown or time source change
-      std::unique_lock lock(impl_->clock_mutex_);
-      while (now() < until && context->is_valid() && !time_source_changed) {
-        cv.wait_until(lock, system_time);
-      }
-    } else {
-      // RCL_ROS_TIME with ros_time_is_active.
-      // Just wait without "until" because installed
-      // jump callbacks wake the cv on every new sample.
-      std::unique_lock lock(impl_->clock_mutex_);
-      while (now() < until && context->is_valid() && !time_source_changed) {
-        cv.wait(lock);
-      }
-    }
+  if (this_clock_type != RCL_ROS_TIME) {
+    return wait_until(*this, until, context, cv, time_source_changed);
   }
 
-  if (!context->is_valid() || time_source_changed) {
-    return false;
+  // The jump handler is registered on the stack rather than with create_jump_callback(),
+  // so that a ROS time sleep doesn't allocate it
+  Clock::Impl::JumpRegistration registration(
+    nullptr,
+    [&cv, &time_source_changed](const rcl_time_jump_t & jump) {
+      if (jump.clock_change != RCL_ROS_TIME_NO_CHANGE) {
+        time_source_changed = true;
+      }
+      cv.notify_one();
+    },
+    sleep_jump_threshold());
+  {
+    std::lock_guard<std::mutex> clock_guard(impl_->clock_mutex_);
+    impl_->add_jump_registration(registration);
   }
+  registration.weak_impl = impl_;
 
-  return now() >= until;
+  return wait_until(*this, until, context, cv, time_source_changed);
 }
 
 bool
@@ -305,39 +507,112 @@ Clock::create_jump_callback(
   JumpHandler::post_callback_t post_callback,
   const rcl_jump_threshold_t & threshold)
 {
-  // Allocate a new jump handler
-  JumpHandler::UniquePtr handler(new JumpHandler(pre_callback, post_callback, threshold));
-  if (nullptr == handler) {
-    throw std::bad_alloc{};
+  // Checked by rcl when the callbacks were added to the rcl clock
+  if (threshold.min_forward.nanoseconds < 0) {
+    throw std::invalid_argument("forward jump threshold must be positive or zero");
+  }
+  if (threshold.min_backward.nanoseconds > 0) {
+    throw std::invalid_argument("backward jump threshold must be negative or zero");
   }
 
+  // A single allocation for the handler and the shared pointer control block
+  auto registration = std::make_shared<Clock::Impl::JumpRegistration>(
+    std::move(pre_callback), std::move(post_callback), threshold);
   {
     std::lock_guard<std::mutex> clock_guard(impl_->clock_mutex_);
-    // Try to add the jump callback to the clock
-    rcl_ret_t ret = rcl_clock_add_jump_callback(
-      &impl_->rcl_clock_, threshold, Clock::on_time_jump,
-      handler.get());
-    if (RCL_RET_OK != ret) {
-      exceptions::throw_from_rcl_error(ret, "Failed to add time jump callback");
+    impl_->add_jump_registration(*registration);
+  }
+  registration->weak_impl = impl_;
+
+  // The registration, which removes the handler, is destroyed when all copies are destructed
+  return JumpHandler::SharedPtr(registration, &registration->handler);
+}
+
+class ClockSleeper::Impl
+{
+public:
+  Impl(Clock::SharedPtr clock, Context::SharedPtr context)
+  : clock_(std::move(clock)), context_(std::move(context))
+  {
+    if (!clock_) {
+      throw std::invalid_argument("clock cannot be nullptr");
+    }
+    if (!context_) {
+      throw std::invalid_argument("context cannot be nullptr");
+    }
+    // Wake the sleeping thread if the context is shutdown
+    shutdown_cb_handle_ = context_->add_on_shutdown_callback(
+      [this]() {
+        cv_.notify_one();
+      });
+    if (clock_->get_clock_type() == RCL_ROS_TIME) {
+      jump_handler_ = clock_->create_jump_callback(
+        nullptr,
+        [this](const rcl_time_jump_t & jump) {
+          if (jump.clock_change != RCL_ROS_TIME_NO_CHANGE) {
+            time_source_changed_ = true;
+          }
+          cv_.notify_one();
+        },
+        sleep_jump_threshold());
     }
   }
 
-  std::weak_ptr<Clock::Impl> weak_impl = impl_;
-  // *INDENT-OFF*
-  // create shared_ptr that removes the callback automatically when all copies are destructed
-  return JumpHandler::SharedPtr(handler.release(), [weak_impl](JumpHandler * handler) noexcept {
-    auto shared_impl = weak_impl.lock();
-    if (shared_impl) {
-      std::lock_guard<std::mutex> clock_guard(shared_impl->clock_mutex_);
-      rcl_ret_t ret = rcl_clock_remove_jump_callback(&shared_impl->rcl_clock_,
-          Clock::on_time_jump, handler);
-      if (RCL_RET_OK != ret) {
-        RCUTILS_LOG_ERROR("Failed to remove time jump callback");
-      }
+  ~Impl()
+  {
+    jump_handler_.reset();
+    context_->remove_on_shutdown_callback(shutdown_cb_handle_);
+  }
+
+  bool
+  sleep_until(const Time & until)
+  {
+    if (!context_->is_valid()) {
+      throw std::runtime_error("context cannot be slept with because it's invalid");
+    }
+    if (until.get_clock_type() != clock_->get_clock_type()) {
+      throw std::runtime_error("until's clock type does not match this clock's type");
+    }
+    {
+      // Only the changes of time source during this sleep invalidate it
+      std::lock_guard<std::mutex> guard(clock_->get_clock_mutex());
+      time_source_changed_ = false;
     }
-    delete handler;
-  });
-  // *INDENT-ON*
+    return wait_until(*clock_, until, context_, cv_, time_source_changed_);
+  }
+
+  Clock::SharedPtr clock_;
+  Context::SharedPtr context_;
+  std::condition_variable cv_;
+  // Set by the jump callback, protected by the clock mutex as the callback is
+  bool time_source_changed_{false};
+  rclcpp::OnShutdownCallbackHandle shutdown_cb_handle_;
+  JumpHandler::SharedPtr jump_handler_;
+};
+
+ClockSleeper::ClockSleeper(Clock::SharedPtr clock, Context::SharedPtr context)
+: impl_(std::make_unique<Impl>(std::move(clock), std::move(context)))
+{}
+
+ClockSleeper::~ClockSleeper()
+{}
+
+bool
+ClockSleeper::sleep_until(Time until)
+{
+  return impl_->sleep_until(until);
+}
+
+bool
+ClockSleeper::sleep_for(Duration rel_time)
+{
+  return impl_->sleep_until(impl_->clock_->now() + rel_time);
+}
+
+Clock::SharedPtr
+ClockSleeper::get_clock() const
+{
+  return impl_->clock_;
 }
 
 }  // namespace rclcpp
@@ -0,0 +1,665 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rclcpp/content_filter.hpp"
+
+#include <cctype>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "rosidl_runtime_c/message_type_support_struct.h"
+#include "rosidl_typesupport_introspection_cpp/field_types.hpp"
+#include "rosidl_typesupport_introspection_cpp/identifier.hpp"
+#include "rosidl_typesupport_introspection_cpp/message_introspection.hpp"
+
+#include "rclcpp/serialized_field_extractor.hpp"
+
+namespace introspection = rosidl_typesupport_introspection_cpp;
+
+namespace
+{
+
+struct Value
+{
+  bool is_string = false;
+  double number = 0.0;
+  std::string string;
+};
+
+/// Field used by the expression, which can be read from serialized or deserialized messages.
+struct Field
+{
+  rclcpp::SerializedFieldExtractor extractor;
+  // Offset of the field in the deserialized message
+  size_t offset;
+};
+
+struct Operand
+{
+  static constexpr size_t kLiteral = static_cast<size_t>(-1);
+
+  // Index of the field in the fields of the filter, or kLiteral
+  size_t field = kLiteral;
+  Value literal;
+};
+
+enum class Comparison
+{
+  Equal, NotEqual, Less, LessEqual, Greater, GreaterEqual,
+};
+
+struct Condition
+{
+  enum class Type
+  {
+    And, Or, Not, Compare, Between, Like,
+  };
+
+  Type type;
+  Comparison comparison = Comparison::Equal;
+  // The conditions combined by And and Or, or negated by Not
+  std::unique_ptr<Condition> left;
+  std::unique_ptr<Condition> right;
+  // The compared operands, the value and the bounds for Between, the value and the pattern for Like
+  std::vector<Operand> operands;
+};
+
+bool
+is_string_type(uint8_t type_id)
+{
+  return type_id == introspection::ROS_TYPE_STRING;
+}
+
+const introspection::MessageMembers *
+get_members(const rosidl_message_type_support_t * type_support)
+{
+  const rosidl_message_type_support_t * introspection_type_support =
+    get_message_typesupport_handle(type_support, introspection::typesupport_identifier);
+  if (!introspection_type_support) {
+    throw std::invalid_argument("the type support doesn't provide the introspection of the type");
+  }
+  return static_cast<const introspection::MessageMembers *>(introspection_type_support->data);
+}
+
+// Offset of a field in the deserialized message, once the extractor checked that it exists
+size_t
+get_field_offset(const rosidl_message_type_support_t * type_support, const std::string & path)
+{
+  const introspection::MessageMembers * members = get_members(type_support);
+  size_t offset = 0;
+  size_t begin = 0;
+  while (true) {
+    const size_t end = path.find('.', begin);
+    const std::string name = path.substr(begin, end - begin);
+    uint32_t index = 0;
+    while (name != members->members_[index].name_) {
+      ++index;
+    }
+    const introspection::MessageMember & member = members->members_[index];
+    offset += member.offset_;
+    if (end == std::string::npos) {
+      return offset;
+    }
+    members = get_members(member.members_);
+    begin = end + 1;
+  }
+}
+
+template<typename T>
+double
+load_number(const void * field)
+{
+  return static_cast<double>(*static_cast<const T *>(field));
+}
+
+double
+read_number(const void * field, uint8_t type_id)
+{
+  switch (type_id) {
+    case introspection::ROS_TYPE_BOOLEAN:
+      return *static_cast<const bool *>(field) ? 1.0 : 0.0;
+    case introspection::ROS_TYPE_OCTET:
+    case introspection::ROS_TYPE_CHAR:
+    case introspection::ROS_TYPE_UINT8:
+      return load_number<uint8_t>(field);
+    case introspection::ROS_TYPE_INT8:
+      return load_number<int8_t>(field);
+    case introspection::ROS_TYPE_UINT16:
+      return load_number<uint16_t>(field);
+    case introspection::ROS_TYPE_INT16:
+      return load_number<int16_t>(field);
+    case introspection::ROS_TYPE_UINT32:
+      return load_number<uint32_t>(field);
+    case introspection::ROS_TYPE_INT32:
+      return load_number<int32_t>(field);
+    case introspection::ROS_TYPE_UINT64:
+      return load_number<uint64_t>(field);
+    case introspection::ROS_TYPE_INT64:
+      return load_number<int64_t>(field);
+    case introspection::ROS_TYPE_FLOAT:
+      return load_number<float>(field);
+    default:
+      return load_number<double>(field);
+  }
+}
+
+double
+read_number(
+  const rclcpp::SerializedFieldExtractor & extractor,
+  const rclcpp::SerializedMessageView & message)
+{
+  switch (extractor.get_field_type_id()) {
+    case introspection::ROS_TYPE_BOOLEAN:
+      return extractor.extract<bool>(message) ? 1.0 : 0.0;
+    case introspection::ROS_TYPE_OCTET:
+    case introspection::ROS_TYPE_CHAR:
+    case introspection::ROS_TYPE_UINT8:
+      return extractor.extract<uint8_t>(message);
+    case introspection::ROS_TYPE_INT8:
+      return extractor.extract<int8_t>(message);
+    case introspection::ROS_TYPE_UINT16:
+      return extractor.extract<uint16_t>(message);
+    case introspection::ROS_TYPE_INT16:
+      return extractor.extract<int16_t>(message);
+    case introspection::ROS_TYPE_UINT32:
+      return extractor.extract<uint32_t>(message);
+    case introspection::ROS_TYPE_INT32:
+      return extractor.extract<int32_t>(message);
+    case introspection::ROS_TYPE_UINT64:
+      return static_cast<double>(extractor.extract<uint64_t>(message));
+    case introspection::ROS_TYPE_INT64:
+      return static_cast<double>(extractor.extract<int64_t>(message));
+    case introspection::ROS_TYPE_FLOAT:
+      return extractor.extract<float>(message);
+    default:
+      return extractor.extract<double>(message);
+  }
+}
+
+template<typename T>
+bool
+compare(Comparison comparison, const T & lhs, const T & rhs)
+{
+  switch (comparison) {
+    case Comparison::Equal:
+      return lhs == rhs;
+    case Comparison::NotEqual:
+      return !(lhs == rhs);
+    case Comparison::Less:
+      return lhs < rhs;
+    case Comparison::LessEqual:
+      return lhs <= rhs;
+    case Comparison::Greater:
+      return lhs > rhs;
+    default:
+      return lhs >= rhs;
+  }
+}
+
+bool
+compare(Comparison comparison, const Value & lhs, const Value & rhs)
+{
+  if (lhs.is_string) {
+    return compare(comparison, lhs.string, rhs.string);
+  }
+  return compare(comparison, lhs.number, rhs.number);
+}
+
+// Match a string against a LIKE pattern, where % matches any characters and _ a single one
+bool
+like(const std::string & value, const std::string & pattern)
+{
+  size_t v = 0;
+  size_t p = 0;
+  // Position in the pattern after the last %, and in the value where it started matching
+  size_t star = std::string::npos;
+  size_t star_v = 0;
+  while (v < value.size()) {
+    if (p < pattern.size() && (pattern[p] == '_' || pattern[p] == value[v])) {
+      ++v;
+      ++p;
+    } else if (p < pattern.size() && pattern[p] == '%') {
+      star = ++p;
+      star_v = v;
+    } else if (star != std::string::npos) {
+      p = star;
+      v = ++star_v;
+    } else {
+      return false;
+    }
+  }
+  while (p < pattern.size() && pattern[p] == '%') {
+    ++p;
+  }
+  return p == pattern.size();
+}
+
+/// Evaluate a condition, reading the value of the fields with read_field(index).
+template<typename ReadField>
+bool
+evaluate(const Condition & condition, const ReadField & read_field)
+{
+  auto value = [&read_field](const Operand & operand) {
+      return operand.field == Operand::kLiteral ? operand.literal : read_field(operand.field);
+    };
+  switch (condition.type) {
+    case Condition::Type::And:
+      return evaluate(*condition.left, read_field) && evaluate(*condition.right, read_field);
+    case Condition::Type::Or:
+      return evaluate(*condition.left, read_field) || evaluate(*condition.right, read_field);
+    case Condition::Type::Not:
+      return !evaluate(*condition.left, read_field);
+    case Condition::Type::Compare:
+      return compare(
+        condition.comparison, value(condition.operands[0]), value(condition.operands[1]));
+    case Condition::Type::Between:
+      {
+        const Value checked = value(condition.operands[0]);
+        return compare(Comparison::GreaterEqual, checked, value(condition.operands[1])) &&
+               compare(Comparison::LessEqual, checked, value(condition.operands[2]));
+      }
+    default:
+      return like(value(condition.operands[0]).string, value(condition.operands[1]).string);
+  }
+}
+
+/// Recursive descent parser of filter expressions.
+class Parser
+{
+public:
+  Parser(
+    const rosidl_message_type_support_t * type_support,
+    const std::string & expression,
+    const std::vector<std::string> & parameters,
+    std::vector<Field> & fields)
+  : type_support_(type_support), expression_(expression), parameters_(parameters),
+    fields_(fields)
+  {}
+
+  std::unique_ptr<Condition>
+  parse()
+  {
+    auto condition = parse_or();
+    skip_spaces();
+    if (position_ != expression_.size()) {
+      fail("unexpected characters");
+    }
+    return condition;
+  }
+
+private:
+  [[noreturn]] void
+  fail(const std::string & reason) const
+  {
+    throw std::invalid_argument(
+            "invalid filter expression '" + expression_ + "' at offset " +
+            std::to_string(position_) + ": " + reason);
+  }
+
+  void
+  skip_spaces()
+  {
+    while (position_ < expression_.size() &&
+      std::isspace(static_cast<unsigned char>(expression_[position_])))
+    {
+      ++position_;
+    }
+  }
+
+  static bool
+  is_word_character(char c)
+  {
+    return std::isalnum(static_cast<unsigned char>(c)) || c == '_' || c == '.';
+  }
+
+  // Consume the keyword if it's the next word, ignoring the case
+  bool
+  accept_keyword(const char * keyword)
+  {
+    skip_spaces();
+    size_t end = position_;
+    for (const char * c = keyword; *c; ++c, ++end) {
+      if (end >= expression_.size() ||
+        std::toupper(static_cast<unsigned char>(expression_[end])) != *c)
+      {
+        return false;
+      }
+    }
+    if (end < expression_.size() && is_word_character(expression_[end])) {
+      return false;
+    }
+    position_ = end;
+    return true;
+  }
+
+  bool
+  accept(const char * token)
+  {
+    skip_spaces();
+    if (expression_.compare(position_, std::char_traits<char>::length(token), token) != 0) {
+      return false;
+    }
+    position_ += std::char_traits<char>::length(token);
+    return true;
+  }
+
+  std::unique_ptr<Condition>
+  combine(Condition::Type type, std::unique_ptr<Condition> left, std::unique_ptr<Condition> right)
+  {
+    auto condition = std::make_unique<Condition>();
+    condition->type = type;
+    condition->left = std::move(left);
+    condition->right = std::move(right);
+    return condition;
+  }
+
+  std::unique_ptr<Condition>
+  parse_or()
+  {
+    auto condition = parse_and();
+    while (accept_keyword("OR")) {
+      condition = combine(Condition::Type::Or, std::move(condition), parse_and());
+    }
+    return condition;
+  }
+
+  std::unique_ptr<Condition>
+  parse_and()
+  {
+    auto condition = parse_unary();
+    while (accept_keyword("AND")) {
+      condition = combine(Condition::Type::And, std::move(condition), parse_unary());
+    }
+    return condition;
+  }
+
+  std::unique_ptr<Condition>
+  parse_unary()
+  {
+    if (accept_keyword("NOT")) {
+      return combine(Condition::Type::Not, parse_unary(), nullptr);
+    }
+    if (accept("(")) {
+      auto condition = parse_or();
+      if (!accept(")")) {
+        fail("expected ')'");
+      }
+      return condition;
+    }
+    return parse_predicate();
+  }
+
+  std::unique_ptr<Condition>
+  parse_predicate()
+  {
+    auto condition = std::make_unique<Condition>();
+    condition->operands.push_back(parse_operand());
+    const bool negated = accept_keyword("NOT");
+    if (accept_keyword("BETWEEN")) {
+      condition->type = Condition::Type::Between;
+      condition->operands.push_back(parse_operand());
+      if (!accept_keyword("AND")) {
+        fail("expected AND");
+      }
+      condition->operands.push_back(parse_operand());
+    } else if (accept_keyword("LIKE")) {
+      condition->type = Condition::Type::Like;
+      condition->operands.push_back(parse_operand());
+      if (!is_string(condition->operands[0])) {
+        fail("LIKE requires strings");
+      }
+    } else if (negated) {
+      fail("expected BETWEEN or LIKE");
+    } else {
+      condition->type = Condition::Type::Compare;
+      condition->comparison = parse_comparison();
+      condition->operands.push_back(parse_operand());
+    }
+    for (const Operand & operand : condition->operands) {
+      if (is_string(operand) != is_string(condition->operands[0])) {
+        fail("strings can't be compared with numbers");
+      }
+    }
+    if (negated) {
+      return combine(Condition::Type::Not, std::move(condition), nullptr);
+    }
+    return condition;
+  }
+
+  Comparison
+  parse_comparison()
+  {
+    if (accept("<=")) {
+      return Comparison::LessEqual;
+    } else if (accept(">=")) {
+      return Comparison::GreaterEqual;
+    } else if (accept("<>") || accept("!=")) {
+      return Comparison::NotEqual;
+    } else if (accept("<")) {
+      return Comparison::Less;
+    } else if (accept(">")) {
+      return Comparison::Greater;
+    } else if (accept("=")) {
+      return Comparison::Equal;
+    }
+    fail("expected a comparison operator");
+  }
+
+  bool
+  is_string(const Operand & operand) const
+  {
+    if (operand.field == Operand::kLiteral) {
+      return operand.literal.is_string;
+    }
+    return is_string_type(fields_[operand.field].extractor.get_field_type_id());
+  }
+
+  Operand
+  parse_operand()
+  {
+    skip_spaces();
+    if (position_ >= expression_.size()) {
+      fail("expected an operand");
+    }
+    Operand operand;
+    const char c = expression_[position_];
+    if (c == '%') {
+      const size_t begin = ++position_;
+      while (position_ < expression_.size() &&
+        std::isdigit(static_cast<unsigned char>(expression_[position_])))
+      {
+        ++position_;
+      }
+      if (begin == position_) {
+        fail("expected a parameter index");
+      }
+      const size_t index = std::stoul(expression_.substr(begin, position_ - begin));
+      if (index >= parameters_.size()) {
+        fail("parameter %" + std::to_string(index) + " isn't given");
+      }
+      if (!parse_literal(parameters_[index], operand.literal)) {
+        fail("parameter %" + std::to_string(index) + " isn't a literal");
+      }
+    } else if (c == '\'') {
+      const size_t end = expression_.find('\'', position_ + 1);
+      if (end == std::string::npos) {
+        fail("unterminated string");
+      }
+      operand.literal.is_string = true;
+      operand.literal.string = expression_.substr(position_ + 1, end - position_ - 1);
+      position_ = end + 1;
+    } else if (std::isdigit(static_cast<unsigned char>(c)) || c == '-' || c == '+' || c == '.') {
+      const char * begin = expression_.c_str() + position_;
+      char * end = nullptr;
+      operand.literal.number = std::strtod(begin, &end);
+      if (end == begin) {
+        fail("expected a number");
+      }
+      position_ += static_cast<size_t>(end - begin);
+    } else if (accept_keyword("TRUE")) {
+      operand.literal.number = 1.0;
+    } else if (accept_keyword("FALSE")) {
+      operand.literal.number = 0.0;
+    } else if (is_word_character(c)) {
+      const size_t begin = position_;
+      while (position_ < expression_.size() && is_word_character(expression_[position_])) {
+        ++position_;
+      }
+      operand.field = add_field(expression_.substr(begin, position_ - begin));
+    } else {
+      fail("expected an operand");
+    }
+    return operand;
+  }
+
+  // Parse the literal value of a parameter
+  static bool
+  parse_literal(const std::string & text, Value & value)
+  {
+    const size_t begin = text.find_first_not_of(" \t");
+    const size_t end = text.find_last_not_of(" \t");
+    if (begin == std::string::npos) {
+      return false;
+    }
+    const std::string literal = text.substr(begin, end - begin + 1);
+    if (literal.size() >= 2 && literal.front() == '\'' && literal.back() == '\'') {
+      value.is_string = true;
+      value.string = literal.substr(1, literal.size() - 2);
+      return true;
+    }
+    if (literal == "TRUE" || literal == "true") {
+      value.number = 1.0;
+      return true;
+    }
+    if (literal == "FALSE" || literal == "false") {
+      value.number = 0.0;
+      return true;
+    }
+    char * parsed = nullptr;
+    value.number = std::strtod(literal.c_str(), &parsed);
+    return parsed == literal.c_str() + literal.size();
+  }
+
+  size_t
+  add_field(const std::string & path)
+  {
+    for (size_t i = 0; i < fields_.size(); ++i) {
+      if (fields_[i].extractor.get_field_path() == path) {
+        return i;
+      }
+    }
+    fields_.push_back(
+      {rclcpp::SerializedFieldExtractor(type_support_, path),
+        get_field_offset(type_support_, path)});
+    return fields_.size() - 1;
+  }
+
+  const rosidl_message_type_support_t * type_support_;
+  const std::string & expression_;
+  const std::vector<std::string> & parameters_;
+  std::vector<Field> & fields_;
+  size_t position_ = 0;
+};
+
+}  // namespace
+
+namespace rclcpp
+{
+
+struct ContentFilter::Impl
+{
+  std::string filter_expression;
+  std::vector<std::string> expression_parameters;
+  std::vector<Field> fields;
+  std::unique_ptr<Condition> condition;
+};
+
+ContentFilter::ContentFilter(
+  const rosidl_message_type_support_t * type_support,
+  const std::string & filter_expression,
+  const std::vector<std::string> & expression_parameters)
+{
+  if (!type_support) {
+    throw std::invalid_argument("type support is nullptr");
+  }
+  if (filter_expression.empty()) {
+    throw std::invalid_argument("filter expression is empty");
+  }
+  auto impl = std::make_unique<Impl>();
+  impl->filter_expression = filter_expression;
+  impl->expression_parameters = expression_parameters;
+  impl->condition = Parser(
+    type_support, impl->filter_expression, impl->expression_parameters, impl->fields).parse();
+  impl_ = std::move(impl);
+}
+
+ContentFilter::~ContentFilter() = default;
+
+const std::string &
+ContentFilter::get_filter_expression() const
+{
+  return impl_->filter_expression;
+}
+
+const std::vector<std::string> &
+ContentFilter::get_expression_parameters() const
+{
+  return impl_->expression_parameters;
+}
+
+bool
+ContentFilter::matches(const rclcpp::SerializedMessageView & message) const
+{
+  return evaluate(
+    *impl_->condition,
+    [this, &message](size_t index) {
+      const SerializedFieldExtractor & extractor = impl_->fields[index].extractor;
+      Value value;
+      if (is_string_type(extractor.get_field_type_id())) {
+        value.is_string = true;
+        value.string = extractor.extract<std::string>(message);
+      } else {
+        value.number = read_number(extractor, message);
+      }
+      return value;
+    });
+}
+
+bool
+ContentFilter::matches_ros_message(const void * message) const
+{
+  return evaluate(
+    *impl_->condition,
+    [this, message](size_t index) {
+      const Field & field = impl_->fields[index];
+      const void * data = static_cast<const uint8_t *>(message) + field.offset;
+      const uint8_t type_id = field.extractor.get_field_type_id();
+      Value value;
+      if (is_string_type(type_id)) {
+        value.is_string = true;
+        value.string = *static_cast<const std::string *>(data);
+      } else {
+        value.number = read_number(data, type_id);
+      }
+      return value;
+    });
+}
+
+}  // namespace rclcpp
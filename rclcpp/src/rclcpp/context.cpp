@@ -27,11 +27,13 @@
 
 #include "rclcpp/detail/utilities.hpp"
 #include "rclcpp/exceptions.hpp"
+#include "rclcpp/guard_condition.hpp"
 #include "rclcpp/logging.hpp"
 
 #include "rcutils/error_handling.h"
 #include "rcutils/macros.h"
 
+#include "./async_logging.hpp"
 #include "./logging_mutex.hpp"
 
 using rclcpp::Context;
@@ -128,6 +130,9 @@ rclcpp_logging_output_handler(
   const char * format, va_list * args)
 {
   try {
+    if (async_log(location, severity, name, timestamp, format, args)) {
+      return;
+    }
     std::shared_ptr<std::recursive_mutex> logging_mutex;
     logging_mutex = get_global_logging_mutex();
     std::lock_guard<std::recursive_mutex> guard(*logging_mutex);
@@ -199,18 +204,32 @@ Context::init(
   if (this->is_valid()) {
     throw rclcpp::ContextAlreadyInitialized();
   }
-  this->clean_up();
-  rcl_context_t * context = new rcl_context_t;
-  if (!context) {
-    throw std::runtime_error("failed to allocate memory for rcl context");
+  std::vector<std::string> arguments;
+  for (int i = 0; i < argc; ++i) {
+    arguments.emplace_back(argv[i]);
   }
-  *context = rcl_get_zero_initialized_context();
-  rcl_ret_t ret = rcl_init(argc, argv, init_options.get_rcl_init_options(), context);
-  if (RCL_RET_OK != ret) {
-    delete context;
-    rclcpp::exceptions::throw_from_rcl_error(ret, "failed to initialize rcl");
+  rcl_ret_t ret = RCL_RET_OK;
+  if (
+    rcl_context_kept_ && init_options.keep_rcl_context_on_shutdown &&
+    arguments == init_arguments_ && init_options.get_domain_id() == init_options_.get_domain_id())
+  {
+    // reuse the rcl context kept initialized by the last shutdown
+    shutdown_reason_ = "";
+    sub_contexts_.clear();
+  } else {
+    this->clean_up();
+    rcl_context_t * context = new rcl_context_t;
+    if (!context) {
+      throw std::runtime_error("failed to allocate memory for rcl context");
+    }
+    *context = rcl_get_zero_initialized_context();
+    ret = rcl_init(argc, argv, init_options.get_rcl_init_options(), context);
+    if (RCL_RET_OK != ret) {
+      delete context;
+      rclcpp::exceptions::throw_from_rcl_error(ret, "failed to initialize rcl");
+    }
+    rcl_context_.reset(context, __delete_context);
   }
-  rcl_context_.reset(context, __delete_context);
 
   if (init_options.auto_initialize_logging()) {
     logging_mutex_ = get_global_logging_mutex();
@@ -222,9 +241,14 @@ Context::init(
         rcl_init_options_get_allocator(init_options.get_rcl_init_options()),
         rclcpp_logging_output_handler);
       if (RCL_RET_OK != ret) {
+        rcl_context_kept_ = false;
         rcl_context_.reset();
         rclcpp::exceptions::throw_from_rcl_error(ret, "failed to configure logging");
       }
+      if (init_options.async_logging_queue_size > 0) {
+        start_async_logging(
+          init_options.async_logging_queue_size, init_options.async_logging_overflow_policy);
+      }
     } else {
       RCLCPP_WARN(
         rclcpp::get_logger("rclcpp"),
@@ -241,10 +265,13 @@ Context::init(
     }
 
     init_options_ = init_options;
+    init_arguments_ = std::move(arguments);
 
     weak_contexts_ = get_weak_contexts();
     weak_contexts_->add_context(this->shared_from_this());
+    rcl_context_kept_ = false;
   } catch (const std::exception & e) {
+    rcl_context_kept_ = false;
     ret = rcl_shutdown(rcl_context_.get());
     rcl_context_.reset();
     if (RCL_RET_OK != ret) {
@@ -262,7 +289,7 @@ Context::is_valid() const
 {
   // Take a local copy of the shared pointer to avoid it getting nulled under our feet.
   auto local_rcl_context = rcl_context_;
-  if (!local_rcl_context) {
+  if (!local_rcl_context || rcl_context_kept_) {
     return false;
   }
   return rcl_context_is_valid(local_rcl_context.get());
@@ -317,10 +344,15 @@ Context::shutdown(const std::string & reason)
     }
   }
 
-  // rcl shutdown
-  rcl_ret_t ret = rcl_shutdown(rcl_context_.get());
-  if (RCL_RET_OK != ret) {
-    rclcpp::exceptions::throw_from_rcl_error(ret);
+  if (init_options_.keep_rcl_context_on_shutdown) {
+    // keep the rcl context initialized, to be reused by the next init
+    rcl_context_kept_ = true;
+  } else {
+    // rcl shutdown
+    rcl_ret_t ret = rcl_shutdown(rcl_context_.get());
+    if (RCL_RET_OK != ret) {
+      rclcpp::exceptions::throw_from_rcl_error(ret);
+    }
   }
   // set shutdown reason
   shutdown_reason_ = reason;
@@ -331,6 +363,28 @@ Context::shutdown(const std::string & reason)
       (*callback)();
     }
   }
+  // wake up the executors and wait sets waiting on their shutdown guard condition
+  std::vector<std::weak_ptr<GuardCondition>> guard_conditions;
+  {
+    std::lock_guard<std::mutex> lock(shutdown_guard_conditions_mutex_);
+    guard_conditions.reserve(shutdown_guard_conditions_.size());
+    for (const auto & pair : shutdown_guard_conditions_) {
+      guard_conditions.push_back(pair.second);
+    }
+  }
+  for (const auto & weak_guard_condition : guard_conditions) {
+    auto guard_condition = weak_guard_condition.lock();
+    if (!guard_condition) {
+      continue;
+    }
+    try {
+      guard_condition->trigger();
+    } catch (const std::exception & exc) {
+      RCLCPP_ERROR(
+        rclcpp::get_logger("rclcpp"), "failed to trigger shutdown guard condition: %s",
+        exc.what());
+    }
+  }
 
   // interrupt all blocking sleep_for() and all blocking executors or wait sets
   this->interrupt_all_sleep_for();
@@ -339,8 +393,15 @@ Context::shutdown(const std::string & reason)
   // shutdown logger
   if (logging_mutex_) {
     // logging was initialized by this context
-    std::lock_guard<std::recursive_mutex> guard(*logging_mutex_);
+    std::unique_lock<std::recursive_mutex> guard(*logging_mutex_);
     size_t & count = get_logging_reference_count();
+    if (1u == count) {
+      // output the queued log messages before logging is finalized,
+      // the thread outputting them needs the logging mutex
+      guard.unlock();
+      stop_async_logging();
+      guard.lock();
+    }
     if (0u == --count) {
       rcl_ret_t rcl_ret = rcl_logging_fini();
       if (RCL_RET_OK != rcl_ret) {
@@ -374,6 +435,21 @@ Context::remove_on_shutdown_callback(const OnShutdownCallbackHandle & callback_h
   return remove_shutdown_callback<ShutdownType::on_shutdown>(callback_handle);
 }
 
+void
+Context::add_shutdown_guard_condition(
+  const std::shared_ptr<rclcpp::GuardCondition> & guard_condition)
+{
+  std::lock_guard<std::mutex> lock(shutdown_guard_conditions_mutex_);
+  shutdown_guard_conditions_[guard_condition.get()] = guard_condition;
+}
+
+bool
+Context::remove_shutdown_guard_condition(const rclcpp::GuardCondition * guard_condition)
+{
+  std::lock_guard<std::mutex> lock(shutdown_guard_conditions_mutex_);
+  return shutdown_guard_conditions_.erase(guard_condition) != 0;
+}
+
 rclcpp::PreShutdownCallbackHandle
 Context::add_pre_shutdown_callback(PreShutdownCallback callback)
 {
@@ -514,6 +590,16 @@ void
 Context::clean_up()
 {
   shutdown_reason_ = "";
+  if (rcl_context_kept_.exchange(false)) {
+    // the rcl context kept by the last shutdown is no longer going to be reused
+    rcl_ret_t ret = rcl_shutdown(rcl_context_.get());
+    if (RCL_RET_OK != ret) {
+      RCLCPP_ERROR(
+        rclcpp::get_logger("rclcpp"),
+        "failed to shutdown the kept rcl context: %s", rcl_get_error_string().str);
+      rcl_reset_error();
+    }
+  }
   rcl_context_.reset();
   sub_contexts_.clear();
 }
@@ -0,0 +1,252 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rclcpp/deadline_monitor.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "rclcpp/create_timer.hpp"
+
+namespace rclcpp
+{
+
+class DeadlineMonitor::Watch
+{
+public:
+  std::weak_ptr<rclcpp::SubscriptionBase> subscription;
+  std::string topic_name;
+  std::chrono::nanoseconds period;
+  MissedDeadlineCallback callback;
+  // Start of the current period when no message was received during it
+  std::chrono::steady_clock::time_point start;
+  uint64_t total_count {0};
+  bool watched {true};
+};
+
+class DeadlineMonitor::Wheel
+{
+public:
+  Wheel(std::chrono::nanoseconds resolution, size_t number_of_slots)
+  : resolution_(resolution), slots_(number_of_slots),
+    next_tick_(tick_of(std::chrono::steady_clock::now()))
+  {}
+
+  ~Wheel()
+  {
+    for (const auto & watch : watches_) {
+      auto subscription = watch->subscription.lock();
+      if (subscription) {
+        subscription->remove_deadline_watcher();
+      }
+    }
+  }
+
+  void
+  add(const WatchHandle & watch)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    watches_.insert(watch);
+    insert(watch, watch->start + watch->period);
+  }
+
+  void
+  remove(const WatchHandle & watch)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (0u == watches_.erase(watch)) {
+      throw std::runtime_error("Watch handle not found in this deadline monitor");
+    }
+    // Dropped from its slot when its tick is processed
+    watch->watched = false;
+    auto subscription = watch->subscription.lock();
+    if (subscription) {
+      subscription->remove_deadline_watcher();
+    }
+  }
+
+  size_t
+  size() const
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return watches_.size();
+  }
+
+  void
+  check(std::chrono::steady_clock::time_point now)
+  {
+    std::vector<std::pair<MissedDeadlineCallback, DeadlineMissedInfo>> missed;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      const int64_t last_tick = tick_of(now);
+      // Past one revolution, every slot is processed once
+      const int64_t first_tick =
+        std::max(next_tick_, last_tick - static_cast<int64_t>(slots_.size()) + 1);
+      for (int64_t tick = first_tick; tick <= last_tick; ++tick) {
+        // Moved out, since the watches which are not due yet may be inserted in the same slot
+        std::vector<WatchHandle> due;
+        due.swap(slots_[slot_of(tick)]);
+        for (auto & watch : due) {
+          process(watch, now, missed);
+        }
+      }
+      next_tick_ = std::max(next_tick_, last_tick + 1);
+    }
+    // Called without holding the lock, so that the callbacks can watch or unwatch
+    for (const auto & callback_and_info : missed) {
+      callback_and_info.first(callback_and_info.second);
+    }
+  }
+
+private:
+  int64_t
+  tick_of(std::chrono::steady_clock::time_point time) const
+  {
+    return time.time_since_epoch() / resolution_;
+  }
+
+  size_t
+  slot_of(int64_t tick) const
+  {
+    return static_cast<size_t>(tick) % slots_.size();
+  }
+
+  void
+  insert(const WatchHandle & watch, std::chrono::steady_clock::time_point deadline)
+  {
+    // A deadline in a tick already processed is checked in the next one
+    slots_[slot_of(std::max(tick_of(deadline), next_tick_))].push_back(watch);
+  }
+
+  void
+  process(
+    const WatchHandle & watch,
+    std::chrono::steady_clock::time_point now,
+    std::vector<std::pair<MissedDeadlineCallback, DeadlineMissedInfo>> & missed)
+  {
+    if (!watch->watched) {
+      return;
+    }
+    auto subscription = watch->subscription.lock();
+    if (!subscription) {
+      watches_.erase(watch);
+      return;
+    }
+    const auto last_message = std::max(
+      subscription->get_last_message_received_time(), watch->start);
+    const auto deadline = last_message + watch->period;
+    if (deadline > now) {
+      // Not due yet, or due in a later revolution of the wheel
+      insert(watch, deadline);
+      return;
+    }
+    watch->total_count++;
+    missed.emplace_back(
+      watch->callback,
+      DeadlineMissedInfo{watch->topic_name, watch->period, now - last_message, watch->total_count});
+    watch->start = now;
+    insert(watch, now + watch->period);
+  }
+
+  const std::chrono::nanoseconds resolution_;
+  mutable std::mutex mutex_;
+  std::unordered_set<WatchHandle> watches_;
+  std::vector<std::vector<WatchHandle>> slots_;
+  // First tick whose slot wasn't processed yet
+  int64_t next_tick_;
+};
+
+DeadlineMonitor::DeadlineMonitor(
+  rclcpp::node_interfaces::NodeBaseInterface::SharedPtr node_base,
+  rclcpp::node_interfaces::NodeTimersInterface::SharedPtr node_timers,
+  std::chrono::nanoseconds resolution,
+  size_t number_of_slots,
+  rclcpp::CallbackGroup::SharedPtr group)
+{
+  if (resolution <= std::chrono::nanoseconds::zero()) {
+    throw std::invalid_argument("the resolution of a deadline monitor must be positive");
+  }
+  if (0u == number_of_slots) {
+    throw std::invalid_argument("a deadline monitor needs at least one slot");
+  }
+  wheel_ = std::make_shared<Wheel>(resolution, number_of_slots);
+  std::weak_ptr<Wheel> weak_wheel = wheel_;
+  timer_ = rclcpp::create_wall_timer(
+    resolution,
+    [weak_wheel]() {
+      auto wheel = weak_wheel.lock();
+      if (wheel) {
+        wheel->check(std::chrono::steady_clock::now());
+      }
+    },
+    group, node_base.get(), node_timers.get());
+}
+
+DeadlineMonitor::~DeadlineMonitor()
+{
+  timer_->cancel();
+}
+
+DeadlineMonitor::WatchHandle
+DeadlineMonitor::watch(
+  const rclcpp::SubscriptionBase::SharedPtr & subscription,
+  std::chrono::nanoseconds period,
+  MissedDeadlineCallback callback)
+{
+  if (!subscription) {
+    throw std::invalid_argument("the watched subscription cannot be null");
+  }
+  if (period <= std::chrono::nanoseconds::zero()) {
+    throw std::invalid_argument("the deadline period must be positive");
+  }
+  if (!callback) {
+    throw std::invalid_argument("the missed deadline callback cannot be empty");
+  }
+  auto watch = std::make_shared<Watch>();
+  watch->subscription = subscription;
+  watch->topic_name = subscription->get_topic_name();
+  watch->period = period;
+  watch->callback = std::move(callback);
+  watch->start = std::chrono::steady_clock::now();
+  subscription->add_deadline_watcher();
+  wheel_->add(watch);
+  return watch;
+}
+
+void
+DeadlineMonitor::unwatch(const WatchHandle & handle)
+{
+  wheel_->remove(handle);
+}
+
+size_t
+DeadlineMonitor::size() const
+{
+  return wheel_->size();
+}
+
+void
+DeadlineMonitor::check_deadlines(std::chrono::steady_clock::time_point now)
+{
+  wheel_->check(now);
+}
+
+}  // namespace rclcpp
@@ -0,0 +1,119 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rclcpp/detail/async_publish_queue.hpp"
+
+#include <chrono>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "rclcpp/logging.hpp"
+
+using rclcpp::detail::AsyncPublishQueue;
+
+AsyncPublishQueue::AsyncPublishQueue(
+  size_t capacity, bool block_when_full, const std::string & topic_name)
+: capacity_(capacity), block_when_full_(block_when_full), topic_name_(topic_name)
+{
+  if (0u == capacity) {
+    throw std::invalid_argument("the asynchronous publish queue size must not be zero");
+  }
+  thread_ = std::thread(&AsyncPublishQueue::run, this);
+}
+
+AsyncPublishQueue::~AsyncPublishQueue()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  queued_cv_.notify_one();
+  thread_.join();
+}
+
+void
+AsyncPublishQueue::push(Publication publication)
+{
+  Publication dropped;
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (publications_.size() >= capacity_) {
+      if (block_when_full_) {
+        taken_cv_.wait(lock, [this]() {return publications_.size() < capacity_;});
+      } else {
+        // Released without the lock, it may hold the last reference to a large message
+        dropped = std::move(publications_.front());
+        publications_.pop_front();
+        dropped_count_++;
+      }
+    }
+    publications_.push_back(std::move(publication));
+  }
+  queued_cv_.notify_one();
+}
+
+uint64_t
+AsyncPublishQueue::get_dropped_count() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return dropped_count_;
+}
+
+bool
+AsyncPublishQueue::wait_until_empty(std::chrono::nanoseconds timeout)
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  auto is_empty = [this]() {return publications_.empty() && !executing_;};
+  if (timeout < std::chrono::nanoseconds(0)) {
+    taken_cv_.wait(lock, is_empty);
+    return true;
+  }
+  return taken_cv_.wait_for(lock, timeout, is_empty);
+}
+
+void
+AsyncPublishQueue::run()
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    queued_cv_.wait(lock, [this]() {return stop_ || !publications_.empty();});
+    if (publications_.empty()) {
+      // Stopped, once everything queued was published
+      return;
+    }
+    Publication publication = std::move(publications_.front());
+    publications_.pop_front();
+    executing_ = true;
+    lock.unlock();
+    taken_cv_.notify_all();
+
+    try {
+      publication();
+    } catch (const std::exception & exception) {
+      RCLCPP_ERROR(
+        rclcpp::get_logger("rclcpp"),
+        "failed to publish asynchronously on topic '%s': %s", topic_name_.c_str(),
+        exception.what());
+    }
+    // The message is released before waiters are told it was published
+    publication = nullptr;
+
+    lock.lock();
+    executing_ = false;
+    taken_cv_.notify_all();
+  }
+}
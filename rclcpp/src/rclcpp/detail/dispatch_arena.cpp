@@ -0,0 +1,200 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rclcpp/detail/dispatch_arena.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <stdexcept>
+
+namespace rclcpp
+{
+namespace detail
+{
+
+/// Header of a chunk, followed by its memory.
+struct DispatchArena::Chunk
+{
+  /// Number of live allocations of the chunk, plus one while the arena uses it.
+  std::atomic<size_t> references;
+  /// Size in bytes of the memory following the header.
+  size_t size;
+};
+
+namespace
+{
+
+// Each allocation is preceded by a pointer to its chunk
+constexpr size_t header_size = sizeof(void *);
+constexpr size_t chunk_alignment = alignof(std::max_align_t);
+
+size_t
+align_up(size_t value, size_t alignment)
+{
+  return (value + alignment - 1) & ~(alignment - 1);
+}
+
+}  // namespace
+
+DispatchArena::DispatchArena(size_t chunk_size)
+: chunk_size_(chunk_size), chunk_(nullptr), offset_(0)
+{
+  if (chunk_size == 0) {
+    throw std::invalid_argument("the chunk size of a dispatch arena must be positive");
+  }
+}
+
+DispatchArena::~DispatchArena()
+{
+  if (chunk_) {
+    release(chunk_);
+  }
+}
+
+void *
+DispatchArena::allocate(size_t size, size_t alignment)
+{
+  if (alignment < alignof(void *)) {
+    alignment = alignof(void *);
+  }
+  if (alignment > chunk_alignment ||
+    size > SIZE_MAX - header_size - alignment - sizeof(Chunk) - chunk_alignment)
+  {
+    throw std::bad_alloc();
+  }
+  const size_t data_offset = align_up(sizeof(Chunk), chunk_alignment);
+  const size_t required = size + header_size + alignment - 1;
+
+  Chunk * chunk = nullptr;
+  size_t offset = 0;
+  if (required > chunk_size_ / 4) {
+    // Large allocations get a chunk of their own, not to waste the remainder of the current one
+    chunk = static_cast<Chunk *>(::operator new(data_offset + required));
+    new (chunk) Chunk{{1}, required};
+  } else {
+    if (chunk_ && offset_ + required > chunk_->size) {
+      release(chunk_);
+      chunk_ = nullptr;
+    }
+    if (!chunk_) {
+      chunk_ = static_cast<Chunk *>(::operator new(data_offset + chunk_size_));
+      new (chunk_) Chunk{{1}, chunk_size_};
+      offset_ = 0;
+    }
+    chunk = chunk_;
+    offset = offset_;
+    chunk->references.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  char * memory = reinterpret_cast<char *>(chunk) + data_offset;
+  const uintptr_t begin = reinterpret_cast<uintptr_t>(memory + offset + header_size);
+  char * data = reinterpret_cast<char *>(align_up(begin, alignment));
+  *reinterpret_cast<Chunk **>(data - header_size) = chunk;
+  if (chunk == chunk_) {
+    offset_ = static_cast<size_t>(data + size - memory);
+  }
+  return data;
+}
+
+void
+DispatchArena::deallocate(void * pointer) noexcept
+{
+  if (pointer) {
+    release(*reinterpret_cast<Chunk **>(static_cast<char *>(pointer) - header_size));
+  }
+}
+
+void
+DispatchArena::reset()
+{
+  if (!chunk_) {
+    return;
+  }
+  // Synchronize with the deallocations made by other threads before reusing their memory
+  if (chunk_->references.load(std::memory_order_acquire) == 1) {
+    offset_ = 0;
+  } else {
+    release(chunk_);
+    chunk_ = nullptr;
+  }
+}
+
+size_t
+DispatchArena::get_chunk_size() const
+{
+  return chunk_size_;
+}
+
+void
+DispatchArena::release(Chunk * chunk) noexcept
+{
+  if (chunk->references.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    chunk->~Chunk();
+    ::operator delete(chunk);
+  }
+}
+
+namespace
+{
+
+struct ThreadDispatchArena
+{
+  std::unique_ptr<DispatchArena> arena;
+  DispatchArena * current = nullptr;
+};
+
+ThreadDispatchArena &
+get_thread_dispatch_arena()
+{
+  thread_local ThreadDispatchArena thread_arena;
+  return thread_arena;
+}
+
+}  // namespace
+
+DispatchArena *
+get_dispatch_arena()
+{
+  return get_thread_dispatch_arena().current;
+}
+
+DispatchArenaScope::DispatchArenaScope(size_t chunk_size)
+: active_(chunk_size != 0), previous_(nullptr)
+{
+  if (!active_) {
+    return;
+  }
+  ThreadDispatchArena & thread_arena = get_thread_dispatch_arena();
+  previous_ = thread_arena.current;
+  // Replacing the arena is safe, its chunks are freed with their last allocation
+  if (!previous_ &&
+    (!thread_arena.arena || thread_arena.arena->get_chunk_size() != chunk_size))
+  {
+    thread_arena.arena = std::make_unique<DispatchArena>(chunk_size);
+  }
+  thread_arena.current = thread_arena.arena.get();
+}
+
+DispatchArenaScope::~DispatchArenaScope()
+{
+  if (active_) {
+    get_thread_dispatch_arena().current = previous_;
+  }
+}
+
+}  // namespace detail
+}  // namespace rclcpp
@@ -16,33 +16,87 @@
 
 #include <string>
 #include <map>
+#include <memory>
+#include <regex>
+#include <utility>
 #include <vector>
 
 #include "rcl_yaml_param_parser/parser.h"
+#include "rcpputils/find_and_replace.hpp"
 #include "rcpputils/scope_exit.hpp"
 
 #include "rclcpp/parameter_map.hpp"
 
+rclcpp::detail::ParsedParameterOverrides::ParsedParameterOverrides(const rcl_arguments_t * args)
+{
+  rcl_params_t * params = NULL;
+  rcl_ret_t ret = rcl_arguments_get_param_overrides(args, &params);
+  if (RCL_RET_OK != ret) {
+    rclcpp::exceptions::throw_from_rcl_error(ret);
+  }
+  if (!params) {
+    return;
+  }
+  auto cleanup_params = rcpputils::make_scope_exit(
+    [params]() {
+      rcl_yaml_node_struct_fini(params);
+    });
+  // Keep the order of the node names, as later ones overwrite earlier ones
+  for (size_t n = 0; n < params->num_nodes; ++n) {
+    rcl_params_t single_node = *params;
+    single_node.num_nodes = 1;
+    single_node.node_names = &params->node_names[n];
+    single_node.params = &params->params[n];
+    for (auto & node_parameters : rclcpp::parameter_map_from(&single_node)) {
+      NodeOverrides node_overrides;
+      node_overrides.node_name = node_parameters.first;
+      if (node_overrides.node_name.find('*') != std::string::npos) {
+        // Same as parameter_map_from(): "/*" -> "(/\\w+)" and "/**" -> "(/\\w+)*"
+        node_overrides.pattern = std::make_unique<std::regex>(
+          rcpputils::find_and_replace(node_overrides.node_name, "/*", "(/\\w+)"));
+      }
+      node_overrides.parameters = std::move(node_parameters.second);
+      nodes_.push_back(std::move(node_overrides));
+    }
+  }
+}
+
+void
+rclcpp::detail::ParsedParameterOverrides::resolve(
+  const std::string & node_fqn, std::map<std::string, rclcpp::ParameterValue> & result) const
+{
+  for (const auto & node_overrides : nodes_) {
+    const bool matched = node_overrides.pattern ?
+      std::regex_match(node_fqn, *node_overrides.pattern) :
+      node_overrides.node_name == node_fqn;
+    if (!matched) {
+      continue;
+    }
+    // Combine parameter yaml files, overwriting values in older ones
+    for (const rclcpp::Parameter & param : node_overrides.parameters) {
+      result[param.get_name()] = param.get_parameter_value();
+    }
+  }
+}
+
 std::map<std::string, rclcpp::ParameterValue>
 rclcpp::detail::resolve_parameter_overrides(
   const std::string & node_fqn,
   const std::vector<rclcpp::Parameter> & parameter_overrides,
   const rcl_arguments_t * local_args,
-  const rcl_arguments_t * global_args)
+  rclcpp::Context * global_context)
 {
   std::map<std::string, rclcpp::ParameterValue> result;
 
   // global before local so that local overwrites global
-  std::array<const rcl_arguments_t *, 2> argument_sources = {global_args, local_args};
-
-  // Get fully qualified node name post-remapping to use to find node's params in yaml files
-
-  for (const rcl_arguments_t * source : argument_sources) {
-    if (!source) {
-      continue;
-    }
+  if (global_context) {
+    // Converted once per context, the global arguments are the same for all the nodes
+    global_context->get_sub_context<ParsedParameterOverrides>(
+      &global_context->get_rcl_context()->global_arguments)->resolve(node_fqn, result);
+  }
+  if (local_args) {
     rcl_params_t * params = NULL;
-    rcl_ret_t ret = rcl_arguments_get_param_overrides(source, &params);
+    rcl_ret_t ret = rcl_arguments_get_param_overrides(local_args, &params);
     if (RCL_RET_OK != ret) {
       rclcpp::exceptions::throw_from_rcl_error(ret);
     }
@@ -17,10 +17,13 @@
 
 #include <string>
 #include <map>
+#include <memory>
+#include <regex>
 #include <vector>
 
 #include "rcl/arguments.h"
 
+#include "rclcpp/context.hpp"
 #include "rclcpp/parameter.hpp"
 #include "rclcpp/parameter_value.hpp"
 #include "rclcpp/visibility_control.hpp"
@@ -29,14 +32,48 @@ namespace rclcpp
 {
 namespace detail
 {
+
+/// \internal Parameter overrides of the global arguments, converted once for all the nodes.
+/**
+ * Used as a sub-context, so that the parameter files given to the process are copied out of
+ * rcl and converted once per context, instead of once for every node.
+ */
+class ParsedParameterOverrides
+{
+public:
+  RCLCPP_LOCAL
+  explicit ParsedParameterOverrides(const rcl_arguments_t * args);
+
+  /// Set the overrides matching the node in result, the later ones overwriting the earlier.
+  RCLCPP_LOCAL
+  void
+  resolve(
+    const std::string & node_fqn, std::map<std::string, rclcpp::ParameterValue> & result) const;
+
+private:
+  /// Parameters of a node name of the parameter files, which may have wildcards.
+  struct NodeOverrides
+  {
+    std::string node_name;
+    // Only set for node names with wildcards, the others are compared as is
+    std::unique_ptr<std::regex> pattern;
+    std::vector<rclcpp::Parameter> parameters;
+  };
+
+  std::vector<NodeOverrides> nodes_;
+};
+
 /// \internal Get the parameter overrides from the arguments.
+/**
+ * \param[in] global_context the context whose global arguments are used, or nullptr
+ */
 RCLCPP_LOCAL
 std::map<std::string, rclcpp::ParameterValue>
 resolve_parameter_overrides(
   const std::string & node_name,
   const std::vector<rclcpp::Parameter> & parameter_overrides,
   const rcl_arguments_t * local_args,
-  const rcl_arguments_t * global_args);
+  rclcpp::Context * global_context);
 
 }  // namespace detail
 }  // namespace rclcpp
@@ -0,0 +1,51 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__DETAIL__SUB_NAMESPACE_HPP_
+#define RCLCPP__DETAIL__SUB_NAMESPACE_HPP_
+
+#include <string>
+
+#include "rclcpp/visibility_control.hpp"
+
+namespace rclcpp
+{
+namespace detail
+{
+
+/// \internal Extend a sub-namespace, which was already validated, by a relative namespace.
+/**
+ * \throws NameValidationError if the extension is empty or absolute
+ */
+RCLCPP_LOCAL
+std::string
+extend_sub_namespace(const std::string & existing_sub_namespace, const std::string & extension);
+
+/// \internal Get the namespace of the entities created with a sub-namespace of a node.
+RCLCPP_LOCAL
+std::string
+create_effective_namespace(const std::string & node_namespace, const std::string & sub_namespace);
+
+/// \internal Validate the namespace returned by create_effective_namespace().
+/**
+ * \throws InvalidNamespaceError if the namespace is invalid
+ */
+RCLCPP_LOCAL
+void
+validate_effective_namespace(const std::string & effective_namespace);
+
+}  // namespace detail
+}  // namespace rclcpp
+
+#endif  // RCLCPP__DETAIL__SUB_NAMESPACE_HPP_
@@ -42,8 +42,6 @@ Duration::Duration(std::chrono::nanoseconds nanoseconds)
   rcl_duration_.nanoseconds = nanoseconds.count();
 }
 
-Duration::Duration(const Duration & rhs) = default;
-
 Duration::Duration(
   const builtin_interfaces::msg::Duration & duration_msg)
 {
@@ -87,9 +85,6 @@ Duration::operator builtin_interfaces::msg::Duration() const
   return msg_duration;
 }
 
-Duration &
-Duration::operator=(const Duration & rhs) = default;
-
 Duration &
 Duration::operator=(const builtin_interfaces::msg::Duration & duration_msg)
 {
@@ -97,42 +92,6 @@ Duration::operator=(const builtin_interfaces::msg::Duration & duration_msg)
   return *this;
 }
 
-bool
-Duration::operator==(const rclcpp::Duration & rhs) const
-{
-  return rcl_duration_.nanoseconds == rhs.rcl_duration_.nanoseconds;
-}
-
-bool
-Duration::operator!=(const rclcpp::Duration & rhs) const
-{
-  return rcl_duration_.nanoseconds != rhs.rcl_duration_.nanoseconds;
-}
-
-bool
-Duration::operator<(const rclcpp::Duration & rhs) const
-{
-  return rcl_duration_.nanoseconds < rhs.rcl_duration_.nanoseconds;
-}
-
-bool
-Duration::operator<=(const rclcpp::Duration & rhs) const
-{
-  return rcl_duration_.nanoseconds <= rhs.rcl_duration_.nanoseconds;
-}
-
-bool
-Duration::operator>=(const rclcpp::Duration & rhs) const
-{
-  return rcl_duration_.nanoseconds >= rhs.rcl_duration_.nanoseconds;
-}
-
-bool
-Duration::operator>(const rclcpp::Duration & rhs) const
-{
-  return rcl_duration_.nanoseconds > rhs.rcl_duration_.nanoseconds;
-}
-
 void
 bounds_check_duration_sum(int64_t lhsns, int64_t rhsns, uint64_t max)
 {
@@ -243,12 +202,6 @@ Duration::operator*=(double scale)
   return *this;
 }
 
-rcl_duration_value_t
-Duration::nanoseconds() const
-{
-  return rcl_duration_.nanoseconds;
-}
-
 Duration
 Duration::max()
 {
@@ -308,12 +261,4 @@ Duration::from_seconds(double seconds)
   return ret;
 }
 
-Duration
-Duration::from_nanoseconds(rcl_duration_value_t nanoseconds)
-{
-  Duration ret;
-  ret.rcl_duration_.nanoseconds = nanoseconds;
-  return ret;
-}
-
 }  // namespace rclcpp
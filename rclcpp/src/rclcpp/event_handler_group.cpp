@@ -0,0 +1,196 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rclcpp/event_handler_group.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace rclcpp
+{
+
+EventHandlerGroup::~EventHandlerGroup()
+{
+  // The handlers outlive the group, their callbacks mustn't call the group anymore
+  clear_on_ready_callback();
+}
+
+void
+EventHandlerGroup::add_event_handler(std::shared_ptr<rclcpp::EventHandlerBase> event_handler)
+{
+  if (!event_handler) {
+    throw std::invalid_argument("event handler is nullptr");
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (on_ready_callback_) {
+    set_handler_on_ready_callback(*event_handler, event_handlers_.size());
+  }
+  event_handlers_.push_back(event_handler);
+}
+
+size_t
+EventHandlerGroup::size() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return static_cast<size_t>(
+    std::count_if(
+      event_handlers_.begin(), event_handlers_.end(),
+      [](const auto & weak_handler) {return !weak_handler.expired();}));
+}
+
+size_t
+EventHandlerGroup::get_number_of_ready_events()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!on_ready_callback_) {
+    event_handlers_.erase(
+      std::remove_if(
+        event_handlers_.begin(), event_handlers_.end(),
+        [](const auto & weak_handler) {return weak_handler.expired();}),
+      event_handlers_.end());
+  }
+  // Handlers added after this call aren't added to the wait set sized with this count
+  number_of_waited_handlers_ = event_handlers_.size();
+  size_t number_of_events = 0;
+  for (const auto & weak_handler : event_handlers_) {
+    auto event_handler = weak_handler.lock();
+    if (event_handler) {
+      number_of_events += event_handler->get_number_of_ready_events();
+    }
+  }
+  return number_of_events;
+}
+
+void
+EventHandlerGroup::add_to_wait_set(rcl_wait_set_t * wait_set)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (size_t i = 0; i < number_of_waited_handlers_; ++i) {
+    auto event_handler = event_handlers_[i].lock();
+    if (event_handler) {
+      event_handler->add_to_wait_set(wait_set);
+    }
+  }
+}
+
+bool
+EventHandlerGroup::is_ready(rcl_wait_set_t * wait_set)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  ready_handlers_.clear();
+  for (size_t i = 0; i < number_of_waited_handlers_; ++i) {
+    auto event_handler = event_handlers_[i].lock();
+    if (event_handler && event_handler->is_ready(wait_set)) {
+      ready_handlers_.push_back(std::move(event_handler));
+    }
+  }
+  return !ready_handlers_.empty();
+}
+
+std::shared_ptr<void>
+EventHandlerGroup::take_data()
+{
+  std::vector<std::shared_ptr<rclcpp::EventHandlerBase>> ready_handlers;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ready_handlers.swap(ready_handlers_);
+  }
+  auto taken_events = std::make_shared<TakenEvents>();
+  taken_events->events.reserve(ready_handlers.size());
+  for (auto & event_handler : ready_handlers) {
+    auto data = event_handler->take_data();
+    if (data) {
+      taken_events->events.emplace_back(std::move(event_handler), std::move(data));
+    }
+  }
+  return taken_events;
+}
+
+std::shared_ptr<void>
+EventHandlerGroup::take_data_by_entity_id(size_t id)
+{
+  std::shared_ptr<rclcpp::EventHandlerBase> event_handler;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (id < event_handlers_.size()) {
+      event_handler = event_handlers_[id].lock();
+    }
+  }
+  auto taken_events = std::make_shared<TakenEvents>();
+  if (event_handler) {
+    auto data = event_handler->take_data();
+    if (data) {
+      taken_events->events.emplace_back(std::move(event_handler), std::move(data));
+    }
+  }
+  return taken_events;
+}
+
+void
+EventHandlerGroup::execute(std::shared_ptr<void> & data)
+{
+  if (!data) {
+    throw std::runtime_error("'data' is empty");
+  }
+  auto taken_events = std::static_pointer_cast<TakenEvents>(data);
+  for (auto & handler_and_data : taken_events->events) {
+    handler_and_data.first->execute(handler_and_data.second);
+  }
+}
+
+void
+EventHandlerGroup::set_on_ready_callback(std::function<void(size_t, int)> callback)
+{
+  if (!callback) {
+    throw std::invalid_argument(
+            "The callback passed to set_on_ready_callback "
+            "is not callable.");
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  on_ready_callback_ = callback;
+  for (size_t i = 0; i < event_handlers_.size(); ++i) {
+    auto event_handler = event_handlers_[i].lock();
+    if (event_handler) {
+      set_handler_on_ready_callback(*event_handler, i);
+    }
+  }
+}
+
+void
+EventHandlerGroup::clear_on_ready_callback()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  on_ready_callback_ = nullptr;
+  for (const auto & weak_handler : event_handlers_) {
+    auto event_handler = weak_handler.lock();
+    if (event_handler) {
+      event_handler->clear_on_ready_callback();
+    }
+  }
+}
+
+void
+EventHandlerGroup::set_handler_on_ready_callback(
+  rclcpp::EventHandlerBase & event_handler, size_t index)
+{
+  event_handler.set_on_ready_callback(
+    [callback = on_ready_callback_, index](size_t number_of_events, int) {
+      callback(number_of_events, static_cast<int>(index));
+    });
+}
+
+}  // namespace rclcpp
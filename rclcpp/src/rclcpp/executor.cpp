@@ -13,53 +13,329 @@
 // limitations under the License.
 
 #include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
 #include <memory>
 #include <map>
+#include <new>
+#include <new>
+#include <shared_mutex>
+#include <stdexcept>
 #include <string>
 #include <type_traits>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
+#if defined(__linux__)
+#include <alloca.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
 #include "rcl/allocator.h"
 #include "rcl/error_handling.h"
 #include "rcpputils/scope_exit.hpp"
 
+#include "rclcpp/allocation_tracking.hpp"
+#include "rclcpp/content_filter.hpp"
+#include "rclcpp/detail/dispatch_arena.hpp"
 #include "rclcpp/dynamic_typesupport/dynamic_message.hpp"
 #include "rclcpp/exceptions.hpp"
 #include "rclcpp/executor.hpp"
 #include "rclcpp/guard_condition.hpp"
+#include "rclcpp/lock_profiling.hpp"
 #include "rclcpp/memory_strategy.hpp"
 #include "rclcpp/node.hpp"
+#include "rclcpp/serialization.hpp"
+#include "rclcpp/serialized_message.hpp"
+#include "rclcpp/tracing.hpp"
 #include "rclcpp/utilities.hpp"
 
 #include "rcutils/logging_macros.h"
 
-#include "tracetools/tracetools.h"
-
 using namespace std::chrono_literals;
 
 using rclcpp::exceptions::throw_from_rcl_error;
 using rclcpp::Executor;
+using rclcpp::lock_profiling::ProfiledLockGuard;
+
+namespace
+{
+
+/// Describe the entity executed by the given executable, for error messages.
+std::string
+describe_executable(const rclcpp::AnyExecutable & any_exec)
+{
+  if (any_exec.timer) {
+    return "executing a timer";
+  } else if (any_exec.subscription) {
+    return std::string("executing the subscription to '") +
+           any_exec.subscription->get_topic_name() + "'";
+  } else if (any_exec.service) {
+    return std::string("executing the service '") + any_exec.service->get_service_name() + "'";
+  } else if (any_exec.client) {
+    return std::string("executing the client of '") + any_exec.client->get_service_name() + "'";
+  }
+  return "executing a waitable";
+}
+
+/// Get the kind of the entity executed by the given executable.
+rclcpp::CallbackStatistics::EntityType
+get_entity_type(const rclcpp::AnyExecutable & any_exec)
+{
+  using EntityType = rclcpp::CallbackStatistics::EntityType;
+  if (any_exec.timer) {
+    return EntityType::Timer;
+  } else if (any_exec.subscription) {
+    return EntityType::Subscription;
+  } else if (any_exec.service) {
+    return EntityType::Service;
+  } else if (any_exec.client) {
+    return EntityType::Client;
+  }
+  return EntityType::Waitable;
+}
+
+#if defined(__linux__)
+size_t
+get_page_size()
+{
+  const long page_size = sysconf(_SC_PAGESIZE);  // NOLINT(runtime/int)
+  return page_size > 0 ? static_cast<size_t>(page_size) : 4096u;
+}
+
+/// Get the stack size of the calling thread, or 0 if it's unknown.
+size_t
+get_thread_stack_size()
+{
+  pthread_attr_t attributes;
+  if (pthread_getattr_np(pthread_self(), &attributes) != 0) {
+    return 0;
+  }
+  void * stack_address = nullptr;
+  size_t stack_size = 0;
+  if (pthread_attr_getstack(&attributes, &stack_address, &stack_size) != 0) {
+    stack_size = 0;
+  }
+  pthread_attr_destroy(&attributes);
+  return stack_size;
+}
+#endif
+
+/// Touch each page of the given size of stack, not inlined so that the stack is released after.
+#if defined(__GNUC__)
+__attribute__((noinline))
+#endif
+void
+prefault_stack(size_t size)
+{
+#if defined(__linux__)
+  volatile char * stack = static_cast<volatile char *>(alloca(size));
+  const size_t page_size = get_page_size();
+  for (size_t offset = 0; offset < size; offset += page_size) {
+    stack[offset] = 0;
+  }
+#else
+  (void)size;
+  throw std::runtime_error("prefaulting the stack is only supported on Linux");
+#endif
+}
+
+/// Allocate and touch the given size of heap, which is kept by the process once released.
+void
+prefault_heap(size_t size)
+{
+#if defined(__GLIBC__)
+  // Neither give the released memory back to the system nor map large allocations separately
+  if (mallopt(M_TRIM_THRESHOLD, -1) == 0 || mallopt(M_MMAP_MAX, 0) == 0) {
+    throw std::runtime_error("failed to configure malloc to keep the heap");
+  }
+  volatile char * heap = static_cast<volatile char *>(std::malloc(size));
+  if (nullptr == heap) {
+    throw std::bad_alloc();
+  }
+  const size_t page_size = get_page_size();
+  for (size_t offset = 0; offset < size; offset += page_size) {
+    heap[offset] = 0;
+  }
+  std::free(const_cast<char *>(heap));
+#else
+  (void)size;
+  throw std::runtime_error("prefaulting the heap is only supported with glibc");
+#endif
+}
+
+void
+lock_memory()
+{
+#if defined(__linux__)
+  if (mlockall(MCL_CURRENT | MCL_FUTURE) != 0) {
+    throw std::runtime_error(std::string("failed to lock the memory: ") + std::strerror(errno));
+  }
+#else
+  throw std::runtime_error("locking the memory is only supported on Linux");
+#endif
+}
 
-class rclcpp::ExecutorImplementation {};
+}  // namespace
+
+class rclcpp::ExecutorImplementation
+{
+public:
+  explicit ExecutorImplementation(const rclcpp::ExecutorOptions & options)
+  : collect_callback_statistics(options.collect_callback_statistics),
+    dispatch_arena_chunk_size(options.dispatch_arena_chunk_size),
+    fair_scheduling_quantum(options.fair_scheduling_quantum)
+  {
+    if (options.flight_recorder_size > 0) {
+      flight_recorder = std::make_shared<rclcpp::FlightRecorder>(options.flight_recorder_size);
+    }
+    if (options.fair_scheduling &&
+      fair_scheduling_quantum <= std::chrono::nanoseconds::zero())
+    {
+      throw std::invalid_argument("fair_scheduling_quantum must be positive");
+    }
+    if (options.busy_wait_duration < std::chrono::nanoseconds::zero()) {
+      throw std::invalid_argument("busy_wait_duration must not be negative");
+    }
+  }
+
+  /// Get the statistics of the entity executed by the given executable, creating them if needed.
+  rclcpp::CallbackStatistics::SharedPtr
+  get_callback_statistics(const rclcpp::AnyExecutable & any_exec)
+  {
+    using EntityType = rclcpp::CallbackStatistics::EntityType;
+    const void * entity = nullptr;
+    if (any_exec.timer) {
+      entity = any_exec.timer.get();
+    } else if (any_exec.subscription) {
+      entity = any_exec.subscription.get();
+    } else if (any_exec.service) {
+      entity = any_exec.service.get();
+    } else if (any_exec.client) {
+      entity = any_exec.client.get();
+    } else if (any_exec.waitable) {
+      entity = any_exec.waitable.get();
+    } else {
+      return nullptr;
+    }
+
+    {
+      std::shared_lock<std::shared_mutex> lock(callback_statistics_mutex);
+      auto it = callback_statistics.find(entity);
+      if (it != callback_statistics.end()) {
+        return it->second;
+      }
+    }
+
+    rclcpp::CallbackStatistics::SharedPtr statistics;
+    if (any_exec.timer) {
+      statistics = std::make_shared<rclcpp::CallbackStatistics>(EntityType::Timer, "");
+    } else if (any_exec.subscription) {
+      statistics = std::make_shared<rclcpp::CallbackStatistics>(
+        EntityType::Subscription, any_exec.subscription->get_topic_name());
+    } else if (any_exec.service) {
+      statistics = std::make_shared<rclcpp::CallbackStatistics>(
+        EntityType::Service, any_exec.service->get_service_name());
+    } else if (any_exec.client) {
+      statistics = std::make_shared<rclcpp::CallbackStatistics>(
+        EntityType::Client, any_exec.client->get_service_name());
+    } else {
+      statistics = std::make_shared<rclcpp::CallbackStatistics>(EntityType::Waitable, "");
+    }
+    std::unique_lock<std::shared_mutex> lock(callback_statistics_mutex);
+    // Another thread may have executed the same entity meanwhile
+    auto result = callback_statistics.emplace(entity, std::move(statistics));
+    return result.first->second;
+  }
+
+  /// If true, callback statistics are recorded.
+  const bool collect_callback_statistics;
+  /// Size of the chunks of the dispatch arenas, 0 if they are disabled.
+  const size_t dispatch_arena_chunk_size;
+  /// Time when the last wait for work ended, in nanoseconds of the steady clock.
+  std::atomic<int64_t> last_wait_end_time {0};
+  /// Number of calls of wait_for_work().
+  std::atomic<uint64_t> wait_count {0};
+  /// Size of the stack prefaulted by the threads of the executor, set by warm_up().
+  std::atomic<size_t> stack_prefault_size {0};
+  /// Recorder of the executed callbacks, nullptr if it's disabled.
+  rclcpp::FlightRecorder::SharedPtr flight_recorder;
+
+  mutable std::shared_mutex callback_statistics_mutex;
+  std::unordered_map<const void *, rclcpp::CallbackStatistics::SharedPtr> callback_statistics;
+
+  /// Share of an entity in the fair scheduling.
+  struct FairShare
+  {
+    /// Time the entity may still spend in callbacks in this round, negative when in debt.
+    std::chrono::nanoseconds credit;
+    /// Value of fair_scheduling_turn when the entity was last taken.
+    uint64_t last_turn;
+    /// Value of fair_scheduling_round when the entity was last credited.
+    uint64_t round;
+  };
+
+  /// Get the share of the entity, a new entity starting with a full quantum.
+  FairShare &
+  get_fair_share(const void * entity)
+  {
+    auto result = fair_shares.emplace(
+      entity, FairShare{fair_scheduling_quantum, 0, fair_scheduling_round});
+    return result.first->second;
+  }
+
+  /// Deduct the time spent executing a callback of the entity from its credit.
+  void
+  charge_fair_share(const void * entity, std::chrono::nanoseconds duration)
+  {
+    std::lock_guard<std::mutex> lock(fair_shares_mutex);
+    auto it = fair_shares.find(entity);
+    // Dropped when a round started while its callback was executing, the debt is forgiven
+    if (it != fair_shares.end()) {
+      it->second.credit -= duration;
+    }
+  }
+
+  const std::chrono::nanoseconds fair_scheduling_quantum;
+
+  /// Statistics of the acquisitions of Executor::mutex_ by the executor itself.
+  const rclcpp::lock_profiling::LockProfile mutex_profile{"rclcpp::Executor::mutex_"};
+
+  /// Also locked while Executor::mutex_ is held, never the other way around.
+  std::mutex fair_shares_mutex;
+  std::unordered_map<const void *, FairShare> fair_shares;
+  uint64_t fair_scheduling_turn {0};
+  uint64_t fair_scheduling_round {0};
+};
 
 Executor::Executor(const rclcpp::ExecutorOptions & options)
 : spinning(false),
   interrupt_guard_condition_(std::make_shared<rclcpp::GuardCondition>(options.context)),
   shutdown_guard_condition_(std::make_shared<rclcpp::GuardCondition>(options.context)),
   memory_strategy_(options.memory_strategy),
-  impl_(std::make_unique<rclcpp::ExecutorImplementation>())
+  thread_attributes_(options.thread_attributes),
+  priority_scheduling_(options.priority_scheduling),
+  fair_scheduling_(options.fair_scheduling),
+  busy_wait_duration_(options.busy_wait_duration),
+  impl_(std::make_unique<rclcpp::ExecutorImplementation>(options))
 {
   // Store the context for later use.
   context_ = options.context;
 
-  shutdown_callback_handle_ = context_->add_on_shutdown_callback(
-    [weak_gc = std::weak_ptr<rclcpp::GuardCondition>{shutdown_guard_condition_}]() {
-      auto strong_gc = weak_gc.lock();
-      if (strong_gc) {
-        strong_gc->trigger();
-      }
-    });
+  // Every executed callback and entity change interrupts the wait, once is enough
+  interrupt_guard_condition_->set_trigger_coalescing(true);
+
+  context_->add_shutdown_guard_condition(shutdown_guard_condition_);
 
   // The number of guard conditions is always at least 2: 1 for the ctrl-c guard cond,
   // and one for the executor's guard cond (interrupt_guard_condition_)
@@ -130,12 +406,11 @@ Executor::~Executor()
   memory_strategy_->remove_guard_condition(shutdown_guard_condition_.get());
   memory_strategy_->remove_guard_condition(interrupt_guard_condition_.get());
 
-  // Remove shutdown callback handle registered to Context
-  if (!context_->remove_on_shutdown_callback(shutdown_callback_handle_)) {
+  // Remove the shutdown guard condition registered to Context
+  if (!context_->remove_shutdown_guard_condition(shutdown_guard_condition_.get())) {
     RCUTILS_LOG_ERROR_NAMED(
       "rclcpp",
-      "failed to remove registered on_shutdown callback");
-    rcl_reset_error();
+      "failed to remove registered shutdown guard condition");
   }
 }
 
@@ -143,7 +418,7 @@ std::vector<rclcpp::CallbackGroup::WeakPtr>
 Executor::get_all_callback_groups()
 {
   std::vector<rclcpp::CallbackGroup::WeakPtr> groups;
-  std::lock_guard<std::mutex> guard{mutex_};
+  ProfiledLockGuard guard{mutex_, impl_->mutex_profile};
   for (const auto & group_node_ptr : weak_groups_associated_with_executor_to_nodes_) {
     groups.push_back(group_node_ptr.first);
   }
@@ -157,7 +432,7 @@ std::vector<rclcpp::CallbackGroup::WeakPtr>
 Executor::get_manually_added_callback_groups()
 {
   std::vector<rclcpp::CallbackGroup::WeakPtr> groups;
-  std::lock_guard<std::mutex> guard{mutex_};
+  ProfiledLockGuard guard{mutex_, impl_->mutex_profile};
   for (auto const & group_node_ptr : weak_groups_associated_with_executor_to_nodes_) {
     groups.push_back(group_node_ptr.first);
   }
@@ -168,7 +443,7 @@ std::vector<rclcpp::CallbackGroup::WeakPtr>
 Executor::get_automatically_added_callback_groups_from_nodes()
 {
   std::vector<rclcpp::CallbackGroup::WeakPtr> groups;
-  std::lock_guard<std::mutex> guard{mutex_};
+  ProfiledLockGuard guard{mutex_, impl_->mutex_profile};
   for (auto const & group_node_ptr : weak_groups_to_nodes_associated_with_executor_) {
     groups.push_back(group_node_ptr.first);
   }
@@ -247,7 +522,7 @@ Executor::add_callback_group(
   rclcpp::node_interfaces::NodeBaseInterface::SharedPtr node_ptr,
   bool notify)
 {
-  std::lock_guard<std::mutex> guard{mutex_};
+  ProfiledLockGuard guard{mutex_, impl_->mutex_profile};
   this->add_callback_group_to_map(
     group_ptr,
     node_ptr,
@@ -265,7 +540,7 @@ Executor::add_node(rclcpp::node_interfaces::NodeBaseInterface::SharedPtr node_pt
             std::string("Node '") + node_ptr->get_fully_qualified_name() +
             "' has already been added to an executor.");
   }
-  std::lock_guard<std::mutex> guard{mutex_};
+  ProfiledLockGuard guard{mutex_, impl_->mutex_profile};
   node_ptr->for_each_callback_group(
     [this, node_ptr, notify](rclcpp::CallbackGroup::SharedPtr group_ptr)
     {
@@ -284,7 +559,7 @@ Executor::add_node(rclcpp::node_interfaces::NodeBaseInterface::SharedPtr node_pt
   weak_nodes_to_guard_conditions_[node_ptr] = gc.get();
   // Add the node's notify condition to the guard condition handles
   memory_strategy_->add_guard_condition(*gc);
-  weak_nodes_.push_back(node_ptr);
+  weak_nodes_.insert(node_ptr);
 }
 
 void
@@ -309,9 +584,17 @@ Executor::remove_callback_group_from_map(
     throw std::runtime_error("Callback group needs to be associated with executor.");
   }
   // If the node was matched and removed, interrupt waiting.
-  if (!has_node(node_ptr, weak_groups_to_nodes_associated_with_executor_) &&
-    !has_node(node_ptr, weak_groups_associated_with_executor_to_nodes_))
-  {
+  // Only the callback groups of the node are looked up in weak_groups_to_nodes_, which holds
+  // the groups of both maps, rather than scanning the groups of every node with has_node().
+  bool node_has_groups = false;
+  node_ptr->for_each_callback_group(
+    [this, &node_ptr, &node_has_groups](rclcpp::CallbackGroup::SharedPtr other_group_ptr)
+    {
+      auto other_iter = weak_groups_to_nodes_.find(other_group_ptr);
+      node_has_groups = node_has_groups ||
+      (other_iter != weak_groups_to_nodes_.end() && other_iter->second.lock() == node_ptr);
+    });
+  if (!node_has_groups) {
     auto iter = weak_groups_to_guard_conditions_.find(weak_group_ptr);
     if (iter != weak_groups_to_guard_conditions_.end()) {
       memory_strategy_->remove_guard_condition(iter->second);
@@ -335,7 +618,7 @@ Executor::remove_callback_group(
   rclcpp::CallbackGroup::SharedPtr group_ptr,
   bool notify)
 {
-  std::lock_guard<std::mutex> guard{mutex_};
+  ProfiledLockGuard guard{mutex_, impl_->mutex_profile};
   this->remove_callback_group_from_map(
     group_ptr,
     weak_groups_associated_with_executor_to_nodes_,
@@ -355,37 +638,29 @@ Executor::remove_node(rclcpp::node_interfaces::NodeBaseInterface::SharedPtr node
     throw std::runtime_error("Node needs to be associated with an executor.");
   }
 
-  std::lock_guard<std::mutex> guard{mutex_};
-  bool found_node = false;
-  auto node_it = weak_nodes_.begin();
-  while (node_it != weak_nodes_.end()) {
-    bool matched = (node_it->lock() == node_ptr);
-    if (matched) {
-      found_node = true;
-      node_it = weak_nodes_.erase(node_it);
-    } else {
-      ++node_it;
-    }
-  }
-  if (!found_node) {
+  ProfiledLockGuard guard{mutex_, impl_->mutex_profile};
+  if (weak_nodes_.erase(node_ptr) == 0) {
     throw std::runtime_error("Node needs to be associated with this executor.");
   }
 
-  for (auto it = weak_groups_to_nodes_associated_with_executor_.begin();
-    it != weak_groups_to_nodes_associated_with_executor_.end(); )
-  {
-    auto weak_node_ptr = it->second;
-    auto shared_node_ptr = weak_node_ptr.lock();
-    auto group_ptr = it->first.lock();
-
-    // Increment iterator before removing in case it's invalidated
-    it++;
-    if (shared_node_ptr == node_ptr) {
-      remove_callback_group_from_map(
-        group_ptr,
-        weak_groups_to_nodes_associated_with_executor_,
-        notify);
-    }
+  // Look up the callback groups of the node, rather than scanning the groups of every node.
+  // They are removed once collected, as removing a group iterates over the groups of the node.
+  std::vector<rclcpp::CallbackGroup::SharedPtr> groups_to_remove;
+  node_ptr->for_each_callback_group(
+    [this, &node_ptr, &groups_to_remove](rclcpp::CallbackGroup::SharedPtr group_ptr)
+    {
+      auto iter = weak_groups_to_nodes_associated_with_executor_.find(group_ptr);
+      if (iter != weak_groups_to_nodes_associated_with_executor_.end() &&
+      iter->second.lock() == node_ptr)
+      {
+        groups_to_remove.push_back(group_ptr);
+      }
+    });
+  for (const auto & group_ptr : groups_to_remove) {
+    remove_callback_group_from_map(
+      group_ptr,
+      weak_groups_to_nodes_associated_with_executor_,
+      notify);
   }
 
   memory_strategy_->remove_guard_condition(node_ptr->get_shared_notify_guard_condition().get());
@@ -447,6 +722,63 @@ Executor::spin_node_all(std::shared_ptr<rclcpp::Node> node, std::chrono::nanosec
   this->spin_node_all(node->get_node_base_interface(), max_duration);
 }
 
+void
+Executor::warm_up(const rclcpp::WarmUpOptions & options)
+{
+  if (spinning.exchange(true)) {
+    throw std::runtime_error("warm_up() called while already spinning");
+  }
+  RCPPUTILS_SCOPE_EXIT(this->spinning.store(false); );
+
+#if defined(__linux__)
+  const size_t stack_size = get_thread_stack_size();
+  if (stack_size > 0 && options.stack_prefault_size >= stack_size) {
+    throw std::invalid_argument("stack_prefault_size must be smaller than the stack");
+  }
+#endif
+
+  this->prepare_entities();
+
+  // Locked first, so that the pages prefaulted below stay resident
+  if (options.lock_memory) {
+    lock_memory();
+  }
+  if (options.heap_prefault_size > 0) {
+    prefault_heap(options.heap_prefault_size);
+  }
+  if (options.stack_prefault_size > 0) {
+    prefault_stack(options.stack_prefault_size);
+  }
+  impl_->stack_prefault_size.store(options.stack_prefault_size, std::memory_order_relaxed);
+
+  if (options.enter_steady_state) {
+    rclcpp::allocation_tracking::enter_steady_state();
+  }
+}
+
+void
+Executor::prepare_entities()
+{
+  this->wait_for_work(std::chrono::nanoseconds(0));
+}
+
+void
+Executor::prefault_thread_stack()
+{
+  size_t size = impl_->stack_prefault_size.load(std::memory_order_relaxed);
+  if (0 == size) {
+    return;
+  }
+#if defined(__linux__)
+  // The threads may have been given smaller stacks than the thread which warmed up
+  const size_t stack_size = get_thread_stack_size();
+  if (stack_size > 0) {
+    size = std::min(size, stack_size / 2);
+  }
+#endif
+  prefault_stack(size);
+}
+
 void Executor::spin_all(std::chrono::nanoseconds max_duration)
 {
   if (max_duration < 0ns) {
@@ -530,7 +862,7 @@ Executor::set_memory_strategy(rclcpp::memory_strategy::MemoryStrategy::SharedPtr
   if (memory_strategy == nullptr) {
     throw std::runtime_error("Received NULL memory strategy in executor.");
   }
-  std::lock_guard<std::mutex> guard{mutex_};
+  ProfiledLockGuard guard{mutex_, impl_->mutex_profile};
   memory_strategy_ = memory_strategy;
 }
 
@@ -540,14 +872,46 @@ Executor::execute_any_executable(AnyExecutable & any_exec)
   if (!spinning.load()) {
     return;
   }
+
+  // Owned here, as statistics may be reset while the callback is executing
+  rclcpp::CallbackStatistics::SharedPtr statistics;
+  std::chrono::steady_clock::time_point start_time;
+  if (fair_scheduling_) {
+    start_time = std::chrono::steady_clock::now();
+  }
+  if (impl_->collect_callback_statistics) {
+    statistics = impl_->get_callback_statistics(any_exec);
+    start_time = std::chrono::steady_clock::now();
+    const std::chrono::nanoseconds wait_end_time(
+      impl_->last_wait_end_time.load(std::memory_order_relaxed));
+    if (statistics && wait_end_time.count() != 0) {
+      statistics->wait_latency.record(start_time.time_since_epoch() - wait_end_time);
+    }
+  }
+
+  rclcpp::FlightRecorder::Token flight_record;
+  if (impl_->flight_recorder) {
+    flight_record = impl_->flight_recorder->start(
+      get_entity_type(any_exec), any_exec.get_entity());
+  }
+
+  const rclcpp::detail::DispatchArenaScope arena_scope(impl_->dispatch_arena_chunk_size);
+  const rclcpp::allocation_tracking::AllocationCounter allocations;
   if (any_exec.timer) {
-    TRACETOOLS_TRACEPOINT(
+    RCLCPP_TRACEPOINT(
+      Executor,
       rclcpp_executor_execute,
       static_cast<const void *>(any_exec.timer->get_timer_handle().get()));
     execute_timer(any_exec.timer);
+    if (statistics) {
+      const rclcpp::TimerInfo info = any_exec.timer->get_last_call_info();
+      statistics->timer_lateness.record(info.lateness);
+      statistics->timer_missed_periods.fetch_add(info.missed_periods, std::memory_order_relaxed);
+    }
   }
   if (any_exec.subscription) {
-    TRACETOOLS_TRACEPOINT(
+    RCLCPP_TRACEPOINT(
+      Executor,
       rclcpp_executor_execute,
       static_cast<const void *>(any_exec.subscription->get_subscription_handle().get()));
     execute_subscription(any_exec.subscription);
@@ -561,22 +925,52 @@ Executor::execute_any_executable(AnyExecutable & any_exec)
   if (any_exec.waitable) {
     any_exec.waitable->execute(any_exec.data);
   }
+  rclcpp::detail::DispatchArena * arena = rclcpp::detail::get_dispatch_arena();
+  if (arena) {
+    // The data taken for the waitable was consumed, so that its chunk can be reused
+    any_exec.data.reset();
+    arena->reset();
+  }
+  if (impl_->flight_recorder) {
+    impl_->flight_recorder->end(flight_record);
+  }
+
+  const uint64_t allocation_count = allocations.get_count();
+  if (statistics || fair_scheduling_) {
+    const auto execution_time = std::chrono::steady_clock::now() - start_time;
+    if (statistics) {
+      statistics->execution_time.record(execution_time);
+      statistics->allocation_count.fetch_add(allocation_count, std::memory_order_relaxed);
+    }
+    if (fair_scheduling_) {
+      impl_->charge_fair_share(any_exec.get_entity(), execution_time);
+    }
+  }
+
   // Reset the callback_group, regardless of type
-  any_exec.callback_group->can_be_taken_from().store(true);
-  // Wake the wait, because it may need to be recalculated or work that
-  // was previously blocked is now available.
-  try {
-    interrupt_guard_condition_->trigger();
-  } catch (const rclcpp::exceptions::RCLError & ex) {
-    throw std::runtime_error(
-            std::string(
-              "Failed to trigger guard condition from execute_any_executable: ") + ex.what());
+  const bool group_released = any_exec.callback_group->finish_callback(any_exec.get_entity());
+  // Wake the wait if it left out the entities of the group, which may have work blocked until
+  // now. Otherwise the wait already includes them, and waking it would only make another thread
+  // build the wait set again for nothing, for every executed callback.
+  if (group_released) {
+    try {
+      interrupt_guard_condition_->trigger();
+    } catch (const rclcpp::exceptions::RCLError & ex) {
+      throw std::runtime_error(
+              std::string(
+                "Failed to trigger guard condition from execute_any_executable: ") + ex.what());
+    }
+  }
+
+  if (allocation_count != 0 && rclcpp::allocation_tracking::is_steady_state()) {
+    throw rclcpp::exceptions::AllocationInSteadyStateError(
+            allocation_count, describe_executable(any_exec));
   }
 }
 
 template<typename Taker, typename Handler>
 static
-void
+bool
 take_and_do_error_handling(
   const char * action_description,
   const char * topic_or_service_name,
@@ -609,15 +1003,58 @@ take_and_do_error_handling(
       action_description,
       topic_or_service_name);
   }
+  return taken;
 }
 
-void
-Executor::execute_subscription(rclcpp::SubscriptionBase::SharedPtr subscription)
+// Evaluate a content filter on a serialized message, which is delivered if it can't be evaluated.
+static
+bool
+passes_content_filter(
+  const rclcpp::ContentFilter & content_filter,
+  const rclcpp::SerializedMessage & serialized_msg,
+  const rclcpp::SubscriptionBase::SharedPtr & subscription)
+{
+  try {
+    return content_filter.matches(rclcpp::SerializedMessageView(serialized_msg));
+  } catch (const std::runtime_error & exception) {
+    RCLCPP_WARN_ONCE(
+      rclcpp::get_logger("rclcpp"),
+      "failed to evaluate the content filter of topic '%s', unfiltered messages are delivered: %s",
+      subscription->get_topic_name(), exception.what());
+    return true;
+  }
+}
+
+// Take a single message from the subscription and deliver it, return false if none was taken.
+static
+bool
+take_and_handle_message(const rclcpp::SubscriptionBase::SharedPtr & subscription)
 {
   using rclcpp::dynamic_typesupport::DynamicMessage;
 
+  // Only filled by the takes if the subscription needs it, see needs_message_info()
   rclcpp::MessageInfo message_info;
   message_info.get_rmw_message_info().from_intra_process = false;
+  bool taken = false;
+
+  if (!subscription->try_accept_message_at_max_rate()) {
+    // Decimated messages are taken serialized, which only copies them, and dropped
+    std::shared_ptr<rclcpp::SerializedMessage> serialized_msg =
+      subscription->create_serialized_message();
+    taken = take_and_do_error_handling(
+      "taking a serialized message to decimate from topic",
+      subscription->get_topic_name(),
+      [&]() {return subscription->take_serialized(*serialized_msg, message_info, false);},
+      []() {});
+    subscription->return_serialized_message(serialized_msg);
+    if (taken) {
+      subscription->record_message_received();
+    }
+    return taken;
+  }
+
+  // Filter evaluated by rclcpp when the middleware doesn't filter the messages
+  const auto content_filter = subscription->get_fallback_content_filter();
 
   switch (subscription->get_delivered_message_kind()) {
     // Deliver ROS message
@@ -625,49 +1062,56 @@ Executor::execute_subscription(rclcpp::SubscriptionBase::SharedPtr subscription)
       {
         if (subscription->can_loan_messages()) {
           // This is the case where a loaned message is taken from the middleware via
-          // inter-process communication, given to the user for their callback,
-          // and then returned.
-          void * loaned_msg = nullptr;
-          // TODO(wjwwood): refactor this into methods on subscription when LoanedMessage
-          //   is extened to support subscriptions as well.
-          take_and_do_error_handling(
+          // inter-process communication, and given to the user for their callback.
+          // The loan is returned once the last reference to the message is released, so
+          // shared pointer callbacks can keep it without a copy.
+          std::shared_ptr<void> loaned_msg;
+          taken = take_and_do_error_handling(
             "taking a loaned message from topic",
             subscription->get_topic_name(),
             [&]()
             {
-              rcl_ret_t ret = rcl_take_loaned_message(
-                subscription->get_subscription_handle().get(),
-                &loaned_msg,
-                &message_info.get_rmw_message_info(),
-                nullptr);
-              if (RCL_RET_SUBSCRIPTION_TAKE_FAILED == ret) {
-                return false;
-              } else if (RCL_RET_OK != ret) {
-                rclcpp::exceptions::throw_from_rcl_error(ret);
-              }
-              return true;
+              loaned_msg = subscription->take_loaned_message(message_info, false);
+              return nullptr != loaned_msg;
             },
-            [&]() {subscription->handle_loaned_message(loaned_msg, message_info);});
-          if (nullptr != loaned_msg) {
-            rcl_ret_t ret = rcl_return_loaned_message_from_subscription(
-              subscription->get_subscription_handle().get(), loaned_msg);
-            if (RCL_RET_OK != ret) {
-              RCLCPP_ERROR(
-                rclcpp::get_logger("rclcpp"),
-                "rcl_return_loaned_message_from_subscription() failed for subscription on topic "
-                "'%s': %s",
-                subscription->get_topic_name(), rcl_get_error_string().str);
-            }
-            loaned_msg = nullptr;
-          }
+            [&]() {
+              if (!content_filter || content_filter->matches_ros_message(loaned_msg.get())) {
+                subscription->handle_shared_loaned_message(loaned_msg, message_info);
+              }
+            });
+        } else if (content_filter || subscription->get_deserialize_after_take()) {
+          // The message is taken serialized, and only deserialized if it passes the filter, if
+          // any. Deserializing outside of the take lets the threads of a multi-threaded executor
+          // deserialize the messages of the same subscription in parallel.
+          std::shared_ptr<rclcpp::SerializedMessage> serialized_msg =
+            subscription->create_serialized_message();
+          taken = take_and_do_error_handling(
+            "taking a serialized message to filter from topic",
+            subscription->get_topic_name(),
+            [&]() {return subscription->take_serialized(*serialized_msg, message_info, false);},
+            [&]()
+            {
+              if (content_filter &&
+                !passes_content_filter(*content_filter, *serialized_msg, subscription))
+              {
+                return;
+              }
+              std::shared_ptr<void> message = subscription->create_message();
+              rclcpp::SerializationBase serialization(
+                &subscription->get_message_type_support_handle());
+              serialization.deserialize_message(serialized_msg.get(), message.get());
+              subscription->handle_message(message, message_info);
+              subscription->return_message(message);
+            });
+          subscription->return_serialized_message(serialized_msg);
         } else {
           // This case is taking a copy of the message data from the middleware via
           // inter-process communication.
           std::shared_ptr<void> message = subscription->create_message();
-          take_and_do_error_handling(
+          taken = take_and_do_error_handling(
             "taking a message from topic",
             subscription->get_topic_name(),
-            [&]() {return subscription->take_type_erased(message.get(), message_info);},
+            [&]() {return subscription->take_type_erased(message.get(), message_info, false);},
             [&]() {subscription->handle_message(message, message_info);});
           // TODO(clalancette): In the case that the user is using the MessageMemoryPool,
           // and they take a shared_ptr reference to the message in the callback, this can
@@ -684,15 +1128,22 @@ Executor::execute_subscription(rclcpp::SubscriptionBase::SharedPtr subscription)
       {
         // This is the case where a copy of the serialized message is taken from
         // the middleware via inter-process communication.
-        std::shared_ptr<SerializedMessage> serialized_msg =
+        std::shared_ptr<rclcpp::SerializedMessage> serialized_msg =
           subscription->create_serialized_message();
-        take_and_do_error_handling(
+        taken = take_and_do_error_handling(
           "taking a serialized message from topic",
           subscription->get_topic_name(),
-          [&]() {return subscription->take_serialized(*serialized_msg.get(), message_info);},
           [&]()
           {
-            subscription->handle_serialized_message(serialized_msg, message_info);
+            return subscription->take_serialized(*serialized_msg.get(), message_info, false);
+          },
+          [&]()
+          {
+            if (!content_filter ||
+              passes_content_filter(*content_filter, *serialized_msg, subscription))
+            {
+              subscription->handle_serialized_message(serialized_msg, message_info);
+            }
           });
         subscription->return_serialized_message(serialized_msg);
         break;
@@ -710,30 +1161,55 @@ Executor::execute_subscription(rclcpp::SubscriptionBase::SharedPtr subscription)
         throw std::runtime_error("Delivered message kind is not supported");
       }
   }
-  return;
+  // Filtered out messages count too, the publisher is alive
+  if (taken) {
+    subscription->record_message_received();
+  }
+  return taken;
 }
 
 void
-Executor::execute_timer(rclcpp::TimerBase::SharedPtr timer)
+Executor::execute_subscription(const rclcpp::SubscriptionBase::SharedPtr & subscription)
+{
+  // Keep taking messages while there are some available, up to the batch size,
+  // to avoid waiting again for each message of a burst.
+  const size_t max_batch_size = subscription->get_max_batch_size();
+  for (size_t taken_messages = 0; taken_messages < max_batch_size; ++taken_messages) {
+    if (!take_and_handle_message(subscription)) {
+      break;
+    }
+  }
+}
+
+void
+Executor::execute_timer(const rclcpp::TimerBase::SharedPtr & timer)
 {
   timer->execute_callback();
 }
 
 void
-Executor::execute_service(rclcpp::ServiceBase::SharedPtr service)
+Executor::execute_service(const rclcpp::ServiceBase::SharedPtr & service)
 {
-  auto request_header = service->create_request_header();
-  std::shared_ptr<void> request = service->create_request();
-  take_and_do_error_handling(
-    "taking a service server request from service",
-    service->get_service_name(),
-    [&]() {return service->take_type_erased_request(request.get(), *request_header);},
-    [&]() {service->handle_request(request_header, request);});
+  // Keep taking requests while there are some available, up to the batch size,
+  // to avoid waiting again for each request of a burst.
+  const size_t max_batch_size = service->get_max_batch_size();
+  for (size_t taken_requests = 0; taken_requests < max_batch_size; ++taken_requests) {
+    auto request_header = service->create_request_header();
+    std::shared_ptr<void> request = service->create_request();
+    bool taken = take_and_do_error_handling(
+      "taking a service server request from service",
+      service->get_service_name(),
+      [&]() {return service->take_type_erased_request(request.get(), *request_header);},
+      [&]() {service->handle_request(request_header, request);});
+    if (!taken) {
+      break;
+    }
+  }
 }
 
 void
 Executor::execute_client(
-  rclcpp::ClientBase::SharedPtr client)
+  const rclcpp::ClientBase::SharedPtr & client)
 {
   auto request_header = client->create_request_header();
   std::shared_ptr<void> response = client->create_response();
@@ -747,9 +1223,11 @@ Executor::execute_client(
 void
 Executor::wait_for_work(std::chrono::nanoseconds timeout)
 {
-  TRACETOOLS_TRACEPOINT(rclcpp_executor_wait_for_work, timeout.count());
+  RCLCPP_TRACEPOINT(Executor, rclcpp_executor_wait_for_work, timeout.count());
+  impl_->wait_count.fetch_add(1, std::memory_order_relaxed);
+  const rclcpp::allocation_tracking::AllocationCounter allocations;
   {
-    std::lock_guard<std::mutex> guard(mutex_);
+    ProfiledLockGuard guard(mutex_, impl_->mutex_profile);
 
     // Check weak_nodes_ to find any callback group that is not owned
     // by an executor and add it to the list of callbackgroups for
@@ -757,6 +1235,9 @@ Executor::wait_for_work(std::chrono::nanoseconds timeout)
     // allowed to add to another executor
     add_callback_groups_from_nodes_associated_to_executor();
 
+    // Ready entities not taken yet will be reported again by this wait
+    clear_prioritized_ready_executables();
+
     // Collect the subscriptions and timers to be waited on
     memory_strategy_->clear_handles();
     bool has_invalid_weak_groups_or_nodes =
@@ -800,20 +1281,36 @@ Executor::wait_for_work(std::chrono::nanoseconds timeout)
         });
     }
 
-    // clear wait set
-    rcl_ret_t ret = rcl_wait_set_clear(&wait_set_);
-    if (ret != RCL_RET_OK) {
-      throw_from_rcl_error(ret, "Couldn't clear wait set");
-    }
-
     // The size of waitables are accounted for in size of the other entities
-    ret = rcl_wait_set_resize(
-      &wait_set_, memory_strategy_->number_of_ready_subscriptions(),
-      memory_strategy_->number_of_guard_conditions(), memory_strategy_->number_of_ready_timers(),
-      memory_strategy_->number_of_ready_clients(), memory_strategy_->number_of_ready_services(),
-      memory_strategy_->number_of_ready_events());
-    if (RCL_RET_OK != ret) {
-      throw_from_rcl_error(ret, "Couldn't resize the wait set");
+    const size_t number_of_subscriptions = memory_strategy_->number_of_ready_subscriptions();
+    const size_t number_of_guard_conditions = memory_strategy_->number_of_guard_conditions();
+    const size_t number_of_timers = memory_strategy_->number_of_ready_timers();
+    const size_t number_of_clients = memory_strategy_->number_of_ready_clients();
+    const size_t number_of_services = memory_strategy_->number_of_ready_services();
+    const size_t number_of_events = memory_strategy_->number_of_ready_events();
+
+    // Resizing reallocates the storage of the wait set, so only do it when the number of
+    // entities changed, otherwise clearing is enough to be able to refill it.
+    rcl_ret_t ret;
+    if (
+      wait_set_.size_of_subscriptions != number_of_subscriptions ||
+      wait_set_.size_of_guard_conditions != number_of_guard_conditions ||
+      wait_set_.size_of_timers != number_of_timers ||
+      wait_set_.size_of_clients != number_of_clients ||
+      wait_set_.size_of_services != number_of_services ||
+      wait_set_.size_of_events != number_of_events)
+    {
+      ret = rcl_wait_set_resize(
+        &wait_set_, number_of_subscriptions, number_of_guard_conditions, number_of_timers,
+        number_of_clients, number_of_services, number_of_events);
+      if (RCL_RET_OK != ret) {
+        throw_from_rcl_error(ret, "Couldn't resize the wait set");
+      }
+    } else {
+      ret = rcl_wait_set_clear(&wait_set_);
+      if (ret != RCL_RET_OK) {
+        throw_from_rcl_error(ret, "Couldn't clear wait set");
+      }
     }
 
     if (!memory_strategy_->add_handles_to_wait_set(&wait_set_)) {
@@ -821,8 +1318,45 @@ Executor::wait_for_work(std::chrono::nanoseconds timeout)
     }
   }
 
-  rcl_ret_t status =
-    rcl_wait(&wait_set_, std::chrono::duration_cast<std::chrono::nanoseconds>(timeout).count());
+  rcl_ret_t status = RCL_RET_TIMEOUT;
+  bool polled = false;
+  if (busy_wait_duration_ > std::chrono::nanoseconds::zero() &&
+    timeout != std::chrono::nanoseconds::zero())
+  {
+    // A negative timeout waits forever
+    const auto busy_wait = timeout < std::chrono::nanoseconds::zero() ?
+      busy_wait_duration_ : std::min(busy_wait_duration_, timeout);
+    const auto start = std::chrono::steady_clock::now();
+    polled = true;
+    while (true) {
+      status = rcl_wait(&wait_set_, 0);
+      if (status != RCL_RET_TIMEOUT) {
+        break;
+      }
+      // rcl_wait() removed the entities which aren't ready, so fill the wait set again
+      {
+        ProfiledLockGuard guard(mutex_, impl_->mutex_profile);
+        rcl_ret_t ret = rcl_wait_set_clear(&wait_set_);
+        if (ret != RCL_RET_OK) {
+          throw_from_rcl_error(ret, "Couldn't clear wait set");
+        }
+        if (!memory_strategy_->add_handles_to_wait_set(&wait_set_)) {
+          throw std::runtime_error("Couldn't fill wait set");
+        }
+      }
+      const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start);
+      if (elapsed >= busy_wait) {
+        if (timeout > std::chrono::nanoseconds::zero()) {
+          timeout = std::max(timeout - elapsed, std::chrono::nanoseconds::zero());
+        }
+        break;
+      }
+    }
+  }
+  if (!polled || (status == RCL_RET_TIMEOUT && timeout != std::chrono::nanoseconds::zero())) {
+    status = rcl_wait(&wait_set_, timeout.count());
+  }
   if (status == RCL_RET_WAIT_SET_EMPTY) {
     RCUTILS_LOG_WARN_NAMED(
       "rclcpp",
@@ -832,10 +1366,22 @@ Executor::wait_for_work(std::chrono::nanoseconds timeout)
     throw_from_rcl_error(status, "rcl_wait() failed");
   }
 
+  if (impl_->collect_callback_statistics) {
+    impl_->last_wait_end_time.store(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count(),
+      std::memory_order_relaxed);
+  }
+
   // check the null handles in the wait set and remove them from the handles in memory strategy
   // for callback-based entities
-  std::lock_guard<std::mutex> guard(mutex_);
+  ProfiledLockGuard guard(mutex_, impl_->mutex_profile);
   memory_strategy_->remove_null_handles(&wait_set_);
+
+  const uint64_t allocation_count = allocations.get_count();
+  if (allocation_count != 0 && rclcpp::allocation_tracking::is_steady_state()) {
+    throw rclcpp::exceptions::AllocationInSteadyStateError(allocation_count, "waiting for work");
+  }
 }
 
 rclcpp::node_interfaces::NodeBaseInterface::SharedPtr
@@ -859,33 +1405,19 @@ Executor::get_node_by_group(
 rclcpp::CallbackGroup::SharedPtr
 Executor::get_group_by_timer(rclcpp::TimerBase::SharedPtr timer)
 {
-  std::lock_guard<std::mutex> guard{mutex_};
-  for (const auto & pair : weak_groups_associated_with_executor_to_nodes_) {
-    auto group = pair.first.lock();
-    if (!group) {
-      continue;
-    }
-    auto timer_ref = group->find_timer_ptrs_if(
-      [timer](const rclcpp::TimerBase::SharedPtr & timer_ptr) -> bool {
-        return timer_ptr == timer;
-      });
-    if (timer_ref) {
-      return group;
-    }
+  if (!timer) {
+    return nullptr;
   }
-
-  for (const auto & pair : weak_groups_to_nodes_associated_with_executor_) {
-    auto group = pair.first.lock();
-    if (!group) {
-      continue;
-    }
-    auto timer_ref = group->find_timer_ptrs_if(
-      [timer](const rclcpp::TimerBase::SharedPtr & timer_ptr) -> bool {
-        return timer_ptr == timer;
-      });
-    if (timer_ref) {
-      return group;
-    }
+  // The timer knows its group, which just needs to be one of the groups of this executor
+  auto group = timer->get_callback_group();
+  if (!group) {
+    return nullptr;
+  }
+  ProfiledLockGuard guard{mutex_, impl_->mutex_profile};
+  if (weak_groups_associated_with_executor_to_nodes_.count(group) != 0 ||
+    weak_groups_to_nodes_associated_with_executor_.count(group) != 0)
+  {
+    return group;
   }
   return nullptr;
 }
@@ -903,41 +1435,46 @@ Executor::get_next_ready_executable_from_map(
   const rclcpp::memory_strategy::MemoryStrategy::WeakCallbackGroupsToNodesMap &
   weak_groups_to_nodes)
 {
-  TRACETOOLS_TRACEPOINT(rclcpp_executor_get_next_ready);
+  RCLCPP_TRACEPOINT(Executor, rclcpp_executor_get_next_ready);
   bool success = false;
-  std::lock_guard<std::mutex> guard{mutex_};
-  // Check the timers to see if there are any that are ready
-  memory_strategy_->get_next_timer(any_executable, weak_groups_to_nodes);
-  if (any_executable.timer) {
-    success = true;
-  }
-  if (!success) {
-    // Check the subscriptions to see if there are any that are ready
-    memory_strategy_->get_next_subscription(any_executable, weak_groups_to_nodes);
-    if (any_executable.subscription) {
+  ProfiledLockGuard guard{mutex_, impl_->mutex_profile};
+  if (priority_scheduling_ || fair_scheduling_) {
+    success = get_highest_priority_ready_executable(any_executable, weak_groups_to_nodes);
+  } else {
+    // Check the timers to see if there are any that are ready
+    memory_strategy_->get_next_timer(any_executable, weak_groups_to_nodes);
+    if (any_executable.timer) {
       success = true;
     }
-  }
-  if (!success) {
-    // Check the services to see if there are any that are ready
-    memory_strategy_->get_next_service(any_executable, weak_groups_to_nodes);
-    if (any_executable.service) {
-      success = true;
+    if (!success) {
+      // Check the subscriptions to see if there are any that are ready
+      memory_strategy_->get_next_subscription(any_executable, weak_groups_to_nodes);
+      if (any_executable.subscription) {
+        success = true;
+      }
     }
-  }
-  if (!success) {
-    // Check the clients to see if there are any that are ready
-    memory_strategy_->get_next_client(any_executable, weak_groups_to_nodes);
-    if (any_executable.client) {
-      success = true;
+    if (!success) {
+      // Check the services to see if there are any that are ready
+      memory_strategy_->get_next_service(any_executable, weak_groups_to_nodes);
+      if (any_executable.service) {
+        success = true;
+      }
     }
-  }
-  if (!success) {
-    // Check the waitables to see if there are any that are ready
-    memory_strategy_->get_next_waitable(any_executable, weak_groups_to_nodes);
-    if (any_executable.waitable) {
-      any_executable.data = any_executable.waitable->take_data();
-      success = true;
+    if (!success) {
+      // Check the clients to see if there are any that are ready
+      memory_strategy_->get_next_client(any_executable, weak_groups_to_nodes);
+      if (any_executable.client) {
+        success = true;
+      }
+    }
+    if (!success) {
+      // Check the waitables to see if there are any that are ready
+      memory_strategy_->get_next_waitable(any_executable, weak_groups_to_nodes);
+      if (any_executable.waitable) {
+        const rclcpp::detail::DispatchArenaScope arena_scope(impl_->dispatch_arena_chunk_size);
+        any_executable.data = any_executable.waitable->take_data();
+        success = true;
+      }
     }
   }
   // At this point any_executable should be valid with either a valid subscription
@@ -950,24 +1487,158 @@ Executor::get_next_ready_executable_from_map(
     }
   }
 
-  if (success) {
-    // If it is valid, check to see if the group is mutually exclusive or
-    // not, then mark it accordingly ..Check if the callback_group belongs to this executor
-    if (any_executable.callback_group && any_executable.callback_group->type() == \
-      CallbackGroupType::MutuallyExclusive)
-    {
-      // It should not have been taken otherwise
-      assert(any_executable.callback_group->can_be_taken_from().load());
-      // Set to false to indicate something is being run from this group
-      // This is reset to true either when the any_executable is executed or when the
-      // any_executable is destructued
-      any_executable.callback_group->can_be_taken_from().store(false);
-    }
+  if (success && any_executable.callback_group) {
+    // Mark the callback as running in its group, according to the type of the group.
+    // This is reset either when the any_executable is executed or when the
+    // any_executable is destructed
+    any_executable.callback_group->start_callback(any_executable.get_entity());
   }
   // If there is no ready executable, return false
   return success;
 }
 
+bool
+Executor::get_highest_priority_ready_executable(
+  AnyExecutable & any_executable,
+  const WeakCallbackGroupsToNodesMap & weak_groups_to_nodes)
+{
+  // Move everything the memory strategy found ready into the prioritized list.
+  // Each entity is given only once by the memory strategy until the next wait.
+  while (true) {
+    auto candidate = std::make_unique<AnyExecutable>();
+    memory_strategy_->get_next_timer(*candidate, weak_groups_to_nodes);
+    if (!candidate->timer) {
+      memory_strategy_->get_next_subscription(*candidate, weak_groups_to_nodes);
+    }
+    if (!candidate->timer && !candidate->subscription) {
+      memory_strategy_->get_next_service(*candidate, weak_groups_to_nodes);
+    }
+    if (!candidate->timer && !candidate->subscription && !candidate->service) {
+      memory_strategy_->get_next_client(*candidate, weak_groups_to_nodes);
+    }
+    if (!candidate->timer && !candidate->subscription && !candidate->service &&
+      !candidate->client)
+    {
+      memory_strategy_->get_next_waitable(*candidate, weak_groups_to_nodes);
+    }
+    if (!candidate->callback_group) {
+      break;
+    }
+    prioritized_ready_executables_.push_back(std::move(candidate));
+  }
+
+  // Pick the first executable with the highest priority whose group can be taken from.
+  auto best = prioritized_ready_executables_.end();
+  for (auto it = prioritized_ready_executables_.begin();
+    it != prioritized_ready_executables_.end(); ++it)
+  {
+    const auto & group = (*it)->callback_group;
+    if (!group->can_start_callback((*it)->get_entity())) {
+      continue;
+    }
+    if (best == prioritized_ready_executables_.end() ||
+      (priority_scheduling_ &&
+      group->get_priority() > (*best)->callback_group->get_priority()))
+    {
+      best = it;
+    }
+  }
+  if (best == prioritized_ready_executables_.end()) {
+    return false;
+  }
+
+  if (fair_scheduling_) {
+    const int priority = (*best)->callback_group->get_priority();
+    auto is_candidate = [this, priority](const std::unique_ptr<AnyExecutable> & executable) {
+        return (!priority_scheduling_ || executable->callback_group->get_priority() == priority) &&
+               executable->callback_group->can_start_callback(executable->get_entity());
+      };
+    // Take the candidate with credit left executed the longest time ago
+    auto take_fair_candidate = [&]() {
+        auto fair_best = prioritized_ready_executables_.end();
+        uint64_t fair_best_turn = 0;
+        for (auto it = prioritized_ready_executables_.begin();
+          it != prioritized_ready_executables_.end(); ++it)
+        {
+          if (!is_candidate(*it)) {
+            continue;
+          }
+          const auto & share = impl_->get_fair_share((*it)->get_entity());
+          if (share.credit > std::chrono::nanoseconds::zero() &&
+            (fair_best == prioritized_ready_executables_.end() || share.last_turn < fair_best_turn))
+          {
+            fair_best = it;
+            fair_best_turn = share.last_turn;
+          }
+        }
+        return fair_best;
+      };
+
+    std::lock_guard<std::mutex> lock(impl_->fair_shares_mutex);
+    auto fair_best = take_fair_candidate();
+    if (fair_best == prioritized_ready_executables_.end()) {
+      // All the candidates are in debt: start a new round, with as many quanta as needed for
+      // the one with the least debt to get credit again.
+      const auto quantum = impl_->fair_scheduling_quantum;
+      int64_t rounds = -1;
+      for (const auto & executable : prioritized_ready_executables_) {
+        if (is_candidate(executable)) {
+          const auto & share = impl_->get_fair_share(executable->get_entity());
+          const int64_t needed = -share.credit.count() / quantum.count() + 1;
+          if (rounds < 0 || needed < rounds) {
+            rounds = needed;
+          }
+        }
+      }
+      impl_->fair_scheduling_round++;
+      for (const auto & executable : prioritized_ready_executables_) {
+        if (is_candidate(executable)) {
+          auto & share = impl_->get_fair_share(executable->get_entity());
+          share.credit = std::min(quantum, share.credit + rounds * quantum);
+          share.round = impl_->fair_scheduling_round;
+        }
+      }
+      // Entities which weren't ready in this round lose their share
+      for (auto it = impl_->fair_shares.begin(); it != impl_->fair_shares.end(); ) {
+        if (it->second.round != impl_->fair_scheduling_round) {
+          it = impl_->fair_shares.erase(it);
+        } else {
+          ++it;
+        }
+      }
+      fair_best = take_fair_candidate();
+    }
+    best = fair_best;
+    impl_->get_fair_share((*best)->get_entity()).last_turn = ++impl_->fair_scheduling_turn;
+  }
+
+  // Moving clears the callback_group, to prevent the AnyExecutable destructor from
+  // resetting the callback group `can_be_taken_from`
+  any_executable = std::move(**best);
+  if (any_executable.waitable) {
+    const rclcpp::detail::DispatchArenaScope arena_scope(impl_->dispatch_arena_chunk_size);
+    any_executable.data = any_executable.waitable->take_data();
+  }
+  prioritized_ready_executables_.erase(best);
+  return true;
+}
+
+void
+Executor::clear_prioritized_ready_executables()
+{
+  // Timers are kept, as the memory strategy already called them and the wait set
+  // won't report them as ready again until their next period.
+  auto it = prioritized_ready_executables_.begin();
+  while (it != prioritized_ready_executables_.end()) {
+    if ((*it)->timer) {
+      ++it;
+      continue;
+    }
+    (*it)->callback_group.reset();
+    it = prioritized_ready_executables_.erase(it);
+  }
+}
+
 bool
 Executor::get_next_executable(AnyExecutable & any_executable, std::chrono::nanoseconds timeout)
 {
@@ -1009,3 +1680,52 @@ Executor::is_spinning()
 {
   return spinning;
 }
+
+uint64_t
+Executor::get_wait_count() const
+{
+  return impl_->wait_count.load(std::memory_order_relaxed);
+}
+
+rclcpp::ExecutorBacklog
+Executor::get_backlog()
+{
+  rclcpp::ExecutorBacklog backlog;
+  for (const auto & weak_group : get_all_callback_groups()) {
+    auto group = weak_group.lock();
+    if (!group) {
+      continue;
+    }
+    group->find_subscription_ptrs_if(
+      [&backlog](const rclcpp::SubscriptionBase::SharedPtr & subscription) {
+        backlog.subscriptions.push_back(subscription->get_backlog());
+        return false;
+      });
+  }
+  return backlog;
+}
+
+std::vector<rclcpp::CallbackStatistics::ConstSharedPtr>
+Executor::get_callback_statistics() const
+{
+  std::shared_lock<std::shared_mutex> lock(impl_->callback_statistics_mutex);
+  std::vector<rclcpp::CallbackStatistics::ConstSharedPtr> statistics;
+  statistics.reserve(impl_->callback_statistics.size());
+  for (const auto & pair : impl_->callback_statistics) {
+    statistics.push_back(pair.second);
+  }
+  return statistics;
+}
+
+rclcpp::FlightRecorder::SharedPtr
+Executor::get_flight_recorder() const
+{
+  return impl_->flight_recorder;
+}
+
+void
+Executor::reset_callback_statistics()
+{
+  std::unique_lock<std::shared_mutex> lock(impl_->callback_statistics_mutex);
+  impl_->callback_statistics.clear();
+}
@@ -12,15 +12,33 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <memory>
+
 #include "rclcpp/executors.hpp"
+#include "rclcpp/node_interfaces/node_base.hpp"
+
+namespace
+{
+
+/// Return the executor kept by the node, or a new one if the node doesn't keep any.
+std::shared_ptr<rclcpp::executors::SingleThreadedExecutor>
+get_spin_executor(const rclcpp::node_interfaces::NodeBaseInterface::SharedPtr & node_ptr)
+{
+  auto node_base = std::dynamic_pointer_cast<rclcpp::node_interfaces::NodeBase>(node_ptr);
+  if (node_base) {
+    return node_base->get_spin_executor();
+  }
+  return std::make_shared<rclcpp::executors::SingleThreadedExecutor>();
+}
+
+}  // namespace
 
 void
 rclcpp::spin_all(
   rclcpp::node_interfaces::NodeBaseInterface::SharedPtr node_ptr,
   std::chrono::nanoseconds max_duration)
 {
-  rclcpp::executors::SingleThreadedExecutor exec;
-  exec.spin_node_all(node_ptr, max_duration);
+  get_spin_executor(node_ptr)->spin_node_all(node_ptr, max_duration);
 }
 
 void
@@ -32,8 +50,7 @@ rclcpp::spin_all(rclcpp::Node::SharedPtr node_ptr, std::chrono::nanoseconds max_
 void
 rclcpp::spin_some(rclcpp::node_interfaces::NodeBaseInterface::SharedPtr node_ptr)
 {
-  rclcpp::executors::SingleThreadedExecutor exec;
-  exec.spin_node_some(node_ptr);
+  get_spin_executor(node_ptr)->spin_node_some(node_ptr);
 }
 
 void
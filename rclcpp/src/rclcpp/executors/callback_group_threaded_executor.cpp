@@ -0,0 +1,199 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rclcpp/executors/callback_group_threaded_executor.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "rcpputils/scope_exit.hpp"
+
+#include "rclcpp/utilities.hpp"
+
+using rclcpp::executors::CallbackGroupThreadedExecutor;
+
+CallbackGroupThreadedExecutor::CallbackGroupThreadedExecutor(
+  const rclcpp::ExecutorOptions & options,
+  std::chrono::nanoseconds next_exec_timeout)
+: rclcpp::Executor(options),
+  next_exec_timeout_(next_exec_timeout)
+{
+  if (options.numa_aware) {
+    numa_node_cpus_ = rclcpp::get_numa_node_cpus();
+    if (numa_node_cpus_.size() < 2u) {
+      numa_node_cpus_.clear();
+    }
+  }
+}
+
+CallbackGroupThreadedExecutor::~CallbackGroupThreadedExecutor() {}
+
+void
+CallbackGroupThreadedExecutor::spin()
+{
+  if (spinning.exchange(true)) {
+    throw std::runtime_error("spin() called while already spinning");
+  }
+  RCPPUTILS_SCOPE_EXIT(this->spinning.store(false); );
+  RCPPUTILS_SCOPE_EXIT(this->stop_workers(); );
+
+  dispatch();
+}
+
+size_t
+CallbackGroupThreadedExecutor::get_number_of_threads()
+{
+  std::lock_guard<std::mutex> lock(workers_mutex_);
+  return workers_.size();
+}
+
+void
+CallbackGroupThreadedExecutor::dispatch()
+{
+  auto any_exec = std::make_unique<rclcpp::AnyExecutable>();
+  while (rclcpp::ok(this->context_) && spinning.load()) {
+    // Hand out everything that is ready before waiting again.
+    if (get_next_ready_executable(*any_exec)) {
+      push_executable(std::move(any_exec));
+      any_exec = std::make_unique<rclcpp::AnyExecutable>();
+      continue;
+    }
+    remove_expired_workers();
+    wait_for_work(next_exec_timeout_);
+  }
+}
+
+void
+CallbackGroupThreadedExecutor::run(GroupWorker & worker)
+{
+  this->prefault_thread_stack();
+  while (true) {
+    AnyExecutablePtr any_exec;
+    {
+      std::unique_lock<std::mutex> lock(worker.mutex);
+      worker.cv.wait(
+        lock, [&worker]() {
+          return worker.should_stop || !worker.executables.empty();
+        });
+      if (worker.should_stop) {
+        return;
+      }
+      any_exec = std::move(worker.executables.front());
+      worker.executables.pop_front();
+    }
+
+    execute_any_executable(*any_exec);
+
+    // Clear the callback_group to prevent the AnyExecutable destructor from
+    // resetting the callback group `can_be_taken_from`
+    any_exec->callback_group.reset();
+  }
+}
+
+void
+CallbackGroupThreadedExecutor::push_executable(AnyExecutablePtr any_exec)
+{
+  rclcpp::CallbackGroup::SharedPtr group = any_exec->callback_group;
+  std::lock_guard<std::mutex> lock(workers_mutex_);
+  auto it = workers_.find(group.get());
+  if (it != workers_.end() && it->second->callback_group.expired()) {
+    // A destroyed group was at the same address
+    stop_worker(*it->second);
+    workers_.erase(it);
+    it = workers_.end();
+  }
+  if (it == workers_.end()) {
+    auto worker = std::make_unique<GroupWorker>();
+    worker->callback_group = group;
+    GroupWorker & worker_ref = *worker;
+    // Throws if the thread can't be started with the attributes of the group
+    worker->thread = std::make_unique<rclcpp::ThreadWithAttributes>(
+      get_worker_thread_attributes(*group, worker_ref), [this, &worker_ref]() {run(worker_ref);});
+    it = workers_.emplace(group.get(), std::move(worker)).first;
+  }
+  GroupWorker & worker = *it->second;
+  {
+    std::lock_guard<std::mutex> worker_lock(worker.mutex);
+    worker.executables.push_back(std::move(any_exec));
+  }
+  worker.cv.notify_one();
+}
+
+rclcpp::ThreadAttributes
+CallbackGroupThreadedExecutor::get_worker_thread_attributes(
+  const rclcpp::CallbackGroup & group, GroupWorker & worker)
+{
+  rclcpp::ThreadAttributes attributes = group.get_thread_attributes();
+  if (numa_node_cpus_.empty() || !attributes.cpu_affinity.empty()) {
+    return attributes;
+  }
+  // Called with workers_mutex_ held, the new worker isn't in workers_ yet
+  std::vector<size_t> workers_per_node(numa_node_cpus_.size(), 0u);
+  for (const auto & [other_group, other_worker] : workers_) {
+    (void)other_group;
+    if (other_worker->numa_node < workers_per_node.size()) {
+      workers_per_node[other_worker->numa_node]++;
+    }
+  }
+  worker.numa_node = static_cast<size_t>(
+    std::min_element(workers_per_node.begin(), workers_per_node.end()) -
+    workers_per_node.begin());
+  attributes.cpu_affinity = numa_node_cpus_[worker.numa_node];
+  return attributes;
+}
+
+void
+CallbackGroupThreadedExecutor::remove_expired_workers()
+{
+  std::lock_guard<std::mutex> lock(workers_mutex_);
+  for (auto it = workers_.begin(); it != workers_.end(); ) {
+    if (it->second->callback_group.expired()) {
+      // The pending executables keep their group alive, so there is none left
+      stop_worker(*it->second);
+      it = workers_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+void
+CallbackGroupThreadedExecutor::stop_worker(GroupWorker & worker)
+{
+  {
+    std::lock_guard<std::mutex> lock(worker.mutex);
+    worker.should_stop = true;
+  }
+  worker.cv.notify_all();
+  worker.thread->join();
+  // Any executable left behind is discarded, which releases its callback group.
+  worker.executables.clear();
+}
+
+void
+CallbackGroupThreadedExecutor::stop_workers()
+{
+  std::lock_guard<std::mutex> lock(workers_mutex_);
+  for (auto & [group, worker] : workers_) {
+    (void)group;
+    stop_worker(*worker);
+  }
+  workers_.clear();
+}
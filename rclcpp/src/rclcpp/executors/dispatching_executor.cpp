@@ -0,0 +1,129 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rclcpp/executors/dispatching_executor.hpp"
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+
+#include "rcpputils/scope_exit.hpp"
+
+#include "rclcpp/any_executable.hpp"
+#include "rclcpp/utilities.hpp"
+
+using rclcpp::executors::DispatchingExecutor;
+
+struct DispatchingExecutor::DispatchedExecutable
+{
+  DispatchedExecutable(
+    std::unique_ptr<rclcpp::AnyExecutable> any_exec, DispatchingExecutor & executor)
+  : any_exec(std::move(any_exec)), executor(executor)
+  {}
+
+  ~DispatchedExecutable()
+  {
+    // Release the callback group first, if the callback wasn't executed
+    any_exec.reset();
+    executor.task_done();
+  }
+
+  std::unique_ptr<rclcpp::AnyExecutable> any_exec;
+  DispatchingExecutor & executor;
+};
+
+DispatchingExecutor::DispatchingExecutor(
+  Dispatcher dispatcher,
+  const rclcpp::ExecutorOptions & options,
+  std::chrono::nanoseconds next_exec_timeout)
+: rclcpp::Executor(options),
+  dispatcher_(std::move(dispatcher)),
+  next_exec_timeout_(next_exec_timeout)
+{
+  if (!dispatcher_) {
+    throw std::invalid_argument("the dispatcher of a DispatchingExecutor can't be empty");
+  }
+}
+
+DispatchingExecutor::~DispatchingExecutor() {}
+
+void
+DispatchingExecutor::spin()
+{
+  if (spinning.exchange(true)) {
+    throw std::runtime_error("spin() called while already spinning");
+  }
+  // Stop spinning first, so that the pending tasks don't execute their callback
+  RCPPUTILS_SCOPE_EXIT(this->wait_for_pending_tasks(); );
+  RCPPUTILS_SCOPE_EXIT(this->spinning.store(false); );
+
+  dispatch();
+}
+
+size_t
+DispatchingExecutor::get_number_of_pending_tasks()
+{
+  std::lock_guard<std::mutex> lock(pending_tasks_mutex_);
+  return pending_tasks_;
+}
+
+void
+DispatchingExecutor::dispatch()
+{
+  auto any_exec = std::make_unique<rclcpp::AnyExecutable>();
+  while (rclcpp::ok(this->context_) && spinning.load()) {
+    if (!get_next_ready_executable(*any_exec)) {
+      wait_for_work(next_exec_timeout_);
+      continue;
+    }
+    {
+      std::lock_guard<std::mutex> lock(pending_tasks_mutex_);
+      pending_tasks_++;
+    }
+    auto dispatched = std::make_shared<DispatchedExecutable>(std::move(any_exec), *this);
+    any_exec = std::make_unique<rclcpp::AnyExecutable>();
+    // Hand out everything that is ready before waiting again.
+    dispatcher_(
+      [this, dispatched = std::move(dispatched)]() {
+        if (!dispatched->any_exec || !spinning.load()) {
+          return;
+        }
+        execute_any_executable(*dispatched->any_exec);
+        // Clear the callback_group to prevent the AnyExecutable destructor from
+        // resetting the callback group `can_be_taken_from`
+        dispatched->any_exec->callback_group.reset();
+        // Release the entities now, the task may be destroyed much later
+        dispatched->any_exec.reset();
+      });
+  }
+}
+
+void
+DispatchingExecutor::task_done()
+{
+  {
+    std::lock_guard<std::mutex> lock(pending_tasks_mutex_);
+    pending_tasks_--;
+  }
+  pending_tasks_cv_.notify_all();
+}
+
+void
+DispatchingExecutor::wait_for_pending_tasks()
+{
+  std::unique_lock<std::mutex> lock(pending_tasks_mutex_);
+  pending_tasks_cv_.wait(lock, [this]() {return pending_tasks_ == 0;});
+}
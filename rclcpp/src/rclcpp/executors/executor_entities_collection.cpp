@@ -14,6 +14,11 @@
 
 #include "rclcpp/executors/executor_entities_collection.hpp"
 
+#include <algorithm>
+#include <chrono>
+#include <utility>
+#include <vector>
+
 namespace rclcpp
 {
 namespace executors
@@ -39,6 +44,94 @@ void ExecutorEntitiesCollection::clear()
   waitables.clear();
 }
 
+namespace
+{
+
+/// Add the entities of a callback group to a collection.
+void
+add_group_entities(
+  const rclcpp::CallbackGroup::SharedPtr & group_ptr,
+  const rclcpp::CallbackGroup::WeakPtr & weak_group_ptr,
+  ExecutorEntitiesCollection & collection)
+{
+  group_ptr->collect_all_ptrs(
+    [&collection, weak_group_ptr](const rclcpp::SubscriptionBase::SharedPtr & subscription) {
+      collection.subscriptions.insert(
+        {
+          subscription->get_subscription_handle().get(),
+          {subscription, weak_group_ptr}
+        });
+    },
+    [&collection, weak_group_ptr](const rclcpp::ServiceBase::SharedPtr & service) {
+      collection.services.insert(
+        {
+          service->get_service_handle().get(),
+          {service, weak_group_ptr}
+        });
+    },
+    [&collection, weak_group_ptr](const rclcpp::ClientBase::SharedPtr & client) {
+      collection.clients.insert(
+        {
+          client->get_client_handle().get(),
+          {client, weak_group_ptr}
+        });
+    },
+    [&collection, weak_group_ptr](const rclcpp::TimerBase::SharedPtr & timer) {
+      collection.timers.insert(
+        {
+          timer->get_timer_handle().get(),
+          {timer, weak_group_ptr}
+        });
+    },
+    [&collection, weak_group_ptr](const rclcpp::Waitable::SharedPtr & waitable) {
+      collection.waitables.insert(
+        {
+          waitable.get(),
+          {waitable, weak_group_ptr}
+        });
+    }
+  );
+}
+
+/// Add the entities of previous not in next to removed, and those of next not in previous to added.
+void
+diff_collections(
+  const ExecutorEntitiesCollection & previous,
+  const ExecutorEntitiesCollection & next,
+  ExecutorEntitiesCollection & added,
+  ExecutorEntitiesCollection & removed)
+{
+  diff_entities(previous.timers, next.timers, added.timers, removed.timers);
+  diff_entities(
+    previous.subscriptions, next.subscriptions, added.subscriptions, removed.subscriptions);
+  diff_entities(previous.clients, next.clients, added.clients, removed.clients);
+  diff_entities(previous.services, next.services, added.services, removed.services);
+  diff_entities(
+    previous.guard_conditions, next.guard_conditions,
+    added.guard_conditions, removed.guard_conditions);
+  diff_entities(previous.waitables, next.waitables, added.waitables, removed.waitables);
+}
+
+/// Return true if an entity of the collection was destroyed since it was collected.
+bool
+has_destroyed_entities(const ExecutorEntitiesCollection & collection)
+{
+  const auto has_expired_entry = [](const auto & entities) {
+      return std::any_of(
+        entities.begin(), entities.end(),
+        [](const auto & entry) {return entry.second.entity.expired();});
+    };
+  return
+    has_expired_entry(collection.timers) ||
+    has_expired_entry(collection.subscriptions) ||
+    has_expired_entry(collection.clients) ||
+    has_expired_entry(collection.services) ||
+    has_expired_entry(collection.guard_conditions) ||
+    has_expired_entry(collection.waitables);
+}
+
+}  // namespace
+
 void
 build_entities_collection(
   const std::vector<rclcpp::CallbackGroup::WeakPtr> & callback_groups,
@@ -52,45 +145,56 @@ build_entities_collection(
       continue;
     }
 
-    if (group_ptr->can_be_taken_from().load()) {
-      group_ptr->collect_all_ptrs(
-        [&collection, weak_group_ptr](const rclcpp::SubscriptionBase::SharedPtr & subscription) {
-          collection.subscriptions.insert(
-            {
-              subscription->get_subscription_handle().get(),
-              {subscription, weak_group_ptr}
-            });
-        },
-        [&collection, weak_group_ptr](const rclcpp::ServiceBase::SharedPtr & service) {
-          collection.services.insert(
-            {
-              service->get_service_handle().get(),
-              {service, weak_group_ptr}
-            });
-        },
-        [&collection, weak_group_ptr](const rclcpp::ClientBase::SharedPtr & client) {
-          collection.clients.insert(
-            {
-              client->get_client_handle().get(),
-              {client, weak_group_ptr}
-            });
-        },
-        [&collection, weak_group_ptr](const rclcpp::TimerBase::SharedPtr & timer) {
-          collection.timers.insert(
-            {
-              timer->get_timer_handle().get(),
-              {timer, weak_group_ptr}
-            });
-        },
-        [&collection, weak_group_ptr](const rclcpp::Waitable::SharedPtr & waitable) {
-          collection.waitables.insert(
-            {
-              waitable.get(),
-              {waitable, weak_group_ptr}
-            });
-        }
-      );
+    if (group_ptr->can_be_taken_from().load() && group_ptr->is_enabled()) {
+      add_group_entities(group_ptr, weak_group_ptr, collection);
+    }
+  }
+}
+
+void
+collect_entities_changes(
+  const std::vector<rclcpp::CallbackGroup::WeakPtr> & callback_groups,
+  CallbackGroupsEntities & groups_entities,
+  ExecutorEntitiesCollection & added,
+  ExecutorEntitiesCollection & removed)
+{
+  const ExecutorEntitiesCollection no_entities;
+  CallbackGroupsEntities previous_groups_entities;
+  previous_groups_entities.swap(groups_entities);
+
+  for (const auto & weak_group_ptr : callback_groups) {
+    auto group_ptr = weak_group_ptr.lock();
+    if (!group_ptr) {
+      continue;
+    }
+    auto previous = previous_groups_entities.find(weak_group_ptr);
+    // Read before collecting, so that entities added meanwhile change the version again
+    const uint64_t version = group_ptr->get_entities_version();
+    // Destroying an entity doesn't change the version, so its group is collected again
+    if (previous != previous_groups_entities.end() && previous->second.version == version &&
+      !has_destroyed_entities(previous->second.entities))
+    {
+      groups_entities.insert(previous_groups_entities.extract(previous));
+      continue;
+    }
+
+    CallbackGroupEntities & group_entities = groups_entities[weak_group_ptr];
+    group_entities.version = version;
+    if (group_ptr->is_enabled()) {
+      add_group_entities(group_ptr, weak_group_ptr, group_entities.entities);
     }
+    if (previous != previous_groups_entities.end()) {
+      diff_collections(previous->second.entities, group_entities.entities, added, removed);
+      previous_groups_entities.erase(previous);
+    } else {
+      diff_collections(no_entities, group_entities.entities, added, removed);
+    }
+  }
+
+  // The groups left were removed or destroyed
+  for (const auto & [weak_group_ptr, group_entities] : previous_groups_entities) {
+    (void)weak_group_ptr;
+    diff_collections(group_entities.entities, no_entities, added, removed);
   }
 }
 
@@ -106,6 +210,8 @@ ready_executables(
     return added;
   }
   auto rcl_wait_set = wait_result.get_wait_set().get_rcl_wait_set();
+  // Only the ready entities are looked up, rather than all the entities of the wait set
+  const rclcpp::ReadyEntityIndices & ready = wait_result.get_ready_indices();
 
   // Cache shared pointers to groups to avoid extra work re-locking them
   std::map<rclcpp::CallbackGroup::WeakPtr,
@@ -120,8 +226,7 @@ ready_executables(
       return group_map.find(weak_cbg_ptr)->second;
     };
 
-  for (size_t ii = 0; ii < rcl_wait_set.size_of_timers; ++ii) {
-    if (nullptr == rcl_wait_set.timers[ii]) {continue;}
+  for (size_t ii : ready.timers) {
     auto entity_iter = collection.timers.find(rcl_wait_set.timers[ii]);
     if (entity_iter != collection.timers.end()) {
       auto entity = entity_iter->second.entity.lock();
@@ -136,15 +241,51 @@ ready_executables(
         continue;
       }
       rclcpp::AnyExecutable exec;
-      exec.timer = entity;
-      exec.callback_group = group_info;
-      executables.push_back(exec);
+      exec.timer = std::move(entity);
+      exec.callback_group = std::move(group_info);
+      executables.push_back(std::move(exec));
+      added++;
+    }
+  }
+
+  // Timers expiring within their slack share this wakeup, instead of waking up again.
+  // Only the timers with a slack are checked, reusing the buffers of the thread.
+  thread_local std::vector<const rcl_timer_t *> timers_with_slack;
+  thread_local std::vector<const rcl_timer_t *> ready_timers;
+  rclcpp::TimerBase::get_timers_with_slack(timers_with_slack);
+  if (!timers_with_slack.empty() && collection.timers.size() > ready.timers.size()) {
+    ready_timers.clear();
+    for (size_t ii : ready.timers) {
+      ready_timers.push_back(rcl_wait_set.timers[ii]);
+    }
+    std::sort(ready_timers.begin(), ready_timers.end());
+    for (const rcl_timer_t * timer_handle : timers_with_slack) {
+      auto entity_iter = collection.timers.find(timer_handle);
+      if (entity_iter == collection.timers.end() ||
+        std::binary_search(ready_timers.begin(), ready_timers.end(), timer_handle))
+      {
+        continue;
+      }
+      auto entity = entity_iter->second.entity.lock();
+      if (!entity || !entity->is_ready_within_slack()) {
+        continue;
+      }
+      auto group_info = group_cache(entity_iter->second.callback_group);
+      if (group_info && !group_info->can_be_taken_from().load()) {
+        continue;
+      }
+      if (!entity->call()) {
+        continue;
+      }
+      rclcpp::AnyExecutable exec;
+      exec.timer = std::move(entity);
+      exec.callback_group = std::move(group_info);
+      executables.push_back(std::move(exec));
       added++;
     }
   }
 
-  for (size_t ii = 0; ii < rcl_wait_set.size_of_subscriptions; ++ii) {
-    if (nullptr == rcl_wait_set.subscriptions[ii]) {continue;}
+  for (size_t ii : ready.subscriptions) {
     auto entity_iter = collection.subscriptions.find(rcl_wait_set.subscriptions[ii]);
     if (entity_iter != collection.subscriptions.end()) {
       auto entity = entity_iter->second.entity.lock();
@@ -156,15 +297,14 @@ ready_executables(
         continue;
       }
       rclcpp::AnyExecutable exec;
-      exec.subscription = entity;
-      exec.callback_group = group_info;
-      executables.push_back(exec);
+      exec.subscription = std::move(entity);
+      exec.callback_group = std::move(group_info);
+      executables.push_back(std::move(exec));
       added++;
     }
   }
 
-  for (size_t ii = 0; ii < rcl_wait_set.size_of_services; ++ii) {
-    if (nullptr == rcl_wait_set.services[ii]) {continue;}
+  for (size_t ii : ready.services) {
     auto entity_iter = collection.services.find(rcl_wait_set.services[ii]);
     if (entity_iter != collection.services.end()) {
       auto entity = entity_iter->second.entity.lock();
@@ -176,15 +316,14 @@ ready_executables(
         continue;
       }
       rclcpp::AnyExecutable exec;
-      exec.service = entity;
-      exec.callback_group = group_info;
-      executables.push_back(exec);
+      exec.service = std::move(entity);
+      exec.callback_group = std::move(group_info);
+      executables.push_back(std::move(exec));
       added++;
     }
   }
 
-  for (size_t ii = 0; ii < rcl_wait_set.size_of_clients; ++ii) {
-    if (nullptr == rcl_wait_set.clients[ii]) {continue;}
+  for (size_t ii : ready.clients) {
     auto entity_iter = collection.clients.find(rcl_wait_set.clients[ii]);
     if (entity_iter != collection.clients.end()) {
       auto entity = entity_iter->second.entity.lock();
@@ -196,9 +335,9 @@ ready_executables(
         continue;
       }
       rclcpp::AnyExecutable exec;
-      exec.client = entity;
-      exec.callback_group = group_info;
-      executables.push_back(exec);
+      exec.client = std::move(entity);
+      exec.callback_group = std::move(group_info);
+      executables.push_back(std::move(exec));
       added++;
     }
   }
@@ -216,10 +355,10 @@ ready_executables(
       continue;
     }
     rclcpp::AnyExecutable exec;
-    exec.waitable = waitable;
-    exec.callback_group = group_info;
     exec.data = waitable->take_data();
-    executables.push_back(exec);
+    exec.waitable = std::move(waitable);
+    exec.callback_group = std::move(group_info);
+    executables.push_back(std::move(exec));
     added++;
   }
 
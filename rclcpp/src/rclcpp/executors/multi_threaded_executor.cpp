@@ -39,6 +39,13 @@ MultiThreadedExecutor::MultiThreadedExecutor(
     number_of_threads :
     std::max(std::thread::hardware_concurrency(), 2U);
 
+  if (options.numa_aware && thread_attributes_.empty()) {
+    const auto numa_node_cpus = rclcpp::get_numa_node_cpus();
+    if (numa_node_cpus.size() > 1u) {
+      thread_attributes_ = rclcpp::make_numa_thread_attributes(number_of_threads_, numa_node_cpus);
+    }
+  }
+
   if (number_of_threads_ == 1) {
     RCLCPP_WARN(
       rclcpp::get_logger("rclcpp"),
@@ -56,6 +63,10 @@ MultiThreadedExecutor::spin()
     throw std::runtime_error("spin() called while already spinning");
   }
   RCPPUTILS_SCOPE_EXIT(this->spinning.store(false); );
+  if (!thread_attributes_.empty()) {
+    spin_with_thread_attributes();
+    return;
+  }
   std::vector<std::thread> threads;
   size_t thread_id = 0;
   {
@@ -72,6 +83,32 @@ MultiThreadedExecutor::spin()
   }
 }
 
+void
+MultiThreadedExecutor::spin_with_thread_attributes()
+{
+  std::vector<rclcpp::ThreadWithAttributes> threads;
+  threads.reserve(number_of_threads_);
+  try {
+    std::lock_guard wait_lock{wait_mutex_};
+    for (size_t thread_id = 0; thread_id < number_of_threads_; ++thread_id) {
+      threads.emplace_back(
+        thread_attributes_[thread_id % thread_attributes_.size()],
+        std::bind(&MultiThreadedExecutor::run, this, thread_id));
+    }
+  } catch (...) {
+    // Stop the threads which were already started before reporting the failure
+    this->cancel();
+    for (auto & thread : threads) {
+      thread.join();
+    }
+    throw;
+  }
+
+  for (auto & thread : threads) {
+    thread.join();
+  }
+}
+
 size_t
 MultiThreadedExecutor::get_number_of_threads()
 {
@@ -82,6 +119,7 @@ void
 MultiThreadedExecutor::run(size_t this_thread_number)
 {
   (void)this_thread_number;
+  this->prefault_thread_stack();
   while (rclcpp::ok(this->context_) && spinning.load()) {
     rclcpp::AnyExecutable any_exec;
     {
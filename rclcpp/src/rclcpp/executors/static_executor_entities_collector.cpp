@@ -89,6 +89,16 @@ StaticExecutorEntitiesCollector::fini()
   exec_list_.clear();
 }
 
+void
+StaticExecutorEntitiesCollector::set_frozen(bool frozen)
+{
+  frozen_ = frozen;
+  if (!frozen_ && refresh_pending_) {
+    std::shared_ptr<void> shared_ptr;
+    execute(shared_ptr);
+  }
+}
+
 std::shared_ptr<void>
 StaticExecutorEntitiesCollector::take_data()
 {
@@ -99,6 +109,12 @@ void
 StaticExecutorEntitiesCollector::execute(std::shared_ptr<void> & data)
 {
   (void) data;
+  // Entities are only collected once unfrozen
+  if (frozen_) {
+    refresh_pending_ = true;
+    return;
+  }
+  refresh_pending_ = false;
   // Fill memory strategy with entities coming from weak_nodes_
   fill_memory_strategy();
   // Fill exec_list_ with entities coming from weak_nodes_ (same as memory strategy)
@@ -179,7 +195,7 @@ StaticExecutorEntitiesCollector::fill_executable_list_from_map(
   for (const auto & pair : weak_groups_to_nodes) {
     auto group = pair.first.lock();
     auto node = pair.second.lock();
-    if (!node || !group || !group->can_be_taken_from().load()) {
+    if (!node || !group || !group->can_be_taken_from().load() || !group->is_enabled()) {
       continue;
     }
     group->find_timer_ptrs_if(
@@ -438,8 +454,8 @@ StaticExecutorEntitiesCollector::is_ready(rcl_wait_set_t * p_wait_set)
     if (p_wait_set->guard_conditions[i] != NULL) {
       auto found_guard_condition = std::find_if(
         weak_nodes_to_guard_conditions_.begin(), weak_nodes_to_guard_conditions_.end(),
-        [&](std::pair<rclcpp::node_interfaces::NodeBaseInterface::WeakPtr,
-        const GuardCondition *> pair) -> bool {
+        [&](const std::pair<const rclcpp::node_interfaces::NodeBaseInterface::WeakPtr,
+        const GuardCondition *> & pair) -> bool {
           const rcl_guard_condition_t & rcl_gc = pair.second->get_rcl_guard_condition();
           return &rcl_gc == p_wait_set->guard_conditions[i];
         });
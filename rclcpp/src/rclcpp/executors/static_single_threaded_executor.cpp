@@ -21,9 +21,28 @@
 
 #include "rcpputils/scope_exit.hpp"
 
+#include "rclcpp/allocation_tracking.hpp"
+#include "rclcpp/exceptions.hpp"
+
 using rclcpp::executors::StaticSingleThreadedExecutor;
 using rclcpp::experimental::ExecutableList;
 
+namespace
+{
+
+/// Throw if the executor allocated memory in steady state, since the counter was created.
+void
+check_steady_state_allocations(const rclcpp::allocation_tracking::AllocationCounter & allocations)
+{
+  const uint64_t allocation_count = allocations.get_count();
+  if (allocation_count != 0 && rclcpp::allocation_tracking::is_steady_state()) {
+    throw rclcpp::exceptions::AllocationInSteadyStateError(
+            allocation_count, "spinning a static single threaded executor");
+  }
+}
+
+}  // namespace
+
 StaticSingleThreadedExecutor::StaticSingleThreadedExecutor(
   const rclcpp::ExecutorOptions & options)
 : rclcpp::Executor(options)
@@ -49,11 +68,15 @@ StaticSingleThreadedExecutor::spin()
   // Set memory_strategy_ and exec_list_ based on weak_nodes_
   // Prepare wait_set_ based on memory_strategy_
   entities_collector_->init(&wait_set_, memory_strategy_);
+  freeze_entities_collector();
+  RCPPUTILS_SCOPE_EXIT(entities_collector_->set_frozen(false); );
 
   while (rclcpp::ok(this->context_) && spinning.load()) {
+    const rclcpp::allocation_tracking::AllocationCounter allocations;
     // Refresh wait set and wait for work
     entities_collector_->refresh_wait_set();
     execute_ready_executables();
+    check_steady_state_allocations(allocations);
   }
 }
 
@@ -102,18 +125,28 @@ StaticSingleThreadedExecutor::spin_some_impl(std::chrono::nanoseconds max_durati
     throw std::runtime_error("spin_some() called while already spinning");
   }
   RCPPUTILS_SCOPE_EXIT(this->spinning.store(false); );
+  freeze_entities_collector();
+  RCPPUTILS_SCOPE_EXIT(entities_collector_->set_frozen(false); );
 
   while (rclcpp::ok(context_) && spinning.load() && max_duration_not_elapsed()) {
+    const rclcpp::allocation_tracking::AllocationCounter allocations;
     // Get executables that are ready now
     entities_collector_->refresh_wait_set(std::chrono::milliseconds::zero());
     // Execute ready executables
     bool work_available = execute_ready_executables();
+    check_steady_state_allocations(allocations);
     if (!work_available || !exhaustive) {
       break;
     }
   }
 }
 
+void
+StaticSingleThreadedExecutor::prepare_entities()
+{
+  entities_collector_->init(&wait_set_, memory_strategy_);
+}
+
 void
 StaticSingleThreadedExecutor::spin_once_impl(std::chrono::nanoseconds timeout)
 {
@@ -123,10 +156,37 @@ StaticSingleThreadedExecutor::spin_once_impl(std::chrono::nanoseconds timeout)
   }
 
   if (rclcpp::ok(context_) && spinning.load()) {
+    freeze_entities_collector();
+    RCPPUTILS_SCOPE_EXIT(entities_collector_->set_frozen(false); );
+    const rclcpp::allocation_tracking::AllocationCounter allocations;
     // Wait until we have a ready entity or timeout expired
     entities_collector_->refresh_wait_set(timeout);
     // Execute ready executables
     execute_ready_executables(true);
+    check_steady_state_allocations(allocations);
+  }
+}
+
+void
+StaticSingleThreadedExecutor::set_freeze_entities(bool freeze)
+{
+  if (spinning.load()) {
+    throw std::runtime_error("set_freeze_entities() called while spinning");
+  }
+  freeze_entities_.store(freeze);
+}
+
+bool
+StaticSingleThreadedExecutor::get_freeze_entities() const
+{
+  return freeze_entities_.load();
+}
+
+void
+StaticSingleThreadedExecutor::freeze_entities_collector()
+{
+  if (freeze_entities_.load()) {
+    entities_collector_->set_frozen(true);
   }
 }
 
@@ -229,10 +289,16 @@ StaticSingleThreadedExecutor::execute_ready_executables(bool spin_once)
   // Execute all the ready timers
   for (size_t i = 0; i < wait_set_.size_of_timers; ++i) {
     if (i < entities_collector_->get_number_of_timers()) {
-      if (wait_set_.timers[i] && entities_collector_->get_timer(i)->is_ready()) {
-        auto timer = entities_collector_->get_timer(i);
-        timer->call();
-        execute_timer(std::move(timer));
+      const auto & timer = entities_collector_->get_timer(i);
+      // Timers expiring within their slack share this wakeup, instead of waking up again
+      const bool ready = wait_set_.timers[i] ?
+        timer->is_ready() :
+        timer->get_slack() != std::chrono::nanoseconds::zero() && timer->is_ready_within_slack();
+      if (ready) {
+        if (!timer->call()) {
+          continue;
+        }
+        execute_timer(timer);
         if (spin_once) {
           return true;
         }
@@ -266,7 +332,7 @@ StaticSingleThreadedExecutor::execute_ready_executables(bool spin_once)
   }
   // Execute all the ready waitables
   for (size_t i = 0; i < entities_collector_->get_number_of_waitables(); ++i) {
-    auto waitable = entities_collector_->get_waitable(i);
+    const auto & waitable = entities_collector_->get_waitable(i);
     if (waitable->is_ready(&wait_set_)) {
       auto data = waitable->take_data();
       waitable->execute(data);
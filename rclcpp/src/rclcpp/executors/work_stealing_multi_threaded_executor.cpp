@@ -0,0 +1,216 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rclcpp/executors/work_stealing_multi_threaded_executor.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "rcpputils/scope_exit.hpp"
+
+#include "rclcpp/utilities.hpp"
+
+using rclcpp::executors::WorkStealingMultiThreadedExecutor;
+
+WorkStealingMultiThreadedExecutor::WorkStealingMultiThreadedExecutor(
+  const rclcpp::ExecutorOptions & options,
+  size_t number_of_threads,
+  std::chrono::nanoseconds next_exec_timeout)
+: rclcpp::Executor(options),
+  next_exec_timeout_(next_exec_timeout)
+{
+  number_of_threads_ = number_of_threads > 0 ?
+    number_of_threads :
+    std::max(std::thread::hardware_concurrency(), 2U);
+
+  worker_queues_.reserve(number_of_threads_);
+  for (size_t i = 0; i < number_of_threads_; ++i) {
+    worker_queues_.emplace_back(std::make_unique<WorkerQueue>());
+  }
+}
+
+WorkStealingMultiThreadedExecutor::~WorkStealingMultiThreadedExecutor() {}
+
+void
+WorkStealingMultiThreadedExecutor::spin()
+{
+  if (spinning.exchange(true)) {
+    throw std::runtime_error("spin() called while already spinning");
+  }
+  RCPPUTILS_SCOPE_EXIT(this->spinning.store(false); );
+  workers_should_stop_.store(false);
+
+  std::vector<std::thread> threads;
+  threads.reserve(number_of_threads_);
+  RCPPUTILS_SCOPE_EXIT(this->stop_workers(threads); );
+  for (size_t thread_id = 0; thread_id < number_of_threads_; ++thread_id) {
+    threads.emplace_back([this, thread_id]() {run(thread_id);});
+  }
+
+  dispatch();
+}
+
+size_t
+WorkStealingMultiThreadedExecutor::get_number_of_threads()
+{
+  return number_of_threads_;
+}
+
+void
+WorkStealingMultiThreadedExecutor::dispatch()
+{
+  auto any_exec = std::make_unique<rclcpp::AnyExecutable>();
+  while (rclcpp::ok(this->context_) && spinning.load()) {
+    // Hand out everything that is ready before waiting again.
+    if (get_next_ready_executable(*any_exec)) {
+      push_executable(std::move(any_exec));
+      any_exec = std::make_unique<rclcpp::AnyExecutable>();
+      continue;
+    }
+    wait_for_work(next_exec_timeout_);
+  }
+}
+
+void
+WorkStealingMultiThreadedExecutor::run(size_t this_thread_number)
+{
+  this->prefault_thread_stack();
+  auto & own_queue = *worker_queues_[this_thread_number];
+  while (true) {
+    wait_for_executable(own_queue);
+    if (workers_should_stop_.load()) {
+      return;
+    }
+    // Woken for work another worker took already
+    if (!claim_executable()) {
+      continue;
+    }
+
+    AnyExecutablePtr any_exec = pop_or_steal_executable(this_thread_number);
+    execute_any_executable(*any_exec);
+
+    // Clear the callback_group to prevent the AnyExecutable destructor from
+    // resetting the callback group `can_be_taken_from`
+    any_exec->callback_group.reset();
+  }
+}
+
+void
+WorkStealingMultiThreadedExecutor::push_executable(AnyExecutablePtr any_exec)
+{
+  // Only the dispatching thread pushes work, so next_worker_ needs no synchronization.
+  const size_t target = next_worker_;
+  next_worker_ = (next_worker_ + 1) % number_of_threads_;
+  auto & target_queue = *worker_queues_[target];
+  {
+    std::lock_guard<std::mutex> lock(target_queue.mutex);
+    target_queue.executables.push_back(std::move(any_exec));
+    // Counted once in the queue, so that a claimed executable is always there to be popped
+    pending_executables_++;
+  }
+  if (target_queue.waiting.load()) {
+    target_queue.cv.notify_one();
+    return;
+  }
+  // The worker is busy executing, let an idle one steal the executable
+  for (size_t i = 1; i < number_of_threads_; ++i) {
+    auto & idle_queue = *worker_queues_[(target + i) % number_of_threads_];
+    if (idle_queue.waiting.load()) {
+      std::lock_guard<std::mutex> lock(idle_queue.mutex);
+      idle_queue.cv.notify_one();
+      return;
+    }
+  }
+}
+
+void
+WorkStealingMultiThreadedExecutor::wait_for_executable(WorkerQueue & own_queue)
+{
+  std::unique_lock<std::mutex> lock(own_queue.mutex);
+  if (workers_should_stop_.load() || !own_queue.executables.empty()) {
+    return;
+  }
+  // Announced before checking for pending work, so that either this worker sees the work
+  // pushed concurrently or the dispatching thread sees the worker waiting and wakes it.
+  own_queue.waiting.store(true);
+  if (pending_executables_.load() == 0) {
+    own_queue.cv.wait(lock);
+  }
+  own_queue.waiting.store(false);
+}
+
+bool
+WorkStealingMultiThreadedExecutor::claim_executable()
+{
+  size_t pending = pending_executables_.load();
+  while (pending > 0) {
+    if (pending_executables_.compare_exchange_weak(pending, pending - 1)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+WorkStealingMultiThreadedExecutor::AnyExecutablePtr
+WorkStealingMultiThreadedExecutor::pop_or_steal_executable(size_t this_thread_number)
+{
+  // The queues hold at least one executable per claim not popped yet, so the claimed one is
+  // found, even if the workers popping concurrently make a round miss it.
+  while (true) {
+    // Oldest work from the own queue first.
+    {
+      auto & own_queue = worker_queues_[this_thread_number];
+      std::lock_guard<std::mutex> lock(own_queue->mutex);
+      if (!own_queue->executables.empty()) {
+        AnyExecutablePtr any_exec = std::move(own_queue->executables.front());
+        own_queue->executables.pop_front();
+        return any_exec;
+      }
+    }
+    // Otherwise steal from the back of the other queues.
+    for (size_t i = 1; i < number_of_threads_; ++i) {
+      auto & victim_queue = worker_queues_[(this_thread_number + i) % number_of_threads_];
+      std::lock_guard<std::mutex> lock(victim_queue->mutex);
+      if (!victim_queue->executables.empty()) {
+        AnyExecutablePtr any_exec = std::move(victim_queue->executables.back());
+        victim_queue->executables.pop_back();
+        return any_exec;
+      }
+    }
+  }
+}
+
+void
+WorkStealingMultiThreadedExecutor::stop_workers(std::vector<std::thread> & threads)
+{
+  workers_should_stop_.store(true);
+  for (auto & worker_queue : worker_queues_) {
+    std::lock_guard<std::mutex> lock(worker_queue->mutex);
+    worker_queue->cv.notify_all();
+  }
+  for (auto & thread : threads) {
+    thread.join();
+  }
+  threads.clear();
+
+  // Any executable left behind is discarded, which releases its callback group.
+  for (auto & worker_queue : worker_queues_) {
+    std::lock_guard<std::mutex> lock(worker_queue->mutex);
+    worker_queue->executables.clear();
+  }
+  pending_executables_.store(0);
+}
@@ -14,27 +14,132 @@
 
 #include "rclcpp/experimental/executors/events_executor/events_executor.hpp"
 
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
 #include <memory>
+#include <shared_mutex>
+#include <thread>
 #include <utility>
 #include <vector>
 
+#include "rclcpp/experimental/subscription_intra_process_base.hpp"
+
 #include "rcpputils/scope_exit.hpp"
 
 using namespace std::chrono_literals;
 
 using rclcpp::experimental::executors::EventsExecutor;
+using rclcpp::experimental::executors::ExecutorEvent;
+
+namespace
+{
+
+// Generation of a slot once released, skipping zero which is used by the events without slot
+uint32_t
+next_generation(uint32_t generation)
+{
+  return generation == UINT32_MAX ? 1 : generation + 1;
+}
+
+// Number of events of an entity worth keeping queued, as its history drops older messages
+uint32_t
+get_max_events(const rclcpp::QoS & qos)
+{
+  if (qos.history() != rclcpp::HistoryPolicy::KeepLast) {
+    return 0;
+  }
+  return static_cast<uint32_t>(std::min<size_t>(qos.depth(), UINT32_MAX));
+}
+
+// Executor whose events are being executed by this thread, if any
+thread_local const EventsExecutor * t_executing_executor = nullptr;
+
+// Marks the calling thread as executing the events of an executor, until destroyed
+class ExecutingExecutorScope
+{
+public:
+  explicit ExecutingExecutorScope(const EventsExecutor * executor)
+  : previous_(std::exchange(t_executing_executor, executor))
+  {}
+
+  ~ExecutingExecutorScope()
+  {
+    // Executors can be spun from the callbacks of other executors
+    t_executing_executor = previous_;
+  }
+
+private:
+  const EventsExecutor * previous_;
+};
+
+// Entity whose callback is being executed by this thread: messages aren't executed inline
+// nested in the callback of the same entity, or of another entity of the same callback group
+struct RunningEntity
+{
+  // Event being executed, whose callback group is only looked up when needed
+  const ExecutorEvent * event;
+  const void * entity_key;
+  const rclcpp::CallbackGroup * callback_group;
+};
+thread_local RunningEntity t_running_entity {nullptr, nullptr, nullptr};
+
+// Marks the calling thread as executing the callback of an entity, until destroyed
+class RunningEntityScope
+{
+public:
+  explicit RunningEntityScope(const RunningEntity & running_entity)
+  : previous_(std::exchange(t_running_entity, running_entity))
+  {}
+
+  ~RunningEntityScope()
+  {
+    t_running_entity = previous_;
+  }
+
+private:
+  RunningEntity previous_;
+};
+
+// Kind of the entity executed for the given event type
+rclcpp::CallbackStatistics::EntityType
+get_entity_type(ExecutorEventType type)
+{
+  using EntityType = rclcpp::CallbackStatistics::EntityType;
+  switch (type) {
+    case ExecutorEventType::CLIENT_EVENT:
+      return EntityType::Client;
+    case ExecutorEventType::SUBSCRIPTION_EVENT:
+      return EntityType::Subscription;
+    case ExecutorEventType::SERVICE_EVENT:
+      return EntityType::Service;
+    case ExecutorEventType::TIMER_EVENT:
+      return EntityType::Timer;
+    case ExecutorEventType::WAITABLE_EVENT:
+      break;
+  }
+  return EntityType::Waitable;
+}
+
+}  // namespace
 
 EventsExecutor::EventsExecutor(
   rclcpp::experimental::executors::EventsQueue::UniquePtr events_queue,
   bool execute_timers_separate_thread,
-  const rclcpp::ExecutorOptions & options)
+  const rclcpp::ExecutorOptions & options,
+  size_t number_of_threads)
 : rclcpp::Executor(options)
 {
+  number_of_threads_ = number_of_threads > 0 ?
+    number_of_threads :
+    std::max(std::thread::hardware_concurrency(), 1U);
+
   // Get ownership of the queue used to store events.
   if (!events_queue) {
     throw std::invalid_argument("events_queue can't be a null pointer");
   }
   events_queue_ = std::move(events_queue);
+  flight_recorder_ = get_flight_recorder();
 
   // Create timers manager
   // The timers manager can be used either to only track timers (in this case an expired
@@ -43,12 +148,23 @@ EventsExecutor::EventsExecutor(
   std::function<void(const rclcpp::TimerBase *)> timer_on_ready_cb = nullptr;
   if (!execute_timers_separate_thread) {
     timer_on_ready_cb = [this](const rclcpp::TimerBase * timer_id) {
-        ExecutorEvent event = {timer_id, -1, ExecutorEventType::TIMER_EVENT, 1};
+        ExecutorEvent event = {timer_id, -1, ExecutorEventType::TIMER_EVENT, 1, 0, 0, 0};
         this->events_queue_->enqueue(event);
       };
   }
   timers_manager_ =
     std::make_shared<rclcpp::experimental::TimersManager>(context_, timer_on_ready_cb);
+  execute_timers_separate_thread_ = execute_timers_separate_thread;
+
+  // A thread of spin() waiting for the head timer must re-compute its timeout when timers
+  // change. This event isn't associated to any entity and it's ignored when executed.
+  timers_manager_->set_on_timers_updated_callback(
+    [this]() {
+      if (wait_for_timers_in_events_loop_.load() && spinning.load()) {
+        ExecutorEvent wake_up_event = {nullptr, -1, ExecutorEventType::WAITABLE_EVENT, 1, 0, 0, 0};
+        this->events_queue_->enqueue(wake_up_event);
+      }
+    });
 
   this->current_entities_collection_ =
     std::make_shared<rclcpp::executors::ExecutorEntitiesCollection>();
@@ -67,16 +183,19 @@ EventsExecutor::EventsExecutor(
   // Make sure that the notify waitable is immediately added to the collection
   // to avoid missing events
   this->add_notify_waitable_to_collection(current_entities_collection_->waitables);
+  // Keyed by the waitable pointer, as in the collection
+  auto notify_waitable = std::static_pointer_cast<rclcpp::Waitable>(notify_waitable_);
+  const ExecutorEvent notify_waitable_event = this->acquire_entity_slot(
+    notify_waitable.get(), ExecutorEventType::WAITABLE_EVENT, notify_waitable, {});
 
   notify_waitable_->add_guard_condition(interrupt_guard_condition_);
   notify_waitable_->add_guard_condition(shutdown_guard_condition_);
 
   notify_waitable_->set_on_ready_callback(
-    this->create_waitable_callback(notify_waitable_.get()));
+    this->create_waitable_callback(notify_waitable_event));
 
-  auto notify_waitable_entity_id = notify_waitable_.get();
   notify_waitable_->set_on_ready_callback(
-    [this, notify_waitable_entity_id](size_t num_events, int waitable_data) {
+    [this, notify_waitable_event](size_t num_events, int waitable_data) {
       // The notify waitable has a special callback.
       // We don't care about how many events as when we wake up the executor we are going to
       // process everything regardless.
@@ -87,8 +206,9 @@ EventsExecutor::EventsExecutor(
         return;
       }
 
-      ExecutorEvent event =
-      {notify_waitable_entity_id, waitable_data, ExecutorEventType::WAITABLE_EVENT, 1};
+      ExecutorEvent event = notify_waitable_event;
+      event.waitable_data = waitable_data;
+      event.num_events = 1;
       this->events_queue_->enqueue(event);
     });
 
@@ -99,8 +219,12 @@ EventsExecutor::EventsExecutor(
 EventsExecutor::~EventsExecutor()
 {
   spinning.store(false);
+  timers_manager_->set_on_timers_updated_callback(nullptr);
   notify_waitable_->clear_on_ready_callback();
-  this->refresh_current_collection({});
+  // Copied, as the entities are removed from the current collection while iterating
+  const rclcpp::executors::ExecutorEntitiesCollection all_entities = *current_entities_collection_;
+  this->refresh_current_collection({}, all_entities);
+  groups_entities_.clear();
 }
 
 void
@@ -111,17 +235,317 @@ EventsExecutor::spin()
   }
   RCPPUTILS_SCOPE_EXIT(this->spinning.store(false); );
 
-  timers_manager_->start();
+  if (!wait_for_timers_in_events_loop_.load()) {
+    timers_manager_->start();
+  }
   RCPPUTILS_SCOPE_EXIT(timers_manager_->stop(); );
 
+  if (!thread_attributes_.empty()) {
+    this->spin_with_thread_attributes();
+    return;
+  }
+
+  if (number_of_threads_ == 1) {
+    ExecutingExecutorScope executing_scope(this);
+    while (rclcpp::ok(context_) && spinning.load()) {
+      // Wait until we get an event
+      ExecutorEvent event;
+      bool has_event = this->dequeue_event(event);
+      if (has_event) {
+        this->execute_event(event);
+      }
+    }
+    return;
+  }
+
+  std::vector<std::thread> threads;
+  threads.reserve(number_of_threads_ - 1);
+  for (size_t i = 0; i < number_of_threads_ - 1; ++i) {
+    threads.emplace_back([this]() {this->run_events_loop();});
+  }
+  this->run_events_loop();
+  for (auto & thread : threads) {
+    thread.join();
+  }
+}
+
+void
+EventsExecutor::spin_with_thread_attributes()
+{
+  std::vector<rclcpp::ThreadWithAttributes> threads;
+  threads.reserve(number_of_threads_);
+  try {
+    for (size_t i = 0; i < number_of_threads_; ++i) {
+      threads.emplace_back(
+        thread_attributes_[i % thread_attributes_.size()],
+        [this]() {this->run_events_loop();});
+    }
+  } catch (...) {
+    // Stop the threads which were already started before reporting the failure
+    this->cancel();
+    for (auto & thread : threads) {
+      thread.join();
+    }
+    throw;
+  }
+
+  for (auto & thread : threads) {
+    thread.join();
+  }
+}
+
+size_t
+EventsExecutor::get_number_of_threads() const
+{
+  return number_of_threads_;
+}
+
+void
+EventsExecutor::set_wait_for_timers_in_events_loop(bool wait_for_timers)
+{
+  if (wait_for_timers && execute_timers_separate_thread_) {
+    throw std::invalid_argument(
+            "timers executed in a separate thread can't be waited for by spin()");
+  }
+  if (spinning.load()) {
+    throw std::runtime_error(
+            "set_wait_for_timers_in_events_loop() called while spinning");
+  }
+  wait_for_timers_in_events_loop_.store(wait_for_timers);
+}
+
+bool
+EventsExecutor::get_wait_for_timers_in_events_loop() const
+{
+  return wait_for_timers_in_events_loop_.load();
+}
+
+void
+EventsExecutor::set_intra_process_inline_depth(size_t max_depth)
+{
+  if (max_depth > 0 && number_of_threads_ > 1) {
+    throw std::invalid_argument(
+            "intra-process messages can't be executed inline with more than one thread");
+  }
+  std::lock_guard<std::recursive_mutex> lock(collection_mutex_);
+  intra_process_inline_depth_ = max_depth;
+  for (const auto & [waitable_ptr, entry] : current_entities_collection_->waitables) {
+    (void)waitable_ptr;
+    auto waitable = entry.entity.lock();
+    if (waitable) {
+      this->set_inline_execution(waitable, entry.callback_group, max_depth);
+    }
+  }
+}
+
+size_t
+EventsExecutor::get_intra_process_inline_depth()
+{
+  std::lock_guard<std::recursive_mutex> lock(collection_mutex_);
+  return intra_process_inline_depth_;
+}
+
+bool
+EventsExecutor::dequeue_event(ExecutorEvent & event)
+{
+  if (!wait_for_timers_in_events_loop_.load()) {
+    return this->poll_and_dequeue(event);
+  }
+
+  // Wait until the head timer is ready, the waiting threads are woken up if it changes
+  const auto timeout = std::max(timers_manager_->get_head_timeout(), 0ns);
+  if (this->poll_and_dequeue(event, timeout)) {
+    return true;
+  }
+  // Push the events of the ready timers, this thread or another one then executes them
+  timers_manager_->execute_ready_timers();
+  return events_queue_->dequeue(event, 0ns);
+}
+
+bool
+EventsExecutor::poll_and_dequeue(ExecutorEvent & event, std::chrono::nanoseconds timeout)
+{
+  if (busy_wait_duration_ > 0ns && timeout > 0ns) {
+    const auto busy_wait = std::min(busy_wait_duration_, timeout);
+    const auto start = std::chrono::steady_clock::now();
+    std::chrono::nanoseconds elapsed{0};
+    do {
+      if (events_queue_->dequeue(event, 0ns)) {
+        return true;
+      }
+      elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start);
+    } while (elapsed < busy_wait);
+    // The maximum timeout waits forever
+    if (timeout != std::chrono::nanoseconds::max()) {
+      timeout -= std::min(elapsed, timeout);
+    }
+  }
+  return events_queue_->dequeue(event, timeout);
+}
+
+void
+EventsExecutor::prepare_entities()
+{
+  this->refresh_current_collection_from_callback_groups();
+}
+
+void
+EventsExecutor::run_events_loop()
+{
+  this->prefault_thread_stack();
+  ExecutingExecutorScope executing_scope(this);
   while (rclcpp::ok(context_) && spinning.load()) {
-    // Wait until we get an event
     ExecutorEvent event;
-    bool has_event = events_queue_->dequeue(event);
+    bool has_event = this->dequeue_event(event);
     if (has_event) {
-      this->execute_event(event);
+      this->execute_event_exclusively(event);
+    }
+  }
+
+  // Only one thread is woken up by the event that stopped the spin, so wake up the next one.
+  // This event isn't associated to any entity and it's ignored when executed.
+  ExecutorEvent wake_up_event = {nullptr, -1, ExecutorEventType::WAITABLE_EVENT, 1, 0, 0, 0};
+  events_queue_->enqueue(wake_up_event);
+}
+
+void
+EventsExecutor::execute_event_exclusively(const ExecutorEvent & event)
+{
+  if (!event.entity_key) {
+    return;
+  }
+
+  rclcpp::CallbackGroup::SharedPtr group = this->get_event_callback_group(event);
+  if (group && group->type() == rclcpp::CallbackGroupType::Reentrant) {
+    group.reset();
+  }
+  // Reader writer groups need the entity itself, to know whether it has shared access
+  const void * entity = nullptr;
+  if (group && group->type() == rclcpp::CallbackGroupType::ReaderWriter) {
+    entity = this->get_event_entity(event);
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(dispatch_mutex_);
+    const bool entity_busy = busy_entities_.count(event.entity_key) != 0;
+    if (entity_busy || (group && !group->can_start_callback(entity))) {
+      deferred_events_.push_back(event);
+      return;
+    }
+    busy_entities_.insert(event.entity_key);
+    if (group) {
+      group->start_callback(entity);
+    }
+  }
+
+  RCPPUTILS_SCOPE_EXIT(this->release_event_entity(event.entity_key, group, entity); );
+  this->execute_event(event);
+}
+
+bool
+EventsExecutor::execute_inline_exclusively(
+  const rclcpp::Waitable * waitable,
+  const rclcpp::CallbackGroup::WeakPtr & weak_group,
+  const std::function<void()> & execute)
+{
+  // Only the callbacks of the events of this executor are known not to run in the group
+  if (t_executing_executor != this || !t_running_entity.entity_key ||
+    t_running_entity.entity_key == waitable)
+  {
+    return false;
+  }
+  rclcpp::CallbackGroup::SharedPtr group = weak_group.lock();
+  const rclcpp::CallbackGroup * target_group = group.get();
+  if (group) {
+    const rclcpp::CallbackGroup * running_group = t_running_entity.callback_group;
+    if (!running_group && t_running_entity.event) {
+      running_group = this->get_event_callback_group(*t_running_entity.event).get();
+    }
+    if (target_group == running_group) {
+      return false;
+    }
+    if (group->type() == rclcpp::CallbackGroupType::Reentrant) {
+      group.reset();
+    }
+  }
+  // The slot keeps the entity as a pointer to the waitable, like get_event_entity()
+  const void * entity = nullptr;
+  if (group && group->type() == rclcpp::CallbackGroupType::ReaderWriter) {
+    entity = waitable;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(dispatch_mutex_);
+    if (busy_entities_.count(waitable) != 0 || (group && !group->can_start_callback(entity))) {
+      return false;
+    }
+    busy_entities_.insert(waitable);
+    if (group) {
+      group->start_callback(entity);
+    }
+  }
+
+  RCPPUTILS_SCOPE_EXIT(this->release_event_entity(waitable, group, entity); );
+  RunningEntityScope running_scope({nullptr, waitable, target_group});
+  execute();
+  return true;
+}
+
+void
+EventsExecutor::release_event_entity(
+  const void * entity_key,
+  const rclcpp::CallbackGroup::SharedPtr & group,
+  const void * entity)
+{
+  std::vector<ExecutorEvent> deferred_events;
+  {
+    std::lock_guard<std::mutex> lock(dispatch_mutex_);
+    busy_entities_.erase(entity_key);
+    if (group) {
+      group->finish_callback(entity);
+    }
+    deferred_events.swap(deferred_events_);
+  }
+
+  // Give the deferred events another chance, preserving their relative order
+  for (const auto & deferred_event : deferred_events) {
+    events_queue_->enqueue(deferred_event);
+  }
+}
+
+const void *
+EventsExecutor::get_event_entity(const ExecutorEvent & event)
+{
+  if (event.type == ExecutorEventType::TIMER_EVENT) {
+    return event.entity_key;
+  }
+  // The slot keeps the entity as a pointer to its base class
+  auto entity = this->retrieve_entity<void>(event);
+  return entity.get();
+}
+
+rclcpp::CallbackGroup::SharedPtr
+EventsExecutor::get_event_callback_group(const ExecutorEvent & event)
+{
+  if (event.type == ExecutorEventType::TIMER_EVENT) {
+    std::lock_guard<std::recursive_mutex> lock(collection_mutex_);
+    auto it = timer_groups_.find(static_cast<const rclcpp::TimerBase *>(event.entity_key));
+    if (it == timer_groups_.end()) {
+      return nullptr;
     }
+    return it->second.lock();
+  }
+
+  std::shared_lock<std::shared_mutex> lock(slots_mutex_);
+  if (event.entity_slot >= entity_slots_.size()) {
+    return nullptr;
   }
+  const EntitySlot & slot = entity_slots_[event.entity_slot];
+  if (slot.generation != event.entity_generation) {
+    return nullptr;
+  }
+  return slot.callback_group.lock();
 }
 
 void
@@ -147,6 +571,7 @@ EventsExecutor::spin_some_impl(std::chrono::nanoseconds max_duration, bool exhau
   }
 
   RCPPUTILS_SCOPE_EXIT(this->spinning.store(false); );
+  ExecutingExecutorScope executing_scope(this);
 
   auto start = std::chrono::steady_clock::now();
 
@@ -205,6 +630,7 @@ EventsExecutor::spin_once_impl(std::chrono::nanoseconds timeout)
   if (timeout < 0ns) {
     timeout = std::chrono::nanoseconds::max();
   }
+  ExecutingExecutorScope executing_scope(this);
 
   // Select the smallest between input timeout and timer timeout
   bool is_timer_timeout = false;
@@ -215,7 +641,7 @@ EventsExecutor::spin_once_impl(std::chrono::nanoseconds timeout)
   }
 
   ExecutorEvent event;
-  bool has_event = events_queue_->dequeue(event, timeout);
+  bool has_event = this->poll_and_dequeue(event, timeout);
 
   // If we wake up from the wait with an event, it means that it
   // arrived before any of the timers expired.
@@ -270,16 +696,17 @@ EventsExecutor::remove_node(std::shared_ptr<rclcpp::Node> node_ptr, bool notify)
 void
 EventsExecutor::execute_event(const ExecutorEvent & event)
 {
+  RunningEntityScope running_scope({&event, event.entity_key, nullptr});
+  // Wake-up events aren't associated to any entity, nothing is executed for them
+  rclcpp::FlightRecorder::Token flight_record;
+  if (flight_recorder_ && event.entity_key) {
+    flight_record = flight_recorder_->start(get_entity_type(event.type), event.entity_key);
+  }
+
   switch (event.type) {
     case ExecutorEventType::CLIENT_EVENT:
       {
-        rclcpp::ClientBase::SharedPtr client;
-        {
-          std::lock_guard<std::recursive_mutex> lock(collection_mutex_);
-          client = this->retrieve_entity(
-            static_cast<const rcl_client_t *>(event.entity_key),
-            current_entities_collection_->clients);
-        }
+        auto client = this->retrieve_entity<rclcpp::ClientBase>(event);
         if (client) {
           for (size_t i = 0; i < event.num_events; i++) {
             execute_client(client);
@@ -290,13 +717,7 @@ EventsExecutor::execute_event(const ExecutorEvent & event)
       }
     case ExecutorEventType::SUBSCRIPTION_EVENT:
       {
-        rclcpp::SubscriptionBase::SharedPtr subscription;
-        {
-          std::lock_guard<std::recursive_mutex> lock(collection_mutex_);
-          subscription = this->retrieve_entity(
-            static_cast<const rcl_subscription_t *>(event.entity_key),
-            current_entities_collection_->subscriptions);
-        }
+        auto subscription = this->retrieve_entity<rclcpp::SubscriptionBase>(event);
         if (subscription) {
           for (size_t i = 0; i < event.num_events; i++) {
             execute_subscription(subscription);
@@ -306,13 +727,7 @@ EventsExecutor::execute_event(const ExecutorEvent & event)
       }
     case ExecutorEventType::SERVICE_EVENT:
       {
-        rclcpp::ServiceBase::SharedPtr service;
-        {
-          std::lock_guard<std::recursive_mutex> lock(collection_mutex_);
-          service = this->retrieve_entity(
-            static_cast<const rcl_service_t *>(event.entity_key),
-            current_entities_collection_->services);
-        }
+        auto service = this->retrieve_entity<rclcpp::ServiceBase>(event);
         if (service) {
           for (size_t i = 0; i < event.num_events; i++) {
             execute_service(service);
@@ -329,13 +744,7 @@ EventsExecutor::execute_event(const ExecutorEvent & event)
       }
     case ExecutorEventType::WAITABLE_EVENT:
       {
-        rclcpp::Waitable::SharedPtr waitable;
-        {
-          std::lock_guard<std::recursive_mutex> lock(collection_mutex_);
-          waitable = this->retrieve_entity(
-            static_cast<const rclcpp::Waitable *>(event.entity_key),
-            current_entities_collection_->waitables);
-        }
+        auto waitable = this->retrieve_entity<rclcpp::Waitable>(event);
         if (waitable) {
           for (size_t i = 0; i < event.num_events; i++) {
             auto data = waitable->take_data_by_entity_id(event.waitable_data);
@@ -345,6 +754,10 @@ EventsExecutor::execute_event(const ExecutorEvent & event)
         break;
       }
   }
+
+  if (flight_recorder_) {
+    flight_recorder_->end(flight_record);
+  }
 }
 
 void
@@ -383,6 +796,14 @@ EventsExecutor::get_all_callback_groups()
   return this->entities_collector_->get_all_callback_groups();
 }
 
+rclcpp::ExecutorBacklog
+EventsExecutor::get_backlog()
+{
+  rclcpp::ExecutorBacklog backlog = rclcpp::Executor::get_backlog();
+  backlog.events_queue_size = events_queue_->size();
+  return backlog;
+}
+
 std::vector<rclcpp::CallbackGroup::WeakPtr>
 EventsExecutor::get_manually_added_callback_groups()
 {
@@ -400,65 +821,79 @@ EventsExecutor::get_automatically_added_callback_groups_from_nodes()
 void
 EventsExecutor::refresh_current_collection_from_callback_groups()
 {
-  // Build the new collection
   this->entities_collector_->update_collections();
   auto callback_groups = this->entities_collector_->get_all_callback_groups();
-  rclcpp::executors::ExecutorEntitiesCollection new_collection;
-  rclcpp::executors::build_entities_collection(callback_groups, new_collection);
-
-  // TODO(alsora): this may be implemented in a better way.
-  // We need the notify waitable to be included in the executor "current_collection"
-  // because we need to be able to retrieve events for it.
-  // We could explicitly check for the notify waitable ID when we receive a waitable event
-  // but I think that it's better if the waitable was in the collection and it could be
-  // retrieved in the "standard" way.
-  // To do it, we need to add the notify waitable as an entry in both the new and
-  // current collections such that it's neither added or removed.
-  this->add_notify_waitable_to_collection(new_collection.waitables);
 
   // Acquire lock before modifying the current collection
   std::lock_guard<std::recursive_mutex> lock(collection_mutex_);
-  this->add_notify_waitable_to_collection(current_entities_collection_->waitables);
-
-  this->refresh_current_collection(new_collection);
+  // Only the groups which changed are collected again, and only their changes are applied.
+  // The notify waitable isn't in any group, so it's never removed from the current collection.
+  rclcpp::executors::ExecutorEntitiesCollection added_entities;
+  rclcpp::executors::ExecutorEntitiesCollection removed_entities;
+  rclcpp::executors::collect_entities_changes(
+    callback_groups, groups_entities_, added_entities, removed_entities);
+
+  this->refresh_current_collection(added_entities, removed_entities);
 }
 
 void
 EventsExecutor::refresh_current_collection(
-  const rclcpp::executors::ExecutorEntitiesCollection & new_collection)
+  const rclcpp::executors::ExecutorEntitiesCollection & added_entities,
+  const rclcpp::executors::ExecutorEntitiesCollection & removed_entities)
 {
   // Acquire lock before modifying the current collection
   std::lock_guard<std::recursive_mutex> lock(collection_mutex_);
 
-  current_entities_collection_->timers.update(
-    new_collection.timers,
+  current_entities_collection_->timers.apply_changes(
+    added_entities.timers, removed_entities.timers,
     [this](rclcpp::TimerBase::SharedPtr timer) {timers_manager_->add_timer(timer);},
     [this](rclcpp::TimerBase::SharedPtr timer) {timers_manager_->remove_timer(timer);});
 
-  current_entities_collection_->subscriptions.update(
-    new_collection.subscriptions,
-    [this](auto subscription) {
-      subscription->set_on_new_message_callback(
-        this->create_entity_callback(
-          subscription->get_subscription_handle().get(), ExecutorEventType::SUBSCRIPTION_EVENT));
+  const bool timers_changed = !added_entities.timers.empty() || !removed_entities.timers.empty();
+  if (number_of_threads_ > 1 && timers_changed) {
+    timer_groups_.clear();
+    for (const auto & [timer_handle, entry] : current_entities_collection_->timers) {
+      (void)timer_handle;
+      auto timer = entry.entity.lock();
+      if (timer) {
+        timer_groups_.emplace(timer.get(), entry.callback_group);
+      }
+    }
+  }
+
+  current_entities_collection_->subscriptions.apply_changes(
+    added_entities.subscriptions, removed_entities.subscriptions,
+    [this, &added_entities](auto subscription) {
+      const auto handle = subscription->get_subscription_handle().get();
+      ExecutorEvent event = this->acquire_entity_slot(
+        handle, ExecutorEventType::SUBSCRIPTION_EVENT, subscription,
+        added_entities.subscriptions.at(handle).callback_group);
+      event.max_events = get_max_events(subscription->get_actual_qos());
+      subscription->set_on_new_message_callback(this->create_entity_callback(event));
     },
     [](auto subscription) {subscription->clear_on_new_message_callback();});
 
-  current_entities_collection_->clients.update(
-    new_collection.clients,
-    [this](auto client) {
+  current_entities_collection_->clients.apply_changes(
+    added_entities.clients, removed_entities.clients,
+    [this, &added_entities](auto client) {
+      const auto handle = client->get_client_handle().get();
       client->set_on_new_response_callback(
         this->create_entity_callback(
-          client->get_client_handle().get(), ExecutorEventType::CLIENT_EVENT));
+          this->acquire_entity_slot(
+            handle, ExecutorEventType::CLIENT_EVENT, client,
+            added_entities.clients.at(handle).callback_group)));
     },
     [](auto client) {client->clear_on_new_response_callback();});
 
-  current_entities_collection_->services.update(
-    new_collection.services,
-    [this](auto service) {
+  current_entities_collection_->services.apply_changes(
+    added_entities.services, removed_entities.services,
+    [this, &added_entities](auto service) {
+      const auto handle = service->get_service_handle().get();
       service->set_on_new_request_callback(
         this->create_entity_callback(
-          service->get_service_handle().get(), ExecutorEventType::SERVICE_EVENT));
+          this->acquire_entity_slot(
+            handle, ExecutorEventType::SERVICE_EVENT, service,
+            added_entities.services.at(handle).callback_group)));
     },
     [](auto service) {service->clear_on_new_request_callback();});
 
@@ -469,39 +904,145 @@ EventsExecutor::refresh_current_collection(
     [](auto guard_condition) {guard_condition->set_on_trigger_callback(nullptr);});
   */
 
-  current_entities_collection_->waitables.update(
-    new_collection.waitables,
-    [this](auto waitable) {
-      waitable->set_on_ready_callback(
-        this->create_waitable_callback(waitable.get()));
+  current_entities_collection_->waitables.apply_changes(
+    added_entities.waitables, removed_entities.waitables,
+    [this, &added_entities](auto waitable) {
+      ExecutorEvent event = this->acquire_entity_slot(
+        waitable.get(), ExecutorEventType::WAITABLE_EVENT, waitable,
+        added_entities.waitables.at(waitable.get()).callback_group);
+      auto intra_process_subscription =
+        std::dynamic_pointer_cast<rclcpp::experimental::SubscriptionIntraProcessBase>(waitable);
+      if (intra_process_subscription) {
+        event.max_events = get_max_events(intra_process_subscription->get_actual_qos());
+      }
+      waitable->set_on_ready_callback(this->create_waitable_callback(event));
+      if (intra_process_inline_depth_ > 0) {
+        this->set_inline_execution(
+          waitable, added_entities.waitables.at(waitable.get()).callback_group,
+          intra_process_inline_depth_);
+      }
     },
-    [](auto waitable) {waitable->clear_on_ready_callback();});
+    [this](auto waitable) {
+      waitable->clear_on_ready_callback();
+      if (intra_process_inline_depth_ > 0) {
+        this->set_inline_execution(waitable, {}, 0);
+      }
+    });
+
+  this->release_removed_entity_slots(removed_entities);
 }
 
 std::function<void(size_t)>
-EventsExecutor::create_entity_callback(
-  void * entity_key, ExecutorEventType event_type)
+EventsExecutor::create_entity_callback(const ExecutorEvent & entity_event)
 {
   std::function<void(size_t)>
-  callback = [this, entity_key, event_type](size_t num_events) {
-      ExecutorEvent event = {entity_key, -1, event_type, num_events};
+  callback = [this, entity_event](size_t num_events) {
+      ExecutorEvent event = entity_event;
+      event.num_events = num_events;
       this->events_queue_->enqueue(event);
     };
   return callback;
 }
 
 std::function<void(size_t, int)>
-EventsExecutor::create_waitable_callback(const rclcpp::Waitable * entity_key)
+EventsExecutor::create_waitable_callback(const ExecutorEvent & waitable_event)
 {
   std::function<void(size_t, int)>
-  callback = [this, entity_key](size_t num_events, int waitable_data) {
-      ExecutorEvent event =
-      {entity_key, waitable_data, ExecutorEventType::WAITABLE_EVENT, num_events};
+  callback = [this, waitable_event](size_t num_events, int waitable_data) {
+      ExecutorEvent event = waitable_event;
+      event.waitable_data = waitable_data;
+      event.num_events = num_events;
       this->events_queue_->enqueue(event);
     };
   return callback;
 }
 
+ExecutorEvent
+EventsExecutor::acquire_entity_slot(
+  const void * entity_key,
+  ExecutorEventType type,
+  std::shared_ptr<void> entity,
+  rclcpp::CallbackGroup::WeakPtr callback_group)
+{
+  std::unique_lock<std::shared_mutex> lock(slots_mutex_);
+  uint32_t index = 0;
+  auto it = entity_slot_indices_.find(entity_key);
+  if (it != entity_slot_indices_.end()) {
+    // A new entity with the handle of a destroyed one, whose events must be ignored
+    index = it->second;
+    entity_slots_[index].generation = next_generation(entity_slots_[index].generation);
+  } else if (!free_entity_slots_.empty()) {
+    index = free_entity_slots_.back();
+    free_entity_slots_.pop_back();
+  } else {
+    index = static_cast<uint32_t>(entity_slots_.size());
+    entity_slots_.emplace_back();
+  }
+  EntitySlot & slot = entity_slots_[index];
+  slot.type = type;
+  slot.entity_key = entity_key;
+  slot.entity = std::move(entity);
+  slot.callback_group = std::move(callback_group);
+  entity_slot_indices_[entity_key] = index;
+  return {entity_key, -1, type, 0, index, slot.generation, 0};
+}
+
+void
+EventsExecutor::release_removed_entity_slots(
+  const rclcpp::executors::ExecutorEntitiesCollection & removed_entities)
+{
+  const auto & collection = *current_entities_collection_;
+  std::unique_lock<std::shared_mutex> lock(slots_mutex_);
+  auto release = [this](const void * entity_key) {
+      auto it = entity_slot_indices_.find(entity_key);
+      if (it == entity_slot_indices_.end()) {
+        return;
+      }
+      EntitySlot & slot = entity_slots_[it->second];
+      slot.generation = next_generation(slot.generation);
+      slot.entity_key = nullptr;
+      slot.entity.reset();
+      slot.callback_group.reset();
+      free_entity_slots_.push_back(it->second);
+      entity_slot_indices_.erase(it);
+    };
+  // The handle of a removed entity may have been reused by an added one, which keeps the slot
+  auto release_removed = [&release](const auto & removed, const auto & current) {
+      for (const auto & [key, entry] : removed) {
+        (void)entry;
+        if (current.count(key) == 0) {
+          release(key);
+        }
+      }
+    };
+  release_removed(removed_entities.clients, collection.clients);
+  release_removed(removed_entities.subscriptions, collection.subscriptions);
+  release_removed(removed_entities.services, collection.services);
+  release_removed(removed_entities.waitables, collection.waitables);
+}
+
+void
+EventsExecutor::set_inline_execution(
+  const rclcpp::Waitable::SharedPtr & waitable,
+  const rclcpp::CallbackGroup::WeakPtr & weak_group,
+  size_t max_depth)
+{
+  auto subscription =
+    std::dynamic_pointer_cast<rclcpp::experimental::SubscriptionIntraProcessBase>(waitable);
+  if (!subscription) {
+    return;
+  }
+  if (max_depth == 0) {
+    subscription->set_inline_execution(nullptr, 0);
+    return;
+  }
+  subscription->set_inline_execution(
+    [this, waitable_ptr = waitable.get(), weak_group](const std::function<void()> & execute) {
+      return this->execute_inline_exclusively(waitable_ptr, weak_group, execute);
+    },
+    max_depth);
+}
+
 void
 EventsExecutor::add_notify_waitable_to_collection(
   rclcpp::executors::ExecutorEntitiesCollection::WaitableCollection & collection)
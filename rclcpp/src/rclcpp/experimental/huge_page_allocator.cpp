@@ -0,0 +1,237 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rclcpp/experimental/huge_page_allocator.hpp"
+
+#include <cstddef>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <string>
+#include <utility>
+#include <vector>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+using rclcpp::experimental::HugePageMemoryPool;
+
+struct HugePageMemoryPool::BlockHeader
+{
+  // Size of the mapping holding the block, zero if it was allocated with operator new
+  size_t mapped_size;
+  // Size rounded up to the page size, under which the block is cached
+  size_t rounded_size;
+  // NUMA node of the thread which mapped the block
+  unsigned int node;
+};
+
+namespace
+{
+
+// Keeps the blocks aligned on cache lines when they are mapped
+constexpr size_t kHeaderSize = 64;
+
+constexpr size_t kDefaultPageSize = 4096;
+constexpr size_t kDefaultHugePageSize = 2 * 1024 * 1024;
+
+size_t
+read_page_size()
+{
+#ifdef __linux__
+  const long page_size = sysconf(_SC_PAGESIZE);  // NOLINT(runtime/int)
+  if (page_size > 0) {
+    return static_cast<size_t>(page_size);
+  }
+#endif
+  return kDefaultPageSize;
+}
+
+size_t
+read_huge_page_size()
+{
+#ifdef __linux__
+  std::ifstream meminfo("/proc/meminfo");
+  std::string key;
+  while (meminfo >> key) {
+    if (key == "Hugepagesize:") {
+      size_t size_kb = 0;
+      if (meminfo >> size_kb && size_kb > 0) {
+        return size_kb * 1024;
+      }
+      break;
+    }
+    meminfo.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+  }
+#endif
+  return kDefaultHugePageSize;
+}
+
+#ifdef __linux__
+size_t
+round_up(size_t size, size_t multiple)
+{
+  return (size + multiple - 1) / multiple * multiple;
+}
+
+unsigned int
+get_current_node()
+{
+  unsigned int cpu = 0;
+  unsigned int node = 0;
+  if (syscall(SYS_getcpu, &cpu, &node, nullptr) != 0) {
+    return 0;
+  }
+  return node;
+}
+#endif
+
+}  // namespace
+
+HugePageMemoryPool::HugePageMemoryPool(size_t mapping_threshold, size_t max_cached_size)
+: page_size_(read_page_size()),
+  huge_page_size_(read_huge_page_size()),
+  mapping_threshold_(mapping_threshold ? mapping_threshold : huge_page_size_ / 2),
+  max_cached_size_(max_cached_size),
+  cached_size_(0)
+{}
+
+HugePageMemoryPool::~HugePageMemoryPool()
+{
+#ifdef __linux__
+  for (const auto & blocks : cached_blocks_) {
+    for (BlockHeader * header : blocks.second) {
+      munmap(header, header->mapped_size);
+    }
+  }
+#endif
+}
+
+void *
+HugePageMemoryPool::allocate(size_t size)
+{
+  static_assert(sizeof(BlockHeader) <= kHeaderSize, "header too large");
+  if (size > std::numeric_limits<size_t>::max() - huge_page_size_ - kHeaderSize) {
+    throw std::bad_alloc();
+  }
+  const size_t total_size = size + kHeaderSize;
+  BlockHeader * header = nullptr;
+#ifdef __linux__
+  if (size >= mapping_threshold_) {
+    const size_t rounded_size = round_up(total_size, page_size_);
+    const unsigned int node = get_current_node();
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = cached_blocks_.find({node, rounded_size});
+      if (it != cached_blocks_.end() && !it->second.empty()) {
+        header = it->second.back();
+        it->second.pop_back();
+        cached_size_ -= header->mapped_size;
+      }
+    }
+    if (!header) {
+      // Explicit huge pages are only available if the system reserved some
+      size_t mapped_size = round_up(total_size, huge_page_size_);
+      void * address = mmap(
+        nullptr, mapped_size, PROT_READ | PROT_WRITE,
+        MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+      if (address == MAP_FAILED) {
+        // Transparent huge pages back the aligned parts of the mapping, which isn't rounded
+        // up to the huge page size so as not to waste memory
+        mapped_size = rounded_size;
+        address = mmap(
+          nullptr, mapped_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (address == MAP_FAILED) {
+          throw std::bad_alloc();
+        }
+#ifdef MADV_HUGEPAGE
+        // They may be disabled, in which case regular pages are used
+        (void)madvise(address, mapped_size, MADV_HUGEPAGE);
+#endif
+      }
+      header = new (address) BlockHeader{mapped_size, rounded_size, node};
+    }
+    return reinterpret_cast<char *>(header) + kHeaderSize;
+  }
+#endif
+  header = new (::operator new(total_size)) BlockHeader{0, 0, 0};
+  return reinterpret_cast<char *>(header) + kHeaderSize;
+}
+
+void
+HugePageMemoryPool::deallocate(void * pointer) noexcept
+{
+  if (!pointer) {
+    return;
+  }
+  auto header = reinterpret_cast<BlockHeader *>(static_cast<char *>(pointer) - kHeaderSize);
+  if (header->mapped_size == 0) {
+    ::operator delete(header);
+    return;
+  }
+  cache_or_unmap(header);
+}
+
+void
+HugePageMemoryPool::cache_or_unmap(BlockHeader * header) noexcept
+{
+#ifdef __linux__
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (cached_size_ + header->mapped_size <= max_cached_size_) {
+      try {
+        cached_blocks_[{header->node, header->rounded_size}].push_back(header);
+        cached_size_ += header->mapped_size;
+        return;
+      } catch (const std::bad_alloc &) {
+        // Unmapped below
+      }
+    }
+  }
+  munmap(header, header->mapped_size);
+#else
+  (void)header;
+#endif
+}
+
+size_t
+HugePageMemoryPool::get_huge_page_size() const
+{
+  return huge_page_size_;
+}
+
+size_t
+HugePageMemoryPool::get_mapping_threshold() const
+{
+  return mapping_threshold_;
+}
+
+size_t
+HugePageMemoryPool::get_cached_size() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return cached_size_;
+}
+
+HugePageMemoryPool::SharedPtr
+HugePageMemoryPool::get_default()
+{
+  static HugePageMemoryPool::SharedPtr pool = std::make_shared<HugePageMemoryPool>();
+  return pool;
+}
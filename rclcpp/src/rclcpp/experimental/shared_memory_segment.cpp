@@ -0,0 +1,161 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rclcpp/experimental/shared_memory_segment.hpp"
+
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using rclcpp::experimental::SharedMemorySegment;
+
+#ifndef _WIN32
+namespace
+{
+
+/// Time given to the creator of a segment to resize it, before it's considered to have failed.
+constexpr std::chrono::seconds kResizeTimeout{1};
+
+std::runtime_error
+segment_error(const std::string & what, const std::string & name, int error_number)
+{
+  return std::runtime_error(
+    what + " shared memory segment '" + name + "': " + std::strerror(error_number));
+}
+
+}  // namespace
+#endif
+
+SharedMemorySegment::SharedMemorySegment(const std::string & name, size_t size)
+: name_("/" + name),
+  size_(size),
+  address_(nullptr),
+  owner_(false)
+{
+  if (name.empty() || name.find('/') != std::string::npos) {
+    throw std::invalid_argument("shared memory segment name must be non-empty without '/'");
+  }
+  if (size == 0) {
+    throw std::invalid_argument("shared memory segment size must be a positive value");
+  }
+
+#ifndef _WIN32
+  int fd = -1;
+  while (fd < 0) {
+    fd = shm_open(name_.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+    if (fd >= 0) {
+      owner_ = true;
+      if (ftruncate(fd, static_cast<off_t>(size_)) != 0) {
+        const int error_number = errno;
+        close(fd);
+        shm_unlink(name_.c_str());
+        throw segment_error("failed to resize", name_, error_number);
+      }
+      break;
+    }
+    if (errno != EEXIST) {
+      throw segment_error("failed to create", name_, errno);
+    }
+    fd = shm_open(name_.c_str(), O_RDWR, 0600);
+    if (fd < 0) {
+      if (errno == ENOENT) {
+        // The creator failed and removed the segment meanwhile, try to create it again
+        continue;
+      }
+      throw segment_error("failed to open", name_, errno);
+    }
+
+    // The creator may not have resized the segment yet, its size is zero until then
+    const auto deadline = std::chrono::steady_clock::now() + kResizeTimeout;
+    struct stat segment_stat;
+    while (true) {
+      if (fstat(fd, &segment_stat) != 0) {
+        const int error_number = errno;
+        close(fd);
+        throw segment_error("failed to get the size of", name_, error_number);
+      }
+      if (segment_stat.st_size != 0 || std::chrono::steady_clock::now() >= deadline) {
+        break;
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    if (static_cast<size_t>(segment_stat.st_size) != size_) {
+      close(fd);
+      throw std::runtime_error(
+              "shared memory segment '" + name_ + "' exists with a different size");
+    }
+  }
+
+  address_ = mmap(nullptr, size_, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  // Saved before close() can change it
+  const int map_error_number = errno;
+  // The mapping stays valid after closing the file descriptor.
+  close(fd);
+  if (address_ == MAP_FAILED) {
+    address_ = nullptr;
+    if (owner_) {
+      shm_unlink(name_.c_str());
+    }
+    throw segment_error("failed to map", name_, map_error_number);
+  }
+#else
+  throw std::runtime_error("shared memory segments are not supported on this platform");
+#endif
+}
+
+SharedMemorySegment::~SharedMemorySegment()
+{
+#ifndef _WIN32
+  if (address_) {
+    munmap(address_, size_);
+  }
+  if (owner_) {
+    shm_unlink(name_.c_str());
+  }
+#endif
+}
+
+void *
+SharedMemorySegment::get_address() const
+{
+  return address_;
+}
+
+size_t
+SharedMemorySegment::get_size() const
+{
+  return size_;
+}
+
+bool
+SharedMemorySegment::is_owner() const
+{
+  return owner_;
+}
+
+const std::string &
+SharedMemorySegment::get_name() const
+{
+  return name_;
+}
@@ -0,0 +1,174 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rclcpp/experimental/synchronized_subscription.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+using rclcpp::experimental::detail::StampMatcher;
+
+namespace
+{
+
+// Distance between two stamps, saturated instead of overflowing
+uint64_t
+distance(int64_t a, int64_t b)
+{
+  return a > b ? static_cast<uint64_t>(a) - static_cast<uint64_t>(b) :
+         static_cast<uint64_t>(b) - static_cast<uint64_t>(a);
+}
+
+}  // namespace
+
+StampMatcher::StampMatcher(size_t number_of_topics, const SynchronizedSubscriptionOptions & options)
+: policy_(options.policy),
+  queue_size_(options.queue_size),
+  max_interval_ns_(options.max_interval.count()),
+  queues_(number_of_topics)
+{
+  if (number_of_topics < 2) {
+    throw std::invalid_argument("at least two topics must be synchronized");
+  }
+  if (0u == queue_size_) {
+    throw std::invalid_argument("the queue size of a synchronized subscription must not be zero");
+  }
+  if (max_interval_ns_ < 0) {
+    throw std::invalid_argument("the maximum interval of a synchronized subscription is negative");
+  }
+}
+
+std::vector<StampMatcher::Match>
+StampMatcher::add(size_t topic, int64_t stamp, std::shared_ptr<const void> message)
+{
+  auto & queue = queues_.at(topic);
+  std::vector<Match> matches;
+  if (!queue.empty() && stamp < queue.back().stamp) {
+    dropped_count_++;
+    return matches;
+  }
+  if (queue.size() == queue_size_) {
+    drop(topic, 1u);
+  }
+  queue.push_back({stamp, std::move(message)});
+
+  Match match;
+  while (SyncPolicy::ExactTime == policy_ ? match_exact_time(match) :
+    match_approximate_time(match))
+  {
+    matches.push_back(std::move(match));
+  }
+  return matches;
+}
+
+uint64_t
+StampMatcher::get_dropped_count() const
+{
+  return dropped_count_;
+}
+
+bool
+StampMatcher::match_exact_time(Match & match)
+{
+  while (true) {
+    int64_t pivot = INT64_MIN;
+    for (const auto & queue : queues_) {
+      if (queue.empty()) {
+        return false;
+      }
+      pivot = std::max(pivot, queue.front().stamp);
+    }
+    // Older messages can't be matched anymore, the topics with none left are waited for
+    bool matched = true;
+    for (size_t topic = 0; topic < queues_.size(); ++topic) {
+      auto & queue = queues_[topic];
+      auto first_not_older = std::find_if(
+        queue.begin(), queue.end(), [pivot](const Entry & entry) {return entry.stamp >= pivot;});
+      drop(topic, static_cast<size_t>(first_not_older - queue.begin()));
+      matched = matched && !queue.empty() && queue.front().stamp == pivot;
+    }
+    if (matched) {
+      take_oldest(match);
+      return true;
+    }
+  }
+}
+
+bool
+StampMatcher::match_approximate_time(Match & match)
+{
+  std::vector<size_t> candidates(queues_.size());
+  while (true) {
+    // Every match includes the oldest message of a topic, the latest of them is the pivot
+    int64_t pivot = INT64_MIN;
+    for (const auto & queue : queues_) {
+      if (queue.empty()) {
+        return false;
+      }
+      pivot = std::max(pivot, queue.front().stamp);
+    }
+    size_t oldest_topic = 0;
+    for (size_t topic = 0; topic < queues_.size(); ++topic) {
+      const auto & queue = queues_[topic];
+      size_t candidate = 0;
+      while (candidate + 1 < queue.size() &&
+        distance(queue[candidate + 1].stamp, pivot) <= distance(queue[candidate].stamp, pivot))
+      {
+        candidate++;
+      }
+      if (candidate + 1 == queue.size() && queue[candidate].stamp < pivot) {
+        // A message received later may be closer to the pivot
+        return false;
+      }
+      candidates[topic] = candidate;
+      if (queue[candidate].stamp < queues_[oldest_topic][candidates[oldest_topic]].stamp) {
+        oldest_topic = topic;
+      }
+    }
+    const int64_t oldest_stamp = queues_[oldest_topic][candidates[oldest_topic]].stamp;
+    if (distance(pivot, oldest_stamp) <= static_cast<uint64_t>(max_interval_ns_)) {
+      for (size_t topic = 0; topic < queues_.size(); ++topic) {
+        drop(topic, candidates[topic]);
+      }
+      take_oldest(match);
+      return true;
+    }
+    // The oldest candidate is too far from the pivot to be part of any match
+    drop(oldest_topic, candidates[oldest_topic] + 1);
+  }
+}
+
+void
+StampMatcher::drop(size_t topic, size_t count)
+{
+  auto & queue = queues_[topic];
+  queue.erase(queue.begin(), queue.begin() + static_cast<std::ptrdiff_t>(count));
+  dropped_count_ += count;
+}
+
+void
+StampMatcher::take_oldest(Match & match)
+{
+  match.clear();
+  match.reserve(queues_.size());
+  for (auto & queue : queues_) {
+    match.push_back(std::move(queue.front().message));
+    queue.pop_front();
+  }
+}
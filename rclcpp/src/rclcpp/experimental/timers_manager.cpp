@@ -16,10 +16,14 @@
 
 #include <inttypes.h>
 
+#include <algorithm>
 #include <ctime>
 #include <iostream>
+#include <limits>
 #include <memory>
 #include <stdexcept>
+#include <utility>
+#include <vector>
 
 #include "rcpputils/scope_exit.hpp"
 
@@ -27,10 +31,14 @@ using rclcpp::experimental::TimersManager;
 
 TimersManager::TimersManager(
   std::shared_ptr<rclcpp::Context> context,
-  std::function<void(const rclcpp::TimerBase *)> on_ready_callback)
+  std::function<void(const rclcpp::TimerBase *)> on_ready_callback,
+  TimersStorageType storage_type)
 : on_ready_callback_(on_ready_callback),
   context_(context)
 {
+  if (storage_type == TimersStorageType::TimingWheel) {
+    timing_wheel_ = std::make_unique<TimingWheel>();
+  }
 }
 
 TimersManager::~TimersManager()
@@ -51,23 +59,32 @@ void TimersManager::add_timer(rclcpp::TimerBase::SharedPtr timer)
   bool added = false;
   {
     std::unique_lock<std::mutex> lock(timers_mutex_);
-    added = weak_timers_heap_.add_timer(timer);
+    if (timing_wheel_) {
+      added = timing_wheel_->add_timer(timer);
+    } else {
+      added = weak_timers_heap_.add_timer(timer);
+    }
     timers_updated_ = timers_updated_ || added;
   }
 
+  const rclcpp::TimerBase * timer_id = timer.get();
   timer->set_on_reset_callback(
-    [this](size_t arg) {
+    [this, timer_id](size_t arg) {
       {
         (void)arg;
         std::unique_lock<std::mutex> lock(timers_mutex_);
+        if (timing_wheel_) {
+          // The trigger time of the timer changed, so move it to the new slot
+          timing_wheel_->reschedule(timer_id);
+        }
         timers_updated_ = true;
       }
-      timers_cv_.notify_one();
+      this->notify_timers_updated();
     });
 
   if (added) {
     // Notify that a timer has been added
-    timers_cv_.notify_one();
+    this->notify_timers_updated();
   }
 }
 
@@ -121,6 +138,9 @@ size_t TimersManager::get_number_ready_timers()
   }
 
   std::unique_lock<std::mutex> lock(timers_mutex_);
+  if (timing_wheel_) {
+    return timing_wheel_->get_number_ready_timers();
+  }
   TimersHeap locked_heap = weak_timers_heap_.validate_and_lock();
   return locked_heap.get_number_ready_timers();
 }
@@ -135,6 +155,12 @@ bool TimersManager::execute_head_timer()
 
   std::unique_lock<std::mutex> lock(timers_mutex_);
 
+  if (timing_wheel_) {
+    // NOTE: here we always execute the timer, regardless of whether the
+    // on_ready_callback is set or not.
+    return this->execute_timing_wheel_timers_unsafe(1, false) > 0;
+  }
+
   TimersHeap timers_heap = weak_timers_heap_.validate_and_lock();
 
   // Nothing to do if we don't have any timer
@@ -148,8 +174,9 @@ bool TimersManager::execute_head_timer()
   if (timer_ready) {
     // NOTE: here we always execute the timer, regardless of whether the
     // on_ready_callback is set or not.
-    head_timer->call();
-    head_timer->execute_callback();
+    if (head_timer->call()) {
+      head_timer->execute_callback();
+    }
     timers_heap.heapify_root();
     weak_timers_heap_.store(timers_heap);
   }
@@ -157,20 +184,58 @@ bool TimersManager::execute_head_timer()
   return timer_ready;
 }
 
+void TimersManager::execute_ready_timers()
+{
+  // Do not allow to interfere with the thread running
+  if (running_) {
+    throw std::runtime_error(
+            "execute_ready_timers() can't be used while timers thread is running");
+  }
+
+  std::unique_lock<std::mutex> lock(timers_mutex_);
+  this->execute_ready_timers_unsafe();
+}
+
 void TimersManager::execute_ready_timer(const rclcpp::TimerBase * timer_id)
 {
   TimerPtr ready_timer;
   {
     std::unique_lock<std::mutex> lock(timers_mutex_);
-    ready_timer = weak_timers_heap_.get_timer(timer_id);
+    if (timing_wheel_) {
+      ready_timer = timing_wheel_->get_timer(timer_id);
+    } else {
+      ready_timer = weak_timers_heap_.get_timer(timer_id);
+    }
   }
   if (ready_timer) {
     ready_timer->execute_callback();
   }
 }
 
+void TimersManager::set_on_timers_updated_callback(std::function<void()> callback)
+{
+  std::unique_lock<std::mutex> lock(timers_mutex_);
+  on_timers_updated_callback_ = std::move(callback);
+}
+
+void TimersManager::notify_timers_updated()
+{
+  timers_cv_.notify_one();
+  std::function<void()> callback;
+  {
+    std::unique_lock<std::mutex> lock(timers_mutex_);
+    callback = on_timers_updated_callback_;
+  }
+  if (callback) {
+    callback();
+  }
+}
+
 std::chrono::nanoseconds TimersManager::get_head_timeout_unsafe()
 {
+  if (timing_wheel_) {
+    return timing_wheel_->get_head_timeout();
+  }
   // If we don't have any weak pointer, then we just return maximum timeout
   if (weak_timers_heap_.empty()) {
     return std::chrono::nanoseconds::max();
@@ -197,6 +262,11 @@ std::chrono::nanoseconds TimersManager::get_head_timeout_unsafe()
 
 void TimersManager::execute_ready_timers_unsafe()
 {
+  if (timing_wheel_) {
+    this->execute_timing_wheel_timers_unsafe(std::numeric_limits<size_t>::max(), true);
+    return;
+  }
+
   // We start by locking the timers
   TimersHeap locked_heap = weak_timers_heap_.validate_and_lock();
 
@@ -212,26 +282,75 @@ void TimersManager::execute_ready_timers_unsafe()
   TimerPtr head_timer = locked_heap.front();
   const size_t number_ready_timers = locked_heap.get_number_ready_timers();
   size_t executed_timers = 0;
+  std::vector<const rclcpp::TimerBase *> executed;
   while (executed_timers < number_ready_timers && head_timer->is_ready()) {
-    head_timer->call();
-    if (on_ready_callback_) {
-      on_ready_callback_(head_timer.get());
-    } else {
-      head_timer->execute_callback();
+    // A timer which was touched is rescheduled instead of being executed
+    if (head_timer->call()) {
+      if (on_ready_callback_) {
+        on_ready_callback_(head_timer.get());
+      } else {
+        head_timer->execute_callback();
+      }
     }
 
     executed_timers++;
+    executed.push_back(head_timer.get());
     // Executing a timer will result in updating its time_until_trigger, so re-heapify
     locked_heap.heapify_root();
     // Get new head timer
     head_timer = locked_heap.front();
   }
 
+  // Timers expiring within their slack share this wakeup, instead of waking up again
+  if (executed_timers > 0) {
+    bool executed_within_slack = false;
+    for (const TimerPtr & timer : locked_heap.get_timers_within_slack()) {
+      // A late timer called above may expire again within its slack
+      if (std::find(executed.begin(), executed.end(), timer.get()) != executed.end()) {
+        continue;
+      }
+      if (!timer->call()) {
+        continue;
+      }
+      if (on_ready_callback_) {
+        on_ready_callback_(timer.get());
+      } else {
+        timer->execute_callback();
+      }
+      executed_within_slack = true;
+    }
+    if (executed_within_slack) {
+      locked_heap.heapify();
+    }
+  }
+
   // After having performed work on the locked heap we reflect the changes to weak one.
   // Timers will be already sorted the next time we need them if none went out of scope.
   weak_timers_heap_.store(locked_heap);
 }
 
+size_t TimersManager::execute_timing_wheel_timers_unsafe(
+  size_t max_timers, bool use_on_ready_callback)
+{
+  // Timers are taken from the wheel before being executed, so timers becoming ready
+  // while executing these ones are left for the next iteration.
+  std::vector<TimerPtr> ready_timers = timing_wheel_->take_ready_timers(max_timers);
+  for (const TimerPtr & timer : ready_timers) {
+    const bool execute = timer->call();
+    // Calling a timer updates its time_until_trigger, so put it back in the wheel
+    timing_wheel_->reschedule(timer.get());
+    if (!execute) {
+      continue;
+    }
+    if (use_on_ready_callback && on_ready_callback_) {
+      on_ready_callback_(timer.get());
+    } else {
+      timer->execute_callback();
+    }
+  }
+  return ready_timers.size();
+}
+
 void TimersManager::run_timers()
 {
   // Make sure the running flag is set to false when we exit from this function
@@ -269,16 +388,23 @@ void TimersManager::clear()
     // Lock mutex and then clear all data structures
     std::unique_lock<std::mutex> lock(timers_mutex_);
 
-    TimersHeap locked_heap = weak_timers_heap_.validate_and_lock();
-    locked_heap.clear_timers_on_reset_callbacks();
+    if (timing_wheel_) {
+      for (const TimerPtr & timer : timing_wheel_->get_timers()) {
+        timer->clear_on_reset_callback();
+      }
+      timing_wheel_->clear();
+    } else {
+      TimersHeap locked_heap = weak_timers_heap_.validate_and_lock();
+      locked_heap.clear_timers_on_reset_callbacks();
 
-    weak_timers_heap_.clear();
+      weak_timers_heap_.clear();
+    }
 
     timers_updated_ = true;
   }
 
   // Notify timers thread such that it can re-compute its timeout
-  timers_cv_.notify_one();
+  this->notify_timers_updated();
 }
 
 void TimersManager::remove_timer(TimerPtr timer)
@@ -286,14 +412,18 @@ void TimersManager::remove_timer(TimerPtr timer)
   bool removed = false;
   {
     std::unique_lock<std::mutex> lock(timers_mutex_);
-    removed = weak_timers_heap_.remove_timer(timer);
+    if (timing_wheel_) {
+      removed = timing_wheel_->remove_timer(timer.get());
+    } else {
+      removed = weak_timers_heap_.remove_timer(timer);
+    }
 
     timers_updated_ = timers_updated_ || removed;
   }
 
   if (removed) {
     // Notify timers thread such that it can re-compute its timeout
-    timers_cv_.notify_one();
+    this->notify_timers_updated();
     timer->clear_on_reset_callback();
   }
 }
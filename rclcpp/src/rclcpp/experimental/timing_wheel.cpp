@@ -0,0 +1,285 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rclcpp/experimental/timing_wheel.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <stdexcept>
+#include <vector>
+
+using rclcpp::experimental::TimingWheel;
+
+TimingWheel::TimingWheel(std::chrono::nanoseconds resolution)
+: start_time_(std::chrono::steady_clock::now()),
+  resolution_(resolution)
+{
+  if (resolution <= std::chrono::nanoseconds::zero()) {
+    throw std::invalid_argument("TimingWheel resolution must be positive");
+  }
+}
+
+bool TimingWheel::add_timer(const TimerPtr & timer)
+{
+  auto result = entries_.emplace(timer.get(), Entry());
+  if (!result.second) {
+    return false;
+  }
+  Entry & entry = result.first->second;
+  entry.timer = timer;
+  this->schedule(timer.get(), entry);
+  return true;
+}
+
+bool TimingWheel::remove_timer(const rclcpp::TimerBase * timer_id)
+{
+  auto it = entries_.find(timer_id);
+  if (it == entries_.end()) {
+    return false;
+  }
+  this->unlink(it->second);
+  entries_.erase(it);
+  return true;
+}
+
+void TimingWheel::reschedule(const rclcpp::TimerBase * timer_id)
+{
+  auto it = entries_.find(timer_id);
+  if (it == entries_.end()) {
+    return;
+  }
+  this->unlink(it->second);
+  if (it->second.timer.expired()) {
+    entries_.erase(it);
+    return;
+  }
+  this->schedule(timer_id, it->second);
+}
+
+TimingWheel::TimerPtr TimingWheel::get_timer(const rclcpp::TimerBase * timer_id) const
+{
+  auto it = entries_.find(timer_id);
+  if (it == entries_.end()) {
+    return nullptr;
+  }
+  return it->second.timer.lock();
+}
+
+std::vector<TimingWheel::TimerPtr> TimingWheel::take_ready_timers(size_t max_timers)
+{
+  this->advance(this->now_tick());
+
+  std::vector<TimerPtr> ready_timers;
+  auto it = expired_.begin();
+  while (it != expired_.end() && ready_timers.size() < max_timers) {
+    const rclcpp::TimerBase * timer_id = *it;
+    ++it;
+    auto entry_it = entries_.find(timer_id);
+    Entry & entry = entry_it->second;
+    TimerPtr timer = entry.timer.lock();
+    if (!timer) {
+      // The timer went out of scope
+      this->unlink(entry);
+      entries_.erase(entry_it);
+      continue;
+    }
+    this->unlink(entry);
+    if (timer->is_ready()) {
+      ready_timers.push_back(std::move(timer));
+    } else {
+      // The timer uses a different clock, or it has been canceled: look at it again later
+      this->schedule(timer_id, entry, 1);
+    }
+  }
+  return ready_timers;
+}
+
+std::chrono::nanoseconds TimingWheel::get_head_timeout()
+{
+  this->advance(this->now_tick());
+
+  if (!expired_.empty()) {
+    return std::chrono::nanoseconds::zero();
+  }
+  if (timers_in_levels_ == 0) {
+    return std::chrono::nanoseconds::max();
+  }
+
+  // Look for the first non empty slot of the first level, or for the next time the
+  // higher levels have to be cascaded, whichever comes first.
+  uint64_t next_tick = current_tick_ + 1;
+  for (; (next_tick & (kSlotsPerLevel - 1)) != 0; ++next_tick) {
+    if (!levels_[0][next_tick & (kSlotsPerLevel - 1)].empty()) {
+      break;
+    }
+  }
+
+  auto next_time = start_time_ + resolution_ * next_tick;
+  return std::max(
+    std::chrono::nanoseconds::zero(),
+    std::chrono::duration_cast<std::chrono::nanoseconds>(
+      next_time - std::chrono::steady_clock::now()));
+}
+
+size_t TimingWheel::get_number_ready_timers() const
+{
+  size_t ready_timers = 0;
+  for (const auto & pair : entries_) {
+    // Timers taken and not re-scheduled yet are not considered
+    if (!pair.second.slot) {
+      continue;
+    }
+    TimerPtr timer = pair.second.timer.lock();
+    if (timer && timer->is_ready()) {
+      ready_timers++;
+    }
+  }
+  return ready_timers;
+}
+
+std::vector<TimingWheel::TimerPtr> TimingWheel::get_timers() const
+{
+  std::vector<TimerPtr> timers;
+  timers.reserve(entries_.size());
+  for (const auto & pair : entries_) {
+    TimerPtr timer = pair.second.timer.lock();
+    if (timer) {
+      timers.push_back(std::move(timer));
+    }
+  }
+  return timers;
+}
+
+size_t TimingWheel::size() const
+{
+  return entries_.size();
+}
+
+void TimingWheel::clear()
+{
+  for (auto & level : levels_) {
+    for (auto & slot : level) {
+      slot.clear();
+    }
+  }
+  expired_.clear();
+  timers_in_levels_ = 0;
+  entries_.clear();
+}
+
+uint64_t TimingWheel::now_tick() const
+{
+  auto elapsed = std::chrono::steady_clock::now() - start_time_;
+  return static_cast<uint64_t>(elapsed / resolution_);
+}
+
+void TimingWheel::schedule(
+  const rclcpp::TimerBase * timer_id, Entry & entry, uint64_t min_ticks)
+{
+  TimerPtr timer = entry.timer.lock();
+  if (!timer) {
+    return;
+  }
+  std::chrono::nanoseconds time_until_trigger = timer->time_until_trigger();
+  if (time_until_trigger == std::chrono::nanoseconds::max()) {
+    // The timer is canceled: it will be scheduled again when it's reset
+    return;
+  }
+
+  uint64_t ticks = 0;
+  if (time_until_trigger > std::chrono::nanoseconds::zero()) {
+    // Round up, so that timers are never found expired before their trigger time
+    ticks = static_cast<uint64_t>(
+      (time_until_trigger + resolution_ - std::chrono::nanoseconds(1)) / resolution_);
+  }
+  ticks = std::max(ticks, min_ticks);
+  // The current tick may lag behind the current time, if time wasn't advanced recently
+  this->place(timer_id, entry, std::max(this->now_tick(), current_tick_) + ticks);
+}
+
+void TimingWheel::place(
+  const rclcpp::TimerBase * timer_id, Entry & entry, uint64_t expiry_tick)
+{
+  entry.expiry_tick = expiry_tick;
+  if (expiry_tick <= current_tick_) {
+    entry.slot = &expired_;
+  } else {
+    uint64_t delta = expiry_tick - current_tick_;
+    size_t level = 0;
+    while (level + 1 < kNumberOfLevels && delta >= (uint64_t(1) << (kSlotBits * (level + 1)))) {
+      level++;
+    }
+    const uint64_t max_delta = (uint64_t(1) << (kSlotBits * kNumberOfLevels)) - 1;
+    if (delta > max_delta) {
+      // Beyond the range of the wheel: the timer will be re-scheduled when it's found expired.
+      expiry_tick = current_tick_ + max_delta;
+    }
+    size_t index = (expiry_tick >> (kSlotBits * level)) & (kSlotsPerLevel - 1);
+    entry.slot = &levels_[level][index];
+    timers_in_levels_++;
+  }
+  entry.slot->push_back(timer_id);
+  entry.position = std::prev(entry.slot->end());
+}
+
+void TimingWheel::unlink(Entry & entry)
+{
+  if (!entry.slot) {
+    return;
+  }
+  if (entry.slot != &expired_) {
+    timers_in_levels_--;
+  }
+  entry.slot->erase(entry.position);
+  entry.slot = nullptr;
+}
+
+void TimingWheel::advance(uint64_t target_tick)
+{
+  while (current_tick_ < target_tick) {
+    if (timers_in_levels_ == 0) {
+      // Nothing to move, jump directly to the target
+      current_tick_ = target_tick;
+      return;
+    }
+    current_tick_++;
+
+    // When a level wraps around, bring the timers of the next slot of the higher levels down.
+    size_t index = current_tick_ & (kSlotsPerLevel - 1);
+    for (size_t level = 1; index == 0 && level < kNumberOfLevels; ++level) {
+      index = (current_tick_ >> (kSlotBits * level)) & (kSlotsPerLevel - 1);
+      this->cascade(level, index);
+    }
+
+    Slot & slot = levels_[0][current_tick_ & (kSlotsPerLevel - 1)];
+    for (const rclcpp::TimerBase * timer_id : slot) {
+      entries_[timer_id].slot = &expired_;
+    }
+    timers_in_levels_ -= slot.size();
+    // Splicing keeps the stored positions valid
+    expired_.splice(expired_.end(), slot);
+  }
+}
+
+void TimingWheel::cascade(size_t level, size_t index)
+{
+  Slot slot;
+  slot.swap(levels_[level][index]);
+  timers_in_levels_ -= slot.size();
+  for (const rclcpp::TimerBase * timer_id : slot) {
+    Entry & entry = entries_[timer_id];
+    entry.slot = nullptr;
+    this->place(timer_id, entry, entry.expiry_tick);
+  }
+}
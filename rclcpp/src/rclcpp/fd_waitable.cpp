@@ -0,0 +1,241 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rclcpp/fd_waitable.hpp"
+
+#include <cerrno>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#endif
+
+#include "rclcpp/detail/add_guard_condition_to_rcl_wait_set.hpp"
+#include "rclcpp/logging.hpp"
+#include "rmw/impl/cpp/demangle.hpp"
+
+using rclcpp::FdWaitable;
+
+FdWaitable::FdWaitable(
+  rclcpp::Context::SharedPtr context,
+  int fd,
+  Direction direction,
+  Callback callback)
+: fd_(fd),
+  direction_(direction),
+  callback_(std::move(callback)),
+  gc_(std::move(context)),
+  fd_data_(std::make_shared<int>(fd))
+{
+  if (fd < 0) {
+    throw std::invalid_argument("the file descriptor must not be negative");
+  }
+  if (!callback_) {
+    throw std::invalid_argument("the callback of the file descriptor is not callable");
+  }
+#ifndef _WIN32
+  if (0 != ::pipe(wake_fds_)) {
+    throw std::runtime_error(
+            std::string("failed to create the pipe of the file descriptor waitable: ") +
+            std::strerror(errno));
+  }
+  for (int wake_fd : wake_fds_) {
+    ::fcntl(wake_fd, F_SETFD, FD_CLOEXEC);
+  }
+  thread_ = std::thread(&FdWaitable::watch, this);
+#else
+  throw std::runtime_error("file descriptor waitables are not supported on Windows");
+#endif
+}
+
+FdWaitable::~FdWaitable()
+{
+#ifndef _WIN32
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  armed_cv_.notify_one();
+  // Wakes the thread up if it's polling
+  const char byte = 0;
+  while (::write(wake_fds_[1], &byte, 1) < 0 && EINTR == errno) {}
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+  ::close(wake_fds_[0]);
+  ::close(wake_fds_[1]);
+#endif
+}
+
+int
+FdWaitable::get_fd() const
+{
+  return fd_;
+}
+
+void
+FdWaitable::add_to_wait_set(rcl_wait_set_t * wait_set)
+{
+  detail::add_guard_condition_to_rcl_wait_set(*wait_set, gc_);
+}
+
+bool
+FdWaitable::is_ready(rcl_wait_set_t * wait_set)
+{
+  (void)wait_set;
+  return ready_.load();
+}
+
+std::shared_ptr<void>
+FdWaitable::take_data()
+{
+  // Taken once per readiness, by a single thread
+  if (!ready_.exchange(false)) {
+    return nullptr;
+  }
+  return fd_data_;
+}
+
+std::shared_ptr<void>
+FdWaitable::take_data_by_entity_id(size_t id)
+{
+  (void)id;
+  return take_data();
+}
+
+void
+FdWaitable::execute(std::shared_ptr<void> & data)
+{
+  if (!data) {
+    return;
+  }
+  try {
+    callback_(fd_);
+  } catch (...) {
+    arm();
+    throw;
+  }
+  arm();
+}
+
+void
+FdWaitable::arm()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    armed_ = true;
+  }
+  armed_cv_.notify_one();
+}
+
+void
+FdWaitable::watch()
+{
+#ifndef _WIN32
+  const short events = Direction::Read == direction_ ? POLLIN : POLLOUT;
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      armed_cv_.wait(lock, [this]() {return armed_ || stop_;});
+      if (stop_) {
+        return;
+      }
+    }
+    struct pollfd fds[2] = {{fd_, events, 0}, {wake_fds_[0], POLLIN, 0}};
+    if (::poll(fds, 2, -1) < 0) {
+      if (EINTR == errno) {
+        continue;
+      }
+      RCLCPP_ERROR(
+        rclcpp::get_logger("rclcpp"),
+        "failed to poll file descriptor %d, it's no longer watched: %s", fd_,
+        std::strerror(errno));
+      return;
+    }
+    if (0 != fds[1].revents) {
+      return;
+    }
+    if (0 == fds[0].revents) {
+      continue;
+    }
+    // Errors and hang ups are also reported, the callback gets them when reading or writing
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      armed_ = false;
+    }
+    ready_ = true;
+    gc_.trigger();
+
+    std::lock_guard<std::recursive_mutex> lock(callback_mutex_);
+    if (on_ready_callback_) {
+      on_ready_callback_(1);
+    } else {
+      unread_count_++;
+    }
+  }
+#endif
+}
+
+void
+FdWaitable::set_on_ready_callback(std::function<void(size_t, int)> callback)
+{
+  if (!callback) {
+    throw std::invalid_argument(
+            "The callback passed to set_on_ready_callback "
+            "is not callable.");
+  }
+
+  // Note: we bind the int identifier argument to this waitable's entity types
+  auto new_callback =
+    [callback, this](size_t number_of_events) {
+      try {
+        callback(number_of_events, static_cast<int>(EntityType::FileDescriptor));
+      } catch (const std::exception & exception) {
+        RCLCPP_ERROR_STREAM(
+          rclcpp::get_logger("rclcpp"),
+          "rclcpp::FdWaitable@" << this <<
+            " caught " << rmw::impl::cpp::demangle(exception) <<
+            " exception in user-provided callback for the 'on ready' callback: " <<
+            exception.what());
+      } catch (...) {
+        RCLCPP_ERROR_STREAM(
+          rclcpp::get_logger("rclcpp"),
+          "rclcpp::FdWaitable@" << this <<
+            " caught unhandled exception in user-provided callback " <<
+            "for the 'on ready' callback");
+      }
+    };
+
+  std::lock_guard<std::recursive_mutex> lock(callback_mutex_);
+  on_ready_callback_ = new_callback;
+  if (unread_count_ > 0) {
+    on_ready_callback_(unread_count_);
+    unread_count_ = 0;
+  }
+}
+
+void
+FdWaitable::clear_on_ready_callback()
+{
+  std::lock_guard<std::recursive_mutex> lock(callback_mutex_);
+  on_ready_callback_ = nullptr;
+}
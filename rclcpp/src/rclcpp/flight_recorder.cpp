@@ -0,0 +1,417 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rclcpp/flight_recorder.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#if defined(_WIN32)
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace rclcpp
+{
+
+/// Ring of records of one thread, written by that thread only.
+struct FlightRecorder::ThreadRing
+{
+  /// Record stored with atomics, so that it can be read while it's overwritten.
+  struct Slot
+  {
+    /// 2 * index + 1 while the record of the given index is written, 2 * index + 2 once written.
+    std::atomic<uint64_t> sequence {0};
+    std::atomic<int64_t> start_ns {0};
+    std::atomic<int64_t> duration_ns {0};
+    std::atomic<const void *> entity {nullptr};
+    std::atomic<uint8_t> entity_type {0};
+  };
+
+  ThreadRing(std::thread::id thread_id, size_t thread_index, size_t capacity)
+  : thread_id(thread_id), thread_index(thread_index), capacity(capacity),
+    slots(new Slot[capacity])
+  {}
+
+  const std::thread::id thread_id;
+  const size_t thread_index;
+  const size_t capacity;
+  const std::unique_ptr<Slot[]> slots;
+  /// Index of the next record.
+  std::atomic<uint64_t> head {0};
+  ThreadRing * next = nullptr;
+};
+
+namespace
+{
+
+std::atomic<uint64_t> next_recorder_id {1};
+
+/// Ring used last by the thread, to skip the lookup when the thread uses a single recorder.
+struct ThreadRingCache
+{
+  uint64_t recorder_id = 0;
+  void * ring = nullptr;
+};
+
+thread_local ThreadRingCache thread_ring_cache;
+
+/// Recorders written by the signal handler, a fixed array so that it can read them.
+constexpr size_t max_signal_recorders = 16;
+std::atomic<const FlightRecorder *> signal_recorders[max_signal_recorders];
+std::atomic<int> signal_fd {2};
+
+int64_t
+now_ns()
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+const char *
+entity_type_name(uint8_t entity_type)
+{
+  switch (static_cast<FlightRecorder::EntityType>(entity_type)) {
+    case FlightRecorder::EntityType::Timer:
+      return "timer";
+    case FlightRecorder::EntityType::Subscription:
+      return "subscription";
+    case FlightRecorder::EntityType::Service:
+      return "service";
+    case FlightRecorder::EntityType::Client:
+      return "client";
+    case FlightRecorder::EntityType::Waitable:
+      return "waitable";
+  }
+  return "unknown";
+}
+
+/// Line being formatted without allocating, so that it can be done in a signal handler.
+class LineWriter
+{
+public:
+  void
+  append(const char * text) noexcept
+  {
+    while (*text != '\0' && size_ < sizeof(buffer_)) {
+      buffer_[size_++] = *text++;
+    }
+  }
+
+  void
+  append(int64_t value) noexcept
+  {
+    if (value < 0) {
+      append("-");
+    }
+    // Digits of the absolute value, which may not be representable as an int64_t
+    uint64_t magnitude = value < 0 ?
+      0 - static_cast<uint64_t>(value) : static_cast<uint64_t>(value);
+    append_unsigned(magnitude, 10);
+  }
+
+  void
+  append_hex(uint64_t value) noexcept
+  {
+    append("0x");
+    append_unsigned(value, 16);
+  }
+
+  bool
+  flush(int fd) noexcept
+  {
+    size_t written = 0;
+    while (written < size_) {
+#if defined(_WIN32)
+      const auto result = _write(fd, buffer_ + written, static_cast<unsigned>(size_ - written));
+#else
+      const auto result = ::write(fd, buffer_ + written, size_ - written);
+#endif
+      if (result <= 0) {
+        return false;
+      }
+      written += static_cast<size_t>(result);
+    }
+    size_ = 0;
+    return true;
+  }
+
+private:
+  void
+  append_unsigned(uint64_t value, uint64_t base) noexcept
+  {
+    char digits[20];
+    size_t count = 0;
+    do {
+      digits[count++] = "0123456789abcdef"[value % base];
+      value /= base;
+    } while (value != 0);
+    while (count > 0 && size_ < sizeof(buffer_)) {
+      buffer_[size_++] = digits[--count];
+    }
+  }
+
+  char buffer_[160];
+  size_t size_ = 0;
+};
+
+#if !defined(_WIN32)
+bool
+is_crash_signal(int signal)
+{
+  return signal == SIGSEGV || signal == SIGBUS || signal == SIGILL || signal == SIGFPE ||
+         signal == SIGABRT;
+}
+
+void
+write_recorders_on_signal(int signal)
+{
+  const int fd = signal_fd.load(std::memory_order_relaxed);
+  for (const auto & slot : signal_recorders) {
+    const FlightRecorder * recorder = slot.load(std::memory_order_acquire);
+    if (recorder) {
+      recorder->write(fd);
+    }
+  }
+  if (is_crash_signal(signal)) {
+    // The handler was reset to the default action when the signal was delivered
+    std::raise(signal);
+  }
+}
+#endif
+
+}  // namespace
+
+FlightRecorder::FlightRecorder(size_t records_per_thread)
+: id_(next_recorder_id.fetch_add(1, std::memory_order_relaxed)),
+  records_per_thread_(records_per_thread)
+{
+  if (records_per_thread_ == 0) {
+    throw std::invalid_argument("records_per_thread must be positive");
+  }
+  for (auto & slot : signal_recorders) {
+    const FlightRecorder * expected = nullptr;
+    if (slot.compare_exchange_strong(expected, this, std::memory_order_release)) {
+      break;
+    }
+  }
+}
+
+FlightRecorder::~FlightRecorder()
+{
+  for (auto & slot : signal_recorders) {
+    const FlightRecorder * expected = this;
+    if (slot.compare_exchange_strong(expected, nullptr)) {
+      break;
+    }
+  }
+  ThreadRing * ring = rings_.load(std::memory_order_acquire);
+  while (ring) {
+    ThreadRing * next = ring->next;
+    delete ring;
+    ring = next;
+  }
+}
+
+FlightRecorder::ThreadRing *
+FlightRecorder::get_thread_ring()
+{
+  if (thread_ring_cache.recorder_id == id_) {
+    return static_cast<ThreadRing *>(thread_ring_cache.ring);
+  }
+  // The thread alternates between recorders, its ring may exist already
+  const std::thread::id thread_id = std::this_thread::get_id();
+  ThreadRing * ring = rings_.load(std::memory_order_acquire);
+  while (ring && ring->thread_id != thread_id) {
+    ring = ring->next;
+  }
+  if (!ring) {
+    ring = new ThreadRing(
+      thread_id, thread_count_.fetch_add(1, std::memory_order_relaxed), records_per_thread_);
+    ring->next = rings_.load(std::memory_order_relaxed);
+    while (!rings_.compare_exchange_weak(ring->next, ring, std::memory_order_release)) {}
+  }
+  thread_ring_cache.recorder_id = id_;
+  thread_ring_cache.ring = ring;
+  return ring;
+}
+
+FlightRecorder::Token
+FlightRecorder::start(EntityType entity_type, const void * entity)
+{
+  ThreadRing * ring = get_thread_ring();
+  const uint64_t index = ring->head.load(std::memory_order_relaxed);
+  const int64_t start_ns = now_ns();
+  ThreadRing::Slot & slot = ring->slots[index % ring->capacity];
+  slot.sequence.store(2 * index + 1, std::memory_order_relaxed);
+  // Readers seeing any of the new values also see that the record is being written
+  std::atomic_thread_fence(std::memory_order_release);
+  slot.start_ns.store(start_ns, std::memory_order_relaxed);
+  slot.duration_ns.store(-1, std::memory_order_relaxed);
+  slot.entity.store(entity, std::memory_order_relaxed);
+  slot.entity_type.store(static_cast<uint8_t>(entity_type), std::memory_order_relaxed);
+  slot.sequence.store(2 * index + 2, std::memory_order_release);
+  ring->head.store(index + 1, std::memory_order_release);
+
+  Token token;
+  token.ring_ = ring;
+  token.index_ = index;
+  token.start_ns_ = start_ns;
+  return token;
+}
+
+void
+FlightRecorder::end(const Token & token) noexcept
+{
+  if (!token.ring_) {
+    return;
+  }
+  ThreadRing::Slot & slot = token.ring_->slots[token.index_ % token.ring_->capacity];
+  // Only this thread writes the ring, the record can't be overwritten concurrently
+  if (slot.sequence.load(std::memory_order_relaxed) == 2 * token.index_ + 2) {
+    slot.duration_ns.store(now_ns() - token.start_ns_, std::memory_order_relaxed);
+  }
+}
+
+namespace
+{
+
+/// Read the record of the given index, return false if it was overwritten or not written.
+template<typename SlotT>
+bool
+read_slot(
+  const SlotT & slot, uint64_t index, int64_t & start_ns, int64_t & duration_ns,
+  const void *& entity, uint8_t & entity_type) noexcept
+{
+  const uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+  if (sequence != 2 * index + 2) {
+    return false;
+  }
+  start_ns = slot.start_ns.load(std::memory_order_relaxed);
+  duration_ns = slot.duration_ns.load(std::memory_order_relaxed);
+  entity = slot.entity.load(std::memory_order_relaxed);
+  entity_type = slot.entity_type.load(std::memory_order_relaxed);
+  // The values read are discarded if the writer started overwriting them meanwhile
+  std::atomic_thread_fence(std::memory_order_acquire);
+  return slot.sequence.load(std::memory_order_relaxed) == sequence;
+}
+
+}  // namespace
+
+std::vector<FlightRecorder::Record>
+FlightRecorder::get_records() const
+{
+  std::vector<Record> records;
+  for (ThreadRing * ring = rings_.load(std::memory_order_acquire); ring; ring = ring->next) {
+    const uint64_t head = ring->head.load(std::memory_order_acquire);
+    const uint64_t first = head > ring->capacity ? head - ring->capacity : 0;
+    for (uint64_t index = first; index < head; ++index) {
+      int64_t start_ns = 0;
+      int64_t duration_ns = 0;
+      const void * entity = nullptr;
+      uint8_t entity_type = 0;
+      if (read_slot(
+          ring->slots[index % ring->capacity], index, start_ns, duration_ns, entity, entity_type))
+      {
+        records.push_back(
+          Record{
+            static_cast<EntityType>(entity_type), entity, ring->thread_index,
+            std::chrono::steady_clock::time_point(std::chrono::nanoseconds(start_ns)),
+            std::chrono::nanoseconds(duration_ns)});
+      }
+    }
+  }
+  std::stable_sort(
+    records.begin(), records.end(), [](const Record & a, const Record & b) {
+      return a.start_time < b.start_time;
+    });
+  return records;
+}
+
+size_t
+FlightRecorder::get_records_per_thread() const
+{
+  return records_per_thread_;
+}
+
+bool
+FlightRecorder::write(int fd) const noexcept
+{
+  LineWriter line;
+  line.append("flight recorder ");
+  line.append(static_cast<int64_t>(id_));
+  line.append(": thread start_ns duration_ns entity_type entity\n");
+  bool ok = line.flush(fd);
+  for (ThreadRing * ring = rings_.load(std::memory_order_acquire); ring; ring = ring->next) {
+    const uint64_t head = ring->head.load(std::memory_order_acquire);
+    const uint64_t first = head > ring->capacity ? head - ring->capacity : 0;
+    for (uint64_t index = first; index < head; ++index) {
+      int64_t start_ns = 0;
+      int64_t duration_ns = 0;
+      const void * entity = nullptr;
+      uint8_t entity_type = 0;
+      if (!read_slot(
+          ring->slots[index % ring->capacity], index, start_ns, duration_ns, entity, entity_type))
+      {
+        continue;
+      }
+      line.append(static_cast<int64_t>(ring->thread_index));
+      line.append(" ");
+      line.append(start_ns);
+      line.append(" ");
+      if (duration_ns < 0) {
+        line.append("executing");
+      } else {
+        line.append(duration_ns);
+      }
+      line.append(" ");
+      line.append(entity_type_name(entity_type));
+      line.append(" ");
+      line.append_hex(reinterpret_cast<uintptr_t>(entity));
+      line.append("\n");
+      ok = line.flush(fd) && ok;
+    }
+  }
+  return ok;
+}
+
+bool
+FlightRecorder::write_on_signal(int signal, int fd)
+{
+#if defined(_WIN32)
+  (void)signal;
+  (void)fd;
+  return false;
+#else
+  signal_fd.store(fd, std::memory_order_relaxed);
+  struct sigaction action {};
+  action.sa_handler = write_recorders_on_signal;
+  sigemptyset(&action.sa_mask);
+  action.sa_flags = SA_RESTART;
+  if (is_crash_signal(signal)) {
+    action.sa_flags |= SA_RESETHAND;
+  }
+  return sigaction(signal, &action, nullptr) == 0;
+#endif
+}
+
+}  // namespace rclcpp
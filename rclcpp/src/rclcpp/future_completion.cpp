@@ -0,0 +1,66 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rclcpp/future_completion.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "rclcpp/exceptions.hpp"
+#include "rclcpp/logging.hpp"
+
+namespace
+{
+
+// Guard conditions of the executors waiting in spin_until_future_complete()
+std::mutex g_listeners_mutex;
+std::vector<rclcpp::GuardCondition *> g_listeners;
+
+}  // namespace
+
+void
+rclcpp::notify_future_completion()
+{
+  // Always locked, so that a listener registered concurrently checks its future afterwards
+  std::lock_guard<std::mutex> lock(g_listeners_mutex);
+  for (rclcpp::GuardCondition * guard_condition : g_listeners) {
+    try {
+      guard_condition->trigger();
+    } catch (const rclcpp::exceptions::RCLError & ex) {
+      RCLCPP_ERROR(
+        rclcpp::get_logger("rclcpp"),
+        "failed to wake an executor waiting for a future: %s", ex.what());
+    }
+  }
+}
+
+rclcpp::detail::FutureCompletionListener::FutureCompletionListener(
+  std::shared_ptr<rclcpp::GuardCondition> guard_condition)
+: guard_condition_(std::move(guard_condition))
+{
+  std::lock_guard<std::mutex> lock(g_listeners_mutex);
+  g_listeners.push_back(guard_condition_.get());
+}
+
+rclcpp::detail::FutureCompletionListener::~FutureCompletionListener()
+{
+  std::lock_guard<std::mutex> lock(g_listeners_mutex);
+  auto it = std::find(g_listeners.begin(), g_listeners.end(), guard_condition_.get());
+  if (it != g_listeners.end()) {
+    g_listeners.erase(it);
+  }
+}
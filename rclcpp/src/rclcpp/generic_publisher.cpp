@@ -16,28 +16,149 @@
 #include "rclcpp/generic_publisher.hpp"
 
 #include <memory>
+#include <stdexcept>
 #include <string>
+#include <vector>
+
+#include "rcl/error_handling.h"
+
+#include "rclcpp/experimental/intra_process_manager.hpp"
+#include "rclcpp/topic_statistics/publisher_topic_statistics.hpp"
 
 namespace rclcpp
 {
 
+bool GenericPublisher::is_serialized() const
+{
+  return true;
+}
+
+void GenericPublisher::setup_serialized_intra_process(
+  rclcpp::node_interfaces::NodeBaseInterface * node_base)
+{
+  // Unlike typed publishers, generic publishers are commonly created with whatever QoS the
+  // recorded or bridged topic uses, so they silently keep using the middleware only when the
+  // QoS is not supported by intra-process communication.
+  const rclcpp::QoS qos = get_actual_qos();
+  if (qos.history() != rclcpp::HistoryPolicy::KeepLast || qos.depth() == 0 ||
+    qos.durability() != rclcpp::DurabilityPolicy::Volatile)
+  {
+    return;
+  }
+  auto ipm = rclcpp::experimental::IntraProcessManager::get_instance(*node_base->get_context());
+  uint64_t intra_process_publisher_id = ipm->add_publisher(this->shared_from_this());
+  this->setup_intra_process(intra_process_publisher_id, ipm);
+}
+
 void GenericPublisher::publish(const rclcpp::SerializedMessage & message)
 {
+  rclcpp::topic_statistics::PublisherTopicStatistics::PublishScope statistics_scope(
+    topic_statistics_.get());
+  if (topic_statistics_) {
+    topic_statistics_->record_published_bytes(message.size());
+  }
+
+  if (intra_process_is_enabled_) {
+    if (intra_process_subscription_count_.load() > 0) {
+      auto ipm = weak_ipm_.lock();
+      if (!ipm) {
+        throw std::runtime_error(
+                "intra process publish called after destruction of intra process manager");
+      }
+      // The message is copied once, and the copy is shared by the intra-process subscriptions.
+      std::allocator<rclcpp::SerializedMessage> allocator;
+      ipm->template do_intra_process_publish_shared<rclcpp::SerializedMessage,
+        rclcpp::SerializedMessage, std::allocator<void>>(
+        intra_process_publisher_id_,
+        std::make_shared<const rclcpp::SerializedMessage>(message),
+        allocator);
+      if (topic_statistics_) {
+        topic_statistics_->record_intra_process_publication();
+      }
+    }
+    if (!has_inter_process_subscriptions()) {
+      return;
+    }
+  }
+
+  publish_inter_process(message);
+  if (topic_statistics_) {
+    topic_statistics_->record_inter_process_publication();
+  }
+}
+
+void GenericPublisher::publish_inter_process(const rclcpp::SerializedMessage & message)
+{
+  const rcl_serialized_message_t * serialized_message = &message.get_rcl_serialized_message();
+  // Kept until the message was published, then returned to the pool
+  std::shared_ptr<rclcpp::SerializedMessage> encoded_message;
+  if (payload_codec_) {
+    encoded_message = encoded_message_pool_->acquire();
+    payload_codec_->encode(*serialized_message, *encoded_message);
+    serialized_message = &encoded_message->get_rcl_serialized_message();
+  }
+
   auto return_code = rcl_publish_serialized_message(
-    get_publisher_handle().get(), &message.get_rcl_serialized_message(), NULL);
+    get_publisher_handle().get(), serialized_message, NULL);
 
   if (return_code != RCL_RET_OK) {
     rclcpp::exceptions::throw_from_rcl_error(return_code, "failed to publish serialized message");
   }
 }
 
+void GenericPublisher::publish_batch(const std::vector<rclcpp::SerializedMessage> & messages)
+{
+  if (intra_process_is_enabled_ || topic_statistics_ || payload_codec_) {
+    for (const auto & message : messages) {
+      publish(message);
+    }
+    return;
+  }
+
+  rcl_publisher_t * publisher_handle = get_publisher_handle().get();
+  for (const auto & message : messages) {
+    auto return_code = rcl_publish_serialized_message(
+      publisher_handle, &message.get_rcl_serialized_message(), NULL);
+
+    if (return_code != RCL_RET_OK) {
+      rclcpp::exceptions::throw_from_rcl_error(return_code, "failed to publish serialized message");
+    }
+  }
+}
+
 void GenericPublisher::publish_as_loaned_msg(const rclcpp::SerializedMessage & message)
 {
+  rclcpp::topic_statistics::PublisherTopicStatistics::PublishScope statistics_scope(
+    topic_statistics_.get());
+  if (topic_statistics_) {
+    topic_statistics_->record_published_bytes(message.size());
+  }
   auto loaned_message = borrow_loaned_message();
-  deserialize_message(message.get_rcl_serialized_message(), loaned_message);
+  try {
+    deserialize_message(message.get_rcl_serialized_message(), loaned_message);
+  } catch (...) {
+    // The loan isn't published, so it has to be given back to the middleware
+    // The deserialization error is the one reported, not a failure to return the loan
+    if (rcl_return_loaned_message_from_publisher(
+        get_publisher_handle().get(), loaned_message) != RCL_RET_OK)
+    {
+      rcl_reset_error();
+    }
+    throw;
+  }
   publish_loaned_message(loaned_message);
 }
 
+std::shared_ptr<rclcpp::SerializedMessage>
+GenericPublisher::borrow_serialized_message(size_t capacity)
+{
+  auto message = serialized_message_pool_->acquire();
+  if (message->capacity() < capacity) {
+    message->reserve(capacity);
+  }
+  return message;
+}
+
 void * GenericPublisher::borrow_loaned_message()
 {
   void * loaned_message = nullptr;
@@ -74,6 +195,9 @@ void GenericPublisher::publish_loaned_message(void * loaned_message)
   if (return_code != RCL_RET_OK) {
     rclcpp::exceptions::throw_from_rcl_error(return_code, "failed to publish loaned message");
   }
+  if (topic_statistics_) {
+    topic_statistics_->record_inter_process_publication(true);
+  }
 }
 
 }  // namespace rclcpp
@@ -21,10 +21,55 @@
 #include "rcl/subscription.h"
 
 #include "rclcpp/exceptions.hpp"
+#include "rclcpp/experimental/intra_process_manager.hpp"
+#include "rclcpp/experimental/subscription_intra_process_serialized.hpp"
 
 namespace rclcpp
 {
 
+void
+GenericSubscription::setup_serialized_intra_process(
+  rclcpp::node_interfaces::NodeBaseInterface * node_base,
+  rclcpp::IntraProcessBufferType buffer_type)
+{
+  // As for rclcpp::GenericPublisher, incompatible QoS settings are not an error, the
+  // messages are then only received through the middleware.
+  const rclcpp::QoS qos_profile = get_actual_qos();
+  if (qos_profile.history() != rclcpp::HistoryPolicy::KeepLast || qos_profile.depth() == 0 ||
+    qos_profile.durability() != rclcpp::DurabilityPolicy::Volatile)
+  {
+    return;
+  }
+
+  // Views can be shared, while the other callback owns its message.
+  if (buffer_type == rclcpp::IntraProcessBufferType::CallbackDefault) {
+    buffer_type = view_callback_ ?
+      rclcpp::IntraProcessBufferType::SharedPtr : rclcpp::IntraProcessBufferType::UniquePtr;
+  } else if (buffer_type == rclcpp::IntraProcessBufferType::LockFreeCallbackDefault) {
+    buffer_type = view_callback_ ?
+      rclcpp::IntraProcessBufferType::LockFreeSharedPtr :
+      rclcpp::IntraProcessBufferType::LockFreeUniquePtr;
+  } else if (buffer_type == rclcpp::IntraProcessBufferType::MailboxCallbackDefault) {
+    buffer_type = view_callback_ ?
+      rclcpp::IntraProcessBufferType::MailboxSharedPtr :
+      rclcpp::IntraProcessBufferType::MailboxUniquePtr;
+  }
+
+  auto context = node_base->get_context();
+  subscription_intra_process_ =
+    std::make_shared<rclcpp::experimental::SubscriptionIntraProcessSerialized>(
+    callback_,
+    view_callback_,
+    context,
+    this->get_topic_name(),  // important to get like this, as it has the fully-qualified name
+    qos_profile,
+    buffer_type);
+
+  auto ipm = rclcpp::experimental::IntraProcessManager::get_instance(*context);
+  uint64_t intra_process_subscription_id = ipm->add_subscription(subscription_intra_process_);
+  this->setup_intra_process(intra_process_subscription_id, ipm);
+}
+
 std::shared_ptr<void>
 GenericSubscription::create_message()
 {
@@ -34,6 +79,9 @@ GenericSubscription::create_message()
 std::shared_ptr<rclcpp::SerializedMessage>
 GenericSubscription::create_serialized_message()
 {
+  if (serialized_message_pool_) {
+    return serialized_message_pool_->acquire();
+  }
   return std::make_shared<rclcpp::SerializedMessage>(0);
 }
 
@@ -48,9 +96,18 @@ GenericSubscription::handle_message(
 
 void
 GenericSubscription::handle_serialized_message(
-  const std::shared_ptr<rclcpp::SerializedMessage> & message,
-  const rclcpp::MessageInfo &)
+  const std::shared_ptr<rclcpp::SerializedMessage> & serialized_message,
+  const rclcpp::MessageInfo & message_info)
 {
+  std::shared_ptr<rclcpp::SerializedMessage> message = serialized_message;
+  if (payload_codec_) {
+    message = decoded_message_pool_->acquire();
+    payload_codec_->decode(serialized_message->get_rcl_serialized_message(), *message);
+  }
+  if (view_callback_) {
+    view_callback_(rclcpp::SerializedMessageView(*message), message_info);
+    return;
+  }
   callback_(message);
 }
 
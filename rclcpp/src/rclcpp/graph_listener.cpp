@@ -153,19 +153,17 @@ GraphListener::run_loop()
     detail::add_guard_condition_to_rcl_wait_set(wait_set_, interrupt_guard_condition_);
 
     // Put graph guard conditions for each node into the wait set.
-    std::vector<size_t> graph_gc_indexes(node_graph_interfaces_size, 0u);
+    // rcl_wait() clears the entries which weren't triggered, so they are added on each loop,
+    // but neither the indexes nor the guard conditions are allocated or queried again.
+    graph_gc_indexes_.assign(node_graph_interfaces_size, 0u);
     for (size_t i = 0u; i < node_graph_interfaces_size; ++i) {
-      auto node_ptr = node_graph_interfaces_[i];
       // Only wait on graph changes if some user of the node is watching.
-      if (node_ptr->count_graph_users() == 0) {
+      if (node_graph_interfaces_[i]->count_graph_users() == 0) {
         continue;
       }
       // Add the graph guard condition for the node to the wait set.
-      auto graph_gc = node_ptr->get_graph_guard_condition();
-      if (!graph_gc) {
-        throw_from_rcl_error(RCL_RET_ERROR, "failed to get graph guard condition");
-      }
-      ret = rcl_wait_set_add_guard_condition(&wait_set_, graph_gc, &graph_gc_indexes[i]);
+      ret = rcl_wait_set_add_guard_condition(
+        &wait_set_, graph_guard_conditions_[i], &graph_gc_indexes_[i]);
       if (RCL_RET_OK != ret) {
         throw_from_rcl_error(ret, "failed to add graph guard condition to wait set");
       }
@@ -183,11 +181,7 @@ GraphListener::run_loop()
     // Notify nodes who's guard conditions are set (triggered).
     for (size_t i = 0u; i < node_graph_interfaces_size; ++i) {
       const auto node_ptr = node_graph_interfaces_[i];
-      auto graph_gc = node_ptr->get_graph_guard_condition();
-      if (!graph_gc) {
-        throw_from_rcl_error(RCL_RET_ERROR, "failed to get graph guard condition");
-      }
-      if (graph_gc == wait_set_.guard_conditions[graph_gc_indexes[i]]) {
+      if (graph_guard_conditions_[i] == wait_set_.guard_conditions[graph_gc_indexes_[i]]) {
         node_ptr->notify_graph_change();
       }
       if (is_shutdown_) {
@@ -272,7 +266,13 @@ GraphListener::add_node(rclcpp::node_interfaces::NodeGraphInterface * node_graph
   if (has_node_(&node_graph_interfaces_, node_graph)) {
     throw NodeAlreadyAddedError();
   }
+  // The graph guard condition of a node doesn't change, so it is only queried here.
+  auto graph_gc = node_graph->get_graph_guard_condition();
+  if (!graph_gc) {
+    throw_from_rcl_error(RCL_RET_ERROR, "failed to get graph guard condition");
+  }
   node_graph_interfaces_.push_back(node_graph);
+  graph_guard_conditions_.push_back(graph_gc);
   // The run loop has already been interrupted by acquire_nodes_lock_() and
   // will evaluate the new node when nodes_lock releases the node_graph_interfaces_mutex_.
 }
@@ -280,14 +280,19 @@ GraphListener::add_node(rclcpp::node_interfaces::NodeGraphInterface * node_graph
 static void
 remove_node_(
   std::vector<rclcpp::node_interfaces::NodeGraphInterface *> * node_graph_interfaces,
+  std::vector<const rcl_guard_condition_t *> * graph_guard_conditions,
   rclcpp::node_interfaces::NodeGraphInterface * node_graph)
 {
   // Remove the node if it is found.
   for (auto it = node_graph_interfaces->begin(); it != node_graph_interfaces->end(); ++it) {
     if (node_graph == *it) {
-      // Found the node, remove it.
-      node_graph_interfaces->erase(it);
-      // Now trigger the interrupt guard condition to make sure
+      // Found the node, replace it and its graph guard condition with the last ones rather
+      // than shifting all the following ones, as the order doesn't matter.
+      const auto index = it - node_graph_interfaces->begin();
+      *it = node_graph_interfaces->back();
+      (*graph_guard_conditions)[index] = graph_guard_conditions->back();
+      node_graph_interfaces->pop_back();
+      graph_guard_conditions->pop_back();
       return;
     }
   }
@@ -304,7 +309,7 @@ GraphListener::remove_node(rclcpp::node_interfaces::NodeGraphInterface * node_gr
   std::lock_guard<std::mutex> shutdown_lock(shutdown_mutex_);
   if (is_shutdown()) {
     // If shutdown, then the run loop has been joined, so we can remove them directly.
-    return remove_node_(&node_graph_interfaces_, node_graph);
+    return remove_node_(&node_graph_interfaces_, &graph_guard_conditions_, node_graph);
   }
   // Otherwise, first interrupt and lock against the run loop to safely remove the node.
   // Acquire the nodes mutex using the barrier to prevent the run loop from
@@ -315,7 +320,7 @@ GraphListener::remove_node(rclcpp::node_interfaces::NodeGraphInterface * node_gr
     &interrupt_guard_condition_);
   // Store the now acquired node_graph_interfaces_mutex_ in the scoped lock using adopt_lock.
   std::lock_guard<std::mutex> nodes_lock(node_graph_interfaces_mutex_, std::adopt_lock);
-  remove_node_(&node_graph_interfaces_, node_graph);
+  remove_node_(&node_graph_interfaces_, &graph_guard_conditions_, node_graph);
 }
 
 void
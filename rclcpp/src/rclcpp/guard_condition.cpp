@@ -22,6 +22,16 @@
 namespace rclcpp
 {
 
+namespace
+{
+
+// States of GuardCondition::trigger_state_
+constexpr int kNotTriggered = 0;
+constexpr int kTriggered = 1;
+constexpr int kTriggersCoalesced = 2;
+
+}  // namespace
+
 GuardCondition::GuardCondition(
   rclcpp::Context::SharedPtr context,
   rcl_guard_condition_options_t guard_condition_options)
@@ -74,6 +84,24 @@ GuardCondition::get_rcl_guard_condition() const
 void
 GuardCondition::trigger()
 {
+  if (coalesce_triggers_.load(std::memory_order_relaxed) && !has_on_trigger_callback_.load()) {
+    // Only the first trigger since the last wait reaches the middleware
+    int state = trigger_state_.load();
+    while (true) {
+      if (state == kNotTriggered) {
+        if (trigger_state_.compare_exchange_weak(state, kTriggered)) {
+          break;
+        }
+      } else if (state == kTriggered) {
+        if (trigger_state_.compare_exchange_weak(state, kTriggersCoalesced)) {
+          return;
+        }
+      } else {
+        return;
+      }
+    }
+  }
+
   rcl_ret_t ret = rcl_trigger_guard_condition(&rcl_guard_condition_);
   if (RCL_RET_OK != ret) {
     rclcpp::exceptions::throw_from_rcl_error(ret);
@@ -90,6 +118,24 @@ GuardCondition::trigger()
   }
 }
 
+void
+GuardCondition::set_trigger_coalescing(bool coalesce)
+{
+  coalesce_triggers_.store(coalesce);
+  if (!coalesce) {
+    prepare_for_wait();
+  }
+}
+
+void
+GuardCondition::prepare_for_wait() const
+{
+  if (trigger_state_.exchange(kNotTriggered) == kTriggersCoalesced) {
+    // The wait set may have consumed the first trigger before the coalesced ones happened
+    const_cast<GuardCondition *>(this)->trigger();
+  }
+}
+
 bool
 GuardCondition::exchange_in_use_by_wait_set_state(bool in_use_state)
 {
@@ -100,6 +146,7 @@ void
 GuardCondition::add_to_wait_set(rcl_wait_set_t * wait_set)
 {
   std::lock_guard<std::recursive_mutex> lock(reentrant_mutex_);
+  prepare_for_wait();
 
   if (exchange_in_use_by_wait_set_state(true)) {
     if (wait_set != wait_set_) {
@@ -123,6 +170,7 @@ GuardCondition::set_on_trigger_callback(std::function<void(size_t)> callback)
 
   if (callback) {
     on_trigger_callback_ = callback;
+    has_on_trigger_callback_.store(true);
 
     if (unread_count_) {
       callback(unread_count_);
@@ -130,6 +178,7 @@ GuardCondition::set_on_trigger_callback(std::function<void(size_t)> callback)
     }
   } else {
     on_trigger_callback_ = nullptr;
+    has_on_trigger_callback_.store(false);
   }
 }
 
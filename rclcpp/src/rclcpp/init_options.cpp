@@ -44,6 +44,10 @@ InitOptions::InitOptions(const InitOptions & other)
 : InitOptions(*other.get_rcl_init_options())
 {
   shutdown_on_signal = other.shutdown_on_signal;
+  share_intra_process_across_contexts = other.share_intra_process_across_contexts;
+  keep_rcl_context_on_shutdown = other.keep_rcl_context_on_shutdown;
+  async_logging_queue_size = other.async_logging_queue_size;
+  async_logging_overflow_policy = other.async_logging_overflow_policy;
   initialize_logging_ = other.initialize_logging_;
 }
 
@@ -71,6 +75,10 @@ InitOptions::operator=(const InitOptions & other)
       rclcpp::exceptions::throw_from_rcl_error(ret, "failed to copy rcl init options");
     }
     this->shutdown_on_signal = other.shutdown_on_signal;
+    this->share_intra_process_across_contexts = other.share_intra_process_across_contexts;
+    this->keep_rcl_context_on_shutdown = other.keep_rcl_context_on_shutdown;
+    this->async_logging_queue_size = other.async_logging_queue_size;
+    this->async_logging_overflow_policy = other.async_logging_overflow_policy;
     this->initialize_logging_ = other.initialize_logging_;
   }
   return *this;
@@ -14,9 +14,13 @@
 
 #include "rclcpp/experimental/intra_process_manager.hpp"
 
+#include <algorithm>
 #include <atomic>
+#include <limits>
 #include <memory>
 #include <mutex>
+#include <string>
+#include <unordered_map>
 
 namespace rclcpp
 {
@@ -25,23 +29,61 @@ namespace experimental
 
 static std::atomic<uint64_t> _next_unique_id {1};
 
+namespace
+{
+
+/// Holds the intra process manager shared with other contexts, keeping it alive.
+struct SharedIntraProcessManagerHolder
+{
+  IntraProcessManager::SharedPtr ipm;
+};
+
+}  // namespace
+
 IntraProcessManager::IntraProcessManager()
 {}
 
 IntraProcessManager::~IntraProcessManager()
 {}
 
+IntraProcessManager::SharedPtr
+IntraProcessManager::get_instance(rclcpp::Context & context)
+{
+  if (!context.get_init_options().share_intra_process_across_contexts) {
+    return context.get_sub_context<IntraProcessManager>();
+  }
+
+  static std::mutex shared_ipms_mutex;
+  static std::unordered_map<size_t, std::weak_ptr<IntraProcessManager>> shared_ipms;
+
+  auto holder = context.get_sub_context<SharedIntraProcessManagerHolder>();
+  std::lock_guard<std::mutex> lock(shared_ipms_mutex);
+  if (!holder->ipm) {
+    auto & shared_ipm = shared_ipms[context.get_domain_id()];
+    holder->ipm = shared_ipm.lock();
+    if (!holder->ipm) {
+      holder->ipm = std::make_shared<IntraProcessManager>();
+      shared_ipm = holder->ipm;
+    }
+  }
+  return holder->ipm;
+}
+
 uint64_t
 IntraProcessManager::add_publisher(rclcpp::PublisherBase::SharedPtr publisher)
 {
-  std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+  std::unique_lock lock(mutex_);
 
   uint64_t pub_id = IntraProcessManager::get_next_unique_id();
 
   publishers_[pub_id] = publisher;
 
   // Initialize the subscriptions storage for this publisher.
-  pub_to_subs_[pub_id] = SplittedSubscriptions();
+  // Its broadcast ring keeps as many messages as its history, at least one.
+  auto plan = std::make_shared<DeliveryPlan>();
+  plan->broadcast = std::make_shared<BroadcastState>(
+    std::max<size_t>(publisher->get_actual_qos().depth(), 1));
+  pub_to_subs_[pub_id] = std::move(plan);
 
   // create an entry for the publisher id and populate with already existing subscriptions
   for (auto & pair : subscriptions_) {
@@ -51,7 +93,7 @@ IntraProcessManager::add_publisher(rclcpp::PublisherBase::SharedPtr publisher)
     }
     if (can_communicate(publisher, subscription)) {
       uint64_t sub_id = pair.first;
-      insert_sub_id_for_pub(sub_id, pub_id, subscription->use_take_shared_method());
+      insert_sub_id_for_pub(sub_id, subscription, pub_id);
     }
   }
 
@@ -61,7 +103,7 @@ IntraProcessManager::add_publisher(rclcpp::PublisherBase::SharedPtr publisher)
 uint64_t
 IntraProcessManager::add_subscription(SubscriptionIntraProcessBase::SharedPtr subscription)
 {
-  std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+  std::unique_lock lock(mutex_);
 
   uint64_t sub_id = IntraProcessManager::get_next_unique_id();
 
@@ -75,7 +117,7 @@ IntraProcessManager::add_subscription(SubscriptionIntraProcessBase::SharedPtr su
     }
     if (can_communicate(publisher, subscription)) {
       uint64_t pub_id = pair.first;
-      insert_sub_id_for_pub(sub_id, pub_id, subscription->use_take_shared_method());
+      insert_sub_id_for_pub(sub_id, subscription, pub_id);
     }
   }
 
@@ -85,44 +127,102 @@ IntraProcessManager::add_subscription(SubscriptionIntraProcessBase::SharedPtr su
 void
 IntraProcessManager::remove_subscription(uint64_t intra_process_subscription_id)
 {
-  std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+  std::unique_lock lock(mutex_);
 
   subscriptions_.erase(intra_process_subscription_id);
 
+  auto is_removed_subscription = [intra_process_subscription_id](const auto & target)
+    {
+      return target->subscription_id == intra_process_subscription_id;
+    };
+
   for (auto & pair : pub_to_subs_) {
-    pair.second.take_shared_subscriptions.erase(
-      std::remove(
-        pair.second.take_shared_subscriptions.begin(),
-        pair.second.take_shared_subscriptions.end(),
-        intra_process_subscription_id),
-      pair.second.take_shared_subscriptions.end());
-
-    pair.second.take_ownership_subscriptions.erase(
-      std::remove(
-        pair.second.take_ownership_subscriptions.begin(),
-        pair.second.take_ownership_subscriptions.end(),
-        intra_process_subscription_id),
-      pair.second.take_ownership_subscriptions.end());
+    const auto & plan = *pair.second;
+    if (std::none_of(
+        plan.all_subscriptions.begin(), plan.all_subscriptions.end(), is_removed_subscription))
+    {
+      continue;
+    }
+
+    // Publishing may still be using the current plan, so a new one is built
+    auto new_plan = std::make_shared<DeliveryPlan>(plan);
+    for (auto * targets : {&new_plan->take_shared_subscriptions,
+        &new_plan->take_ownership_subscriptions, &new_plan->all_subscriptions})
+    {
+      targets->erase(
+        std::remove_if(targets->begin(), targets->end(), is_removed_subscription),
+        targets->end());
+    }
+    pair.second = std::move(new_plan);
+    update_subscription_count(pair.first);
   }
 }
 
+uint64_t
+IntraProcessManager::add_service(ServiceIntraProcessBase::SharedPtr service)
+{
+  std::unique_lock lock(mutex_);
+
+  uint64_t service_id = IntraProcessManager::get_next_unique_id();
+  services_[service->get_service_name()].emplace(service_id, service);
+  service_names_.emplace(service_id, service->get_service_name());
+  return service_id;
+}
+
+void
+IntraProcessManager::remove_service(uint64_t intra_process_service_id)
+{
+  std::unique_lock lock(mutex_);
+
+  auto name_it = service_names_.find(intra_process_service_id);
+  if (name_it == service_names_.end()) {
+    return;
+  }
+  auto services_it = services_.find(name_it->second);
+  if (services_it != services_.end()) {
+    services_it->second.erase(intra_process_service_id);
+    if (services_it->second.empty()) {
+      services_.erase(services_it);
+    }
+  }
+  service_names_.erase(name_it);
+}
+
+ServiceIntraProcessBase::SharedPtr
+IntraProcessManager::get_service(const std::string & service_name) const
+{
+  std::shared_lock lock(mutex_);
+
+  auto services_it = services_.find(service_name);
+  if (services_it == services_.end()) {
+    return nullptr;
+  }
+  for (const auto & pair : services_it->second) {
+    auto service = pair.second.lock();
+    if (service) {
+      return service;
+    }
+  }
+  return nullptr;
+}
+
 void
 IntraProcessManager::remove_publisher(uint64_t intra_process_publisher_id)
 {
-  std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+  std::unique_lock lock(mutex_);
 
   publishers_.erase(intra_process_publisher_id);
   pub_to_subs_.erase(intra_process_publisher_id);
 }
 
 bool
-IntraProcessManager::matches_any_publishers(const rmw_gid_t * id) const
+IntraProcessManager::matches_any_publishers(const rmw_gid_t * id, bool serialized) const
 {
-  std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+  std::shared_lock lock(mutex_);
 
   for (auto & publisher_pair : publishers_) {
     auto publisher = publisher_pair.second.lock();
-    if (!publisher) {
+    if (!publisher || publisher->is_serialized() != serialized) {
       continue;
     }
     if (*publisher.get() == id) {
@@ -135,10 +235,8 @@ IntraProcessManager::matches_any_publishers(const rmw_gid_t * id) const
 size_t
 IntraProcessManager::get_subscription_count(uint64_t intra_process_publisher_id) const
 {
-  std::shared_lock<std::shared_timed_mutex> lock(mutex_);
-
-  auto publisher_it = pub_to_subs_.find(intra_process_publisher_id);
-  if (publisher_it == pub_to_subs_.end()) {
+  auto plan = get_delivery_plan(intra_process_publisher_id);
+  if (!plan) {
     // Publisher is either invalid or no longer exists.
     RCLCPP_WARN(
       rclcpp::get_logger("rclcpp"),
@@ -146,17 +244,13 @@ IntraProcessManager::get_subscription_count(uint64_t intra_process_publisher_id)
     return 0;
   }
 
-  auto count =
-    publisher_it->second.take_shared_subscriptions.size() +
-    publisher_it->second.take_ownership_subscriptions.size();
-
-  return count;
+  return plan->all_subscriptions.size();
 }
 
 SubscriptionIntraProcessBase::SharedPtr
 IntraProcessManager::get_subscription_intra_process(uint64_t intra_process_subscription_id)
 {
-  std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+  std::shared_lock lock(mutex_);
 
   auto subscription_it = subscriptions_.find(intra_process_subscription_id);
   if (subscription_it == subscriptions_.end()) {
@@ -197,14 +291,50 @@ IntraProcessManager::get_next_unique_id()
 void
 IntraProcessManager::insert_sub_id_for_pub(
   uint64_t sub_id,
-  uint64_t pub_id,
-  bool use_take_shared_method)
+  SubscriptionIntraProcessBase::SharedPtr subscription,
+  uint64_t pub_id)
 {
-  if (use_take_shared_method) {
-    pub_to_subs_[pub_id].take_shared_subscriptions.push_back(sub_id);
+  auto & plan = pub_to_subs_[pub_id];
+  auto target = std::make_shared<const DeliveryTarget>(sub_id, subscription);
+
+  // Publishing may still be using the current plan, so a new one is built
+  auto new_plan = plan ? std::make_shared<DeliveryPlan>(*plan) : std::make_shared<DeliveryPlan>();
+  if (subscription->use_take_shared_method()) {
+    new_plan->take_shared_subscriptions.push_back(target);
+    new_plan->all_subscriptions.insert(
+      new_plan->all_subscriptions.begin() + new_plan->take_shared_subscriptions.size() - 1,
+      target);
   } else {
-    pub_to_subs_[pub_id].take_ownership_subscriptions.push_back(sub_id);
+    new_plan->take_ownership_subscriptions.push_back(target);
+    new_plan->all_subscriptions.push_back(target);
+  }
+  plan = std::move(new_plan);
+  update_subscription_count(pub_id);
+}
+
+void
+IntraProcessManager::update_subscription_count(uint64_t pub_id)
+{
+  auto publisher_it = publishers_.find(pub_id);
+  if (publisher_it == publishers_.end()) {
+    return;
+  }
+  auto publisher = publisher_it->second.lock();
+  if (publisher) {
+    publisher->set_intra_process_subscription_count(pub_to_subs_[pub_id]->all_subscriptions.size());
+  }
+}
+
+std::shared_ptr<const IntraProcessManager::DeliveryPlan>
+IntraProcessManager::get_delivery_plan(uint64_t intra_process_publisher_id) const
+{
+  std::shared_lock lock(mutex_);
+
+  auto publisher_it = pub_to_subs_.find(intra_process_publisher_id);
+  if (publisher_it == pub_to_subs_.end()) {
+    return nullptr;
   }
+  return publisher_it->second;
 }
 
 bool
@@ -217,6 +347,11 @@ IntraProcessManager::can_communicate(
     return false;
   }
 
+  // serialized messages are only exchanged between generic publishers and subscriptions
+  if (pub->is_serialized() != sub->is_serialized()) {
+    return false;
+  }
+
   auto check_result = rclcpp::qos_check_compatible(pub->get_actual_qos(), sub->get_actual_qos());
   if (check_result.compatibility == rclcpp::QoSCompatibility::Error) {
     return false;
@@ -230,8 +365,8 @@ IntraProcessManager::lowest_available_capacity(const uint64_t intra_process_publ
 {
   size_t capacity = std::numeric_limits<size_t>::max();
 
-  auto publisher_it = pub_to_subs_.find(intra_process_publisher_id);
-  if (publisher_it == pub_to_subs_.end()) {
+  auto plan = get_delivery_plan(intra_process_publisher_id);
+  if (!plan) {
     // Publisher is either invalid or no longer exists.
     RCLCPP_WARN(
       rclcpp::get_logger("rclcpp"),
@@ -239,35 +374,16 @@ IntraProcessManager::lowest_available_capacity(const uint64_t intra_process_publ
     return 0u;
   }
 
-  if (publisher_it->second.take_shared_subscriptions.empty() &&
-    publisher_it->second.take_ownership_subscriptions.empty())
-  {
+  if (plan->all_subscriptions.empty()) {
     // no subscriptions available
     return 0u;
   }
 
-  auto available_capacity = [this, &capacity](const uint64_t intra_process_subscription_id)
-    {
-      auto subscription_it = subscriptions_.find(intra_process_subscription_id);
-      if (subscription_it != subscriptions_.end()) {
-        auto subscription = subscription_it->second.lock();
-        if (subscription) {
-          capacity = std::min(capacity, subscription->available_capacity());
-        }
-      } else {
-        // Subscription is either invalid or no longer exists.
-        RCLCPP_WARN(
-          rclcpp::get_logger("rclcpp"),
-          "Calling available_capacity for invalid or no longer existing subscription id");
-      }
-    };
-
-  for (const auto sub_id : publisher_it->second.take_shared_subscriptions) {
-    available_capacity(sub_id);
-  }
-
-  for (const auto sub_id : publisher_it->second.take_ownership_subscriptions) {
-    available_capacity(sub_id);
+  for (const auto & target : plan->all_subscriptions) {
+    auto subscription = target->subscription.lock();
+    if (subscription) {
+      capacity = std::min(capacity, subscription->available_capacity());
+    }
   }
 
   return capacity;
@@ -0,0 +1,156 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rclcpp/experimental/intra_process_work_queue.hpp"
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+
+#include "rclcpp/detail/add_guard_condition_to_rcl_wait_set.hpp"
+#include "rclcpp/logging.hpp"
+#include "rmw/impl/cpp/demangle.hpp"
+
+using rclcpp::experimental::IntraProcessWorkQueue;
+
+IntraProcessWorkQueue::IntraProcessWorkQueue(rclcpp::Context::SharedPtr context)
+: gc_(std::move(context))
+{
+  // Work pushed before the next wait needs a single trigger
+  gc_.set_trigger_coalescing(true);
+}
+
+IntraProcessWorkQueue::~IntraProcessWorkQueue()
+{}
+
+void
+IntraProcessWorkQueue::push(Work work)
+{
+  {
+    std::lock_guard<std::mutex> lock(queue_mutex_);
+    queue_.push_back(std::move(work));
+  }
+  gc_.trigger();
+
+  std::lock_guard<std::recursive_mutex> lock(callback_mutex_);
+  if (on_ready_callback_) {
+    on_ready_callback_(1);
+  } else {
+    unread_count_++;
+  }
+}
+
+size_t
+IntraProcessWorkQueue::size() const
+{
+  std::lock_guard<std::mutex> lock(queue_mutex_);
+  return queue_.size();
+}
+
+void
+IntraProcessWorkQueue::add_to_wait_set(rcl_wait_set_t * wait_set)
+{
+  detail::add_guard_condition_to_rcl_wait_set(*wait_set, gc_);
+}
+
+bool
+IntraProcessWorkQueue::is_ready(rcl_wait_set_t * wait_set)
+{
+  (void)wait_set;
+  return size() > 0;
+}
+
+std::shared_ptr<void>
+IntraProcessWorkQueue::take_data()
+{
+  std::shared_ptr<Work> work;
+  bool more = false;
+  {
+    std::lock_guard<std::mutex> lock(queue_mutex_);
+    if (queue_.empty()) {
+      return nullptr;
+    }
+    work = std::make_shared<Work>(std::move(queue_.front()));
+    queue_.pop_front();
+    more = !queue_.empty();
+  }
+  if (more) {
+    // A single item is executed per wait, wake the next one up for the rest
+    gc_.trigger();
+  }
+  return work;
+}
+
+std::shared_ptr<void>
+IntraProcessWorkQueue::take_data_by_entity_id(size_t id)
+{
+  (void)id;
+  return take_data();
+}
+
+void
+IntraProcessWorkQueue::execute(std::shared_ptr<void> & data)
+{
+  auto work = std::static_pointer_cast<Work>(data);
+  if (work && *work) {
+    (*work)();
+  }
+}
+
+void
+IntraProcessWorkQueue::set_on_ready_callback(std::function<void(size_t, int)> callback)
+{
+  if (!callback) {
+    throw std::invalid_argument(
+            "The callback passed to set_on_ready_callback "
+            "is not callable.");
+  }
+
+  // Note: we bind the int identifier argument to this waitable's entity types
+  auto new_callback =
+    [callback, this](size_t number_of_events) {
+      try {
+        callback(number_of_events, static_cast<int>(EntityType::Work));
+      } catch (const std::exception & exception) {
+        RCLCPP_ERROR_STREAM(
+          rclcpp::get_logger("rclcpp"),
+          "rclcpp::experimental::IntraProcessWorkQueue@" << this <<
+            " caught " << rmw::impl::cpp::demangle(exception) <<
+            " exception in user-provided callback for the 'on ready' callback: " <<
+            exception.what());
+      } catch (...) {
+        RCLCPP_ERROR_STREAM(
+          rclcpp::get_logger("rclcpp"),
+          "rclcpp::experimental::IntraProcessWorkQueue@" << this <<
+            " caught unhandled exception in user-provided callback " <<
+            "for the 'on ready' callback");
+      }
+    };
+
+  std::lock_guard<std::recursive_mutex> lock(callback_mutex_);
+  on_ready_callback_ = new_callback;
+  if (unread_count_ > 0) {
+    on_ready_callback_(unread_count_);
+    unread_count_ = 0;
+  }
+}
+
+void
+IntraProcessWorkQueue::clear_on_ready_callback()
+{
+  std::lock_guard<std::recursive_mutex> lock(callback_mutex_);
+  on_ready_callback_ = nullptr;
+}
@@ -0,0 +1,117 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rclcpp/lock_profiling.hpp"
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace rclcpp
+{
+namespace lock_profiling
+{
+
+namespace detail
+{
+
+std::atomic<bool> enabled{false};
+
+namespace
+{
+
+/// The counters of each name, never removed so that the references stay valid.
+struct Registry
+{
+  std::mutex mutex;
+  std::map<std::string, std::unique_ptr<LockCounters>> counters;
+};
+
+Registry &
+get_registry()
+{
+  // Leaked, so that mutexes of static objects can be destroyed after it
+  static Registry * registry = new Registry();
+  return *registry;
+}
+
+}  // namespace
+
+LockCounters &
+get_lock_counters(const char * name)
+{
+  Registry & registry = get_registry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  auto & counters = registry.counters[name];
+  if (!counters) {
+    counters = std::make_unique<LockCounters>();
+  }
+  return *counters;
+}
+
+}  // namespace detail
+
+void
+set_enabled(bool enabled) noexcept
+{
+  detail::enabled.store(enabled, std::memory_order_relaxed);
+}
+
+std::vector<LockStatistics>
+get_statistics()
+{
+  detail::Registry & registry = detail::get_registry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  std::vector<LockStatistics> statistics;
+  for (const auto & pair : registry.counters) {
+    const detail::LockCounters & counters = *pair.second;
+    LockStatistics entry;
+    entry.acquisitions = counters.acquisitions.load(std::memory_order_relaxed);
+    if (entry.acquisitions == 0) {
+      continue;
+    }
+    entry.name = pair.first;
+    entry.contended_acquisitions = counters.contended_acquisitions.load(std::memory_order_relaxed);
+    entry.wait_time = std::chrono::nanoseconds(
+      counters.wait_time_ns.load(std::memory_order_relaxed));
+    entry.max_wait_time = std::chrono::nanoseconds(
+      counters.max_wait_time_ns.load(std::memory_order_relaxed));
+    entry.hold_time = std::chrono::nanoseconds(
+      counters.hold_time_ns.load(std::memory_order_relaxed));
+    statistics.push_back(std::move(entry));
+  }
+  return statistics;
+}
+
+void
+reset_statistics()
+{
+  detail::Registry & registry = detail::get_registry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  for (const auto & pair : registry.counters) {
+    detail::LockCounters & counters = *pair.second;
+    counters.acquisitions.store(0, std::memory_order_relaxed);
+    counters.contended_acquisitions.store(0, std::memory_order_relaxed);
+    counters.wait_time_ns.store(0, std::memory_order_relaxed);
+    counters.max_wait_time_ns.store(0, std::memory_order_relaxed);
+    counters.hold_time_ns.store(0, std::memory_order_relaxed);
+  }
+}
+
+}  // namespace lock_profiling
+}  // namespace rclcpp
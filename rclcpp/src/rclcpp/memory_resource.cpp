@@ -0,0 +1,68 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rclcpp/memory_resource.hpp"
+
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <stdexcept>
+
+using rclcpp::pmr::SynchronizedMemoryResource;
+
+std::shared_ptr<rclcpp::pmr::Allocator>
+rclcpp::pmr::make_allocator(std::pmr::memory_resource * resource)
+{
+  if (!resource) {
+    throw std::invalid_argument("resource must not be nullptr");
+  }
+  return std::make_shared<Allocator>(resource);
+}
+
+SynchronizedMemoryResource::SynchronizedMemoryResource(std::pmr::memory_resource * upstream)
+: upstream_(upstream)
+{
+  if (!upstream_) {
+    throw std::invalid_argument("upstream resource must not be nullptr");
+  }
+}
+
+SynchronizedMemoryResource::~SynchronizedMemoryResource()
+{}
+
+std::pmr::memory_resource *
+SynchronizedMemoryResource::upstream_resource() const
+{
+  return upstream_;
+}
+
+void *
+SynchronizedMemoryResource::do_allocate(size_t bytes, size_t alignment)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return upstream_->allocate(bytes, alignment);
+}
+
+void
+SynchronizedMemoryResource::do_deallocate(void * pointer, size_t bytes, size_t alignment)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  upstream_->deallocate(pointer, bytes, alignment);
+}
+
+bool
+SynchronizedMemoryResource::do_is_equal(const std::pmr::memory_resource & other) const noexcept
+{
+  return this == &other;
+}
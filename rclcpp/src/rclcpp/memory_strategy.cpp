@@ -17,6 +17,27 @@
 
 using rclcpp::memory_strategy::MemoryStrategy;
 
+namespace
+{
+
+// The group of an entity, if it's one of the groups of the map and its node still exists
+rclcpp::CallbackGroup::SharedPtr
+get_group_if_in_map(
+  rclcpp::CallbackGroup::SharedPtr group,
+  const MemoryStrategy::WeakCallbackGroupsToNodesMap & weak_groups_to_nodes)
+{
+  if (!group) {
+    return nullptr;
+  }
+  const auto it = weak_groups_to_nodes.find(group);
+  if (it == weak_groups_to_nodes.end() || it->second.expired()) {
+    return nullptr;
+  }
+  return group;
+}
+
+}  // namespace
+
 rclcpp::SubscriptionBase::SharedPtr
 MemoryStrategy::get_subscription_by_handle(
   const std::shared_ptr<const rcl_subscription_t> & subscriber_handle,
@@ -124,21 +145,10 @@ MemoryStrategy::get_group_by_subscription(
   const rclcpp::SubscriptionBase::SharedPtr & subscription,
   const WeakCallbackGroupsToNodesMap & weak_groups_to_nodes)
 {
-  for (const auto & pair : weak_groups_to_nodes) {
-    auto group = pair.first.lock();
-    auto node = pair.second.lock();
-    if (!group || !node) {
-      continue;
-    }
-    auto match_sub = group->find_subscription_ptrs_if(
-      [&subscription](const rclcpp::SubscriptionBase::SharedPtr & sub) -> bool {
-        return sub == subscription;
-      });
-    if (match_sub) {
-      return group;
-    }
+  if (!subscription) {
+    return nullptr;
   }
-  return nullptr;
+  return get_group_if_in_map(subscription->get_callback_group(), weak_groups_to_nodes);
 }
 
 rclcpp::CallbackGroup::SharedPtr
@@ -146,21 +156,10 @@ MemoryStrategy::get_group_by_service(
   const rclcpp::ServiceBase::SharedPtr & service,
   const WeakCallbackGroupsToNodesMap & weak_groups_to_nodes)
 {
-  for (const auto & pair : weak_groups_to_nodes) {
-    auto group = pair.first.lock();
-    auto node = pair.second.lock();
-    if (!group || !node) {
-      continue;
-    }
-    auto service_ref = group->find_service_ptrs_if(
-      [&service](const rclcpp::ServiceBase::SharedPtr & serv) -> bool {
-        return serv == service;
-      });
-    if (service_ref) {
-      return group;
-    }
+  if (!service) {
+    return nullptr;
   }
-  return nullptr;
+  return get_group_if_in_map(service->get_callback_group(), weak_groups_to_nodes);
 }
 
 rclcpp::CallbackGroup::SharedPtr
@@ -168,21 +167,10 @@ MemoryStrategy::get_group_by_client(
   const rclcpp::ClientBase::SharedPtr & client,
   const WeakCallbackGroupsToNodesMap & weak_groups_to_nodes)
 {
-  for (const auto & pair : weak_groups_to_nodes) {
-    auto group = pair.first.lock();
-    auto node = pair.second.lock();
-    if (!group || !node) {
-      continue;
-    }
-    auto client_ref = group->find_client_ptrs_if(
-      [&client](const rclcpp::ClientBase::SharedPtr & cli) -> bool {
-        return cli == client;
-      });
-    if (client_ref) {
-      return group;
-    }
+  if (!client) {
+    return nullptr;
   }
-  return nullptr;
+  return get_group_if_in_map(client->get_callback_group(), weak_groups_to_nodes);
 }
 
 rclcpp::CallbackGroup::SharedPtr
@@ -190,21 +178,10 @@ MemoryStrategy::get_group_by_timer(
   const rclcpp::TimerBase::SharedPtr & timer,
   const WeakCallbackGroupsToNodesMap & weak_groups_to_nodes)
 {
-  for (const auto & pair : weak_groups_to_nodes) {
-    auto group = pair.first.lock();
-    auto node = pair.second.lock();
-    if (!group || !node) {
-      continue;
-    }
-    auto timer_ref = group->find_timer_ptrs_if(
-      [&timer](const rclcpp::TimerBase::SharedPtr & time) -> bool {
-        return time == timer;
-      });
-    if (timer_ref) {
-      return group;
-    }
+  if (!timer) {
+    return nullptr;
   }
-  return nullptr;
+  return get_group_if_in_map(timer->get_callback_group(), weak_groups_to_nodes);
 }
 
 rclcpp::CallbackGroup::SharedPtr
@@ -212,19 +189,8 @@ MemoryStrategy::get_group_by_waitable(
   const rclcpp::Waitable::SharedPtr & waitable,
   const WeakCallbackGroupsToNodesMap & weak_groups_to_nodes)
 {
-  for (const auto & pair : weak_groups_to_nodes) {
-    auto group = pair.first.lock();
-    auto node = pair.second.lock();
-    if (!group || !node) {
-      continue;
-    }
-    auto waitable_ref = group->find_waitable_ptrs_if(
-      [&waitable](const rclcpp::Waitable::SharedPtr & group_waitable) -> bool {
-        return group_waitable == waitable;
-      });
-    if (waitable_ref) {
-      return group;
-    }
+  if (!waitable) {
+    return nullptr;
   }
-  return nullptr;
+  return get_group_if_in_map(waitable->get_callback_group(), weak_groups_to_nodes);
 }
@@ -36,4 +36,16 @@ MessageInfo::get_rmw_message_info()
   return rmw_message_info_;
 }
 
+std::chrono::steady_clock::time_point
+MessageInfo::get_receive_stamp() const
+{
+  return receive_stamp_;
+}
+
+void
+MessageInfo::set_receive_stamp(std::chrono::steady_clock::time_point receive_stamp)
+{
+  receive_stamp_ = receive_stamp;
+}
+
 }  // namespace rclcpp
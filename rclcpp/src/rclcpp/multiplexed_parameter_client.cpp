@@ -0,0 +1,380 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rclcpp/multiplexed_parameter_client.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "./parameter_service_names.hpp"
+
+using rclcpp::MultiplexedParameterClient;
+
+/// Parameters requested from a remote node in a single get_parameters request.
+struct MultiplexedParameterClient::GetParametersBatch
+{
+  /// Caller waiting for some of the parameters of the batch.
+  struct Waiter
+  {
+    size_t offset;
+    size_t count;
+    std::shared_ptr<std::promise<std::vector<rclcpp::Parameter>>> promise;
+    std::shared_future<std::vector<rclcpp::Parameter>> future;
+    std::function<void(std::shared_future<std::vector<rclcpp::Parameter>>)> callback;
+  };
+
+  std::vector<std::string> names;
+  std::vector<Waiter> waiters;
+};
+
+/// Service clients of a remote node, created when first used.
+struct MultiplexedParameterClient::RemoteNode
+{
+  std::string name;
+  rclcpp::Client<rcl_interfaces::srv::GetParameters>::SharedPtr get_parameters_client;
+  rclcpp::Client<rcl_interfaces::srv::DescribeParameters>::SharedPtr
+    describe_parameters_client;
+  rclcpp::Client<rcl_interfaces::srv::SetParameters>::SharedPtr set_parameters_client;
+  rclcpp::Client<rcl_interfaces::srv::ListParameters>::SharedPtr list_parameters_client;
+  /// Number of requests in flight, the clients aren't evicted while it's not zero.
+  size_t requests_in_flight = 0;
+  /// Whether a get_parameters request is in flight, further ones are queued meanwhile.
+  bool get_parameters_in_flight = false;
+  GetParametersBatch queued_batch;
+};
+
+MultiplexedParameterClient::MultiplexedParameterClient(
+  const rclcpp::node_interfaces::NodeBaseInterface::SharedPtr node_base,
+  const rclcpp::node_interfaces::NodeGraphInterface::SharedPtr node_graph,
+  const rclcpp::node_interfaces::NodeServicesInterface::SharedPtr node_services,
+  size_t max_remote_nodes,
+  const rclcpp::QoS & qos_profile,
+  rclcpp::CallbackGroup::SharedPtr group)
+: node_base_(node_base),
+  node_graph_(node_graph),
+  node_services_(node_services),
+  max_remote_nodes_(max_remote_nodes),
+  qos_profile_(qos_profile),
+  group_(std::move(group))
+{
+  if (max_remote_nodes_ == 0) {
+    throw std::invalid_argument("max_remote_nodes must be greater than zero");
+  }
+}
+
+MultiplexedParameterClient::~MultiplexedParameterClient() {}
+
+std::shared_ptr<MultiplexedParameterClient::RemoteNode>
+MultiplexedParameterClient::get_remote_node(const std::string & remote_node_name)
+{
+  auto it = remote_nodes_.find(remote_node_name);
+  if (it != remote_nodes_.end()) {
+    lru_.splice(lru_.begin(), lru_, it->second);
+    return lru_.front();
+  }
+
+  // Evict the least recently used nodes without requests in flight
+  for (auto lru_it = lru_.end(); lru_it != lru_.begin() && lru_.size() >= max_remote_nodes_; ) {
+    --lru_it;
+    if ((*lru_it)->requests_in_flight == 0) {
+      remote_nodes_.erase((*lru_it)->name);
+      lru_it = lru_.erase(lru_it);
+    }
+  }
+
+  auto remote_node = std::make_shared<RemoteNode>();
+  remote_node->name = remote_node_name;
+  lru_.push_front(remote_node);
+  remote_nodes_.emplace(remote_node_name, lru_.begin());
+  return remote_node;
+}
+
+template<typename ServiceT>
+typename rclcpp::Client<ServiceT>::SharedPtr
+MultiplexedParameterClient::get_client(
+  RemoteNode & remote_node,
+  typename rclcpp::Client<ServiceT>::SharedPtr & client,
+  const char * service_name)
+{
+  if (!client) {
+    rcl_client_options_t options = rcl_client_get_default_options();
+    options.qos = qos_profile_.get_rmw_qos_profile();
+    client = rclcpp::Client<ServiceT>::make_shared(
+      node_base_.get(), node_graph_, remote_node.name + "/" + service_name, options);
+    node_services_->add_client(std::dynamic_pointer_cast<rclcpp::ClientBase>(client), group_);
+  }
+  return client;
+}
+
+std::shared_future<std::vector<rclcpp::Parameter>>
+MultiplexedParameterClient::get_parameters(
+  const std::string & remote_node_name,
+  const std::vector<std::string> & names,
+  std::function<
+    void(std::shared_future<std::vector<rclcpp::Parameter>>)
+  > callback)
+{
+  auto promise_result = std::make_shared<std::promise<std::vector<rclcpp::Parameter>>>();
+  auto future_result = promise_result->get_future().share();
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto remote_node = get_remote_node(remote_node_name);
+  auto & batch = remote_node->queued_batch;
+  batch.waiters.push_back(
+    GetParametersBatch::Waiter{
+      batch.names.size(), names.size(), promise_result, future_result, callback});
+  batch.names.insert(batch.names.end(), names.begin(), names.end());
+  if (!remote_node->get_parameters_in_flight) {
+    send_queued_batch(remote_node);
+  }
+  return future_result;
+}
+
+void
+MultiplexedParameterClient::send_queued_batch(const std::shared_ptr<RemoteNode> & remote_node)
+{
+  if (remote_node->queued_batch.waiters.empty()) {
+    remote_node->get_parameters_in_flight = false;
+    return;
+  }
+  auto batch = std::make_shared<GetParametersBatch>(std::move(remote_node->queued_batch));
+  remote_node->queued_batch = GetParametersBatch{};
+  remote_node->get_parameters_in_flight = true;
+  remote_node->requests_in_flight++;
+
+  auto request = std::make_shared<rcl_interfaces::srv::GetParameters::Request>();
+  request->names = batch->names;
+  auto client = get_client<rcl_interfaces::srv::GetParameters>(
+    *remote_node, remote_node->get_parameters_client, parameter_service_names::get_parameters);
+  client->async_send_request(
+    request,
+    [this, weak_remote_node = std::weak_ptr<RemoteNode>(remote_node), batch](
+      rclcpp::Client<rcl_interfaces::srv::GetParameters>::SharedFuture cb_f)
+    {
+      const auto & values = cb_f.get()->values;
+      for (const auto & waiter : batch->waiters) {
+        std::vector<rclcpp::Parameter> parameters;
+        // The service returns no values if any parameter isn't declared
+        if (values.size() != batch->names.size()) {
+          waiter.promise->set_value(std::move(parameters));
+          continue;
+        }
+        parameters.reserve(waiter.count);
+        for (size_t i = waiter.offset; i < waiter.offset + waiter.count; ++i) {
+          rcl_interfaces::msg::Parameter parameter;
+          parameter.name = batch->names[i];
+          parameter.value = values[i];
+          parameters.push_back(rclcpp::Parameter::from_parameter_msg(parameter));
+        }
+        waiter.promise->set_value(std::move(parameters));
+      }
+      auto remote_node = weak_remote_node.lock();
+      if (remote_node) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        remote_node->requests_in_flight--;
+        send_queued_batch(remote_node);
+      }
+      for (const auto & waiter : batch->waiters) {
+        if (waiter.callback) {
+          waiter.callback(waiter.future);
+        }
+      }
+    });
+}
+
+void
+MultiplexedParameterClient::finish_request(const std::weak_ptr<RemoteNode> & weak_remote_node)
+{
+  auto remote_node = weak_remote_node.lock();
+  if (remote_node) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    remote_node->requests_in_flight--;
+  }
+}
+
+std::shared_future<std::vector<rcl_interfaces::msg::ParameterDescriptor>>
+MultiplexedParameterClient::describe_parameters(
+  const std::string & remote_node_name,
+  const std::vector<std::string> & names,
+  std::function<
+    void(std::shared_future<std::vector<rcl_interfaces::msg::ParameterDescriptor>>)
+  > callback)
+{
+  auto promise_result =
+    std::make_shared<std::promise<std::vector<rcl_interfaces::msg::ParameterDescriptor>>>();
+  auto future_result = promise_result->get_future().share();
+
+  auto request = std::make_shared<rcl_interfaces::srv::DescribeParameters::Request>();
+  request->names = names;
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto remote_node = get_remote_node(remote_node_name);
+  auto client = get_client<rcl_interfaces::srv::DescribeParameters>(
+    *remote_node, remote_node->describe_parameters_client,
+    parameter_service_names::describe_parameters);
+  remote_node->requests_in_flight++;
+  client->async_send_request(
+    request,
+    [this, weak_remote_node = std::weak_ptr<RemoteNode>(remote_node), promise_result,
+    future_result, callback](
+      rclcpp::Client<rcl_interfaces::srv::DescribeParameters>::SharedFuture cb_f)
+    {
+      promise_result->set_value(cb_f.get()->descriptors);
+      finish_request(weak_remote_node);
+      if (callback != nullptr) {
+        callback(future_result);
+      }
+    });
+
+  return future_result;
+}
+
+std::shared_future<std::vector<rcl_interfaces::msg::SetParametersResult>>
+MultiplexedParameterClient::set_parameters(
+  const std::string & remote_node_name,
+  const std::vector<rclcpp::Parameter> & parameters,
+  std::function<
+    void(std::shared_future<std::vector<rcl_interfaces::msg::SetParametersResult>>)
+  > callback)
+{
+  auto promise_result =
+    std::make_shared<std::promise<std::vector<rcl_interfaces::msg::SetParametersResult>>>();
+  auto future_result = promise_result->get_future().share();
+
+  auto request = std::make_shared<rcl_interfaces::srv::SetParameters::Request>();
+  request->parameters.reserve(parameters.size());
+  for (const auto & parameter : parameters) {
+    request->parameters.push_back(parameter.to_parameter_msg());
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto remote_node = get_remote_node(remote_node_name);
+  auto client = get_client<rcl_interfaces::srv::SetParameters>(
+    *remote_node, remote_node->set_parameters_client, parameter_service_names::set_parameters);
+  remote_node->requests_in_flight++;
+  client->async_send_request(
+    request,
+    [this, weak_remote_node = std::weak_ptr<RemoteNode>(remote_node), promise_result,
+    future_result, callback](
+      rclcpp::Client<rcl_interfaces::srv::SetParameters>::SharedFuture cb_f)
+    {
+      promise_result->set_value(cb_f.get()->results);
+      finish_request(weak_remote_node);
+      if (callback != nullptr) {
+        callback(future_result);
+      }
+    });
+
+  return future_result;
+}
+
+std::shared_future<rcl_interfaces::msg::ListParametersResult>
+MultiplexedParameterClient::list_parameters(
+  const std::string & remote_node_name,
+  const std::vector<std::string> & prefixes,
+  uint64_t depth,
+  std::function<
+    void(std::shared_future<rcl_interfaces::msg::ListParametersResult>)
+  > callback)
+{
+  auto promise_result = std::make_shared<std::promise<rcl_interfaces::msg::ListParametersResult>>();
+  auto future_result = promise_result->get_future().share();
+
+  auto request = std::make_shared<rcl_interfaces::srv::ListParameters::Request>();
+  request->prefixes = prefixes;
+  request->depth = depth;
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto remote_node = get_remote_node(remote_node_name);
+  auto client = get_client<rcl_interfaces::srv::ListParameters>(
+    *remote_node, remote_node->list_parameters_client, parameter_service_names::list_parameters);
+  remote_node->requests_in_flight++;
+  client->async_send_request(
+    request,
+    [this, weak_remote_node = std::weak_ptr<RemoteNode>(remote_node), promise_result,
+    future_result, callback](
+      rclcpp::Client<rcl_interfaces::srv::ListParameters>::SharedFuture cb_f)
+    {
+      promise_result->set_value(cb_f.get()->result);
+      finish_request(weak_remote_node);
+      if (callback != nullptr) {
+        callback(future_result);
+      }
+    });
+
+  return future_result;
+}
+
+std::vector<rclcpp::ClientBase::SharedPtr>
+MultiplexedParameterClient::get_all_clients(const std::string & remote_node_name)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto remote_node = get_remote_node(remote_node_name);
+  return {
+    get_client<rcl_interfaces::srv::GetParameters>(
+      *remote_node, remote_node->get_parameters_client, parameter_service_names::get_parameters),
+    get_client<rcl_interfaces::srv::DescribeParameters>(
+      *remote_node, remote_node->describe_parameters_client,
+      parameter_service_names::describe_parameters),
+    get_client<rcl_interfaces::srv::SetParameters>(
+      *remote_node, remote_node->set_parameters_client, parameter_service_names::set_parameters),
+    get_client<rcl_interfaces::srv::ListParameters>(
+      *remote_node, remote_node->list_parameters_client,
+      parameter_service_names::list_parameters),
+  };
+}
+
+bool
+MultiplexedParameterClient::service_is_ready(const std::string & remote_node_name)
+{
+  for (const auto & client : get_all_clients(remote_node_name)) {
+    if (!client->service_is_ready()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool
+MultiplexedParameterClient::wait_for_service_nanoseconds(
+  const std::string & remote_node_name, std::chrono::nanoseconds timeout)
+{
+  // Not waiting with the lock held, the clients are kept alive by this scope
+  const auto clients = get_all_clients(remote_node_name);
+  const auto start = std::chrono::steady_clock::now();
+  for (const auto & client : clients) {
+    auto remaining = timeout;
+    if (timeout >= std::chrono::nanoseconds::zero()) {
+      remaining = std::max(
+        std::chrono::nanoseconds::zero(), timeout - (std::chrono::steady_clock::now() - start));
+    }
+    if (!client->wait_for_service(remaining)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+size_t
+MultiplexedParameterClient::get_number_of_remote_nodes() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return lru_.size();
+}
@@ -0,0 +1,269 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "rclcpp/multiplexed_parameter_service.hpp"
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "rclcpp/create_service.hpp"
+#include "rclcpp/logging.hpp"
+
+#include "./parameter_service_names.hpp"
+
+using rclcpp::MultiplexedParameterService;
+using rclcpp::node_interfaces::NodeParametersInterface;
+
+MultiplexedParameterService::MultiplexedParameterService(
+  const std::shared_ptr<rclcpp::node_interfaces::NodeBaseInterface> node_base,
+  const std::shared_ptr<rclcpp::node_interfaces::NodeServicesInterface> node_services,
+  const rclcpp::QoS & qos_profile)
+{
+  const std::string node_name = node_base->get_name();
+
+  get_parameters_service_ = create_service<rcl_interfaces::srv::GetParameters>(
+    node_base, node_services,
+    node_name + "/" + parameter_service_names::get_parameters,
+    [this](
+      const std::shared_ptr<rmw_request_id_t>,
+      const std::shared_ptr<rcl_interfaces::srv::GetParameters::Request> request,
+      std::shared_ptr<rcl_interfaces::srv::GetParameters::Response> response)
+    {
+      try {
+        for (std::string name : request->names) {
+          auto node_params = this->find_node(name);
+          if (!node_params) {
+            throw rclcpp::exceptions::ParameterNotDeclaredException(name);
+          }
+          response->values.push_back(node_params->get_parameter(name).get_value_message());
+        }
+      } catch (const rclcpp::exceptions::ParameterNotDeclaredException & ex) {
+        RCLCPP_DEBUG(rclcpp::get_logger("rclcpp"), "Failed to get parameters: %s", ex.what());
+      } catch (const rclcpp::exceptions::ParameterUninitializedException & ex) {
+        RCLCPP_DEBUG(rclcpp::get_logger("rclcpp"), "Failed to get parameters: %s", ex.what());
+      }
+    },
+    qos_profile, nullptr);
+
+  get_parameter_types_service_ = create_service<rcl_interfaces::srv::GetParameterTypes>(
+    node_base, node_services,
+    node_name + "/" + parameter_service_names::get_parameter_types,
+    [this](
+      const std::shared_ptr<rmw_request_id_t>,
+      const std::shared_ptr<rcl_interfaces::srv::GetParameterTypes::Request> request,
+      std::shared_ptr<rcl_interfaces::srv::GetParameterTypes::Response> response)
+    {
+      try {
+        for (std::string name : request->names) {
+          auto node_params = this->find_node(name);
+          if (!node_params) {
+            throw rclcpp::exceptions::ParameterNotDeclaredException(name);
+          }
+          response->types.push_back(node_params->get_parameter_types({name}).at(0));
+        }
+      } catch (const rclcpp::exceptions::ParameterNotDeclaredException & ex) {
+        RCLCPP_DEBUG(rclcpp::get_logger("rclcpp"), "Failed to get parameter types: %s", ex.what());
+        response->types.clear();
+      }
+    },
+    qos_profile, nullptr);
+
+  set_parameters_service_ = create_service<rcl_interfaces::srv::SetParameters>(
+    node_base, node_services,
+    node_name + "/" + parameter_service_names::set_parameters,
+    [this](
+      const std::shared_ptr<rmw_request_id_t>,
+      const std::shared_ptr<rcl_interfaces::srv::SetParameters::Request> request,
+      std::shared_ptr<rcl_interfaces::srv::SetParameters::Response> response)
+    {
+      // Set parameters one-by-one, since they may belong to different nodes
+      for (const auto & p : request->parameters) {
+        auto result = rcl_interfaces::msg::SetParametersResult();
+        std::string name = p.name;
+        auto node_params = this->find_node(name);
+        try {
+          if (!node_params) {
+            throw rclcpp::exceptions::ParameterNotDeclaredException(p.name);
+          }
+          result = node_params->set_parameters_atomically(
+            {rclcpp::Parameter(name, rclcpp::ParameterValue(p.value))});
+        } catch (const rclcpp::exceptions::ParameterNotDeclaredException & ex) {
+          RCLCPP_DEBUG(rclcpp::get_logger("rclcpp"), "Failed to set parameter: %s", ex.what());
+          result.successful = false;
+          result.reason = ex.what();
+        }
+        response->results.push_back(result);
+      }
+    },
+    qos_profile, nullptr);
+
+  set_parameters_atomically_service_ = create_service<rcl_interfaces::srv::SetParametersAtomically>(
+    node_base, node_services,
+    node_name + "/" + parameter_service_names::set_parameters_atomically,
+    [this](
+      const std::shared_ptr<rmw_request_id_t>,
+      const std::shared_ptr<rcl_interfaces::srv::SetParametersAtomically::Request> request,
+      std::shared_ptr<rcl_interfaces::srv::SetParametersAtomically::Response> response)
+    {
+      NodeParametersInterface::SharedPtr node_params;
+      std::vector<rclcpp::Parameter> pvariants;
+      for (const auto & p : request->parameters) {
+        std::string name = p.name;
+        auto owner = this->find_node(name);
+        if (!owner || (node_params && owner != node_params)) {
+          response->result.successful = false;
+          response->result.reason = owner ?
+            "Only parameters of the same node can be set atomically" :
+            "One or more parameters were not declared before setting";
+          return;
+        }
+        node_params = owner;
+        pvariants.emplace_back(name, rclcpp::ParameterValue(p.value));
+      }
+      if (!node_params) {
+        response->result.successful = true;
+        return;
+      }
+      try {
+        response->result = node_params->set_parameters_atomically(pvariants);
+      } catch (const rclcpp::exceptions::ParameterNotDeclaredException & ex) {
+        RCLCPP_DEBUG(
+          rclcpp::get_logger("rclcpp"), "Failed to set parameters atomically: %s", ex.what());
+        response->result.successful = false;
+        response->result.reason = "One or more parameters were not declared before setting";
+      }
+    },
+    qos_profile, nullptr);
+
+  describe_parameters_service_ = create_service<rcl_interfaces::srv::DescribeParameters>(
+    node_base, node_services,
+    node_name + "/" + parameter_service_names::describe_parameters,
+    [this](
+      const std::shared_ptr<rmw_request_id_t>,
+      const std::shared_ptr<rcl_interfaces::srv::DescribeParameters::Request> request,
+      std::shared_ptr<rcl_interfaces::srv::DescribeParameters::Response> response)
+    {
+      try {
+        for (const auto & full_name : request->names) {
+          std::string name = full_name;
+          auto node_params = this->find_node(name);
+          if (!node_params) {
+            throw rclcpp::exceptions::ParameterNotDeclaredException(full_name);
+          }
+          auto descriptor = node_params->describe_parameters({name}).at(0);
+          descriptor.name = full_name;
+          response->descriptors.push_back(descriptor);
+        }
+      } catch (const rclcpp::exceptions::ParameterNotDeclaredException & ex) {
+        RCLCPP_DEBUG(rclcpp::get_logger("rclcpp"), "Failed to describe parameters: %s", ex.what());
+        response->descriptors.clear();
+      }
+    },
+    qos_profile, nullptr);
+
+  list_parameters_service_ = create_service<rcl_interfaces::srv::ListParameters>(
+    node_base, node_services,
+    node_name + "/" + parameter_service_names::list_parameters,
+    [this](
+      const std::shared_ptr<rmw_request_id_t>,
+      const std::shared_ptr<rcl_interfaces::srv::ListParameters::Request> request,
+      std::shared_ptr<rcl_interfaces::srv::ListParameters::Response> response)
+    {
+      std::map<std::string, NodeParametersInterface::WeakPtr> nodes;
+      {
+        std::lock_guard<std::mutex> lock(nodes_mutex_);
+        nodes = nodes_;
+      }
+      for (const auto & [fully_qualified_name, weak_node_params] : nodes) {
+        auto node_params = weak_node_params.lock();
+        if (!node_params) {
+          continue;
+        }
+        const std::string node_prefix = fully_qualified_name + separator;
+        // Strip the name of the node from the prefixes of its parameters
+        bool list_all = request->prefixes.empty();
+        std::vector<std::string> prefixes;
+        for (const auto & prefix : request->prefixes) {
+          if (prefix.size() <= node_prefix.size()) {
+            list_all |= 0 == node_prefix.compare(0, prefix.size(), prefix);
+          } else if (0 == prefix.compare(0, node_prefix.size(), node_prefix)) {
+            prefixes.push_back(prefix.substr(node_prefix.size()));
+          }
+        }
+        if (list_all) {
+          prefixes.clear();
+        } else if (prefixes.empty()) {
+          continue;
+        }
+        auto result = node_params->list_parameters(prefixes, request->depth);
+        for (const auto & name : result.names) {
+          response->result.names.push_back(node_prefix + name);
+        }
+        for (const auto & prefix : result.prefixes) {
+          response->result.prefixes.push_back(node_prefix + prefix);
+        }
+      }
+    },
+    qos_profile, nullptr);
+}
+
+void
+MultiplexedParameterService::add_node(
+  const std::string & fully_qualified_name,
+  NodeParametersInterface::SharedPtr node_parameters)
+{
+  if (!node_parameters) {
+    throw std::invalid_argument("node parameters interface cannot be nullptr");
+  }
+  std::lock_guard<std::mutex> lock(nodes_mutex_);
+  auto it = nodes_.find(fully_qualified_name);
+  if (it != nodes_.end() && !it->second.expired()) {
+    throw std::invalid_argument(
+            "the parameters of node '" + fully_qualified_name + "' are already served");
+  }
+  nodes_[fully_qualified_name] = node_parameters;
+}
+
+bool
+MultiplexedParameterService::remove_node(const std::string & fully_qualified_name)
+{
+  std::lock_guard<std::mutex> lock(nodes_mutex_);
+  return nodes_.erase(fully_qualified_name) > 0;
+}
+
+NodeParametersInterface::SharedPtr
+MultiplexedParameterService::find_node(std::string & name)
+{
+  const size_t separator_pos = name.find(separator);
+  if (std::string::npos == separator_pos) {
+    return nullptr;
+  }
+  std::lock_guard<std::mutex> lock(nodes_mutex_);
+  auto it = nodes_.find(name.substr(0, separator_pos));
+  if (it == nodes_.end()) {
+    return nullptr;
+  }
+  auto node_params = it->second.lock();
+  if (!node_params) {
+    nodes_.erase(it);
+    return nullptr;
+  }
+  name.erase(0, separator_pos + 1);
+  return node_params;
+}
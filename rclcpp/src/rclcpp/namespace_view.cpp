@@ -0,0 +1,65 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rclcpp/namespace_view.hpp"
+
+#include <string>
+#include <utility>
+
+#include "./detail/sub_namespace.hpp"
+
+using rclcpp::NamespaceView;
+
+NamespaceView::NamespaceView(rclcpp::Node::SharedPtr node, std::string sub_namespace)
+: node_(std::move(node)), sub_namespace_(std::move(sub_namespace))
+{}
+
+const rclcpp::Node::SharedPtr &
+NamespaceView::get_node() const
+{
+  return node_;
+}
+
+std::string
+NamespaceView::get_sub_namespace() const
+{
+  return rclcpp::detail::extend_sub_namespace(node_->get_sub_namespace(), sub_namespace_);
+}
+
+std::string
+NamespaceView::get_effective_namespace() const
+{
+  return rclcpp::detail::create_effective_namespace(
+    node_->get_effective_namespace(), sub_namespace_);
+}
+
+NamespaceView
+NamespaceView::create_namespace_view(const std::string & sub_namespace) const
+{
+  std::string extended_sub_namespace =
+    rclcpp::detail::extend_sub_namespace(sub_namespace_, sub_namespace);
+  rclcpp::detail::validate_effective_namespace(
+    rclcpp::detail::create_effective_namespace(
+      node_->get_effective_namespace(), extended_sub_namespace));
+  return NamespaceView(node_, std::move(extended_sub_namespace));
+}
+
+std::string
+NamespaceView::extend_name(const std::string & name) const
+{
+  if (name.empty() || name.front() == '/' || name.front() == '~') {
+    return name;
+  }
+  return sub_namespace_ + "/" + name;
+}
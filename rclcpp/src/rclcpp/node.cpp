@@ -26,6 +26,7 @@
 #include "rclcpp/detail/qos_parameters.hpp"
 #include "rclcpp/exceptions.hpp"
 #include "rclcpp/graph_listener.hpp"
+#include "rclcpp/namespace_view.hpp"
 #include "rclcpp/node.hpp"
 #include "rclcpp/node_interfaces/node_base.hpp"
 #include "rclcpp/node_interfaces/node_clock.hpp"
@@ -40,75 +41,14 @@
 #include "rclcpp/node_interfaces/node_waitables.hpp"
 #include "rclcpp/qos_overriding_options.hpp"
 
-#include "rmw/validate_namespace.h"
-
 #include "./detail/resolve_parameter_overrides.hpp"
+#include "./detail/sub_namespace.hpp"
 
 using rclcpp::Node;
 using rclcpp::NodeOptions;
-using rclcpp::exceptions::throw_from_rcl_error;
-
-namespace
-{
-
-RCLCPP_LOCAL
-std::string
-extend_sub_namespace(const std::string & existing_sub_namespace, const std::string & extension)
-{
-  // Assumption is that the existing_sub_namespace does not need checking
-  // because it would be checked already when it was set with this function.
-
-  if (extension.empty()) {
-    throw rclcpp::exceptions::NameValidationError(
-            "sub_namespace",
-            extension.c_str(),
-            "sub-nodes should not extend nodes by an empty sub-namespace",
-            0);
-  } else if (extension.front() == '/') {
-    // check if the new sub-namespace extension is absolute
-    throw rclcpp::exceptions::NameValidationError(
-            "sub_namespace",
-            extension.c_str(),
-            "a sub-namespace should not have a leading /",
-            0);
-  }
-
-  std::string new_sub_namespace;
-  if (existing_sub_namespace.empty()) {
-    new_sub_namespace = extension;
-  } else {
-    new_sub_namespace = existing_sub_namespace + "/" + extension;
-  }
-
-  // remove any trailing `/` so that new extensions do not result in `//`
-  if (new_sub_namespace.back() == '/') {
-    new_sub_namespace = new_sub_namespace.substr(0, new_sub_namespace.size() - 1);
-  }
-
-  return new_sub_namespace;
-}
-
-RCLCPP_LOCAL
-std::string
-create_effective_namespace(const std::string & node_namespace, const std::string & sub_namespace)
-{
-  // Assumption is that both the node_namespace and sub_namespace are conforming
-  // and do not need trimming of `/` and other things, as they were validated
-  // in other functions already.
-
-  // A node may not have a sub_namespace if it is no sub_node. In this case,
-  // just return the original namespace
-  if (sub_namespace.empty()) {
-    return node_namespace;
-  } else if (node_namespace.back() == '/') {
-    // this is the special case where node_namespace is just `/`
-    return node_namespace + sub_namespace;
-  } else {
-    return node_namespace + "/" + sub_namespace;
-  }
-}
-
-}  // namespace
+using rclcpp::detail::create_effective_namespace;
+using rclcpp::detail::extend_sub_namespace;
+using rclcpp::detail::validate_effective_namespace;
 
 /// Internal implementation to provide hidden and API/ABI stable changes to the Node.
 /**
@@ -140,18 +80,17 @@ get_parameter_events_qos(
   const rclcpp::NodeOptions & options)
 {
   auto final_qos = options.parameter_event_qos();
-  const rcl_arguments_t * global_args = nullptr;
+  rclcpp::Context * global_context = nullptr;
   auto * rcl_options = options.get_rcl_node_options();
   if (rcl_options->use_global_arguments) {
-    auto context_ptr = node_base.get_context()->get_rcl_context();
-    global_args = &(context_ptr->global_arguments);
+    global_context = node_base.get_context().get();
   }
 
   auto parameter_overrides = rclcpp::detail::resolve_parameter_overrides(
     node_base.get_fully_qualified_name(),
     options.parameter_overrides(),
     &rcl_options->arguments,
-    global_args);
+    global_context);
 
   auto final_topic_name = node_base.resolve_topic_or_service_name("/parameter_events", false);
   auto prefix = "qos_overrides." + final_topic_name + ".";
@@ -186,7 +125,8 @@ Node::Node(
   node_graph_(new rclcpp::node_interfaces::NodeGraph(node_base_.get())),
   node_logging_(new rclcpp::node_interfaces::NodeLogging(node_base_)),
   node_timers_(new rclcpp::node_interfaces::NodeTimers(node_base_.get())),
-  node_topics_(new rclcpp::node_interfaces::NodeTopics(node_base_.get(), node_timers_.get())),
+  node_topics_(new rclcpp::node_interfaces::NodeTopics(
+      node_base_.get(), node_timers_.get(), options.aggregate_event_handlers())),
   node_services_(new rclcpp::node_interfaces::NodeServices(node_base_.get())),
   node_clock_(new rclcpp::node_interfaces::NodeClock(
       node_base_,
@@ -210,7 +150,9 @@ Node::Node(
       get_parameter_events_qos(*node_base_, options),
       options.parameter_event_publisher_options(),
       options.allow_undeclared_parameters(),
-      options.automatically_declare_parameters_from_overrides()
+      options.automatically_declare_parameters_from_overrides(),
+      node_timers_,
+      options.parameter_event_coalescing_period()
     )),
   node_time_source_(new rclcpp::node_interfaces::NodeTimeSource(
       node_base_,
@@ -221,13 +163,16 @@ Node::Node(
       node_clock_,
       node_parameters_,
       options.clock_qos(),
-      options.use_clock_thread()
+      options.use_clock_thread(),
+      options.use_shared_clock_subscription()
     )),
   node_type_descriptions_(new rclcpp::node_interfaces::NodeTypeDescriptions(
       node_base_,
       node_logging_,
       node_parameters_,
-      node_services_
+      node_services_,
+      options.start_type_description_service(),
+      options.share_type_description_service()
     )),
   node_waitables_(new rclcpp::node_interfaces::NodeWaitables(node_base_.get())),
   node_options_(options),
@@ -272,25 +217,7 @@ Node::Node(
   effective_namespace_(create_effective_namespace(other.get_namespace(), sub_namespace_)),
   hidden_impl_(other.hidden_impl_)
 {
-  // Validate new effective namespace.
-  int validation_result;
-  size_t invalid_index;
-  rmw_ret_t rmw_ret =
-    rmw_validate_namespace(effective_namespace_.c_str(), &validation_result, &invalid_index);
-
-  if (rmw_ret != RMW_RET_OK) {
-    if (rmw_ret == RMW_RET_INVALID_ARGUMENT) {
-      throw_from_rcl_error(RCL_RET_INVALID_ARGUMENT, "failed to validate subnode namespace");
-    }
-    throw_from_rcl_error(RCL_RET_ERROR, "failed to validate subnode namespace");
-  }
-
-  if (validation_result != RMW_NAMESPACE_VALID) {
-    throw rclcpp::exceptions::InvalidNamespaceError(
-            effective_namespace_.c_str(),
-            rmw_namespace_validation_result_string(validation_result),
-            invalid_index);
-  }
+  validate_effective_namespace(effective_namespace_);
 }
 
 Node::~Node()
@@ -409,6 +336,12 @@ Node::get_parameter(const std::string & name, rclcpp::Parameter & parameter) con
   return node_parameters_->get_parameter(name, parameter);
 }
 
+rclcpp::node_interfaces::ParameterHandle::SharedPtr
+Node::get_parameter_handle(const std::string & name)
+{
+  return node_parameters_->get_parameter_handle(name);
+}
+
 std::vector<rclcpp::Parameter>
 Node::get_parameters(
   const std::vector<std::string> & names) const
@@ -671,6 +604,15 @@ Node::create_sub_node(const std::string & sub_namespace)
   return std::shared_ptr<Node>(new Node(*this, sub_namespace));
 }
 
+rclcpp::NamespaceView
+Node::create_namespace_view(const std::string & sub_namespace)
+{
+  std::string view_sub_namespace = extend_sub_namespace("", sub_namespace);
+  validate_effective_namespace(
+    create_effective_namespace(effective_namespace_, view_sub_namespace));
+  return rclcpp::NamespaceView(shared_from_this(), std::move(view_sub_namespace));
+}
+
 const NodeOptions &
 Node::get_node_options() const
 {
@@ -24,6 +24,7 @@
 #include "rcl/logging.h"
 #include "rcl/logging_rosout.h"
 #include "rclcpp/exceptions.hpp"
+#include "rclcpp/executors/single_threaded_executor.hpp"
 #include "rcutils/logging_macros.h"
 #include "rmw/validate_namespace.h"
 #include "rmw/validate_node_name.h"
@@ -324,6 +325,15 @@ std::string
 NodeBase::resolve_topic_or_service_name(
   const std::string & name, bool is_service, bool only_expand) const
 {
+  auto & resolved_names = resolved_names_[(is_service ? 1 : 0) + (only_expand ? 2 : 0)];
+  {
+    std::lock_guard<std::mutex> lock(resolved_names_mutex_);
+    auto it = resolved_names.find(name);
+    if (it != resolved_names.end()) {
+      return it->second;
+    }
+  }
+
   char * output_cstr = NULL;
   auto allocator = rcl_get_default_allocator();
   rcl_ret_t ret = rcl_node_resolve_name(
@@ -338,5 +348,30 @@ NodeBase::resolve_topic_or_service_name(
   }
   std::string output{output_cstr};
   allocator.deallocate(output_cstr, allocator.state);
+
+  std::lock_guard<std::mutex> lock(resolved_names_mutex_);
+  resolved_names.emplace(name, output);
   return output;
 }
+
+void
+NodeBase::clear_resolved_names()
+{
+  std::lock_guard<std::mutex> lock(resolved_names_mutex_);
+  for (auto & resolved_names : resolved_names_) {
+    resolved_names.clear();
+  }
+}
+
+std::shared_ptr<rclcpp::executors::SingleThreadedExecutor>
+NodeBase::get_spin_executor()
+{
+  auto rcl_context = rclcpp::contexts::get_global_default_context()->get_rcl_context();
+  std::lock_guard<std::mutex> lock(spin_executor_mutex_);
+  if (!spin_executor_ || spin_executor_rcl_context_.lock() != rcl_context) {
+    // The guard conditions of a previous executor belong to a finalized rcl context
+    spin_executor_ = std::make_shared<rclcpp::executors::SingleThreadedExecutor>();
+    spin_executor_rcl_context_ = rcl_context;
+  }
+  return spin_executor_;
+}
@@ -40,7 +40,9 @@ NodeGraph::NodeGraph(rclcpp::node_interfaces::NodeBaseInterface * node_base)
     node_base->get_context()->get_sub_context<GraphListener>(node_base->get_context())
   ),
   should_add_to_graph_listener_(true),
-  graph_users_count_(0)
+  graph_users_count_(0),
+  graph_generation_(0),
+  graph_cache_enabled_(false)
 {}
 
 NodeGraph::~NodeGraph()
@@ -54,14 +56,15 @@ NodeGraph::~NodeGraph()
   }
 }
 
+static
 std::map<std::string, std::vector<std::string>>
-NodeGraph::get_topic_names_and_types(bool no_demangle) const
+get_topic_names_and_types_from_rcl(const rcl_node_t * rcl_node_handle, bool no_demangle)
 {
   rcl_names_and_types_t topic_names_and_types = rcl_get_zero_initialized_names_and_types();
 
   rcl_allocator_t allocator = rcl_get_default_allocator();
   auto ret = rcl_get_topic_names_and_types(
-    node_base_->get_rcl_node_handle(),
+    rcl_node_handle,
     &allocator,
     no_demangle,
     &topic_names_and_types);
@@ -96,6 +99,22 @@ NodeGraph::get_topic_names_and_types(bool no_demangle) const
   return topics_and_types;
 }
 
+std::map<std::string, std::vector<std::string>>
+NodeGraph::get_topic_names_and_types(bool no_demangle) const
+{
+  if (!graph_cache_enabled_) {
+    return get_topic_names_and_types_from_rcl(node_base_->get_rcl_node_handle(), no_demangle);
+  }
+  std::lock_guard<std::mutex> cache_lock(graph_cache_mutex_);
+  this->validate_graph_cache();
+  auto & topic_names_and_types = graph_cache_.topic_names_and_types[no_demangle ? 1 : 0];
+  if (!topic_names_and_types) {
+    topic_names_and_types = get_topic_names_and_types_from_rcl(
+      node_base_->get_rcl_node_handle(), no_demangle);
+  }
+  return *topic_names_and_types;
+}
+
 std::map<std::string, std::vector<std::string>>
 NodeGraph::get_service_names_and_types() const
 {
@@ -392,8 +411,9 @@ NodeGraph::get_node_names_with_enclaves() const
   return node_tuples;
 }
 
+static
 std::vector<std::pair<std::string, std::string>>
-NodeGraph::get_node_names_and_namespaces() const
+get_node_names_and_namespaces_from_rcl(const rcl_node_t * rcl_node_handle)
 {
   rcutils_string_array_t node_names_c =
     rcutils_get_zero_initialized_string_array();
@@ -402,7 +422,7 @@ NodeGraph::get_node_names_and_namespaces() const
 
   auto allocator = rcl_get_default_allocator();
   auto ret = rcl_get_node_names(
-    node_base_->get_rcl_node_handle(),
+    rcl_node_handle,
     allocator,
     &node_names_c,
     &node_namespaces_c);
@@ -454,6 +474,21 @@ NodeGraph::get_node_names_and_namespaces() const
   return node_names;
 }
 
+std::vector<std::pair<std::string, std::string>>
+NodeGraph::get_node_names_and_namespaces() const
+{
+  if (!graph_cache_enabled_) {
+    return get_node_names_and_namespaces_from_rcl(node_base_->get_rcl_node_handle());
+  }
+  std::lock_guard<std::mutex> cache_lock(graph_cache_mutex_);
+  this->validate_graph_cache();
+  if (!graph_cache_.node_names_and_namespaces) {
+    graph_cache_.node_names_and_namespaces =
+      get_node_names_and_namespaces_from_rcl(node_base_->get_rcl_node_handle());
+  }
+  return *graph_cache_.node_names_and_namespaces;
+}
+
 size_t
 NodeGraph::count_publishers(const std::string & topic_name) const
 {
@@ -465,6 +500,16 @@ NodeGraph::count_publishers(const std::string & topic_name) const
     rcl_node_get_namespace(rcl_node_handle),
     false);    // false = not a service
 
+  std::unique_lock<std::mutex> cache_lock(graph_cache_mutex_, std::defer_lock);
+  if (graph_cache_enabled_) {
+    cache_lock.lock();
+    this->validate_graph_cache();
+    auto it = graph_cache_.publisher_counts.find(fqdn);
+    if (it != graph_cache_.publisher_counts.end()) {
+      return it->second;
+    }
+  }
+
   size_t count;
   auto ret = rcl_count_publishers(rcl_node_handle, fqdn.c_str(), &count);
   if (ret != RMW_RET_OK) {
@@ -473,6 +518,9 @@ NodeGraph::count_publishers(const std::string & topic_name) const
       std::string("could not count publishers: ") + rmw_get_error_string().str);
     // *INDENT-ON*
   }
+  if (cache_lock.owns_lock()) {
+    graph_cache_.publisher_counts.emplace(std::move(fqdn), count);
+  }
   return count;
 }
 
@@ -487,6 +535,16 @@ NodeGraph::count_subscribers(const std::string & topic_name) const
     rcl_node_get_namespace(rcl_node_handle),
     false);    // false = not a service
 
+  std::unique_lock<std::mutex> cache_lock(graph_cache_mutex_, std::defer_lock);
+  if (graph_cache_enabled_) {
+    cache_lock.lock();
+    this->validate_graph_cache();
+    auto it = graph_cache_.subscriber_counts.find(fqdn);
+    if (it != graph_cache_.subscriber_counts.end()) {
+      return it->second;
+    }
+  }
+
   size_t count;
   auto ret = rcl_count_subscribers(rcl_node_handle, fqdn.c_str(), &count);
   if (ret != RMW_RET_OK) {
@@ -495,6 +553,9 @@ NodeGraph::count_subscribers(const std::string & topic_name) const
       std::string("could not count subscribers: ") + rmw_get_error_string().str);
     // *INDENT-ON*
   }
+  if (cache_lock.owns_lock()) {
+    graph_cache_.subscriber_counts.emplace(std::move(fqdn), count);
+  }
   return count;
 }
 
@@ -551,6 +612,8 @@ NodeGraph::get_graph_guard_condition() const
 void
 NodeGraph::notify_graph_change()
 {
+  // Invalidate the cached graph queries, they are refreshed the next time they are used
+  graph_generation_++;
   {
     std::lock_guard<std::mutex> graph_changed_lock(graph_mutex_);
     bool bad_ptr_encountered = false;
@@ -583,6 +646,7 @@ NodeGraph::notify_graph_change()
     throw std::runtime_error(
             std::string("failed to notify wait set on graph change: ") + ex.what());
   }
+  dispatch_graph_changes();
 }
 
 void
@@ -647,6 +711,167 @@ NodeGraph::count_graph_users() const
   return graph_users_count_.load();
 }
 
+void
+NodeGraph::set_graph_cache_enabled(bool enabled)
+{
+  rclcpp::Event::SharedPtr graph_cache_event;
+  if (enabled) {
+    // Holding a graph event makes the graph listener notify this node of graph changes
+    graph_cache_event = this->get_graph_event();
+  }
+  std::lock_guard<std::mutex> cache_lock(graph_cache_mutex_);
+  graph_cache_event_ = graph_cache_event;
+  graph_cache_ = GraphCache();
+  graph_cache_.generation = graph_generation_.load();
+  graph_cache_enabled_ = enabled;
+}
+
+bool
+NodeGraph::is_graph_cache_enabled() const
+{
+  return graph_cache_enabled_.load();
+}
+
+uint64_t
+NodeGraph::get_graph_generation() const
+{
+  return graph_generation_.load();
+}
+
+void
+NodeGraph::validate_graph_cache() const
+{
+  uint64_t generation = graph_generation_.load();
+  if (graph_cache_.generation != generation) {
+    graph_cache_ = GraphCache();
+    graph_cache_.generation = generation;
+  }
+}
+
+rclcpp::GraphChangeCallbackHandle::SharedPtr
+NodeGraph::add_graph_change_callback(
+  rclcpp::GraphChangeCallbackHandle::GraphChangeCallbackType callback)
+{
+  auto handle = std::make_shared<rclcpp::GraphChangeCallbackHandle>();
+  handle->callback = callback;
+  // Got without holding graph_change_mutex_, which the graph listener locks when notifying
+  auto graph_change_event = this->get_graph_event();
+  std::lock_guard<std::mutex> lock(graph_change_mutex_);
+  if (!graph_change_event_) {
+    // The changes are reported from the graph as it is when the first callback is added
+    graph_change_event_ = graph_change_event;
+    graph_snapshot_ = take_graph_snapshot();
+  }
+  graph_change_callbacks_.emplace_back(handle);
+  return handle;
+}
+
+void
+NodeGraph::remove_graph_change_callback(const rclcpp::GraphChangeCallbackHandle * const handle)
+{
+  std::lock_guard<std::mutex> lock(graph_change_mutex_);
+  auto it = std::find_if(
+    graph_change_callbacks_.begin(),
+    graph_change_callbacks_.end(),
+    [handle](const auto & weak_handle) {
+      return handle == weak_handle.lock().get();
+    });
+  if (it == graph_change_callbacks_.end()) {
+    throw std::runtime_error("Graph change callback doesn't exist");
+  }
+  graph_change_callbacks_.erase(it);
+  if (graph_change_callbacks_.empty()) {
+    graph_change_event_.reset();
+    graph_snapshot_ = GraphSnapshot();
+  }
+}
+
+NodeGraph::GraphSnapshot
+NodeGraph::take_graph_snapshot() const
+{
+  GraphSnapshot snapshot;
+  for (auto & node_name : get_node_names()) {
+    snapshot.nodes.emplace(std::move(node_name), std::vector<std::string>());
+  }
+  snapshot.topics = get_topic_names_and_types(false);
+  snapshot.services = get_service_names_and_types();
+  return snapshot;
+}
+
+static
+void
+diff_names_and_types(
+  const std::map<std::string, std::vector<std::string>> & before,
+  const std::map<std::string, std::vector<std::string>> & after,
+  rclcpp::GraphChange::Kind added_kind,
+  rclcpp::GraphChange::Kind removed_kind,
+  std::vector<rclcpp::GraphChange> & changes)
+{
+  // Both maps are sorted by name, so they are walked together
+  auto before_it = before.begin();
+  auto after_it = after.begin();
+  while (before_it != before.end() || after_it != after.end()) {
+    if (after_it == after.end() ||
+      (before_it != before.end() && before_it->first < after_it->first))
+    {
+      changes.push_back({removed_kind, before_it->first, before_it->second});
+      ++before_it;
+    } else if (before_it == before.end() || after_it->first < before_it->first) {
+      changes.push_back({added_kind, after_it->first, after_it->second});
+      ++after_it;
+    } else {
+      if (before_it->second != after_it->second) {
+        changes.push_back({removed_kind, before_it->first, before_it->second});
+        changes.push_back({added_kind, after_it->first, after_it->second});
+      }
+      ++before_it;
+      ++after_it;
+    }
+  }
+}
+
+void
+NodeGraph::dispatch_graph_changes()
+{
+  std::vector<rclcpp::GraphChangeCallbackHandle::SharedPtr> callbacks;
+  std::vector<rclcpp::GraphChange> changes;
+  {
+    std::lock_guard<std::mutex> lock(graph_change_mutex_);
+    for (auto it = graph_change_callbacks_.begin(); it != graph_change_callbacks_.end(); ) {
+      auto handle = it->lock();
+      if (handle) {
+        callbacks.push_back(std::move(handle));
+        ++it;
+      } else {
+        it = graph_change_callbacks_.erase(it);
+      }
+    }
+    if (callbacks.empty()) {
+      // Stop monitoring the graph once all the handles were dropped
+      graph_change_event_.reset();
+      graph_snapshot_ = GraphSnapshot();
+      return;
+    }
+    GraphSnapshot snapshot = take_graph_snapshot();
+    using Kind = rclcpp::GraphChange::Kind;
+    diff_names_and_types(
+      graph_snapshot_.nodes, snapshot.nodes, Kind::NodeAdded, Kind::NodeRemoved, changes);
+    diff_names_and_types(
+      graph_snapshot_.topics, snapshot.topics, Kind::TopicAdded, Kind::TopicRemoved, changes);
+    diff_names_and_types(
+      graph_snapshot_.services, snapshot.services, Kind::ServiceAdded, Kind::ServiceRemoved,
+      changes);
+    graph_snapshot_ = std::move(snapshot);
+  }
+  if (changes.empty()) {
+    return;
+  }
+  // Called without holding the lock, so that the callbacks can add or remove callbacks
+  for (const auto & handle : callbacks) {
+    handle->callback(changes);
+  }
+}
+
 static
 std::vector<rclcpp::TopicEndpointInfo>
 convert_to_topic_info_list(const rcl_topic_endpoint_info_array_t & info_array)
@@ -16,7 +16,9 @@
 
 #include <rcl_yaml_param_parser/parser.h>
 
+#include <algorithm>
 #include <array>
+#include <chrono>
 #include <cmath>
 #include <cstdlib>
 #include <cstring>
@@ -25,12 +27,14 @@
 #include <map>
 #include <memory>
 #include <sstream>
+#include <stdexcept>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "rcl_interfaces/srv/list_parameters.hpp"
 #include "rclcpp/create_publisher.hpp"
+#include "rclcpp/create_timer.hpp"
 #include "rclcpp/parameter_map.hpp"
 #include "rcutils/logging_macros.h"
 #include "rmw/qos_profiles.h"
@@ -45,23 +49,23 @@ local_perform_automatically_declare_parameters_from_overrides(
   const std::map<std::string, rclcpp::ParameterValue> & parameter_overrides,
   std::function<bool(const std::string &)> has_parameter,
   std::function<void(
-    const std::string &,
-    const rclcpp::ParameterValue &,
-    const rcl_interfaces::msg::ParameterDescriptor &,
+    const std::vector<std::pair<rclcpp::Parameter, rcl_interfaces::msg::ParameterDescriptor>> &,
     bool)>
-  declare_parameter)
+  declare_parameters)
 {
   rcl_interfaces::msg::ParameterDescriptor descriptor;
   descriptor.dynamic_typing = true;
+  // Declare all of them at once, so that large configurations don't cost one
+  // callback round and one parameter event per parameter.
+  std::vector<std::pair<rclcpp::Parameter, rcl_interfaces::msg::ParameterDescriptor>> parameters;
   for (const auto & pair : parameter_overrides) {
     if (!has_parameter(pair.first)) {
-      declare_parameter(
-        pair.first,
-        pair.second,
-        descriptor,
-        true);
+      parameters.emplace_back(rclcpp::Parameter(pair.first, pair.second), descriptor);
     }
   }
+  if (!parameters.empty()) {
+    declare_parameters(parameters, true);
+  }
 }
 
 NodeParameters::NodeParameters(
@@ -77,6 +81,38 @@ NodeParameters::NodeParameters(
   const rclcpp::PublisherOptionsBase & parameter_event_publisher_options,
   bool allow_undeclared_parameters,
   bool automatically_declare_parameters_from_overrides)
+: NodeParameters(
+    node_base,
+    node_logging,
+    node_topics,
+    node_services,
+    node_clock,
+    parameter_overrides,
+    start_parameter_services,
+    start_parameter_event_publisher,
+    parameter_event_qos,
+    parameter_event_publisher_options,
+    allow_undeclared_parameters,
+    automatically_declare_parameters_from_overrides,
+    nullptr,
+    std::chrono::milliseconds(0))
+{}
+
+NodeParameters::NodeParameters(
+  const rclcpp::node_interfaces::NodeBaseInterface::SharedPtr node_base,
+  const rclcpp::node_interfaces::NodeLoggingInterface::SharedPtr node_logging,
+  rclcpp::node_interfaces::NodeTopicsInterface::SharedPtr node_topics,
+  const rclcpp::node_interfaces::NodeServicesInterface::SharedPtr node_services,
+  const rclcpp::node_interfaces::NodeClockInterface::SharedPtr node_clock,
+  const std::vector<rclcpp::Parameter> & parameter_overrides,
+  bool start_parameter_services,
+  bool start_parameter_event_publisher,
+  const rclcpp::QoS & parameter_event_qos,
+  const rclcpp::PublisherOptionsBase & parameter_event_publisher_options,
+  bool allow_undeclared_parameters,
+  bool automatically_declare_parameters_from_overrides,
+  const rclcpp::node_interfaces::NodeTimersInterface::SharedPtr node_timers,
+  std::chrono::milliseconds parameter_event_coalescing_period)
 : allow_undeclared_(allow_undeclared_parameters),
   events_publisher_(nullptr),
   node_logging_(node_logging),
@@ -103,6 +139,20 @@ NodeParameters::NodeParameters(
       publisher_options);
   }
 
+  if (nullptr != events_publisher_ && parameter_event_coalescing_period.count() > 0) {
+    if (nullptr == node_timers) {
+      throw std::invalid_argument("node_timers is needed to coalesce parameter events");
+    }
+    // The timer is only started when a change is made.
+    parameter_event_coalescing_timer_ = rclcpp::create_wall_timer(
+      parameter_event_coalescing_period,
+      [this]() {this->publish_pending_parameter_event();},
+      nullptr,
+      node_base.get(),
+      node_timers.get(),
+      false);
+  }
+
   // Get the node options
   const rcl_node_t * node = node_base->get_rcl_node_handle();
   if (nullptr == node) {
@@ -113,15 +163,14 @@ NodeParameters::NodeParameters(
     throw std::runtime_error("Need valid node options in NodeParameters");
   }
 
-  const rcl_arguments_t * global_args = nullptr;
+  rclcpp::Context * global_context = nullptr;
   if (options->use_global_arguments) {
-    auto context_ptr = node_base->get_context()->get_rcl_context();
-    global_args = &(context_ptr->global_arguments);
+    global_context = node_base->get_context().get();
   }
   combined_name_ = node_base->get_fully_qualified_name();
 
   parameter_overrides_ = rclcpp::detail::resolve_parameter_overrides(
-    combined_name_, parameter_overrides, &options->arguments, global_args);
+    combined_name_, parameter_overrides, &options->arguments, global_context);
 
   // If asked, initialize any parameters that ended up in the initial parameter values,
   // but did not get declared explcitily by this point.
@@ -130,15 +179,7 @@ NodeParameters::NodeParameters(
     local_perform_automatically_declare_parameters_from_overrides(
       this->get_parameter_overrides(),
       std::bind(&NodeParameters::has_parameter, this, _1),
-      [this](
-        const std::string & name,
-        const rclcpp::ParameterValue & default_value,
-        const rcl_interfaces::msg::ParameterDescriptor & parameter_descriptor,
-        bool ignore_override)
-      {
-        NodeParameters::declare_parameter(
-          name, default_value, parameter_descriptor, ignore_override);
-      }
+      std::bind(&NodeParameters::declare_parameters, this, _1, _2)
     );
   }
 }
@@ -152,19 +193,22 @@ NodeParameters::perform_automatically_declare_parameters_from_overrides()
       return this->has_parameter(name);
     },
     [this](
-      const std::string & name,
-      const rclcpp::ParameterValue & default_value,
-      const rcl_interfaces::msg::ParameterDescriptor & parameter_descriptor,
+      const std::vector<
+        std::pair<rclcpp::Parameter, rcl_interfaces::msg::ParameterDescriptor>
+      > & parameters,
       bool ignore_override)
     {
-      this->declare_parameter(
-        name, default_value, parameter_descriptor, ignore_override);
+      this->declare_parameters(parameters, ignore_override);
     }
   );
 }
 
 NodeParameters::~NodeParameters()
-{}
+{
+  if (parameter_event_coalescing_timer_) {
+    parameter_event_coalescing_timer_->cancel();
+  }
+}
 
 RCLCPP_LOCAL
 bool
@@ -416,11 +460,12 @@ __set_parameters_atomically_common(
   }
   // If accepted, actually set the values.
   if (result.successful) {
-    for (size_t i = 0; i < parameters.size(); ++i) {
-      const std::string & name = parameters[i].get_name();
-      parameter_infos[name].descriptor.name = parameters[i].get_name();
-      parameter_infos[name].descriptor.type = parameters[i].get_type();
-      parameter_infos[name].value = parameters[i].get_parameter_value();
+    for (const auto & parameter : parameters) {
+      // The only copy of the value made to set it
+      auto & parameter_info = parameter_infos[parameter.get_name()];
+      parameter_info.descriptor.name = parameter.get_name();
+      parameter_info.descriptor.type = parameter.get_type();
+      parameter_info.value = parameter.get_parameter_value();
     }
     // Call the user post set parameter callback
     __call_post_set_parameters_callbacks(parameters, post_set_callback_container);
@@ -484,7 +529,7 @@ __declare_parameter_common(
   }
 
   // Add declared parameters to storage.
-  parameters_out[name] = parameter_infos.at(name);
+  parameters_out[name] = std::move(parameter_infos.at(name));
 
   // Extend the given parameter event, if valid.
   if (parameter_event_out) {
@@ -494,6 +539,26 @@ __declare_parameter_common(
   return result;
 }
 
+[[noreturn]]
+static
+void
+__throw_declare_parameter_failure(
+  const std::string & name,
+  const rcl_interfaces::msg::SetParametersResult & result)
+{
+  constexpr const char type_error_msg_start[] = "Wrong parameter type";
+  if (
+    0u == std::strncmp(
+      result.reason.c_str(), type_error_msg_start, sizeof(type_error_msg_start) - 1))
+  {
+    // TODO(ivanpauno): Refactor the logic so we don't need the above `strncmp` and we can
+    // detect between both exceptions more elegantly.
+    throw rclcpp::exceptions::InvalidParameterTypeException(name, result.reason);
+  }
+  throw rclcpp::exceptions::InvalidParameterValueException(
+          "parameter '" + name + "' could not be set: " + result.reason);
+}
+
 static
 const rclcpp::ParameterValue &
 declare_parameter_helper(
@@ -506,9 +571,7 @@ declare_parameter_helper(
   const std::map<std::string, rclcpp::ParameterValue> & overrides,
   OnSetCallbacksHandleContainer & on_set_callback_container,
   PostSetCallbacksHandleContainer & post_set_callback_container,
-  rclcpp::Publisher<rcl_interfaces::msg::ParameterEvent> * events_publisher,
-  const std::string & combined_name,
-  rclcpp::node_interfaces::NodeClockInterface & node_clock)
+  rcl_interfaces::msg::ParameterEvent & parameter_event)
 {
   // TODO(sloretz) parameter name validation
   if (name.empty()) {
@@ -534,7 +597,6 @@ declare_parameter_helper(
     parameter_descriptor.type = static_cast<uint8_t>(type);
   }
 
-  rcl_interfaces::msg::ParameterEvent parameter_event;
   auto result = __declare_parameter_common(
     name,
     default_value,
@@ -548,24 +610,7 @@ declare_parameter_helper(
 
   // If it failed to be set, then throw an exception.
   if (!result.successful) {
-    constexpr const char type_error_msg_start[] = "Wrong parameter type";
-    if (
-      0u == std::strncmp(
-        result.reason.c_str(), type_error_msg_start, sizeof(type_error_msg_start) - 1))
-    {
-      // TODO(ivanpauno): Refactor the logic so we don't need the above `strncmp` and we can
-      // detect between both exceptions more elegantly.
-      throw rclcpp::exceptions::InvalidParameterTypeException(name, result.reason);
-    }
-    throw rclcpp::exceptions::InvalidParameterValueException(
-            "parameter '" + name + "' could not be set: " + result.reason);
-  }
-
-  // Publish if events_publisher_ is not nullptr, which may be if disabled in the constructor.
-  if (nullptr != events_publisher) {
-    parameter_event.node = combined_name;
-    parameter_event.stamp = node_clock.get_clock()->now();
-    events_publisher->publish(parameter_event);
+    __throw_declare_parameter_failure(name, result);
   }
 
   return parameters.at(name).value;
@@ -578,10 +623,11 @@ NodeParameters::declare_parameter(
   const rcl_interfaces::msg::ParameterDescriptor & parameter_descriptor,
   bool ignore_override)
 {
-  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  std::lock_guard lock(mutex_);
   ParameterMutationRecursionGuard guard(parameter_modification_enabled_);
 
-  return declare_parameter_helper(
+  rcl_interfaces::msg::ParameterEvent parameter_event;
+  const rclcpp::ParameterValue & value = declare_parameter_helper(
     name,
     rclcpp::PARAMETER_NOT_SET,
     default_value,
@@ -591,9 +637,9 @@ NodeParameters::declare_parameter(
     parameter_overrides_,
     on_set_parameters_callback_container_,
     post_set_parameters_callback_container_,
-    events_publisher_.get(),
-    combined_name_,
-    *node_clock_);
+    parameter_event);
+  publish_parameter_event(parameter_event);
+  return value;
 }
 
 const rclcpp::ParameterValue &
@@ -603,7 +649,7 @@ NodeParameters::declare_parameter(
   const rcl_interfaces::msg::ParameterDescriptor & parameter_descriptor,
   bool ignore_override)
 {
-  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  std::lock_guard lock(mutex_);
   ParameterMutationRecursionGuard guard(parameter_modification_enabled_);
 
   if (rclcpp::PARAMETER_NOT_SET == type) {
@@ -617,7 +663,8 @@ NodeParameters::declare_parameter(
             "with `dynamic_typing=true`"};
   }
 
-  return declare_parameter_helper(
+  rcl_interfaces::msg::ParameterEvent parameter_event;
+  const rclcpp::ParameterValue & value = declare_parameter_helper(
     name,
     type,
     rclcpp::ParameterValue{},
@@ -627,15 +674,106 @@ NodeParameters::declare_parameter(
     parameter_overrides_,
     on_set_parameters_callback_container_,
     post_set_parameters_callback_container_,
-    events_publisher_.get(),
-    combined_name_,
-    *node_clock_);
+    parameter_event);
+  publish_parameter_event(parameter_event);
+  return value;
+}
+
+std::vector<rclcpp::ParameterValue>
+NodeParameters::declare_parameters(
+  const std::vector<
+    std::pair<rclcpp::Parameter, rcl_interfaces::msg::ParameterDescriptor>
+  > & parameters,
+  bool ignore_override)
+{
+  std::lock_guard lock(mutex_);
+  ParameterMutationRecursionGuard guard(parameter_modification_enabled_);
+
+  // Validate all of the declarations before any of them is stored.
+  std::map<std::string, ParameterInfo> parameter_infos;
+  std::vector<rclcpp::Parameter> initial_parameters;
+  initial_parameters.reserve(parameters.size());
+  for (const auto & declaration : parameters) {
+    const std::string & name = declaration.first.get_name();
+    // TODO(sloretz) parameter name validation
+    if (name.empty()) {
+      throw rclcpp::exceptions::InvalidParametersException("parameter name must not be empty");
+    }
+    if (__lockless_has_parameter(parameters_, name) || parameter_infos.count(name) != 0) {
+      throw rclcpp::exceptions::ParameterAlreadyDeclaredException(
+              "parameter '" + name + "' has already been declared");
+    }
+
+    ParameterInfo & parameter_info = parameter_infos[name];
+    parameter_info.descriptor = declaration.second;
+    parameter_info.descriptor.name = name;
+    const rclcpp::ParameterValue & default_value = declaration.first.get_parameter_value();
+    if (parameter_info.descriptor.dynamic_typing) {
+      parameter_info.descriptor.type = rclcpp::PARAMETER_NOT_SET;
+    } else {
+      if (rclcpp::PARAMETER_NOT_SET == default_value.get_type()) {
+        throw rclcpp::exceptions::InvalidParameterTypeException{
+                name,
+                "cannot declare a statically typed parameter with an uninitialized value"
+        };
+      }
+      parameter_info.descriptor.type = static_cast<uint8_t>(default_value.get_type());
+    }
+
+    // Use the value from the overrides if available, otherwise use the default.
+    const rclcpp::ParameterValue * initial_value = &default_value;
+    auto overrides_it = parameter_overrides_.find(name);
+    if (!ignore_override && overrides_it != parameter_overrides_.end()) {
+      initial_value = &overrides_it->second;
+    }
+    if (initial_value->get_type() == rclcpp::PARAMETER_NOT_SET) {
+      // Declared without a value
+      continue;
+    }
+
+    initial_parameters.emplace_back(name, *initial_value);
+    auto result = __check_parameters(parameter_infos, {initial_parameters.back()}, false);
+    if (!result.successful) {
+      __throw_declare_parameter_failure(name, result);
+    }
+  }
+
+  // Check with the user's callbacks to see if all of the initial values can be set.
+  if (!initial_parameters.empty()) {
+    auto result = __set_parameters_atomically_common(
+      initial_parameters,
+      parameter_infos,
+      on_set_parameters_callback_container_,
+      post_set_parameters_callback_container_);
+    if (!result.successful) {
+      throw rclcpp::exceptions::InvalidParameterValueException(
+              "parameters could not be set: " + result.reason);
+    }
+  }
+
+  parameters_.insert(parameter_infos.begin(), parameter_infos.end());
+
+  if (!parameters.empty()) {
+    rcl_interfaces::msg::ParameterEvent parameter_event;
+    parameter_event.new_parameters.reserve(initial_parameters.size());
+    for (const auto & parameter : initial_parameters) {
+      parameter_event.new_parameters.push_back(parameter.to_parameter_msg());
+    }
+    publish_parameter_event(parameter_event);
+  }
+
+  std::vector<rclcpp::ParameterValue> values;
+  values.reserve(parameters.size());
+  for (const auto & declaration : parameters) {
+    values.push_back(parameters_.at(declaration.first.get_name()).value);
+  }
+  return values;
 }
 
 void
 NodeParameters::undeclare_parameter(const std::string & name)
 {
-  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  std::lock_guard lock(mutex_);
 
   ParameterMutationRecursionGuard guard(parameter_modification_enabled_);
 
@@ -655,12 +793,18 @@ NodeParameters::undeclare_parameter(const std::string & name)
   }
 
   parameters_.erase(parameter_info);
+
+  auto handle_it = parameter_handles_.find(name);
+  if (handle_it != parameter_handles_.end()) {
+    handle_it->second->invalidate();
+    parameter_handles_.erase(handle_it);
+  }
 }
 
 bool
 NodeParameters::has_parameter(const std::string & name) const
 {
-  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  std::lock_guard lock(mutex_);
 
   return __lockless_has_parameter(parameters_, name);
 }
@@ -688,25 +832,30 @@ __find_parameter_by_name(
   return std::find_if(
     parameters.begin(),
     parameters.end(),
-    [&](auto parameter) {return parameter.get_name() == name;});
+    [&](const auto & parameter) {return parameter.get_name() == name;});
 }
 
 rcl_interfaces::msg::SetParametersResult
 NodeParameters::set_parameters_atomically(const std::vector<rclcpp::Parameter> & parameters)
 {
-  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  std::lock_guard lock(mutex_);
 
   ParameterMutationRecursionGuard guard(parameter_modification_enabled_);
 
   rcl_interfaces::msg::SetParametersResult result;
 
   // call any user registered pre set parameter callbacks
-  // this callback can make changes to the original parameters list
+  // this callback can make changes to the original parameters list, which is only copied then
   // also check if the changed parameter list is empty or not, if empty return
-  std::vector<rclcpp::Parameter> parameters_after_pre_set_callback(parameters);
-  __call_pre_set_parameters_callbacks(
-    parameters_after_pre_set_callback,
-    pre_set_parameters_callback_container_);
+  std::vector<rclcpp::Parameter> pre_set_parameters;
+  if (!pre_set_parameters_callback_container_.empty()) {
+    pre_set_parameters = parameters;
+    __call_pre_set_parameters_callbacks(
+      pre_set_parameters,
+      pre_set_parameters_callback_container_);
+  }
+  const std::vector<rclcpp::Parameter> & parameters_after_pre_set_callback =
+    pre_set_parameters_callback_container_.empty() ? parameters : pre_set_parameters;
 
   if (parameters_after_pre_set_callback.empty()) {
     result.successful = false;
@@ -760,6 +909,8 @@ NodeParameters::set_parameters_atomically(const std::vector<rclcpp::Parameter> &
   std::map<std::string, rclcpp::node_interfaces::ParameterInfo> staged_parameter_changes;
   rcl_interfaces::msg::ParameterEvent parameter_event_msg;
   parameter_event_msg.node = combined_name_;
+  // The values are only copied into the event if it's published
+  const bool publishes_parameter_event = nullptr != events_publisher_;
   OnSetCallbacksHandleContainer empty_on_set_callback_container;
   PostSetCallbacksHandleContainer empty_post_set_callback_container;
 
@@ -778,7 +929,7 @@ NodeParameters::set_parameters_atomically(const std::vector<rclcpp::Parameter> &
       // Only call callbacks once below
       empty_on_set_callback_container,   // callback_container is explicitly empty
       empty_post_set_callback_container,  // callback_container is explicitly empty
-      &parameter_event_msg,
+      publishes_parameter_event ? &parameter_event_msg : nullptr,
       true);
     if (!result.successful) {
       // Declare failed, return knowing that nothing was changed because the
@@ -851,14 +1002,14 @@ NodeParameters::set_parameters_atomically(const std::vector<rclcpp::Parameter> &
   }
 
   // If successful, then update the parameter infos from the implicitly declared parameter's.
-  for (const auto & kv_pair : staged_parameter_changes) {
+  for (auto & kv_pair : staged_parameter_changes) {
     // assumption: the parameter is already present in parameters_ due to the above "set"
     assert(__lockless_has_parameter(parameters_, kv_pair.first));
     // assumption: the value in parameters_ is the same as the value resulting from the declare
     assert(parameters_[kv_pair.first].value == kv_pair.second.value);
     // This assignment should not change the name, type, or value, but may
-    // change other things from the ParameterInfo.
-    parameters_[kv_pair.first] = kv_pair.second;
+    // change other things from the ParameterInfo. Only the keys are used below.
+    parameters_[kv_pair.first] = std::move(kv_pair.second);
   }
 
   // Undeclare parameters that need to be.
@@ -868,12 +1019,21 @@ NodeParameters::set_parameters_atomically(const std::vector<rclcpp::Parameter> &
     assert(it != parameters_.end());
     if (it != parameters_.end()) {
       // Update the parameter event message and remove it.
-      parameter_event_msg.deleted_parameters.push_back(
-        rclcpp::Parameter(it->first, it->second.value).to_parameter_msg());
+      if (publishes_parameter_event) {
+        parameter_event_msg.deleted_parameters.push_back(
+          rclcpp::Parameter(it->first, it->second.value).to_parameter_msg());
+      }
       parameters_.erase(it);
     }
   }
 
+  // Make the new values visible to the readers of the parameter handles.
+  update_parameter_handles(*parameters_to_be_set);
+
+  if (!publishes_parameter_event) {
+    return result;
+  }
+
   // Update the parameter event message for any parameters which were only set,
   // and not either declared or undeclared.
   for (const auto & parameter : *parameters_to_be_set) {
@@ -893,11 +1053,7 @@ NodeParameters::set_parameters_atomically(const std::vector<rclcpp::Parameter> &
     parameter_event_msg.changed_parameters.push_back(parameter.to_parameter_msg());
   }
 
-  // Publish if events_publisher_ is not nullptr, which may be if disabled in the constructor.
-  if (nullptr != events_publisher_) {
-    parameter_event_msg.stamp = node_clock_->get_clock()->now();
-    events_publisher_->publish(parameter_event_msg);
-  }
+  publish_parameter_event(parameter_event_msg);
   return result;
 }
 
@@ -907,7 +1063,7 @@ NodeParameters::get_parameters(const std::vector<std::string> & names) const
   std::vector<rclcpp::Parameter> results;
   results.reserve(names.size());
 
-  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  std::lock_guard lock(mutex_);
   for (auto & name : names) {
     results.emplace_back(this->get_parameter(name));
   }
@@ -917,7 +1073,7 @@ NodeParameters::get_parameters(const std::vector<std::string> & names) const
 rclcpp::Parameter
 NodeParameters::get_parameter(const std::string & name) const
 {
-  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  std::lock_guard lock(mutex_);
 
   auto param_iter = parameters_.find(name);
   if (parameters_.end() != param_iter) {
@@ -940,7 +1096,7 @@ NodeParameters::get_parameter(
   const std::string & name,
   rclcpp::Parameter & parameter) const
 {
-  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  std::lock_guard lock(mutex_);
 
   auto param_iter = parameters_.find(name);
   if (
@@ -954,12 +1110,175 @@ NodeParameters::get_parameter(
   }
 }
 
+// Return the position of the parameter with the given name, or end if there is none.
+RCLCPP_LOCAL
+std::vector<rcl_interfaces::msg::Parameter>::iterator
+__find_parameter_msg_by_name(
+  std::vector<rcl_interfaces::msg::Parameter> & parameters,
+  const std::string & name)
+{
+  return std::find_if(
+    parameters.begin(), parameters.end(),
+    [&name](const rcl_interfaces::msg::Parameter & parameter) {return parameter.name == name;});
+}
+
+// Insert the given parameter, or replace the value of the one with the same name.
+RCLCPP_LOCAL
+void
+__upsert_parameter_msg(
+  std::vector<rcl_interfaces::msg::Parameter> & parameters,
+  rcl_interfaces::msg::Parameter && parameter)
+{
+  auto it = __find_parameter_msg_by_name(parameters, parameter.name);
+  if (it != parameters.end()) {
+    *it = std::move(parameter);
+  } else {
+    parameters.push_back(std::move(parameter));
+  }
+}
+
+// Remove the parameter with the given name, return true if there was one.
+RCLCPP_LOCAL
+bool
+__erase_parameter_msg(
+  std::vector<rcl_interfaces::msg::Parameter> & parameters,
+  const std::string & name)
+{
+  auto it = __find_parameter_msg_by_name(parameters, name);
+  if (it == parameters.end()) {
+    return false;
+  }
+  parameters.erase(it);
+  return true;
+}
+
+// Merge the changes of the given event into the pending one, as if they were made at once.
+// The values of the event are moved, rather than copied.
+RCLCPP_LOCAL
+void
+__merge_parameter_event(
+  rcl_interfaces::msg::ParameterEvent & pending,
+  rcl_interfaces::msg::ParameterEvent && event)
+{
+  for (auto & parameter : event.new_parameters) {
+    if (__erase_parameter_msg(pending.deleted_parameters, parameter.name)) {
+      // Deleted and declared again.
+      __upsert_parameter_msg(pending.changed_parameters, std::move(parameter));
+    } else {
+      __upsert_parameter_msg(pending.new_parameters, std::move(parameter));
+    }
+  }
+  for (auto & parameter : event.changed_parameters) {
+    auto it = __find_parameter_msg_by_name(pending.new_parameters, parameter.name);
+    if (it != pending.new_parameters.end()) {
+      // Still new, with the latest value.
+      *it = std::move(parameter);
+    } else {
+      __upsert_parameter_msg(pending.changed_parameters, std::move(parameter));
+    }
+  }
+  for (auto & parameter : event.deleted_parameters) {
+    if (!__erase_parameter_msg(pending.new_parameters, parameter.name)) {
+      __erase_parameter_msg(pending.changed_parameters, parameter.name);
+      __upsert_parameter_msg(pending.deleted_parameters, std::move(parameter));
+    }
+    // Otherwise it was declared and deleted in the same period, which is not an event.
+  }
+}
+
+void
+NodeParameters::publish_parameter_event(rcl_interfaces::msg::ParameterEvent & parameter_event)
+{
+  // Publish if events_publisher_ is not nullptr, which may be if disabled in the constructor.
+  if (nullptr == events_publisher_) {
+    return;
+  }
+  if (!parameter_event_coalescing_timer_) {
+    parameter_event.node = combined_name_;
+    parameter_event.stamp = node_clock_->get_clock()->now();
+    // Moved, so that intra-process subscriptions don't get a copy of the values
+    events_publisher_->publish(
+      std::make_unique<rcl_interfaces::msg::ParameterEvent>(std::move(parameter_event)));
+    return;
+  }
+
+  __merge_parameter_event(pending_parameter_event_, std::move(parameter_event));
+  if (!parameter_event_pending_) {
+    // Start the coalescing period.
+    parameter_event_pending_ = true;
+    parameter_event_coalescing_timer_->reset();
+  }
+}
+
+void
+NodeParameters::publish_pending_parameter_event()
+{
+  std::lock_guard lock(mutex_);
+
+  parameter_event_coalescing_timer_->cancel();
+  if (!parameter_event_pending_) {
+    return;
+  }
+  parameter_event_pending_ = false;
+
+  rcl_interfaces::msg::ParameterEvent parameter_event;
+  std::swap(parameter_event, pending_parameter_event_);
+  if (
+    !parameter_event.new_parameters.empty() ||
+    !parameter_event.changed_parameters.empty() ||
+    !parameter_event.deleted_parameters.empty())
+  {
+    parameter_event.node = combined_name_;
+    parameter_event.stamp = node_clock_->get_clock()->now();
+    events_publisher_->publish(
+      std::make_unique<rcl_interfaces::msg::ParameterEvent>(std::move(parameter_event)));
+  }
+}
+
+void
+NodeParameters::update_parameter_handles(const std::vector<rclcpp::Parameter> & parameters)
+{
+  for (const auto & parameter : parameters) {
+    auto handle_it = parameter_handles_.find(parameter.get_name());
+    if (handle_it == parameter_handles_.end()) {
+      continue;
+    }
+    auto parameter_it = parameters_.find(parameter.get_name());
+    if (parameter_it != parameters_.end()) {
+      handle_it->second->set_value(parameter_it->second.value);
+    } else {
+      // The parameter was undeclared.
+      handle_it->second->invalidate();
+      parameter_handles_.erase(handle_it);
+    }
+  }
+}
+
+rclcpp::node_interfaces::ParameterHandle::SharedPtr
+NodeParameters::get_parameter_handle(const std::string & name)
+{
+  std::lock_guard lock(mutex_);
+
+  auto parameter_info = parameters_.find(name);
+  if (parameter_info == parameters_.end()) {
+    throw rclcpp::exceptions::ParameterNotDeclaredException(
+            "cannot get a handle to parameter '" + name + "' which has not yet been declared");
+  }
+
+  auto & handle = parameter_handles_[name];
+  if (!handle) {
+    handle = std::make_shared<rclcpp::node_interfaces::ParameterHandle>(
+      name, parameter_info->second.value);
+  }
+  return handle;
+}
+
 bool
 NodeParameters::get_parameters_by_prefix(
   const std::string & prefix,
   std::map<std::string, rclcpp::Parameter> & parameters) const
 {
-  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  std::lock_guard lock(mutex_);
 
   std::string prefix_with_dot = prefix.empty() ? prefix : prefix + ".";
   bool ret = false;
@@ -978,7 +1297,7 @@ NodeParameters::get_parameters_by_prefix(
 std::vector<rcl_interfaces::msg::ParameterDescriptor>
 NodeParameters::describe_parameters(const std::vector<std::string> & names) const
 {
-  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  std::lock_guard lock(mutex_);
   std::vector<rcl_interfaces::msg::ParameterDescriptor> results;
   results.reserve(names.size());
 
@@ -1006,7 +1325,7 @@ NodeParameters::describe_parameters(const std::vector<std::string> & names) cons
 std::vector<uint8_t>
 NodeParameters::get_parameter_types(const std::vector<std::string> & names) const
 {
-  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  std::lock_guard lock(mutex_);
   std::vector<uint8_t> results;
   results.reserve(names.size());
 
@@ -1032,7 +1351,7 @@ NodeParameters::get_parameter_types(const std::vector<std::string> & names) cons
 rcl_interfaces::msg::ListParametersResult
 NodeParameters::list_parameters(const std::vector<std::string> & prefixes, uint64_t depth) const
 {
-  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  std::lock_guard lock(mutex_);
   rcl_interfaces::msg::ListParametersResult result;
 
   // TODO(mikaelarguedas) define parameter separator different from "/" to avoid ambiguity
@@ -1090,7 +1409,7 @@ void
 NodeParameters::remove_pre_set_parameters_callback(
   const PreSetParametersCallbackHandle * const handle)
 {
-  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  std::lock_guard lock(mutex_);
   ParameterMutationRecursionGuard guard(parameter_modification_enabled_);
 
   auto it = std::find_if(
@@ -1110,7 +1429,7 @@ void
 NodeParameters::remove_on_set_parameters_callback(
   const OnSetParametersCallbackHandle * const handle)
 {
-  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  std::lock_guard lock(mutex_);
   ParameterMutationRecursionGuard guard(parameter_modification_enabled_);
 
   auto it = std::find_if(
@@ -1130,7 +1449,7 @@ void
 NodeParameters::remove_post_set_parameters_callback(
   const PostSetParametersCallbackHandle * const handle)
 {
-  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  std::lock_guard lock(mutex_);
   ParameterMutationRecursionGuard guard(parameter_modification_enabled_);
 
   auto it = std::find_if(
@@ -1149,7 +1468,7 @@ NodeParameters::remove_post_set_parameters_callback(
 PreSetParametersCallbackHandle::SharedPtr
 NodeParameters::add_pre_set_parameters_callback(PreSetParametersCallbackType callback)
 {
-  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  std::lock_guard lock(mutex_);
   ParameterMutationRecursionGuard guard(parameter_modification_enabled_);
 
   auto handle = std::make_shared<PreSetParametersCallbackHandle>();
@@ -1162,7 +1481,7 @@ NodeParameters::add_pre_set_parameters_callback(PreSetParametersCallbackType cal
 OnSetParametersCallbackHandle::SharedPtr
 NodeParameters::add_on_set_parameters_callback(OnSetParametersCallbackType callback)
 {
-  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  std::lock_guard lock(mutex_);
   ParameterMutationRecursionGuard guard(parameter_modification_enabled_);
 
   auto handle = std::make_shared<OnSetParametersCallbackHandle>();
@@ -1176,7 +1495,7 @@ PostSetParametersCallbackHandle::SharedPtr
 NodeParameters::add_post_set_parameters_callback(
   PostSetParametersCallbackType callback)
 {
-  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  std::lock_guard lock(mutex_);
   ParameterMutationRecursionGuard guard(parameter_modification_enabled_);
 
   auto handle = std::make_shared<PostSetParametersCallbackHandle>();
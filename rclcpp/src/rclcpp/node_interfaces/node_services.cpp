@@ -40,6 +40,12 @@ NodeServices::add_service(
 
   group->add_service(service_base_ptr);
 
+  auto intra_process_waitable = service_base_ptr->get_intra_process_waitable();
+  if (nullptr != intra_process_waitable) {
+    // Add to the callback group to be notified about intra-process requests.
+    group->add_waitable(intra_process_waitable);
+  }
+
   // Notify the executor that a new service was created using the parent Node.
   try {
     node_base_->trigger_notify_guard_condition();
@@ -65,6 +71,12 @@ NodeServices::add_client(
 
   group->add_client(client_base_ptr);
 
+  auto intra_process_waitable = client_base_ptr->get_intra_process_waitable();
+  if (nullptr != intra_process_waitable) {
+    // Add to the callback group to be notified about intra-process responses.
+    group->add_waitable(intra_process_waitable);
+  }
+
   // Notify the executor that a new client was created using the parent Node.
   try {
     node_base_->trigger_notify_guard_condition();
@@ -14,6 +14,8 @@
 
 #include "rclcpp/node_interfaces/node_topics.hpp"
 
+#include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <string>
 
@@ -33,8 +35,10 @@ using rclcpp::node_interfaces::NodeTopics;
 
 NodeTopics::NodeTopics(
   rclcpp::node_interfaces::NodeBaseInterface * node_base,
-  rclcpp::node_interfaces::NodeTimersInterface * node_timers)
-: node_base_(node_base), node_timers_(node_timers)
+  rclcpp::node_interfaces::NodeTimersInterface * node_timers,
+  bool aggregate_event_handlers)
+: node_base_(node_base), node_timers_(node_timers),
+  aggregate_event_handlers_(aggregate_event_handlers)
 {}
 
 NodeTopics::~NodeTopics()
@@ -65,8 +69,7 @@ NodeTopics::add_publisher(
   }
 
   for (auto & key_event_pair : publisher->get_event_handlers()) {
-    auto publisher_event = key_event_pair.second;
-    callback_group->add_waitable(publisher_event);
+    add_event_handler(key_event_pair.second, callback_group);
   }
 
   // Notify the executor that a new publisher was created using the parent Node.
@@ -106,8 +109,7 @@ NodeTopics::add_subscription(
   callback_group->add_subscription(subscription);
 
   for (auto & key_event_pair : subscription->get_event_handlers()) {
-    auto subscription_event = key_event_pair.second;
-    callback_group->add_waitable(subscription_event);
+    add_event_handler(key_event_pair.second, callback_group);
   }
 
   auto intra_process_waitable = subscription->get_intra_process_waitable();
@@ -126,6 +128,36 @@ NodeTopics::add_subscription(
   }
 }
 
+void
+NodeTopics::add_event_handler(
+  const std::shared_ptr<rclcpp::EventHandlerBase> & event_handler,
+  const rclcpp::CallbackGroup::SharedPtr & callback_group)
+{
+  if (!aggregate_event_handlers_) {
+    callback_group->add_waitable(event_handler);
+    return;
+  }
+  rclcpp::EventHandlerGroup::SharedPtr event_handler_group;
+  {
+    std::lock_guard<std::mutex> lock(event_handler_groups_mutex_);
+    for (auto it = event_handler_groups_.begin(); it != event_handler_groups_.end(); ) {
+      if (it->first.expired()) {
+        it = event_handler_groups_.erase(it);
+      } else {
+        ++it;
+      }
+    }
+    auto & group = event_handler_groups_[callback_group];
+    if (!group) {
+      // The callback group only keeps a weak pointer to its waitables, the node owns the group
+      group = rclcpp::EventHandlerGroup::make_shared();
+      callback_group->add_waitable(group);
+    }
+    event_handler_group = group;
+  }
+  event_handler_group->add_event_handler(event_handler);
+}
+
 rclcpp::node_interfaces::NodeBaseInterface *
 NodeTopics::get_node_base_interface() const
 {
@@ -12,9 +12,13 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <thread>
+#include <utility>
+#include <vector>
 
 #include "rclcpp/node_interfaces/node_type_descriptions.hpp"
 #include "rclcpp/parameter_client.hpp"
@@ -48,20 +52,166 @@ namespace rclcpp
 namespace node_interfaces
 {
 
-class NodeTypeDescriptions::NodeTypeDescriptionsImpl
+namespace
+{
+
+using ServiceT = GetTypeDescription__C;
+using TypeDescriptionService = rclcpp::Service<ServiceT>;
+
+/// Create the ~/get_type_description service of a node, handling requests with the callback.
+TypeDescriptionService::SharedPtr
+create_type_description_service(
+  const rclcpp::node_interfaces::NodeBaseInterface::SharedPtr & node_base,
+  const rclcpp::node_interfaces::NodeServicesInterface::SharedPtr & node_services,
+  const rclcpp::Logger & logger,
+  rclcpp::AnyServiceCallback<ServiceT> callback)
+{
+  auto * rcl_node = node_base->get_rcl_node_handle();
+  std::shared_ptr<rcl_service_t> rcl_srv(
+    new rcl_service_t,
+    [rcl_node, logger](rcl_service_t * service)
+    {
+      if (rcl_service_fini(service, rcl_node) != RCL_RET_OK) {
+        RCLCPP_ERROR(
+          logger,
+          "Error in destruction of rcl service handle [~/get_type_description]: %s",
+          rcl_get_error_string().str);
+        rcl_reset_error();
+      }
+      delete service;
+    });
+  *rcl_srv = rcl_get_zero_initialized_service();
+  rcl_ret_t rcl_ret = rcl_node_type_description_service_init(rcl_srv.get(), rcl_node);
+
+  if (rcl_ret != RCL_RET_OK) {
+    RCLCPP_ERROR(
+      logger, "Failed to initialize ~/get_type_description service: %s",
+      rcl_get_error_string().str);
+    throw std::runtime_error(
+            "Failed to initialize ~/get_type_description service.");
+  }
+
+  auto service = std::make_shared<TypeDescriptionService>(
+    node_base->get_shared_rcl_node_handle(),
+    rcl_srv,
+    callback);
+  node_services->add_service(std::dynamic_pointer_cast<ServiceBase>(service), nullptr);
+  return service;
+}
+
+/// Single ~/get_type_description service answering for all the nodes of a context sharing it.
+/**
+ * The service is created on the first node sharing it, and moved to another one when the
+ * node hosting it is destroyed.
+ * Requests are answered from the type descriptions of the first node knowing the type.
+ */
+class SharedTypeDescriptionService
+  : public std::enable_shared_from_this<SharedTypeDescriptionService>
 {
 public:
-  using ServiceT = GetTypeDescription__C;
+  /// Node sharing the service.
+  struct Member
+  {
+    const void * owner;
+    rclcpp::node_interfaces::NodeBaseInterface::SharedPtr node_base;
+    rclcpp::node_interfaces::NodeServicesInterface::SharedPtr node_services;
+    rclcpp::Logger logger;
+  };
+
+  void
+  add_node(Member member)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    members_.push_back(std::move(member));
+    if (!service_) {
+      create_service(members_.back());
+    }
+  }
+
+  void
+  remove_node(const void * owner)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = std::find_if(
+      members_.begin(), members_.end(),
+      [owner](const Member & member) {return member.owner == owner;});
+    if (it == members_.end()) {
+      return;
+    }
+    const bool hosts_service = it == members_.begin();
+    members_.erase(it);
+    if (hosts_service) {
+      service_.reset();
+      if (!members_.empty()) {
+        try {
+          create_service(members_.front());
+        } catch (const std::exception & exc) {
+          RCLCPP_ERROR(
+            members_.front().logger, "Failed to move the shared type description service: %s",
+            exc.what());
+        }
+      }
+    }
+  }
+
+private:
+  /// Create the service on the given node, the first of the members.
+  void
+  create_service(const Member & member)
+  {
+    rclcpp::AnyServiceCallback<ServiceT> callback;
+    callback.set(
+      [weak_this = weak_from_this()](
+        std::shared_ptr<rmw_request_id_t> header,
+        std::shared_ptr<ServiceT::Request> request,
+        std::shared_ptr<ServiceT::Response> response
+      ) {
+        auto shared_this = weak_this.lock();
+        if (shared_this) {
+          shared_this->handle_request(header.get(), request.get(), response.get());
+        }
+      });
+    service_ = create_type_description_service(
+      member.node_base, member.node_services, member.logger, callback);
+  }
+
+  void
+  handle_request(
+    rmw_request_id_t * header, ServiceT::Request * request, ServiceT::Response * response)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto & member : members_) {
+      rcl_node_type_description_service_handle_request(
+        member.node_base->get_rcl_node_handle(), header, request, response);
+      if (response->successful) {
+        return;
+      }
+    }
+  }
+
+  std::mutex mutex_;
+  /// Nodes sharing the service, the first one hosts it.
+  std::vector<Member> members_;
+  TypeDescriptionService::SharedPtr service_;
+};
+
+}  // namespace
 
+class NodeTypeDescriptions::NodeTypeDescriptionsImpl
+{
+public:
   rclcpp::Logger logger_;
   rclcpp::node_interfaces::NodeBaseInterface::SharedPtr node_base_;
-  rclcpp::Service<ServiceT>::SharedPtr type_description_srv_;
+  TypeDescriptionService::SharedPtr type_description_srv_;
+  std::shared_ptr<SharedTypeDescriptionService> shared_type_description_srv_;
 
   NodeTypeDescriptionsImpl(
     rclcpp::node_interfaces::NodeBaseInterface::SharedPtr node_base,
     rclcpp::node_interfaces::NodeLoggingInterface::SharedPtr node_logging,
     rclcpp::node_interfaces::NodeParametersInterface::SharedPtr node_parameters,
-    rclcpp::node_interfaces::NodeServicesInterface::SharedPtr node_services)
+    rclcpp::node_interfaces::NodeServicesInterface::SharedPtr node_services,
+    bool start_type_description_service,
+    bool share_type_description_service)
   : logger_(node_logging->get_logger()),
     node_base_(node_base)
   {
@@ -71,7 +221,7 @@ public:
     try {
       auto enable_param = node_parameters->declare_parameter(
         enable_param_name,
-        rclcpp::ParameterValue(true),
+        rclcpp::ParameterValue(start_type_description_service),
         rcl_interfaces::msg::ParameterDescriptor()
         .set__name(enable_param_name)
         .set__type(rclcpp::PARAMETER_BOOL)
@@ -83,53 +233,37 @@ public:
       throw;
     }
 
-    if (enabled) {
-      auto * rcl_node = node_base->get_rcl_node_handle();
-      std::shared_ptr<rcl_service_t> rcl_srv(
-        new rcl_service_t,
-        [rcl_node, logger = this->logger_](rcl_service_t * service)
-        {
-          if (rcl_service_fini(service, rcl_node) != RCL_RET_OK) {
-            RCLCPP_ERROR(
-              logger,
-              "Error in destruction of rcl service handle [~/get_type_description]: %s",
-              rcl_get_error_string().str);
-            rcl_reset_error();
-          }
-          delete service;
-        });
-      *rcl_srv = rcl_get_zero_initialized_service();
-      rcl_ret_t rcl_ret = rcl_node_type_description_service_init(rcl_srv.get(), rcl_node);
-
-      if (rcl_ret != RCL_RET_OK) {
-        RCLCPP_ERROR(
-          logger_, "Failed to initialize ~/get_type_description service: %s",
-          rcl_get_error_string().str);
-        throw std::runtime_error(
-                "Failed to initialize ~/get_type_description service.");
-      }
+    if (!enabled) {
+      return;
+    }
+    if (share_type_description_service) {
+      shared_type_description_srv_ =
+        node_base_->get_context()->get_sub_context<SharedTypeDescriptionService>();
+      shared_type_description_srv_->add_node({this, node_base_, node_services, logger_});
+      return;
+    }
 
-      rclcpp::AnyServiceCallback<ServiceT> cb;
-      cb.set(
-        [this](
-          std::shared_ptr<rmw_request_id_t> header,
-          std::shared_ptr<ServiceT::Request> request,
-          std::shared_ptr<ServiceT::Response> response
-        ) {
-          rcl_node_type_description_service_handle_request(
-            node_base_->get_rcl_node_handle(),
-            header.get(),
-            request.get(),
-            response.get());
-        });
-
-      type_description_srv_ = std::make_shared<Service<ServiceT>>(
-        node_base_->get_shared_rcl_node_handle(),
-        rcl_srv,
-        cb);
-      node_services->add_service(
-        std::dynamic_pointer_cast<ServiceBase>(type_description_srv_),
-        nullptr);
+    rclcpp::AnyServiceCallback<ServiceT> cb;
+    cb.set(
+      [this](
+        std::shared_ptr<rmw_request_id_t> header,
+        std::shared_ptr<ServiceT::Request> request,
+        std::shared_ptr<ServiceT::Response> response
+      ) {
+        rcl_node_type_description_service_handle_request(
+          node_base_->get_rcl_node_handle(),
+          header.get(),
+          request.get(),
+          response.get());
+      });
+    type_description_srv_ = create_type_description_service(
+      node_base_, node_services, logger_, cb);
+  }
+
+  ~NodeTypeDescriptionsImpl()
+  {
+    if (shared_type_description_srv_) {
+      shared_type_description_srv_->remove_node(this);
     }
   }
 };
@@ -138,12 +272,16 @@ NodeTypeDescriptions::NodeTypeDescriptions(
   rclcpp::node_interfaces::NodeBaseInterface::SharedPtr node_base,
   rclcpp::node_interfaces::NodeLoggingInterface::SharedPtr node_logging,
   rclcpp::node_interfaces::NodeParametersInterface::SharedPtr node_parameters,
-  rclcpp::node_interfaces::NodeServicesInterface::SharedPtr node_services)
+  rclcpp::node_interfaces::NodeServicesInterface::SharedPtr node_services,
+  bool start_type_description_service,
+  bool share_type_description_service)
 : impl_(new NodeTypeDescriptionsImpl(
       node_base,
       node_logging,
       node_parameters,
-      node_services))
+      node_services,
+      start_type_description_service,
+      share_type_description_service))
 {}
 
 NodeTypeDescriptions::~NodeTypeDescriptions()
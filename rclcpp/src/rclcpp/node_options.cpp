@@ -14,8 +14,10 @@
 
 #include "rclcpp/node_options.hpp"
 
+#include <chrono>
 #include <limits>
 #include <memory>
+#include <stdexcept>
 #include <string>
 #include <vector>
 #include <utility>
@@ -80,9 +82,14 @@ NodeOptions::operator=(const NodeOptions & other)
     this->clock_type_ = other.clock_type_;
     this->clock_qos_ = other.clock_qos_;
     this->use_clock_thread_ = other.use_clock_thread_;
+    this->use_shared_clock_subscription_ = other.use_shared_clock_subscription_;
+    this->aggregate_event_handlers_ = other.aggregate_event_handlers_;
+    this->start_type_description_service_ = other.start_type_description_service_;
+    this->share_type_description_service_ = other.share_type_description_service_;
     this->parameter_event_qos_ = other.parameter_event_qos_;
     this->rosout_qos_ = other.rosout_qos_;
     this->parameter_event_publisher_options_ = other.parameter_event_publisher_options_;
+    this->parameter_event_coalescing_period_ = other.parameter_event_coalescing_period_;
     this->allow_undeclared_parameters_ = other.allow_undeclared_parameters_;
     this->automatically_declare_parameters_from_overrides_ =
       other.automatically_declare_parameters_from_overrides_;
@@ -261,6 +268,43 @@ NodeOptions::enable_logger_service(bool enable_logger_service)
   return *this;
 }
 
+bool
+NodeOptions::start_type_description_service() const
+{
+  return this->start_type_description_service_;
+}
+
+NodeOptions &
+NodeOptions::start_type_description_service(bool start_type_description_service)
+{
+  this->start_type_description_service_ = start_type_description_service;
+  return *this;
+}
+
+bool
+NodeOptions::share_type_description_service() const
+{
+  return this->share_type_description_service_;
+}
+
+NodeOptions &
+NodeOptions::share_type_description_service(bool share_type_description_service)
+{
+  this->share_type_description_service_ = share_type_description_service;
+  return *this;
+}
+
+NodeOptions &
+NodeOptions::lightweight()
+{
+  this->start_parameter_services_ = false;
+  this->start_parameter_event_publisher_ = false;
+  this->enable_logger_service_ = false;
+  this->start_type_description_service_ = false;
+  this->use_shared_clock_subscription_ = true;
+  return *this;
+}
+
 bool
 NodeOptions::start_parameter_event_publisher() const
 {
@@ -313,6 +357,32 @@ NodeOptions::use_clock_thread(bool use_clock_thread)
   return *this;
 }
 
+bool
+NodeOptions::use_shared_clock_subscription() const
+{
+  return this->use_shared_clock_subscription_;
+}
+
+NodeOptions &
+NodeOptions::use_shared_clock_subscription(bool use_shared_clock_subscription)
+{
+  this->use_shared_clock_subscription_ = use_shared_clock_subscription;
+  return *this;
+}
+
+bool
+NodeOptions::aggregate_event_handlers() const
+{
+  return this->aggregate_event_handlers_;
+}
+
+NodeOptions &
+NodeOptions::aggregate_event_handlers(bool aggregate_event_handlers)
+{
+  this->aggregate_event_handlers_ = aggregate_event_handlers;
+  return *this;
+}
+
 const rclcpp::QoS &
 NodeOptions::parameter_event_qos() const
 {
@@ -326,6 +396,23 @@ NodeOptions::parameter_event_qos(const rclcpp::QoS & parameter_event_qos)
   return *this;
 }
 
+std::chrono::milliseconds
+NodeOptions::parameter_event_coalescing_period() const
+{
+  return this->parameter_event_coalescing_period_;
+}
+
+NodeOptions &
+NodeOptions::parameter_event_coalescing_period(
+  std::chrono::milliseconds parameter_event_coalescing_period)
+{
+  if (parameter_event_coalescing_period < std::chrono::milliseconds(0)) {
+    throw std::invalid_argument("parameter_event_coalescing_period must not be negative");
+  }
+  this->parameter_event_coalescing_period_ = parameter_event_coalescing_period;
+  return *this;
+}
+
 const rclcpp::QoS &
 NodeOptions::rosout_qos() const
 {
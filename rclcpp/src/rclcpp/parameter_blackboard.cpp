@@ -0,0 +1,182 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rclcpp/parameter_blackboard.hpp"
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "rclcpp/exceptions.hpp"
+#include "rclcpp/parameter.hpp"
+
+using rclcpp::ParameterBlackboard;
+
+ParameterBlackboard::SharedPtr
+ParameterBlackboard::get_instance(rclcpp::Context & context)
+{
+  return context.get_sub_context<ParameterBlackboard>();
+}
+
+ParameterBlackboard::ValueSharedPtr
+ParameterBlackboard::get(const std::string & key) const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = values_.find(key);
+  if (it == values_.end()) {
+    return nullptr;
+  }
+  return it->second;
+}
+
+bool
+ParameterBlackboard::has(const std::string & key) const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return values_.find(key) != values_.end();
+}
+
+ParameterBlackboard::Snapshot
+ParameterBlackboard::snapshot() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return values_;
+}
+
+void
+ParameterBlackboard::set(const std::string & key, rclcpp::ParameterValue value)
+{
+  set(key, std::make_shared<const rclcpp::ParameterValue>(std::move(value)));
+}
+
+void
+ParameterBlackboard::set(const std::string & key, ValueSharedPtr value)
+{
+  if (!value || value->get_type() == rclcpp::ParameterType::PARAMETER_NOT_SET) {
+    throw std::invalid_argument("cannot set blackboard key '" + key + "' to an unset value");
+  }
+  std::lock_guard<std::recursive_mutex> callbacks_lock(callbacks_mutex_);
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    values_[key] = value;
+  }
+  call_callbacks(key, value);
+}
+
+bool
+ParameterBlackboard::erase(const std::string & key)
+{
+  std::lock_guard<std::recursive_mutex> callbacks_lock(callbacks_mutex_);
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (values_.erase(key) == 0) {
+      return false;
+    }
+  }
+  call_callbacks(key, nullptr);
+  return true;
+}
+
+rclcpp::BlackboardCallbackHandle::SharedPtr
+ParameterBlackboard::add_callback(BlackboardCallbackType callback, const std::string & key)
+{
+  auto handle = std::make_shared<BlackboardCallbackHandle>();
+  handle->key = key;
+  handle->callback = std::move(callback);
+  std::lock_guard<std::recursive_mutex> lock(callbacks_mutex_);
+  callbacks_.emplace_back(handle);
+  return handle;
+}
+
+void
+ParameterBlackboard::remove_callback(const BlackboardCallbackHandle * const handle)
+{
+  std::lock_guard<std::recursive_mutex> lock(callbacks_mutex_);
+  callbacks_.remove_if(
+    [handle](const BlackboardCallbackHandle::WeakPtr & weak_handle) {
+      auto locked_handle = weak_handle.lock();
+      return !locked_handle || locked_handle.get() == handle;
+    });
+}
+
+void
+ParameterBlackboard::call_callbacks(const std::string & key, const ValueSharedPtr & value)
+{
+  // Hold the handles, so that callbacks added or removed by a callback don't affect this call
+  std::vector<BlackboardCallbackHandle::SharedPtr> handles;
+  for (auto it = callbacks_.begin(); it != callbacks_.end(); ) {
+    auto handle = it->lock();
+    if (!handle) {
+      it = callbacks_.erase(it);
+      continue;
+    }
+    if (handle->key.empty() || handle->key == key) {
+      handles.push_back(std::move(handle));
+    }
+    ++it;
+  }
+  for (const auto & handle : handles) {
+    handle->callback(key, value);
+  }
+}
+
+rclcpp::node_interfaces::PostSetParametersCallbackHandle::SharedPtr
+ParameterBlackboard::share_parameter(
+  rclcpp::node_interfaces::NodeParametersInterface::SharedPtr node_parameters,
+  const std::string & name,
+  const std::string & key)
+{
+  if (!node_parameters->has_parameter(name)) {
+    throw rclcpp::exceptions::ParameterNotDeclaredException(
+            "cannot share parameter '" + name + "' which has not yet been declared");
+  }
+  const std::string shared_key = key.empty() ? name : key;
+
+  // Whether the callback already set the key, with a value newer than the initial one
+  struct SyncState
+  {
+    std::mutex mutex;
+    bool updated = false;
+  };
+  auto state = std::make_shared<SyncState>();
+  std::weak_ptr<ParameterBlackboard> weak_this = weak_from_this();
+  auto handle = node_parameters->add_post_set_parameters_callback(
+    [weak_this, state, name, shared_key](const std::vector<rclcpp::Parameter> & parameters) {
+      auto blackboard = weak_this.lock();
+      if (!blackboard) {
+        return;
+      }
+      for (const auto & parameter : parameters) {
+        if (parameter.get_name() != name) {
+          continue;
+        }
+        std::lock_guard<std::mutex> lock(state->mutex);
+        state->updated = true;
+        if (parameter.get_type() == rclcpp::ParameterType::PARAMETER_NOT_SET) {
+          blackboard->erase(shared_key);
+        } else {
+          blackboard->set(shared_key, parameter.get_parameter_value());
+        }
+      }
+    });
+
+  auto parameter = node_parameters->get_parameter(name);
+  std::lock_guard<std::mutex> lock(state->mutex);
+  if (!state->updated && parameter.get_type() != rclcpp::ParameterType::PARAMETER_NOT_SET) {
+    set(shared_key, parameter.get_parameter_value());
+  }
+  return handle;
+}
@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
 #include <functional>
 #include <memory>
 #include <string>
@@ -19,12 +20,25 @@
 #include <utility>
 #include <vector>
 
+#include "rclcpp/exceptions.hpp"
 #include "rclcpp/parameter_event_handler.hpp"
 #include "rcpputils/join.hpp"
 
 namespace rclcpp
 {
 
+namespace
+{
+/// Last token of a node name matching all of the nodes of a namespace.
+constexpr char kNodeNameWildcard[] = "*";
+
+bool
+is_node_name_wildcard(const std::string & node_name)
+{
+  return !node_name.empty() && node_name.back() == kNodeNameWildcard[0];
+}
+}  // namespace
+
 ParameterEventCallbackHandle::SharedPtr
 ParameterEventHandler::add_parameter_event_callback(
   ParameterEventCallbackType callback)
@@ -33,6 +47,8 @@ ParameterEventHandler::add_parameter_event_callback(
   auto handle = std::make_shared<ParameterEventCallbackHandle>();
   handle->callback = callback;
   callbacks_->event_callbacks_.emplace_front(handle);
+  // All events are needed from now on.
+  update_content_filter();
 
   return handle;
 }
@@ -50,6 +66,7 @@ ParameterEventHandler::remove_parameter_event_callback(
     });
   if (it != callbacks_->event_callbacks_.end()) {
     callbacks_->event_callbacks_.erase(it);
+    update_content_filter();
   } else {
     throw std::runtime_error("Callback doesn't exist");
   }
@@ -70,6 +87,7 @@ ParameterEventHandler::add_parameter_callback(
   handle->node_name = full_node_name;
   // the last callback registered is executed first.
   callbacks_->parameter_callbacks_[{parameter_name, full_node_name}].emplace_front(handle);
+  update_content_filter();
 
   return handle;
 }
@@ -91,6 +109,7 @@ ParameterEventHandler::remove_parameter_callback(
     container.erase(it);
     if (container.empty()) {
       callbacks_->parameter_callbacks_.erase({handle->parameter_name, handle->node_name});
+      update_content_filter();
     }
   } else {
     throw std::runtime_error("Callback doesn't exist");
@@ -166,30 +185,102 @@ ParameterEventHandler::Callbacks::event_callback(const rcl_interfaces::msg::Para
 {
   std::lock_guard<std::recursive_mutex> lock(mutex_);
 
-  for (auto it = parameter_callbacks_.begin(); it != parameter_callbacks_.end(); ++it) {
-    rclcpp::Parameter p;
-    if (get_parameter_from_event(event, p, it->first.first, it->first.second)) {
-      for (auto cb = it->second.begin(); cb != it->second.end(); ++cb) {
-        auto shared_handle = cb->lock();
-        if (nullptr != shared_handle) {
-          shared_handle->callback(p);
-        } else {
-          cb = it->second.erase(cb);
+  if (!parameter_callbacks_.empty()) {
+    // Besides the exact node name, the callbacks of the namespace wildcard are called.
+    const std::string namespace_wildcard =
+      event.node.substr(0, event.node.rfind('/') + 1) + kNodeNameWildcard;
+    const std::string * const node_names[] = {&event.node, &namespace_wildcard};
+
+    // Look the changed parameters up, instead of matching every registered callback.
+    auto dispatch =
+      [this, &node_names](const rcl_interfaces::msg::Parameter & parameter_msg) {
+        for (const std::string * node_name : node_names) {
+          auto it = parameter_callbacks_.find({parameter_msg.name, *node_name});
+          if (it == parameter_callbacks_.end()) {
+            continue;
+          }
+          // Take the callbacks first, so that they can be removed while being called.
+          std::vector<ParameterCallbackHandle::SharedPtr> handles;
+          for (auto cb = it->second.begin(); cb != it->second.end(); ) {
+            auto shared_handle = cb->lock();
+            if (nullptr != shared_handle) {
+              handles.push_back(std::move(shared_handle));
+              ++cb;
+            } else {
+              cb = it->second.erase(cb);
+            }
+          }
+          if (handles.empty()) {
+            continue;
+          }
+          const auto parameter = rclcpp::Parameter::from_parameter_msg(parameter_msg);
+          for (const auto & handle : handles) {
+            handle->callback(parameter);
+          }
         }
-      }
+      };
+    for (const auto & new_parameter : event.new_parameters) {
+      dispatch(new_parameter);
+    }
+    for (const auto & changed_parameter : event.changed_parameters) {
+      dispatch(changed_parameter);
     }
   }
 
-  for (auto event_cb = event_callbacks_.begin(); event_cb != event_callbacks_.end(); ++event_cb) {
+  for (auto event_cb = event_callbacks_.begin(); event_cb != event_callbacks_.end(); ) {
     auto shared_event_handle = event_cb->lock();
     if (nullptr != shared_event_handle) {
       shared_event_handle->callback(event);
+      ++event_cb;
     } else {
       event_cb = event_callbacks_.erase(event_cb);
     }
   }
 }
 
+void
+ParameterEventHandler::update_content_filter()
+{
+  // The nodes given to the constructor are always filtered.
+  if (!node_names_.empty() || !content_filter_supported_ || nullptr == event_subscription_) {
+    return;
+  }
+
+  // Only the nodes of the parameter callbacks are needed, unless any events are.
+  std::vector<std::string> node_names;
+  bool filter = callbacks_->event_callbacks_.empty();
+  for (const auto & kv : callbacks_->parameter_callbacks_) {
+    if (!filter) {
+      break;
+    }
+    const std::string & node_name = kv.first.second;
+    if (is_node_name_wildcard(node_name)) {
+      filter = false;
+    } else if (std::find(node_names.begin(), node_names.end(), node_name) == node_names.end()) {
+      node_names.push_back(node_name);
+    }
+  }
+  rclcpp::ContentFilterOptions content_filter;
+  if (filter) {
+    content_filter = make_node_names_content_filter(node_names);
+  }
+  if (
+    content_filter.filter_expression == content_filter_.filter_expression &&
+    content_filter.expression_parameters == content_filter_.expression_parameters)
+  {
+    return;
+  }
+
+  try {
+    event_subscription_->set_content_filter(
+      content_filter.filter_expression, content_filter.expression_parameters);
+    content_filter_ = std::move(content_filter);
+  } catch (const rclcpp::exceptions::RCLError &) {
+    // The events are only dispatched to the matching callbacks on reception.
+    content_filter_supported_ = false;
+  }
+}
+
 std::string
 ParameterEventHandler::resolve_path(const std::string & path)
 {
@@ -209,4 +300,24 @@ ParameterEventHandler::resolve_path(const std::string & path)
   return full_path;
 }
 
+rclcpp::ContentFilterOptions
+ParameterEventHandler::make_node_names_content_filter(const std::vector<std::string> & node_names)
+{
+  // The number of expression parameters is limited, so many nodes are only filtered on reception.
+  constexpr size_t max_expression_parameters = 100;
+  rclcpp::ContentFilterOptions content_filter_options;
+  if (node_names.empty() || node_names.size() > max_expression_parameters) {
+    return content_filter_options;
+  }
+
+  std::vector<std::string> conditions;
+  conditions.reserve(node_names.size());
+  for (size_t i = 0; i < node_names.size(); ++i) {
+    conditions.push_back("node = %" + std::to_string(i));
+    content_filter_options.expression_parameters.push_back("'" + node_names[i] + "'");
+  }
+  content_filter_options.filter_expression = rcpputils::join(conditions, " OR ");
+  return content_filter_options;
+}
+
 }  // namespace rclcpp
@@ -23,6 +23,7 @@
 #include <sstream>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "rcutils/logging_macros.h"
@@ -37,6 +38,7 @@
 #include "rclcpp/macros.hpp"
 #include "rclcpp/network_flow_endpoint.hpp"
 #include "rclcpp/node.hpp"
+#include "rclcpp/topic_statistics/publisher_topic_statistics.hpp"
 #include "rclcpp/event_handler.hpp"
 
 using rclcpp::PublisherBase;
@@ -103,11 +105,13 @@ PublisherBase::PublisherBase(
   }
 
   bind_event_callbacks(event_callbacks_, use_default_callbacks);
+  cache_subscription_count();
 }
 
 PublisherBase::~PublisherBase()
 {
   // must fini the events before fini-ing the publisher
+  matched_event_handler_.reset();
   event_handlers_.clear();
 
   auto ipm = weak_ipm_.lock();
@@ -190,6 +194,34 @@ PublisherBase::bind_event_callbacks(
   }
 }
 
+void
+PublisherBase::cache_subscription_count()
+{
+  // The middleware keeps a single "on ready" callback per event, which executors may replace
+  // when the user handles the matched events.
+  if (event_callbacks_.matched_callback) {
+    return;
+  }
+  try {
+    auto handler = std::make_shared<EventHandler<PublisherMatchedCallbackType,
+        std::shared_ptr<rcl_publisher_t>>>(
+      [](MatchedInfo &) {},
+      rcl_publisher_event_init,
+      publisher_handle_,
+      RCL_PUBLISHER_MATCHED);
+    handler->set_on_ready_callback(
+      [this](size_t, int) {
+        subscription_count_outdated_.store(true);
+      });
+    matched_event_handler_ = handler;
+  } catch (const rclcpp::exceptions::RCLErrorBase & /*exc*/) {
+    // e.g. UnsupportedEventTypeException
+    RCLCPP_DEBUG(
+      rclcpp::get_logger("rclcpp"),
+      "Failed to add event handler for matched subscriptions, the count isn't cached");
+  }
+}
+
 size_t
 PublisherBase::get_queue_size() const
 {
@@ -267,7 +299,33 @@ PublisherBase::get_intra_process_subscription_count() const
             "intra process subscriber count called after "
             "destruction of intra process manager");
   }
-  return ipm->get_subscription_count(intra_process_publisher_id_);
+  return intra_process_subscription_count_.load();
+}
+
+bool
+PublisherBase::has_any_subscribers() const
+{
+  return intra_process_subscription_count_.load() > 0 || get_cached_subscription_count() > 0;
+}
+
+bool
+PublisherBase::has_inter_process_subscriptions() const
+{
+  const size_t intra_process_subscription_count = intra_process_subscription_count_.load();
+  return get_cached_subscription_count() > intra_process_subscription_count;
+}
+
+size_t
+PublisherBase::get_cached_subscription_count() const
+{
+  if (!matched_event_handler_) {
+    return get_subscription_count();
+  }
+  // A matched event received during the query outdates the count again
+  if (subscription_count_outdated_.exchange(false)) {
+    subscription_count_.store(get_subscription_count());
+  }
+  return subscription_count_.load();
 }
 
 rclcpp::QoS
@@ -289,6 +347,12 @@ PublisherBase::assert_liveliness() const
   return RCL_RET_OK == rcl_publisher_assert_liveliness(publisher_handle_.get());
 }
 
+bool
+PublisherBase::is_serialized() const
+{
+  return false;
+}
+
 bool
 PublisherBase::can_loan_messages() const
 {
@@ -324,6 +388,19 @@ PublisherBase::setup_intra_process(
   intra_process_is_enabled_ = true;
 }
 
+void
+PublisherBase::set_intra_process_subscription_count(size_t count)
+{
+  intra_process_subscription_count_.store(count);
+}
+
+void
+PublisherBase::set_topic_statistics(
+  std::shared_ptr<rclcpp::topic_statistics::PublisherTopicStatistics> topic_statistics)
+{
+  topic_statistics_ = std::move(topic_statistics);
+}
+
 void
 PublisherBase::default_incompatible_qos_callback(
   rclcpp::QOSOfferedIncompatibleQoSInfo & event) const
@@ -81,4 +81,17 @@ QosOverridingOptions::get_validation_callback() const
   return validation_callback_;
 }
 
+QosOverridingOptions &
+QosOverridingOptions::declare_only_overridden(bool declare_only_overridden)
+{
+  declare_only_overridden_ = declare_only_overridden;
+  return *this;
+}
+
+bool
+QosOverridingOptions::get_declare_only_overridden() const
+{
+  return declare_only_overridden_;
+}
+
 }  // namespace rclcpp
@@ -14,7 +14,9 @@
 
 #include "rclcpp/rate.hpp"
 
+#include <algorithm>
 #include <chrono>
+#include <cstdint>
 #include <stdexcept>
 
 namespace rclcpp
@@ -22,7 +24,7 @@ namespace rclcpp
 
 Rate::Rate(
   const double rate, Clock::SharedPtr clock)
-: clock_(clock), period_(0, 0), last_interval_(clock_->now())
+: clock_(clock), sleeper_(clock_), period_(0, 0), last_interval_(clock_->now())
 {
   if (rate <= 0.0) {
     throw std::invalid_argument{"rate must be greater than 0"};
@@ -32,7 +34,7 @@ Rate::Rate(
 
 Rate::Rate(
   const Duration & period, Clock::SharedPtr clock)
-: clock_(clock), period_(period), last_interval_(clock_->now())
+: clock_(clock), sleeper_(clock_), period_(period), last_interval_(clock_->now())
 {
   if (period <= Duration(0, 0)) {
     throw std::invalid_argument{"period must be greater than 0"};
@@ -42,6 +44,9 @@ Rate::Rate(
 bool
 Rate::sleep()
 {
+  if (overrun_policy_ == OverrunPolicy::KeepPhase) {
+    return sleep_keeping_phase();
+  }
   // Time coming into sleep
   auto now = clock_->now();
   // Time of next interval
@@ -58,19 +63,70 @@ Rate::sleep()
     // If an entire cycle was missed then reset next interval.
     // This might happen if the loop took more than a cycle.
     // Or if time jumps forward.
+    uint64_t missed_cycles = 0;
     if (now > next_interval + period_) {
+      missed_cycles = static_cast<uint64_t>((now - next_interval).nanoseconds() /
+        period_.nanoseconds());
       last_interval_ = now + period_;
     }
+    record_cycle(next_interval, now, true, missed_cycles);
     // Either way do not sleep and return false
     return false;
   }
   // Calculate the time to sleep
   auto time_to_sleep = next_interval - now;
   // Sleep (will get interrupted by ctrl-c, may not sleep full time)
-  clock_->sleep_for(time_to_sleep);
+  sleeper_.sleep_for(time_to_sleep);
+  record_cycle(next_interval, clock_->now(), false, 0);
   return true;
 }
 
+bool
+Rate::sleep_keeping_phase()
+{
+  auto now = clock_->now();
+  if (now < last_interval_) {
+    // The time jumped backwards, start the cycles again from now
+    last_interval_ = now;
+  }
+  const Time cycle_end = last_interval_ + period_;
+  if (cycle_end <= now) {
+    // Skip the cycles which ended already, the next one ends at a whole period
+    const auto missed_cycles = static_cast<uint64_t>((now - cycle_end).nanoseconds() /
+      period_.nanoseconds());
+    last_interval_ = cycle_end + Duration::from_nanoseconds(
+      static_cast<int64_t>(missed_cycles) * period_.nanoseconds());
+    record_cycle(cycle_end, now, true, missed_cycles);
+    return false;
+  }
+  last_interval_ = cycle_end;
+  // Sleep until an absolute time, so that the time of this call doesn't shift the cycles
+  const bool slept = sleeper_.sleep_until(cycle_end);
+  record_cycle(cycle_end, clock_->now(), false, 0);
+  return slept;
+}
+
+void
+Rate::record_cycle(const Time & cycle_end, const Time & now, bool overrun, uint64_t missed_cycles)
+{
+  statistics_.cycle_count++;
+  if (overrun) {
+    statistics_.overrun_count++;
+  }
+  statistics_.missed_cycles += missed_cycles;
+  const std::chrono::nanoseconds lateness(
+    std::max<int64_t>((now - cycle_end).nanoseconds(), 0));
+  statistics_.max_lateness = std::max(statistics_.max_lateness, lateness);
+  // Below 1us in the first bucket, then one bucket per power of two of microseconds
+  size_t bucket = 0;
+  for (int64_t us = lateness.count() / 1000; us > 0 &&
+    bucket + 1 < RateStatistics::lateness_histogram_size; us >>= 1)
+  {
+    bucket++;
+  }
+  statistics_.lateness_histogram[bucket]++;
+}
+
 bool
 Rate::is_steady() const
 {
@@ -95,6 +151,30 @@ Rate::period() const
   return std::chrono::nanoseconds(period_.nanoseconds());
 }
 
+void
+Rate::set_overrun_policy(OverrunPolicy policy)
+{
+  overrun_policy_ = policy;
+}
+
+Rate::OverrunPolicy
+Rate::get_overrun_policy() const
+{
+  return overrun_policy_;
+}
+
+RateStatistics
+Rate::get_statistics() const
+{
+  return statistics_;
+}
+
+void
+Rate::reset_statistics()
+{
+  statistics_ = RateStatistics();
+}
+
 WallRate::WallRate(const double rate)
 : Rate(rate, std::make_shared<Clock>(RCL_STEADY_TIME))
 {}
@@ -0,0 +1,336 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "rclcpp/serialized_field_extractor.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include "rcpputils/endian.hpp"
+#include "rosidl_typesupport_introspection_cpp/field_types.hpp"
+#include "rosidl_typesupport_introspection_cpp/identifier.hpp"
+#include "rosidl_typesupport_introspection_cpp/message_introspection.hpp"
+
+#include "rclcpp/typesupport_helpers.hpp"
+
+namespace introspection = rosidl_typesupport_introspection_cpp;
+
+namespace
+{
+
+// Size of the encapsulation header preceding the CDR data, which is the origin of the alignment
+constexpr size_t kEncapsulationHeaderSize = 4;
+
+// Size of the values of a primitive type, zero for the other types
+size_t
+primitive_size(uint8_t type_id)
+{
+  switch (type_id) {
+    case introspection::ROS_TYPE_BOOLEAN:
+    case introspection::ROS_TYPE_OCTET:
+    case introspection::ROS_TYPE_CHAR:
+    case introspection::ROS_TYPE_UINT8:
+    case introspection::ROS_TYPE_INT8:
+      return 1;
+    case introspection::ROS_TYPE_UINT16:
+    case introspection::ROS_TYPE_INT16:
+      return 2;
+    case introspection::ROS_TYPE_FLOAT:
+    case introspection::ROS_TYPE_UINT32:
+    case introspection::ROS_TYPE_INT32:
+      return 4;
+    case introspection::ROS_TYPE_DOUBLE:
+    case introspection::ROS_TYPE_UINT64:
+    case introspection::ROS_TYPE_INT64:
+      return 8;
+    default:
+      return 0;
+  }
+}
+
+uint32_t
+load_uint32(const uint8_t * data, bool swap)
+{
+  uint8_t bytes[4];
+  for (size_t i = 0; i < 4; ++i) {
+    bytes[i] = data[swap ? 3 - i : i];
+  }
+  uint32_t value = 0;
+  std::memcpy(&value, bytes, 4);
+  return value;
+}
+
+bool
+is_sequence(const introspection::MessageMember & member)
+{
+  return member.is_array_ && (member.array_size_ == 0 || member.is_upper_bound_);
+}
+
+const introspection::MessageMembers *
+get_members(const rosidl_message_type_support_t * type_support)
+{
+  const rosidl_message_type_support_t * introspection_type_support =
+    get_message_typesupport_handle(type_support, introspection::typesupport_identifier);
+  if (!introspection_type_support) {
+    throw std::invalid_argument("the type support doesn't provide the introspection of the type");
+  }
+  return static_cast<const introspection::MessageMembers *>(introspection_type_support->data);
+}
+
+std::string
+get_type_name(const introspection::MessageMembers * members)
+{
+  return std::string(members->message_namespace_) + "::" + members->message_name_;
+}
+
+// Check that the member can be skipped, which requires knowing the size of its values
+void
+check_skippable(const introspection::MessageMember & member)
+{
+  if (member.type_id_ == introspection::ROS_TYPE_MESSAGE) {
+    const introspection::MessageMembers * members = get_members(member.members_);
+    for (uint32_t i = 0; i < members->member_count_; ++i) {
+      check_skippable(members->members_[i]);
+    }
+  } else if (member.type_id_ != introspection::ROS_TYPE_STRING &&
+    primitive_size(member.type_id_) == 0)
+  {
+    throw std::invalid_argument(
+            "field '" + std::string(member.name_) + "' of unsupported type precedes the field");
+  }
+}
+
+/// Cursor over plain CDR data, which only reads what is needed to skip values.
+class CdrReader
+{
+public:
+  explicit CdrReader(const rclcpp::SerializedMessageView & message)
+  : data_(message.data()), size_(message.size()), offset_(kEncapsulationHeaderSize)
+  {
+    if (size_ < kEncapsulationHeaderSize) {
+      throw std::runtime_error("serialized message is too short to hold CDR data");
+    }
+    // The representation identifier is big endian, CDR_BE is 0x0000 and CDR_LE is 0x0001
+    if (data_[0] != 0 || data_[1] > 1) {
+      throw std::runtime_error("serialized message isn't plain CDR data");
+    }
+    const bool little_endian = data_[1] == 1;
+    swap_ = little_endian != (rcpputils::endian::native == rcpputils::endian::little);
+  }
+
+  bool
+  swap() const
+  {
+    return swap_;
+  }
+
+  void
+  align(size_t alignment)
+  {
+    const size_t position = offset_ - kEncapsulationHeaderSize;
+    offset_ += (alignment - position % alignment) % alignment;
+  }
+
+  // Get a pointer to the next size bytes, after checking that they are in the data
+  const uint8_t *
+  peek(size_t size) const
+  {
+    if (offset_ > size_ || size_ - offset_ < size) {
+      throw std::runtime_error("serialized message is truncated");
+    }
+    return data_ + offset_;
+  }
+
+  void
+  skip(size_t count, size_t size)
+  {
+    if (offset_ > size_ || count > (size_ - offset_) / size) {
+      throw std::runtime_error("serialized message is truncated");
+    }
+    offset_ += count * size;
+  }
+
+  uint32_t
+  read_uint32()
+  {
+    align(4);
+    const uint32_t value = load_uint32(peek(4), swap_);
+    offset_ += 4;
+    return value;
+  }
+
+  void
+  skip_members(const introspection::MessageMembers * members, uint32_t count)
+  {
+    for (uint32_t i = 0; i < count; ++i) {
+      skip_member(members->members_[i]);
+    }
+  }
+
+  void
+  skip_member(const introspection::MessageMember & member)
+  {
+    size_t count = 1;
+    if (is_sequence(member)) {
+      count = read_uint32();
+    } else if (member.is_array_) {
+      count = member.array_size_;
+    }
+    if (count == 0) {
+      return;
+    }
+    const size_t size = primitive_size(member.type_id_);
+    if (size != 0) {
+      align(size);
+      skip(count, size);
+    } else if (member.type_id_ == introspection::ROS_TYPE_STRING) {
+      for (size_t i = 0; i < count; ++i) {
+        // The length includes the terminating null character
+        skip(read_uint32(), 1);
+      }
+    } else {
+      const introspection::MessageMembers * members = get_members(member.members_);
+      for (size_t i = 0; i < count; ++i) {
+        skip_members(members, members->member_count_);
+      }
+    }
+  }
+
+private:
+  const uint8_t * data_;
+  size_t size_;
+  size_t offset_;
+  bool swap_;
+};
+
+}  // namespace
+
+namespace rclcpp
+{
+
+SerializedFieldExtractor::SerializedFieldExtractor(
+  const std::string & type,
+  const std::string & field_path)
+: library_(rclcpp::get_typesupport_library(type, introspection::typesupport_identifier)),
+  field_path_(field_path)
+{
+  compile(
+    rclcpp::get_message_typesupport_handle(
+      type, introspection::typesupport_identifier, *library_));
+}
+
+SerializedFieldExtractor::SerializedFieldExtractor(
+  const rosidl_message_type_support_t * type_support,
+  const std::string & field_path)
+: field_path_(field_path)
+{
+  if (!type_support) {
+    throw std::invalid_argument("type support is nullptr");
+  }
+  compile(type_support);
+}
+
+void
+SerializedFieldExtractor::compile(const rosidl_message_type_support_t * type_support)
+{
+  const introspection::MessageMembers * members = get_members(type_support);
+  size_t begin = 0;
+  while (true) {
+    const size_t end = field_path_.find('.', begin);
+    const std::string name = field_path_.substr(begin, end - begin);
+    uint32_t index = 0;
+    while (index < members->member_count_ && name != members->members_[index].name_) {
+      ++index;
+    }
+    if (index == members->member_count_) {
+      throw std::invalid_argument(
+              "message type '" + get_type_name(members) + "' has no field '" + name + "'");
+    }
+    for (uint32_t i = 0; i < index; ++i) {
+      check_skippable(members->members_[i]);
+    }
+    steps_.push_back({members, index});
+
+    const introspection::MessageMember & member = members->members_[index];
+    if (member.is_array_) {
+      throw std::invalid_argument(
+              "field '" + name + "' of path '" + field_path_ + "' is an array or a sequence");
+    }
+    if (end == std::string::npos) {
+      if (member.type_id_ != introspection::ROS_TYPE_STRING &&
+        primitive_size(member.type_id_) == 0)
+      {
+        throw std::invalid_argument(
+                "field '" + field_path_ + "' isn't a primitive or a string");
+      }
+      field_type_id_ = member.type_id_;
+      return;
+    }
+    if (member.type_id_ != introspection::ROS_TYPE_MESSAGE) {
+      throw std::invalid_argument(
+              "field '" + name + "' of path '" + field_path_ + "' isn't a message");
+    }
+    members = get_members(member.members_);
+    begin = end + 1;
+  }
+}
+
+const std::string &
+SerializedFieldExtractor::get_field_path() const
+{
+  return field_path_;
+}
+
+uint8_t
+SerializedFieldExtractor::get_field_type_id() const
+{
+  return field_type_id_;
+}
+
+const uint8_t *
+SerializedFieldExtractor::find_field(
+  const rclcpp::SerializedMessageView & message, size_t size, bool & swap) const
+{
+  CdrReader reader(message);
+  for (const Step & step : steps_) {
+    reader.skip_members(step.members, step.field_index);
+  }
+  reader.align(size);
+  swap = reader.swap();
+  return reader.peek(size);
+}
+
+std::string
+SerializedFieldExtractor::extract_string(const rclcpp::SerializedMessageView & message) const
+{
+  if (field_type_id_ != introspection::ROS_TYPE_STRING) {
+    throw std::invalid_argument("field '" + field_path_ + "' isn't a string");
+  }
+  bool swap = false;
+  const uint8_t * data = find_field(message, 4, swap);
+  const uint32_t length = load_uint32(data, swap);
+  // The length includes the terminating null character
+  const size_t available = message.size() - static_cast<size_t>(data + 4 - message.data());
+  if (length > available) {
+    throw std::runtime_error("serialized message is truncated");
+  }
+  return std::string(reinterpret_cast<const char *>(data + 4), length > 0 ? length - 1 : 0);
+}
+
+}  // namespace rclcpp
@@ -0,0 +1,106 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rclcpp/serialized_message_pool.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+using rclcpp::SerializedMessagePool;
+
+struct SerializedMessagePool::State
+{
+  State(size_t max_free_messages, const rcl_allocator_t & allocator)
+  : max_free_messages(max_free_messages), allocator(allocator)
+  {}
+
+  void
+  release(rclcpp::SerializedMessage * message)
+  {
+    std::unique_ptr<rclcpp::SerializedMessage> owned_message(message);
+    std::lock_guard<std::mutex> lock(mutex);
+    high_water_mark = std::max(high_water_mark, owned_message->size());
+    if (free_messages.size() < max_free_messages) {
+      owned_message->get_rcl_serialized_message().buffer_length = 0u;
+      free_messages.push_back(std::move(owned_message));
+    }
+  }
+
+  const size_t max_free_messages;
+  const rcl_allocator_t allocator;
+
+  mutable std::mutex mutex;
+  std::vector<std::unique_ptr<rclcpp::SerializedMessage>> free_messages;
+  size_t high_water_mark = 0u;
+};
+
+SerializedMessagePool::SerializedMessagePool(
+  size_t max_free_messages, const rcl_allocator_t & allocator)
+: state_(std::make_shared<State>(max_free_messages, allocator))
+{
+  state_->free_messages.reserve(max_free_messages);
+}
+
+SerializedMessagePool::~SerializedMessagePool()
+{}
+
+std::shared_ptr<rclcpp::SerializedMessage>
+SerializedMessagePool::acquire()
+{
+  std::unique_ptr<rclcpp::SerializedMessage> message;
+  size_t capacity = 0u;
+  {
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    capacity = state_->high_water_mark;
+    if (!state_->free_messages.empty()) {
+      message = std::move(state_->free_messages.back());
+      state_->free_messages.pop_back();
+    }
+  }
+  // Allocate outside of the lock, other threads may be returning messages
+  if (!message) {
+    message = std::make_unique<rclcpp::SerializedMessage>(capacity, state_->allocator);
+  } else if (message->capacity() < capacity) {
+    message->reserve(capacity);
+  }
+
+  std::weak_ptr<State> weak_state = state_;
+  return std::shared_ptr<rclcpp::SerializedMessage>(
+    message.release(),
+    [weak_state](rclcpp::SerializedMessage * message) {
+      auto state = weak_state.lock();
+      if (state) {
+        state->release(message);
+      } else {
+        delete message;
+      }
+    });
+}
+
+size_t
+SerializedMessagePool::get_high_water_mark() const
+{
+  std::lock_guard<std::mutex> lock(state_->mutex);
+  return state_->high_water_mark;
+}
+
+size_t
+SerializedMessagePool::get_number_of_free_messages() const
+{
+  std::lock_guard<std::mutex> lock(state_->mutex);
+  return state_->free_messages.size();
+}
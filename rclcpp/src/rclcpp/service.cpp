@@ -18,9 +18,12 @@
 #include <iostream>
 #include <memory>
 #include <sstream>
+#include <stdexcept>
 #include <string>
+#include <utility>
 
 #include "rclcpp/any_service_callback.hpp"
+#include "rclcpp/experimental/intra_process_manager.hpp"
 #include "rclcpp/macros.hpp"
 #include "rclcpp/qos.hpp"
 #include "rmw/error_handling.h"
@@ -33,6 +36,17 @@ ServiceBase::ServiceBase(std::shared_ptr<rcl_node_t> node_handle)
   node_logger_(rclcpp::get_node_logger(node_handle_.get()))
 {}
 
+ServiceBase::~ServiceBase()
+{
+  if (!service_intra_process_) {
+    return;
+  }
+  auto ipm = weak_ipm_.lock();
+  if (ipm) {
+    ipm->remove_service(intra_process_service_id_);
+  }
+}
+
 
 bool
 ServiceBase::take_type_erased_request(void * request_out, rmw_request_id_t & request_id_out)
@@ -49,6 +63,21 @@ ServiceBase::take_type_erased_request(void * request_out, rmw_request_id_t & req
   return true;
 }
 
+void
+ServiceBase::set_max_batch_size(size_t max_batch_size)
+{
+  if (max_batch_size == 0) {
+    throw std::invalid_argument("max_batch_size must be greater than zero");
+  }
+  max_batch_size_.store(max_batch_size);
+}
+
+size_t
+ServiceBase::get_max_batch_size() const
+{
+  return max_batch_size_.load();
+}
+
 const char *
 ServiceBase::get_service_name()
 {
@@ -136,3 +165,29 @@ ServiceBase::set_on_new_request_callback(rcl_event_callback_t callback, const vo
       ret, "failed to set the on new request callback for service");
   }
 }
+
+std::shared_ptr<rclcpp::CallbackGroup>
+ServiceBase::get_callback_group() const
+{
+  return callback_group_.lock();
+}
+
+rclcpp::Waitable::SharedPtr
+ServiceBase::get_intra_process_waitable() const
+{
+  return service_intra_process_;
+}
+
+void
+ServiceBase::add_intra_process_service(
+  rclcpp::experimental::ServiceIntraProcessBase::SharedPtr service_intra_process,
+  rclcpp::Context & context)
+{
+  if (service_intra_process_) {
+    throw std::runtime_error("intra-process is already set up for the service");
+  }
+  auto ipm = rclcpp::experimental::IntraProcessManager::get_instance(context);
+  intra_process_service_id_ = ipm->add_service(service_intra_process);
+  weak_ipm_ = ipm;
+  service_intra_process_ = std::move(service_intra_process);
+}
@@ -14,8 +14,10 @@
 
 #include "rclcpp/subscription_base.hpp"
 
+#include <chrono>
 #include <cstdio>
 #include <memory>
+#include <stdexcept>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -28,6 +30,7 @@
 #include "rclcpp/experimental/intra_process_manager.hpp"
 #include "rclcpp/logging.hpp"
 #include "rclcpp/node_interfaces/node_base_interface.hpp"
+#include "rclcpp/tracing.hpp"
 #include "rclcpp/event_handler.hpp"
 
 #include "rmw/error_handling.h"
@@ -90,6 +93,15 @@ SubscriptionBase::SubscriptionBase(
   }
 
   bind_event_callbacks(event_callbacks_, use_default_callbacks);
+
+  const rmw_subscription_content_filter_options_t * content_filter_options =
+    subscription_options.rmw_subscription_options.content_filter_options;
+  if (content_filter_options && content_filter_options->filter_expression) {
+    const rcutils_string_array_t & parameters = content_filter_options->expression_parameters;
+    update_content_filter(
+      content_filter_options->filter_expression,
+      std::vector<std::string>(parameters.data, parameters.data + parameters.size));
+  }
 }
 
 SubscriptionBase::~SubscriptionBase()
@@ -210,20 +222,24 @@ SubscriptionBase::get_actual_qos() const
 }
 
 bool
-SubscriptionBase::take_type_erased(void * message_out, rclcpp::MessageInfo & message_info_out)
+SubscriptionBase::take_type_erased(
+  void * message_out,
+  rclcpp::MessageInfo & message_info_out,
+  bool fill_message_info)
 {
   rcl_ret_t ret = rcl_take(
     this->get_subscription_handle().get(),
     message_out,
-    &message_info_out.get_rmw_message_info(),
+    message_info_to_take(message_info_out, fill_message_info),
     nullptr  // rmw_subscription_allocation_t is unused here
   );
-  TRACETOOLS_TRACEPOINT(rclcpp_take, static_cast<const void *>(message_out));
+  RCLCPP_TRACEPOINT(Subscription, rclcpp_take, static_cast<const void *>(message_out));
   if (RCL_RET_SUBSCRIPTION_TAKE_FAILED == ret) {
     return false;
   } else if (RCL_RET_OK != ret) {
     rclcpp::exceptions::throw_from_rcl_error(ret);
   }
+  capture_receive_stamp(message_info_out);
   if (
     matches_any_intra_process_publishers(&message_info_out.get_rmw_message_info().publisher_gid))
   {
@@ -234,21 +250,75 @@ SubscriptionBase::take_type_erased(void * message_out, rclcpp::MessageInfo & mes
   return true;
 }
 
+std::shared_ptr<void>
+SubscriptionBase::take_loaned_message(
+  rclcpp::MessageInfo & message_info_out,
+  bool fill_message_info)
+{
+  void * loaned_message = nullptr;
+  rcl_ret_t ret = rcl_take_loaned_message(
+    this->get_subscription_handle().get(),
+    &loaned_message,
+    message_info_to_take(message_info_out, fill_message_info),
+    nullptr);
+  if (RCL_RET_SUBSCRIPTION_TAKE_FAILED == ret) {
+    return nullptr;
+  } else if (RCL_RET_OK != ret) {
+    rclcpp::exceptions::throw_from_rcl_error(ret);
+  }
+  capture_receive_stamp(message_info_out);
+  // The deleter keeps the subscription alive, and subscriptions can return loans concurrently
+  std::shared_ptr<rcl_subscription_t> subscription_handle = subscription_handle_;
+  return std::shared_ptr<void>(
+    loaned_message,
+    [subscription_handle, logger = node_logger_](void * message) {
+      rcl_ret_t ret = rcl_return_loaned_message_from_subscription(
+        subscription_handle.get(), message);
+      if (RCL_RET_OK != ret) {
+        RCLCPP_ERROR(
+          logger,
+          "rcl_return_loaned_message_from_subscription() failed for subscription on topic "
+          "'%s': %s",
+          rcl_subscription_get_topic_name(subscription_handle.get()),
+          rcl_get_error_string().str);
+        rcl_reset_error();
+      }
+    });
+}
+
+void
+SubscriptionBase::handle_shared_loaned_message(
+  const std::shared_ptr<void> & loaned_message,
+  const rclcpp::MessageInfo & message_info)
+{
+  handle_loaned_message(loaned_message.get(), message_info);
+}
+
 bool
 SubscriptionBase::take_serialized(
   rclcpp::SerializedMessage & message_out,
-  rclcpp::MessageInfo & message_info_out)
+  rclcpp::MessageInfo & message_info_out,
+  bool fill_message_info)
 {
   rcl_ret_t ret = rcl_take_serialized_message(
     this->get_subscription_handle().get(),
     &message_out.get_rcl_serialized_message(),
-    &message_info_out.get_rmw_message_info(),
+    message_info_to_take(message_info_out, fill_message_info),
     nullptr);
   if (RCL_RET_SUBSCRIPTION_TAKE_FAILED == ret) {
     return false;
   } else if (RCL_RET_OK != ret) {
     rclcpp::exceptions::throw_from_rcl_error(ret);
   }
+  capture_receive_stamp(message_info_out);
+  if (
+    subscription_intra_process_ && subscription_intra_process_->is_serialized() &&
+    matches_any_intra_process_publishers(&message_info_out.get_rmw_message_info().publisher_gid))
+  {
+    // In this case, the message will be delivered via intra-process and
+    // we should ignore this copy of the message.
+    return false;
+  }
   return true;
 }
 
@@ -270,6 +340,128 @@ SubscriptionBase::get_delivered_message_kind() const
   return delivered_message_kind_;
 }
 
+void
+SubscriptionBase::set_max_batch_size(size_t max_batch_size)
+{
+  if (max_batch_size == 0) {
+    throw std::invalid_argument("max_batch_size must be greater than zero");
+  }
+  max_batch_size_.store(max_batch_size);
+}
+
+size_t
+SubscriptionBase::get_max_batch_size() const
+{
+  return max_batch_size_.load();
+}
+
+void
+SubscriptionBase::set_deserialize_after_take(bool deserialize_after_take)
+{
+  deserialize_after_take_.store(deserialize_after_take);
+}
+
+bool
+SubscriptionBase::get_deserialize_after_take() const
+{
+  return deserialize_after_take_.load();
+}
+
+void
+SubscriptionBase::set_max_rate(double max_rate)
+{
+  rate_limiter_.set_max_rate(max_rate);
+}
+
+double
+SubscriptionBase::get_max_rate() const
+{
+  return rate_limiter_.get_max_rate();
+}
+
+bool
+SubscriptionBase::try_accept_message_at_max_rate()
+{
+  return rate_limiter_.try_accept();
+}
+
+rclcpp::SubscriptionBacklog
+SubscriptionBase::get_backlog() const
+{
+  rclcpp::SubscriptionBacklog backlog;
+  backlog.topic_name = get_topic_name();
+  backlog.uses_intra_process = use_intra_process_ && subscription_intra_process_;
+  if (backlog.uses_intra_process) {
+    // The buffers are sized with the QoS depth, but only report their free capacity
+    const size_t capacity = subscription_intra_process_->get_actual_qos().depth();
+    const size_t available = subscription_intra_process_->available_capacity();
+    backlog.intra_process_capacity = capacity;
+    backlog.intra_process_queued = available < capacity ? capacity - available : 0;
+    backlog.intra_process_dropped = subscription_intra_process_->get_dropped_count();
+  }
+  return backlog;
+}
+
+bool
+SubscriptionBase::needs_message_info() const
+{
+  return needs_message_info_ || use_intra_process_;
+}
+
+bool
+SubscriptionBase::captures_receive_stamp() const
+{
+  return capture_receive_stamp_;
+}
+
+void
+SubscriptionBase::set_message_info_usage(bool needs_message_info, bool capture_receive_stamp)
+{
+  needs_message_info_ = needs_message_info;
+  capture_receive_stamp_ = capture_receive_stamp;
+}
+
+rmw_message_info_t *
+SubscriptionBase::message_info_to_take(
+  rclcpp::MessageInfo & message_info,
+  bool fill_message_info)
+{
+  // The publisher gid of the message info tells apart the inter-process copies of the
+  // intra-process messages, so it's always needed with intra-process communication
+  if (fill_message_info || needs_message_info()) {
+    return &message_info.get_rmw_message_info();
+  }
+  // Left as is, then: the callback doesn't get it and the publisher gid isn't checked
+  return nullptr;
+}
+
+void
+SubscriptionBase::capture_receive_stamp(rclcpp::MessageInfo & message_info) const
+{
+  if (capture_receive_stamp_) {
+    message_info.set_receive_stamp(std::chrono::steady_clock::now());
+  }
+}
+
+std::chrono::steady_clock::time_point
+SubscriptionBase::get_last_message_received_time() const
+{
+  return std::chrono::steady_clock::time_point(
+    std::chrono::nanoseconds(last_message_received_ns_.load(std::memory_order_relaxed)));
+}
+
+void
+SubscriptionBase::add_deadline_watcher()
+{
+  deadline_watchers_.fetch_add(1);
+}
+
+void
+SubscriptionBase::remove_deadline_watcher()
+{
+  deadline_watchers_.fetch_sub(1);
+}
+
 size_t
 SubscriptionBase::get_publisher_count() const
 {
@@ -298,20 +490,7 @@ SubscriptionBase::setup_intra_process(
 bool
 SubscriptionBase::can_loan_messages() const
 {
-  bool retval = rcl_subscription_can_loan_messages(subscription_handle_.get());
-  if (retval) {
-    // TODO(clalancette): The loaned message interface is currently not safe to use with
-    // shared_ptr callbacks.  If a user takes a copy of the shared_ptr, it can get freed from
-    // underneath them via rcl_return_loaned_message_from_subscription().  The correct solution is
-    // to return the loaned message in a custom deleter, but that needs to be carefully handled
-    // with locking.  Warn the user about this until we fix it.
-    RCLCPP_WARN_ONCE(
-      this->node_logger_,
-      "Loaned messages are only safe with const ref subscription callbacks. "
-      "If you are using any other kind of subscriptions, "
-      "set the ROS_DISABLE_LOANED_MESSAGES environment variable to 1 (the default).");
-  }
-  return retval;
+  return rcl_subscription_can_loan_messages(subscription_handle_.get());
 }
 
 rclcpp::Waitable::SharedPtr
@@ -370,7 +549,11 @@ SubscriptionBase::matches_any_intra_process_publishers(const rmw_gid_t * sender_
             "intra process publisher check called "
             "after destruction of intra process manager");
   }
-  return ipm->matches_any_publishers(sender_gid);
+  // Subscriptions to serialized messages only receive intra-process messages
+  // from publishers of serialized messages, and the other way around
+  const bool serialized =
+    subscription_intra_process_ && subscription_intra_process_->is_serialized();
+  return ipm->matches_any_publishers(sender_gid, serialized);
 }
 
 bool
@@ -495,6 +678,38 @@ SubscriptionBase::set_content_filter(
   if (RCL_RET_OK != ret) {
     rclcpp::exceptions::throw_from_rcl_error(ret, "failed to set cft expression parameters");
   }
+  update_content_filter(filter_expression, expression_parameters);
+}
+
+std::shared_ptr<const rclcpp::ContentFilter>
+SubscriptionBase::get_fallback_content_filter() const
+{
+  return std::atomic_load(&fallback_content_filter_);
+}
+
+void
+SubscriptionBase::update_content_filter(
+  const std::string & filter_expression,
+  const std::vector<std::string> & expression_parameters)
+{
+  std::shared_ptr<const rclcpp::ContentFilter> content_filter;
+  if (!filter_expression.empty()) {
+    try {
+      content_filter = std::make_shared<const rclcpp::ContentFilter>(
+        &type_support_, filter_expression, expression_parameters);
+    } catch (const std::exception & exception) {
+      RCLCPP_WARN(
+        node_logger_,
+        "Content filter of topic '%s' can't be evaluated by rclcpp, the messages of intra-process "
+        "publishers, and of all publishers if the middleware doesn't filter, aren't filtered: %s",
+        get_topic_name(), exception.what());
+    }
+  }
+  std::atomic_store(&content_filter_, content_filter);
+  std::atomic_store(&fallback_content_filter_, is_cft_enabled() ? nullptr : content_filter);
+  if (subscription_intra_process_) {
+    subscription_intra_process_->set_content_filter(std::move(content_filter));
+  }
 }
 
 rclcpp::ContentFilterOptions
@@ -547,3 +762,9 @@ SubscriptionBase::take_dynamic_message(
   throw std::runtime_error("Unimplemented");
   return false;
 }
+
+std::shared_ptr<rclcpp::CallbackGroup>
+SubscriptionBase::get_callback_group() const
+{
+  return callback_group_.lock();
+}
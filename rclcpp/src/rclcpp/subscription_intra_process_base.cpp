@@ -12,11 +12,37 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+
 #include "rclcpp/experimental/subscription_intra_process_base.hpp"
 #include "rclcpp/detail/add_guard_condition_to_rcl_wait_set.hpp"
 
+#include "rcpputils/scope_exit.hpp"
+
 using rclcpp::experimental::SubscriptionIntraProcessBase;
 
+namespace
+{
+
+// Number of intra-process subscriptions with a content filter, in the whole process
+std::atomic<size_t> g_content_filter_count{0};
+
+// Number of messages being executed inline by this thread, nested in each other
+thread_local size_t t_inline_depth = 0;
+
+}  // namespace
+
+SubscriptionIntraProcessBase::~SubscriptionIntraProcessBase()
+{
+  if (content_filter_) {
+    g_content_filter_count.fetch_sub(1, std::memory_order_relaxed);
+  }
+}
+
 void
 SubscriptionIntraProcessBase::add_to_wait_set(rcl_wait_set_t * wait_set)
 {
@@ -34,3 +60,63 @@ SubscriptionIntraProcessBase::get_actual_qos() const
 {
   return qos_profile_;
 }
+
+void
+SubscriptionIntraProcessBase::set_content_filter(
+  std::shared_ptr<const rclcpp::ContentFilter> content_filter)
+{
+  const bool filtered = content_filter != nullptr;
+  auto previous = std::atomic_exchange(&content_filter_, std::move(content_filter));
+  if (filtered && !previous) {
+    g_content_filter_count.fetch_add(1, std::memory_order_relaxed);
+  } else if (!filtered && previous) {
+    g_content_filter_count.fetch_sub(1, std::memory_order_relaxed);
+  }
+}
+
+bool
+SubscriptionIntraProcessBase::matches_content_filter(const void * ros_message) const
+{
+  auto content_filter = std::atomic_load(&content_filter_);
+  return !content_filter || content_filter->matches_ros_message(ros_message);
+}
+
+bool
+SubscriptionIntraProcessBase::has_any_content_filter()
+{
+  return g_content_filter_count.load(std::memory_order_relaxed) != 0;
+}
+
+void
+SubscriptionIntraProcessBase::set_inline_execution(
+  std::function<bool(const std::function<void()> &)> inline_executor, size_t max_depth)
+{
+  std::lock_guard<std::recursive_mutex> lock(callback_mutex_);
+  inline_execution_enabled_.store(inline_executor && max_depth > 0);
+  inline_executor_ = std::move(inline_executor);
+  max_inline_depth_ = max_depth;
+}
+
+bool
+SubscriptionIntraProcessBase::execute_inline()
+{
+  if (!inline_execution_enabled_.load(std::memory_order_relaxed)) {
+    return false;
+  }
+  std::function<bool(const std::function<void()> &)> inline_executor;
+  {
+    std::lock_guard<std::recursive_mutex> lock(callback_mutex_);
+    if (!inline_executor_ || t_inline_depth >= max_inline_depth_) {
+      return false;
+    }
+    inline_executor = inline_executor_;
+  }
+  return inline_executor(
+    [this]() {
+      ++t_inline_depth;
+      RCPPUTILS_SCOPE_EXIT(--t_inline_depth;);
+      // Messages still in the buffer are older, taking the next one keeps them in order
+      auto data = this->take_data();
+      this->execute(data);
+    });
+}
@@ -0,0 +1,283 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rclcpp/thread_attributes.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#ifndef _WIN32
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+using rclcpp::ThreadWithAttributes;
+
+#ifndef _WIN32
+struct ThreadWithAttributes::Impl
+{
+  pthread_t thread;
+  bool joinable = false;
+};
+
+namespace
+{
+
+struct ThreadStartData
+{
+  std::string name;
+  std::function<void()> function;
+};
+
+void *
+thread_start_routine(void * arg)
+{
+  std::unique_ptr<ThreadStartData> data(static_cast<ThreadStartData *>(arg));
+  if (!data->name.empty()) {
+#if defined(__APPLE__)
+    pthread_setname_np(data->name.c_str());
+#elif defined(__linux__)
+    // Linux limits thread names to 16 bytes including the terminating null
+    pthread_setname_np(pthread_self(), data->name.substr(0, 15).c_str());
+#endif
+  }
+  data->function();
+  return nullptr;
+}
+
+void
+check_pthread_result(int ret, const char * what)
+{
+  if (ret != 0) {
+    throw std::runtime_error(std::string("failed to ") + what + ": " + std::strerror(ret));
+  }
+}
+
+}  // namespace
+
+ThreadWithAttributes::ThreadWithAttributes(
+  const ThreadAttributes & attributes, std::function<void()> function)
+: impl_(std::make_unique<Impl>())
+{
+  pthread_attr_t attr;
+  check_pthread_result(pthread_attr_init(&attr), "initialize thread attributes");
+  std::unique_ptr<pthread_attr_t, int (*)(pthread_attr_t *)> attr_guard(
+    &attr, pthread_attr_destroy);
+
+  if (attributes.stack_size > 0) {
+    check_pthread_result(
+      pthread_attr_setstacksize(&attr, attributes.stack_size), "set thread stack size");
+  }
+
+  if (attributes.scheduling_policy != ThreadSchedulingPolicy::Inherit) {
+    int policy = SCHED_OTHER;
+    if (attributes.scheduling_policy == ThreadSchedulingPolicy::Fifo) {
+      policy = SCHED_FIFO;
+    } else if (attributes.scheduling_policy == ThreadSchedulingPolicy::RoundRobin) {
+      policy = SCHED_RR;
+    }
+    sched_param param;
+    std::memset(&param, 0, sizeof(param));
+    param.sched_priority = policy == SCHED_OTHER ? 0 : attributes.priority;
+    check_pthread_result(
+      pthread_attr_setinheritsched(&attr, PTHREAD_EXPLICIT_SCHED), "set explicit scheduling");
+    check_pthread_result(pthread_attr_setschedpolicy(&attr, policy), "set scheduling policy");
+    check_pthread_result(pthread_attr_setschedparam(&attr, &param), "set scheduling priority");
+  }
+
+#if defined(__linux__)
+  if (!attributes.cpu_affinity.empty()) {
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    for (size_t cpu : attributes.cpu_affinity) {
+      if (cpu >= CPU_SETSIZE) {
+        throw std::invalid_argument("cpu index " + std::to_string(cpu) + " is out of range");
+      }
+      CPU_SET(cpu, &cpu_set);
+    }
+    check_pthread_result(
+      pthread_attr_setaffinity_np(&attr, sizeof(cpu_set), &cpu_set), "set cpu affinity");
+  }
+#endif
+
+  auto data = std::make_unique<ThreadStartData>();
+  data->name = attributes.name;
+  data->function = std::move(function);
+  check_pthread_result(
+    pthread_create(&impl_->thread, &attr, thread_start_routine, data.get()), "create thread");
+  // The new thread owns the start data now
+  data.release();
+  impl_->joinable = true;
+}
+
+void
+ThreadWithAttributes::join()
+{
+  if (!joinable()) {
+    throw std::runtime_error("thread is not joinable");
+  }
+  check_pthread_result(pthread_join(impl_->thread, nullptr), "join thread");
+  impl_->joinable = false;
+}
+
+bool
+ThreadWithAttributes::joinable() const
+{
+  return impl_ && impl_->joinable;
+}
+#else
+struct ThreadWithAttributes::Impl
+{
+  std::thread thread;
+};
+
+ThreadWithAttributes::ThreadWithAttributes(
+  const ThreadAttributes & attributes, std::function<void()> function)
+: impl_(std::make_unique<Impl>())
+{
+  // Thread attributes are not supported on this platform
+  (void)attributes;
+  impl_->thread = std::thread(std::move(function));
+}
+
+void
+ThreadWithAttributes::join()
+{
+  if (!joinable()) {
+    throw std::runtime_error("thread is not joinable");
+  }
+  impl_->thread.join();
+}
+
+bool
+ThreadWithAttributes::joinable() const
+{
+  return impl_ && impl_->thread.joinable();
+}
+#endif
+
+ThreadWithAttributes::ThreadWithAttributes(ThreadWithAttributes && other) = default;
+
+ThreadWithAttributes &
+ThreadWithAttributes::operator=(ThreadWithAttributes && other)
+{
+  if (this != &other) {
+    if (joinable()) {
+      join();
+    }
+    impl_ = std::move(other.impl_);
+  }
+  return *this;
+}
+
+ThreadWithAttributes::~ThreadWithAttributes()
+{
+  if (joinable()) {
+    join();
+  }
+}
+
+namespace
+{
+
+#if defined(__linux__)
+// Parse a sysfs list of indices, e.g. "0-3,8,10-11", return false if it's malformed
+bool
+parse_index_list(const std::string & list, std::vector<size_t> & indices)
+{
+  std::stringstream stream(list);
+  std::string range;
+  while (std::getline(stream, range, ',')) {
+    if (range.empty() || range == "\n") {
+      continue;
+    }
+    try {
+      const size_t dash = range.find('-');
+      const size_t first = std::stoul(range.substr(0, dash));
+      const size_t last = dash == std::string::npos ? first : std::stoul(range.substr(dash + 1));
+      for (size_t index = first; index <= last; ++index) {
+        indices.push_back(index);
+      }
+    } catch (const std::logic_error &) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool
+read_index_list(const std::string & path, std::vector<size_t> & indices)
+{
+  std::ifstream file(path);
+  std::string list;
+  return file && std::getline(file, list) && parse_index_list(list, indices);
+}
+#endif
+
+}  // namespace
+
+std::vector<std::vector<size_t>>
+rclcpp::get_numa_node_cpus()
+{
+  std::vector<std::vector<size_t>> numa_node_cpus;
+#if defined(__linux__)
+  std::vector<size_t> nodes;
+  if (read_index_list("/sys/devices/system/node/online", nodes)) {
+    for (size_t node : nodes) {
+      std::vector<size_t> cpus;
+      const std::string path =
+        "/sys/devices/system/node/node" + std::to_string(node) + "/cpulist";
+      if (!read_index_list(path, cpus)) {
+        numa_node_cpus.clear();
+        break;
+      }
+      if (!cpus.empty()) {
+        numa_node_cpus.push_back(std::move(cpus));
+      }
+    }
+  }
+#endif
+  if (numa_node_cpus.empty()) {
+    std::vector<size_t> cpus(std::max(std::thread::hardware_concurrency(), 1u));
+    for (size_t cpu = 0; cpu < cpus.size(); ++cpu) {
+      cpus[cpu] = cpu;
+    }
+    numa_node_cpus.push_back(std::move(cpus));
+  }
+  return numa_node_cpus;
+}
+
+std::vector<rclcpp::ThreadAttributes>
+rclcpp::make_numa_thread_attributes(
+  size_t number_of_threads,
+  const std::vector<std::vector<size_t>> & numa_node_cpus)
+{
+  std::vector<ThreadAttributes> attributes(number_of_threads);
+  if (numa_node_cpus.empty()) {
+    return attributes;
+  }
+  for (size_t thread = 0; thread < number_of_threads; ++thread) {
+    attributes[thread].cpu_affinity = numa_node_cpus[thread % numa_node_cpus.size()];
+  }
+  return attributes;
+}
@@ -63,8 +63,6 @@ Time::Time(int64_t nanoseconds, rcl_clock_type_t clock_type)
   rcl_time_.nanoseconds = nanoseconds;
 }
 
-Time::Time(const Time & rhs) = default;
-
 Time::Time(
   const builtin_interfaces::msg::Time & time_msg,
   rcl_clock_type_t clock_type)
@@ -103,9 +101,6 @@ Time::operator builtin_interfaces::msg::Time() const
   return msg_time;
 }
 
-Time &
-Time::operator=(const Time & rhs) = default;
-
 Time &
 Time::operator=(const builtin_interfaces::msg::Time & time_msg)
 {
@@ -113,60 +108,10 @@ Time::operator=(const builtin_interfaces::msg::Time & time_msg)
   return *this;
 }
 
-bool
-Time::operator==(const rclcpp::Time & rhs) const
-{
-  if (rcl_time_.clock_type != rhs.rcl_time_.clock_type) {
-    throw std::runtime_error("can't compare times with different time sources");
-  }
-
-  return rcl_time_.nanoseconds == rhs.rcl_time_.nanoseconds;
-}
-
-bool
-Time::operator!=(const rclcpp::Time & rhs) const
-{
-  return !(*this == rhs);
-}
-
-bool
-Time::operator<(const rclcpp::Time & rhs) const
+void
+Time::throw_different_time_sources()
 {
-  if (rcl_time_.clock_type != rhs.rcl_time_.clock_type) {
-    throw std::runtime_error("can't compare times with different time sources");
-  }
-
-  return rcl_time_.nanoseconds < rhs.rcl_time_.nanoseconds;
-}
-
-bool
-Time::operator<=(const rclcpp::Time & rhs) const
-{
-  if (rcl_time_.clock_type != rhs.rcl_time_.clock_type) {
-    throw std::runtime_error("can't compare times with different time sources");
-  }
-
-  return rcl_time_.nanoseconds <= rhs.rcl_time_.nanoseconds;
-}
-
-bool
-Time::operator>=(const rclcpp::Time & rhs) const
-{
-  if (rcl_time_.clock_type != rhs.rcl_time_.clock_type) {
-    throw std::runtime_error("can't compare times with different time sources");
-  }
-
-  return rcl_time_.nanoseconds >= rhs.rcl_time_.nanoseconds;
-}
-
-bool
-Time::operator>(const rclcpp::Time & rhs) const
-{
-  if (rcl_time_.clock_type != rhs.rcl_time_.clock_type) {
-    throw std::runtime_error("can't compare times with different time sources");
-  }
-
-  return rcl_time_.nanoseconds > rhs.rcl_time_.nanoseconds;
+  throw std::runtime_error("can't compare times with different time sources");
 }
 
 Time
@@ -215,24 +160,12 @@ Time::operator-(const rclcpp::Duration & rhs) const
   return Time(rcl_time_.nanoseconds - rhs.nanoseconds(), rcl_time_.clock_type);
 }
 
-int64_t
-Time::nanoseconds() const
-{
-  return rcl_time_.nanoseconds;
-}
-
 double
 Time::seconds() const
 {
   return std::chrono::duration<double>(std::chrono::nanoseconds(rcl_time_.nanoseconds)).count();
 }
 
-rcl_clock_type_t
-Time::get_clock_type() const
-{
-  return rcl_time_.clock_type;
-}
-
 Time
 operator+(const rclcpp::Duration & lhs, const rclcpp::Time & rhs)
 {
@@ -12,8 +12,12 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <functional>
+#include <future>
 #include <memory>
 #include <string>
+#include <thread>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -23,6 +27,7 @@
 #include "rcl/time.h"
 
 #include "rclcpp/clock.hpp"
+#include "rclcpp/context.hpp"
 #include "rclcpp/exceptions.hpp"
 #include "rclcpp/logging.hpp"
 #include "rclcpp/node.hpp"
@@ -116,13 +121,14 @@ public:
 
     if (clock->get_clock_type() == RCL_ROS_TIME) {
       // Do change
-      if (!set_ros_time_enabled && clock->ros_time_is_active()) {
+      const bool ros_time_is_active = clock->ros_time_is_active();
+      if (!set_ros_time_enabled && ros_time_is_active) {
         auto ret = rcl_disable_ros_time_override(clock->get_clock_handle());
         if (ret != RCL_RET_OK) {
           rclcpp::exceptions::throw_from_rcl_error(
             ret, "Failed to disable ros_time_override_status");
         }
-      } else if (set_ros_time_enabled && !clock->ros_time_is_active()) {
+      } else if (set_ros_time_enabled && !ros_time_is_active) {
         auto ret = rcl_enable_ros_time_override(clock->get_clock_handle());
         if (ret != RCL_RET_OK) {
           rclcpp::exceptions::throw_from_rcl_error(
@@ -188,6 +194,93 @@ private:
   std::shared_ptr<builtin_interfaces::msg::Time> last_time_msg_{nullptr};
 };
 
+// Subscription to the clock topic shared by the time sources of a context.
+/**
+ * Stored as a sub context, the subscription and the thread spinning it are created for the
+ * first listener and destroyed with the last one.
+ * Each message is deserialized once and passed to all the listeners by the same thread.
+ */
+class ClockHub final
+{
+public:
+  using ClockMsg = rosgraph_msgs::msg::Clock;
+  using ClockCallback = std::function<void (std::shared_ptr<const ClockMsg>)>;
+
+  // Add a listener, the subscription uses the QoS of the first one
+  void add_listener(
+    const void * key,
+    ClockCallback callback,
+    rclcpp::Context::SharedPtr context,
+    const rclcpp::QoS & qos)
+  {
+    std::lock_guard<std::mutex> guard(listeners_lock_);
+    listeners_[key] = std::move(callback);
+    if (node_) {
+      return;
+    }
+
+    // The internal node doesn't use the global arguments, so it never uses sim time itself
+    rclcpp::NodeOptions node_options;
+    node_options.context(context)
+    .use_global_arguments(false)
+    .enable_rosout(false)
+    .start_parameter_services(false)
+    .start_parameter_event_publisher(false)
+    .use_clock_thread(false);
+    node_ = std::make_shared<rclcpp::Node>("_clock_hub", node_options);
+    subscription_ = node_->create_subscription<ClockMsg>(
+      "/clock",
+      qos,
+      [this](std::shared_ptr<const ClockMsg> msg) {
+        std::lock_guard<std::mutex> guard(listeners_lock_);
+        for (auto & listener : listeners_) {
+          listener.second(msg);
+        }
+      });
+
+    rclcpp::ExecutorOptions exec_options;
+    exec_options.context = context;
+    executor_ = std::make_shared<rclcpp::executors::SingleThreadedExecutor>(exec_options);
+    executor_->add_node(node_);
+    cancel_executor_promise_ = std::promise<void>{};
+    thread_ = std::thread(
+      [executor = executor_, future = cancel_executor_promise_.get_future()]() {
+        executor->spin_until_future_complete(future);
+      });
+  }
+
+  // Remove a listener, its callback isn't called anymore once this returns
+  void remove_listener(const void * key)
+  {
+    std::unique_lock<std::mutex> guard(listeners_lock_);
+    listeners_.erase(key);
+    if (!listeners_.empty() || !node_) {
+      return;
+    }
+    auto node = std::move(node_);
+    auto subscription = std::move(subscription_);
+    auto executor = std::move(executor_);
+    auto thread = std::move(thread_);
+    auto cancel_executor_promise = std::move(cancel_executor_promise_);
+    // The thread may be waiting for the lock to call the listeners
+    guard.unlock();
+    cancel_executor_promise.set_value();
+    executor->cancel();
+    thread.join();
+    executor->remove_node(node);
+  }
+
+private:
+  std::mutex listeners_lock_;
+  std::unordered_map<const void *, ClockCallback> listeners_;
+
+  rclcpp::Node::SharedPtr node_;
+  rclcpp::Subscription<ClockMsg>::SharedPtr subscription_;
+  rclcpp::executors::SingleThreadedExecutor::SharedPtr executor_;
+  std::promise<void> cancel_executor_promise_;
+  std::thread thread_;
+};
+
 class TimeSource::NodeState final
 {
 public:
@@ -220,6 +313,18 @@ public:
     use_clock_thread_ = use_clock_thread;
   }
 
+  // Check if the clock subscription is shared with the other time sources of the context
+  bool get_use_shared_clock_subscription()
+  {
+    return use_shared_clock_subscription_;
+  }
+
+  // Set whether the clock subscription is shared with the other time sources of the context
+  void set_use_shared_clock_subscription(bool use_shared_clock_subscription)
+  {
+    use_shared_clock_subscription_ = use_shared_clock_subscription;
+  }
+
   // Check if the clock thread is joinable
   bool clock_thread_is_joinable()
   {
@@ -324,6 +429,10 @@ private:
   bool use_clock_thread_;
   std::thread clock_executor_thread_;
 
+  // Shared clock subscription of the context, used instead of clock_subscription_.
+  bool use_shared_clock_subscription_{false};
+  std::shared_ptr<ClockHub> clock_hub_;
+
   // Preserve the node reference
   std::mutex node_base_lock_;
   rclcpp::node_interfaces::NodeBaseInterface::SharedPtr node_base_{nullptr};
@@ -367,11 +476,24 @@ private:
   void create_clock_sub()
   {
     std::lock_guard<std::mutex> guard(clock_sub_lock_);
-    if (clock_subscription_) {
+    if (clock_subscription_ || clock_hub_) {
       // Subscription already created.
       return;
     }
 
+    if (use_shared_clock_subscription_) {
+      auto context = node_base_->get_context();
+      clock_hub_ = context->get_sub_context<ClockHub>();
+      clock_hub_->add_listener(
+        this,
+        [this](std::shared_ptr<const rosgraph_msgs::msg::Clock> msg) {
+          clock_cb(msg);
+        },
+        context,
+        qos_);
+      return;
+    }
+
     rclcpp::SubscriptionOptions options;
     options.qos_overriding_options = rclcpp::QosOverridingOptions(
       {
@@ -423,6 +545,10 @@ private:
   void destroy_clock_sub()
   {
     std::lock_guard<std::mutex> guard(clock_sub_lock_);
+    if (clock_hub_) {
+      clock_hub_->remove_listener(this);
+      clock_hub_.reset();
+    }
     if (clock_executor_thread_.joinable()) {
       cancel_clock_executor_promise_.set_value();
       clock_executor_->cancel();
@@ -530,6 +656,8 @@ TimeSource::TimeSource(
 void TimeSource::attachNode(rclcpp::Node::SharedPtr node)
 {
   node_state_->set_use_clock_thread(node->get_node_options().use_clock_thread());
+  node_state_->set_use_shared_clock_subscription(
+    node->get_node_options().use_shared_clock_subscription());
   attachNode(
     node->get_node_base_interface(),
     node->get_node_topics_interface(),
@@ -587,6 +715,16 @@ void TimeSource::set_use_clock_thread(bool use_clock_thread)
   node_state_->set_use_clock_thread(use_clock_thread);
 }
 
+bool TimeSource::get_use_shared_clock_subscription()
+{
+  return node_state_->get_use_shared_clock_subscription();
+}
+
+void TimeSource::set_use_shared_clock_subscription(bool use_shared_clock_subscription)
+{
+  node_state_->set_use_shared_clock_subscription(use_shared_clock_subscription);
+}
+
 bool TimeSource::clock_thread_is_joinable()
 {
   return node_state_->clock_thread_is_joinable();
@@ -14,10 +14,15 @@
 
 #include "rclcpp/timer.hpp"
 
+#include <algorithm>
 #include <chrono>
+#include <stdexcept>
 #include <string>
 #include <memory>
+#include <mutex>
 #include <thread>
+#include <unordered_set>
+#include <vector>
 
 #include "rmw/impl/cpp/demangle.hpp"
 
@@ -29,6 +34,41 @@
 
 using rclcpp::TimerBase;
 
+namespace
+{
+
+/// Handles of the timers whose slack isn't zero.
+struct TimersWithSlack
+{
+  std::mutex mutex;
+  std::unordered_set<const rcl_timer_t *> handles;
+  // Read without the mutex, there are usually no such timers
+  std::atomic<size_t> count{0};
+};
+
+TimersWithSlack &
+get_timers_with_slack_registry()
+{
+  // Never destroyed, static timers may be destroyed after it otherwise
+  static auto * registry = new TimersWithSlack();
+  return *registry;
+}
+
+void
+update_timers_with_slack(const rcl_timer_t * handle, bool has_slack)
+{
+  auto & registry = get_timers_with_slack_registry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  if (has_slack) {
+    registry.handles.insert(handle);
+  } else {
+    registry.handles.erase(handle);
+  }
+  registry.count.store(registry.handles.size(), std::memory_order_relaxed);
+}
+
+}  // namespace
+
 TimerBase::TimerBase(
   rclcpp::Clock::SharedPtr clock,
   std::chrono::nanoseconds period,
@@ -77,6 +117,9 @@ TimerBase::TimerBase(
 TimerBase::~TimerBase()
 {
   clear_on_reset_callback();
+  if (slack_.load(std::memory_order_relaxed) != 0) {
+    update_timers_with_slack(timer_handle_.get(), false);
+  }
 }
 
 void
@@ -112,6 +155,52 @@ TimerBase::reset()
   }
 }
 
+void
+TimerBase::touch()
+{
+  last_touch_time_.store(clock_->now().nanoseconds(), std::memory_order_relaxed);
+}
+
+bool
+TimerBase::postpone_to_last_touch(std::chrono::nanoseconds time_until_call)
+{
+  const int64_t last_touch = last_touch_time_.exchange(not_touched, std::memory_order_relaxed);
+  if (last_touch == not_touched) {
+    return false;
+  }
+  int64_t period = 0;
+  rcl_ret_t ret = rcl_timer_get_period(timer_handle_.get(), &period);
+  if (ret != RCL_RET_OK) {
+    rclcpp::exceptions::throw_from_rcl_error(ret, "Failed to get timer period");
+  }
+  const int64_t expiration = last_touch + period;
+  const int64_t now = clock_->now().nanoseconds();
+  const int64_t scheduled = now + time_until_call.count();
+  // The timer wasn't touched since a period, or is called early within its slack
+  if (expiration <= std::max(now, scheduled)) {
+    return false;
+  }
+
+  // rcl_timer_call() schedules the next call one period after the scheduled one, so the
+  // timer is called with the period which brings it to the new expiration.
+  // Unlike rcl_timer_reset(), this doesn't notify the executors, which are already awake.
+  std::lock_guard<std::recursive_mutex> lock(callback_mutex_);
+  int64_t old_period = 0;
+  ret = rcl_timer_exchange_period(timer_handle_.get(), expiration - scheduled, &old_period);
+  if (ret != RCL_RET_OK) {
+    rclcpp::exceptions::throw_from_rcl_error(ret, "Failed to postpone timer");
+  }
+  ret = rcl_timer_call(timer_handle_.get());
+  rcl_ret_t restore_ret = rcl_timer_exchange_period(timer_handle_.get(), old_period, &period);
+  if (ret != RCL_RET_OK && ret != RCL_RET_TIMER_CANCELED) {
+    rclcpp::exceptions::throw_from_rcl_error(ret, "Failed to postpone timer");
+  }
+  if (restore_ret != RCL_RET_OK) {
+    rclcpp::exceptions::throw_from_rcl_error(restore_ret, "Failed to restore timer period");
+  }
+  return true;
+}
+
 bool
 TimerBase::is_ready()
 {
@@ -123,6 +212,55 @@ TimerBase::is_ready()
   return ready;
 }
 
+void
+TimerBase::set_slack(std::chrono::nanoseconds slack)
+{
+  int64_t period = 0;
+  rcl_ret_t ret = rcl_timer_get_period(timer_handle_.get(), &period);
+  if (ret != RCL_RET_OK) {
+    rclcpp::exceptions::throw_from_rcl_error(ret, "Failed to get timer period");
+  }
+  if (slack < std::chrono::nanoseconds::zero()) {
+    throw std::invalid_argument{"timer slack cannot be negative"};
+  }
+  // A larger slack would let the timer run repeatedly ahead of its expirations
+  if (slack.count() > 0 && slack.count() >= period) {
+    throw std::invalid_argument{"timer slack must be less than the timer period"};
+  }
+  const int64_t previous_slack = slack_.exchange(slack.count(), std::memory_order_relaxed);
+  if ((previous_slack != 0) != (slack.count() != 0)) {
+    update_timers_with_slack(timer_handle_.get(), slack.count() != 0);
+  }
+}
+
+std::chrono::nanoseconds
+TimerBase::get_slack() const
+{
+  return std::chrono::nanoseconds(slack_.load(std::memory_order_relaxed));
+}
+
+void
+TimerBase::get_timers_with_slack(std::vector<const rcl_timer_t *> & handles)
+{
+  handles.clear();
+  auto & registry = get_timers_with_slack_registry();
+  if (registry.count.load(std::memory_order_relaxed) == 0) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  handles.insert(handles.end(), registry.handles.begin(), registry.handles.end());
+}
+
+bool
+TimerBase::is_ready_within_slack()
+{
+  const int64_t slack = slack_.load(std::memory_order_relaxed);
+  if (slack == 0) {
+    return is_ready();
+  }
+  return time_until_trigger().count() <= slack;
+}
+
 std::chrono::nanoseconds
 TimerBase::time_until_trigger()
 {
@@ -218,3 +356,63 @@ TimerBase::set_on_reset_callback(rcl_event_callback_t callback, const void * use
     rclcpp::exceptions::throw_from_rcl_error(ret, "Failed to set timer on reset callback");
   }
 }
+
+rclcpp::TimerInfo
+TimerBase::get_last_call_info() const
+{
+  const rcl_clock_type_t clock_type = clock_->get_clock_type();
+  const int64_t expected_call_time = last_expected_call_time_.load(std::memory_order_relaxed);
+  const int64_t actual_call_time = last_actual_call_time_.load(std::memory_order_relaxed);
+  return {
+    rclcpp::Time(expected_call_time, clock_type),
+    rclcpp::Time(actual_call_time, clock_type),
+    std::chrono::nanoseconds(std::max<int64_t>(actual_call_time - expected_call_time, 0)),
+    last_missed_periods_.load(std::memory_order_relaxed)};
+}
+
+rclcpp::TimerStatistics
+TimerBase::get_statistics() const
+{
+  return {
+    call_count_.load(std::memory_order_relaxed),
+    missed_periods_.load(std::memory_order_relaxed),
+    std::chrono::nanoseconds(max_lateness_.load(std::memory_order_relaxed))};
+}
+
+void
+TimerBase::reset_statistics()
+{
+  call_count_.store(0, std::memory_order_relaxed);
+  missed_periods_.store(0, std::memory_order_relaxed);
+  max_lateness_.store(0, std::memory_order_relaxed);
+}
+
+void
+TimerBase::record_call(std::chrono::nanoseconds time_until_call)
+{
+  const int64_t actual_call_time = clock_->now().nanoseconds();
+  const int64_t lateness = std::max<int64_t>(-time_until_call.count(), 0);
+  int64_t period = 0;
+  if (rcl_timer_get_period(timer_handle_.get(), &period) != RCL_RET_OK) {
+    rcl_reset_error();
+    period = 0;
+  }
+  const uint64_t missed_periods = period > 0 ? static_cast<uint64_t>(lateness / period) : 0;
+
+  last_expected_call_time_.store(actual_call_time - lateness, std::memory_order_relaxed);
+  last_actual_call_time_.store(actual_call_time, std::memory_order_relaxed);
+  last_missed_periods_.store(missed_periods, std::memory_order_relaxed);
+  call_count_.fetch_add(1, std::memory_order_relaxed);
+  missed_periods_.fetch_add(missed_periods, std::memory_order_relaxed);
+  int64_t max_lateness = max_lateness_.load(std::memory_order_relaxed);
+  while (lateness > max_lateness &&
+    !max_lateness_.compare_exchange_weak(max_lateness, lateness, std::memory_order_relaxed))
+  {
+  }
+}
+
+std::shared_ptr<rclcpp::CallbackGroup>
+TimerBase::get_callback_group() const
+{
+  return callback_group_.lock();
+}
@@ -0,0 +1,191 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rclcpp/topic_statistics/executor_backlog_statistics.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "libstatistics_collector/collector/generate_statistics_message.hpp"
+
+#include "rclcpp/create_timer.hpp"
+#include "rclcpp/node_interfaces/node_topics_interface.hpp"
+#include "rclcpp/publisher.hpp"
+#include "rclcpp/publisher_factory.hpp"
+
+namespace rclcpp
+{
+namespace topic_statistics
+{
+
+using MetricsPublisher = rclcpp::Publisher<statistics_msgs::msg::MetricsMessage>;
+using libstatistics_collector::moving_average_statistics::StatisticData;
+
+namespace
+{
+
+int64_t
+get_current_nanoseconds_since_epoch()
+{
+  const auto now = std::chrono::system_clock::now();
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(now.time_since_epoch()).count();
+}
+
+/// Statistics reporting a single sampled value.
+StatisticData
+make_value_statistic_data(double value)
+{
+  StatisticData data;
+  data.average = value;
+  data.min = value;
+  data.max = value;
+  data.standard_deviation = 0.0;
+  data.sample_count = 1;
+  return data;
+}
+
+/// Statistics reporting a count, as their sample count.
+StatisticData
+make_count_statistic_data(uint64_t count)
+{
+  StatisticData data;
+  data.average = std::nan("");
+  data.min = std::nan("");
+  data.max = std::nan("");
+  data.standard_deviation = std::nan("");
+  data.sample_count = count;
+  return data;
+}
+
+}  // namespace
+
+ExecutorBacklogStatistics::ExecutorBacklogStatistics(
+  const std::string & node_name,
+  rclcpp::Executor & executor,
+  rclcpp::PublisherBase::SharedPtr publisher)
+: node_name_(node_name),
+  executor_(executor),
+  publisher_(std::move(publisher))
+{
+  if (nullptr == publisher_) {
+    throw std::invalid_argument("publisher pointer is nullptr");
+  }
+  if (nullptr == std::dynamic_pointer_cast<MetricsPublisher>(publisher_)) {
+    throw std::invalid_argument("publisher must publish statistics_msgs::msg::MetricsMessage");
+  }
+}
+
+ExecutorBacklogStatistics::~ExecutorBacklogStatistics()
+{
+  if (publisher_timer_) {
+    publisher_timer_->cancel();
+    publisher_timer_.reset();
+  }
+}
+
+void
+ExecutorBacklogStatistics::set_publisher_timer(rclcpp::TimerBase::SharedPtr publisher_timer)
+{
+  publisher_timer_ = std::move(publisher_timer);
+}
+
+void
+ExecutorBacklogStatistics::publish_message()
+{
+  auto publisher = std::static_pointer_cast<MetricsPublisher>(publisher_);
+  for (const auto & message : generate_messages()) {
+    publisher->publish(message);
+  }
+}
+
+std::vector<statistics_msgs::msg::MetricsMessage>
+ExecutorBacklogStatistics::generate_messages()
+{
+  using libstatistics_collector::collector::GenerateStatisticMessage;
+
+  const rclcpp::ExecutorBacklog backlog = executor_.get_backlog();
+  // The backlog is a snapshot, reported as a window of zero duration
+  const rclcpp::Time now{get_current_nanoseconds_since_epoch()};
+
+  std::vector<statistics_msgs::msg::MetricsMessage> messages;
+  for (const auto & subscription : backlog.subscriptions) {
+    if (!subscription.uses_intra_process) {
+      continue;
+    }
+    messages.push_back(
+      GenerateStatisticMessage(
+        subscription.topic_name, kIntraProcessQueuedMetricName, "messages", now, now,
+        make_value_statistic_data(static_cast<double>(subscription.intra_process_queued))));
+    messages.push_back(
+      GenerateStatisticMessage(
+        subscription.topic_name, kIntraProcessDroppedMetricName, "messages", now, now,
+        make_count_statistic_data(subscription.intra_process_dropped)));
+  }
+  messages.push_back(
+    GenerateStatisticMessage(
+      node_name_, kEventsQueueSizeMetricName, "events", now, now,
+      make_value_statistic_data(static_cast<double>(backlog.events_queue_size))));
+  return messages;
+}
+
+ExecutorBacklogStatistics::SharedPtr
+create_executor_backlog_statistics(
+  rclcpp::node_interfaces::NodeTopicsInterface * node_topics,
+  rclcpp::Executor & executor,
+  std::chrono::milliseconds publish_period,
+  const std::string & publish_topic,
+  const rclcpp::QoS & qos)
+{
+  if (publish_period <= std::chrono::milliseconds(0)) {
+    throw std::invalid_argument(
+            "publish_period must be greater than 0, specified value of " +
+            std::to_string(publish_period.count()) + " ms");
+  }
+  auto node_base = node_topics->get_node_base_interface();
+
+  auto publisher = node_topics->create_publisher(
+    publish_topic,
+    rclcpp::create_publisher_factory<statistics_msgs::msg::MetricsMessage>(
+      rclcpp::PublisherOptions()),
+    qos);
+  node_topics->add_publisher(publisher, nullptr);
+
+  auto statistics =
+    std::make_shared<ExecutorBacklogStatistics>(node_base->get_name(), executor, publisher);
+
+  std::weak_ptr<ExecutorBacklogStatistics> weak_statistics(statistics);
+  auto timer = rclcpp::create_wall_timer(
+    std::chrono::duration_cast<std::chrono::nanoseconds>(publish_period),
+    [weak_statistics]() {
+      auto statistics = weak_statistics.lock();
+      if (statistics) {
+        statistics->publish_message();
+      }
+    },
+    nullptr,
+    node_base,
+    node_topics->get_node_timers_interface());
+  statistics->set_publisher_timer(timer);
+
+  return statistics;
+}
+
+}  // namespace topic_statistics
+}  // namespace rclcpp
@@ -0,0 +1,210 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rclcpp/topic_statistics/publisher_topic_statistics.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "libstatistics_collector/collector/generate_statistics_message.hpp"
+
+#include "rclcpp/create_timer.hpp"
+#include "rclcpp/detail/resolve_enable_topic_statistics.hpp"
+#include "rclcpp/node_interfaces/node_topics_interface.hpp"
+#include "rclcpp/publisher.hpp"
+#include "rclcpp/publisher_factory.hpp"
+
+namespace rclcpp
+{
+namespace topic_statistics
+{
+
+using MetricsPublisher = rclcpp::Publisher<statistics_msgs::msg::MetricsMessage>;
+
+namespace
+{
+
+/// Whether a publish call is being measured by the current thread.
+thread_local bool publish_scope_active = false;
+
+int64_t
+get_current_nanoseconds_since_epoch()
+{
+  const auto now = std::chrono::system_clock::now();
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(now.time_since_epoch()).count();
+}
+
+/// Statistics reporting a count, as their sample count.
+StatisticData
+make_count_statistic_data(uint64_t count)
+{
+  StatisticData data;
+  data.average = std::nan("");
+  data.min = std::nan("");
+  data.max = std::nan("");
+  data.standard_deviation = std::nan("");
+  data.sample_count = count;
+  return data;
+}
+
+}  // namespace
+
+bool
+PublisherTopicStatistics::PublishScope::enter()
+{
+  if (publish_scope_active) {
+    return false;
+  }
+  publish_scope_active = true;
+  return true;
+}
+
+void
+PublisherTopicStatistics::PublishScope::leave()
+{
+  publish_scope_active = false;
+}
+
+PublisherTopicStatistics::PublisherTopicStatistics(
+  const std::string & node_name,
+  rclcpp::PublisherBase::SharedPtr publisher)
+: node_name_(node_name),
+  publisher_(std::move(publisher)),
+  window_start_(get_current_nanoseconds_since_epoch())
+{
+  if (nullptr == publisher_) {
+    throw std::invalid_argument("publisher pointer is nullptr");
+  }
+  if (nullptr == std::dynamic_pointer_cast<MetricsPublisher>(publisher_)) {
+    throw std::invalid_argument("publisher must publish statistics_msgs::msg::MetricsMessage");
+  }
+}
+
+PublisherTopicStatistics::~PublisherTopicStatistics()
+{
+  if (publisher_timer_) {
+    publisher_timer_->cancel();
+    publisher_timer_.reset();
+  }
+}
+
+void
+PublisherTopicStatistics::set_publisher_timer(rclcpp::TimerBase::SharedPtr publisher_timer)
+{
+  publisher_timer_ = std::move(publisher_timer);
+}
+
+void
+PublisherTopicStatistics::publish_message_and_reset_measurements()
+{
+  auto publisher = std::static_pointer_cast<MetricsPublisher>(publisher_);
+  for (const auto & message : generate_messages_and_reset_measurements()) {
+    publisher->publish(message);
+  }
+}
+
+std::vector<statistics_msgs::msg::MetricsMessage>
+PublisherTopicStatistics::generate_messages_and_reset_measurements()
+{
+  using libstatistics_collector::collector::GenerateStatisticMessage;
+
+  const rclcpp::Time window_start = window_start_;
+  const rclcpp::Time window_end{get_current_nanoseconds_since_epoch()};
+  window_start_ = window_end;
+
+  StatisticData published_bytes_rate = make_count_statistic_data(
+    sized_publications_.exchange(0, std::memory_order_relaxed));
+  const uint64_t published_bytes = published_bytes_.exchange(0, std::memory_order_relaxed);
+  const double window_seconds = (window_end - window_start).seconds();
+  if (published_bytes_rate.sample_count > 0 && window_seconds > 0.0) {
+    published_bytes_rate.average = static_cast<double>(published_bytes) / window_seconds;
+  }
+
+  std::vector<statistics_msgs::msg::MetricsMessage> messages;
+  messages.push_back(
+    GenerateStatisticMessage(
+      node_name_, kPublishDurationMetricName, "ms", window_start, window_end,
+      publish_duration_.get_and_reset()));
+  messages.push_back(
+    GenerateStatisticMessage(
+      node_name_, kIntraProcessPublicationsMetricName, "messages", window_start, window_end,
+      make_count_statistic_data(
+        intra_process_publications_.exchange(0, std::memory_order_relaxed))));
+  messages.push_back(
+    GenerateStatisticMessage(
+      node_name_, kInterProcessPublicationsMetricName, "messages", window_start, window_end,
+      make_count_statistic_data(
+        inter_process_publications_.exchange(0, std::memory_order_relaxed))));
+  messages.push_back(
+    GenerateStatisticMessage(
+      node_name_, kLoanedPublicationsMetricName, "messages", window_start, window_end,
+      make_count_statistic_data(loaned_publications_.exchange(0, std::memory_order_relaxed))));
+  messages.push_back(
+    GenerateStatisticMessage(
+      node_name_, kPublishedBytesRateMetricName, "B/s", window_start, window_end,
+      published_bytes_rate));
+  return messages;
+}
+
+PublisherTopicStatistics::SharedPtr
+create_publisher_topic_statistics(
+  rclcpp::node_interfaces::NodeTopicsInterface * node_topics,
+  const rclcpp::PublisherOptionsBase & options)
+{
+  auto node_base = node_topics->get_node_base_interface();
+  if (!rclcpp::detail::resolve_enable_topic_statistics(options, *node_base)) {
+    return nullptr;
+  }
+  if (options.topic_stats_options.publish_period <= std::chrono::milliseconds(0)) {
+    throw std::invalid_argument(
+            "topic_stats_options.publish_period must be greater than 0, specified value of " +
+            std::to_string(options.topic_stats_options.publish_period.count()) + " ms");
+  }
+
+  // The statistics publisher itself doesn't collect statistics.
+  auto publisher = node_topics->create_publisher(
+    options.topic_stats_options.publish_topic,
+    rclcpp::create_publisher_factory<statistics_msgs::msg::MetricsMessage>(
+      rclcpp::PublisherOptions()),
+    options.topic_stats_options.qos);
+  node_topics->add_publisher(publisher, options.callback_group);
+
+  auto topic_statistics =
+    std::make_shared<PublisherTopicStatistics>(node_base->get_name(), publisher);
+
+  std::weak_ptr<PublisherTopicStatistics> weak_topic_statistics(topic_statistics);
+  auto timer = rclcpp::create_wall_timer(
+    std::chrono::duration_cast<std::chrono::nanoseconds>(
+      options.topic_stats_options.publish_period),
+    [weak_topic_statistics]() {
+      auto topic_statistics = weak_topic_statistics.lock();
+      if (topic_statistics) {
+        topic_statistics->publish_message_and_reset_measurements();
+      }
+    },
+    options.callback_group,
+    node_base,
+    node_topics->get_node_timers_interface());
+  topic_statistics->set_publisher_timer(timer);
+
+  return topic_statistics;
+}
+
+}  // namespace topic_statistics
+}  // namespace rclcpp
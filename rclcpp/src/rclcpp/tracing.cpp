@@ -0,0 +1,55 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rclcpp/tracing.hpp"
+
+namespace rclcpp
+{
+namespace tracing
+{
+
+namespace detail
+{
+
+std::atomic<uint32_t> enabled_subsystems{static_cast<uint32_t>(Subsystem::All)};
+
+}  // namespace detail
+
+uint32_t
+get_enabled_subsystems() noexcept
+{
+  return detail::enabled_subsystems.load(std::memory_order_relaxed);
+}
+
+void
+set_enabled_subsystems(uint32_t mask) noexcept
+{
+  detail::enabled_subsystems.store(mask, std::memory_order_relaxed);
+}
+
+void
+enable(Subsystem subsystem) noexcept
+{
+  detail::enabled_subsystems.fetch_or(static_cast<uint32_t>(subsystem), std::memory_order_relaxed);
+}
+
+void
+disable(Subsystem subsystem) noexcept
+{
+  detail::enabled_subsystems.fetch_and(
+    ~static_cast<uint32_t>(subsystem), std::memory_order_relaxed);
+}
+
+}  // namespace tracing
+}  // namespace rclcpp
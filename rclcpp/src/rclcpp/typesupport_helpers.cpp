@@ -16,11 +16,14 @@
 #include "rclcpp/typesupport_helpers.hpp"
 
 #include <functional>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <stdexcept>
 #include <string>
 #include <tuple>
+#include <unordered_map>
 #include <utility>
 
 #include "ament_index_cpp/get_package_prefix.hpp"
@@ -129,14 +132,84 @@ const void * get_typesupport_handle_impl(
   }
 }
 
+/// Type support library of a package, with the handles already extracted from it.
+struct CachedTypesupportLibrary
+{
+  // Not owned, so that libraries are unloaded once no endpoint uses them
+  std::weak_ptr<rcpputils::SharedLibrary> library;
+  std::unordered_map<std::string, const rosidl_message_type_support_t *> message_handles;
+  std::unordered_map<std::string, const rosidl_service_type_support_t *> service_handles;
+};
+
+/// Process-wide cache of the type support libraries, by package and type support identifier.
+class TypesupportLibraryCache
+{
+public:
+  std::shared_ptr<rcpputils::SharedLibrary>
+  get_library(const std::string & package_name, const std::string & typesupport_identifier)
+  {
+    // Locked while loading, so that concurrent lookups of a package load it once
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto & cached = libraries_[std::make_pair(package_name, typesupport_identifier)];
+    auto library = cached.library.lock();
+    if (!library) {
+      auto library_path = get_typesupport_library_path(package_name, typesupport_identifier);
+      library = std::make_shared<rcpputils::SharedLibrary>(library_path);
+      cached = CachedTypesupportLibrary{};
+      cached.library = library;
+    }
+    return library;
+  }
+
+  /// Get the handle of the type extracted from the library, or extract it.
+  /**
+   * Only the handles of the libraries returned by get_library() are cached.
+   */
+  template<typename HandleT, typename ExtractT>
+  const HandleT *
+  get_handle(
+    const std::string & type,
+    const std::string & typesupport_identifier,
+    rcpputils::SharedLibrary & library,
+    std::unordered_map<std::string, const HandleT *> CachedTypesupportLibrary::* handles,
+    ExtractT extract)
+  {
+    auto package_name = std::get<0>(extract_type_identifier(type));
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = libraries_.find(std::make_pair(package_name, typesupport_identifier));
+    if (it == libraries_.end() || it->second.library.lock().get() != &library) {
+      return extract();
+    }
+    auto & cached_handles = it->second.*handles;
+    auto handle_it = cached_handles.find(type);
+    if (handle_it != cached_handles.end()) {
+      return handle_it->second;
+    }
+    const HandleT * handle = extract();
+    cached_handles.emplace(type, handle);
+    return handle;
+  }
+
+  static TypesupportLibraryCache &
+  get_instance()
+  {
+    static TypesupportLibraryCache cache;
+    return cache;
+  }
+
+private:
+  std::mutex mutex_;
+  std::map<std::pair<std::string, std::string>, CachedTypesupportLibrary> libraries_;
+};
+
 }  // anonymous namespace
 
 std::shared_ptr<rcpputils::SharedLibrary>
 get_typesupport_library(const std::string & type, const std::string & typesupport_identifier)
 {
   auto package_name = std::get<0>(extract_type_identifier(type));
-  auto library_path = get_typesupport_library_path(package_name, typesupport_identifier);
-  return std::make_shared<rcpputils::SharedLibrary>(library_path);
+  return TypesupportLibraryCache::get_instance().get_library(
+    package_name, typesupport_identifier);
 }
 
 const rosidl_message_type_support_t * get_typesupport_handle(
@@ -156,10 +229,14 @@ const rosidl_message_type_support_t * get_message_typesupport_handle(
   static const std::string symbol_part_name = "__get_message_type_support_handle__";
   static const std::string middle_module_additional = "msg";
 
-  return static_cast<const rosidl_message_type_support_t *>(get_typesupport_handle_impl(
-           type, typesupport_identifier, typesupport_name, symbol_part_name,
-           middle_module_additional, library
-  ));
+  return TypesupportLibraryCache::get_instance().get_handle(
+    type, typesupport_identifier, library, &CachedTypesupportLibrary::message_handles,
+    [&]() {
+      return static_cast<const rosidl_message_type_support_t *>(get_typesupport_handle_impl(
+               type, typesupport_identifier, typesupport_name, symbol_part_name,
+               middle_module_additional, library
+      ));
+    });
 }
 
 const rosidl_service_type_support_t * get_service_typesupport_handle(
@@ -171,10 +248,14 @@ const rosidl_service_type_support_t * get_service_typesupport_handle(
   static const std::string symbol_part_name = "__get_service_type_support_handle__";
   static const std::string middle_module_additional = "srv";
 
-  return static_cast<const rosidl_service_type_support_t *>(get_typesupport_handle_impl(
-           type, typesupport_identifier, typesupport_name, symbol_part_name,
-           middle_module_additional, library
-  ));
+  return TypesupportLibraryCache::get_instance().get_handle(
+    type, typesupport_identifier, library, &CachedTypesupportLibrary::service_handles,
+    [&]() {
+      return static_cast<const rosidl_service_type_support_t *>(get_typesupport_handle_impl(
+               type, typesupport_identifier, typesupport_name, symbol_part_name,
+               middle_module_additional, library
+      ));
+    });
 }
 
 }  // namespace rclcpp
@@ -86,3 +86,9 @@ Waitable::clear_on_ready_callback()
           "Custom waitables should override clear_on_ready_callback if they "
           "want to use it and make sure to call it on the waitable destructor.");
 }
+
+std::shared_ptr<rclcpp::CallbackGroup>
+Waitable::get_callback_group() const
+{
+  return callback_group_.lock();
+}
@@ -0,0 +1,82 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <memory>
+#include <utility>
+
+#include "benchmark/benchmark.h"
+
+#include "rclcpp/any_subscription_callback.hpp"
+#include "rclcpp/message_info.hpp"
+
+#include "test_msgs/msg/basic_types.hpp"
+
+using Message = test_msgs::msg::BasicTypes;
+
+// Dispatch of a message to one of the callback signatures, without any middleware involved
+template<typename CallbackT>
+static void
+dispatch(benchmark::State & st, CallbackT callback)
+{
+  rclcpp::AnySubscriptionCallback<Message> any_subscription_callback;
+  any_subscription_callback.set(std::move(callback));
+  auto message = std::make_shared<Message>();
+  rclcpp::MessageInfo message_info;
+
+  for (auto _ : st) {
+    (void)_;
+    any_subscription_callback.dispatch(message, message_info);
+  }
+}
+
+// Dispatch of an intra-process message, which is moved to the callback when it takes ownership
+template<typename CallbackT>
+static void
+dispatch_intra_process_unique(benchmark::State & st, CallbackT callback)
+{
+  rclcpp::AnySubscriptionCallback<Message> any_subscription_callback;
+  any_subscription_callback.set(std::move(callback));
+  rclcpp::MessageInfo message_info;
+
+  for (auto _ : st) {
+    (void)_;
+    st.PauseTiming();
+    auto message = std::make_unique<Message>();
+    st.ResumeTiming();
+    any_subscription_callback.dispatch_intra_process(std::move(message), message_info);
+  }
+}
+
+BENCHMARK_CAPTURE(
+  dispatch, const_ref,
+  [](const Message & message) {benchmark::DoNotOptimize(&message);});
+BENCHMARK_CAPTURE(
+  dispatch, const_ref_with_info,
+  [](const Message & message, const rclcpp::MessageInfo &) {benchmark::DoNotOptimize(&message);});
+BENCHMARK_CAPTURE(
+  dispatch, shared_const_ptr,
+  [](std::shared_ptr<const Message> message) {benchmark::DoNotOptimize(message);});
+BENCHMARK_CAPTURE(
+  dispatch, const_ref_shared_const_ptr,
+  [](const std::shared_ptr<const Message> & message) {benchmark::DoNotOptimize(message);});
+// Copies the message, as the callback takes ownership of it
+BENCHMARK_CAPTURE(
+  dispatch, unique_ptr,
+  [](std::unique_ptr<Message> message) {benchmark::DoNotOptimize(message);});
+BENCHMARK_CAPTURE(
+  dispatch_intra_process_unique, unique_ptr,
+  [](std::unique_ptr<Message> message) {benchmark::DoNotOptimize(message);});
+BENCHMARK_CAPTURE(
+  dispatch_intra_process_unique, const_ref,
+  [](const Message & message) {benchmark::DoNotOptimize(&message);});
@@ -0,0 +1,83 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "benchmark/benchmark.h"
+
+#include "rcl/time.h"
+
+#include "rclcpp/clock.hpp"
+#include "rclcpp/exceptions.hpp"
+
+// Clock read by all the benchmark threads, while its ROS time is updated by another thread
+static std::shared_ptr<rclcpp::Clock> clock_under_test;
+static std::atomic_bool stop_updates{false};
+static std::thread update_thread;
+
+static void
+check_rcl_ret(rcl_ret_t ret)
+{
+  if (ret != RCL_RET_OK) {
+    rclcpp::exceptions::throw_from_rcl_error(ret);
+  }
+}
+
+static void
+start_ros_time_updates()
+{
+  clock_under_test = std::make_shared<rclcpp::Clock>(RCL_ROS_TIME);
+  check_rcl_ret(rcl_enable_ros_time_override(clock_under_test->get_clock_handle()));
+  stop_updates = false;
+  update_thread = std::thread(
+    []() {
+      rcl_time_point_value_t time = 0;
+      while (!stop_updates) {
+        // Updated as by the time source
+        std::lock_guard<std::mutex> guard(clock_under_test->get_clock_mutex());
+        check_rcl_ret(rcl_set_ros_time_override(clock_under_test->get_clock_handle(), ++time));
+      }
+    });
+}
+
+static void
+stop_ros_time_updates()
+{
+  stop_updates = true;
+  update_thread.join();
+  clock_under_test.reset();
+}
+
+static void
+ros_time_now_while_updated(benchmark::State & st)
+{
+  // The setup of the first thread is done before any thread enters the loop
+  if (st.thread_index() == 0) {
+    start_ros_time_updates();
+  }
+
+  for (auto _ : st) {
+    (void)_;
+    benchmark::DoNotOptimize(clock_under_test->now());
+  }
+
+  // And the teardown once every thread left it
+  if (st.thread_index() == 0) {
+    stop_ros_time_updates();
+  }
+}
+BENCHMARK(ros_time_now_while_updated)->ThreadRange(1, 8)->UseRealTime();
@@ -0,0 +1,165 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <thread>
+
+#include "benchmark/benchmark.h"
+
+#include "rclcpp/callback_group.hpp"
+#include "rclcpp/context.hpp"
+#include "rclcpp/experimental/buffers/ring_buffer_implementation.hpp"
+#include "rclcpp/experimental/executors/events_executor/bounded_events_queue.hpp"
+#include "rclcpp/experimental/executors/events_executor/lock_free_events_queue.hpp"
+#include "rclcpp/experimental/executors/events_executor/simple_events_queue.hpp"
+
+// Structures shared by all the benchmark threads, which measure how they scale with the
+// number of cores using them concurrently.
+// The contention of the multi-threaded executors is measured by benchmark_executor_scaling.
+static std::unique_ptr<rclcpp::experimental::buffers::RingBufferImplementation<int>> ring_buffer;
+static std::unique_ptr<rclcpp::experimental::executors::SimpleEventsQueue> events_queue;
+static std::unique_ptr<rclcpp::experimental::executors::EventsQueue> producers_events_queue;
+static std::shared_ptr<rclcpp::CallbackGroup> callback_group;
+
+static void
+ring_buffer_enqueue_dequeue(benchmark::State & st)
+{
+  // The setup of the first thread is done before any thread enters the loop
+  if (st.thread_index() == 0) {
+    ring_buffer =
+      std::make_unique<rclcpp::experimental::buffers::RingBufferImplementation<int>>(64);
+  }
+
+  for (auto _ : st) {
+    (void)_;
+    ring_buffer->enqueue(1);
+    benchmark::DoNotOptimize(ring_buffer->dequeue());
+  }
+
+  // And the teardown once every thread left it
+  if (st.thread_index() == 0) {
+    ring_buffer.reset();
+  }
+}
+BENCHMARK(ring_buffer_enqueue_dequeue)->ThreadRange(1, 8)->UseRealTime();
+
+static void
+simple_events_queue_enqueue_dequeue(benchmark::State & st)
+{
+  if (st.thread_index() == 0) {
+    events_queue = std::make_unique<rclcpp::experimental::executors::SimpleEventsQueue>();
+  }
+
+  rclcpp::experimental::executors::ExecutorEvent event {};
+  event.num_events = 1;
+  for (auto _ : st) {
+    (void)_;
+    events_queue->enqueue(event);
+    // Another thread may have taken the event, the queue isn't waited for
+    benchmark::DoNotOptimize(events_queue->dequeue(event, std::chrono::nanoseconds(0)));
+  }
+
+  if (st.thread_index() == 0) {
+    events_queue.reset();
+  }
+}
+BENCHMARK(simple_events_queue_enqueue_dequeue)->ThreadRange(1, 8)->UseRealTime();
+
+// The first thread runs the callbacks of a mutually exclusive group, while the other ones
+// read its state as the executors do when collecting the entities to wait for.
+static void
+callback_group_start_finish_while_collected(benchmark::State & st)
+{
+  if (st.thread_index() == 0) {
+    callback_group = std::make_shared<rclcpp::CallbackGroup>(
+      rclcpp::CallbackGroupType::MutuallyExclusive,
+      []() {return rclcpp::Context::SharedPtr();});
+  }
+
+  for (auto _ : st) {
+    (void)_;
+    if (st.thread_index() == 0) {
+      callback_group->start_callback(nullptr);
+      benchmark::DoNotOptimize(callback_group->finish_callback(nullptr));
+    } else {
+      benchmark::DoNotOptimize(callback_group->get_priority());
+      benchmark::DoNotOptimize(callback_group->is_enabled());
+      benchmark::DoNotOptimize(callback_group->get_entities_version());
+    }
+  }
+
+  if (st.thread_index() == 0) {
+    callback_group.reset();
+  }
+}
+BENCHMARK(callback_group_start_finish_while_collected)->ThreadRange(1, 8)->UseRealTime();
+
+// The first thread executes the events as the events executor does, while the other ones
+// enqueue events as the middleware listener threads do, each for its own entity.
+// The argument selects the simple, the lock-free or the bounded events queue, and the
+// throughput is the number of events dequeued per second.
+static void
+events_queue_multi_producer(benchmark::State & st)
+{
+  using rclcpp::experimental::executors::ExecutorEvent;
+  // Producers wait while the consumer is that far behind, so that the queue doesn't grow
+  constexpr size_t kMaxQueuedEvents = 4096;
+
+  if (st.thread_index() == 0) {
+    switch (st.range(0)) {
+      case 1:
+        producers_events_queue =
+          std::make_unique<rclcpp::experimental::executors::LockFreeEventsQueue>();
+        break;
+      case 2:
+        producers_events_queue =
+          std::make_unique<rclcpp::experimental::executors::BoundedEventsQueue>();
+        break;
+      default:
+        producers_events_queue =
+          std::make_unique<rclcpp::experimental::executors::SimpleEventsQueue>();
+        break;
+    }
+  }
+
+  int entity = 0;
+  ExecutorEvent event {};
+  event.entity_key = &entity;
+  event.type = rclcpp::experimental::executors::SUBSCRIPTION_EVENT;
+  event.num_events = 1;
+  int64_t dequeued_events = 0;
+  for (auto _ : st) {
+    (void)_;
+    if (st.thread_index() == 0) {
+      while (producers_events_queue->dequeue(event, std::chrono::nanoseconds(0))) {
+        dequeued_events += static_cast<int64_t>(event.num_events);
+      }
+    } else {
+      while (producers_events_queue->size() > kMaxQueuedEvents) {
+        std::this_thread::yield();
+      }
+      producers_events_queue->enqueue(event);
+    }
+  }
+
+  if (st.thread_index() == 0) {
+    st.SetItemsProcessed(dequeued_events);
+    producers_events_queue.reset();
+  }
+}
+BENCHMARK(events_queue_multi_producer)
+->ArgName("queue")->Arg(0)->Arg(1)->Arg(2)
+->ThreadRange(2, 16)->UseRealTime();
@@ -401,3 +401,59 @@ BENCHMARK_F(
     entities_collector_->execute(data);
   }
 }
+
+/// Measure adding and removing many nodes, as when agents are created and destroyed at runtime.
+/**
+ * Every iteration adds all the nodes to the executor, then removes all of them.
+ * The argument is the number of nodes, the time per node should not grow with it.
+ */
+class PerformanceTestExecutorManyNodes : public PerformanceTest
+{
+public:
+  void SetUp(benchmark::State & st)
+  {
+    rclcpp::init(0, nullptr);
+    // Without their parameter services, nodes are cheaper to create
+    const auto options = rclcpp::NodeOptions()
+      .start_parameter_services(false)
+      .start_parameter_event_publisher(false);
+    for (int64_t i = 0; i < st.range(0); ++i) {
+      nodes.push_back(std::make_shared<rclcpp::Node>("my_node_" + std::to_string(i), options));
+    }
+
+    PerformanceTest::SetUp(st);
+  }
+  void TearDown(benchmark::State & st)
+  {
+    PerformanceTest::TearDown(st);
+    nodes.clear();
+    rclcpp::shutdown();
+  }
+
+  std::vector<rclcpp::Node::SharedPtr> nodes;
+};
+
+BENCHMARK_DEFINE_F(
+  PerformanceTestExecutorManyNodes, single_thread_executor_add_remove_nodes)(benchmark::State & st)
+{
+  rclcpp::executors::SingleThreadedExecutor executor;
+  reset_heap_counters();
+  for (auto _ : st) {
+    (void)_;
+    for (const auto & node : nodes) {
+      executor.add_node(node);
+    }
+    for (const auto & node : nodes) {
+      executor.remove_node(node);
+    }
+  }
+  st.counters["nodes_per_second"] = benchmark::Counter(
+    static_cast<double>(st.iterations()) * static_cast<double>(nodes.size()),
+    benchmark::Counter::kIsRate);
+}
+
+BENCHMARK_REGISTER_F(PerformanceTestExecutorManyNodes, single_thread_executor_add_remove_nodes)
+->ArgName("nodes")
+->RangeMultiplier(10)
+->Range(1, 10000)
+->Unit(benchmark::kMillisecond);
@@ -0,0 +1,216 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "performance_test_fixture/performance_test_fixture.hpp"
+
+#include "rclcpp/callback_statistics.hpp"
+#include "rclcpp/rclcpp.hpp"
+#include "test_msgs/msg/unbounded_sequences.hpp"
+
+using namespace std::chrono_literals;
+using performance_test_fixture::PerformanceTest;
+
+/// Executors compared by the benchmarks, selected by the first argument.
+enum ExecutorKind
+{
+  SingleThreaded = 0,
+  MultiThreaded,
+  StaticSingleThreaded,
+  Events,
+  WorkStealingMultiThreaded,
+};
+
+/// Measure the throughput and the publish to callback latency of the executors.
+/**
+ * Every iteration publishes one message on each topic and waits for all of them to be received,
+ * while the executor spins in another thread.
+ * Arguments are: the executor kind, the number of subscriptions (one topic each), the number
+ * of 1ms timers running alongside, the number of threads of the multi threaded executors and
+ * the size in bytes of the message payload.
+ */
+class PerformanceTestExecutorScaling : public PerformanceTest
+{
+public:
+  void SetUp(benchmark::State & st)
+  {
+    rclcpp::init(0, nullptr);
+    node = std::make_shared<rclcpp::Node>("executor_scaling_node");
+
+    const auto number_of_subscriptions = static_cast<size_t>(st.range(1));
+    for (size_t i = 0; i < number_of_subscriptions; ++i) {
+      const std::string topic = "/executor_scaling_" + std::to_string(i);
+      publishers.push_back(
+        node->create_publisher<test_msgs::msg::UnboundedSequences>(topic, rclcpp::QoS(10)));
+      subscriptions.push_back(
+        node->create_subscription<test_msgs::msg::UnboundedSequences>(
+          topic, rclcpp::QoS(10),
+          [this](test_msgs::msg::UnboundedSequences::ConstSharedPtr msg) {
+            const auto now = std::chrono::steady_clock::now().time_since_epoch();
+            latency.record(now - std::chrono::nanoseconds(msg->int64_values[0]));
+            received_count++;
+          }));
+    }
+
+    const auto number_of_timers = static_cast<size_t>(st.range(2));
+    for (size_t i = 0; i < number_of_timers; ++i) {
+      timers.push_back(node->create_wall_timer(1ms, []() {}));
+    }
+
+    message.byte_values.resize(static_cast<size_t>(st.range(4)));
+    message.int64_values.resize(1);
+
+    executor = create_executor(
+      static_cast<ExecutorKind>(st.range(0)), static_cast<size_t>(st.range(3)));
+    executor->add_node(node);
+    spin_thread = std::thread([this]() {executor->spin();});
+
+    PerformanceTest::SetUp(st);
+  }
+
+  void TearDown(benchmark::State & st)
+  {
+    PerformanceTest::TearDown(st);
+    executor->cancel();
+    spin_thread.join();
+    executor.reset();
+    timers.clear();
+    subscriptions.clear();
+    publishers.clear();
+    node.reset();
+    rclcpp::shutdown();
+  }
+
+  static std::unique_ptr<rclcpp::Executor>
+  create_executor(ExecutorKind kind, size_t number_of_threads)
+  {
+    switch (kind) {
+      case MultiThreaded:
+        return std::make_unique<rclcpp::executors::MultiThreadedExecutor>(
+          rclcpp::ExecutorOptions(), number_of_threads);
+      case StaticSingleThreaded:
+        return std::make_unique<rclcpp::executors::StaticSingleThreadedExecutor>();
+      case Events:
+        return std::make_unique<rclcpp::experimental::executors::EventsExecutor>();
+      case WorkStealingMultiThreaded:
+        return std::make_unique<rclcpp::executors::WorkStealingMultiThreadedExecutor>(
+          rclcpp::ExecutorOptions(), number_of_threads);
+      case SingleThreaded:
+      default:
+        return std::make_unique<rclcpp::executors::SingleThreadedExecutor>();
+    }
+  }
+
+  /// Publish a message on every topic and wait until all of them are received.
+  bool
+  publish_and_wait()
+  {
+    const size_t expected_count = received_count + publishers.size();
+    for (const auto & publisher : publishers) {
+      message.int64_values[0] =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+      publisher->publish(message);
+    }
+    const auto deadline = std::chrono::steady_clock::now() + 5s;
+    while (received_count < expected_count) {
+      if (std::chrono::steady_clock::now() > deadline) {
+        return false;
+      }
+      std::this_thread::yield();
+    }
+    return true;
+  }
+
+protected:
+  rclcpp::Node::SharedPtr node;
+  std::vector<rclcpp::Publisher<test_msgs::msg::UnboundedSequences>::SharedPtr> publishers;
+  std::vector<rclcpp::Subscription<test_msgs::msg::UnboundedSequences>::SharedPtr> subscriptions;
+  std::vector<rclcpp::TimerBase::SharedPtr> timers;
+  std::unique_ptr<rclcpp::Executor> executor;
+  std::thread spin_thread;
+
+  test_msgs::msg::UnboundedSequences message;
+  std::atomic_size_t received_count {0};
+  rclcpp::LatencyHistogram latency;
+};
+
+BENCHMARK_DEFINE_F(PerformanceTestExecutorScaling, publish_and_receive)(benchmark::State & st)
+{
+  // Warm up, so that discovery and the first allocations are not measured
+  if (!publish_and_wait()) {
+    st.SkipWithError("Messages were not received");
+    return;
+  }
+  latency.reset();
+  received_count = 0;
+
+  const uint64_t initial_wait_count = executor->get_wait_count();
+  reset_heap_counters();
+  for (auto _ : st) {
+    (void)_;
+    if (!publish_and_wait()) {
+      st.SkipWithError("Messages were not received");
+      break;
+    }
+  }
+
+  auto to_us = [](std::chrono::nanoseconds value) {
+      return std::chrono::duration<double, std::micro>(value).count();
+    };
+  st.counters["msgs_per_second"] = benchmark::Counter(
+    static_cast<double>(received_count), benchmark::Counter::kIsRate);
+  // Zero for the events executor, which doesn't wait on a wait set
+  st.counters["waits_per_msg"] = received_count == 0 ? 0.0 :
+    static_cast<double>(executor->get_wait_count() - initial_wait_count) /
+    static_cast<double>(received_count);
+  st.counters["latency_p50_us"] = to_us(latency.get_percentile(50.0));
+  st.counters["latency_p99_us"] = to_us(latency.get_percentile(99.0));
+  st.counters["latency_p99.9_us"] = to_us(latency.get_percentile(99.9));
+}
+
+static void
+ExecutorScalingArguments(benchmark::internal::Benchmark * b)
+{
+  b->ArgNames({"executor", "subscriptions", "timers", "threads", "bytes"});
+  for (int64_t executor : {SingleThreaded, MultiThreaded, StaticSingleThreaded, Events,
+      WorkStealingMultiThreaded})
+  {
+    const bool multi_threaded =
+      executor == MultiThreaded || executor == WorkStealingMultiThreaded;
+    for (int64_t subscriptions : {1, 10, 100, 1000}) {
+      for (int64_t timers : {0, 10}) {
+        for (int64_t threads : {1, 2, 4}) {
+          if (!multi_threaded && threads != 1) {
+            continue;
+          }
+          for (int64_t bytes : {64, 64 * 1024}) {
+            b->Args({executor, subscriptions, timers, threads, bytes});
+          }
+        }
+      }
+    }
+  }
+}
+
+BENCHMARK_REGISTER_F(PerformanceTestExecutorScaling, publish_and_receive)
+->Apply(ExecutorScalingArguments)
+->UseRealTime();
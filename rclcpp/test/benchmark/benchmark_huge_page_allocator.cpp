@@ -0,0 +1,56 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+
+#include "benchmark/benchmark.h"
+
+#include "rclcpp/experimental/huge_page_allocator.hpp"
+
+// Allocate, fill and free a large message, as done for each message published intra-process.
+// Large blocks are mapped and unmapped by malloc for each message, and their pages faulted
+// in again, while the pool reuses blocks whose pages are already backed by huge pages.
+template<typename Alloc>
+static void
+fill_large_message(benchmark::State & st, Alloc allocator)
+{
+  const auto size = static_cast<size_t>(st.range(0));
+  for (auto _ : st) {
+    (void)_;
+    uint8_t * data = std::allocator_traits<Alloc>::allocate(allocator, size);
+    std::memset(data, 1, size);
+    benchmark::DoNotOptimize(data);
+    benchmark::ClobberMemory();
+    std::allocator_traits<Alloc>::deallocate(allocator, data, size);
+  }
+  st.SetBytesProcessed(static_cast<int64_t>(st.iterations()) * static_cast<int64_t>(size));
+}
+
+static void
+std_allocator_fill_large_message(benchmark::State & st)
+{
+  fill_large_message(st, std::allocator<uint8_t>());
+}
+BENCHMARK(std_allocator_fill_large_message)->RangeMultiplier(4)->Range(1 << 20, 1 << 25);
+
+static void
+huge_page_allocator_fill_large_message(benchmark::State & st)
+{
+  fill_large_message(
+    st, rclcpp::experimental::HugePageAllocator<uint8_t>(
+      std::make_shared<rclcpp::experimental::HugePageMemoryPool>()));
+}
+BENCHMARK(huge_page_allocator_fill_large_message)->RangeMultiplier(4)->Range(1 << 20, 1 << 25);
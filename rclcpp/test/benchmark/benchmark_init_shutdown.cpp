@@ -53,3 +53,24 @@ BENCHMARK_F(PerformanceTest, rclcpp_shutdown)(benchmark::State & state)
     benchmark::ClobberMemory();
   }
 }
+
+BENCHMARK_F(PerformanceTest, rclcpp_init_keep_rcl_context)(benchmark::State & state)
+{
+  rclcpp::InitOptions init_options;
+  init_options.keep_rcl_context_on_shutdown = true;
+
+  // Warmup and prime caches, the rcl context is then reused
+  rclcpp::init(0, nullptr, init_options);
+  rclcpp::shutdown();
+
+  reset_heap_counters();
+  for (auto _ : state) {
+    (void)_;
+    rclcpp::init(0, nullptr, init_options);
+
+    state.PauseTiming();
+    rclcpp::shutdown();
+    state.ResumeTiming();
+    benchmark::ClobberMemory();
+  }
+}
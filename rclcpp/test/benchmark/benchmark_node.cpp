@@ -59,6 +59,30 @@ BENCHMARK_F(NodePerformanceTest, create_node)(benchmark::State & state)
   }
 }
 
+BENCHMARK_F(NodePerformanceTest, create_lightweight_node)(benchmark::State & state)
+{
+  rclcpp::NodeOptions options;
+  options.lightweight();
+
+  // Warmup and prime caches
+  auto outer_node = std::make_shared<rclcpp::Node>("node", options);
+  outer_node.reset();
+
+  reset_heap_counters();
+  for (auto _ : state) {
+    (void)_;
+    auto node = std::make_shared<rclcpp::Node>("node", options);
+#ifndef __clang_analyzer__
+    benchmark::DoNotOptimize(node);
+#endif
+    benchmark::ClobberMemory();
+
+    state.PauseTiming();
+    node.reset();
+    state.ResumeTiming();
+  }
+}
+
 BENCHMARK_F(NodePerformanceTest, destroy_node)(benchmark::State & state)
 {
   // Warmup and prime caches
@@ -14,6 +14,7 @@
 
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "performance_test_fixture/performance_test_fixture.hpp"
@@ -77,6 +78,28 @@ BENCHMARK_F(NodeParametersInterfaceTest, declare_undeclare)(benchmark::State & s
   }
 }
 
+BENCHMARK_F(NodeParametersInterfaceTest, declare_parameters_undeclare)(benchmark::State & state)
+{
+  constexpr size_t num_parameters = 100;
+  std::vector<std::pair<rclcpp::Parameter, rcl_interfaces::msg::ParameterDescriptor>> parameters;
+  for (size_t i = 0; i < num_parameters; ++i) {
+    parameters.emplace_back(
+      rclcpp::Parameter(param3_name + "_" + std::to_string(i), static_cast<int64_t>(i)),
+      dynamically_typed_descriptor);
+  }
+  auto node_parameters = node->get_node_parameters_interface();
+
+  reset_heap_counters();
+
+  for (auto _ : state) {
+    (void)_;
+    node_parameters->declare_parameters(parameters);
+    for (const auto & parameter : parameters) {
+      node_parameters->undeclare_parameter(parameter.first.get_name());
+    }
+  }
+}
+
 BENCHMARK_F(NodeParametersInterfaceTest, has_parameter_hit)(benchmark::State & state)
 {
   for (auto _ : state) {
@@ -237,6 +260,63 @@ BENCHMARK_F(NodeParametersInterfaceTest, get_parameter)(benchmark::State & state
   }
 }
 
+BENCHMARK_F(NodeParametersInterfaceTest, get_parameter_handle_value)(benchmark::State & state)
+{
+  node->set_parameter(rclcpp::Parameter(param1_name, 42));
+  auto handle = node->get_parameter_handle(param1_name);
+
+  reset_heap_counters();
+
+  for (auto _ : state) {
+    (void)_;
+    auto value = handle->get_value();
+    benchmark::DoNotOptimize(value);
+  }
+}
+
+BENCHMARK_F(NodeParametersInterfaceTest, get_parameter_handle_value_as)(benchmark::State & state)
+{
+  node->set_parameter(rclcpp::Parameter(param1_name, 42));
+  auto handle = node->get_parameter_handle(param1_name);
+
+  reset_heap_counters();
+
+  for (auto _ : state) {
+    (void)_;
+    if (handle->get_value_as<int64_t>() != 42) {
+      state.SkipWithError("Unexpected parameter value");
+      break;
+    }
+  }
+}
+
+BENCHMARK_F(NodeParametersInterfaceTest, set_parameters_with_handle)(benchmark::State & state)
+{
+  const std::vector<rclcpp::Parameter> param_values1
+  {
+    rclcpp::Parameter(param1_name, true),
+    rclcpp::Parameter(param2_name, false),
+  };
+  const std::vector<rclcpp::Parameter> param_values2
+  {
+    rclcpp::Parameter(param1_name, false),
+    rclcpp::Parameter(param2_name, true),
+  };
+  auto handle = node->get_parameter_handle(param1_name);
+
+  reset_heap_counters();
+
+  for (auto _ : state) {
+    (void)_;
+    node->set_parameters(param_values2);
+    node->set_parameters(param_values1);
+  }
+
+  if (!handle->get_value_as<bool>()) {
+    state.SkipWithError("Handle is not updated");
+  }
+}
+
 BENCHMARK_F(NodeParametersInterfaceTest, list_parameters_hit)(benchmark::State & state)
 {
   rcl_interfaces::msg::ListParametersResult param_list;
@@ -335,3 +335,50 @@ BENCHMARK_F(ParameterClientTest, list_parameters_miss)(benchmark::State & state)
     }
   }
 }
+
+BENCHMARK_F(ParameterClientTest, multiplexed_get_parameters)(benchmark::State & state)
+{
+  auto multiplexed_client = std::make_shared<rclcpp::MultiplexedParameterClient>(node);
+  const std::string remote_name = remote_node->get_fully_qualified_name();
+  if (!multiplexed_client->wait_for_service(remote_name)) {
+    state.SkipWithError("Client failed to become ready");
+  }
+
+  for (auto _ : state) {
+    (void)_;
+    auto future = multiplexed_client->get_parameters(remote_name, {param1_name});
+    if (rclcpp::spin_until_future_complete(node, future) != rclcpp::FutureReturnCode::SUCCESS) {
+      state.SkipWithError("Failed to get the parameters");
+      break;
+    }
+    std::vector<rclcpp::Parameter> results = future.get();
+    if (results.size() != 1 || results[0].get_name() != param1_name) {
+      state.SkipWithError("Got the wrong parameter(s)");
+      break;
+    }
+  }
+}
+
+BENCHMARK_F(ParameterClientTest, multiplexed_get_parameters_batched)(benchmark::State & state)
+{
+  auto multiplexed_client = std::make_shared<rclcpp::MultiplexedParameterClient>(node);
+  const std::string remote_name = remote_node->get_fully_qualified_name();
+  if (!multiplexed_client->wait_for_service(remote_name)) {
+    state.SkipWithError("Client failed to become ready");
+  }
+
+  for (auto _ : state) {
+    (void)_;
+    // All but the first request are batched into a second one
+    std::vector<std::shared_future<std::vector<rclcpp::Parameter>>> futures;
+    for (size_t i = 0; i < 10; ++i) {
+      futures.push_back(multiplexed_client->get_parameters(remote_name, {param1_name}));
+    }
+    if (rclcpp::spin_until_future_complete(node, futures.back()) !=
+      rclcpp::FutureReturnCode::SUCCESS)
+    {
+      state.SkipWithError("Failed to get the parameters");
+      break;
+    }
+  }
+}
@@ -0,0 +1,357 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "performance_test_fixture/performance_test_fixture.hpp"
+
+#include "rclcpp/callback_statistics.hpp"
+#include "rclcpp/rclcpp.hpp"
+#include "rclcpp/serialization.hpp"
+#include "test_msgs/msg/unbounded_sequences.hpp"
+
+using namespace std::chrono_literals;
+using performance_test_fixture::PerformanceTest;
+using MessageT = test_msgs::msg::UnboundedSequences;
+
+namespace
+{
+
+int64_t
+now_ns()
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/// Custom type published and received through a type adapter.
+struct Payload
+{
+  std::vector<uint8_t> bytes;
+  int64_t stamp_ns = 0;
+};
+
+}  // namespace
+
+template<>
+struct rclcpp::TypeAdapter<Payload, MessageT>
+{
+  using is_specialized = std::true_type;
+  using custom_type = Payload;
+  using ros_message_type = MessageT;
+
+  static void
+  convert_to_ros_message(const custom_type & source, ros_message_type & destination)
+  {
+    destination.byte_values = source.bytes;
+    destination.int64_values.assign(1, source.stamp_ns);
+  }
+
+  static void
+  convert_to_custom(const ros_message_type & source, custom_type & destination)
+  {
+    destination.bytes = source.byte_values;
+    destination.stamp_ns = source.int64_values.empty() ? 0 : source.int64_values[0];
+  }
+};
+
+using AdaptedType = rclcpp::TypeAdapter<Payload, MessageT>;
+
+/// Measure the publish to callback latency of the publishing paths.
+/**
+ * Every iteration publishes one message, stamped with the time it's published, and spins the
+ * executor in the same thread until all the subscriptions received it.
+ * An iteration being one message, the heap counters of the fixture give the allocations per
+ * message, from the publish call to the end of the callbacks.
+ * The first argument of every benchmark is the size in bytes of the message payload.
+ */
+class PubSubPerformanceTest : public PerformanceTest
+{
+public:
+  void SetUp(benchmark::State & st)
+  {
+    rclcpp::init(0, nullptr);
+    PerformanceTest::SetUp(st);
+  }
+
+  void TearDown(benchmark::State & st)
+  {
+    PerformanceTest::TearDown(st);
+    executor.reset();
+    subscriptions.clear();
+    node.reset();
+    rclcpp::shutdown();
+  }
+
+  /// Create the node, with intra-process communication or not.
+  void
+  create_node(bool intra_process)
+  {
+    node = std::make_shared<rclcpp::Node>(
+      "pub_sub_node", rclcpp::NodeOptions().use_intra_process_comms(intra_process));
+    executor = std::make_unique<rclcpp::executors::SingleThreadedExecutor>();
+    executor->add_node(node);
+  }
+
+  /// Add subscriptions of the ROS type, taking ownership of the messages or sharing them.
+  void
+  add_subscriptions(size_t count, bool unique)
+  {
+    for (size_t i = 0; i < count; ++i) {
+      if (unique) {
+        subscriptions.push_back(
+          node->create_subscription<MessageT>(
+            topic_name, rclcpp::QoS(10),
+            [this](MessageT::UniquePtr msg) {record(msg->int64_values[0]);}));
+      } else {
+        subscriptions.push_back(
+          node->create_subscription<MessageT>(
+            topic_name, rclcpp::QoS(10),
+            [this](MessageT::ConstSharedPtr msg) {record(msg->int64_values[0]);}));
+      }
+    }
+  }
+
+  void
+  record(int64_t stamp_ns)
+  {
+    latency.record(std::chrono::nanoseconds(now_ns() - stamp_ns));
+    received_count++;
+  }
+
+  /// Spin until the subscriptions received the given number of messages.
+  bool
+  spin_until_received(size_t expected_count)
+  {
+    const auto deadline = std::chrono::steady_clock::now() + 5s;
+    while (received_count < expected_count) {
+      if (std::chrono::steady_clock::now() > deadline) {
+        return false;
+      }
+      executor->spin_some(10ms);
+    }
+    return true;
+  }
+
+  /// Measure publishing with the given function, which publishes one stamped message.
+  template<typename PublishT>
+  void
+  run(benchmark::State & st, size_t number_of_subscriptions, PublishT && publish)
+  {
+    // Warm up, so that discovery and the first allocations are not measured
+    publish();
+    if (!spin_until_received(number_of_subscriptions)) {
+      st.SkipWithError("Messages were not received");
+      return;
+    }
+    latency.reset();
+    received_count = 0;
+
+    reset_heap_counters();
+    for (auto _ : st) {
+      (void)_;
+      publish();
+      if (!spin_until_received(received_count + number_of_subscriptions)) {
+        st.SkipWithError("Messages were not received");
+        return;
+      }
+    }
+
+    auto to_us = [](std::chrono::nanoseconds value) {
+        return std::chrono::duration<double, std::micro>(value).count();
+      };
+    st.counters["latency_p50_us"] = to_us(latency.get_percentile(50.0));
+    st.counters["latency_p99_us"] = to_us(latency.get_percentile(99.0));
+    st.counters["latency_p99.9_us"] = to_us(latency.get_percentile(99.9));
+    st.SetBytesProcessed(static_cast<int64_t>(st.iterations()) * st.range(0));
+  }
+
+  /// Get a message with the payload size of the benchmark.
+  MessageT
+  make_message(benchmark::State & st) const
+  {
+    MessageT message;
+    message.byte_values.resize(static_cast<size_t>(st.range(0)));
+    message.int64_values.resize(1);
+    return message;
+  }
+
+protected:
+  static constexpr char topic_name[] = "pub_sub_topic";
+
+  rclcpp::Node::SharedPtr node;
+  std::unique_ptr<rclcpp::executors::SingleThreadedExecutor> executor;
+  std::vector<rclcpp::SubscriptionBase::SharedPtr> subscriptions;
+  size_t received_count = 0;
+  rclcpp::LatencyHistogram latency;
+};
+
+/// Arguments: the payload size, the number of subscriptions, whether they take ownership.
+BENCHMARK_DEFINE_F(PubSubPerformanceTest, intra_process)(benchmark::State & st)
+{
+  create_node(true);
+  auto publisher = node->create_publisher<MessageT>(topic_name, rclcpp::QoS(10));
+  const auto number_of_subscriptions = static_cast<size_t>(st.range(1));
+  add_subscriptions(number_of_subscriptions, st.range(2) != 0);
+  const MessageT message = make_message(st);
+  run(
+    st, number_of_subscriptions, [&]() {
+      auto msg = std::make_unique<MessageT>(message);
+      msg->int64_values[0] = now_ns();
+      publisher->publish(std::move(msg));
+    });
+}
+
+/// Arguments: the payload size, the number of subscriptions.
+BENCHMARK_DEFINE_F(PubSubPerformanceTest, inter_process)(benchmark::State & st)
+{
+  create_node(false);
+  auto publisher = node->create_publisher<MessageT>(topic_name, rclcpp::QoS(10));
+  const auto number_of_subscriptions = static_cast<size_t>(st.range(1));
+  add_subscriptions(number_of_subscriptions, false);
+  MessageT message = make_message(st);
+  run(
+    st, number_of_subscriptions, [&]() {
+      message.int64_values[0] = now_ns();
+      publisher->publish(message);
+    });
+}
+
+/// Arguments: the payload size, the message is serialized again for each publish.
+BENCHMARK_DEFINE_F(PubSubPerformanceTest, generic_publisher)(benchmark::State & st)
+{
+  create_node(false);
+  auto publisher = node->create_generic_publisher(
+    topic_name, "test_msgs/msg/UnboundedSequences", rclcpp::QoS(10));
+  add_subscriptions(1, false);
+  MessageT message = make_message(st);
+  rclcpp::Serialization<MessageT> serialization;
+  rclcpp::SerializedMessage serialized_message;
+  run(
+    st, 1, [&]() {
+      message.int64_values[0] = now_ns();
+      serialization.serialize_message(&message, &serialized_message);
+      publisher->publish(serialized_message);
+    });
+}
+
+/// Arguments: the payload size, the middleware falling back to an allocated message if it
+/// can't loan it, as with unbounded types for most middlewares.
+BENCHMARK_DEFINE_F(PubSubPerformanceTest, loaned_message)(benchmark::State & st)
+{
+  create_node(false);
+  auto publisher = node->create_publisher<MessageT>(topic_name, rclcpp::QoS(10));
+  add_subscriptions(1, false);
+  const auto size = static_cast<size_t>(st.range(0));
+  st.counters["can_loan_messages"] = publisher->can_loan_messages() ? 1.0 : 0.0;
+  run(
+    st, 1, [&]() {
+      auto loaned_message = publisher->borrow_loaned_message();
+      loaned_message.get().byte_values.resize(size);
+      loaned_message.get().int64_values.assign(1, now_ns());
+      publisher->publish(std::move(loaned_message));
+    });
+}
+
+/// Arguments: the payload size, whether the subscription receives the adapted type.
+BENCHMARK_DEFINE_F(PubSubPerformanceTest, type_adapter)(benchmark::State & st)
+{
+  create_node(true);
+  auto publisher = node->create_publisher<AdaptedType>(topic_name, rclcpp::QoS(10));
+  if (st.range(1) != 0) {
+    subscriptions.push_back(
+      node->create_subscription<AdaptedType>(
+        topic_name, rclcpp::QoS(10),
+        [this](std::unique_ptr<Payload> payload) {record(payload->stamp_ns);}));
+  } else {
+    add_subscriptions(1, true);
+  }
+  Payload payload;
+  payload.bytes.resize(static_cast<size_t>(st.range(0)));
+  run(
+    st, 1, [&]() {
+      auto msg = std::make_unique<Payload>(payload);
+      msg->stamp_ns = now_ns();
+      publisher->publish(std::move(msg));
+    });
+}
+
+static const std::vector<int64_t> kPayloadSizes = {
+  64, 4 * 1024, 64 * 1024, 1024 * 1024, 16 * 1024 * 1024};
+
+static void
+IntraProcessArguments(benchmark::internal::Benchmark * b)
+{
+  b->ArgNames({"bytes", "subscriptions", "unique"});
+  for (int64_t bytes : kPayloadSizes) {
+    for (int64_t subscriptions : {1, 2, 8}) {
+      for (int64_t unique : {0, 1}) {
+        b->Args({bytes, subscriptions, unique});
+      }
+    }
+  }
+}
+
+static void
+InterProcessArguments(benchmark::internal::Benchmark * b)
+{
+  b->ArgNames({"bytes", "subscriptions"});
+  for (int64_t bytes : kPayloadSizes) {
+    for (int64_t subscriptions : {1, 2, 8}) {
+      b->Args({bytes, subscriptions});
+    }
+  }
+}
+
+static void
+PayloadSizeArguments(benchmark::internal::Benchmark * b)
+{
+  b->ArgNames({"bytes"});
+  for (int64_t bytes : kPayloadSizes) {
+    b->Args({bytes});
+  }
+}
+
+static void
+TypeAdapterArguments(benchmark::internal::Benchmark * b)
+{
+  b->ArgNames({"bytes", "adapted_subscription"});
+  for (int64_t bytes : kPayloadSizes) {
+    for (int64_t adapted : {0, 1}) {
+      b->Args({bytes, adapted});
+    }
+  }
+}
+
+BENCHMARK_REGISTER_F(PubSubPerformanceTest, intra_process)
+->Apply(IntraProcessArguments)
+->UseRealTime();
+BENCHMARK_REGISTER_F(PubSubPerformanceTest, inter_process)
+->Apply(InterProcessArguments)
+->UseRealTime();
+BENCHMARK_REGISTER_F(PubSubPerformanceTest, generic_publisher)
+->Apply(PayloadSizeArguments)
+->UseRealTime();
+BENCHMARK_REGISTER_F(PubSubPerformanceTest, loaned_message)
+->Apply(PayloadSizeArguments)
+->UseRealTime();
+BENCHMARK_REGISTER_F(PubSubPerformanceTest, type_adapter)
+->Apply(TypeAdapterArguments)
+->UseRealTime();
@@ -0,0 +1,186 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "performance_test_fixture/performance_test_fixture.hpp"
+#include "rclcpp/rclcpp.hpp"
+#include "test_msgs/msg/strings.hpp"
+
+using performance_test_fixture::PerformanceTest;
+
+namespace
+{
+
+size_t g_conversions = 0;
+size_t g_copies = 0;
+
+/// Custom type counting how many times it's copied.
+struct CountedString
+{
+  CountedString() = default;
+
+  explicit CountedString(std::string value)
+  : data(std::move(value)) {}
+
+  CountedString(const CountedString & other)
+  : data(other.data)
+  {
+    g_copies++;
+  }
+
+  CountedString & operator=(const CountedString & other)
+  {
+    data = other.data;
+    g_copies++;
+    return *this;
+  }
+
+  std::string data;
+};
+
+}  // namespace
+
+template<>
+struct rclcpp::TypeAdapter<CountedString, test_msgs::msg::Strings>
+{
+  using is_specialized = std::true_type;
+  using custom_type = CountedString;
+  using ros_message_type = test_msgs::msg::Strings;
+
+  static void
+  convert_to_ros_message(const custom_type & source, ros_message_type & destination)
+  {
+    g_conversions++;
+    destination.string_value = source.data;
+  }
+
+  static void
+  convert_to_custom(const ros_message_type & source, custom_type & destination)
+  {
+    g_conversions++;
+    destination.data = source.string_value;
+  }
+};
+
+using AdaptedType = rclcpp::TypeAdapter<CountedString, test_msgs::msg::Strings>;
+
+/// Kinds of subscriptions receiving the messages of the publisher.
+enum SubscriptionsKind
+{
+  IntraProcessROSType = 0,
+  IntraProcessAdaptedType,
+  InterProcess,
+  MixedROSType,
+  MixedAdaptedType,
+  IntraProcessTwoROSType,
+  IntraProcessSharedAndOwnedROSType,
+};
+
+class PublisherPerformanceTest : public PerformanceTest
+{
+public:
+  void SetUp(benchmark::State & state)
+  {
+    rclcpp::init(0, nullptr);
+    node = std::make_unique<rclcpp::Node>(
+      "node", "ns", rclcpp::NodeOptions().use_intra_process_comms(true));
+    publisher = node->create_publisher<AdaptedType>(topic_name, 1);
+
+    const auto kind = static_cast<SubscriptionsKind>(state.range(0));
+    if (kind == IntraProcessROSType || kind == MixedROSType || kind == IntraProcessTwoROSType ||
+      kind == IntraProcessSharedAndOwnedROSType)
+    {
+      ros_subscription = node->create_subscription<test_msgs::msg::Strings>(
+        topic_name, 1, [](test_msgs::msg::Strings::UniquePtr) {});
+    }
+    if (kind == IntraProcessTwoROSType) {
+      other_ros_subscriptions.push_back(
+        node->create_subscription<test_msgs::msg::Strings>(
+          topic_name, 1, [](test_msgs::msg::Strings::UniquePtr) {}));
+    }
+    if (kind == IntraProcessSharedAndOwnedROSType) {
+      for (size_t i = 0; i < 2; ++i) {
+        other_ros_subscriptions.push_back(
+          node->create_subscription<test_msgs::msg::Strings>(
+            topic_name, 1, [](test_msgs::msg::Strings::ConstSharedPtr) {}));
+      }
+    }
+    if (kind == IntraProcessAdaptedType || kind == MixedAdaptedType) {
+      adapted_subscription = node->create_subscription<AdaptedType>(
+        topic_name, 1, [](std::unique_ptr<CountedString>) {});
+    }
+    if (kind == InterProcess || kind == MixedROSType || kind == MixedAdaptedType) {
+      rclcpp::SubscriptionOptions options;
+      options.use_intra_process_comm = rclcpp::IntraProcessSetting::Disable;
+      inter_process_subscription = node->create_subscription<test_msgs::msg::Strings>(
+        topic_name, 1, [](test_msgs::msg::Strings::UniquePtr) {}, options);
+    }
+
+    performance_test_fixture::PerformanceTest::SetUp(state);
+  }
+
+  void TearDown(benchmark::State & state)
+  {
+    performance_test_fixture::PerformanceTest::TearDown(state);
+
+    inter_process_subscription.reset();
+    other_ros_subscriptions.clear();
+    adapted_subscription.reset();
+    ros_subscription.reset();
+    publisher.reset();
+    node.reset();
+    rclcpp::shutdown();
+  }
+
+protected:
+  static constexpr char topic_name[] = "counted_string";
+
+  std::unique_ptr<rclcpp::Node> node;
+  rclcpp::Publisher<AdaptedType>::SharedPtr publisher;
+  rclcpp::Subscription<test_msgs::msg::Strings>::SharedPtr ros_subscription;
+  std::vector<rclcpp::Subscription<test_msgs::msg::Strings>::SharedPtr> other_ros_subscriptions;
+  rclcpp::Subscription<AdaptedType>::SharedPtr adapted_subscription;
+  rclcpp::Subscription<test_msgs::msg::Strings>::SharedPtr inter_process_subscription;
+};
+
+BENCHMARK_DEFINE_F(PublisherPerformanceTest, publish_type_adapted)(benchmark::State & state) {
+  const std::string payload(1024, 'a');
+
+  g_conversions = 0;
+  g_copies = 0;
+  reset_heap_counters();
+  for (auto _ : state) {
+    (void)_;
+    publisher->publish(std::make_unique<CountedString>(payload));
+  }
+
+  // Report the number of conversions and copies done by rclcpp for each published message
+  state.counters["conversions"] = benchmark::Counter(
+    static_cast<double>(g_conversions), benchmark::Counter::kAvgIterations);
+  state.counters["copies"] = benchmark::Counter(
+    static_cast<double>(g_copies), benchmark::Counter::kAvgIterations);
+}
+BENCHMARK_REGISTER_F(PublisherPerformanceTest, publish_type_adapted)
+->ArgNames({"subscriptions"})
+->Arg(IntraProcessROSType)
+->Arg(IntraProcessAdaptedType)
+->Arg(InterProcess)
+->Arg(MixedROSType)
+->Arg(MixedAdaptedType)
+->Arg(IntraProcessTwoROSType)
+->Arg(IntraProcessSharedAndOwnedROSType);
@@ -0,0 +1,225 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "performance_test_fixture/performance_test_fixture.hpp"
+
+#include "rclcpp/callback_statistics.hpp"
+#include "rclcpp/contexts/default_context.hpp"
+#include "rclcpp/experimental/timers_manager.hpp"
+#include "rclcpp/rclcpp.hpp"
+
+using namespace std::chrono_literals;
+using performance_test_fixture::PerformanceTest;
+using rclcpp::experimental::TimersManager;
+using rclcpp::experimental::TimersStorageType;
+
+using CallbackT = std::function<void ()>;
+using TimerT = rclcpp::WallTimer<CallbackT>;
+
+/// Measure the operations of the timers manager.
+/**
+ * Arguments are: whether timers are stored in a timing wheel instead of a heap, and the
+ * number of timers.
+ */
+class PerformanceTestTimersManager : public PerformanceTest
+{
+public:
+  void SetUp(benchmark::State & st)
+  {
+    rclcpp::init(0, nullptr);
+    auto context = rclcpp::contexts::get_global_default_context();
+    const auto number_of_timers = static_cast<unsigned int>(st.range(1));
+    for (unsigned int i = 0u; i < number_of_timers; i++) {
+      // Spread the periods, so that the timers are not ordered by insertion
+      auto period = std::chrono::milliseconds(100 + (i * 7919) % 10000);
+      timers.push_back(TimerT::make_shared(period, CallbackT([]() {}), context));
+    }
+    PerformanceTest::SetUp(st);
+  }
+
+  void TearDown(benchmark::State & st)
+  {
+    PerformanceTest::TearDown(st);
+    timers.clear();
+    rclcpp::shutdown();
+  }
+
+  TimersManager::SharedPtr make_timers_manager(const benchmark::State & st)
+  {
+    auto storage_type = st.range(0) == 0 ?
+      TimersStorageType::Heap : TimersStorageType::TimingWheel;
+    return std::make_shared<TimersManager>(
+      rclcpp::contexts::get_global_default_context(), nullptr, storage_type);
+  }
+
+  std::vector<TimerT::SharedPtr> timers;
+};
+
+static void
+TimersManagerArguments(benchmark::internal::Benchmark * b)
+{
+  b->ArgNames({"timing_wheel", "timers"});
+  for (int64_t timing_wheel : {0, 1}) {
+    for (int64_t timers : {10, 1000, 100000}) {
+      b->Args({timing_wheel, timers});
+    }
+  }
+}
+
+BENCHMARK_DEFINE_F(PerformanceTestTimersManager, add_remove_timers)(benchmark::State & st)
+{
+  auto timers_manager = make_timers_manager(st);
+
+  reset_heap_counters();
+
+  for (auto _ : st) {
+    (void)_;
+    for (const auto & timer : timers) {
+      timers_manager->add_timer(timer);
+    }
+    for (const auto & timer : timers) {
+      timers_manager->remove_timer(timer);
+    }
+  }
+}
+BENCHMARK_REGISTER_F(PerformanceTestTimersManager, add_remove_timers)
+->Apply(TimersManagerArguments);
+
+BENCHMARK_DEFINE_F(PerformanceTestTimersManager, reset_timers)(benchmark::State & st)
+{
+  auto timers_manager = make_timers_manager(st);
+  for (const auto & timer : timers) {
+    timers_manager->add_timer(timer);
+  }
+
+  reset_heap_counters();
+
+  for (auto _ : st) {
+    (void)_;
+    for (const auto & timer : timers) {
+      timer->reset();
+    }
+  }
+
+  timers_manager->clear();
+}
+BENCHMARK_REGISTER_F(PerformanceTestTimersManager, reset_timers)
+->Apply(TimersManagerArguments);
+
+BENCHMARK_DEFINE_F(PerformanceTestTimersManager, get_head_timeout)(benchmark::State & st)
+{
+  auto timers_manager = make_timers_manager(st);
+  for (const auto & timer : timers) {
+    timers_manager->add_timer(timer);
+  }
+
+  reset_heap_counters();
+
+  for (auto _ : st) {
+    (void)_;
+    auto timeout = timers_manager->get_head_timeout();
+    benchmark::DoNotOptimize(timeout);
+  }
+
+  timers_manager->clear();
+}
+BENCHMARK_REGISTER_F(PerformanceTestTimersManager, get_head_timeout)
+->Apply(TimersManagerArguments);
+
+/// Measure how late the timers are executed by the thread of the timers manager.
+/**
+ * All the timers have the same period, every iteration waits until each of them was executed
+ * once more.
+ * The lateness of an execution is how much longer than the period it came after the previous
+ * execution of the timer.
+ */
+BENCHMARK_DEFINE_F(PerformanceTestTimersManager, execution_jitter)(benchmark::State & st)
+{
+  constexpr auto kPeriod = 10ms;
+  auto context = rclcpp::contexts::get_global_default_context();
+  std::atomic_size_t executed_count{0};
+  rclcpp::LatencyHistogram lateness;
+  std::vector<std::chrono::steady_clock::time_point> last_executions(timers.size());
+  std::vector<TimerT::SharedPtr> periodic_timers;
+  for (size_t i = 0; i < timers.size(); ++i) {
+    periodic_timers.push_back(
+      TimerT::make_shared(
+        kPeriod,
+        CallbackT(
+          [&, i]() {
+            const auto now = std::chrono::steady_clock::now();
+            if (last_executions[i] != std::chrono::steady_clock::time_point()) {
+              lateness.record(now - last_executions[i] - kPeriod);
+            }
+            last_executions[i] = now;
+            executed_count++;
+          }),
+        context));
+  }
+
+  auto timers_manager = make_timers_manager(st);
+  for (const auto & timer : periodic_timers) {
+    timers_manager->add_timer(timer);
+  }
+  timers_manager->start();
+
+  // Wait for all the timers to be executed once, so that the lateness can be measured
+  auto wait_for_executions = [&executed_count](size_t count) {
+      const auto deadline = std::chrono::steady_clock::now() + 5s;
+      while (executed_count < count) {
+        if (std::chrono::steady_clock::now() > deadline) {
+          return false;
+        }
+        std::this_thread::sleep_for(1ms);
+      }
+      return true;
+    };
+  if (!wait_for_executions(periodic_timers.size())) {
+    st.SkipWithError("Timers were not executed");
+    timers_manager->stop();
+    return;
+  }
+  lateness.reset();
+
+  reset_heap_counters();
+
+  for (auto _ : st) {
+    (void)_;
+    if (!wait_for_executions(executed_count + periodic_timers.size())) {
+      st.SkipWithError("Timers were not executed");
+      break;
+    }
+  }
+
+  timers_manager->stop();
+  timers_manager->clear();
+
+  auto to_us = [](std::chrono::nanoseconds value) {
+      return std::chrono::duration<double, std::micro>(value).count();
+    };
+  st.counters["lateness_p50_us"] = to_us(lateness.get_percentile(50.0));
+  st.counters["lateness_p99_us"] = to_us(lateness.get_percentile(99.0));
+  st.counters["lateness_max_us"] = to_us(lateness.get_max());
+}
+BENCHMARK_REGISTER_F(PerformanceTestTimersManager, execution_jitter)
+->Apply(TimersManagerArguments)
+->UseRealTime();
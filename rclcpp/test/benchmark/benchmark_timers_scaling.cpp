@@ -0,0 +1,212 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "performance_test_fixture/performance_test_fixture.hpp"
+
+#include "rclcpp/callback_statistics.hpp"
+#include "rclcpp/experimental/executors/events_executor/events_executor.hpp"
+#include "rclcpp/rclcpp.hpp"
+
+using namespace std::chrono_literals;
+using performance_test_fixture::PerformanceTest;
+
+/// Executors compared by the benchmarks, selected by the first argument.
+enum ExecutorKind
+{
+  SingleThreaded = 0,
+  StaticSingleThreaded,
+  Events,
+  // Events executor with the timers executed by the thread of its timers manager
+  EventsTimersThread,
+};
+
+/// Measure how the executors scale with the number of timers of their nodes.
+/**
+ * All the timers have the same period and are executed by an executor spinning in another
+ * thread, the wait set based ones wait for them while the events executor uses a timers
+ * manager.
+ * Arguments are: the executor kind and the number of timers.
+ */
+class PerformanceTestTimersScaling : public PerformanceTest
+{
+public:
+  static constexpr std::chrono::milliseconds kPeriod{10};
+
+  void SetUp(benchmark::State & st)
+  {
+    rclcpp::init(0, nullptr);
+    node = std::make_shared<rclcpp::Node>("timers_scaling_node");
+
+    const auto number_of_timers = static_cast<size_t>(st.range(1));
+    last_executions.resize(number_of_timers);
+    for (size_t i = 0; i < number_of_timers; ++i) {
+      timers.push_back(
+        node->create_wall_timer(
+          kPeriod, [this, i]() {
+            const auto now = std::chrono::steady_clock::now();
+            if (last_executions[i] != std::chrono::steady_clock::time_point()) {
+              lateness.record(now - last_executions[i] - kPeriod);
+            }
+            last_executions[i] = now;
+            executed_count++;
+          }));
+    }
+
+    executor = create_executor(static_cast<ExecutorKind>(st.range(0)));
+    executor->add_node(node);
+    spin_thread = std::thread([this]() {executor->spin();});
+
+    PerformanceTest::SetUp(st);
+  }
+
+  void TearDown(benchmark::State & st)
+  {
+    PerformanceTest::TearDown(st);
+    executor->cancel();
+    spin_thread.join();
+    executor.reset();
+    timers.clear();
+    node.reset();
+    rclcpp::shutdown();
+  }
+
+  static std::unique_ptr<rclcpp::Executor>
+  create_executor(ExecutorKind kind)
+  {
+    switch (kind) {
+      case StaticSingleThreaded:
+        return std::make_unique<rclcpp::executors::StaticSingleThreadedExecutor>();
+      case Events:
+        return std::make_unique<rclcpp::experimental::executors::EventsExecutor>();
+      case EventsTimersThread:
+        return std::make_unique<rclcpp::experimental::executors::EventsExecutor>(
+          std::make_unique<rclcpp::experimental::executors::SimpleEventsQueue>(), true);
+      case SingleThreaded:
+      default:
+        return std::make_unique<rclcpp::executors::SingleThreadedExecutor>();
+    }
+  }
+
+  /// Wait until the timers were executed count times in total.
+  bool
+  wait_for_executions(size_t count)
+  {
+    const auto deadline = std::chrono::steady_clock::now() + 30s;
+    while (executed_count < count) {
+      if (std::chrono::steady_clock::now() > deadline) {
+        return false;
+      }
+      std::this_thread::sleep_for(1ms);
+    }
+    return true;
+  }
+
+protected:
+  rclcpp::Node::SharedPtr node;
+  std::vector<rclcpp::TimerBase::SharedPtr> timers;
+  std::unique_ptr<rclcpp::Executor> executor;
+  std::thread spin_thread;
+
+  // Only accessed by the thread executing the timers
+  std::vector<std::chrono::steady_clock::time_point> last_executions;
+  std::atomic_size_t executed_count {0};
+  rclcpp::LatencyHistogram lateness;
+};
+
+/// Measure the throughput of the timers, and how much later than their period they execute.
+/**
+ * Every iteration waits until each timer was executed once more.
+ */
+BENCHMARK_DEFINE_F(PerformanceTestTimersScaling, execute_timers)(benchmark::State & st)
+{
+  // Warm up, so that the lateness is only measured between two executions of a timer
+  if (!wait_for_executions(timers.size())) {
+    st.SkipWithError("Timers were not executed");
+    return;
+  }
+  lateness.reset();
+  const size_t initial_count = executed_count;
+
+  reset_heap_counters();
+
+  for (auto _ : st) {
+    (void)_;
+    if (!wait_for_executions(executed_count + timers.size())) {
+      st.SkipWithError("Timers were not executed");
+      break;
+    }
+  }
+
+  auto to_us = [](std::chrono::nanoseconds value) {
+      return std::chrono::duration<double, std::micro>(value).count();
+    };
+  st.counters["executions_per_second"] = benchmark::Counter(
+    static_cast<double>(executed_count - initial_count), benchmark::Counter::kIsRate);
+  st.counters["lateness_p50_us"] = to_us(lateness.get_percentile(50.0));
+  st.counters["lateness_p99_us"] = to_us(lateness.get_percentile(99.0));
+  st.counters["lateness_p99.9_us"] = to_us(lateness.get_percentile(99.9));
+}
+
+/// Measure adding a timer to the node and removing it while the executor runs the others.
+BENCHMARK_DEFINE_F(PerformanceTestTimersScaling, add_remove_timer)(benchmark::State & st)
+{
+  reset_heap_counters();
+
+  for (auto _ : st) {
+    (void)_;
+    auto timer = node->create_wall_timer(1s, []() {});
+    timer.reset();
+  }
+}
+
+/// Measure resetting all the timers while the executor runs them.
+BENCHMARK_DEFINE_F(PerformanceTestTimersScaling, reset_timers)(benchmark::State & st)
+{
+  reset_heap_counters();
+
+  for (auto _ : st) {
+    (void)_;
+    for (const auto & timer : timers) {
+      timer->reset();
+    }
+  }
+}
+
+static void
+TimersScalingArguments(benchmark::internal::Benchmark * b)
+{
+  b->ArgNames({"executor", "timers"});
+  for (int64_t executor : {SingleThreaded, StaticSingleThreaded, Events, EventsTimersThread}) {
+    for (int64_t timers : {10, 1000, 100000}) {
+      b->Args({executor, timers});
+    }
+  }
+}
+
+BENCHMARK_REGISTER_F(PerformanceTestTimersScaling, execute_timers)
+->Apply(TimersScalingArguments)
+->UseRealTime();
+BENCHMARK_REGISTER_F(PerformanceTestTimersScaling, add_remove_timer)
+->Apply(TimersScalingArguments)
+->UseRealTime();
+BENCHMARK_REGISTER_F(PerformanceTestTimersScaling, reset_timers)
+->Apply(TimersScalingArguments)
+->UseRealTime();
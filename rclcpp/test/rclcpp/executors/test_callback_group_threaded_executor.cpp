@@ -0,0 +1,134 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+
+#include "rclcpp/executors/callback_group_threaded_executor.hpp"
+#include "rclcpp/node.hpp"
+#include "rclcpp/rclcpp.hpp"
+
+using namespace std::chrono_literals;
+
+class TestCallbackGroupThreadedExecutor : public ::testing::Test
+{
+protected:
+  static void SetUpTestCase()
+  {
+    rclcpp::init(0, nullptr);
+  }
+
+  static void TearDownTestCase()
+  {
+    rclcpp::shutdown();
+  }
+};
+
+/*
+   Test that each callback group runs in its own thread, other than the spinning one.
+ */
+TEST_F(TestCallbackGroupThreadedExecutor, thread_per_group) {
+  rclcpp::executors::CallbackGroupThreadedExecutor executor;
+  EXPECT_EQ(0u, executor.get_number_of_threads());
+
+  auto node = std::make_shared<rclcpp::Node>("test_callback_group_threaded_executor");
+  auto group_1 = node->create_callback_group(rclcpp::CallbackGroupType::Reentrant);
+  auto group_2 = node->create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive);
+
+  std::mutex threads_mutex;
+  std::set<std::thread::id> threads_1;
+  std::set<std::thread::id> threads_2;
+  std::atomic_int executions_1{0};
+  std::atomic_int executions_2{0};
+  auto timer_1 = node->create_wall_timer(
+    1ms, [&]() {
+      std::lock_guard<std::mutex> lock(threads_mutex);
+      threads_1.insert(std::this_thread::get_id());
+      executions_1++;
+    }, group_1);
+  auto timer_2 = node->create_wall_timer(
+    1ms, [&]() {
+      std::lock_guard<std::mutex> lock(threads_mutex);
+      threads_2.insert(std::this_thread::get_id());
+      executions_2++;
+    }, group_2);
+
+  executor.add_node(node);
+  std::thread::id spin_thread;
+  std::thread spinner([&]() {
+      spin_thread = std::this_thread::get_id();
+      executor.spin();
+    });
+  const auto deadline = std::chrono::steady_clock::now() + 5s;
+  while ((executions_1.load() < 10 || executions_2.load() < 10) &&
+    std::chrono::steady_clock::now() < deadline)
+  {
+    std::this_thread::sleep_for(1ms);
+  }
+  const size_t number_of_threads = executor.get_number_of_threads();
+  executor.cancel();
+  spinner.join();
+
+  // The default callback group of the node has no work, so it has no thread
+  EXPECT_EQ(2u, number_of_threads);
+  EXPECT_EQ(0u, executor.get_number_of_threads());
+  std::lock_guard<std::mutex> lock(threads_mutex);
+  ASSERT_EQ(1u, threads_1.size());
+  ASSERT_EQ(1u, threads_2.size());
+  EXPECT_NE(*threads_1.begin(), *threads_2.begin());
+  EXPECT_EQ(0u, threads_1.count(spin_thread));
+  EXPECT_EQ(0u, threads_2.count(spin_thread));
+}
+
+#ifdef __linux__
+/*
+   Test that the thread of a callback group is started with the attributes of the group.
+ */
+TEST_F(TestCallbackGroupThreadedExecutor, thread_attributes) {
+  rclcpp::executors::CallbackGroupThreadedExecutor executor;
+
+  auto node = std::make_shared<rclcpp::Node>("test_callback_group_threaded_executor_attributes");
+  auto group = node->create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive);
+  rclcpp::ThreadAttributes attributes;
+  attributes.name = "cbg_worker";
+  group->set_thread_attributes(attributes);
+  EXPECT_EQ("cbg_worker", group->get_thread_attributes().name);
+
+  std::mutex name_mutex;
+  std::string thread_name;
+  auto timer = node->create_wall_timer(
+    1ms, [&]() {
+      char buffer[16] = {};
+      pthread_getname_np(pthread_self(), buffer, sizeof(buffer));
+      {
+        std::lock_guard<std::mutex> lock(name_mutex);
+        thread_name = buffer;
+      }
+      executor.cancel();
+    }, group);
+
+  executor.add_node(node);
+  executor.spin();
+
+  std::lock_guard<std::mutex> lock(name_mutex);
+  EXPECT_EQ("cbg_worker", thread_name);
+}
+#endif
@@ -0,0 +1,192 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "rclcpp/executors/dispatching_executor.hpp"
+#include "rclcpp/node.hpp"
+#include "rclcpp/rclcpp.hpp"
+
+using namespace std::chrono_literals;
+using rclcpp::executors::DispatchingExecutor;
+
+namespace
+{
+
+/// Minimal thread pool standing for the task system of an application.
+class ThreadPool
+{
+public:
+  explicit ThreadPool(size_t size)
+  {
+    for (size_t i = 0; i < size; ++i) {
+      threads_.emplace_back([this]() {run();});
+    }
+  }
+
+  ~ThreadPool()
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      should_stop_ = true;
+    }
+    cv_.notify_all();
+    for (auto & thread : threads_) {
+      thread.join();
+    }
+  }
+
+  void
+  push(DispatchingExecutor::Task task)
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      tasks_.push_back(std::move(task));
+    }
+    cv_.notify_one();
+  }
+
+private:
+  void
+  run()
+  {
+    while (true) {
+      DispatchingExecutor::Task task;
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait(lock, [this]() {return should_stop_ || !tasks_.empty();});
+        if (tasks_.empty()) {
+          return;
+        }
+        task = std::move(tasks_.front());
+        tasks_.pop_front();
+      }
+      task();
+    }
+  }
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::deque<DispatchingExecutor::Task> tasks_;
+  bool should_stop_ = false;
+  std::vector<std::thread> threads_;
+};
+
+}  // namespace
+
+class TestDispatchingExecutor : public ::testing::Test
+{
+protected:
+  static void SetUpTestCase()
+  {
+    rclcpp::init(0, nullptr);
+  }
+
+  static void TearDownTestCase()
+  {
+    rclcpp::shutdown();
+  }
+};
+
+TEST_F(TestDispatchingExecutor, empty_dispatcher) {
+  EXPECT_THROW(DispatchingExecutor executor(nullptr), std::invalid_argument);
+}
+
+/*
+   Test that callbacks run in the pool, one at a time for a mutually exclusive group.
+ */
+TEST_F(TestDispatchingExecutor, run_in_pool) {
+  ThreadPool pool(4);
+  DispatchingExecutor executor([&pool](DispatchingExecutor::Task task) {
+      pool.push(std::move(task));
+    });
+
+  auto node = std::make_shared<rclcpp::Node>("test_dispatching_executor");
+  auto group = node->create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive);
+  std::thread::id spin_thread;
+  std::atomic_int running{0};
+  std::atomic_bool overlapped{false};
+  std::atomic_bool ran_in_spin_thread{false};
+  std::atomic_int executions{0};
+  auto callback = [&]() {
+      if (running.fetch_add(1) != 0) {
+        overlapped = true;
+      }
+      if (std::this_thread::get_id() == spin_thread) {
+        ran_in_spin_thread = true;
+      }
+      std::this_thread::sleep_for(1ms);
+      running--;
+      executions++;
+    };
+  auto timer_1 = node->create_wall_timer(1ms, callback, group);
+  auto timer_2 = node->create_wall_timer(1ms, callback, group);
+
+  executor.add_node(node);
+  std::thread spinner([&]() {
+      spin_thread = std::this_thread::get_id();
+      executor.spin();
+    });
+  const auto deadline = std::chrono::steady_clock::now() + 5s;
+  while (executions.load() < 20 && std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::sleep_for(1ms);
+  }
+  executor.cancel();
+  spinner.join();
+
+  EXPECT_GE(executions.load(), 20);
+  EXPECT_FALSE(overlapped.load());
+  EXPECT_FALSE(ran_in_spin_thread.load());
+  // spin() returned once all its tasks were done
+  EXPECT_EQ(0u, executor.get_number_of_pending_tasks());
+}
+
+/*
+   Test that a task destroyed without being run releases its callback group.
+ */
+TEST_F(TestDispatchingExecutor, dropped_task) {
+  std::atomic_int dispatched{0};
+  DispatchingExecutor executor([&dispatched](DispatchingExecutor::Task) {
+      dispatched++;
+    });
+
+  auto node = std::make_shared<rclcpp::Node>("test_dispatching_executor_dropped");
+  auto group = node->create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive);
+  std::atomic_bool executed{false};
+  auto timer = node->create_wall_timer(1ms, [&]() {executed = true;}, group);
+
+  executor.add_node(node);
+  std::thread spinner([&]() {executor.spin();});
+  const auto deadline = std::chrono::steady_clock::now() + 5s;
+  while (dispatched.load() < 3 && std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::sleep_for(1ms);
+  }
+  executor.cancel();
+  spinner.join();
+
+  EXPECT_GE(dispatched.load(), 3);
+  EXPECT_FALSE(executed.load());
+  EXPECT_EQ(0u, executor.get_number_of_pending_tasks());
+}
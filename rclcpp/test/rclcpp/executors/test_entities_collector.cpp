@@ -14,8 +14,13 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <memory>
+#include <vector>
+
 #include "rclcpp/executors/executor_notify_waitable.hpp"
 #include "rclcpp/rclcpp.hpp"
+#include "rclcpp/executors/executor_entities_collection.hpp"
 #include "rclcpp/executors/executor_entities_collector.hpp"
 
 #include "../../utils/rclcpp_gtest_macros.hpp"
@@ -318,3 +323,113 @@ TEST_F(TestExecutorEntitiesCollector, remove_node_opposite_order) {
 
   EXPECT_NO_THROW(entities_collector.remove_node(node2->get_node_base_interface()));
 }
+
+TEST_F(TestExecutorEntitiesCollector, collect_entities_changes) {
+  using rclcpp::executors::ExecutorEntitiesCollection;
+  auto node = std::make_shared<rclcpp::Node>("node1", "ns");
+  rclcpp::CallbackGroup::SharedPtr cb_group1 = node->create_callback_group(
+    rclcpp::CallbackGroupType::MutuallyExclusive, false);
+  rclcpp::CallbackGroup::SharedPtr cb_group2 = node->create_callback_group(
+    rclcpp::CallbackGroupType::MutuallyExclusive, false);
+  auto timer1 = node->create_wall_timer(std::chrono::seconds(1), []() {}, cb_group1);
+  auto timer2 = node->create_wall_timer(std::chrono::seconds(1), []() {}, cb_group2);
+
+  rclcpp::executors::CallbackGroupsEntities groups_entities;
+  std::vector<rclcpp::CallbackGroup::WeakPtr> groups = {cb_group1, cb_group2};
+  {
+    ExecutorEntitiesCollection added, removed;
+    rclcpp::executors::collect_entities_changes(groups, groups_entities, added, removed);
+    EXPECT_EQ(2u, added.timers.size());
+    EXPECT_TRUE(removed.empty());
+  }
+  {
+    // Nothing changed
+    ExecutorEntitiesCollection added, removed;
+    rclcpp::executors::collect_entities_changes(groups, groups_entities, added, removed);
+    EXPECT_TRUE(added.empty());
+    EXPECT_TRUE(removed.empty());
+  }
+  auto timer3 = node->create_wall_timer(std::chrono::seconds(1), []() {}, cb_group1);
+  {
+    ExecutorEntitiesCollection added, removed;
+    rclcpp::executors::collect_entities_changes(groups, groups_entities, added, removed);
+    ASSERT_EQ(1u, added.timers.size());
+    EXPECT_EQ(timer3->get_timer_handle().get(), added.timers.begin()->first);
+    EXPECT_TRUE(removed.empty());
+  }
+  cb_group2->set_enabled(false);
+  {
+    ExecutorEntitiesCollection added, removed;
+    rclcpp::executors::collect_entities_changes(groups, groups_entities, added, removed);
+    EXPECT_TRUE(added.empty());
+    ASSERT_EQ(1u, removed.timers.size());
+    EXPECT_EQ(timer2->get_timer_handle().get(), removed.timers.begin()->first);
+  }
+  groups = {cb_group2};
+  {
+    // The entities of the groups which aren't collected anymore are removed
+    ExecutorEntitiesCollection added, removed;
+    rclcpp::executors::collect_entities_changes(groups, groups_entities, added, removed);
+    EXPECT_TRUE(added.empty());
+    EXPECT_EQ(2u, removed.timers.size());
+  }
+
+  ExecutorEntitiesCollection current;
+  ExecutorEntitiesCollection added;
+  added.timers.insert({timer1->get_timer_handle().get(), {timer1, cb_group1}});
+  size_t added_count = 0;
+  size_t removed_count = 0;
+  auto on_added = [&added_count](const rclcpp::TimerBase::SharedPtr &) {added_count++;};
+  auto on_removed = [&removed_count](const rclcpp::TimerBase::SharedPtr &) {removed_count++;};
+  current.timers.apply_changes(added.timers, {}, on_added, on_removed);
+  // Adding the same entity again doesn't fire the callbacks
+  current.timers.apply_changes(added.timers, {}, on_added, on_removed);
+  EXPECT_EQ(1u, added_count);
+  current.timers.apply_changes({}, added.timers, on_added, on_removed);
+  EXPECT_EQ(1u, removed_count);
+  EXPECT_TRUE(current.timers.empty());
+}
+
+TEST_F(TestExecutorEntitiesCollector, collect_entities_changes_destroyed_entity) {
+  using rclcpp::executors::ExecutorEntitiesCollection;
+  auto node = std::make_shared<rclcpp::Node>("node1", "ns");
+  rclcpp::CallbackGroup::SharedPtr cb_group = node->create_callback_group(
+    rclcpp::CallbackGroupType::MutuallyExclusive, false);
+  auto timer1 = node->create_wall_timer(std::chrono::seconds(1), []() {}, cb_group);
+  auto timer2 = node->create_wall_timer(std::chrono::seconds(1), []() {}, cb_group);
+  const auto timer1_handle = timer1->get_timer_handle().get();
+
+  rclcpp::executors::CallbackGroupsEntities groups_entities;
+  std::vector<rclcpp::CallbackGroup::WeakPtr> groups = {cb_group};
+  {
+    ExecutorEntitiesCollection added, removed;
+    rclcpp::executors::collect_entities_changes(groups, groups_entities, added, removed);
+    EXPECT_EQ(2u, added.timers.size());
+  }
+  timer1.reset();
+  {
+    // The version of the group doesn't change when an entity is destroyed
+    ExecutorEntitiesCollection added, removed;
+    rclcpp::executors::collect_entities_changes(groups, groups_entities, added, removed);
+    EXPECT_TRUE(added.empty());
+    ASSERT_EQ(1u, removed.timers.size());
+    EXPECT_EQ(timer1_handle, removed.timers.begin()->first);
+  }
+  {
+    ExecutorEntitiesCollection added, removed;
+    rclcpp::executors::collect_entities_changes(groups, groups_entities, added, removed);
+    EXPECT_TRUE(added.empty());
+    EXPECT_TRUE(removed.empty());
+  }
+
+  // A recreated entity reusing the handle of a destroyed one is removed and added again
+  auto timer3 = node->create_wall_timer(std::chrono::seconds(1), []() {}, cb_group);
+  ExecutorEntitiesCollection previous, next, added, removed;
+  previous.timers.insert({timer2->get_timer_handle().get(), {timer2, cb_group}});
+  next.timers.insert({timer2->get_timer_handle().get(), {timer3, cb_group}});
+  rclcpp::executors::diff_entities(previous.timers, next.timers, added.timers, removed.timers);
+  ASSERT_EQ(1u, added.timers.size());
+  EXPECT_EQ(timer3, added.timers.begin()->second.entity.lock());
+  ASSERT_EQ(1u, removed.timers.size());
+  EXPECT_EQ(timer2, removed.timers.begin()->second.entity.lock());
+}
@@ -14,9 +14,11 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
 #include <chrono>
 #include <memory>
 #include <string>
+#include <thread>
 
 #include "rclcpp/experimental/executors/events_executor/events_executor.hpp"
 
@@ -383,6 +385,192 @@ TEST_F(TestEventsExecutor, cancel_while_timers_waiting)
   EXPECT_TRUE(std::chrono::steady_clock::now() - start < 1s);
 }
 
+TEST_F(TestEventsExecutor, wait_for_timers_in_events_loop)
+{
+  auto node = std::make_shared<rclcpp::Node>("node");
+
+  std::atomic_size_t t1_runs{0};
+  auto t1 = node->create_wall_timer(1ms, [&]() {t1_runs++;});
+
+  EventsExecutor executor;
+  EXPECT_FALSE(executor.get_wait_for_timers_in_events_loop());
+  executor.set_wait_for_timers_in_events_loop(true);
+  EXPECT_TRUE(executor.get_wait_for_timers_in_events_loop());
+  executor.add_node(node);
+
+  std::thread spinner([&executor]() {executor.spin();});
+
+  auto start = std::chrono::steady_clock::now();
+  while (t1_runs < 10u && std::chrono::steady_clock::now() - start < 5s) {
+    std::this_thread::sleep_for(5ms);
+  }
+  EXPECT_THROW(executor.set_wait_for_timers_in_events_loop(false), std::runtime_error);
+
+  // A timer added while waiting for the head timer is waited for as well
+  std::atomic_size_t t2_runs{0};
+  auto t2 = node->create_wall_timer(1ms, [&]() {t2_runs++;});
+  start = std::chrono::steady_clock::now();
+  while (t2_runs < 10u && std::chrono::steady_clock::now() - start < 5s) {
+    std::this_thread::sleep_for(5ms);
+  }
+  executor.cancel();
+  spinner.join();
+
+  EXPECT_GE(t1_runs, 10u);
+  EXPECT_GE(t2_runs, 10u);
+
+  EventsExecutor separate_thread_executor(
+    std::make_unique<rclcpp::experimental::executors::SimpleEventsQueue>(), true);
+  EXPECT_THROW(
+    separate_thread_executor.set_wait_for_timers_in_events_loop(true), std::invalid_argument);
+}
+
+TEST_F(TestEventsExecutor, multi_threaded_mutually_exclusive_group)
+{
+  auto node = std::make_shared<rclcpp::Node>("node");
+  auto group = node->create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive);
+
+  std::atomic_int running_callbacks{0};
+  std::atomic_bool overlap{false};
+  std::atomic_size_t total_runs{0};
+  auto callback = [&]() {
+      if (running_callbacks.fetch_add(1) != 0) {
+        overlap = true;
+      }
+      std::this_thread::sleep_for(2ms);
+      running_callbacks.fetch_sub(1);
+      total_runs++;
+    };
+  auto t1 = node->create_wall_timer(1ms, callback, group);
+  auto t2 = node->create_wall_timer(1ms, callback, group);
+  auto t3 = node->create_wall_timer(1ms, callback, group);
+
+  EventsExecutor executor(
+    std::make_unique<rclcpp::experimental::executors::SimpleEventsQueue>(),
+    false, rclcpp::ExecutorOptions(), 4);
+  EXPECT_EQ(4u, executor.get_number_of_threads());
+  executor.add_node(node);
+
+  std::thread spinner([&executor]() {executor.spin();});
+
+  auto start = std::chrono::steady_clock::now();
+  while (total_runs < 20u && std::chrono::steady_clock::now() - start < 5s) {
+    std::this_thread::sleep_for(5ms);
+  }
+  executor.cancel();
+  spinner.join();
+
+  EXPECT_GE(total_runs, 20u);
+  EXPECT_FALSE(overlap);
+}
+
+TEST_F(TestEventsExecutor, multi_threaded_reentrant_group)
+{
+  auto node = std::make_shared<rclcpp::Node>("node");
+  auto group = node->create_callback_group(rclcpp::CallbackGroupType::Reentrant);
+
+  std::atomic_int running_callbacks{0};
+  std::atomic_int max_running_callbacks{0};
+  auto callback = [&]() {
+      int running = running_callbacks.fetch_add(1) + 1;
+      int max_running = max_running_callbacks.load();
+      while (running > max_running &&
+        !max_running_callbacks.compare_exchange_weak(max_running, running))
+      {
+      }
+      std::this_thread::sleep_for(20ms);
+      running_callbacks.fetch_sub(1);
+    };
+  auto t1 = node->create_wall_timer(1ms, callback, group);
+  auto t2 = node->create_wall_timer(1ms, callback, group);
+
+  EventsExecutor executor(
+    std::make_unique<rclcpp::experimental::executors::SimpleEventsQueue>(),
+    false, rclcpp::ExecutorOptions(), 2);
+  executor.add_node(node);
+
+  std::thread spinner([&executor]() {executor.spin();});
+
+  auto start = std::chrono::steady_clock::now();
+  while (max_running_callbacks < 2 && std::chrono::steady_clock::now() - start < 5s) {
+    std::this_thread::sleep_for(5ms);
+  }
+  executor.cancel();
+  spinner.join();
+
+  // Different timers of a reentrant group run in parallel, while each timer is serialized
+  EXPECT_EQ(2, max_running_callbacks.load());
+}
+
+TEST_F(TestEventsExecutor, intra_process_inline_depth)
+{
+  auto node = std::make_shared<rclcpp::Node>(
+    "node", rclcpp::NodeOptions().use_intra_process_comms(true));
+
+  // The timer publishes on "a", whose subscription republishes on "b"
+  bool publishing_a = false;
+  bool publishing_b = false;
+  int a_inline = -1;
+  int b_inline = -1;
+  int same_group_inline = -1;
+  auto publisher_a = node->create_publisher<test_msgs::msg::Empty>("a", 10);
+  auto publisher_b = node->create_publisher<test_msgs::msg::Empty>("b", 10);
+  rclcpp::SubscriptionOptions options_a;
+  options_a.callback_group =
+    node->create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive);
+  auto subscription_a = node->create_subscription<test_msgs::msg::Empty>(
+    "a", 10,
+    [&](test_msgs::msg::Empty::ConstSharedPtr) {
+      a_inline = publishing_a;
+      publishing_b = true;
+      publisher_b->publish(test_msgs::msg::Empty());
+      publishing_b = false;
+    },
+    options_a);
+  rclcpp::SubscriptionOptions options_b;
+  options_b.callback_group =
+    node->create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive);
+  auto subscription_b = node->create_subscription<test_msgs::msg::Empty>(
+    "b", 10,
+    [&](test_msgs::msg::Empty::ConstSharedPtr) {b_inline = publishing_b;}, options_b);
+  // In the mutually exclusive group of the timer, it's never executed nested in the timer
+  auto same_group_subscription = node->create_subscription<test_msgs::msg::Empty>(
+    "a", 10,
+    [&](test_msgs::msg::Empty::ConstSharedPtr) {same_group_inline = publishing_a;});
+  auto timer = node->create_wall_timer(
+    1ms, [&](rclcpp::TimerBase & timer) {
+      timer.cancel();
+      publishing_a = true;
+      publisher_a->publish(test_msgs::msg::Empty());
+      publishing_a = false;
+    });
+
+  EventsExecutor executor;
+  EXPECT_EQ(0u, executor.get_intra_process_inline_depth());
+  executor.add_node(node);
+  executor.set_intra_process_inline_depth(1);
+  EXPECT_EQ(1u, executor.get_intra_process_inline_depth());
+
+  auto start = std::chrono::steady_clock::now();
+  while ((b_inline < 0 || same_group_inline < 0) &&
+    std::chrono::steady_clock::now() - start < 5s)
+  {
+    executor.spin_some(10ms);
+  }
+
+  // Only the first message is executed inline, the second one is deeper than the limit
+  EXPECT_EQ(1, a_inline);
+  EXPECT_EQ(0, b_inline);
+  EXPECT_EQ(0, same_group_inline);
+
+  EventsExecutor multi_threaded_executor(
+    std::make_unique<rclcpp::experimental::executors::SimpleEventsQueue>(),
+    false, rclcpp::ExecutorOptions(), 2);
+  EXPECT_THROW(
+    multi_threaded_executor.set_intra_process_inline_depth(1), std::invalid_argument);
+  EXPECT_NO_THROW(multi_threaded_executor.set_intra_process_inline_depth(0));
+}
+
 TEST_F(TestEventsExecutor, destroy_entities)
 {
   // This test fails on Windows! We skip it for now
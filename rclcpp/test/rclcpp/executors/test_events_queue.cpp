@@ -15,8 +15,12 @@
 #include <gtest/gtest.h>
 
 #include <memory>
+#include <thread>
+#include <vector>
 
+#include "rclcpp/experimental/executors/events_executor/bounded_events_queue.hpp"
 #include "rclcpp/experimental/executors/events_executor/events_executor_event_types.hpp"
+#include "rclcpp/experimental/executors/events_executor/lock_free_events_queue.hpp"
 #include "rclcpp/experimental/executors/events_executor/simple_events_queue.hpp"
 
 using namespace std::chrono_literals;
@@ -70,13 +74,160 @@ TEST(TestEventsQueue, SimpleQueueTest)
     simple_queue.get(),
     99,
     rclcpp::experimental::executors::ExecutorEventType::SUBSCRIPTION_EVENT,
-    1};
+    1,
+    3,
+    7,
+    0};
 
   simple_queue->enqueue(push_event);
   ret = simple_queue->dequeue(event);
   EXPECT_TRUE(ret);
   EXPECT_EQ(push_event.entity_key, event.entity_key);
   EXPECT_EQ(push_event.waitable_data, event.waitable_data);
+  EXPECT_EQ(push_event.entity_slot, event.entity_slot);
+  EXPECT_EQ(push_event.entity_generation, event.entity_generation);
   EXPECT_EQ(push_event.type, event.type);
   EXPECT_EQ(push_event.num_events, event.num_events);
 }
+
+TEST(TestEventsQueue, LockFreeQueueTest)
+{
+  // Use a small capacity to exercise the overflow path
+  auto lock_free_queue =
+    std::make_unique<rclcpp::experimental::executors::LockFreeEventsQueue>(4);
+  rclcpp::experimental::executors::ExecutorEvent event {};
+  bool ret = false;
+
+  // Make sure the queue is empty at startup
+  EXPECT_TRUE(lock_free_queue->empty());
+  EXPECT_EQ(lock_free_queue->size(), 0u);
+
+  // Push 10 events, more than the capacity of the ring
+  for (uint32_t i = 1; i < 11; i++) {
+    rclcpp::experimental::executors::ExecutorEvent stub_event {};
+    stub_event.waitable_data = static_cast<int>(i);
+    stub_event.num_events = 1;
+    lock_free_queue->enqueue(stub_event);
+
+    EXPECT_FALSE(lock_free_queue->empty());
+    EXPECT_EQ(lock_free_queue->size(), i);
+  }
+
+  // Events are dequeued in order, including the overflowing ones
+  for (int i = 1; i < 11; i++) {
+    ret = lock_free_queue->dequeue(event, std::chrono::nanoseconds(0));
+    EXPECT_TRUE(ret);
+    EXPECT_EQ(i, event.waitable_data);
+  }
+
+  EXPECT_TRUE(lock_free_queue->empty());
+  EXPECT_EQ(lock_free_queue->size(), 0u);
+
+  ret = lock_free_queue->dequeue(event, std::chrono::nanoseconds(0));
+  EXPECT_FALSE(ret);
+  ret = lock_free_queue->dequeue(event, std::chrono::milliseconds(1));
+  EXPECT_FALSE(ret);
+
+  // Events with multiple occurrences are stored once with their count
+  rclcpp::experimental::executors::ExecutorEvent push_event = {
+    lock_free_queue.get(),
+    99,
+    rclcpp::experimental::executors::ExecutorEventType::SUBSCRIPTION_EVENT,
+    5,
+    0,
+    0,
+    0};
+
+  lock_free_queue->enqueue(push_event);
+  EXPECT_EQ(lock_free_queue->size(), 1u);
+  ret = lock_free_queue->dequeue(event);
+  EXPECT_TRUE(ret);
+  EXPECT_EQ(push_event.entity_key, event.entity_key);
+  EXPECT_EQ(push_event.waitable_data, event.waitable_data);
+  EXPECT_EQ(push_event.type, event.type);
+  EXPECT_EQ(push_event.num_events, event.num_events);
+}
+
+TEST(TestEventsQueue, BoundedQueueTest)
+{
+  using rclcpp::experimental::executors::ExecutorEvent;
+  using rclcpp::experimental::executors::ExecutorEventType;
+  auto bounded_queue = std::make_unique<rclcpp::experimental::executors::BoundedEventsQueue>();
+  ExecutorEvent event {};
+  int entity_a = 0;
+  int entity_b = 0;
+
+  // Events of the same entity are coalesced up to their limit
+  ExecutorEvent event_a = {&entity_a, -1, ExecutorEventType::SUBSCRIPTION_EVENT, 1, 0, 1, 3};
+  ExecutorEvent event_b = {&entity_b, -1, ExecutorEventType::SUBSCRIPTION_EVENT, 1, 1, 1, 0};
+  for (int i = 0; i < 10; i++) {
+    bounded_queue->enqueue(event_a);
+    bounded_queue->enqueue(event_b);
+  }
+  EXPECT_EQ(bounded_queue->size(), 2u);
+
+  // Timer events are all kept, as well as the events of a slot reused by another entity
+  ExecutorEvent timer_event = {&entity_a, -1, ExecutorEventType::TIMER_EVENT, 1, 0, 0, 0};
+  bounded_queue->enqueue(timer_event);
+  bounded_queue->enqueue(timer_event);
+  ExecutorEvent reused_event = event_a;
+  reused_event.entity_generation = 2;
+  bounded_queue->enqueue(reused_event);
+  EXPECT_EQ(bounded_queue->size(), 5u);
+
+  // Coalesced events keep the position of the first one
+  EXPECT_TRUE(bounded_queue->dequeue(event, std::chrono::nanoseconds(0)));
+  EXPECT_EQ(&entity_a, event.entity_key);
+  EXPECT_EQ(3u, event.num_events);
+  EXPECT_TRUE(bounded_queue->dequeue(event, std::chrono::nanoseconds(0)));
+  EXPECT_EQ(&entity_b, event.entity_key);
+  EXPECT_EQ(10u, event.num_events);
+  for (int i = 0; i < 2; i++) {
+    EXPECT_TRUE(bounded_queue->dequeue(event, std::chrono::nanoseconds(0)));
+    EXPECT_EQ(ExecutorEventType::TIMER_EVENT, event.type);
+    EXPECT_EQ(1u, event.num_events);
+  }
+  EXPECT_TRUE(bounded_queue->dequeue(event, std::chrono::nanoseconds(0)));
+  EXPECT_EQ(2u, event.entity_generation);
+  EXPECT_EQ(1u, event.num_events);
+
+  // Once dequeued, the events of an entity are queued again
+  EXPECT_TRUE(bounded_queue->empty());
+  bounded_queue->enqueue(event_a);
+  EXPECT_TRUE(bounded_queue->dequeue(event, std::chrono::milliseconds(1)));
+  EXPECT_EQ(1u, event.num_events);
+  EXPECT_FALSE(bounded_queue->dequeue(event, std::chrono::milliseconds(1)));
+}
+
+TEST(TestEventsQueue, LockFreeQueueMultipleProducers)
+{
+  auto lock_free_queue =
+    std::make_unique<rclcpp::experimental::executors::LockFreeEventsQueue>(16);
+  constexpr size_t num_producers = 4;
+  constexpr size_t events_per_producer = 1000;
+
+  std::vector<std::thread> producers;
+  for (size_t p = 0; p < num_producers; p++) {
+    producers.emplace_back(
+      [&lock_free_queue]() {
+        for (size_t i = 0; i < events_per_producer; i++) {
+          rclcpp::experimental::executors::ExecutorEvent stub_event {};
+          stub_event.num_events = 1;
+          lock_free_queue->enqueue(stub_event);
+        }
+      });
+  }
+
+  // The consumer blocks waiting for events, it must be woken up by the producers
+  size_t received_events = 0;
+  rclcpp::experimental::executors::ExecutorEvent event {};
+  while (received_events < num_producers * events_per_producer) {
+    ASSERT_TRUE(lock_free_queue->dequeue(event, std::chrono::seconds(5)));
+    received_events += event.num_events;
+  }
+
+  for (auto & producer : producers) {
+    producer.join();
+  }
+  EXPECT_TRUE(lock_free_queue->empty());
+}
@@ -24,6 +24,7 @@
 #include <chrono>
 #include <limits>
 #include <memory>
+#include <stdexcept>
 #include <string>
 #include <thread>
 #include <utility>
@@ -88,6 +89,7 @@ using ExecutorTypes =
   ::testing::Types<
   rclcpp::executors::SingleThreadedExecutor,
   rclcpp::executors::MultiThreadedExecutor,
+  rclcpp::executors::WorkStealingMultiThreadedExecutor,
   rclcpp::executors::StaticSingleThreadedExecutor,
   rclcpp::experimental::executors::EventsExecutor>;
 
@@ -106,6 +108,10 @@ public:
       return "MultiThreadedExecutor";
     }
 
+    if (std::is_same<T, rclcpp::executors::WorkStealingMultiThreadedExecutor>()) {
+      return "WorkStealingMultiThreadedExecutor";
+    }
+
     if (std::is_same<T, rclcpp::executors::StaticSingleThreadedExecutor>()) {
       return "StaticSingleThreadedExecutor";
     }
@@ -128,6 +134,7 @@ using StandardExecutors =
   ::testing::Types<
   rclcpp::executors::SingleThreadedExecutor,
   rclcpp::executors::MultiThreadedExecutor,
+  rclcpp::executors::WorkStealingMultiThreadedExecutor,
   rclcpp::experimental::executors::EventsExecutor>;
 TYPED_TEST_SUITE(TestExecutorsStable, StandardExecutors, ExecutorTypeNames);
 
@@ -213,6 +220,68 @@ TYPED_TEST(TestExecutors, spinWithTimer)
   executor.remove_node(this->node, true);
 }
 
+// Check that warming up collects the entities without executing them, and spins afterwards
+TYPED_TEST(TestExecutors, warmUp)
+{
+  using ExecutorType = TypeParam;
+  ExecutorType executor;
+
+  std::atomic_bool timer_completed{false};
+  auto timer = this->node->create_wall_timer(1ms, [&]() {timer_completed = true;});
+  executor.add_node(this->node);
+
+  rclcpp::WarmUpOptions options;
+#ifdef __linux__
+  options.stack_prefault_size = 64 * 1024;
+#endif
+  std::this_thread::sleep_for(2ms);
+  executor.warm_up(options);
+  EXPECT_FALSE(timer_completed);
+
+  std::thread spinner([&]() {executor.spin();});
+
+  auto start = std::chrono::steady_clock::now();
+  while (!timer_completed && (std::chrono::steady_clock::now() - start) < 10s) {
+    std::this_thread::sleep_for(1ms);
+  }
+
+  EXPECT_TRUE(timer_completed);
+  EXPECT_THROW(executor.warm_up(), std::runtime_error);
+  executor.cancel();
+  spinner.join();
+  executor.remove_node(this->node, true);
+}
+
+// Check that the entities of a disabled callback group are not executed until it's enabled
+TYPED_TEST(TestExecutors, spinWithDisabledCallbackGroup)
+{
+  using ExecutorType = TypeParam;
+  ExecutorType executor;
+
+  auto group = this->node->create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive);
+  group->set_enabled(false);
+  EXPECT_FALSE(group->is_enabled());
+  std::atomic_int timer_count{0};
+  auto timer = this->node->create_wall_timer(1ms, [&]() {timer_count++;}, group);
+  executor.add_node(this->node);
+
+  std::thread spinner([&]() {executor.spin();});
+
+  std::this_thread::sleep_for(50ms);
+  EXPECT_EQ(0, timer_count.load());
+
+  group->set_enabled(true);
+  auto start = std::chrono::steady_clock::now();
+  while (timer_count.load() == 0 && (std::chrono::steady_clock::now() - start) < 10s) {
+    std::this_thread::sleep_for(1ms);
+  }
+  EXPECT_GT(timer_count.load(), 0);
+
+  executor.cancel();
+  spinner.join();
+  executor.remove_node(this->node, true);
+}
+
 TYPED_TEST(TestExecutors, spinWhileAlreadySpinning)
 {
   using ExecutorType = TypeParam;
@@ -286,6 +355,31 @@ TYPED_TEST(TestExecutors, testSpinUntilSharedFutureComplete)
   EXPECT_EQ(rclcpp::FutureReturnCode::SUCCESS, ret);
 }
 
+// The future is completed by another thread while nothing else wakes up the executor.
+TYPED_TEST(TestExecutors, testSpinUntilFutureCompleteFromOtherThread)
+{
+  using ExecutorType = TypeParam;
+  ExecutorType executor;
+  executor.add_node(this->node);
+
+  std::promise<bool> promise;
+  std::future<bool> future = promise.get_future();
+  std::thread completer([&promise]() {
+      std::this_thread::sleep_for(50ms);
+      promise.set_value(true);
+      rclcpp::notify_future_completion();
+    });
+
+  auto start = std::chrono::steady_clock::now();
+  auto ret = executor.spin_until_future_complete(future, 10s);
+  completer.join();
+  executor.remove_node(this->node, true);
+
+  // Check it returned on completion rather than on timeout
+  EXPECT_GT(5s, (std::chrono::steady_clock::now() - start));
+  EXPECT_EQ(rclcpp::FutureReturnCode::SUCCESS, ret);
+}
+
 // For a longer running future that should require several iterations of spin_once
 TYPED_TEST(TestExecutors, testSpinUntilFutureCompleteNoTimeout)
 {
@@ -718,6 +812,153 @@ TEST(TestExecutors, testSpinUntilFutureCompleteNodePtr)
   rclcpp::shutdown();
 }
 
+// Check that priority scheduling executes the ready work of the highest priority group first
+TEST(TestExecutors, testPriorityScheduling)
+{
+  rclcpp::init(0, nullptr);
+
+  {
+    auto node = std::make_shared<rclcpp::Node>("node");
+    auto low_priority_group =
+      node->create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive);
+    auto high_priority_group =
+      node->create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive);
+    high_priority_group->set_priority(10);
+    EXPECT_EQ(0, low_priority_group->get_priority());
+    EXPECT_EQ(10, high_priority_group->get_priority());
+
+    std::vector<std::string> executed;
+    rclcpp::TimerBase::SharedPtr low_priority_timer;
+    rclcpp::TimerBase::SharedPtr high_priority_timer;
+    low_priority_timer = node->create_wall_timer(
+      1ms, [&]() {
+        executed.push_back("low");
+        low_priority_timer->cancel();
+      }, low_priority_group);
+    high_priority_timer = node->create_wall_timer(
+      1ms, [&]() {
+        executed.push_back("high");
+        high_priority_timer->cancel();
+      }, high_priority_group);
+
+    rclcpp::ExecutorOptions options;
+    options.priority_scheduling = true;
+    rclcpp::executors::SingleThreadedExecutor executor(options);
+    executor.add_node(node);
+
+    // Make sure both timers are ready when the executor looks for work
+    std::this_thread::sleep_for(10ms);
+    auto start = std::chrono::steady_clock::now();
+    while (executed.size() < 2u && std::chrono::steady_clock::now() - start < 5s) {
+      executor.spin_some();
+    }
+
+    EXPECT_EQ((std::vector<std::string>{"high", "low"}), executed);
+  }
+
+  rclcpp::shutdown();
+}
+
+TEST(TestExecutors, testFairScheduling)
+{
+  rclcpp::init(0, nullptr);
+
+  {
+    auto node = std::make_shared<rclcpp::Node>("node");
+    std::vector<std::string> executed;
+    // Both timers are ready at every wait, the slow one uses more than its quantum
+    auto slow_timer = node->create_wall_timer(
+      1ms, [&]() {
+        executed.push_back("slow");
+        std::this_thread::sleep_for(5ms);
+      });
+    auto fast_timer = node->create_wall_timer(
+      1ms, [&]() {
+        executed.push_back("fast");
+      });
+
+    rclcpp::ExecutorOptions options;
+    options.fair_scheduling = true;
+    options.fair_scheduling_quantum = 1ms;
+    rclcpp::executors::SingleThreadedExecutor executor(options);
+    executor.add_node(node);
+
+    std::this_thread::sleep_for(10ms);
+    auto start = std::chrono::steady_clock::now();
+    while (executed.size() < 6u && std::chrono::steady_clock::now() - start < 5s) {
+      executor.spin_some();
+    }
+    ASSERT_GE(executed.size(), 6u);
+
+    // Once the slow timer is in debt, the fast one goes first at every wait
+    for (size_t i = 2; i + 1 < 6u; i += 2) {
+      EXPECT_EQ("fast", executed[i]) << "at " << i;
+      EXPECT_EQ("slow", executed[i + 1]) << "at " << i;
+    }
+  }
+
+  rclcpp::shutdown();
+}
+
+TEST(TestExecutors, testFairSchedulingInvalidQuantum)
+{
+  rclcpp::init(0, nullptr);
+
+  rclcpp::ExecutorOptions options;
+  options.fair_scheduling = true;
+  options.fair_scheduling_quantum = 0ms;
+  EXPECT_THROW(
+    rclcpp::executors::SingleThreadedExecutor executor(options), std::invalid_argument);
+
+  rclcpp::shutdown();
+}
+
+TEST(TestExecutors, testBusyWait)
+{
+  rclcpp::init(0, nullptr);
+
+  {
+    auto node = std::make_shared<rclcpp::Node>("node");
+    std::atomic<int> timer_count{0};
+    auto timer = node->create_wall_timer(20ms, [&timer_count]() {timer_count++;});
+
+    rclcpp::ExecutorOptions options;
+    options.busy_wait_duration = 10ms;
+    // The timer expires once polling stopped, the wait then blocks until it's ready
+    rclcpp::executors::SingleThreadedExecutor executor(options);
+    executor.add_node(node);
+    executor.spin_once(1s);
+    EXPECT_EQ(1, timer_count);
+    executor.remove_node(node);
+
+    // The timer expires while polling
+    options.busy_wait_duration = 1s;
+    rclcpp::experimental::executors::EventsExecutor events_executor(
+      std::make_unique<rclcpp::experimental::executors::SimpleEventsQueue>(), false, options);
+    events_executor.add_node(node);
+    auto start = std::chrono::steady_clock::now();
+    while (timer_count < 2 && std::chrono::steady_clock::now() - start < 5s) {
+      events_executor.spin_once(1s);
+    }
+    EXPECT_EQ(2, timer_count);
+    events_executor.remove_node(node);
+  }
+
+  rclcpp::shutdown();
+}
+
+TEST(TestExecutors, testBusyWaitInvalidDuration)
+{
+  rclcpp::init(0, nullptr);
+
+  rclcpp::ExecutorOptions options;
+  options.busy_wait_duration = -1ms;
+  EXPECT_THROW(
+    rclcpp::executors::SingleThreadedExecutor executor(options), std::invalid_argument);
+
+  rclcpp::shutdown();
+}
+
 template<typename T>
 class TestIntraprocessExecutors : public ::testing::Test
 {
@@ -818,3 +1059,39 @@ TYPED_TEST(TestIntraprocessExecutors, testIntraprocessRetrigger) {
   executor.spin();
   EXPECT_EQ(kNumMessages, this->callback_count.load());
 }
+
+TYPED_TEST(TestIntraprocessExecutors, getBacklog) {
+  using ExecutorType = TypeParam;
+  ExecutorType executor;
+  executor.add_node(this->node);
+
+  auto find_backlog = [this](const rclcpp::ExecutorBacklog & backlog) {
+      for (const auto & subscription : backlog.subscriptions) {
+        if (subscription.topic_name == this->subscription->get_topic_name()) {
+          return subscription;
+        }
+      }
+      ADD_FAILURE() << "subscription not found in the backlog";
+      return rclcpp::SubscriptionBacklog();
+    };
+
+  auto backlog = find_backlog(executor.get_backlog());
+  EXPECT_TRUE(backlog.uses_intra_process);
+  EXPECT_EQ(this->kNumMessages, backlog.intra_process_capacity);
+  EXPECT_EQ(0u, backlog.intra_process_queued);
+  EXPECT_EQ(0u, backlog.intra_process_dropped);
+
+  // Overflow the buffer of the subscription without executing it
+  for (size_t ii = 0; ii < this->kNumMessages + 2; ++ii) {
+    this->publisher->publish(test_msgs::msg::Empty());
+  }
+  const auto executor_backlog = executor.get_backlog();
+  backlog = find_backlog(executor_backlog);
+  EXPECT_EQ(this->kNumMessages, backlog.intra_process_queued);
+  EXPECT_EQ(2u, backlog.intra_process_dropped);
+  if (std::is_same<ExecutorType, rclcpp::experimental::executors::EventsExecutor>()) {
+    EXPECT_GT(executor_backlog.events_queue_size, 0u);
+  } else {
+    EXPECT_EQ(0u, executor_backlog.events_queue_size);
+  }
+}
@@ -14,9 +14,14 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
 #include <chrono>
+#include <cstdint>
 #include <string>
 #include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
 
 #include "rclcpp/exceptions.hpp"
 #include "rclcpp/node.hpp"
@@ -97,3 +102,159 @@ TEST_F(TestMultiThreadedExecutor, timer_over_take) {
   executor.add_node(node);
   executor.spin();
 }
+
+#ifdef __linux__
+/*
+   Test that the threads executing work are created with the attributes from the options.
+ */
+TEST_F(TestMultiThreadedExecutor, thread_attributes) {
+  rclcpp::ExecutorOptions options;
+  rclcpp::ThreadAttributes attributes;
+  attributes.name = "mte_worker";
+  options.thread_attributes.push_back(attributes);
+
+  rclcpp::executors::MultiThreadedExecutor executor(options, 2u);
+
+  std::shared_ptr<rclcpp::Node> node =
+    std::make_shared<rclcpp::Node>("test_multi_threaded_executor_thread_attributes");
+
+  std::mutex name_mutex;
+  std::string thread_name;
+  auto timer_callback = [&]() {
+      char buffer[16] = {};
+      pthread_getname_np(pthread_self(), buffer, sizeof(buffer));
+      {
+        std::lock_guard<std::mutex> lock(name_mutex);
+        thread_name = buffer;
+      }
+      executor.cancel();
+    };
+  auto timer = node->create_wall_timer(1ms, timer_callback);
+
+  executor.add_node(node);
+  executor.spin();
+
+  std::lock_guard<std::mutex> lock(name_mutex);
+  EXPECT_EQ("mte_worker", thread_name);
+}
+#endif
+
+/*
+   Test that the shared callbacks of a reader writer callback group run at the same time,
+   but never at the same time as the exclusive ones.
+ */
+TEST_F(TestMultiThreadedExecutor, reader_writer_callback_group) {
+  rclcpp::executors::MultiThreadedExecutor executor(rclcpp::ExecutorOptions(), 4u);
+
+  std::shared_ptr<rclcpp::Node> node =
+    std::make_shared<rclcpp::Node>("test_multi_threaded_executor_reader_writer");
+  auto cbg = node->create_callback_group(rclcpp::CallbackGroupType::ReaderWriter);
+
+  std::atomic_int running_readers {0};
+  std::atomic_int running_writers {0};
+  std::atomic_int max_running_readers {0};
+  std::atomic_int writer_count {0};
+  std::atomic_bool overlapped {false};
+
+  auto reader_callback = [&]() {
+      const int readers = ++running_readers;
+      if (running_writers.load() != 0) {
+        overlapped = true;
+      }
+      int max_readers = max_running_readers.load();
+      while (readers > max_readers &&
+        !max_running_readers.compare_exchange_weak(max_readers, readers))
+      {
+      }
+      std::this_thread::sleep_for(20ms);
+      --running_readers;
+    };
+  auto writer_callback = [&]() {
+      if (++running_writers != 1 || running_readers.load() != 0) {
+        overlapped = true;
+      }
+      std::this_thread::sleep_for(5ms);
+      --running_writers;
+      writer_count++;
+    };
+
+  auto reader_timer_1 = node->create_wall_timer(5ms, reader_callback, cbg);
+  auto reader_timer_2 = node->create_wall_timer(5ms, reader_callback, cbg);
+  auto writer_timer = node->create_wall_timer(5ms, writer_callback, cbg);
+  cbg->set_shared_access(reader_timer_1);
+  cbg->set_shared_access(reader_timer_2);
+
+  auto other_node = std::make_shared<rclcpp::Node>("test_multi_threaded_executor_other");
+  auto other_group = other_node->create_callback_group(
+    rclcpp::CallbackGroupType::MutuallyExclusive);
+  EXPECT_THROW(other_group->set_shared_access(writer_timer), std::invalid_argument);
+
+  executor.add_node(node);
+  std::thread spinner([&executor]() {executor.spin();});
+  const auto deadline = std::chrono::steady_clock::now() + 5s;
+  while ((writer_count.load() < 5 || max_running_readers.load() < 2) &&
+    std::chrono::steady_clock::now() < deadline)
+  {
+    std::this_thread::sleep_for(10ms);
+  }
+  executor.cancel();
+  spinner.join();
+
+  EXPECT_FALSE(overlapped.load());
+  EXPECT_EQ(2, max_running_readers.load());
+  EXPECT_GE(writer_count.load(), 5);
+}
+
+/*
+   Test that a writer held back by the readers of a ReaderWriter group doesn't keep ending
+   the waits, and that the last reader wakes the wait for it.
+ */
+TEST_F(TestMultiThreadedExecutor, reader_writer_callback_group_wakes_writer) {
+  std::shared_ptr<rclcpp::Node> node =
+    std::make_shared<rclcpp::Node>("test_multi_threaded_executor_reader_writer_wake");
+  auto cbg = node->create_callback_group(rclcpp::CallbackGroupType::ReaderWriter);
+  rclcpp::TimerBase::SharedPtr reader_timer = node->create_wall_timer(1s, []() {}, cbg);
+  rclcpp::TimerBase::SharedPtr writer_timer = node->create_wall_timer(1s, []() {}, cbg);
+  cbg->set_shared_access(reader_timer);
+  const void * reader = reader_timer.get();
+  const void * writer = writer_timer.get();
+
+  // Readers don't wake the wait when no writer is waiting
+  ASSERT_TRUE(cbg->can_start_callback(reader));
+  cbg->start_callback(reader);
+  EXPECT_FALSE(cbg->finish_callback(reader));
+
+  ASSERT_TRUE(cbg->can_start_callback(reader));
+  cbg->start_callback(reader);
+  EXPECT_FALSE(cbg->can_start_callback(writer));
+  // The entities of the group are left out of the waits while the writer is held back
+  EXPECT_FALSE(cbg->can_be_taken_from().load());
+  EXPECT_FALSE(cbg->can_start_callback(reader));
+  EXPECT_TRUE(cbg->finish_callback(reader));
+  EXPECT_TRUE(cbg->can_be_taken_from().load());
+  EXPECT_TRUE(cbg->can_start_callback(writer));
+}
+
+/*
+   Test that callbacks of reentrant groups don't wake the thread waiting for work.
+ */
+TEST_F(TestMultiThreadedExecutor, reentrant_callbacks_dont_wake_wait) {
+  rclcpp::executors::MultiThreadedExecutor executor(rclcpp::ExecutorOptions(), 2u);
+  EXPECT_EQ(0u, executor.get_wait_count());
+
+  std::shared_ptr<rclcpp::Node> node =
+    std::make_shared<rclcpp::Node>("test_multi_threaded_executor_reentrant_wait");
+  auto cbg = node->create_callback_group(rclcpp::CallbackGroupType::Reentrant);
+  std::atomic_int timer_count {0};
+  auto timer = node->create_wall_timer(10ms, [&timer_count]() {timer_count++;}, cbg);
+
+  executor.add_node(node);
+  std::thread spinner([&executor]() {executor.spin();});
+  std::this_thread::sleep_for(500ms);
+  executor.cancel();
+  spinner.join();
+
+  // One wait per timer call, which would be two if finishing each call woke the other thread
+  ASSERT_GT(timer_count.load(), 10);
+  EXPECT_LT(executor.get_wait_count(), 2u * static_cast<uint64_t>(timer_count.load()));
+}
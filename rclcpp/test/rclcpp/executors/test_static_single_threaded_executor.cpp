@@ -14,10 +14,12 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
 #include <chrono>
 #include <future>
 #include <memory>
 #include <stdexcept>
+#include <thread>
 
 #include "rclcpp/exceptions.hpp"
 #include "rclcpp/node.hpp"
@@ -140,3 +142,45 @@ TEST_F(TestStaticSingleThreadedExecutor, execute_service) {
   executor.remove_node(node);
   executor.spin_until_future_complete(future, std::chrono::milliseconds(1));
 }
+
+TEST_F(TestStaticSingleThreadedExecutor, freeze_entities) {
+  rclcpp::executors::StaticSingleThreadedExecutor executor;
+  EXPECT_FALSE(executor.get_freeze_entities());
+  executor.set_freeze_entities(true);
+  EXPECT_TRUE(executor.get_freeze_entities());
+
+  auto node = std::make_shared<rclcpp::Node>("node", "ns");
+  executor.add_node(node);
+  std::atomic<int> first_timer_calls{0};
+  auto first_timer = node->create_wall_timer(1ms, [&first_timer_calls]() {first_timer_calls++;});
+
+  std::thread spinner([&executor]() {executor.spin();});
+  auto start = std::chrono::steady_clock::now();
+  while (first_timer_calls == 0 && std::chrono::steady_clock::now() - start < 5s) {
+    std::this_thread::sleep_for(1ms);
+  }
+  ASSERT_LT(0, first_timer_calls);
+  EXPECT_THROW(executor.set_freeze_entities(false), std::runtime_error);
+
+  // The timer added while spinning isn't executed until the executor spins again
+  std::atomic<int> second_timer_calls{0};
+  auto second_timer = node->create_wall_timer(
+    1ms, [&second_timer_calls]() {second_timer_calls++;});
+  const int calls_before_wait = first_timer_calls;
+  start = std::chrono::steady_clock::now();
+  while (first_timer_calls < calls_before_wait + 10 &&
+    std::chrono::steady_clock::now() - start < 5s)
+  {
+    std::this_thread::sleep_for(1ms);
+  }
+  executor.cancel();
+  spinner.join();
+  EXPECT_LE(calls_before_wait + 10, first_timer_calls);
+  EXPECT_EQ(0, second_timer_calls);
+
+  start = std::chrono::steady_clock::now();
+  while (second_timer_calls == 0 && std::chrono::steady_clock::now() - start < 5s) {
+    executor.spin_some();
+  }
+  EXPECT_LT(0, second_timer_calls);
+}
@@ -0,0 +1,123 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "rclcpp/executors/typed_static_executor.hpp"
+#include "rclcpp/rclcpp.hpp"
+
+#include "test_msgs/msg/basic_types.hpp"
+#include "test_msgs/srv/empty.hpp"
+
+using namespace std::chrono_literals;
+
+class TestTypedStaticExecutor : public ::testing::Test
+{
+public:
+  void SetUp()
+  {
+    rclcpp::init(0, nullptr);
+    node = std::make_shared<rclcpp::Node>("typed_static_executor_node", "ns");
+  }
+
+  void TearDown()
+  {
+    node.reset();
+    rclcpp::shutdown();
+  }
+
+  rclcpp::Node::SharedPtr node;
+};
+
+TEST_F(TestTypedStaticExecutor, executes_entities) {
+  // Only read by the test once the executor stopped spinning
+  std::vector<test_msgs::msg::BasicTypes::ConstSharedPtr> messages;
+  std::atomic<size_t> message_count{0};
+  auto subscription = node->create_subscription<test_msgs::msg::BasicTypes>(
+    "topic", 10,
+    [&messages, &message_count](test_msgs::msg::BasicTypes::ConstSharedPtr message) {
+      messages.push_back(message);
+      message_count++;
+    });
+  std::atomic<size_t> timer_calls{0};
+  auto timer = node->create_wall_timer(1ms, [&timer_calls]() {timer_calls++;});
+  std::atomic<size_t> requests{0};
+  auto service = node->create_service<test_msgs::srv::Empty>(
+    "service",
+    [&requests](
+      const test_msgs::srv::Empty::Request::SharedPtr,
+      test_msgs::srv::Empty::Response::SharedPtr) {requests++;});
+
+  rclcpp::executors::TypedStaticExecutor executor(subscription, timer, service);
+  static_assert(decltype(executor)::number_of_subscriptions == 1, "one subscription");
+  static_assert(decltype(executor)::number_of_timers == 1, "one timer");
+  static_assert(decltype(executor)::number_of_services == 1, "one service");
+  std::thread spinner([&executor]() {executor.spin();});
+
+  // The client and the publisher are executed by another executor, on another node
+  auto client_node = std::make_shared<rclcpp::Node>("typed_static_executor_client", "ns");
+  auto publisher = client_node->create_publisher<test_msgs::msg::BasicTypes>("topic", 10);
+  auto client = client_node->create_client<test_msgs::srv::Empty>("service");
+  ASSERT_TRUE(client->wait_for_service(5s));
+  auto future = client->async_send_request(std::make_shared<test_msgs::srv::Empty::Request>());
+  rclcpp::executors::SingleThreadedExecutor client_executor;
+  client_executor.add_node(client_node);
+  EXPECT_EQ(
+    rclcpp::FutureReturnCode::SUCCESS, client_executor.spin_until_future_complete(future, 5s));
+
+  const auto deadline = std::chrono::steady_clock::now() + 5s;
+  while (publisher->get_subscription_count() == 0 &&
+    std::chrono::steady_clock::now() < deadline)
+  {
+    std::this_thread::sleep_for(1ms);
+  }
+  for (int32_t i = 1; i <= 3; ++i) {
+    test_msgs::msg::BasicTypes message;
+    message.int32_value = i;
+    publisher->publish(message);
+  }
+  while (message_count < 3 && std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::sleep_for(1ms);
+  }
+  executor.cancel();
+  spinner.join();
+
+  EXPECT_EQ(1u, requests.load());
+  EXPECT_GT(timer_calls.load(), 0u);
+  // The messages kept by the callback aren't reused for the following ones
+  ASSERT_EQ(3u, messages.size());
+  for (int32_t i = 0; i < 3; ++i) {
+    EXPECT_EQ(i + 1, messages[i]->int32_value);
+  }
+}
+
+TEST_F(TestTypedStaticExecutor, spin_once) {
+  auto timer = node->create_wall_timer(1ms, []() {});
+  EXPECT_THROW(
+    rclcpp::executors::TypedStaticExecutor<decltype(timer)::element_type>(nullptr),
+    std::invalid_argument);
+
+  rclcpp::executors::TypedStaticExecutor executor(timer);
+  std::this_thread::sleep_for(2ms);
+  EXPECT_EQ(1u, executor.spin_once(100ms));
+  timer->cancel();
+  EXPECT_EQ(0u, executor.spin_once(10ms));
+}
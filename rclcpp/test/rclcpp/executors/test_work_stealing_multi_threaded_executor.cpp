@@ -0,0 +1,120 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "rclcpp/executors/work_stealing_multi_threaded_executor.hpp"
+#include "rclcpp/node.hpp"
+#include "rclcpp/rclcpp.hpp"
+
+using namespace std::chrono_literals;
+
+class TestWorkStealingMultiThreadedExecutor : public ::testing::Test
+{
+protected:
+  static void SetUpTestCase()
+  {
+    rclcpp::init(0, nullptr);
+  }
+
+  static void TearDownTestCase()
+  {
+    rclcpp::shutdown();
+  }
+};
+
+TEST_F(TestWorkStealingMultiThreadedExecutor, number_of_threads) {
+  rclcpp::executors::WorkStealingMultiThreadedExecutor executor(rclcpp::ExecutorOptions(), 3u);
+  EXPECT_EQ(3u, executor.get_number_of_threads());
+
+  rclcpp::executors::WorkStealingMultiThreadedExecutor default_executor;
+  EXPECT_GE(default_executor.get_number_of_threads(), 2u);
+}
+
+/*
+   Test that the timers of a mutually exclusive callback group never run concurrently.
+ */
+TEST_F(TestWorkStealingMultiThreadedExecutor, mutually_exclusive_group) {
+  rclcpp::executors::WorkStealingMultiThreadedExecutor executor(rclcpp::ExecutorOptions(), 4u);
+
+  auto node = std::make_shared<rclcpp::Node>("test_work_stealing_mutually_exclusive");
+  auto cbg = node->create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive);
+
+  std::atomic_int running{0};
+  std::atomic_int max_running{0};
+  std::atomic_int executions{0};
+  auto callback = [&]() {
+      const int now_running = ++running;
+      int expected = max_running.load();
+      while (now_running > expected && !max_running.compare_exchange_weak(expected, now_running)) {
+      }
+      std::this_thread::sleep_for(2ms);
+      --running;
+      if (++executions >= 40) {
+        executor.cancel();
+      }
+    };
+
+  std::vector<rclcpp::TimerBase::SharedPtr> timers;
+  for (size_t i = 0; i < 4; ++i) {
+    timers.push_back(node->create_wall_timer(1ms, callback, cbg));
+  }
+
+  executor.add_node(node);
+  executor.spin();
+
+  EXPECT_GE(executions.load(), 40);
+  EXPECT_EQ(1, max_running.load());
+}
+
+/*
+   Test that the timers of a reentrant callback group run in parallel on the workers.
+ */
+TEST_F(TestWorkStealingMultiThreadedExecutor, reentrant_group) {
+  rclcpp::executors::WorkStealingMultiThreadedExecutor executor(rclcpp::ExecutorOptions(), 4u);
+
+  auto node = std::make_shared<rclcpp::Node>("test_work_stealing_reentrant");
+  auto cbg = node->create_callback_group(rclcpp::CallbackGroupType::Reentrant);
+
+  std::atomic_int running{0};
+  std::atomic_int max_running{0};
+  auto callback = [&]() {
+      const int now_running = ++running;
+      int expected = max_running.load();
+      while (now_running > expected && !max_running.compare_exchange_weak(expected, now_running)) {
+      }
+      std::this_thread::sleep_for(50ms);
+      --running;
+    };
+
+  std::vector<rclcpp::TimerBase::SharedPtr> timers;
+  for (size_t i = 0; i < 4; ++i) {
+    timers.push_back(node->create_wall_timer(10ms, callback, cbg));
+  }
+
+  executor.add_node(node);
+  std::thread spinner([&]() {executor.spin();});
+  std::this_thread::sleep_for(300ms);
+  executor.cancel();
+  spinner.join();
+
+  EXPECT_GT(max_running.load(), 1);
+}
@@ -14,6 +14,7 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
 #include <memory>
 #include <string>
 
@@ -191,3 +192,53 @@ TEST_F(TestNodeBase, construct_destruct_rcl_guard_condition_fini_error) {
 
   EXPECT_NO_THROW(std::make_shared<rclcpp::Node>("node", "ns").reset());
 }
+
+TEST_F(TestNodeBase, resolve_topic_or_service_name_cached) {
+  auto node = std::make_shared<rclcpp::Node>("node", "ns");
+  auto node_base = std::dynamic_pointer_cast<rclcpp::node_interfaces::NodeBase>(
+    node->get_node_base_interface());
+  ASSERT_NE(nullptr, node_base);
+  EXPECT_EQ("/ns/foo", node_base->resolve_topic_or_service_name("foo", false));
+  EXPECT_EQ("/ns/foo", node_base->resolve_topic_or_service_name("foo", true, true));
+
+  {
+    auto mock = mocking_utils::patch_and_return(
+      "lib:rclcpp", rcl_node_resolve_name, RCL_RET_ERROR);
+    // Cached names aren't resolved again
+    EXPECT_EQ("/ns/foo", node_base->resolve_topic_or_service_name("foo", false));
+    EXPECT_EQ("/ns/foo", node_base->resolve_topic_or_service_name("foo", true, true));
+    EXPECT_THROW(
+      node_base->resolve_topic_or_service_name("foo", true), rclcpp::exceptions::RCLError);
+    EXPECT_THROW(
+      node_base->resolve_topic_or_service_name("bar", false), rclcpp::exceptions::RCLError);
+
+    node_base->clear_resolved_names();
+    EXPECT_THROW(
+      node_base->resolve_topic_or_service_name("foo", false), rclcpp::exceptions::RCLError);
+  }
+  EXPECT_EQ("/ns/bar", node_base->resolve_topic_or_service_name("bar", false));
+}
+
+TEST_F(TestNodeBase, spin_executor_reused) {
+  auto node = std::make_shared<rclcpp::Node>("node", "ns");
+  auto node_base = std::dynamic_pointer_cast<rclcpp::node_interfaces::NodeBase>(
+    node->get_node_base_interface());
+  ASSERT_NE(nullptr, node_base);
+  auto spin_executor = node_base->get_spin_executor();
+  ASSERT_NE(nullptr, spin_executor);
+  EXPECT_EQ(spin_executor, node_base->get_spin_executor());
+
+  int count = 0;
+  auto timer = node->create_wall_timer(std::chrono::milliseconds(0), [&count]() {count++;});
+  rclcpp::spin_some(node);
+  rclcpp::spin_all(node, std::chrono::milliseconds(10));
+  EXPECT_LT(0, count);
+  EXPECT_EQ(spin_executor, node_base->get_spin_executor());
+
+  // The node isn't kept in the executor between the calls
+  rclcpp::executors::SingleThreadedExecutor executor;
+  EXPECT_NO_THROW(executor.add_node(node));
+  EXPECT_THROW(rclcpp::spin_some(node), std::runtime_error);
+  executor.remove_node(node);
+  EXPECT_NO_THROW(rclcpp::spin_some(node));
+}
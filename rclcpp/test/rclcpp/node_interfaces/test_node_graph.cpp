@@ -14,8 +14,10 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -727,3 +729,92 @@ TEST_F(TestNodeGraph, get_info_by_topic_endpoint_info_array_fini_error)
     node_graph()->get_publishers_info_by_topic("topic", false),
     rclcpp::exceptions::RCLError);
 }
+
+TEST_F(TestNodeGraph, graph_cache)
+{
+  auto node_graph_interface = node()->get_node_graph_interface();
+  EXPECT_FALSE(node_graph_interface->is_graph_cache_enabled());
+  node_graph_interface->set_graph_cache_enabled(true);
+  EXPECT_TRUE(node_graph_interface->is_graph_cache_enabled());
+  // The cache keeps the node monitored by the graph listener
+  EXPECT_LE(1u, node_graph()->count_graph_users());
+
+  const std::string topic_name = std::string(absolute_namespace) + "/cached_topic";
+  EXPECT_EQ(0u, node_graph()->count_publishers(topic_name));
+
+  // Creating a publisher changes the graph, which eventually invalidates the cache
+  uint64_t generation = node_graph()->get_graph_generation();
+  auto publisher = node()->create_publisher<test_msgs::msg::Empty>("cached_topic", 10);
+  size_t count = 0u;
+  for (size_t tries = 0; tries < 10 && count == 0u; ++tries) {
+    auto event = node()->get_graph_event();
+    node()->wait_for_graph_change(event, std::chrono::milliseconds(100));
+    count = node_graph()->count_publishers(topic_name);
+  }
+  EXPECT_EQ(1u, count);
+  EXPECT_LT(generation, node_graph()->get_graph_generation());
+
+  auto topic_names_and_types = node_graph()->get_topic_names_and_types();
+  EXPECT_NE(topic_names_and_types.end(), topic_names_and_types.find(topic_name));
+  EXPECT_EQ(1u, node_graph()->get_node_names().size());
+
+  node_graph_interface->set_graph_cache_enabled(false);
+  EXPECT_FALSE(node_graph_interface->is_graph_cache_enabled());
+  publisher.reset();
+  count = 1u;
+  for (size_t tries = 0; tries < 10 && count != 0u; ++tries) {
+    auto event = node()->get_graph_event();
+    node()->wait_for_graph_change(event, std::chrono::milliseconds(100));
+    count = node_graph()->count_publishers(topic_name);
+  }
+  EXPECT_EQ(0u, count);
+}
+
+TEST_F(TestNodeGraph, graph_change_callback)
+{
+  auto node_graph_interface = node()->get_node_graph_interface();
+  const std::string topic_name = std::string(absolute_namespace) + "/changed_topic";
+  std::mutex changes_mutex;
+  std::vector<rclcpp::GraphChange> changes;
+  auto handle = node_graph_interface->add_graph_change_callback(
+    [&changes_mutex, &changes](const std::vector<rclcpp::GraphChange> & new_changes) {
+      std::lock_guard<std::mutex> lock(changes_mutex);
+      changes.insert(changes.end(), new_changes.begin(), new_changes.end());
+    });
+  // The callback keeps the node monitored by the graph listener
+  EXPECT_LE(1u, node_graph()->count_graph_users());
+
+  auto find_change = [&](rclcpp::GraphChange::Kind kind) {
+      std::lock_guard<std::mutex> lock(changes_mutex);
+      return std::find_if(
+        changes.begin(), changes.end(),
+        [&](const rclcpp::GraphChange & change) {
+          return kind == change.kind && topic_name == change.name;
+        }) != changes.end();
+    };
+  auto wait_for_change = [&](rclcpp::GraphChange::Kind kind) {
+      for (size_t tries = 0; tries < 10 && !find_change(kind); ++tries) {
+        auto event = node()->get_graph_event();
+        node()->wait_for_graph_change(event, std::chrono::milliseconds(100));
+      }
+      return find_change(kind);
+    };
+
+  auto publisher = node()->create_publisher<test_msgs::msg::Empty>("changed_topic", 10);
+  ASSERT_TRUE(wait_for_change(rclcpp::GraphChange::Kind::TopicAdded));
+  {
+    std::lock_guard<std::mutex> lock(changes_mutex);
+    auto it = std::find_if(
+      changes.begin(), changes.end(),
+      [&](const rclcpp::GraphChange & change) {return topic_name == change.name;});
+    ASSERT_NE(changes.end(), it);
+    ASSERT_EQ(1u, it->types.size());
+    EXPECT_EQ("test_msgs/msg/Empty", it->types[0]);
+  }
+  publisher.reset();
+  EXPECT_TRUE(wait_for_change(rclcpp::GraphChange::Kind::TopicRemoved));
+
+  node_graph_interface->remove_graph_change_callback(handle.get());
+  EXPECT_THROW(
+    node_graph_interface->remove_graph_change_callback(handle.get()), std::runtime_error);
+}
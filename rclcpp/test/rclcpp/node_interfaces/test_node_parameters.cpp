@@ -21,10 +21,13 @@
 #include <gtest/gtest.h>
 
 #include <algorithm>
+#include <chrono>
 #include <memory>
 #include <string>
+#include <thread>
 #include <vector>
 
+#include "rclcpp/executors.hpp"
 #include "rclcpp/node.hpp"
 #include "rclcpp/node_interfaces/node_parameters.hpp"
 
@@ -182,6 +185,207 @@ TEST_F(TestNodeParameters, set_parameters) {
   EXPECT_TRUE(result[0].successful);
 }
 
+TEST_F(TestNodeParameters, set_parameters_without_parameter_events) {
+  rclcpp::NodeOptions options;
+  options.allow_undeclared_parameters(true);
+  options.start_parameter_event_publisher(false);
+  auto quiet_node = std::make_shared<rclcpp::Node>("quiet_node", "ns", options);
+
+  // Array values as large as calibration tables, declared implicitly, changed and undeclared
+  const std::vector<double> table(10000, 0.5);
+  auto result = quiet_node->set_parameter(rclcpp::Parameter("table", table));
+  EXPECT_TRUE(result.successful);
+  EXPECT_EQ(table, quiet_node->get_parameter("table").as_double_array());
+  const std::vector<double> other_table(10000, 1.5);
+  result = quiet_node->set_parameter(rclcpp::Parameter("table", other_table));
+  EXPECT_TRUE(result.successful);
+  EXPECT_EQ(other_table, quiet_node->get_parameter("table").as_double_array());
+  result = quiet_node->set_parameter(rclcpp::Parameter("table"));
+  EXPECT_TRUE(result.successful);
+  EXPECT_FALSE(quiet_node->has_parameter("table"));
+}
+
+TEST_F(TestNodeParameters, declare_parameters) {
+  rcl_interfaces::msg::ParameterDescriptor dynamic_descriptor;
+  dynamic_descriptor.dynamic_typing = true;
+  rcl_interfaces::msg::ParameterDescriptor int_descriptor;
+  int_descriptor.integer_range.resize(1);
+  int_descriptor.integer_range[0].from_value = 0;
+  int_descriptor.integer_range[0].to_value = 10;
+
+  size_t on_set_calls = 0;
+  size_t post_set_calls = 0;
+  std::vector<rclcpp::Parameter> set_parameters;
+  auto on_set_handle = node_parameters->add_on_set_parameters_callback(
+    [&on_set_calls](const std::vector<rclcpp::Parameter> &) {
+      ++on_set_calls;
+      rcl_interfaces::msg::SetParametersResult result;
+      result.successful = true;
+      return result;
+    });
+  auto post_set_handle = node_parameters->add_post_set_parameters_callback(
+    [&post_set_calls, &set_parameters](const std::vector<rclcpp::Parameter> & parameters) {
+      ++post_set_calls;
+      set_parameters = parameters;
+    });
+
+  auto values = node_parameters->declare_parameters(
+  {
+    {rclcpp::Parameter("batch.int", 5), int_descriptor},
+    {rclcpp::Parameter("batch.string", "value"), dynamic_descriptor},
+    {rclcpp::Parameter("batch.unset"), dynamic_descriptor},
+  });
+  ASSERT_EQ(3u, values.size());
+  EXPECT_EQ(5, values[0].get<int64_t>());
+  EXPECT_EQ("value", values[1].get<std::string>());
+  EXPECT_EQ(rclcpp::PARAMETER_NOT_SET, values[2].get_type());
+  EXPECT_EQ(1u, on_set_calls);
+  EXPECT_EQ(1u, post_set_calls);
+  EXPECT_EQ(2u, set_parameters.size());
+  EXPECT_TRUE(node_parameters->has_parameter("batch.unset"));
+  auto descriptors = node_parameters->describe_parameters({"batch.int"});
+  ASSERT_EQ(1u, descriptors.size());
+  EXPECT_EQ(rcl_interfaces::msg::ParameterType::PARAMETER_INTEGER, descriptors[0].type);
+
+  // A single invalid declaration prevents all of them.
+  EXPECT_THROW(
+    node_parameters->declare_parameters(
+  {
+    {rclcpp::Parameter("batch.valid", 1), int_descriptor},
+    {rclcpp::Parameter("batch.out_of_range", 11), int_descriptor},
+  }),
+    rclcpp::exceptions::InvalidParameterValueException);
+  EXPECT_THROW(
+    node_parameters->declare_parameters(
+  {
+    {rclcpp::Parameter("batch.valid", 1), int_descriptor},
+    {rclcpp::Parameter("batch.int", 1), int_descriptor},
+  }),
+    rclcpp::exceptions::ParameterAlreadyDeclaredException);
+  EXPECT_THROW(
+    node_parameters->declare_parameters(
+  {
+    {rclcpp::Parameter("batch.valid", 1), int_descriptor},
+    {rclcpp::Parameter("batch.valid", 2), int_descriptor},
+  }),
+    rclcpp::exceptions::ParameterAlreadyDeclaredException);
+  EXPECT_THROW(
+    node_parameters->declare_parameters({{rclcpp::Parameter("batch.valid"), int_descriptor}}),
+    rclcpp::exceptions::InvalidParameterTypeException);
+  EXPECT_FALSE(node_parameters->has_parameter("batch.valid"));
+  EXPECT_EQ(1u, on_set_calls);
+
+  node_parameters->remove_on_set_parameters_callback(on_set_handle.get());
+  node_parameters->remove_post_set_parameters_callback(post_set_handle.get());
+}
+
+TEST_F(TestNodeParameters, parameter_handle) {
+  EXPECT_THROW(
+    node_parameters->get_parameter_handle("undeclared_parameter"),
+    rclcpp::exceptions::ParameterNotDeclaredException);
+
+  rcl_interfaces::msg::ParameterDescriptor dynamic_descriptor;
+  dynamic_descriptor.dynamic_typing = true;
+  node_parameters->declare_parameter(
+    "int_parameter", rclcpp::ParameterValue(1), dynamic_descriptor, false);
+
+  auto handle = node_parameters->get_parameter_handle("int_parameter");
+  ASSERT_NE(nullptr, handle);
+  EXPECT_EQ(handle, node_parameters->get_parameter_handle("int_parameter"));
+  EXPECT_EQ("int_parameter", handle->get_name());
+  EXPECT_TRUE(handle->is_valid());
+  EXPECT_EQ(1, handle->get_value_as<int64_t>());
+
+  // A snapshot of the value is not modified by setting the parameter.
+  auto old_value = handle->get_value();
+  EXPECT_TRUE(node_parameters->set_parameters_atomically({{"int_parameter", 2}}).successful);
+  EXPECT_EQ(2, handle->get_value_as<int64_t>());
+  EXPECT_EQ(1, old_value->get<int64_t>());
+  EXPECT_EQ(rclcpp::Parameter("int_parameter", 2), handle->get_parameter());
+
+  // Values rejected by the callbacks are not visible through the handle.
+  auto callback_handle = node_parameters->add_on_set_parameters_callback(
+    [](const std::vector<rclcpp::Parameter> &) {
+      rcl_interfaces::msg::SetParametersResult result;
+      result.successful = false;
+      return result;
+    });
+  EXPECT_FALSE(node_parameters->set_parameters_atomically({{"int_parameter", 3}}).successful);
+  EXPECT_EQ(2, handle->get_value_as<int64_t>());
+  node_parameters->remove_on_set_parameters_callback(callback_handle.get());
+
+  node_parameters->undeclare_parameter("int_parameter");
+  EXPECT_FALSE(handle->is_valid());
+  EXPECT_EQ(2, handle->get_value_as<int64_t>());
+
+  // Declaring the parameter again gives a new handle.
+  node_parameters->declare_parameter(
+    "int_parameter", rclcpp::ParameterValue(4), dynamic_descriptor, false);
+  auto new_handle = node_parameters->get_parameter_handle("int_parameter");
+  EXPECT_NE(handle, new_handle);
+  EXPECT_TRUE(new_handle->is_valid());
+  EXPECT_EQ(4, new_handle->get_value_as<int64_t>());
+
+  // Undeclaring by setting a value of type not set invalidates the handle as well.
+  EXPECT_TRUE(
+    node_parameters->set_parameters_atomically({rclcpp::Parameter("int_parameter")}).successful);
+  EXPECT_FALSE(new_handle->is_valid());
+}
+
+TEST_F(TestNodeParameters, parameter_event_coalescing) {
+  rclcpp::NodeOptions options;
+  options.parameter_event_coalescing_period(std::chrono::milliseconds(100));
+  auto coalescing_node = std::make_shared<rclcpp::Node>("coalescing_node", "ns", options);
+  const std::string coalescing_node_name = coalescing_node->get_fully_qualified_name();
+
+  std::vector<rcl_interfaces::msg::ParameterEvent> events;
+  auto subscription = node->create_subscription<rcl_interfaces::msg::ParameterEvent>(
+    "/parameter_events", rclcpp::ParameterEventsQoS(),
+    [&events, &coalescing_node_name](const rcl_interfaces::msg::ParameterEvent & event) {
+      if (event.node == coalescing_node_name) {
+        events.push_back(event);
+      }
+    });
+  const auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+  while (coalescing_node->count_subscribers("/parameter_events") == 0 &&
+    std::chrono::steady_clock::now() < timeout)
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+
+  // The changes are made without spinning, so they are all within the period which started
+  // with the declaration of the parameters of the node, when it was constructed.
+  rcl_interfaces::msg::ParameterDescriptor dynamic_descriptor;
+  dynamic_descriptor.dynamic_typing = true;
+  coalescing_node->declare_parameter("coalesced", 1, dynamic_descriptor);
+  coalescing_node->set_parameter(rclcpp::Parameter("coalesced", 2));
+  coalescing_node->set_parameter(rclcpp::Parameter("coalesced", 3));
+  coalescing_node->declare_parameter("transient", 1, dynamic_descriptor);
+  // Implicitly undeclared, which is merged with the declaration into no change.
+  coalescing_node->set_parameter(rclcpp::Parameter("transient"));
+
+  rclcpp::executors::SingleThreadedExecutor executor;
+  executor.add_node(node);
+  executor.add_node(coalescing_node);
+  while (events.empty() && std::chrono::steady_clock::now() < timeout) {
+    executor.spin_some(std::chrono::milliseconds(10));
+  }
+  executor.spin_some(std::chrono::milliseconds(200));
+
+  ASSERT_EQ(1u, events.size());
+  const auto & event = events[0];
+  auto new_parameter = std::find_if(
+    event.new_parameters.begin(), event.new_parameters.end(),
+    [](const rcl_interfaces::msg::Parameter & parameter) {return parameter.name == "coalesced";});
+  ASSERT_NE(event.new_parameters.end(), new_parameter);
+  EXPECT_EQ(3, new_parameter->value.integer_value);
+  for (const auto & parameter : event.new_parameters) {
+    EXPECT_NE("transient", parameter.name);
+  }
+  EXPECT_TRUE(event.changed_parameters.empty());
+  EXPECT_TRUE(event.deleted_parameters.empty());
+}
+
 TEST_F(TestNodeParameters, add_remove_on_set_parameters_callback) {
   rcl_interfaces::msg::ParameterDescriptor bool_descriptor;
   bool_descriptor.name = "bool_parameter";
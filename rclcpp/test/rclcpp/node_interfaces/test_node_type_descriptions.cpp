@@ -59,3 +59,50 @@ TEST_F(TestNodeTypeDescriptions, enabled_creates_service)
 
   EXPECT_TRUE(services.find("/ns/node/get_type_description") != services.end());
 }
+
+TEST_F(TestNodeTypeDescriptions, disabled_from_node_options)
+{
+  rclcpp::NodeOptions node_options;
+  node_options.start_type_description_service(false);
+  rclcpp::Node node{"node", "ns", node_options};
+
+  EXPECT_FALSE(node.get_parameter("start_type_description_service").as_bool());
+  auto services = node.get_node_graph_interface()->get_service_names_and_types_by_node(
+    "node", "/ns");
+  EXPECT_TRUE(services.find("/ns/node/get_type_description") == services.end());
+}
+
+TEST_F(TestNodeTypeDescriptions, parameter_override_wins_over_node_options)
+{
+  rclcpp::NodeOptions node_options;
+  node_options.start_type_description_service(false);
+  node_options.append_parameter_override("start_type_description_service", true);
+  rclcpp::Node node{"node", "ns", node_options};
+
+  auto services = node.get_node_graph_interface()->get_service_names_and_types_by_node(
+    "node", "/ns");
+  EXPECT_TRUE(services.find("/ns/node/get_type_description") != services.end());
+}
+
+TEST_F(TestNodeTypeDescriptions, shared_service)
+{
+  rclcpp::NodeOptions node_options;
+  node_options.share_type_description_service(true);
+  auto node1 = std::make_shared<rclcpp::Node>("node1", "ns", node_options);
+  auto node2 = std::make_shared<rclcpp::Node>("node2", "ns", node_options);
+  rclcpp::Node unshared_node{"node3", "ns"};
+  EXPECT_TRUE(node2->get_parameter("start_type_description_service").as_bool());
+
+  auto graph = unshared_node.get_node_graph_interface();
+  auto services = graph->get_service_names_and_types_by_node("node1", "/ns");
+  EXPECT_TRUE(services.find("/ns/node1/get_type_description") != services.end());
+  services = graph->get_service_names_and_types_by_node("node2", "/ns");
+  EXPECT_TRUE(services.find("/ns/node2/get_type_description") == services.end());
+  services = graph->get_service_names_and_types_by_node("node3", "/ns");
+  EXPECT_TRUE(services.find("/ns/node3/get_type_description") != services.end());
+
+  // The service moves to the remaining node once the node hosting it is destroyed
+  node1.reset();
+  services = graph->get_service_names_and_types_by_node("node2", "/ns");
+  EXPECT_TRUE(services.find("/ns/node2/get_type_description") != services.end());
+}
@@ -533,6 +533,28 @@ TEST_F(TestAllocatorMemoryStrategy, add_remove_guard_conditions) {
   EXPECT_EQ(0u, allocator_memory_strategy()->number_of_guard_conditions());
 }
 
+TEST_F(TestAllocatorMemoryStrategy, remove_guard_conditions_in_any_order) {
+  rclcpp::GuardCondition guard_condition1;
+  rclcpp::GuardCondition guard_condition2;
+  rclcpp::GuardCondition guard_condition3;
+  allocator_memory_strategy()->add_guard_condition(guard_condition1);
+  allocator_memory_strategy()->add_guard_condition(guard_condition2);
+  allocator_memory_strategy()->add_guard_condition(guard_condition3);
+
+  // The last guard condition takes the place of the removed one, and can still be removed
+  allocator_memory_strategy()->remove_guard_condition(&guard_condition1);
+  EXPECT_EQ(2u, allocator_memory_strategy()->number_of_guard_conditions());
+  allocator_memory_strategy()->add_guard_condition(guard_condition3);
+  EXPECT_EQ(2u, allocator_memory_strategy()->number_of_guard_conditions());
+  allocator_memory_strategy()->remove_guard_condition(&guard_condition3);
+  EXPECT_EQ(1u, allocator_memory_strategy()->number_of_guard_conditions());
+  allocator_memory_strategy()->add_guard_condition(guard_condition1);
+  EXPECT_EQ(2u, allocator_memory_strategy()->number_of_guard_conditions());
+  allocator_memory_strategy()->remove_guard_condition(&guard_condition2);
+  allocator_memory_strategy()->remove_guard_condition(&guard_condition1);
+  EXPECT_EQ(0u, allocator_memory_strategy()->number_of_guard_conditions());
+}
+
 TEST_F(TestAllocatorMemoryStrategy, add_remove_waitables) {
   EXPECT_THROW(allocator_memory_strategy()->add_waitable_handle(nullptr), std::runtime_error);
   EXPECT_EQ(0u, allocator_memory_strategy()->number_of_waitables());
@@ -833,6 +855,96 @@ TEST_F(TestAllocatorMemoryStrategy, get_next_waitable) {
   }
 }
 
+TEST_F(TestAllocatorMemoryStrategy, get_next_subscription_with_reserved_handles) {
+  AllocatorMemoryStrategy<>::HandleCapacities capacities;
+  capacities.subscriptions = 4;
+  capacities.waitables = 8;
+  allocator_memory_strategy()->reserve_handles(capacities);
+  EXPECT_EQ(0u, allocator_memory_strategy()->number_of_ready_subscriptions());
+
+  WeakCallbackGroupsToNodesMap weak_groups_to_nodes;
+  for (const auto & node : {create_node_with_subscription("node1"),
+      create_node_with_subscription("node2")})
+  {
+    node->for_each_callback_group(
+      [node, &weak_groups_to_nodes](rclcpp::CallbackGroup::SharedPtr group_ptr)
+      {
+        weak_groups_to_nodes.insert(
+          std::pair<rclcpp::CallbackGroup::WeakPtr,
+          rclcpp::node_interfaces::NodeBaseInterface::WeakPtr>(
+            group_ptr,
+            node->get_node_base_interface()));
+      });
+  }
+  allocator_memory_strategy()->collect_entities(weak_groups_to_nodes);
+  EXPECT_EQ(2u, allocator_memory_strategy()->number_of_ready_subscriptions());
+
+  // Taken handles are reset in place, and skipped afterwards
+  rclcpp::AnyExecutable first_result;
+  allocator_memory_strategy()->get_next_subscription(first_result, weak_groups_to_nodes);
+  rclcpp::AnyExecutable second_result;
+  allocator_memory_strategy()->get_next_subscription(second_result, weak_groups_to_nodes);
+  rclcpp::AnyExecutable third_result;
+  allocator_memory_strategy()->get_next_subscription(third_result, weak_groups_to_nodes);
+  ASSERT_NE(nullptr, first_result.subscription);
+  ASSERT_NE(nullptr, second_result.subscription);
+  EXPECT_NE(first_result.subscription, second_result.subscription);
+  EXPECT_EQ(nullptr, third_result.subscription);
+
+  allocator_memory_strategy()->clear_handles();
+  allocator_memory_strategy()->collect_entities(weak_groups_to_nodes);
+  EXPECT_EQ(2u, allocator_memory_strategy()->number_of_ready_subscriptions());
+}
+
+TEST_F(TestAllocatorMemoryStrategy, get_next_subscription_only_ready) {
+  WeakCallbackGroupsToNodesMap weak_groups_to_nodes;
+  for (const auto & node : {create_node_with_subscription("node1"),
+      create_node_with_subscription("node2")})
+  {
+    node->for_each_callback_group(
+      [node, &weak_groups_to_nodes](rclcpp::CallbackGroup::SharedPtr group_ptr)
+      {
+        weak_groups_to_nodes.insert(
+          std::pair<rclcpp::CallbackGroup::WeakPtr,
+          rclcpp::node_interfaces::NodeBaseInterface::WeakPtr>(
+            group_ptr,
+            node->get_node_base_interface()));
+      });
+  }
+  allocator_memory_strategy()->collect_entities(weak_groups_to_nodes);
+
+  rcl_wait_set_t wait_set = rcl_get_zero_initialized_wait_set();
+  ASSERT_EQ(
+    rcl_wait_set_init(
+      &wait_set,
+      allocator_memory_strategy()->number_of_ready_subscriptions(),
+      allocator_memory_strategy()->number_of_guard_conditions(),
+      allocator_memory_strategy()->number_of_ready_timers(),
+      allocator_memory_strategy()->number_of_ready_clients(),
+      allocator_memory_strategy()->number_of_ready_services(),
+      allocator_memory_strategy()->number_of_ready_events(),
+      rclcpp::contexts::get_global_default_context()->get_rcl_context().get(),
+      allocator_memory_strategy()->get_allocator()),
+    RCL_RET_OK);
+  ASSERT_TRUE(allocator_memory_strategy()->add_handles_to_wait_set(&wait_set));
+  ASSERT_EQ(2u, wait_set.size_of_subscriptions);
+
+  // As rcl_wait() does, only leave the ready subscription in the wait set
+  const rcl_subscription_t * ready_subscription = wait_set.subscriptions[1];
+  wait_set.subscriptions[0] = nullptr;
+  allocator_memory_strategy()->remove_null_handles(&wait_set);
+
+  rclcpp::AnyExecutable first_result;
+  allocator_memory_strategy()->get_next_subscription(first_result, weak_groups_to_nodes);
+  ASSERT_NE(nullptr, first_result.subscription);
+  EXPECT_EQ(ready_subscription, first_result.subscription->get_subscription_handle().get());
+  rclcpp::AnyExecutable second_result;
+  allocator_memory_strategy()->get_next_subscription(second_result, weak_groups_to_nodes);
+  EXPECT_EQ(nullptr, second_result.subscription);
+
+  EXPECT_EQ(rcl_wait_set_fini(&wait_set), RCL_RET_OK);
+}
+
 TEST_F(TestAllocatorMemoryStrategy, get_next_subscription_mutually_exclusive) {
   auto node = create_node_with_subscription("node");
 
@@ -13,11 +13,14 @@
 // limitations under the License.
 
 #include <memory>
+#include <thread>
+#include <vector>
 
 #include "gtest/gtest.h"
 
 #include "rclcpp/strategies/message_pool_memory_strategy.hpp"
 #include "test_msgs/msg/empty.hpp"
+#include "test_msgs/msg/unbounded_sequences.hpp"
 #include "../../utils/rclcpp_gtest_macros.hpp"
 
 using rclcpp::strategies::message_pool_memory_strategy::MessagePoolMemoryStrategy;
@@ -81,3 +84,62 @@ TEST_F(TestMessagePoolMemoryStrategy, borrow_hold_reference) {
 
   EXPECT_NO_THROW(message_memory_strategy_->return_message(message2));
 }
+
+TEST(TestMessagePoolMemoryStrategyDynamicSize, reset_keeps_capacity) {
+  auto message_memory_strategy =
+    std::make_shared<MessagePoolMemoryStrategy<test_msgs::msg::UnboundedSequences, 1>>();
+
+  size_t values_capacity = 0;
+  size_t strings_capacity = 0;
+  {
+    auto message = message_memory_strategy->borrow_message();
+    ASSERT_NE(nullptr, message);
+    message->int32_values.resize(1000);
+    message->string_values.resize(10);
+    values_capacity = message->int32_values.capacity();
+    strings_capacity = message->string_values.capacity();
+    EXPECT_NO_THROW(message_memory_strategy->return_message(message));
+  }
+
+  // The message has been reset, but its sequences kept their capacity
+  auto message = message_memory_strategy->borrow_message();
+  ASSERT_NE(nullptr, message);
+  EXPECT_TRUE(message->int32_values.empty());
+  EXPECT_TRUE(message->string_values.empty());
+  EXPECT_EQ(values_capacity, message->int32_values.capacity());
+  EXPECT_EQ(strings_capacity, message->string_values.capacity());
+
+  RCLCPP_EXPECT_THROW_EQ(
+    message_memory_strategy->borrow_message(),
+    std::runtime_error("No more free slots in the pool"));
+}
+
+TEST(TestMessagePoolMemoryStrategyConcurrency, borrow_return_from_threads) {
+  constexpr size_t number_of_threads = 4;
+  auto message_memory_strategy =
+    std::make_shared<MessagePoolMemoryStrategy<test_msgs::msg::Empty, number_of_threads>>();
+
+  // Every thread holds at most one message, so the pool is never exhausted
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < number_of_threads; ++i) {
+    threads.emplace_back(
+      [&message_memory_strategy]() {
+        for (size_t j = 0; j < 10000; ++j) {
+          auto message = message_memory_strategy->borrow_message();
+          ASSERT_NE(nullptr, message);
+          message_memory_strategy->return_message(message);
+        }
+      });
+  }
+  for (auto & thread : threads) {
+    thread.join();
+  }
+
+  std::vector<std::shared_ptr<test_msgs::msg::Empty>> messages;
+  for (size_t i = 0; i < number_of_threads; ++i) {
+    messages.push_back(message_memory_strategy->borrow_message());
+  }
+  RCLCPP_EXPECT_THROW_EQ(
+    message_memory_strategy->borrow_message(),
+    std::runtime_error("No more free slots in the pool"));
+}
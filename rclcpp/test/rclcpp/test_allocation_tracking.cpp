@@ -0,0 +1,114 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+
+#include "rclcpp/allocation_tracking.hpp"
+#include "rclcpp/rclcpp.hpp"
+
+using namespace std::chrono_literals;
+
+RCLCPP_TRACK_ALLOCATIONS()
+
+namespace
+{
+
+// Calls of the allocation functions, unlike new expressions, can't be optimized away
+void
+allocate_and_free(size_t size)
+{
+  ::operator delete(::operator new(size));
+}
+
+}  // namespace
+
+TEST(TestAllocationTracking, count_thread_allocations) {
+  const uint64_t count = rclcpp::allocation_tracking::get_thread_allocation_count();
+  const uint64_t bytes = rclcpp::allocation_tracking::get_thread_allocated_bytes();
+  allocate_and_free(64);
+  EXPECT_TRUE(rclcpp::allocation_tracking::is_enabled());
+  EXPECT_EQ(count + 1, rclcpp::allocation_tracking::get_thread_allocation_count());
+  EXPECT_EQ(bytes + 64, rclcpp::allocation_tracking::get_thread_allocated_bytes());
+
+  rclcpp::allocation_tracking::AllocationCounter counter;
+  EXPECT_EQ(0u, counter.get_count());
+  allocate_and_free(1);
+  allocate_and_free(1);
+  EXPECT_EQ(2u, counter.get_count());
+  counter.reset();
+  EXPECT_EQ(0u, counter.get_count());
+}
+
+class TestExecutorAllocationTracking : public ::testing::Test
+{
+public:
+  void SetUp()
+  {
+    rclcpp::init(0, nullptr);
+  }
+
+  void TearDown()
+  {
+    rclcpp::allocation_tracking::exit_steady_state();
+    rclcpp::shutdown();
+  }
+};
+
+TEST_F(TestExecutorAllocationTracking, count_callback_allocations) {
+  auto node = std::make_shared<rclcpp::Node>("node");
+  std::atomic<size_t> allocations_per_call{3};
+  size_t timer_count = 0;
+  auto timer = node->create_wall_timer(
+    1ms, [&timer_count, &allocations_per_call]() {
+      timer_count++;
+      for (size_t i = 0; i < allocations_per_call; ++i) {
+        allocate_and_free(8);
+      }
+    });
+
+  rclcpp::ExecutorOptions options;
+  options.collect_callback_statistics = true;
+  rclcpp::executors::SingleThreadedExecutor executor(options);
+  executor.add_node(node);
+
+  auto start = std::chrono::steady_clock::now();
+  while (timer_count < 2 && std::chrono::steady_clock::now() - start < 5s) {
+    executor.spin_some(10ms);
+  }
+  ASSERT_LE(2u, timer_count);
+  auto statistics = executor.get_callback_statistics();
+  ASSERT_EQ(1u, statistics.size());
+  EXPECT_EQ(3 * timer_count, statistics[0]->allocation_count.load());
+
+  // Allocating in steady state fails loudly
+  rclcpp::allocation_tracking::enter_steady_state();
+  EXPECT_TRUE(rclcpp::allocation_tracking::is_steady_state());
+  start = std::chrono::steady_clock::now();
+  bool thrown = false;
+  while (!thrown && std::chrono::steady_clock::now() - start < 5s) {
+    try {
+      executor.spin_once(10ms);
+    } catch (const rclcpp::exceptions::AllocationInSteadyStateError & error) {
+      thrown = true;
+      EXPECT_LT(0u, error.allocation_count);
+    }
+  }
+  EXPECT_TRUE(thrown);
+  rclcpp::allocation_tracking::exit_steady_state();
+  EXPECT_FALSE(rclcpp::allocation_tracking::is_steady_state());
+}
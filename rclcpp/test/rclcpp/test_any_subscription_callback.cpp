@@ -22,6 +22,9 @@
 // TODO(aprotyas): Figure out better way to suppress deprecation warnings.
 #define RCLCPP_AVOID_DEPRECATIONS_FOR_UNIT_TESTS 1
 #include "rclcpp/any_subscription_callback.hpp"
+#include "rclcpp/detail/resolve_intra_process_buffer_type.hpp"
+#include "rclcpp/lazy_message.hpp"
+#include "rclcpp/serialization.hpp"
 #include "test_msgs/msg/empty.hpp"
 #include "test_msgs/msg/empty.h"
 
@@ -198,6 +201,98 @@ TEST_F(TestAnySubscriptionCallback, is_serialized_message_callback) {
   }
 }
 
+TEST_F(TestAnySubscriptionCallback, lazy_message_callback) {
+  int deserialized_count = 0;
+  rclcpp::AnySubscriptionCallback<test_msgs::msg::Empty> asc;
+  asc.set(
+    [&deserialized_count](const rclcpp::LazyMessage<test_msgs::msg::Empty> & message) {
+      deserialized_count += message.is_deserialized();
+    });
+  EXPECT_TRUE(asc.is_lazy_message_callback());
+  EXPECT_TRUE(asc.is_serialized_message_callback());
+  EXPECT_TRUE(asc.use_const_reference_method());
+  EXPECT_FALSE(asc.uses_message_info());
+
+  auto serialized_message = std::make_shared<rclcpp::SerializedMessage>();
+  rclcpp::Serialization<test_msgs::msg::Empty>().serialize_message(
+    msg_shared_ptr_.get(), serialized_message.get());
+  asc.dispatch(serialized_message, message_info_);
+  EXPECT_EQ(0, deserialized_count);
+  // Intra-process messages are given deserialized
+  asc.dispatch_intra_process(
+    std::shared_ptr<const test_msgs::msg::Empty>(msg_shared_ptr_), message_info_);
+  asc.dispatch_intra_process(get_unique_ptr_msg(), message_info_);
+  EXPECT_EQ(2, deserialized_count);
+
+  rclcpp::AnySubscriptionCallback<test_msgs::msg::Empty> asc_with_info;
+  asc_with_info.set(
+    [](const rclcpp::LazyMessage<test_msgs::msg::Empty> &, const rclcpp::MessageInfo &) {});
+  EXPECT_TRUE(asc_with_info.is_lazy_message_callback());
+  EXPECT_TRUE(asc_with_info.uses_message_info());
+  EXPECT_NO_THROW(asc_with_info.dispatch(serialized_message, message_info_));
+}
+
+TEST_F(TestAnySubscriptionCallbackTA, lazy_message_callback) {
+  int deserialized_count = 0;
+  rclcpp::AnySubscriptionCallback<MyTA> asc;
+  asc.set(
+    [&deserialized_count](const rclcpp::LazyMessage<test_msgs::msg::Empty> & message) {
+      deserialized_count += message.is_deserialized();
+    });
+  EXPECT_TRUE(asc.is_lazy_message_callback());
+  // Custom messages are converted to ROS messages
+  asc.dispatch_intra_process(std::shared_ptr<const MyEmpty>(msg_shared_ptr_), message_info_);
+  asc.dispatch_intra_process(get_unique_ptr_msg(), message_info_);
+  EXPECT_EQ(2, deserialized_count);
+}
+
+TEST_F(TestAnySubscriptionCallback, resolve_intra_process_buffer_type) {
+  using rclcpp::IntraProcessBufferType;
+  using rclcpp::detail::resolve_intra_process_buffer_type;
+  {
+    // A const reference callback gets shared messages, which aren't copied for it
+    rclcpp::AnySubscriptionCallback<test_msgs::msg::Empty> asc;
+    asc.set([](const test_msgs::msg::Empty &) {});
+    EXPECT_TRUE(asc.use_const_reference_method());
+    EXPECT_FALSE(asc.use_take_shared_method());
+    EXPECT_EQ(
+      IntraProcessBufferType::SharedPtr,
+      resolve_intra_process_buffer_type(IntraProcessBufferType::CallbackDefault, asc));
+    EXPECT_EQ(
+      IntraProcessBufferType::LockFreeSharedPtr,
+      resolve_intra_process_buffer_type(IntraProcessBufferType::LockFreeCallbackDefault, asc));
+    EXPECT_EQ(
+      IntraProcessBufferType::MailboxSharedPtr,
+      resolve_intra_process_buffer_type(IntraProcessBufferType::MailboxCallbackDefault, asc));
+    // An explicit type is kept
+    EXPECT_EQ(
+      IntraProcessBufferType::UniquePtr,
+      resolve_intra_process_buffer_type(IntraProcessBufferType::UniquePtr, asc));
+  }
+  {
+    rclcpp::AnySubscriptionCallback<test_msgs::msg::Empty> asc;
+    asc.set([](const test_msgs::msg::Empty &, const rclcpp::MessageInfo &) {});
+    EXPECT_TRUE(asc.use_const_reference_method());
+  }
+  {
+    // A callback taking ownership gets unique messages
+    rclcpp::AnySubscriptionCallback<test_msgs::msg::Empty> asc;
+    asc.set([](std::unique_ptr<test_msgs::msg::Empty>) {});
+    EXPECT_FALSE(asc.use_const_reference_method());
+    EXPECT_EQ(
+      IntraProcessBufferType::UniquePtr,
+      resolve_intra_process_buffer_type(IntraProcessBufferType::CallbackDefault, asc));
+  }
+  {
+    rclcpp::AnySubscriptionCallback<test_msgs::msg::Empty> asc;
+    asc.set([](std::shared_ptr<const test_msgs::msg::Empty>) {});
+    EXPECT_FALSE(asc.use_const_reference_method());
+    EXPECT_EQ(
+      IntraProcessBufferType::SharedPtr,
+      resolve_intra_process_buffer_type(IntraProcessBufferType::CallbackDefault, asc));
+  }
+}
+
 TEST_F(TestAnySubscriptionCallback, unset_dispatch_throw) {
   EXPECT_THROW(
     any_subscription_callback_.dispatch(msg_shared_ptr_, message_info_),
@@ -210,6 +305,29 @@ TEST_F(TestAnySubscriptionCallback, unset_dispatch_throw) {
     std::runtime_error);
 }
 
+TEST_F(TestAnySubscriptionCallback, dispatch_after_variant_change) {
+  int shared_calls = 0;
+  int const_ref_calls = 0;
+  any_subscription_callback_.set(
+    [&shared_calls](std::shared_ptr<const test_msgs::msg::Empty>) {shared_calls++;});
+  any_subscription_callback_.dispatch(msg_shared_ptr_, message_info_);
+  EXPECT_EQ(1, shared_calls);
+
+  // Dispatching follows callbacks assigned directly to the variant
+  using ConstRefCallback = std::function<void (const test_msgs::msg::Empty &)>;
+  any_subscription_callback_.get_variant() =
+    ConstRefCallback([&const_ref_calls](const test_msgs::msg::Empty &) {const_ref_calls++;});
+  any_subscription_callback_.dispatch(msg_shared_ptr_, message_info_);
+  any_subscription_callback_.dispatch_intra_process(get_unique_ptr_msg(), message_info_);
+  EXPECT_EQ(1, shared_calls);
+  EXPECT_EQ(2, const_ref_calls);
+
+  any_subscription_callback_.get_variant() = ConstRefCallback();
+  EXPECT_THROW(
+    any_subscription_callback_.dispatch(msg_shared_ptr_, message_info_),
+    std::runtime_error);
+}
+
 //
 // Parameterized test to test across all callback types and dispatch types.
 //
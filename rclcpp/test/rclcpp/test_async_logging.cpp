@@ -0,0 +1,73 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <future>
+#include <memory>
+#include <string>
+
+#include "rclcpp/rclcpp.hpp"
+
+#include "rcl_interfaces/msg/log.hpp"
+
+using namespace std::chrono_literals;
+
+class TestAsyncLogging : public ::testing::Test
+{
+protected:
+  void SetUp()
+  {
+    rclcpp::InitOptions init_options;
+    init_options.async_logging_queue_size = 100;
+    rclcpp::init(0, nullptr, init_options);
+    node = std::make_shared<rclcpp::Node>("test_async_logging", "/ns");
+  }
+
+  void TearDown()
+  {
+    node.reset();
+    rclcpp::shutdown();
+  }
+
+  rclcpp::Node::SharedPtr node;
+};
+
+TEST_F(TestAsyncLogging, log_to_rosout) {
+  std::promise<std::string> received_msg_promise;
+  bool received = false;
+  auto sub = node->create_subscription<rcl_interfaces::msg::Log>(
+    "/rosout", 10, [&](rcl_interfaces::msg::Log::ConstSharedPtr msg) {
+      if (!received && msg->name == "ns.test_async_logging") {
+        received = true;
+        received_msg_promise.set_value(msg->msg);
+      }
+    });
+
+  const std::string long_message(2000, 'a');
+  RCLCPP_INFO(node->get_logger(), "%s %d", long_message.c_str(), 42);
+  auto future = received_msg_promise.get_future();
+  ASSERT_EQ(
+    rclcpp::FutureReturnCode::SUCCESS, rclcpp::spin_until_future_complete(node, future, 3s));
+  EXPECT_EQ(long_message + " 42", future.get());
+}
+
+TEST_F(TestAsyncLogging, shutdown_with_queued_messages) {
+  for (int i = 0; i < 1000; ++i) {
+    RCLCPP_INFO(node->get_logger(), "message %d", i);
+  }
+  // The queued messages are output, or dropped, before logging is finalized in TearDown()
+}
@@ -0,0 +1,156 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "rclcpp/experimental/buffers/broadcast_ring.hpp"
+
+using rclcpp::experimental::buffers::BroadcastBufferImplementation;
+using rclcpp::experimental::buffers::BroadcastRing;
+
+TEST(TestBroadcastRing, readers_keep_their_position) {
+  EXPECT_THROW(BroadcastRing<char>(0), std::invalid_argument);
+
+  BroadcastRing<char> ring(3);
+  std::atomic<uint64_t> first_cursor{0};
+  std::atomic<uint64_t> second_cursor{0};
+  char value = '\0';
+  EXPECT_FALSE(ring.has_data(0));
+  EXPECT_FALSE(ring.read(first_cursor, value));
+
+  EXPECT_EQ(0u, ring.write('a'));
+  EXPECT_EQ(1u, ring.write('b'));
+  EXPECT_TRUE(ring.has_data(0));
+  EXPECT_EQ(2u, ring.unread(0));
+
+  // Each element is read by each reader
+  EXPECT_TRUE(ring.read(first_cursor, value));
+  EXPECT_EQ('a', value);
+  EXPECT_TRUE(ring.read(first_cursor, value));
+  EXPECT_EQ('b', value);
+  EXPECT_FALSE(ring.read(first_cursor, value));
+  EXPECT_TRUE(ring.read(second_cursor, value));
+  EXPECT_EQ('a', value);
+
+  // The second reader falls behind and skips the overwritten elements
+  ring.write('c');
+  ring.write('d');
+  ring.write('e');
+  EXPECT_EQ(3u, ring.unread(second_cursor));
+  uint64_t skipped = 0;
+  EXPECT_TRUE(ring.read(second_cursor, value, &skipped));
+  EXPECT_EQ('c', value);
+  EXPECT_EQ(1u, skipped);
+  EXPECT_TRUE(ring.read(first_cursor, value));
+  EXPECT_EQ('c', value);
+}
+
+TEST(TestBroadcastRing, buffer_reads_attached_rings) {
+  BroadcastBufferImplementation<std::shared_ptr<const int>> buffer(2);
+  EXPECT_FALSE(buffer.has_data());
+  EXPECT_EQ(2u, buffer.available_capacity());
+  EXPECT_FALSE(buffer.dequeue());
+
+  buffer.enqueue(std::make_shared<const int>(1));
+  EXPECT_TRUE(buffer.has_data());
+  EXPECT_EQ(1u, buffer.available_capacity());
+  EXPECT_EQ(1, *buffer.dequeue());
+
+  auto ring = std::make_shared<BroadcastRing<std::shared_ptr<const int>>>(4);
+  const uint64_t sequence = ring->write(std::make_shared<const int>(2));
+  EXPECT_TRUE(buffer.attach(*ring, ring, sequence));
+  // Attaching again doesn't move the position
+  EXPECT_TRUE(buffer.attach(*ring, ring, ring->write(std::make_shared<const int>(3))));
+
+  std::shared_ptr<const int> values[3];
+  EXPECT_EQ(2u, buffer.dequeue_n(values, 3));
+  EXPECT_EQ(2, *values[0]);
+  EXPECT_EQ(3, *values[1]);
+
+  EXPECT_EQ(0u, buffer.get_dropped_count());
+  // The buffer falls behind the ring, and counts the overwritten elements
+  for (int i = 4; i < 9; ++i) {
+    ring->write(std::make_shared<const int>(i));
+  }
+  EXPECT_EQ(5, *buffer.dequeue());
+  EXPECT_EQ(1u, buffer.get_dropped_count());
+
+  ring->write(std::make_shared<const int>(9));
+  buffer.clear();
+  EXPECT_FALSE(buffer.has_data());
+
+  // The buffer keeps the ring alive
+  std::weak_ptr<BroadcastRing<std::shared_ptr<const int>>> weak_ring = ring;
+  ring.reset();
+  EXPECT_FALSE(weak_ring.expired());
+
+  std::vector<std::shared_ptr<BroadcastRing<std::shared_ptr<const int>>>> rings;
+  for (size_t i = 1; i < buffer.max_rings; ++i) {
+    rings.push_back(std::make_shared<BroadcastRing<std::shared_ptr<const int>>>(1));
+    if (i < buffer.max_rings - 1) {
+      EXPECT_TRUE(buffer.attach(*rings.back(), rings.back(), 0));
+    }
+  }
+  EXPECT_FALSE(buffer.attach(*rings.back(), rings.back(), 0));
+}
+
+TEST(TestBroadcastRing, concurrent_writers_and_readers) {
+  static constexpr size_t number_of_writers = 2;
+  static constexpr size_t number_of_readers = 3;
+  static constexpr size_t number_of_elements = 10000;
+  BroadcastRing<std::shared_ptr<const size_t>> ring(16);
+
+  std::atomic<size_t> writers_done{0};
+  std::vector<std::thread> threads;
+  for (size_t w = 0; w < number_of_writers; ++w) {
+    threads.emplace_back(
+      [&ring, &writers_done]() {
+        for (size_t i = 0; i < number_of_elements; ++i) {
+          ring.write(std::make_shared<const size_t>(i));
+        }
+        writers_done++;
+      });
+  }
+  std::vector<size_t> read_counts(number_of_readers, 0);
+  for (size_t r = 0; r < number_of_readers; ++r) {
+    threads.emplace_back(
+      [&ring, &writers_done, &read_counts, r]() {
+        std::atomic<uint64_t> cursor{0};
+        std::shared_ptr<const size_t> value;
+        while (writers_done < number_of_writers || ring.has_data(cursor)) {
+          if (ring.read(cursor, value)) {
+            ASSERT_TRUE(value);
+            EXPECT_LT(*value, number_of_elements);
+            read_counts[r]++;
+          }
+        }
+      });
+  }
+  for (auto & thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(number_of_writers * number_of_elements, ring.end());
+  for (size_t count : read_counts) {
+    EXPECT_GT(count, 0u);
+    EXPECT_LE(count, number_of_writers * number_of_elements);
+  }
+}
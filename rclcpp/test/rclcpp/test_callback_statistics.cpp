@@ -0,0 +1,147 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+
+#include "rclcpp/callback_statistics.hpp"
+#include "rclcpp/rclcpp.hpp"
+
+#include "test_msgs/msg/empty.hpp"
+
+using namespace std::chrono_literals;
+
+TEST(TestLatencyHistogram, empty) {
+  rclcpp::LatencyHistogram histogram;
+  EXPECT_EQ(0u, histogram.get_count());
+  EXPECT_EQ(0ns, histogram.get_min());
+  EXPECT_EQ(0ns, histogram.get_max());
+  EXPECT_EQ(0ns, histogram.get_mean());
+  EXPECT_EQ(0ns, histogram.get_percentile(50.0));
+  EXPECT_THROW(histogram.get_percentile(-1.0), std::invalid_argument);
+  EXPECT_THROW(histogram.get_percentile(101.0), std::invalid_argument);
+}
+
+TEST(TestLatencyHistogram, percentiles) {
+  rclcpp::LatencyHistogram histogram;
+  for (int64_t i = 1; i <= 1000; ++i) {
+    histogram.record(std::chrono::microseconds(i));
+  }
+  EXPECT_EQ(1000u, histogram.get_count());
+  EXPECT_EQ(1us, histogram.get_min());
+  EXPECT_EQ(1000us, histogram.get_max());
+  EXPECT_EQ(std::chrono::nanoseconds(500500), histogram.get_mean());
+
+  // Percentiles are reported within the precision of the histogram
+  const auto median = histogram.get_percentile(50.0);
+  EXPECT_GE(median, 500us);
+  EXPECT_LE(median, 500us + 500us / 32);
+  const auto p99 = histogram.get_percentile(99.0);
+  EXPECT_GE(p99, 990us);
+  EXPECT_LE(p99, 990us + 990us / 32);
+  EXPECT_EQ(1000us, histogram.get_percentile(100.0));
+
+  histogram.reset();
+  EXPECT_EQ(0u, histogram.get_count());
+  EXPECT_EQ(0ns, histogram.get_max());
+}
+
+TEST(TestLatencyHistogram, small_values_are_exact) {
+  rclcpp::LatencyHistogram histogram;
+  histogram.record(-5ns);
+  histogram.record(42ns);
+  EXPECT_EQ(0ns, histogram.get_min());
+  EXPECT_EQ(0ns, histogram.get_percentile(50.0));
+  EXPECT_EQ(42ns, histogram.get_percentile(100.0));
+}
+
+class TestExecutorCallbackStatistics : public ::testing::Test
+{
+public:
+  void SetUp()
+  {
+    rclcpp::init(0, nullptr);
+  }
+
+  void TearDown()
+  {
+    rclcpp::shutdown();
+  }
+};
+
+TEST_F(TestExecutorCallbackStatistics, disabled_by_default) {
+  auto node = std::make_shared<rclcpp::Node>("node");
+  auto timer = node->create_wall_timer(1ms, []() {});
+
+  rclcpp::executors::SingleThreadedExecutor executor;
+  executor.add_node(node);
+  executor.spin_some(20ms);
+  EXPECT_TRUE(executor.get_callback_statistics().empty());
+}
+
+TEST_F(TestExecutorCallbackStatistics, record_callbacks) {
+  auto node = std::make_shared<rclcpp::Node>("node");
+  size_t timer_count = 0;
+  auto timer = node->create_wall_timer(
+    1ms, [&timer_count]() {
+      timer_count++;
+      std::this_thread::sleep_for(1ms);
+    });
+  size_t message_count = 0;
+  auto subscription = node->create_subscription<test_msgs::msg::Empty>(
+    "topic", 10, [&message_count](test_msgs::msg::Empty::ConstSharedPtr) {message_count++;});
+  auto publisher = node->create_publisher<test_msgs::msg::Empty>("topic", 10);
+
+  rclcpp::ExecutorOptions options;
+  options.collect_callback_statistics = true;
+  rclcpp::executors::SingleThreadedExecutor executor(options);
+  executor.add_node(node);
+
+  auto start = std::chrono::steady_clock::now();
+  while ((timer_count < 3 || message_count == 0) && std::chrono::steady_clock::now() - start < 5s) {
+    publisher->publish(test_msgs::msg::Empty());
+    executor.spin_some(10ms);
+  }
+  ASSERT_LE(3u, timer_count);
+  ASSERT_LT(0u, message_count);
+
+  rclcpp::CallbackStatistics::ConstSharedPtr timer_statistics;
+  rclcpp::CallbackStatistics::ConstSharedPtr subscription_statistics;
+  for (const auto & statistics : executor.get_callback_statistics()) {
+    if (statistics->entity_type == rclcpp::CallbackStatistics::EntityType::Timer) {
+      timer_statistics = statistics;
+    } else if (  // NOLINT
+      statistics->entity_type == rclcpp::CallbackStatistics::EntityType::Subscription)
+    {
+      subscription_statistics = statistics;
+    }
+  }
+  ASSERT_NE(nullptr, timer_statistics);
+  EXPECT_EQ(timer_count, timer_statistics->execution_time.get_count());
+  EXPECT_EQ(timer_count, timer_statistics->wait_latency.get_count());
+  EXPECT_LE(1ms, timer_statistics->execution_time.get_min());
+  EXPECT_EQ(timer_count, timer_statistics->timer_lateness.get_count());
+
+  ASSERT_NE(nullptr, subscription_statistics);
+  EXPECT_EQ("/topic", subscription_statistics->entity_name);
+  EXPECT_EQ(message_count, subscription_statistics->execution_time.get_count());
+  EXPECT_EQ(0u, subscription_statistics->timer_lateness.get_count());
+
+  executor.reset_callback_statistics();
+  EXPECT_TRUE(executor.get_callback_statistics().empty());
+}
@@ -14,9 +14,14 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <atomic>
+#include <future>
 #include <string>
 #include <memory>
+#include <thread>
 #include <utility>
+#include <vector>
 
 #include "rclcpp/exceptions.hpp"
 #include "rclcpp/rclcpp.hpp"
@@ -202,6 +207,53 @@ TEST_F(TestClient, wait_for_service) {
   EXPECT_TRUE(client->service_is_ready());
 }
 
+TEST_F(TestClient, on_service_available_callback) {
+  const std::string service_name = "service";
+  auto client = node->create_client<test_msgs::srv::Empty>(service_name);
+  EXPECT_THROW(client->set_on_service_available_callback(nullptr), std::invalid_argument);
+
+  std::promise<void> available;
+  std::atomic<size_t> calls{0};
+  client->set_on_service_available_callback(
+    [&available, &calls]() {
+      if (0u == calls++) {
+        available.set_value();
+      }
+    });
+  EXPECT_EQ(0u, calls.load());
+
+  auto service = node->create_service<test_msgs::srv::Empty>(
+    service_name,
+    [](
+      const test_msgs::srv::Empty::Request::SharedPtr,
+      test_msgs::srv::Empty::Response::SharedPtr) {});
+  ASSERT_EQ(
+    std::future_status::ready, available.get_future().wait_for(std::chrono::seconds(5)));
+  EXPECT_TRUE(client->service_is_ready());
+  EXPECT_EQ(1u, calls.load());
+
+  // Called right away when the service is already ready
+  bool called = false;
+  client->set_on_service_available_callback([&called]() {called = true;});
+  EXPECT_TRUE(called);
+  client->clear_on_service_available_callback();
+}
+
+TEST_F(TestClient, pooled_responses) {
+  auto client = node->create_client<test_msgs::srv::Empty>(
+    "service", rclcpp::ServicesQoS(), nullptr, 1);
+
+  auto response = client->create_response();
+  auto request_header = client->create_request_header();
+  const void * response_address = response.get();
+  const void * request_header_address = request_header.get();
+  EXPECT_NE(response_address, client->create_response().get());
+  response.reset();
+  request_header.reset();
+  EXPECT_EQ(response_address, client->create_response().get());
+  EXPECT_EQ(request_header_address, client->create_request_header().get());
+}
+
 /*
    Testing client construction and destruction for subnodes.
  */
@@ -348,6 +400,32 @@ TEST_F(TestClientWithServer, prune_requests_older_than_with_pruned) {
   EXPECT_EQ(future.request_id, pruned_requests[0]);
 }
 
+TEST_F(TestClientWithServer, prune_requests_older_than_many_requests) {
+  auto client = node->create_client<test_msgs::srv::Empty>("no_service_server_available_here");
+  auto request = std::make_shared<test_msgs::srv::Empty::Request>();
+  std::vector<int64_t> old_requests;
+  for (int i = 0; i < 40; ++i) {
+    old_requests.push_back(client->async_send_request(request).request_id);
+  }
+  std::this_thread::sleep_for(1ms);
+  auto time = std::chrono::system_clock::now();
+  std::this_thread::sleep_for(1ms);
+  std::vector<int64_t> new_requests;
+  for (int i = 0; i < 40; ++i) {
+    new_requests.push_back(client->async_send_request(request).request_id);
+  }
+
+  std::vector<int64_t> pruned_requests;
+  EXPECT_EQ(40u, client->prune_requests_older_than(time, &pruned_requests));
+  std::sort(pruned_requests.begin(), pruned_requests.end());
+  std::sort(old_requests.begin(), old_requests.end());
+  EXPECT_EQ(old_requests, pruned_requests);
+  for (int64_t request_id : new_requests) {
+    EXPECT_TRUE(client->remove_pending_request(request_id));
+  }
+  EXPECT_EQ(0u, client->prune_pending_requests());
+}
+
 TEST_F(TestClientWithServer, async_send_request_rcl_send_request_error) {
   // Checking rcl_send_request in rclcpp::Client::async_send_request()
   auto mock = mocking_utils::patch_and_return("lib:rclcpp", rcl_send_request, RCL_RET_ERROR);
@@ -601,3 +679,75 @@ TEST_F(TestClient, client_qos_depth) {
 
   EXPECT_EQ(client_cb_count_, client_qos_profile.depth());
 }
+
+TEST_F(TestClient, intra_process_requests) {
+  using test_msgs::srv::Empty;
+  auto intra_node = std::make_shared<rclcpp::Node>(
+    "intra_node", "/ns", rclcpp::NodeOptions().use_intra_process_comms(true));
+
+  const Empty::Request * received_request = nullptr;
+  int64_t received_sequence_number = 0;
+  auto service = intra_node->create_service<Empty>(
+    "intra_service",
+    [&](
+      const std::shared_ptr<rmw_request_id_t> request_header,
+      const Empty::Request::SharedPtr request, Empty::Response::SharedPtr) {
+      received_request = request.get();
+      received_sequence_number = request_header->sequence_number;
+    });
+  EXPECT_NE(nullptr, service->get_intra_process_waitable());
+  auto client = intra_node->create_client<Empty>("intra_service");
+  EXPECT_NE(nullptr, client->get_intra_process_waitable());
+
+  // Nothing waits for the discovery of the service
+  auto request = std::make_shared<Empty::Request>();
+  auto future = client->async_send_request(request);
+  EXPECT_LT(future.request_id, 0);
+  ASSERT_EQ(
+    rclcpp::FutureReturnCode::SUCCESS,
+    rclcpp::spin_until_future_complete(intra_node, future, 5s));
+  EXPECT_NE(nullptr, future.get());
+  // The request was handed over without a copy
+  EXPECT_EQ(request.get(), received_request);
+  EXPECT_LT(received_sequence_number, 0);
+  EXPECT_EQ(0u, client->prune_pending_requests());
+}
+
+TEST_F(TestClient, intra_process_deferred_response) {
+  using test_msgs::srv::Empty;
+  auto intra_node = std::make_shared<rclcpp::Node>(
+    "intra_node", "/ns", rclcpp::NodeOptions().use_intra_process_comms(true));
+
+  std::shared_ptr<rmw_request_id_t> deferred_header;
+  auto service = intra_node->create_service<Empty>(
+    "deferred_service",
+    [&deferred_header](
+      std::shared_ptr<rmw_request_id_t> request_header, std::shared_ptr<Empty::Request>) {
+      deferred_header = request_header;
+    });
+  auto client = intra_node->create_client<Empty>("deferred_service");
+
+  bool responded = false;
+  client->async_send_request(
+    std::make_shared<Empty::Request>(),
+    [&responded](rclcpp::Client<Empty>::SharedFuture future) {
+      responded = nullptr != future.get();
+    });
+  rclcpp::executors::SingleThreadedExecutor executor;
+  executor.add_node(intra_node);
+  auto start = std::chrono::steady_clock::now();
+  while (!deferred_header && (std::chrono::steady_clock::now() - start) < 5s) {
+    executor.spin_some();
+  }
+  ASSERT_NE(nullptr, deferred_header);
+  executor.spin_some();
+  EXPECT_FALSE(responded);
+
+  Empty::Response response;
+  service->send_response(*deferred_header, response);
+  start = std::chrono::steady_clock::now();
+  while (!responded && (std::chrono::steady_clock::now() - start) < 5s) {
+    executor.spin_some();
+  }
+  EXPECT_TRUE(responded);
+}
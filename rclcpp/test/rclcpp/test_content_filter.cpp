@@ -0,0 +1,174 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "rosidl_typesupport_cpp/message_type_support.hpp"
+
+#include "rclcpp/content_filter.hpp"
+#include "rclcpp/rclcpp.hpp"
+#include "rclcpp/serialization.hpp"
+#include "rclcpp/serialized_message.hpp"
+
+#include "test_msgs/msg/basic_types.hpp"
+#include "test_msgs/msg/nested.hpp"
+#include "test_msgs/msg/strings.hpp"
+
+using namespace std::chrono_literals;
+
+template<typename MessageT>
+rclcpp::SerializedMessage
+serialize(const MessageT & message)
+{
+  rclcpp::SerializedMessage serialized_message;
+  rclcpp::Serialization<MessageT>().serialize_message(&message, &serialized_message);
+  return serialized_message;
+}
+
+template<typename MessageT>
+rclcpp::ContentFilter
+make_filter(const std::string & expression, const std::vector<std::string> & parameters = {})
+{
+  return rclcpp::ContentFilter(
+    rosidl_typesupport_cpp::get_message_type_support_handle<MessageT>(), expression, parameters);
+}
+
+// Evaluate the filter on the message and on its serialization, which must agree
+template<typename MessageT>
+bool
+matches(const rclcpp::ContentFilter & filter, const MessageT & message)
+{
+  const bool matches_message = filter.matches_ros_message(&message);
+  EXPECT_EQ(
+    matches_message, filter.matches(rclcpp::SerializedMessageView(serialize(message))));
+  return matches_message;
+}
+
+TEST(TestContentFilter, comparisons) {
+  using test_msgs::msg::Nested;
+  Nested message;
+  message.basic_types_value.bool_value = true;
+  message.basic_types_value.int32_value = -5;
+  message.basic_types_value.float64_value = 1.5;
+
+  EXPECT_TRUE(matches(make_filter<Nested>("basic_types_value.int32_value = -5"), message));
+  EXPECT_FALSE(matches(make_filter<Nested>("basic_types_value.int32_value <> -5"), message));
+  EXPECT_TRUE(
+    matches(make_filter<Nested>("basic_types_value.int32_value < %0", {"0"}), message));
+  EXPECT_TRUE(
+    matches(
+      make_filter<Nested>(
+        "basic_types_value.float64_value BETWEEN 1 AND 2 AND "
+        "basic_types_value.bool_value = TRUE"),
+      message));
+  EXPECT_FALSE(
+    matches(
+      make_filter<Nested>(
+        "NOT (basic_types_value.float64_value >= 1.5 OR basic_types_value.int32_value > 0)"),
+      message));
+}
+
+TEST(TestContentFilter, strings) {
+  using test_msgs::msg::Strings;
+  Strings message;
+  message.string_value = "sensor_front";
+
+  EXPECT_TRUE(matches(make_filter<Strings>("string_value = 'sensor_front'"), message));
+  EXPECT_TRUE(matches(make_filter<Strings>("string_value LIKE 'sensor_%'"), message));
+  EXPECT_FALSE(matches(make_filter<Strings>("string_value LIKE '%rear'"), message));
+  EXPECT_TRUE(
+    matches(
+      make_filter<Strings>(
+        "string_value = %0 OR string_value = %1", {"'sensor_rear'", "'sensor_front'"}),
+      message));
+}
+
+TEST(TestContentFilter, invalid_expressions) {
+  using test_msgs::msg::BasicTypes;
+  EXPECT_THROW(make_filter<BasicTypes>(""), std::invalid_argument);
+  EXPECT_THROW(make_filter<BasicTypes>("int32_value ="), std::invalid_argument);
+  EXPECT_THROW(make_filter<BasicTypes>("int32_value = 'text'"), std::invalid_argument);
+  EXPECT_THROW(make_filter<BasicTypes>("missing_value = 1"), std::invalid_argument);
+  EXPECT_THROW(make_filter<BasicTypes>("int32_value = %1", {"1"}), std::invalid_argument);
+  EXPECT_THROW(make_filter<BasicTypes>("(int32_value = 1"), std::invalid_argument);
+  EXPECT_THROW(make_filter<BasicTypes>("int32_value = 1 int8_value"), std::invalid_argument);
+  EXPECT_THROW(
+    make_filter<BasicTypes>("int32_value = %0", {"not a literal"}), std::invalid_argument);
+}
+
+class TestContentFilterDelivery : public ::testing::TestWithParam<bool>
+{
+protected:
+  void SetUp() override
+  {
+    rclcpp::init(0, nullptr);
+  }
+
+  void TearDown() override
+  {
+    rclcpp::shutdown();
+  }
+};
+
+TEST_P(TestContentFilterDelivery, only_matching_messages_are_delivered) {
+  const bool use_intra_process = GetParam();
+  auto node = std::make_shared<rclcpp::Node>(
+    "test_content_filter_node", "/ns",
+    rclcpp::NodeOptions().use_intra_process_comms(use_intra_process));
+
+  rclcpp::SubscriptionOptions options;
+  options.content_filter_options.filter_expression = "int32_value > %0";
+  options.content_filter_options.expression_parameters = {"2"};
+  std::vector<int32_t> received;
+  auto subscription = node->create_subscription<test_msgs::msg::BasicTypes>(
+    "content_filter_topic", 10,
+    [&received](const test_msgs::msg::BasicTypes & message) {
+      received.push_back(message.int32_value);
+    }, options);
+  if (!subscription->is_cft_enabled()) {
+    ASSERT_NE(nullptr, subscription->get_fallback_content_filter());
+  }
+  auto publisher = node->create_publisher<test_msgs::msg::BasicTypes>("content_filter_topic", 10);
+  const auto deadline = std::chrono::steady_clock::now() + 10s;
+  while (publisher->get_subscription_count() == 0 && std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::sleep_for(10ms);
+  }
+
+  for (int32_t value = 1; value <= 4; ++value) {
+    auto message = std::make_unique<test_msgs::msg::BasicTypes>();
+    message->int32_value = value;
+    publisher->publish(std::move(message));
+  }
+  rclcpp::executors::SingleThreadedExecutor executor;
+  executor.add_node(node);
+  while (received.size() < 2 && std::chrono::steady_clock::now() < deadline) {
+    executor.spin_some(10ms);
+  }
+  executor.spin_some(100ms);
+  EXPECT_EQ((std::vector<int32_t>{3, 4}), received);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  IntraProcess, TestContentFilterDelivery, ::testing::Values(false, true),
+  [](const ::testing::TestParamInfo<bool> & info) {
+    return info.param ? "intra_process" : "inter_process";
+  });
@@ -14,6 +14,7 @@
 #include <gtest/gtest.h>
 
 #include "rclcpp/context.hpp"
+#include "rclcpp/guard_condition.hpp"
 #include "rclcpp/rclcpp.hpp"
 
 TEST(TestContext, check_pre_shutdown_callback_order) {
@@ -214,3 +215,62 @@ TEST(TestContext, check_on_shutdown_callback_order_after_del) {
 
   EXPECT_TRUE(result[0] == 1 && result[1] == 3 && result[2] == 4 && result[3] == 0);
 }
+
+TEST(TestContext, keep_rcl_context_on_shutdown) {
+  auto context = std::make_shared<rclcpp::Context>();
+  rclcpp::InitOptions init_options;
+  init_options.keep_rcl_context_on_shutdown = true;
+  context->init(0, nullptr, init_options);
+  const uint64_t instance_id = rcl_context_get_instance_id(context->get_rcl_context().get());
+
+  int on_shutdown_calls = 0;
+  context->add_on_shutdown_callback([&on_shutdown_calls]() {on_shutdown_calls++;});
+  EXPECT_TRUE(context->shutdown("for test"));
+  EXPECT_FALSE(context->is_valid());
+  EXPECT_FALSE(context->shutdown("shutdown twice"));
+  EXPECT_EQ("for test", context->shutdown_reason());
+  EXPECT_EQ(1, on_shutdown_calls);
+  EXPECT_TRUE(rcl_context_is_valid(context->get_rcl_context().get()));
+
+  // The kept rcl context is reused by an equivalent init
+  context->init(0, nullptr, init_options);
+  EXPECT_TRUE(context->is_valid());
+  EXPECT_EQ("", context->shutdown_reason());
+  EXPECT_EQ(instance_id, rcl_context_get_instance_id(context->get_rcl_context().get()));
+  EXPECT_TRUE(context->shutdown("for test"));
+  EXPECT_EQ(2, on_shutdown_calls);
+
+  // But not by an init with other arguments
+  const char * argv[] = {"test", "--ros-args", "-r", "__ns:=/test"};
+  context->init(4, argv, init_options);
+  EXPECT_TRUE(context->is_valid());
+  EXPECT_NE(instance_id, rcl_context_get_instance_id(context->get_rcl_context().get()));
+  EXPECT_TRUE(context->shutdown("for test"));
+}
+
+TEST(TestContext, shutdown_guard_conditions) {
+  auto context = std::make_shared<rclcpp::Context>();
+  context->init(0, nullptr);
+  auto guard_condition = std::make_shared<rclcpp::GuardCondition>(context);
+  auto removed_guard_condition = std::make_shared<rclcpp::GuardCondition>(context);
+  auto destroyed_guard_condition = std::make_shared<rclcpp::GuardCondition>(context);
+  size_t trigger_count = 0;
+  size_t removed_trigger_count = 0;
+  guard_condition->set_on_trigger_callback(
+    [&trigger_count](size_t count) {trigger_count += count;});
+  removed_guard_condition->set_on_trigger_callback(
+    [&removed_trigger_count](size_t count) {removed_trigger_count += count;});
+
+  context->add_shutdown_guard_condition(guard_condition);
+  context->add_shutdown_guard_condition(removed_guard_condition);
+  context->add_shutdown_guard_condition(destroyed_guard_condition);
+  EXPECT_TRUE(context->remove_shutdown_guard_condition(removed_guard_condition.get()));
+  EXPECT_FALSE(context->remove_shutdown_guard_condition(removed_guard_condition.get()));
+  // Only weak references are kept
+  destroyed_guard_condition.reset();
+
+  EXPECT_TRUE(context->shutdown("for test"));
+  EXPECT_EQ(1u, trigger_count);
+  EXPECT_EQ(0u, removed_trigger_count);
+  EXPECT_TRUE(context->remove_shutdown_guard_condition(guard_condition.get()));
+}
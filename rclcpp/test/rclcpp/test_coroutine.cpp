@@ -0,0 +1,154 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+
+#include "rclcpp/experimental/coroutine.hpp"
+#include "rclcpp/rclcpp.hpp"
+
+#include "test_msgs/srv/empty.hpp"
+
+using namespace std::chrono_literals;
+using rclcpp::experimental::Task;
+
+class TestCoroutine : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    rclcpp::init(0, nullptr);
+    node = std::make_shared<rclcpp::Node>("test_coroutine_node", "/ns");
+    executor.add_node(node);
+  }
+
+  void TearDown() override
+  {
+    executor.remove_node(node);
+    node.reset();
+    rclcpp::shutdown();
+  }
+
+  /// Spin until the flag is set, return false after a timeout.
+  bool spin_until(const bool & flag)
+  {
+    const auto deadline = std::chrono::steady_clock::now() + 5s;
+    while (!flag && std::chrono::steady_clock::now() < deadline) {
+      executor.spin_once(10ms);
+    }
+    return flag;
+  }
+
+  rclcpp::Node::SharedPtr node;
+  rclcpp::executors::SingleThreadedExecutor executor;
+};
+
+// Coroutines are functions rather than lambdas, whose captures wouldn't outlive a suspension
+namespace
+{
+
+Task<int>
+add(int a, int b)
+{
+  co_return a + b;
+}
+
+Task<void>
+throw_runtime_error()
+{
+  throw std::runtime_error("task failed");
+  co_return;
+}
+
+Task<void>
+await_tasks(int & sum, bool & caught, bool & done)
+{
+  sum = co_await add(1, 2);
+  try {
+    co_await throw_runtime_error();
+  } catch (const std::runtime_error &) {
+    caught = true;
+  }
+  done = true;
+}
+
+Task<void>
+sleep_twice(rclcpp::Node::SharedPtr node, std::thread::id & resumed_thread, bool & done)
+{
+  co_await rclcpp::experimental::sleep_for(node, 0ms);
+  co_await rclcpp::experimental::sleep_for(node, 20ms);
+  resumed_thread = std::this_thread::get_id();
+  done = true;
+}
+
+Task<void>
+send_requests(
+  rclcpp::Client<test_msgs::srv::Empty>::SharedPtr client, int count, int & responses,
+  bool & done)
+{
+  for (int i = 0; i < count; ++i) {
+    auto response = co_await rclcpp::experimental::send_request(
+      client, std::make_shared<test_msgs::srv::Empty::Request>());
+    if (response) {
+      responses++;
+    }
+  }
+  done = true;
+}
+
+}  // namespace
+
+TEST_F(TestCoroutine, tasks) {
+  int sum = 0;
+  bool caught = false;
+  bool done = false;
+  rclcpp::experimental::spawn(await_tasks(sum, caught, done));
+  // Nothing is awaited, the task completes in spawn()
+  EXPECT_TRUE(done);
+  EXPECT_EQ(3, sum);
+  EXPECT_TRUE(caught);
+}
+
+TEST_F(TestCoroutine, sleep_for) {
+  bool done = false;
+  std::thread::id resumed_thread;
+  const auto start = std::chrono::steady_clock::now();
+  rclcpp::experimental::spawn(sleep_twice(node, resumed_thread, done));
+  EXPECT_FALSE(done);
+  ASSERT_TRUE(spin_until(done));
+  EXPECT_GE(std::chrono::steady_clock::now() - start, 20ms);
+  // Resumed by the executor, which runs in this thread
+  EXPECT_EQ(std::this_thread::get_id(), resumed_thread);
+}
+
+TEST_F(TestCoroutine, send_request) {
+  auto service = node->create_service<test_msgs::srv::Empty>(
+    "service",
+    [](
+      const test_msgs::srv::Empty::Request::SharedPtr,
+      test_msgs::srv::Empty::Response::SharedPtr) {});
+  auto client = node->create_client<test_msgs::srv::Empty>("service");
+  ASSERT_TRUE(client->wait_for_service(5s));
+
+  // Requests in sequence don't block the single threaded executor
+  int responses = 0;
+  bool done = false;
+  rclcpp::experimental::spawn(send_requests(client, 3, responses, done));
+  ASSERT_TRUE(spin_until(done));
+  EXPECT_EQ(3, responses);
+}
@@ -0,0 +1,139 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "rclcpp/deadline_monitor.hpp"
+#include "rclcpp/rclcpp.hpp"
+
+#include "test_msgs/msg/empty.hpp"
+
+using namespace std::chrono_literals;
+
+class TestDeadlineMonitor : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    rclcpp::init(0, nullptr);
+    node = std::make_shared<rclcpp::Node>("test_deadline_monitor_node", "/ns");
+    subscription = node->create_subscription<test_msgs::msg::Empty>(
+      "topic", 10, [](test_msgs::msg::Empty::ConstSharedPtr) {});
+  }
+
+  void TearDown() override
+  {
+    subscription.reset();
+    node.reset();
+    rclcpp::shutdown();
+  }
+
+  rclcpp::Node::SharedPtr node;
+  rclcpp::Subscription<test_msgs::msg::Empty>::SharedPtr subscription;
+};
+
+TEST_F(TestDeadlineMonitor, invalid_arguments) {
+  EXPECT_THROW(rclcpp::DeadlineMonitor(node, 0ms), std::invalid_argument);
+  EXPECT_THROW(rclcpp::DeadlineMonitor(node, 1ms, 0), std::invalid_argument);
+
+  rclcpp::DeadlineMonitor monitor(node);
+  auto callback = [](const rclcpp::DeadlineMissedInfo &) {};
+  EXPECT_THROW(monitor.watch(nullptr, 1s, callback), std::invalid_argument);
+  EXPECT_THROW(monitor.watch(subscription, 0s, callback), std::invalid_argument);
+  EXPECT_THROW(monitor.watch(subscription, 1s, nullptr), std::invalid_argument);
+  EXPECT_EQ(0u, monitor.size());
+}
+
+TEST_F(TestDeadlineMonitor, check_deadlines) {
+  rclcpp::DeadlineMonitor monitor(node, 1ms, 8);
+  std::vector<rclcpp::DeadlineMissedInfo> missed;
+  const auto start = std::chrono::steady_clock::now();
+  auto handle = monitor.watch(
+    subscription, 100ms,
+    [&missed](const rclcpp::DeadlineMissedInfo & info) {missed.push_back(info);});
+  EXPECT_EQ(1u, monitor.size());
+
+  monitor.check_deadlines(start + 50ms);
+  EXPECT_TRUE(missed.empty());
+
+  // Past a revolution of the wheel, the deadline is still found
+  monitor.check_deadlines(start + 150ms);
+  ASSERT_EQ(1u, missed.size());
+  EXPECT_EQ("/ns/topic", missed[0].topic_name);
+  EXPECT_EQ(std::chrono::nanoseconds(100ms), missed[0].period);
+  EXPECT_GE(missed[0].time_since_last_message, std::chrono::nanoseconds(100ms));
+  EXPECT_EQ(1u, missed[0].total_count);
+
+  // The next deadline is one period after the missed one was found
+  monitor.check_deadlines(start + 200ms);
+  EXPECT_EQ(1u, missed.size());
+  monitor.check_deadlines(start + 300ms);
+  ASSERT_EQ(2u, missed.size());
+  EXPECT_EQ(2u, missed[1].total_count);
+
+  monitor.unwatch(handle);
+  EXPECT_EQ(0u, monitor.size());
+  EXPECT_THROW(monitor.unwatch(handle), std::runtime_error);
+  monitor.check_deadlines(start + 1s);
+  EXPECT_EQ(2u, missed.size());
+}
+
+TEST_F(TestDeadlineMonitor, destroyed_subscription) {
+  rclcpp::DeadlineMonitor monitor(node, 1ms);
+  size_t missed = 0;
+  monitor.watch(
+    subscription, 10ms, [&missed](const rclcpp::DeadlineMissedInfo &) {missed++;});
+  subscription.reset();
+  monitor.check_deadlines(std::chrono::steady_clock::now() + 1s);
+  EXPECT_EQ(0u, missed);
+  EXPECT_EQ(0u, monitor.size());
+}
+
+TEST_F(TestDeadlineMonitor, messages_received_by_executor) {
+  auto publisher = node->create_publisher<test_msgs::msg::Empty>("topic", 10);
+  auto matched_deadline = std::chrono::steady_clock::now() + 5s;
+  while (0u == subscription->get_publisher_count() &&
+    std::chrono::steady_clock::now() < matched_deadline)
+  {
+    std::this_thread::sleep_for(10ms);
+  }
+  ASSERT_EQ(1u, subscription->get_publisher_count());
+
+  rclcpp::DeadlineMonitor monitor(node, 5ms);
+  size_t missed = 0;
+  monitor.watch(
+    subscription, 500ms, [&missed](const rclcpp::DeadlineMissedInfo &) {missed++;});
+
+  rclcpp::executors::SingleThreadedExecutor executor;
+  executor.add_node(node);
+  // The messages are recorded by the executor taking them, no deadline is missed
+  auto deadline = std::chrono::steady_clock::now() + 1s;
+  while (std::chrono::steady_clock::now() < deadline) {
+    publisher->publish(test_msgs::msg::Empty());
+    executor.spin_some(10ms);
+  }
+  EXPECT_EQ(0u, missed);
+
+  deadline = std::chrono::steady_clock::now() + 2s;
+  while (0u == missed && std::chrono::steady_clock::now() < deadline) {
+    executor.spin_once(10ms);
+  }
+  EXPECT_EQ(1u, missed);
+}
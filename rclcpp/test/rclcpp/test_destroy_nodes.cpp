@@ -0,0 +1,79 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "rclcpp/destroy_nodes.hpp"
+#include "rclcpp/rclcpp.hpp"
+
+#include "test_msgs/msg/empty.hpp"
+
+class TestDestroyNodes : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    rclcpp::init(0, nullptr);
+    for (size_t i = 0; i < 20u; ++i) {
+      auto node = std::make_shared<rclcpp::Node>("node_" + std::to_string(i), "/ns");
+      publishers.push_back(node->create_publisher<test_msgs::msg::Empty>("topic", 10));
+      // Added to the graph listener
+      graph_events.push_back(node->get_graph_event());
+      nodes.push_back(node);
+      weak_nodes.push_back(node);
+    }
+  }
+
+  void TearDown() override
+  {
+    rclcpp::shutdown();
+  }
+
+  std::vector<rclcpp::Node::SharedPtr> nodes;
+  std::vector<rclcpp::Node::WeakPtr> weak_nodes;
+  std::vector<rclcpp::Publisher<test_msgs::msg::Empty>::SharedPtr> publishers;
+  std::vector<rclcpp::Event::SharedPtr> graph_events;
+};
+
+TEST_F(TestDestroyNodes, destroy_nodes) {
+  publishers.clear();
+  auto kept_node = nodes.front();
+  rclcpp::destroy_nodes(std::move(nodes), 4);
+  EXPECT_TRUE(nodes.empty());
+
+  // Referenced elsewhere, the first node is only released
+  EXPECT_FALSE(weak_nodes.front().expired());
+  for (size_t i = 1; i < weak_nodes.size(); ++i) {
+    EXPECT_TRUE(weak_nodes[i].expired());
+  }
+  EXPECT_EQ("node_0", std::string(kept_node->get_name()));
+}
+
+TEST_F(TestDestroyNodes, destroy_nodes_after_shutdown) {
+  publishers.clear();
+  rclcpp::shutdown();
+  rclcpp::destroy_nodes(std::move(nodes));
+  for (const auto & weak_node : weak_nodes) {
+    EXPECT_TRUE(weak_node.expired());
+  }
+}
+
+TEST_F(TestDestroyNodes, no_nodes) {
+  std::vector<rclcpp::Node::SharedPtr> no_nodes;
+  EXPECT_NO_THROW(rclcpp::destroy_nodes(std::move(no_nodes)));
+}
@@ -0,0 +1,181 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "rclcpp/detail/dispatch_arena.hpp"
+#include "rclcpp/rclcpp.hpp"
+
+#include "test_msgs/msg/empty.hpp"
+
+using namespace std::chrono_literals;
+using rclcpp::detail::DispatchArena;
+using rclcpp::detail::DispatchArenaAllocator;
+using rclcpp::detail::DispatchArenaScope;
+
+TEST(TestDispatchArena, construction) {
+  EXPECT_THROW(DispatchArena(0), std::invalid_argument);
+  DispatchArena arena(1024);
+  EXPECT_EQ(1024u, arena.get_chunk_size());
+}
+
+TEST(TestDispatchArena, alignment) {
+  DispatchArena arena(1024);
+  for (size_t alignment : {1u, 2u, 8u, 16u}) {
+    void * pointer = arena.allocate(3, alignment);
+    EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(pointer) % alignment);
+    DispatchArena::deallocate(pointer);
+  }
+}
+
+TEST(TestDispatchArena, chunk_reused_after_reset) {
+  DispatchArena arena(1024);
+  void * first = arena.allocate(16, 8);
+  DispatchArena::deallocate(first);
+  arena.reset();
+  void * second = arena.allocate(16, 8);
+  EXPECT_EQ(first, second);
+  DispatchArena::deallocate(second);
+}
+
+TEST(TestDispatchArena, kept_allocation_stays_valid) {
+  auto arena = std::make_unique<DispatchArena>(1024);
+  auto kept = static_cast<uint64_t *>(arena->allocate(sizeof(uint64_t), alignof(uint64_t)));
+  *kept = 42;
+  // The chunk holding the kept allocation isn't reused after a reset
+  arena->reset();
+  auto other = static_cast<uint64_t *>(arena->allocate(sizeof(uint64_t), alignof(uint64_t)));
+  *other = 0;
+  EXPECT_EQ(42u, *kept);
+  DispatchArena::deallocate(other);
+  // Nor freed with the arena
+  arena.reset();
+  EXPECT_EQ(42u, *kept);
+  DispatchArena::deallocate(kept);
+}
+
+TEST(TestDispatchArena, large_allocations) {
+  DispatchArena arena(1024);
+  void * small = arena.allocate(16, 8);
+  void * large = arena.allocate(4096, 8);
+  std::memset(large, 0, 4096);
+  DispatchArena::deallocate(large);
+  DispatchArena::deallocate(small);
+  // The large allocation didn't use the chunk, which is reused
+  arena.reset();
+  void * reused = arena.allocate(16, 8);
+  EXPECT_EQ(small, reused);
+  DispatchArena::deallocate(reused);
+}
+
+TEST(TestDispatchArena, full_chunk) {
+  DispatchArena arena(256);
+  std::vector<void *> pointers;
+  for (int i = 0; i < 64; ++i) {
+    pointers.push_back(arena.allocate(32, 8));
+  }
+  for (void * pointer : pointers) {
+    DispatchArena::deallocate(pointer);
+  }
+}
+
+TEST(TestDispatchArena, deallocate_from_another_thread) {
+  DispatchArena arena(1024);
+  auto shared = std::allocate_shared<std::vector<int>>(
+    DispatchArenaAllocator<std::vector<int>>(&arena), 3, 1);
+  arena.reset();
+  std::thread thread([shared = std::move(shared)]() mutable {
+      EXPECT_EQ(3u, shared->size());
+      shared.reset();
+    });
+  thread.join();
+  arena.reset();
+}
+
+TEST(TestDispatchArena, scope) {
+  EXPECT_EQ(nullptr, rclcpp::detail::get_dispatch_arena());
+  {
+    DispatchArenaScope disabled(0);
+    EXPECT_EQ(nullptr, rclcpp::detail::get_dispatch_arena());
+    auto object = rclcpp::detail::make_dispatch_shared<int>(1);
+    EXPECT_EQ(1, *object);
+  }
+  DispatchArena * arena = nullptr;
+  {
+    DispatchArenaScope scope(1024);
+    arena = rclcpp::detail::get_dispatch_arena();
+    ASSERT_NE(nullptr, arena);
+    EXPECT_EQ(1024u, arena->get_chunk_size());
+    {
+      // Nested scopes keep the arena of the thread
+      DispatchArenaScope nested(2048);
+      EXPECT_EQ(arena, rclcpp::detail::get_dispatch_arena());
+    }
+    EXPECT_EQ(arena, rclcpp::detail::get_dispatch_arena());
+  }
+  EXPECT_EQ(nullptr, rclcpp::detail::get_dispatch_arena());
+  {
+    DispatchArenaScope scope(1024);
+    EXPECT_EQ(arena, rclcpp::detail::get_dispatch_arena());
+  }
+  // Each thread has its own arena
+  std::thread thread([arena]() {
+      DispatchArenaScope scope(1024);
+      EXPECT_NE(nullptr, rclcpp::detail::get_dispatch_arena());
+      EXPECT_NE(arena, rclcpp::detail::get_dispatch_arena());
+    });
+  thread.join();
+}
+
+TEST(TestDispatchArena, executor) {
+  rclcpp::init(0, nullptr);
+  {
+    auto node = std::make_shared<rclcpp::Node>("test_dispatch_arena_node", "/ns");
+    std::vector<std::shared_ptr<const test_msgs::msg::Empty>> kept;
+    size_t received = 0;
+    auto subscription = node->create_subscription<test_msgs::msg::Empty>(
+      "topic", 10,
+      [&](std::shared_ptr<const test_msgs::msg::Empty> msg) {
+        if (kept.empty()) {
+          kept.push_back(msg);
+        }
+        received++;
+      });
+    auto publisher = node->create_publisher<test_msgs::msg::Empty>("topic", 10);
+
+    rclcpp::ExecutorOptions options;
+    options.dispatch_arena_chunk_size = 4096;
+    rclcpp::executors::SingleThreadedExecutor executor(options);
+    executor.add_node(node);
+    const auto deadline = std::chrono::steady_clock::now() + 5s;
+    while (received < 3 && std::chrono::steady_clock::now() < deadline) {
+      publisher->publish(test_msgs::msg::Empty());
+      executor.spin_some(10ms);
+    }
+    EXPECT_GE(received, 3u);
+    // The executor doesn't leave its arena current
+    EXPECT_EQ(nullptr, rclcpp::detail::get_dispatch_arena());
+    executor.remove_node(node);
+    EXPECT_EQ(1u, kept.size());
+  }
+  rclcpp::shutdown();
+}
@@ -119,6 +119,24 @@ TEST_F(TestDuration, overflows) {
   EXPECT_THROW(base_d_neg * 4, std::underflow_error);
 }
 
+TEST_F(TestDuration, saturating_arithmetic) {
+  auto max = rclcpp::Duration::from_nanoseconds(std::numeric_limits<rcl_duration_value_t>::max());
+  auto min = rclcpp::Duration::from_nanoseconds(std::numeric_limits<rcl_duration_value_t>::min());
+  rclcpp::Duration one(1ns);
+
+  static_assert(noexcept(max.saturating_add(one)), "saturating_add should not throw");
+  static_assert(
+    rclcpp::detail::saturating_add(std::numeric_limits<int64_t>::max(), 1) ==
+    std::numeric_limits<int64_t>::max(), "saturating_add should be usable in constant expressions");
+
+  EXPECT_EQ(max, max.saturating_add(one));
+  EXPECT_EQ(min, min.saturating_sub(one));
+  EXPECT_EQ(max, one.saturating_sub(min));
+  EXPECT_EQ(min, min.saturating_add(min));
+  EXPECT_EQ(rclcpp::Duration(3ns), rclcpp::Duration(2ns).saturating_add(one));
+  EXPECT_EQ(rclcpp::Duration(-1ns), rclcpp::Duration(0ns).saturating_sub(one));
+}
+
 TEST_F(TestDuration, negative_duration) {
   rclcpp::Duration assignable_duration = rclcpp::Duration(0ns) - rclcpp::Duration(5, 0);
 
@@ -23,10 +23,17 @@
 #include "rclcpp/memory_strategy.hpp"
 #include "rclcpp/executors/single_threaded_executor.hpp"
 #include "rclcpp/strategies/allocator_memory_strategy.hpp"
+#include "rclcpp/subscription_base.hpp"
+#include "rosidl_typesupport_cpp/message_type_support.hpp"
+#include "test_msgs/msg/empty.hpp"
 
 #include "../mocking_utils/patch.hpp"
 #include "../utils/rclcpp_gtest_macros.hpp"
 
+using rclcpp::dynamic_typesupport::DynamicMessage;
+using rclcpp::dynamic_typesupport::DynamicMessageType;
+using rclcpp::dynamic_typesupport::DynamicSerializationSupport;
+
 // This file tests the abstract rclcpp::Executor class.  For tests of the concrete classes
 // that implement this class, please see the test/rclcpp/executors subdirectory.
 
@@ -65,6 +72,51 @@ public:
   }
 };
 
+// Subscription which asks the executor to deliver its messages as dynamic messages.
+class DynamicMessageSubscription : public rclcpp::SubscriptionBase
+{
+public:
+  explicit DynamicMessageSubscription(rclcpp::Node * node)
+  : rclcpp::SubscriptionBase(
+      node->get_node_base_interface().get(),
+      *rosidl_typesupport_cpp::get_message_type_support_handle<test_msgs::msg::Empty>(),
+      "topic",
+      rclcpp::SubscriptionOptions().to_rcl_subscription_options(rclcpp::QoS(10)),
+      rclcpp::SubscriptionOptions().event_callbacks,
+      rclcpp::SubscriptionOptions().use_default_callbacks,
+      rclcpp::DeliveredMessageKind::DYNAMIC_MESSAGE) {}
+
+  std::shared_ptr<void> create_message() override {return nullptr;}
+
+  std::shared_ptr<rclcpp::SerializedMessage>
+  create_serialized_message() override {return nullptr;}
+
+  void handle_message(std::shared_ptr<void> &, const rclcpp::MessageInfo &) override {}
+  void handle_loaned_message(void *, const rclcpp::MessageInfo &) override {}
+  void handle_serialized_message(
+    const std::shared_ptr<rclcpp::SerializedMessage> &, const rclcpp::MessageInfo &) override {}
+  void return_message(std::shared_ptr<void> &) override {}
+  void return_serialized_message(std::shared_ptr<rclcpp::SerializedMessage> &) override {}
+
+  DynamicMessageType::SharedPtr get_shared_dynamic_message_type() override {return nullptr;}
+  DynamicMessage::SharedPtr get_shared_dynamic_message() override {return nullptr;}
+  DynamicSerializationSupport::SharedPtr get_shared_dynamic_serialization_support() override
+  {
+    return nullptr;
+  }
+  DynamicMessage::SharedPtr create_dynamic_message() override
+  {
+    ++create_dynamic_message_calls;
+    return nullptr;
+  }
+  void return_dynamic_message(DynamicMessage::SharedPtr &) override {}
+  void handle_dynamic_message(
+    const DynamicMessage::SharedPtr &,
+    const rclcpp::MessageInfo &) override {}
+
+  size_t create_dynamic_message_calls = 0;
+};
+
 class TestExecutor : public ::testing::Test
 {
 public:
@@ -370,6 +422,8 @@ TEST_F(TestExecutor, spin_some_fail_wait_set_clear) {
     node->create_wall_timer(std::chrono::milliseconds(1), [&]() {});
 
   dummy.add_node(node);
+  // The first spin resizes the wait set, the following ones only clear it.
+  dummy.spin_some(std::chrono::milliseconds(1));
   auto mock = mocking_utils::patch_and_return("lib:rclcpp", rcl_wait_set_clear, RCL_RET_ERROR);
   RCLCPP_EXPECT_THROW_EQ(
     dummy.spin_some(std::chrono::milliseconds(1)),
@@ -389,6 +443,31 @@ TEST_F(TestExecutor, spin_some_fail_wait_set_resize) {
     std::runtime_error("Couldn't resize the wait set: error not set"));
 }
 
+TEST_F(TestExecutor, spin_some_reuse_wait_set) {
+  DummyExecutor dummy;
+  auto node = std::make_shared<rclcpp::Node>("node", "ns");
+  auto timer =
+    node->create_wall_timer(std::chrono::milliseconds(1), [&]() {});
+
+  dummy.add_node(node);
+  dummy.spin_some(std::chrono::milliseconds(1));
+
+  // The entities did not change, so the wait set must not be resized again.
+  {
+    auto mock = mocking_utils::patch_and_return(
+      "lib:rclcpp", rcl_wait_set_resize, RCL_RET_ERROR);
+    EXPECT_NO_THROW(dummy.spin_some(std::chrono::milliseconds(1)));
+  }
+
+  // A new entity requires the wait set to be resized.
+  auto another_timer =
+    node->create_wall_timer(std::chrono::milliseconds(1), [&]() {});
+  auto mock = mocking_utils::patch_and_return("lib:rclcpp", rcl_wait_set_resize, RCL_RET_ERROR);
+  RCLCPP_EXPECT_THROW_EQ(
+    dummy.spin_some(std::chrono::milliseconds(1)),
+    std::runtime_error("Couldn't resize the wait set: error not set"));
+}
+
 TEST_F(TestExecutor, spin_some_fail_add_handles_to_wait_set) {
   DummyExecutor dummy;
   auto node = std::make_shared<rclcpp::Node>("node", "ns");
@@ -611,3 +690,30 @@ TEST_F(TestExecutor, is_spinning) {
 
   ASSERT_TRUE(timer_called);
 }
+
+/*
+ * Delivering dynamic messages is not implemented yet, the executor must report it instead of
+ * borrowing a dynamic message from the subscription.
+ */
+TEST_F(TestExecutor, execute_subscription_dynamic_message) {
+  DummyExecutor dummy;
+  auto node = std::make_shared<rclcpp::Node>("node", "ns");
+  auto subscription = std::make_shared<DynamicMessageSubscription>(node.get());
+  node->get_node_topics_interface()->add_subscription(subscription, nullptr);
+  auto publisher = node->create_publisher<test_msgs::msg::Empty>("topic", rclcpp::QoS(10));
+  dummy.add_node(node);
+
+  publisher->publish(test_msgs::msg::Empty());
+  bool thrown = false;
+  auto start = std::chrono::steady_clock::now();
+  while (!thrown && std::chrono::steady_clock::now() - start < std::chrono::seconds(5)) {
+    try {
+      dummy.spin_some(std::chrono::milliseconds(10));
+    } catch (const std::runtime_error & e) {
+      EXPECT_STREQ("Unimplemented", e.what());
+      thrown = true;
+    }
+  }
+  EXPECT_TRUE(thrown);
+  EXPECT_EQ(0u, subscription->create_dynamic_message_calls);
+}
@@ -0,0 +1,129 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "rclcpp/fd_waitable.hpp"
+#include "rclcpp/rclcpp.hpp"
+
+using namespace std::chrono_literals;
+
+class TestFdWaitable : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    rclcpp::init(0, nullptr);
+    node = std::make_shared<rclcpp::Node>("test_fd_waitable_node", "/ns");
+    ASSERT_EQ(0, ::pipe(fds));
+  }
+
+  void TearDown() override
+  {
+    ::close(fds[0]);
+    ::close(fds[1]);
+    node.reset();
+    rclcpp::shutdown();
+  }
+
+  rclcpp::Node::SharedPtr node;
+  int fds[2]{-1, -1};
+};
+
+TEST_F(TestFdWaitable, construction) {
+  auto context = node->get_node_base_interface()->get_context();
+  EXPECT_THROW(
+    rclcpp::FdWaitable(context, -1, rclcpp::FdWaitable::Direction::Read, [](int) {}),
+    std::invalid_argument);
+  EXPECT_THROW(
+    rclcpp::FdWaitable(context, fds[0], rclcpp::FdWaitable::Direction::Read, nullptr),
+    std::invalid_argument);
+  rclcpp::FdWaitable waitable(context, fds[0], rclcpp::FdWaitable::Direction::Read, [](int) {});
+  EXPECT_EQ(fds[0], waitable.get_fd());
+}
+
+TEST_F(TestFdWaitable, read_in_executor) {
+  std::string received;
+  std::thread::id callback_thread;
+  auto waitable = std::make_shared<rclcpp::FdWaitable>(
+    node->get_node_base_interface()->get_context(), fds[0],
+    rclcpp::FdWaitable::Direction::Read,
+    [&received, &callback_thread](int fd) {
+      char buffer[16];
+      ssize_t size = ::read(fd, buffer, sizeof(buffer));
+      if (size > 0) {
+        received.append(buffer, static_cast<size_t>(size));
+      }
+      callback_thread = std::this_thread::get_id();
+    });
+  node->get_node_waitables_interface()->add_waitable(waitable, nullptr);
+  rclcpp::executors::SingleThreadedExecutor executor;
+  executor.add_node(node);
+
+  // Nothing to read yet
+  executor.spin_some(10ms);
+  EXPECT_TRUE(received.empty());
+
+  for (const std::string frame : {"ab", "cd"}) {
+    ASSERT_EQ(2, ::write(fds[1], frame.data(), frame.size()));
+    const auto deadline = std::chrono::steady_clock::now() + 5s;
+    const size_t expected_size = received.size() + frame.size();
+    while (received.size() < expected_size && std::chrono::steady_clock::now() < deadline) {
+      executor.spin_once(10ms);
+    }
+  }
+  EXPECT_EQ("abcd", received);
+  EXPECT_EQ(std::this_thread::get_id(), callback_thread);
+}
+
+TEST_F(TestFdWaitable, on_ready_callback) {
+  auto waitable = std::make_shared<rclcpp::FdWaitable>(
+    node->get_node_base_interface()->get_context(), fds[1],
+    rclcpp::FdWaitable::Direction::Write, [](int) {});
+
+  // The pipe is writable right away
+  std::atomic<size_t> events{0};
+  std::atomic<int> entity_id{-1};
+  waitable->set_on_ready_callback(
+    [&events, &entity_id](size_t number_of_events, int id) {
+      entity_id = id;
+      events += number_of_events;
+    });
+  const auto deadline = std::chrono::steady_clock::now() + 5s;
+  while (events.load() < 1u && std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::sleep_for(1ms);
+  }
+  EXPECT_EQ(1u, events.load());
+  EXPECT_EQ(static_cast<int>(rclcpp::FdWaitable::EntityType::FileDescriptor), entity_id.load());
+  EXPECT_TRUE(waitable->is_ready(nullptr));
+
+  // Not polled again until it's executed
+  auto data = waitable->take_data_by_entity_id(0);
+  ASSERT_NE(nullptr, data);
+  EXPECT_EQ(nullptr, waitable->take_data());
+  waitable->execute(data);
+  while (events.load() < 2u && std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::sleep_for(1ms);
+  }
+  EXPECT_EQ(2u, events.load());
+  waitable->clear_on_ready_callback();
+}
@@ -0,0 +1,185 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <csignal>
+#include <cstdio>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "rclcpp/flight_recorder.hpp"
+#include "rclcpp/rclcpp.hpp"
+
+using namespace std::chrono_literals;
+using rclcpp::FlightRecorder;
+using EntityType = rclcpp::FlightRecorder::EntityType;
+
+namespace
+{
+
+/// Read back what was written to a temporary file.
+std::string
+read_file(FILE * file)
+{
+  std::string contents;
+  std::rewind(file);
+  char buffer[256];
+  size_t count = 0;
+  while ((count = std::fread(buffer, 1, sizeof(buffer), file)) > 0) {
+    contents.append(buffer, count);
+  }
+  return contents;
+}
+
+}  // namespace
+
+TEST(TestFlightRecorder, invalid_size) {
+  EXPECT_THROW(FlightRecorder(0), std::invalid_argument);
+}
+
+TEST(TestFlightRecorder, records_callbacks) {
+  FlightRecorder recorder(4);
+  EXPECT_EQ(4u, recorder.get_records_per_thread());
+  EXPECT_TRUE(recorder.get_records().empty());
+
+  int entities[6];
+  for (int & entity : entities) {
+    auto token = recorder.start(EntityType::Subscription, &entity);
+    recorder.end(token);
+  }
+  auto running = recorder.start(EntityType::Timer, nullptr);
+
+  // The oldest records were overwritten
+  auto records = recorder.get_records();
+  ASSERT_EQ(4u, records.size());
+  for (size_t i = 0; i < 3; ++i) {
+    EXPECT_EQ(EntityType::Subscription, records[i].entity_type);
+    EXPECT_EQ(&entities[i + 3], records[i].entity);
+    EXPECT_EQ(0u, records[i].thread_index);
+    EXPECT_GE(records[i].duration.count(), 0);
+    EXPECT_LE(records[i].start_time, records[i + 1].start_time);
+  }
+  // Started but not ended yet
+  EXPECT_EQ(EntityType::Timer, records[3].entity_type);
+  EXPECT_LT(records[3].duration.count(), 0);
+
+  recorder.end(running);
+  EXPECT_GE(recorder.get_records()[3].duration.count(), 0);
+  // Default constructed tokens are ignored
+  recorder.end(FlightRecorder::Token());
+}
+
+TEST(TestFlightRecorder, records_per_thread) {
+  FlightRecorder recorder(8);
+  int entity = 0;
+  recorder.end(recorder.start(EntityType::Service, &entity));
+  std::thread thread([&recorder, &entity]() {
+      for (int i = 0; i < 8; ++i) {
+        recorder.end(recorder.start(EntityType::Client, &entity));
+      }
+    });
+  thread.join();
+  // The ring of this thread is reused, after the lookup of another recorder
+  FlightRecorder other(1);
+  other.end(other.start(EntityType::Waitable, &entity));
+  recorder.end(recorder.start(EntityType::Service, &entity));
+
+  auto records = recorder.get_records();
+  ASSERT_EQ(10u, records.size());
+  size_t main_thread_records = 0;
+  for (const auto & record : records) {
+    if (record.thread_index == 0) {
+      EXPECT_EQ(EntityType::Service, record.entity_type);
+      main_thread_records++;
+    } else {
+      EXPECT_EQ(1u, record.thread_index);
+      EXPECT_EQ(EntityType::Client, record.entity_type);
+    }
+  }
+  EXPECT_EQ(2u, main_thread_records);
+  EXPECT_EQ(1u, other.get_records().size());
+}
+
+TEST(TestFlightRecorder, write) {
+  FlightRecorder recorder(4);
+  int entity = 0;
+  recorder.end(recorder.start(EntityType::Subscription, &entity));
+  recorder.start(EntityType::Timer, &entity);
+
+  FILE * file = std::tmpfile();
+  ASSERT_NE(nullptr, file);
+  EXPECT_TRUE(recorder.write(fileno(file)));
+  const std::string contents = read_file(file);
+  std::fclose(file);
+  EXPECT_NE(std::string::npos, contents.find("flight recorder"));
+  EXPECT_NE(std::string::npos, contents.find(" subscription 0x"));
+  EXPECT_NE(std::string::npos, contents.find(" executing timer 0x"));
+
+  EXPECT_FALSE(recorder.write(-1));
+}
+
+#if !defined(_WIN32)
+TEST(TestFlightRecorder, write_on_signal) {
+  FlightRecorder recorder(4);
+  int entity = 0;
+  recorder.end(recorder.start(EntityType::Waitable, &entity));
+
+  FILE * file = std::tmpfile();
+  ASSERT_NE(nullptr, file);
+  ASSERT_TRUE(FlightRecorder::write_on_signal(SIGUSR1, fileno(file)));
+  std::raise(SIGUSR1);
+  const std::string contents = read_file(file);
+  std::signal(SIGUSR1, SIG_DFL);
+  std::fclose(file);
+  EXPECT_NE(std::string::npos, contents.find(" waitable 0x"));
+}
+#endif
+
+TEST(TestFlightRecorder, executor) {
+  rclcpp::init(0, nullptr);
+  {
+    rclcpp::ExecutorOptions options;
+    options.flight_recorder_size = 8;
+    rclcpp::executors::SingleThreadedExecutor executor(options);
+    ASSERT_NE(nullptr, executor.get_flight_recorder());
+    EXPECT_EQ(nullptr, rclcpp::executors::SingleThreadedExecutor().get_flight_recorder());
+
+    auto node = std::make_shared<rclcpp::Node>("test_flight_recorder_node");
+    int count = 0;
+    auto timer = node->create_wall_timer(1ms, [&count]() {count++;});
+    executor.add_node(node);
+    const auto deadline = std::chrono::steady_clock::now() + 5s;
+    while (count < 3 && std::chrono::steady_clock::now() < deadline) {
+      executor.spin_once(10ms);
+    }
+    ASSERT_GE(count, 3);
+
+    size_t timer_records = 0;
+    for (const auto & record : executor.get_flight_recorder()->get_records()) {
+      if (record.entity == static_cast<rclcpp::TimerBase *>(timer.get())) {
+        EXPECT_EQ(EntityType::Timer, record.entity_type);
+        EXPECT_GE(record.duration.count(), 0);
+        timer_records++;
+      }
+    }
+    EXPECT_GE(timer_records, 3u);
+    executor.remove_node(node);
+  }
+  rclcpp::shutdown();
+}
@@ -15,8 +15,11 @@
 
 #include <gmock/gmock.h>
 
+#include <algorithm>
+#include <atomic>
 #include <future>
 #include <memory>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -30,6 +33,7 @@
 #include "rclcpp/rclcpp.hpp"
 #include "rclcpp/serialization.hpp"
 #include "rclcpp/serialized_message.hpp"
+#include "rclcpp/serialized_message_codec.hpp"
 
 using namespace ::testing;  // NOLINT
 using namespace rclcpp;  // NOLINT
@@ -224,6 +228,184 @@ TEST_F(RclcppGenericNodeFixture, publish_loaned_msg_work)
   }
 }
 
+TEST_F(RclcppGenericNodeFixture, publish_borrowed_serialized_message)
+{
+  std::string topic_name = "/borrowed_string_topic";
+  std::string type = "test_msgs/msg/Strings";
+
+  auto publisher = node_->create_generic_publisher(topic_name, type, rclcpp::QoS(1));
+
+  auto subscriber_future_ = std::async(
+    std::launch::async, [this, topic_name, type] {
+      return subscribe_raw_messages<std::string, test_msgs::msg::Strings>(1, topic_name, type);
+    });
+
+  auto allocator = node_->get_node_options().allocator();
+  auto success = false;
+  auto ret = rcl_wait_for_subscribers(
+    node_->get_node_base_interface()->get_rcl_node_handle(),
+    &allocator,
+    topic_name.c_str(),
+    1u,
+    static_cast<rcutils_duration_value_t>(1e9),
+    &success);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  ASSERT_TRUE(success);
+
+  const auto serialized_message =
+    serialize_message<std::string, test_msgs::msg::Strings>("Hello World");
+  const auto & data = serialized_message.get_rcl_serialized_message();
+  const uint8_t * buffer = nullptr;
+  // We currently publish more messages because they can get lost
+  for (int i = 0; i < 2; ++i) {
+    auto message = publisher->borrow_serialized_message(data.buffer_length);
+    EXPECT_EQ(0u, message->size());
+    ASSERT_GE(message->capacity(), data.buffer_length);
+    auto & borrowed = message->get_rcl_serialized_message();
+    std::copy(data.buffer, data.buffer + data.buffer_length, borrowed.buffer);
+    borrowed.buffer_length = data.buffer_length;
+    publisher->publish(*message);
+    // The released message is borrowed again
+    if (buffer) {
+      EXPECT_EQ(buffer, borrowed.buffer);
+    }
+    buffer = borrowed.buffer;
+  }
+
+  auto subscribed_messages = subscriber_future_.get();
+  EXPECT_THAT(subscribed_messages, SizeIs(Not(0)));
+  EXPECT_THAT(subscribed_messages[0], StrEq("Hello World"));
+}
+
+TEST_F(RclcppGenericNodeFixture, subscriber_with_message_view)
+{
+  using namespace std::chrono_literals;
+  std::string topic_name = "/string_view_topic";
+  std::string type = "test_msgs/msg/Strings";
+
+  auto serialized_message =
+    serialize_message<std::string, test_msgs::msg::Strings>("Hello World");
+  const std::vector<uint8_t> expected_data(
+    serialized_message.get_rcl_serialized_message().buffer,
+    serialized_message.get_rcl_serialized_message().buffer + serialized_message.size());
+
+  std::vector<std::vector<uint8_t>> received_data;
+  auto subscription = node_->create_generic_subscription(
+    topic_name, type, rclcpp::QoS(10),
+    [&received_data](
+      const rclcpp::SerializedMessageView & view, const rclcpp::MessageInfo & message_info) {
+      EXPECT_FALSE(message_info.get_rmw_message_info().from_intra_process);
+      received_data.emplace_back(view.data(), view.data() + view.size());
+    });
+  auto publisher = node_->create_generic_publisher(topic_name, type, rclcpp::QoS(10));
+
+  ASSERT_TRUE(wait_for([publisher]() {return publisher->get_subscription_count() > 0;}, 5s));
+  for (size_t i = 0; i < 3; ++i) {
+    publisher->publish(serialized_message);
+  }
+  ASSERT_TRUE(wait_for([&received_data]() {return received_data.size() > 0;}, 5s));
+  for (const auto & data : received_data) {
+    EXPECT_EQ(expected_data, data);
+  }
+}
+
+namespace
+{
+
+// Inverts the bytes of the messages and appends a marker, to recognize the encoded messages
+class InvertingCodec : public rclcpp::SerializedMessageCodec
+{
+public:
+  void
+  encode(const rcl_serialized_message_t & input, rclcpp::SerializedMessage & output) override
+  {
+    output.reserve(input.buffer_length + 1);
+    auto & encoded = output.get_rcl_serialized_message();
+    for (size_t i = 0; i < input.buffer_length; ++i) {
+      encoded.buffer[i] = static_cast<uint8_t>(~input.buffer[i]);
+    }
+    encoded.buffer[input.buffer_length] = kMarker;
+    encoded.buffer_length = input.buffer_length + 1;
+    encoded_count++;
+  }
+
+  void
+  decode(const rcl_serialized_message_t & input, rclcpp::SerializedMessage & output) override
+  {
+    if (input.buffer_length == 0 || input.buffer[input.buffer_length - 1] != kMarker) {
+      throw std::runtime_error("not an encoded message");
+    }
+    output.reserve(input.buffer_length - 1);
+    auto & decoded = output.get_rcl_serialized_message();
+    for (size_t i = 0; i + 1 < input.buffer_length; ++i) {
+      decoded.buffer[i] = static_cast<uint8_t>(~input.buffer[i]);
+    }
+    decoded.buffer_length = input.buffer_length - 1;
+    decoded_count++;
+  }
+
+  static constexpr uint8_t kMarker = 0x5a;
+  std::atomic_size_t encoded_count{0};
+  std::atomic_size_t decoded_count{0};
+};
+
+}  // namespace
+
+TEST_F(RclcppGenericNodeFixture, payload_codec)
+{
+  using namespace std::chrono_literals;
+  std::string topic_name = "/payload_codec_topic";
+  std::string type = "test_msgs/msg/Strings";
+
+  auto serialized_message =
+    serialize_message<std::string, test_msgs::msg::Strings>("Hello World");
+  const std::vector<uint8_t> expected_data(
+    serialized_message.get_rcl_serialized_message().buffer,
+    serialized_message.get_rcl_serialized_message().buffer + serialized_message.size());
+  auto codec = std::make_shared<InvertingCodec>();
+
+  rclcpp::SubscriptionOptions subscription_options;
+  subscription_options.payload_codec = codec;
+  std::vector<std::vector<uint8_t>> received_data;
+  auto subscription = node_->create_generic_subscription(
+    topic_name, type, rclcpp::QoS(10),
+    [&received_data](std::shared_ptr<rclcpp::SerializedMessage> message) {
+      const auto & data = message->get_rcl_serialized_message();
+      received_data.emplace_back(data.buffer, data.buffer + data.buffer_length);
+    },
+    subscription_options);
+  // Without the codec, the encoded messages are received
+  std::vector<std::vector<uint8_t>> received_encoded_data;
+  auto raw_subscription = node_->create_generic_subscription(
+    topic_name, type, rclcpp::QoS(10),
+    [&received_encoded_data](std::shared_ptr<rclcpp::SerializedMessage> message) {
+      const auto & data = message->get_rcl_serialized_message();
+      received_encoded_data.emplace_back(data.buffer, data.buffer + data.buffer_length);
+    });
+
+  rclcpp::PublisherOptions publisher_options;
+  publisher_options.payload_codec = codec;
+  auto publisher = node_->create_generic_publisher(
+    topic_name, type, rclcpp::QoS(10), publisher_options);
+
+  ASSERT_TRUE(wait_for([publisher]() {return publisher->get_subscription_count() > 1;}, 5s));
+  publisher->publish_batch({serialized_message, serialized_message});
+  ASSERT_TRUE(
+    wait_for(
+      [&received_data, &received_encoded_data]() {
+        return received_data.size() > 1 && received_encoded_data.size() > 1;
+      }, 5s));
+  for (const auto & data : received_data) {
+    EXPECT_EQ(expected_data, data);
+  }
+  for (const auto & data : received_encoded_data) {
+    ASSERT_EQ(expected_data.size() + 1, data.size());
+    EXPECT_EQ(InvertingCodec::kMarker, data.back());
+  }
+  EXPECT_EQ(2u, codec->encoded_count.load());
+  EXPECT_EQ(received_data.size(), codec->decoded_count.load());
+}
+
 TEST_F(RclcppGenericNodeFixture, generic_subscription_uses_qos)
 {
   // If the GenericSubscription does not use the provided QoS profile,
@@ -263,3 +445,45 @@ TEST_F(RclcppGenericNodeFixture, generic_publisher_uses_qos)
   // It normally takes < 20ms, 5s chosen as "a very long time"
   ASSERT_TRUE(wait_for(connected, 5s));
 }
+
+TEST_F(RclcppGenericNodeFixture, intra_process_generic_publisher_and_subscription)
+{
+  using namespace std::chrono_literals;
+  std::string topic_name = "/intra_process_string_topic";
+  std::string type = "test_msgs/msg/Strings";
+
+  auto serialized_message =
+    serialize_message<std::string, test_msgs::msg::Strings>("Hello World");
+  const std::vector<uint8_t> expected_data(
+    serialized_message.get_rcl_serialized_message().buffer,
+    serialized_message.get_rcl_serialized_message().buffer + serialized_message.size());
+
+  rclcpp::SubscriptionOptions subscription_options;
+  subscription_options.use_intra_process_comm = rclcpp::IntraProcessSetting::Enable;
+  std::vector<std::vector<uint8_t>> received_data;
+  auto subscription = node_->create_generic_subscription(
+    topic_name, type, rclcpp::QoS(10),
+    [&received_data](
+      const rclcpp::SerializedMessageView & view, const rclcpp::MessageInfo & message_info) {
+      EXPECT_TRUE(message_info.get_rmw_message_info().from_intra_process);
+      received_data.emplace_back(view.data(), view.data() + view.size());
+    },
+    subscription_options);
+
+  rclcpp::PublisherOptions publisher_options;
+  publisher_options.use_intra_process_comm = rclcpp::IntraProcessSetting::Enable;
+  auto publisher = node_->create_generic_publisher(
+    topic_name, type, rclcpp::QoS(10), publisher_options);
+  EXPECT_EQ(1u, publisher->get_intra_process_subscription_count());
+
+  // A typed subscription still receives the messages through the middleware
+  auto typed_subscription = node_->create_subscription<test_msgs::msg::Strings>(
+    topic_name, rclcpp::QoS(10), [](std::shared_ptr<const test_msgs::msg::Strings>) {},
+    subscription_options);
+  EXPECT_EQ(1u, publisher->get_intra_process_subscription_count());
+
+  publisher->publish(serialized_message);
+  ASSERT_TRUE(wait_for([&received_data]() {return received_data.size() > 0;}, 5s));
+  ASSERT_EQ(1u, received_data.size());
+  EXPECT_EQ(expected_data, received_data[0]);
+}
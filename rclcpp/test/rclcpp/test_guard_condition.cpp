@@ -14,6 +14,8 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <chrono>
 #include <memory>
 
 #include "rclcpp/rclcpp.hpp"
@@ -182,3 +184,37 @@ TEST_F(TestGuardCondition, callback_and_waitset) {
   EXPECT_EQ(rclcpp::WaitResultKind::Ready, wait_set.wait(std::chrono::seconds(1)).kind());
   EXPECT_EQ(c1.load(), 1u);
 }
+
+/*
+ * Testing that coalesced triggers still wake up the following waits
+ */
+TEST_F(TestGuardCondition, trigger_coalescing) {
+  auto gc = std::make_shared<rclcpp::GuardCondition>();
+  gc->set_trigger_coalescing(true);
+
+  rclcpp::WaitSet wait_set;
+  wait_set.add_guard_condition(gc);
+
+  // A single trigger wakes a single wait
+  gc->trigger();
+  EXPECT_EQ(rclcpp::WaitResultKind::Ready, wait_set.wait(std::chrono::seconds(1)).kind());
+  EXPECT_EQ(rclcpp::WaitResultKind::Timeout, wait_set.wait(std::chrono::milliseconds(0)).kind());
+
+  // Triggers coalesced after the first one don't wake more waits
+  gc->trigger();
+  gc->trigger();
+  gc->trigger();
+  EXPECT_EQ(rclcpp::WaitResultKind::Ready, wait_set.wait(std::chrono::seconds(1)).kind());
+  EXPECT_EQ(rclcpp::WaitResultKind::Timeout, wait_set.wait(std::chrono::milliseconds(0)).kind());
+
+  // Triggers after a wait aren't coalesced with the ones before it
+  gc->trigger();
+  EXPECT_EQ(rclcpp::WaitResultKind::Ready, wait_set.wait(std::chrono::seconds(1)).kind());
+
+  // Callbacks are called for every trigger
+  std::atomic<size_t> count {0};
+  gc->set_on_trigger_callback([&count](size_t count_msgs) {count += count_msgs;});
+  gc->trigger();
+  gc->trigger();
+  EXPECT_EQ(2u, count.load());
+}
@@ -0,0 +1,132 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "rclcpp/experimental/huge_page_allocator.hpp"
+#include "rclcpp/rclcpp.hpp"
+
+#include "test_msgs/msg/strings.hpp"
+
+using namespace std::chrono_literals;
+using rclcpp::experimental::HugePageAllocator;
+using rclcpp::experimental::HugePageMemoryPool;
+
+TEST(TestHugePageAllocator, construct) {
+  EXPECT_THROW(HugePageAllocator<void>(nullptr), std::invalid_argument);
+
+  auto pool = std::make_shared<HugePageMemoryPool>();
+  EXPECT_GT(pool->get_huge_page_size(), 0u);
+  EXPECT_EQ(pool->get_huge_page_size() / 2, pool->get_mapping_threshold());
+  EXPECT_EQ(0u, pool->get_cached_size());
+
+  // Copies, rebound allocators and default allocators share a pool
+  HugePageAllocator<void> allocator(pool);
+  HugePageAllocator<uint8_t> rebound(allocator);
+  EXPECT_EQ(allocator, rebound);
+  EXPECT_NE(allocator, HugePageAllocator<void>());
+  EXPECT_EQ(HugePageAllocator<int>(), HugePageAllocator<double>());
+}
+
+TEST(TestHugePageAllocator, reuse_blocks) {
+  constexpr size_t size = 4 * 1024 * 1024;
+  constexpr size_t max_cached_size = 2 * size + 1024 * 1024;
+  auto pool = std::make_shared<HugePageMemoryPool>(0, max_cached_size);
+  HugePageAllocator<uint8_t> allocator(pool);
+
+  uint8_t * first = allocator.allocate(size);
+  first[0] = 1;
+  first[size - 1] = 2;
+  // The size isn't used to free a block
+  allocator.deallocate(first, 1);
+  const size_t cached_size = pool->get_cached_size();
+#ifdef __linux__
+  EXPECT_GE(cached_size, size);
+
+  // A block of the same size is reused, from the same thread so on the same node
+  uint8_t * second = allocator.allocate(size);
+  EXPECT_EQ(first, second);
+  EXPECT_EQ(0u, pool->get_cached_size());
+
+  // Blocks beyond the cache limit are unmapped
+  uint8_t * third = allocator.allocate(size);
+  uint8_t * fourth = allocator.allocate(size);
+  allocator.deallocate(second, size);
+  allocator.deallocate(third, size);
+  allocator.deallocate(fourth, size);
+  EXPECT_EQ((max_cached_size / cached_size) * cached_size, pool->get_cached_size());
+#else
+  EXPECT_EQ(0u, cached_size);
+#endif
+
+  // Small blocks aren't cached
+  const size_t cached_size_before = pool->get_cached_size();
+  uint8_t * small = allocator.allocate(16);
+  allocator.deallocate(small, 16);
+  EXPECT_EQ(cached_size_before, pool->get_cached_size());
+}
+
+TEST(TestHugePageAllocator, container) {
+  auto pool = std::make_shared<HugePageMemoryPool>();
+  HugePageAllocator<uint8_t> allocator(pool);
+  std::vector<uint8_t, HugePageAllocator<uint8_t>> data(allocator);
+  data.resize(pool->get_mapping_threshold() * 3, 42);
+  EXPECT_EQ(42, data.back());
+  data.clear();
+  data.shrink_to_fit();
+}
+
+TEST(TestHugePageAllocator, intra_process) {
+  rclcpp::init(0, nullptr);
+  {
+    auto node = std::make_shared<rclcpp::Node>(
+      "test_huge_page_allocator", rclcpp::NodeOptions().use_intra_process_comms(true));
+    auto allocator = std::make_shared<HugePageAllocator<void>>();
+
+    rclcpp::PublisherOptionsWithAllocator<HugePageAllocator<void>> publisher_options;
+    publisher_options.allocator = allocator;
+    auto publisher = node->create_publisher<test_msgs::msg::Strings>(
+      "huge_page_topic", 10, publisher_options);
+
+    rclcpp::SubscriptionOptionsWithAllocator<HugePageAllocator<void>> subscription_options;
+    subscription_options.allocator = allocator;
+    std::string received;
+    auto subscription = node->create_subscription<test_msgs::msg::Strings>(
+      "huge_page_topic", 10,
+      [&received](test_msgs::msg::Strings::ConstSharedPtr msg) {
+        received = msg->string_value;
+      },
+      subscription_options);
+
+    auto msg = std::make_unique<test_msgs::msg::Strings>();
+    msg->string_value = "intra-process";
+    publisher->publish(std::move(msg));
+
+    rclcpp::executors::SingleThreadedExecutor executor;
+    executor.add_node(node);
+    const auto deadline = std::chrono::steady_clock::now() + 5s;
+    while (received.empty() && std::chrono::steady_clock::now() < deadline) {
+      executor.spin_once(10ms);
+    }
+    EXPECT_EQ("intra-process", received);
+  }
+  rclcpp::shutdown();
+}
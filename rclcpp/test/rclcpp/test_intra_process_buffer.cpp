@@ -14,6 +14,7 @@
 
 
 #include <memory>
+#include <string>
 #include <utility>
 
 #include "gtest/gtest.h"
@@ -192,6 +193,44 @@ TEST(TestIntraProcessBuffer, shared_buffer_consume) {
   EXPECT_NE(original_message_pointer, popped_message_pointer);
 }
 
+/*
+  Consume unique_ptr from an intra-process buffer with an implementations that stores shared_ptr
+  - Request unique_ptr while the message is still shared, it's expected to be copied
+  - Request unique_ptr once the buffer holds the only reference, it's expected to be moved
+ */
+TEST(TestIntraProcessBuffer, shared_buffer_consume_unique_copy_on_write) {
+  using MessageT = std::string;
+  using Alloc = std::allocator<void>;
+  using Deleter = std::default_delete<MessageT>;
+  using SharedMessageT = std::shared_ptr<const MessageT>;
+  using UniqueMessageT = std::unique_ptr<MessageT, Deleter>;
+  using SharedIntraProcessBufferT = rclcpp::experimental::buffers::TypedIntraProcessBuffer<
+    MessageT, Alloc, Deleter, SharedMessageT>;
+
+  auto buffer_impl =
+    std::make_unique<rclcpp::experimental::buffers::RingBufferImplementation<SharedMessageT>>(2);
+
+  SharedIntraProcessBufferT intra_process_buffer(std::move(buffer_impl));
+
+  auto original_shared_msg = std::make_shared<MessageT>(1000, 'a');
+  auto original_data_pointer = original_shared_msg->data();
+
+  intra_process_buffer.add_shared(original_shared_msg);
+
+  UniqueMessageT popped_unique_msg = intra_process_buffer.consume_unique();
+
+  EXPECT_EQ(*original_shared_msg, *popped_unique_msg);
+  EXPECT_NE(original_data_pointer, popped_unique_msg->data());
+
+  intra_process_buffer.add_shared(original_shared_msg);
+  original_shared_msg.reset();
+
+  popped_unique_msg = intra_process_buffer.consume_unique();
+
+  EXPECT_EQ(MessageT(1000, 'a'), *popped_unique_msg);
+  EXPECT_EQ(original_data_pointer, popped_unique_msg->data());
+}
+
 /*
   Consume data from an intra-process buffer with an implementations that stores unique_ptr
   Messages are inserted using the same data as the implementation, i.e. unique_ptr
@@ -310,3 +349,77 @@ TEST(TestIntraProcessBuffer, available_capacity) {
   EXPECT_EQ(second_value, *popped_unique_msg);
   EXPECT_EQ(second_message_pointer, popped_message_pointer);
 }
+
+/*
+  Consume several messages at once, and read them without consuming them
+  - Buffer storing shared_ptr, consumed as shared_ptr and then as unique_ptr
+ */
+TEST(TestIntraProcessBuffer, shared_buffer_consume_n) {
+  using MessageT = char;
+  using Alloc = std::allocator<void>;
+  using Deleter = std::default_delete<MessageT>;
+  using SharedMessageT = std::shared_ptr<const MessageT>;
+  using UniqueMessageT = std::unique_ptr<MessageT, Deleter>;
+  using SharedIntraProcessBufferT = rclcpp::experimental::buffers::TypedIntraProcessBuffer<
+    MessageT, Alloc, Deleter, SharedMessageT>;
+
+  auto buffer_impl =
+    std::make_unique<rclcpp::experimental::buffers::RingBufferImplementation<SharedMessageT>>(3);
+
+  SharedIntraProcessBufferT intra_process_buffer(std::move(buffer_impl));
+
+  intra_process_buffer.add_shared(std::make_shared<char>('a'));
+  intra_process_buffer.add_shared(std::make_shared<char>('b'));
+  intra_process_buffer.add_shared(std::make_shared<char>('c'));
+
+  std::string stored;
+  intra_process_buffer.for_each_message([&stored](const char & msg) {stored.push_back(msg);});
+  EXPECT_EQ("abc", stored);
+
+  SharedMessageT shared_msgs[2];
+  EXPECT_EQ(2u, intra_process_buffer.consume_shared_n(shared_msgs, 2));
+  EXPECT_EQ('a', *shared_msgs[0]);
+  EXPECT_EQ('b', *shared_msgs[1]);
+
+  UniqueMessageT unique_msgs[2];
+  EXPECT_EQ(1u, intra_process_buffer.consume_unique_n(unique_msgs, 2));
+  EXPECT_EQ('c', *unique_msgs[0]);
+  EXPECT_FALSE(intra_process_buffer.has_data());
+}
+
+/*
+  Consume several messages at once
+  - Buffer storing unique_ptr, consumed as unique_ptr and then as shared_ptr
+ */
+TEST(TestIntraProcessBuffer, unique_buffer_consume_n) {
+  using MessageT = char;
+  using Alloc = std::allocator<void>;
+  using Deleter = std::default_delete<MessageT>;
+  using SharedMessageT = std::shared_ptr<const MessageT>;
+  using UniqueMessageT = std::unique_ptr<MessageT, Deleter>;
+  using UniqueIntraProcessBufferT = rclcpp::experimental::buffers::TypedIntraProcessBuffer<
+    MessageT, Alloc, Deleter, UniqueMessageT>;
+
+  auto buffer_impl =
+    std::make_unique<rclcpp::experimental::buffers::RingBufferImplementation<UniqueMessageT>>(3);
+
+  UniqueIntraProcessBufferT intra_process_buffer(std::move(buffer_impl));
+
+  auto original_unique_msg = std::make_unique<char>('a');
+  auto original_message_pointer = reinterpret_cast<std::uintptr_t>(original_unique_msg.get());
+  intra_process_buffer.add_unique(std::move(original_unique_msg));
+  intra_process_buffer.add_unique(std::make_unique<char>('b'));
+  intra_process_buffer.add_unique(std::make_unique<char>('c'));
+
+  UniqueMessageT unique_msgs[2];
+  EXPECT_EQ(2u, intra_process_buffer.consume_unique_n(unique_msgs, 2));
+  EXPECT_EQ('a', *unique_msgs[0]);
+  EXPECT_EQ('b', *unique_msgs[1]);
+  // Messages are moved out of the buffer, without copies
+  EXPECT_EQ(original_message_pointer, reinterpret_cast<std::uintptr_t>(unique_msgs[0].get()));
+
+  SharedMessageT shared_msgs[2];
+  EXPECT_EQ(1u, intra_process_buffer.consume_shared_n(shared_msgs, 2));
+  EXPECT_EQ('c', *shared_msgs[0]);
+  EXPECT_FALSE(intra_process_buffer.has_data());
+}
@@ -80,6 +80,18 @@ public:
     return qos_profile;
   }
 
+  bool
+  is_serialized() const
+  {
+    return serialized;
+  }
+
+  void
+  set_intra_process_subscription_count(size_t count)
+  {
+    intra_process_subscription_count = count;
+  }
+
   bool
   operator==(const rmw_gid_t & gid) const
   {
@@ -96,6 +108,8 @@ public:
 
   rclcpp::QoS qos_profile;
   std::string topic_name;
+  bool serialized = false;
+  size_t intra_process_subscription_count = 0;
   uint64_t intra_process_publisher_id_;
   IntraProcessManagerWeakPtr weak_ipm_;
 };
@@ -219,6 +233,12 @@ public:
   virtual bool
   use_take_shared_method() const = 0;
 
+  bool
+  is_serialized() const
+  {
+    return serialized;
+  }
+
   QoS
   get_actual_qos()
   {
@@ -237,6 +257,7 @@ public:
 
   rclcpp::QoS qos_profile;
   std::string topic_name;
+  bool serialized = false;
 };
 
 template<
@@ -390,6 +411,7 @@ void Publisher<T, Alloc>::publish(MessageUniquePtr msg)
      while the new publisher is expected to have 2 subscriptions (it's compatible with both QoS).
    - Remove the just added subscriptions.
    - The count for the last publisher is expected to decrease to 1.
+   - The counts cached by the publishers are expected to match.
  */
 TEST(TestIntraProcessManager, add_pub_sub) {
   using IntraProcessManagerT = rclcpp::experimental::IntraProcessManager;
@@ -441,6 +463,11 @@ TEST(TestIntraProcessManager, add_pub_sub) {
   ASSERT_EQ(1u, p1_subs);
   ASSERT_EQ(0u, p2_subs);
   ASSERT_EQ(1u, p3_subs);
+
+  // The publishers cache their count
+  EXPECT_EQ(1u, p1->intra_process_subscription_count);
+  EXPECT_EQ(0u, p2->intra_process_subscription_count);
+  EXPECT_EQ(1u, p3->intra_process_subscription_count);
 }
 
 /*
@@ -820,3 +847,93 @@ TEST(TestIntraProcessManager, lowest_available_capacity) {
   c1 = ipm->lowest_available_capacity(p1_id);
   ASSERT_EQ(history_depth - 1u, c1);
 }
+
+/*
+   This tests the delivery to subscriptions that changed after the publisher was added:
+   - Add two subscriptions requesting ownership and one not requesting ownership.
+   - Destroy one of the subscriptions requesting ownership, without removing it from ipm.
+   - Publishes a unique_ptr message.
+   - The destroyed subscription is skipped, and the other subscription requesting ownership
+     is expected to receive the original message.
+   - Remove the subscription not requesting ownership.
+   - Publishes a unique_ptr message.
+   - The remaining subscription is expected to receive the original message.
+ */
+TEST(TestIntraProcessManager, subscriptions_changed_after_publisher) {
+  using IntraProcessManagerT = rclcpp::experimental::IntraProcessManager;
+  using MessageT = rcl_interfaces::msg::Log;
+  using PublisherT = rclcpp::mock::Publisher<MessageT>;
+  using SubscriptionIntraProcessT = rclcpp::experimental::mock::SubscriptionIntraProcess<MessageT>;
+
+  auto ipm = std::make_shared<IntraProcessManagerT>();
+
+  auto p1 = std::make_shared<PublisherT>();
+  auto p1_id = ipm->add_publisher(p1);
+  p1->set_intra_process_manager(p1_id, ipm);
+
+  auto s1 = std::make_shared<SubscriptionIntraProcessT>();
+  s1->take_shared_method = true;
+  auto s1_id = ipm->add_subscription(s1);
+
+  auto s2 = std::make_shared<SubscriptionIntraProcessT>();
+  s2->take_shared_method = false;
+  ipm->add_subscription(s2);
+
+  auto s3 = std::make_shared<SubscriptionIntraProcessT>();
+  s3->take_shared_method = false;
+  ipm->add_subscription(s3);
+
+  ASSERT_EQ(3u, ipm->get_subscription_count(p1_id));
+
+  s2.reset();
+
+  auto unique_msg = std::make_unique<MessageT>();
+  auto original_message_pointer = reinterpret_cast<std::uintptr_t>(unique_msg.get());
+  p1->publish(std::move(unique_msg));
+  auto received_message_pointer_1 = s1->pop();
+  auto received_message_pointer_3 = s3->pop();
+  ASSERT_NE(0u, received_message_pointer_1);
+  ASSERT_NE(original_message_pointer, received_message_pointer_1);
+  ASSERT_EQ(original_message_pointer, received_message_pointer_3);
+
+  ipm->remove_subscription(s1_id);
+  ASSERT_EQ(2u, ipm->get_subscription_count(p1_id));
+
+  unique_msg = std::make_unique<MessageT>();
+  original_message_pointer = reinterpret_cast<std::uintptr_t>(unique_msg.get());
+  p1->publish(std::move(unique_msg));
+  received_message_pointer_1 = s1->pop();
+  received_message_pointer_3 = s3->pop();
+  ASSERT_EQ(0u, received_message_pointer_1);
+  ASSERT_EQ(original_message_pointer, received_message_pointer_3);
+}
+
+/*
+   This tests that publishers and subscriptions only match if they both use serialized messages:
+   - Add a typed publisher and a serialized publisher.
+   - Add a typed subscription and a serialized subscription.
+   - Each publisher is expected to have only one subscription, of its kind.
+ */
+TEST(TestIntraProcessManager, serialized_endpoints) {
+  using IntraProcessManagerT = rclcpp::experimental::IntraProcessManager;
+  using MessageT = rcl_interfaces::msg::Log;
+  using PublisherT = rclcpp::mock::Publisher<MessageT>;
+  using SubscriptionIntraProcessT = rclcpp::experimental::mock::SubscriptionIntraProcess<MessageT>;
+
+  auto ipm = std::make_shared<IntraProcessManagerT>();
+
+  auto typed_pub = std::make_shared<PublisherT>();
+  auto serialized_pub = std::make_shared<PublisherT>();
+  serialized_pub->serialized = true;
+  auto typed_pub_id = ipm->add_publisher(typed_pub);
+  auto serialized_pub_id = ipm->add_publisher(serialized_pub);
+
+  auto typed_sub = std::make_shared<SubscriptionIntraProcessT>();
+  auto serialized_sub = std::make_shared<SubscriptionIntraProcessT>();
+  serialized_sub->serialized = true;
+  ipm->add_subscription(typed_sub);
+  ipm->add_subscription(serialized_sub);
+
+  ASSERT_EQ(1u, ipm->get_subscription_count(typed_pub_id));
+  ASSERT_EQ(1u, ipm->get_subscription_count(serialized_pub_id));
+}
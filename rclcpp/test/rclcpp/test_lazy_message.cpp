@@ -0,0 +1,134 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include "rosidl_typesupport_cpp/message_type_support.hpp"
+
+#include "rclcpp/lazy_message.hpp"
+#include "rclcpp/rclcpp.hpp"
+#include "rclcpp/serialization.hpp"
+#include "rclcpp/serialized_field_extractor.hpp"
+
+#include "test_msgs/msg/basic_types.hpp"
+
+using namespace std::chrono_literals;
+using test_msgs::msg::BasicTypes;
+
+namespace
+{
+
+std::shared_ptr<rclcpp::SerializedMessage>
+serialize(const BasicTypes & message)
+{
+  auto serialized_message = std::make_shared<rclcpp::SerializedMessage>();
+  rclcpp::Serialization<BasicTypes>().serialize_message(&message, serialized_message.get());
+  return serialized_message;
+}
+
+rclcpp::SerializedFieldExtractor
+make_extractor(const std::string & field_path)
+{
+  return rclcpp::SerializedFieldExtractor(
+    rosidl_typesupport_cpp::get_message_type_support_handle<BasicTypes>(), field_path);
+}
+
+}  // namespace
+
+TEST(TestLazyMessage, deserialized_on_first_access) {
+  BasicTypes message;
+  message.int32_value = 7;
+  message.float64_value = 2.5;
+  const rclcpp::LazyMessage<BasicTypes> lazy_message(serialize(message));
+  EXPECT_FALSE(lazy_message.is_deserialized());
+  EXPECT_EQ(7, lazy_message.peek<int32_t>(make_extractor("int32_value")));
+  EXPECT_FALSE(lazy_message.is_deserialized());
+
+  EXPECT_EQ(message, lazy_message.get());
+  EXPECT_TRUE(lazy_message.is_deserialized());
+  // Deserialized once
+  EXPECT_EQ(&lazy_message.get(), lazy_message.get_shared().get());
+  EXPECT_EQ(2.5, lazy_message->float64_value);
+
+  const auto copy = lazy_message;
+  EXPECT_TRUE(copy.is_deserialized());
+  EXPECT_EQ(&lazy_message.get(), &copy.get());
+}
+
+TEST(TestLazyMessage, deserialized_message) {
+  auto message = std::make_shared<BasicTypes>();
+  message->uint16_value = 12u;
+  const rclcpp::LazyMessage<BasicTypes> lazy_message(
+    std::shared_ptr<const BasicTypes>(message));
+  EXPECT_TRUE(lazy_message.is_deserialized());
+  EXPECT_EQ(message.get(), &lazy_message.get());
+  // Serialized on demand
+  EXPECT_EQ(12u, lazy_message.peek<uint16_t>(make_extractor("uint16_value")));
+  EXPECT_EQ(serialize(*message)->size(), lazy_message.get_serialized_message().size());
+}
+
+TEST(TestLazyMessage, invalid_arguments) {
+  EXPECT_THROW(
+    rclcpp::LazyMessage<BasicTypes>(std::shared_ptr<const rclcpp::SerializedMessage>()),
+    std::invalid_argument);
+  EXPECT_THROW(
+    rclcpp::LazyMessage<BasicTypes>(std::shared_ptr<const BasicTypes>()),
+    std::invalid_argument);
+
+  const rclcpp::LazyMessage<BasicTypes> lazy_message(serialize(BasicTypes()));
+  EXPECT_THROW(lazy_message.peek<double>(make_extractor("int32_value")), std::invalid_argument);
+}
+
+TEST(TestLazyMessage, subscription) {
+  rclcpp::init(0, nullptr);
+  {
+    auto node = std::make_shared<rclcpp::Node>("test_lazy_message_node", "/ns");
+    const auto extractor = make_extractor("int32_value");
+    size_t received = 0;
+    size_t deserialized = 0;
+    // Only the messages with an even value are deserialized
+    auto subscription = node->create_subscription<BasicTypes>(
+      "topic", 10,
+      [&](const rclcpp::LazyMessage<BasicTypes> & message) {
+        received++;
+        if (message.peek<int32_t>(extractor) % 2 == 0) {
+          EXPECT_EQ(0, message->int32_value % 2);
+          deserialized++;
+        }
+        EXPECT_EQ(message.is_deserialized(), message.peek<int32_t>(extractor) % 2 == 0);
+      });
+    EXPECT_TRUE(subscription->is_serialized());
+    auto publisher = node->create_publisher<BasicTypes>("topic", 10);
+
+    rclcpp::executors::SingleThreadedExecutor executor;
+    executor.add_node(node);
+    BasicTypes message;
+    const auto deadline = std::chrono::steady_clock::now() + 5s;
+    // Publish until the subscription is matched and has received messages of both kinds
+    while (deserialized < 2 && std::chrono::steady_clock::now() < deadline) {
+      message.int32_value++;
+      publisher->publish(message);
+      executor.spin_some(10ms);
+    }
+    EXPECT_GE(deserialized, 2u);
+    EXPECT_GT(received, deserialized);
+  }
+  rclcpp::shutdown();
+}
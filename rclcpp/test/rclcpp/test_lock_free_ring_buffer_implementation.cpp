@@ -0,0 +1,167 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <memory>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "rclcpp/experimental/buffers/buffer_implementation_base.hpp"
+#include "rclcpp/experimental/buffers/lock_free_ring_buffer_implementation.hpp"
+
+using rclcpp::experimental::buffers::LockFreeRingBufferImplementation;
+
+/*
+   Construtctor
+ */
+TEST(TestLockFreeRingBufferImplementation, constructor) {
+  // Cannot create a buffer of size zero.
+  EXPECT_THROW(
+    LockFreeRingBufferImplementation<char> rb(0),
+    std::invalid_argument);
+
+  LockFreeRingBufferImplementation<char> rb(1);
+
+  EXPECT_EQ(false, rb.has_data());
+  EXPECT_EQ(false, rb.is_full());
+  EXPECT_EQ(1u, rb.available_capacity());
+}
+
+/*
+   Basic usage
+   - insert data and check that it has data
+   - extract data
+   - overwrite old data writing over the buffer capacity
+ */
+TEST(TestLockFreeRingBufferImplementation, basic_usage) {
+  LockFreeRingBufferImplementation<char> rb(2);
+
+  rb.enqueue('a');
+
+  EXPECT_EQ(true, rb.has_data());
+  EXPECT_EQ(false, rb.is_full());
+
+  char v = rb.dequeue();
+
+  EXPECT_EQ('a', v);
+  EXPECT_EQ(false, rb.has_data());
+  EXPECT_EQ(false, rb.is_full());
+
+  rb.enqueue('b');
+  rb.enqueue('c');
+
+  EXPECT_EQ(true, rb.has_data());
+  EXPECT_EQ(true, rb.is_full());
+  EXPECT_EQ(0u, rb.available_capacity());
+
+  rb.enqueue('d');
+
+  EXPECT_EQ(true, rb.has_data());
+  EXPECT_EQ(true, rb.is_full());
+
+  v = rb.dequeue();
+
+  EXPECT_EQ('c', v);
+  EXPECT_EQ(true, rb.has_data());
+  EXPECT_EQ(false, rb.is_full());
+
+  v = rb.dequeue();
+
+  EXPECT_EQ('d', v);
+  EXPECT_EQ(false, rb.has_data());
+  EXPECT_EQ(false, rb.is_full());
+
+  // Dequeue from an empty buffer returns a default constructed element.
+  EXPECT_EQ(char(), rb.dequeue());
+}
+
+/*
+   Clear the buffer and check that move-only types are released.
+ */
+TEST(TestLockFreeRingBufferImplementation, clear_unique_ptr) {
+  LockFreeRingBufferImplementation<std::unique_ptr<int>> rb(3);
+
+  rb.enqueue(std::make_unique<int>(1));
+  rb.enqueue(std::make_unique<int>(2));
+  EXPECT_EQ(1u, rb.available_capacity());
+
+  rb.clear();
+
+  EXPECT_EQ(false, rb.has_data());
+  EXPECT_EQ(3u, rb.available_capacity());
+  EXPECT_EQ(nullptr, rb.dequeue());
+}
+
+/*
+   Concurrent producers
+   - several threads enqueue without ever blocking
+   - the buffer never holds more than its capacity and only the newest values survive
+ */
+TEST(TestLockFreeRingBufferImplementation, concurrent_producers) {
+  constexpr size_t capacity = 16;
+  constexpr size_t num_threads = 4;
+  constexpr size_t values_per_thread = 10000;
+  LockFreeRingBufferImplementation<size_t> rb(capacity);
+
+  std::vector<std::thread> producers;
+  for (size_t t = 0; t < num_threads; ++t) {
+    producers.emplace_back(
+      [&rb, t]() {
+        for (size_t i = 1; i <= values_per_thread; ++i) {
+          rb.enqueue(t * values_per_thread + i);
+        }
+      });
+  }
+  for (auto & producer : producers) {
+    producer.join();
+  }
+
+  EXPECT_EQ(true, rb.is_full());
+  std::set<size_t> values;
+  while (rb.has_data()) {
+    values.insert(rb.dequeue());
+  }
+  EXPECT_EQ(capacity, values.size());
+  EXPECT_EQ(0u, values.count(0u));
+}
+
+/*
+   Batch dequeue, reading without consuming isn't supported
+ */
+TEST(TestLockFreeRingBufferImplementation, dequeue_n) {
+  LockFreeRingBufferImplementation<char> rb(3);
+
+  rb.enqueue('a');
+  rb.enqueue('b');
+  rb.enqueue('c');
+  EXPECT_EQ(0u, rb.get_dropped_count());
+  rb.enqueue('d');
+  EXPECT_EQ(1u, rb.get_dropped_count());
+
+  EXPECT_THROW(rb.for_each_data([](const char &) {}), std::runtime_error);
+
+  char values[2];
+  EXPECT_EQ(2u, rb.dequeue_n(values, 2));
+  EXPECT_EQ('b', values[0]);
+  EXPECT_EQ('c', values[1]);
+
+  EXPECT_EQ(1u, rb.dequeue_n(values, 2));
+  EXPECT_EQ('d', values[0]);
+  EXPECT_EQ(false, rb.has_data());
+  EXPECT_EQ(0u, rb.dequeue_n(values, 2));
+}
@@ -0,0 +1,159 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "rclcpp/lock_profiling.hpp"
+#include "rclcpp/rclcpp.hpp"
+
+using rclcpp::lock_profiling::LockStatistics;
+using rclcpp::lock_profiling::ProfiledMutex;
+
+namespace
+{
+
+/// Return the statistics of the given name, or empty statistics if it wasn't locked.
+LockStatistics
+get_statistics(const std::string & name)
+{
+  for (const auto & statistics : rclcpp::lock_profiling::get_statistics()) {
+    if (statistics.name == name) {
+      return statistics;
+    }
+  }
+  return LockStatistics();
+}
+
+}  // namespace
+
+class TestLockProfiling : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    rclcpp::lock_profiling::reset_statistics();
+  }
+
+  void TearDown() override
+  {
+    rclcpp::lock_profiling::set_enabled(false);
+    rclcpp::lock_profiling::reset_statistics();
+  }
+};
+
+TEST_F(TestLockProfiling, disabled_by_default) {
+  EXPECT_FALSE(rclcpp::lock_profiling::is_enabled());
+  ProfiledMutex<std::mutex> mutex("test_disabled");
+  {
+    std::lock_guard<ProfiledMutex<std::mutex>> lock(mutex);
+  }
+  EXPECT_EQ(0u, get_statistics("test_disabled").acquisitions);
+}
+
+TEST_F(TestLockProfiling, acquisitions_and_hold_time) {
+  rclcpp::lock_profiling::set_enabled(true);
+  ProfiledMutex<std::mutex> mutex("test_hold");
+  // The instances of a name share their statistics
+  ProfiledMutex<std::mutex> other_mutex("test_hold");
+  {
+    std::lock_guard<ProfiledMutex<std::mutex>> lock(mutex);
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  }
+  ASSERT_TRUE(other_mutex.try_lock());
+  other_mutex.unlock();
+
+  auto statistics = get_statistics("test_hold");
+  EXPECT_EQ(2u, statistics.acquisitions);
+  EXPECT_EQ(0u, statistics.contended_acquisitions);
+  EXPECT_GE(statistics.hold_time, std::chrono::milliseconds(5));
+
+  rclcpp::lock_profiling::reset_statistics();
+  EXPECT_EQ(0u, get_statistics("test_hold").acquisitions);
+}
+
+TEST_F(TestLockProfiling, lock_guard) {
+  rclcpp::lock_profiling::set_enabled(true);
+  std::mutex mutex;
+  const rclcpp::lock_profiling::LockProfile profile("test_lock_guard");
+  {
+    rclcpp::lock_profiling::ProfiledLockGuard<std::mutex> lock(mutex, profile);
+    EXPECT_FALSE(mutex.try_lock());
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  }
+  // Locking the mutex without the guard isn't measured
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+  }
+
+  auto statistics = get_statistics("test_lock_guard");
+  EXPECT_EQ(1u, statistics.acquisitions);
+  EXPECT_GE(statistics.hold_time, std::chrono::milliseconds(5));
+  ASSERT_TRUE(mutex.try_lock());
+  mutex.unlock();
+}
+
+TEST_F(TestLockProfiling, recursive_mutex) {
+  rclcpp::lock_profiling::set_enabled(true);
+  ProfiledMutex<std::recursive_mutex> mutex("test_recursive");
+  {
+    std::lock_guard<ProfiledMutex<std::recursive_mutex>> outer(mutex);
+    std::lock_guard<ProfiledMutex<std::recursive_mutex>> inner(mutex);
+  }
+  EXPECT_EQ(2u, get_statistics("test_recursive").acquisitions);
+  // The mutex isn't held anymore
+  ASSERT_TRUE(mutex.try_lock());
+  mutex.unlock();
+}
+
+TEST_F(TestLockProfiling, contention) {
+  rclcpp::lock_profiling::set_enabled(true);
+  ProfiledMutex<std::shared_timed_mutex> mutex("test_contention");
+  std::unique_lock<ProfiledMutex<std::shared_timed_mutex>> lock(mutex);
+  std::thread reader(
+    [&mutex]() {
+      std::shared_lock<ProfiledMutex<std::shared_timed_mutex>> shared_lock(mutex);
+    });
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  lock.unlock();
+  reader.join();
+
+  auto statistics = get_statistics("test_contention");
+  EXPECT_EQ(2u, statistics.acquisitions);
+  EXPECT_EQ(1u, statistics.contended_acquisitions);
+  EXPECT_GT(statistics.wait_time, std::chrono::nanoseconds(0));
+  EXPECT_EQ(statistics.wait_time, statistics.max_wait_time);
+}
+
+TEST_F(TestLockProfiling, rclcpp_mutexes) {
+  rclcpp::init(0, nullptr);
+  rclcpp::lock_profiling::set_enabled(true);
+  auto node = std::make_shared<rclcpp::Node>("test_lock_profiling_node");
+  node->declare_parameter("parameter", 1);
+  rclcpp::executors::SingleThreadedExecutor executor;
+  executor.add_node(node);
+  executor.spin_some();
+  executor.remove_node(node);
+
+  EXPECT_GT(get_statistics("rclcpp::node_interfaces::NodeParameters::mutex_").acquisitions, 0u);
+  EXPECT_GT(get_statistics("rclcpp::Executor::mutex_").acquisitions, 0u);
+  rclcpp::shutdown();
+}
@@ -124,6 +124,24 @@ TEST_F(TestLoggingMacros, test_logging_stream) {
   EXPECT_EQ("message 5", g_last_log_event.message);
 }
 
+TEST_F(TestLoggingMacros, test_logging_stream_lazy) {
+  int evaluations = 0;
+  auto evaluate = [&evaluations]() {return ++evaluations;};
+
+  // Not evaluated for messages which aren't logged
+  rcutils_logging_set_default_logger_level(RCUTILS_LOG_SEVERITY_INFO);
+  RCLCPP_DEBUG_STREAM(g_logger, "message " << evaluate());
+  EXPECT_EQ(0u, g_log_calls);
+  EXPECT_EQ(0, evaluations);
+
+  for (int i : {1, 2, 3}) {
+    RCLCPP_INFO_STREAM_ONCE(g_logger, "message " << i << " " << evaluate());
+  }
+  EXPECT_EQ(1u, g_log_calls);
+  EXPECT_EQ(1, evaluations);
+  EXPECT_EQ("message 1 1", g_last_log_event.message);
+}
+
 TEST_F(TestLoggingMacros, test_logging_once) {
   for (int i : {1, 2, 3}) {
     RCLCPP_INFO_ONCE(g_logger, "message %d", i);
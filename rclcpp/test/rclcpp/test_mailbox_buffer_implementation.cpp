@@ -0,0 +1,107 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "rclcpp/experimental/buffers/mailbox_buffer_implementation.hpp"
+
+using rclcpp::experimental::buffers::MailboxBufferImplementation;
+
+TEST(TestMailboxBufferImplementation, basic_usage) {
+  MailboxBufferImplementation<char> mb;
+  EXPECT_FALSE(mb.has_data());
+  EXPECT_EQ(1u, mb.available_capacity());
+  EXPECT_EQ('\0', mb.dequeue());
+
+  mb.enqueue('a');
+  EXPECT_TRUE(mb.has_data());
+  EXPECT_EQ(0u, mb.available_capacity());
+
+  // The stored element is replaced
+  mb.enqueue('b');
+  EXPECT_EQ(1u, mb.get_dropped_count());
+  EXPECT_EQ('b', mb.dequeue());
+  EXPECT_FALSE(mb.has_data());
+
+  mb.enqueue('c');
+  char values[2] = {'\0', '\0'};
+  EXPECT_EQ(0u, mb.dequeue_n(values, 0));
+  EXPECT_EQ(1u, mb.dequeue_n(values, 2));
+  EXPECT_EQ('c', values[0]);
+  EXPECT_EQ(0u, mb.dequeue_n(values, 2));
+
+  mb.enqueue('d');
+  mb.clear();
+  EXPECT_FALSE(mb.has_data());
+  // Taken and cleared elements aren't dropped
+  EXPECT_EQ(1u, mb.get_dropped_count());
+}
+
+TEST(TestMailboxBufferImplementation, replaced_elements_are_freed) {
+  MailboxBufferImplementation<std::shared_ptr<int>> mb;
+  auto first = std::make_shared<int>(1);
+  std::weak_ptr<int> weak_first = first;
+  mb.enqueue(std::move(first));
+  mb.enqueue(std::make_shared<int>(2));
+  EXPECT_TRUE(weak_first.expired());
+
+  auto second = mb.dequeue();
+  ASSERT_TRUE(second);
+  EXPECT_EQ(2, *second);
+  // The buffer doesn't keep a reference to the taken element
+  EXPECT_EQ(1, second.use_count());
+
+  MailboxBufferImplementation<std::unique_ptr<int>> unique_mb;
+  unique_mb.enqueue(std::make_unique<int>(3));
+  auto third = unique_mb.dequeue();
+  ASSERT_TRUE(third);
+  EXPECT_EQ(3, *third);
+  EXPECT_FALSE(unique_mb.dequeue());
+}
+
+TEST(TestMailboxBufferImplementation, concurrent_producers) {
+  MailboxBufferImplementation<std::unique_ptr<size_t>> mb;
+  constexpr size_t number_of_producers = 4;
+  constexpr size_t number_of_elements = 10000;
+
+  std::vector<std::thread> producers;
+  for (size_t p = 0; p < number_of_producers; ++p) {
+    producers.emplace_back(
+      [&mb, p]() {
+        for (size_t i = 0; i < number_of_elements; ++i) {
+          mb.enqueue(std::make_unique<size_t>(p * number_of_elements + i));
+        }
+      });
+  }
+  size_t taken = 0;
+  for (size_t i = 0; i < number_of_elements; ++i) {
+    if (mb.dequeue()) {
+      taken++;
+    }
+  }
+  for (auto & producer : producers) {
+    producer.join();
+  }
+
+  // The element left is the last one of the producer which enqueued last
+  auto last = mb.dequeue();
+  ASSERT_TRUE(last);
+  EXPECT_EQ(number_of_elements - 1, *last % number_of_elements);
+  EXPECT_LE(taken, number_of_producers * number_of_elements);
+}
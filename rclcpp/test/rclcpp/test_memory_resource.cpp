@@ -0,0 +1,131 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
+#include <string>
+
+#include "rclcpp/memory_resource.hpp"
+#include "rclcpp/rclcpp.hpp"
+
+#include "test_msgs/msg/strings.hpp"
+
+using namespace std::chrono_literals;
+
+namespace
+{
+
+// Count the allocations made from the default resource.
+class CountingMemoryResource : public std::pmr::memory_resource
+{
+public:
+  size_t allocations = 0;
+
+protected:
+  void *
+  do_allocate(size_t bytes, size_t alignment) override
+  {
+    allocations++;
+    return std::pmr::get_default_resource()->allocate(bytes, alignment);
+  }
+
+  void
+  do_deallocate(void * pointer, size_t bytes, size_t alignment) override
+  {
+    std::pmr::get_default_resource()->deallocate(pointer, bytes, alignment);
+  }
+
+  bool
+  do_is_equal(const std::pmr::memory_resource & other) const noexcept override
+  {
+    return this == &other;
+  }
+};
+
+}  // namespace
+
+TEST(TestMemoryResource, synchronized_memory_resource) {
+  EXPECT_THROW(rclcpp::pmr::SynchronizedMemoryResource(nullptr), std::invalid_argument);
+  EXPECT_THROW(rclcpp::pmr::make_allocator(nullptr), std::invalid_argument);
+
+  CountingMemoryResource upstream;
+  rclcpp::pmr::SynchronizedMemoryResource resource(&upstream);
+  EXPECT_EQ(&upstream, resource.upstream_resource());
+
+  void * pointer = resource.allocate(64, 8);
+  EXPECT_EQ(1u, upstream.allocations);
+  resource.deallocate(pointer, 64, 8);
+  EXPECT_TRUE(resource.is_equal(resource));
+  EXPECT_FALSE(resource.is_equal(upstream));
+}
+
+TEST(TestMemoryResource, rcl_allocator) {
+  // rcl frees memory without its size, so it doesn't use the memory resource
+  CountingMemoryResource resource;
+  rclcpp::pmr::PublisherOptions options;
+  options.allocator = rclcpp::pmr::make_allocator(&resource);
+  rcl_publisher_options_t rcl_options =
+    options.to_rcl_publisher_options<test_msgs::msg::Strings>(rclcpp::QoS(10));
+  EXPECT_EQ(rcl_get_default_allocator().allocate, rcl_options.allocator.allocate);
+}
+
+TEST(TestMemoryResource, intra_process_with_different_resources) {
+  rclcpp::init(0, nullptr);
+  {
+    auto node = std::make_shared<rclcpp::Node>(
+      "test_memory_resource", rclcpp::NodeOptions().use_intra_process_comms(true));
+
+    // The resources differ, the endpoint types don't
+    CountingMemoryResource publisher_resource;
+    std::pmr::monotonic_buffer_resource arena;
+    rclcpp::pmr::SynchronizedMemoryResource subscription_resource(&arena);
+
+    rclcpp::pmr::PublisherOptions publisher_options;
+    publisher_options.allocator = rclcpp::pmr::make_allocator(&publisher_resource);
+    rclcpp::pmr::Publisher<test_msgs::msg::Strings>::SharedPtr publisher =
+      node->create_publisher<test_msgs::msg::Strings>("pmr_topic", 10, publisher_options);
+
+    rclcpp::pmr::SubscriptionOptions subscription_options;
+    subscription_options.allocator = rclcpp::pmr::make_allocator(&subscription_resource);
+    std::string received;
+    rclcpp::pmr::Subscription<test_msgs::msg::Strings>::SharedPtr subscription =
+      node->create_subscription<test_msgs::msg::Strings>(
+      "pmr_topic", 10,
+      [&received](test_msgs::msg::Strings::ConstSharedPtr msg) {
+        received = msg->string_value;
+      },
+      subscription_options);
+
+    // The message published by reference is copied with the allocator of the publisher
+    test_msgs::msg::Strings msg;
+    msg.string_value = "arena";
+    const size_t allocations_before = publisher_resource.allocations;
+    publisher->publish(msg);
+    EXPECT_LT(allocations_before, publisher_resource.allocations);
+
+    rclcpp::executors::SingleThreadedExecutor executor;
+    executor.add_node(node);
+    const auto deadline = std::chrono::steady_clock::now() + 5s;
+    while (received.empty() && std::chrono::steady_clock::now() < deadline) {
+      executor.spin_once(10ms);
+    }
+    EXPECT_EQ("arena", received);
+  }
+  rclcpp::shutdown();
+}
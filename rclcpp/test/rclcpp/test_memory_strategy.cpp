@@ -530,3 +530,22 @@ TEST_F(TestMemoryStrategy, get_group_by_waitable) {
     nullptr,
     memory_strategy()->get_group_by_waitable(waitable, weak_groups_to_nodes));
 }
+
+TEST_F(TestMemoryStrategy, get_group_of_group_not_in_map) {
+  WeakCallbackGroupsToNodesMap weak_groups_to_nodes;
+  auto node = std::make_shared<rclcpp::Node>("node", "ns");
+  auto callback_group =
+    node->create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive);
+  auto timer = node->create_wall_timer(std::chrono::milliseconds(1), []() {}, callback_group);
+
+  // The timer knows its group, which is only returned once it's in the map
+  EXPECT_EQ(callback_group, timer->get_callback_group());
+  EXPECT_EQ(nullptr, memory_strategy()->get_group_by_timer(timer, weak_groups_to_nodes));
+  weak_groups_to_nodes.insert(
+    std::pair<rclcpp::CallbackGroup::WeakPtr,
+    rclcpp::node_interfaces::NodeBaseInterface::WeakPtr>(
+      rclcpp::CallbackGroup::WeakPtr(callback_group),
+      rclcpp::node_interfaces::NodeBaseInterface::WeakPtr(node->get_node_base_interface())));
+  EXPECT_EQ(callback_group, memory_strategy()->get_group_by_timer(timer, weak_groups_to_nodes));
+  EXPECT_EQ(nullptr, memory_strategy()->get_group_by_timer(nullptr, weak_groups_to_nodes));
+}
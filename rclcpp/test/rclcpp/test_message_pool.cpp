@@ -0,0 +1,89 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "rclcpp/message_pool.hpp"
+
+#include "test_msgs/msg/strings.hpp"
+
+using MessagePool = rclcpp::MessagePool<test_msgs::msg::Strings>;
+
+TEST(TestMessagePool, acquire_and_release) {
+  MessagePool pool(2);
+  EXPECT_EQ(2u, pool.size());
+  EXPECT_EQ(2u, pool.get_number_of_free_messages());
+
+  auto message = pool.acquire();
+  ASSERT_NE(nullptr, message);
+  EXPECT_EQ(1u, pool.get_number_of_free_messages());
+  message->string_value = std::string(1000, 'a');
+  const auto * pooled_message = message.get();
+  const auto * pooled_data = message->string_value.data();
+
+  // The message returns to the pool with its contents
+  message.reset();
+  EXPECT_EQ(2u, pool.get_number_of_free_messages());
+  message = pool.acquire();
+  EXPECT_EQ(pooled_message, message.get());
+  EXPECT_EQ(pooled_data, message->string_value.data());
+}
+
+TEST(TestMessagePool, exhausted_pool) {
+  MessagePool pool(1);
+  auto first = pool.acquire();
+  EXPECT_EQ(0u, pool.get_number_of_free_messages());
+
+  // A new message is allocated, but the pool doesn't grow beyond its size
+  auto second = pool.acquire();
+  ASSERT_NE(nullptr, second);
+  EXPECT_NE(first.get(), second.get());
+  first.reset();
+  second.reset();
+  EXPECT_EQ(1u, pool.get_number_of_free_messages());
+}
+
+TEST(TestMessagePool, share) {
+  MessagePool pool(1);
+  auto message = pool.acquire();
+  const auto * pooled_message = message.get();
+
+  std::shared_ptr<const test_msgs::msg::Strings> shared_message = pool.share(std::move(message));
+  EXPECT_EQ(pooled_message, shared_message.get());
+  auto other_shared_message = shared_message;
+  shared_message.reset();
+  EXPECT_EQ(0u, pool.get_number_of_free_messages());
+
+  other_shared_message.reset();
+  EXPECT_EQ(1u, pool.get_number_of_free_messages());
+  EXPECT_EQ(pooled_message, pool.acquire().get());
+}
+
+TEST(TestMessagePool, message_outlives_pool) {
+  MessagePool::MessageUniquePtr message;
+  std::shared_ptr<const test_msgs::msg::Strings> shared_message;
+  {
+    MessagePool pool(2);
+    message = pool.acquire();
+    shared_message = pool.share(pool.acquire());
+  }
+  message->string_value = "still valid";
+  EXPECT_EQ("still valid", message->string_value);
+  message.reset();
+  shared_message.reset();
+}
@@ -0,0 +1,146 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "rclcpp/rclcpp.hpp"
+
+using namespace std::chrono_literals;
+
+class TestMultiplexedParameterClient : public ::testing::Test
+{
+protected:
+  static void SetUpTestCase()
+  {
+    rclcpp::init(0, nullptr);
+  }
+
+  static void TearDownTestCase()
+  {
+    rclcpp::shutdown();
+  }
+
+  void SetUp()
+  {
+    client_node = std::make_shared<rclcpp::Node>("client", "/ns");
+    node1 = std::make_shared<rclcpp::Node>("node1", "/ns");
+    node2 = std::make_shared<rclcpp::Node>("node2", "/ns");
+    node1->declare_parameter("parameter", 1);
+    node1->declare_parameter("other_parameter", "one");
+    node2->declare_parameter("parameter", 2);
+    executor.add_node(client_node);
+    executor.add_node(node1);
+    executor.add_node(node2);
+  }
+
+  template<typename FutureT>
+  bool spin_until_complete(const FutureT & future)
+  {
+    return rclcpp::FutureReturnCode::SUCCESS == executor.spin_until_future_complete(future, 10s);
+  }
+
+  rclcpp::Node::SharedPtr client_node;
+  rclcpp::Node::SharedPtr node1;
+  rclcpp::Node::SharedPtr node2;
+  rclcpp::executors::SingleThreadedExecutor executor;
+};
+
+TEST_F(TestMultiplexedParameterClient, invalid_size) {
+  EXPECT_THROW(rclcpp::MultiplexedParameterClient(client_node, 0), std::invalid_argument);
+}
+
+TEST_F(TestMultiplexedParameterClient, get_set_parameters) {
+  rclcpp::MultiplexedParameterClient client(client_node);
+  EXPECT_EQ(0u, client.get_number_of_remote_nodes());
+  ASSERT_TRUE(client.wait_for_service("/ns/node1", 10s));
+  ASSERT_TRUE(client.wait_for_service("/ns/node2", 10s));
+
+  auto future1 = client.get_parameters("/ns/node1", {"parameter"});
+  auto future2 = client.get_parameters("/ns/node2", {"parameter"});
+  EXPECT_EQ(2u, client.get_number_of_remote_nodes());
+  ASSERT_TRUE(spin_until_complete(future1));
+  ASSERT_TRUE(spin_until_complete(future2));
+  ASSERT_EQ(1u, future1.get().size());
+  EXPECT_EQ(1, future1.get()[0].as_int());
+  ASSERT_EQ(1u, future2.get().size());
+  EXPECT_EQ(2, future2.get()[0].as_int());
+
+  auto set_future = client.set_parameters("/ns/node2", {rclcpp::Parameter("parameter", 20)});
+  ASSERT_TRUE(spin_until_complete(set_future));
+  ASSERT_EQ(1u, set_future.get().size());
+  EXPECT_TRUE(set_future.get()[0].successful);
+  EXPECT_EQ(20, node2->get_parameter("parameter").as_int());
+
+  auto list_future = client.list_parameters("/ns/node1", {"other"}, 0);
+  ASSERT_TRUE(spin_until_complete(list_future));
+  EXPECT_EQ(std::vector<std::string>{"other_parameter"}, list_future.get().names);
+
+  auto describe_future = client.describe_parameters("/ns/node1", {"parameter"});
+  ASSERT_TRUE(spin_until_complete(describe_future));
+  ASSERT_EQ(1u, describe_future.get().size());
+  EXPECT_EQ("parameter", describe_future.get()[0].name);
+}
+
+TEST_F(TestMultiplexedParameterClient, batched_get_parameters) {
+  rclcpp::MultiplexedParameterClient client(client_node);
+  ASSERT_TRUE(client.wait_for_service("/ns/node1", 10s));
+
+  // The first request is sent, the others are batched until it completes
+  int callbacks = 0;
+  auto future1 = client.get_parameters("/ns/node1", {"parameter"});
+  auto future2 = client.get_parameters(
+    "/ns/node1", {"other_parameter", "parameter"},
+    [&callbacks](std::shared_future<std::vector<rclcpp::Parameter>>) {callbacks++;});
+  auto future3 = client.get_parameters(
+    "/ns/node1", {"parameter"},
+    [&callbacks](std::shared_future<std::vector<rclcpp::Parameter>>) {callbacks++;});
+  ASSERT_TRUE(spin_until_complete(future3));
+  ASSERT_TRUE(spin_until_complete(future1));
+  EXPECT_EQ(2, callbacks);
+
+  ASSERT_EQ(1u, future1.get().size());
+  EXPECT_EQ(1, future1.get()[0].as_int());
+  ASSERT_EQ(2u, future2.get().size());
+  EXPECT_EQ("other_parameter", future2.get()[0].get_name());
+  EXPECT_EQ("one", future2.get()[0].as_string());
+  EXPECT_EQ(1, future2.get()[1].as_int());
+  ASSERT_EQ(1u, future3.get().size());
+  EXPECT_EQ("parameter", future3.get()[0].get_name());
+}
+
+TEST_F(TestMultiplexedParameterClient, evict_least_recently_used) {
+  rclcpp::MultiplexedParameterClient client(client_node, 1);
+  ASSERT_TRUE(client.wait_for_service("/ns/node1", 10s));
+
+  auto future1 = client.get_parameters("/ns/node1", {"parameter"});
+  ASSERT_TRUE(spin_until_complete(future1));
+  EXPECT_EQ(1u, client.get_number_of_remote_nodes());
+
+  // The clients of node1 are evicted, no request is in flight
+  ASSERT_TRUE(client.wait_for_service("/ns/node2", 10s));
+  EXPECT_EQ(1u, client.get_number_of_remote_nodes());
+  // Those of node2 are kept while a request is in flight
+  auto future2 = client.get_parameters("/ns/node2", {"parameter"});
+  client.service_is_ready("/ns/node1");
+  EXPECT_EQ(2u, client.get_number_of_remote_nodes());
+
+  ASSERT_TRUE(spin_until_complete(future2));
+  EXPECT_EQ(2, future2.get()[0].as_int());
+}
@@ -0,0 +1,135 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "rclcpp/rclcpp.hpp"
+
+using namespace std::chrono_literals;
+
+class TestMultiplexedParameterService : public ::testing::Test
+{
+protected:
+  static void SetUpTestCase()
+  {
+    rclcpp::init(0, nullptr);
+  }
+
+  static void TearDownTestCase()
+  {
+    rclcpp::shutdown();
+  }
+
+  void SetUp()
+  {
+    auto options = rclcpp::NodeOptions().start_parameter_services(false);
+    host = std::make_shared<rclcpp::Node>("host", "/ns", options);
+    node1 = std::make_shared<rclcpp::Node>("node1", "/ns", options);
+    node2 = std::make_shared<rclcpp::Node>("node2", "/ns", options);
+    service = std::make_shared<rclcpp::MultiplexedParameterService>(
+      host->get_node_base_interface(), host->get_node_services_interface());
+    service->add_node(node1);
+    service->add_node(node2);
+    node1->declare_parameter("parameter", 1);
+    node2->declare_parameter("parameter", 2);
+    client = std::make_shared<rclcpp::SyncParametersClient>(host);
+    ASSERT_TRUE(client->wait_for_service(1s));
+  }
+
+  rclcpp::Node::SharedPtr host;
+  rclcpp::Node::SharedPtr node1;
+  rclcpp::Node::SharedPtr node2;
+  rclcpp::MultiplexedParameterService::SharedPtr service;
+  rclcpp::SyncParametersClient::SharedPtr client;
+};
+
+TEST_F(TestMultiplexedParameterService, add_remove_node) {
+  EXPECT_THROW(service->add_node(node1), std::invalid_argument);
+  EXPECT_TRUE(service->remove_node("/ns/node1"));
+  EXPECT_FALSE(service->remove_node("/ns/node1"));
+  EXPECT_EQ(-1, client->get_parameter("/ns/node1:parameter", -1));
+  service->add_node(node1);
+  EXPECT_EQ(1, client->get_parameter("/ns/node1:parameter", -1));
+}
+
+TEST_F(TestMultiplexedParameterService, get_parameters) {
+  EXPECT_EQ(1, client->get_parameter("/ns/node1:parameter", 0));
+  EXPECT_EQ(2, client->get_parameter("/ns/node2:parameter", 0));
+  EXPECT_EQ(-1, client->get_parameter("/ns/node2:undeclared_parameter", -1));
+  EXPECT_EQ(-1, client->get_parameter("/ns/unknown:parameter", -1));
+  EXPECT_EQ(-1, client->get_parameter("parameter", -1));
+
+  const auto types = client->get_parameter_types({"/ns/node1:parameter"}, 10s);
+  ASSERT_EQ(1u, types.size());
+  EXPECT_EQ(rclcpp::ParameterType::PARAMETER_INTEGER, types[0]);
+
+  const auto descriptors = client->describe_parameters({"/ns/node2:parameter"}, 10s);
+  ASSERT_EQ(1u, descriptors.size());
+  EXPECT_EQ("/ns/node2:parameter", descriptors[0].name);
+}
+
+TEST_F(TestMultiplexedParameterService, set_parameters) {
+  const std::vector<rclcpp::Parameter> parameters = {
+    rclcpp::Parameter("/ns/node1:parameter", 10),
+    rclcpp::Parameter("/ns/node2:parameter", 20),
+    rclcpp::Parameter("/ns/unknown:parameter", 30),
+  };
+  const auto results = client->set_parameters(parameters, 10s);
+  ASSERT_EQ(3u, results.size());
+  EXPECT_TRUE(results[0].successful);
+  EXPECT_TRUE(results[1].successful);
+  EXPECT_FALSE(results[2].successful);
+  EXPECT_EQ(10, node1->get_parameter("parameter").as_int());
+  EXPECT_EQ(20, node2->get_parameter("parameter").as_int());
+
+  // Parameters of several nodes can't be set atomically
+  auto result = client->set_parameters_atomically(
+    {rclcpp::Parameter("/ns/node1:parameter", 0), rclcpp::Parameter("/ns/node2:parameter", 0)},
+    10s);
+  EXPECT_FALSE(result.successful);
+  EXPECT_EQ(10, node1->get_parameter("parameter").as_int());
+
+  result = client->set_parameters_atomically({rclcpp::Parameter("/ns/node1:parameter", 0)}, 10s);
+  EXPECT_TRUE(result.successful);
+  EXPECT_EQ(0, node1->get_parameter("parameter").as_int());
+}
+
+TEST_F(TestMultiplexedParameterService, list_parameters) {
+  auto list = client->list_parameters({"/ns/node1:"}, 0, 10s);
+  EXPECT_NE(
+    list.names.end(), std::find(list.names.begin(), list.names.end(), "/ns/node1:parameter"));
+  for (const auto & name : list.names) {
+    EXPECT_EQ(0u, name.find("/ns/node1:")) << name;
+  }
+
+  list = client->list_parameters({}, 0, 10s);
+  EXPECT_NE(
+    list.names.end(), std::find(list.names.begin(), list.names.end(), "/ns/node1:parameter"));
+  EXPECT_NE(
+    list.names.end(), std::find(list.names.begin(), list.names.end(), "/ns/node2:parameter"));
+
+  // Destroyed nodes are no longer served
+  node2.reset();
+  list = client->list_parameters({"/ns"}, 0, 10s);
+  for (const auto & name : list.names) {
+    EXPECT_EQ(0u, name.find("/ns/node1:")) << name;
+  }
+}
@@ -387,6 +387,42 @@ TEST_F(TestNode, subnode_construction_and_destruction) {
   }
 }
 
+TEST_F(TestNode, namespace_view) {
+  auto node = std::make_shared<rclcpp::Node>("my_node", "/ns");
+  auto subnode = node->create_sub_node("sub_ns");
+
+  auto view = subnode->create_namespace_view("channel");
+  EXPECT_EQ(subnode, view.get_node());
+  EXPECT_EQ("sub_ns/channel", view.get_sub_namespace());
+  EXPECT_EQ("/ns/sub_ns/channel", view.get_effective_namespace());
+  auto nested_view = view.create_namespace_view("a/");
+  EXPECT_EQ("/ns/sub_ns/channel/a", nested_view.get_effective_namespace());
+
+  // Names are extended as by a sub-node, absolute and private names are not
+  auto publisher = view.create_publisher<test_msgs::msg::Empty>("topic", 10);
+  EXPECT_STREQ("/ns/sub_ns/channel/topic", publisher->get_topic_name());
+  auto absolute_publisher = view.create_publisher<test_msgs::msg::Empty>("/topic", 10);
+  EXPECT_STREQ("/topic", absolute_publisher->get_topic_name());
+  auto private_publisher = view.create_publisher<test_msgs::msg::Empty>("~/topic", 10);
+  EXPECT_STREQ("/ns/my_node/topic", private_publisher->get_topic_name());
+  auto subscription = nested_view.create_subscription<test_msgs::msg::Empty>(
+    "topic", 10, [](test_msgs::msg::Empty::ConstSharedPtr) {});
+  EXPECT_STREQ("/ns/sub_ns/channel/a/topic", subscription->get_topic_name());
+  auto service = view.create_service<test_msgs::srv::Empty>(
+    "service",
+    [](
+      const test_msgs::srv::Empty::Request::SharedPtr,
+      test_msgs::srv::Empty::Response::SharedPtr) {});
+  EXPECT_STREQ("/ns/sub_ns/channel/service", service->get_service_name());
+  auto client = view.create_client<test_msgs::srv::Empty>("service");
+  EXPECT_STREQ("/ns/sub_ns/channel/service", client->get_service_name());
+
+  EXPECT_THROW(node->create_namespace_view(""), rclcpp::exceptions::NameValidationError);
+  EXPECT_THROW(node->create_namespace_view("/view"), rclcpp::exceptions::NameValidationError);
+  EXPECT_THROW(
+    view.create_namespace_view("invalid_ns?"), rclcpp::exceptions::InvalidNamespaceError);
+}
+
 TEST_F(TestNode, get_logger) {
   {
     auto node = std::make_shared<rclcpp::Node>("my_node");
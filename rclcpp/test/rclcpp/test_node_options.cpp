@@ -14,6 +14,7 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
 #include <memory>
 #include <string>
 #include <vector>
@@ -271,6 +272,28 @@ TEST(TestNodeOptions, bool_setters_and_getters) {
   EXPECT_FALSE(options.enable_logger_service());
   options.enable_logger_service(true);
   EXPECT_TRUE(options.enable_logger_service());
+
+  options.start_type_description_service(false);
+  EXPECT_FALSE(options.start_type_description_service());
+  options.start_type_description_service(true);
+  EXPECT_TRUE(options.start_type_description_service());
+}
+
+TEST(TestNodeOptions, lightweight) {
+  rclcpp::NodeOptions options;
+  options.enable_logger_service(true);
+  options.lightweight();
+  EXPECT_FALSE(options.start_parameter_services());
+  EXPECT_FALSE(options.start_parameter_event_publisher());
+  EXPECT_FALSE(options.enable_logger_service());
+  EXPECT_FALSE(options.start_type_description_service());
+  EXPECT_TRUE(options.use_shared_clock_subscription());
+  // Other options are left as they are
+  EXPECT_TRUE(options.enable_rosout());
+
+  rclcpp::NodeOptions copy;
+  copy = options;
+  EXPECT_FALSE(copy.start_type_description_service());
 }
 
 TEST(TestNodeOptions, parameter_event_qos) {
@@ -297,6 +320,19 @@ TEST(TestNodeOptions, parameter_event_publisher_options) {
   EXPECT_FALSE(options.parameter_event_publisher_options().use_default_callbacks);
 }
 
+TEST(TestNodeOptions, parameter_event_coalescing_period) {
+  rclcpp::NodeOptions options;
+  EXPECT_EQ(std::chrono::milliseconds(0), options.parameter_event_coalescing_period());
+  options.parameter_event_coalescing_period(std::chrono::milliseconds(100));
+  EXPECT_EQ(std::chrono::milliseconds(100), options.parameter_event_coalescing_period());
+  EXPECT_EQ(
+    std::chrono::milliseconds(100),
+    rclcpp::NodeOptions(options).parameter_event_coalescing_period());
+  EXPECT_THROW(
+    options.parameter_event_coalescing_period(std::chrono::milliseconds(-1)),
+    std::invalid_argument);
+}
+
 TEST(TestNodeOptions, set_get_allocator) {
   rclcpp::NodeOptions options;
   EXPECT_NE(nullptr, options.allocator().allocate);
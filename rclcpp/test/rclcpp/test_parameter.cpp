@@ -947,3 +947,21 @@ TEST_F(TestParameter, parameter_vector_stringification) {
     "\"string_param\": {\"type\": \"string\", \"value\": \"I'm a string\"}}",
     ss.str());
 }
+
+TEST_F(TestParameter, value_message_only_carries_set_type) {
+  // Fields of other types in the message are neither kept nor compared
+  rcl_interfaces::msg::ParameterValue value_msg;
+  value_msg.type = rcl_interfaces::msg::ParameterType::PARAMETER_INTEGER;
+  value_msg.integer_value = 42;
+  value_msg.string_value = "ignored";
+  value_msg.double_array_value = {1.0, 2.0};
+
+  const rclcpp::ParameterValue from_msg(value_msg);
+  EXPECT_EQ(rclcpp::ParameterValue(42), from_msg);
+
+  const rcl_interfaces::msg::ParameterValue round_trip = from_msg.to_value_msg();
+  EXPECT_EQ(rcl_interfaces::msg::ParameterType::PARAMETER_INTEGER, round_trip.type);
+  EXPECT_EQ(42, round_trip.integer_value);
+  EXPECT_TRUE(round_trip.string_value.empty());
+  EXPECT_TRUE(round_trip.double_array_value.empty());
+}
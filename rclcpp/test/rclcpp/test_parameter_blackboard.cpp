@@ -0,0 +1,148 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "rclcpp/rclcpp.hpp"
+
+class TestParameterBlackboard : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    rclcpp::init(0, nullptr);
+    blackboard = rclcpp::ParameterBlackboard::get_instance(
+      *rclcpp::contexts::get_global_default_context());
+  }
+
+  void TearDown() override
+  {
+    blackboard.reset();
+    rclcpp::shutdown();
+  }
+
+  rclcpp::ParameterBlackboard::SharedPtr blackboard;
+};
+
+TEST_F(TestParameterBlackboard, get_instance) {
+  EXPECT_EQ(
+    blackboard,
+    rclcpp::ParameterBlackboard::get_instance(*rclcpp::contexts::get_global_default_context()));
+
+  auto other_context = std::make_shared<rclcpp::Context>();
+  EXPECT_NE(blackboard, rclcpp::ParameterBlackboard::get_instance(*other_context));
+}
+
+TEST_F(TestParameterBlackboard, set_get_erase) {
+  EXPECT_FALSE(blackboard->has("config"));
+  EXPECT_EQ(nullptr, blackboard->get("config"));
+  EXPECT_THROW(blackboard->get_as<int64_t>("config"), std::out_of_range);
+  EXPECT_THROW(blackboard->set("config", rclcpp::ParameterValue()), std::invalid_argument);
+  EXPECT_THROW(
+    blackboard->set("config", rclcpp::ParameterBlackboard::ValueSharedPtr()),
+    std::invalid_argument);
+
+  blackboard->set("config", rclcpp::ParameterValue(std::vector<double>{1.0, 2.0}));
+  EXPECT_TRUE(blackboard->has("config"));
+  auto value = blackboard->get("config");
+  // Readers share the same value
+  EXPECT_EQ(value, blackboard->get("config"));
+  EXPECT_EQ(value, blackboard->snapshot().at("config"));
+  EXPECT_EQ(std::vector<double>({1.0, 2.0}), blackboard->get_as<std::vector<double>>("config"));
+  EXPECT_THROW(blackboard->get_as<std::string>("config"), rclcpp::ParameterTypeException);
+
+  // Setting again replaces the value, the previous snapshot is unchanged
+  blackboard->set("config", rclcpp::ParameterValue(std::vector<double>{3.0}));
+  EXPECT_EQ(std::vector<double>({1.0, 2.0}), value->get<std::vector<double>>());
+  EXPECT_EQ(std::vector<double>({3.0}), blackboard->get_as<std::vector<double>>("config"));
+
+  EXPECT_TRUE(blackboard->erase("config"));
+  EXPECT_FALSE(blackboard->erase("config"));
+  EXPECT_FALSE(blackboard->has("config"));
+  EXPECT_TRUE(blackboard->snapshot().empty());
+}
+
+TEST_F(TestParameterBlackboard, callbacks) {
+  std::vector<std::string> changes;
+  auto key_handle = blackboard->add_callback(
+    [&changes](const std::string & key, const rclcpp::ParameterBlackboard::ValueSharedPtr & value) {
+      changes.push_back(key + (value ? "=" + std::to_string(value->get<int64_t>()) : " erased"));
+    }, "a");
+  int all_count = 0;
+  auto all_handle = blackboard->add_callback(
+    [&all_count](const std::string &, const rclcpp::ParameterBlackboard::ValueSharedPtr &) {
+      all_count++;
+    });
+
+  blackboard->set("a", rclcpp::ParameterValue(1));
+  blackboard->set("b", rclcpp::ParameterValue(2));
+  blackboard->erase("a");
+  EXPECT_EQ(std::vector<std::string>({"a=1", "a erased"}), changes);
+  EXPECT_EQ(3, all_count);
+
+  // Callbacks are removed explicitly or when their handle is released
+  blackboard->remove_callback(key_handle.get());
+  all_handle.reset();
+  blackboard->set("a", rclcpp::ParameterValue(3));
+  EXPECT_EQ(2u, changes.size());
+  EXPECT_EQ(3, all_count);
+}
+
+TEST_F(TestParameterBlackboard, share_parameter) {
+  auto node = std::make_shared<rclcpp::Node>("test_parameter_blackboard_node");
+  auto node_parameters = node->get_node_parameters_interface();
+  EXPECT_THROW(
+    blackboard->share_parameter(node_parameters, "gains"),
+    rclcpp::exceptions::ParameterNotDeclaredException);
+
+  rcl_interfaces::msg::ParameterDescriptor descriptor;
+  descriptor.dynamic_typing = true;
+  node->declare_parameter("gains", std::vector<double>{1.0}, descriptor);
+  auto handle = blackboard->share_parameter(node_parameters, "gains", "shared_gains");
+  EXPECT_EQ(std::vector<double>({1.0}), blackboard->get_as<std::vector<double>>("shared_gains"));
+
+  node->set_parameter(rclcpp::Parameter("gains", std::vector<double>{2.0, 3.0}));
+  EXPECT_EQ(
+    std::vector<double>({2.0, 3.0}), blackboard->get_as<std::vector<double>>("shared_gains"));
+
+  // A failed set doesn't change the key
+  auto reject_handle = node->add_on_set_parameters_callback(
+    [](const std::vector<rclcpp::Parameter> &) {
+      rcl_interfaces::msg::SetParametersResult result;
+      result.successful = false;
+      return result;
+    });
+  node->set_parameter(rclcpp::Parameter("gains", std::vector<double>{4.0}));
+  EXPECT_EQ(
+    std::vector<double>({2.0, 3.0}), blackboard->get_as<std::vector<double>>("shared_gains"));
+  node->remove_on_set_parameters_callback(reject_handle.get());
+
+  // Unsetting the parameter undeclares it and erases the key
+  node->set_parameter(rclcpp::Parameter("gains"));
+  EXPECT_FALSE(blackboard->has("shared_gains"));
+
+  // Once the handle is removed, the key isn't updated anymore
+  node->declare_parameter("gains", std::vector<double>{5.0}, descriptor);
+  EXPECT_EQ(
+    std::vector<double>({5.0}), blackboard->get_as<std::vector<double>>("shared_gains"));
+  node_parameters->remove_post_set_parameters_callback(handle.get());
+  node->set_parameter(rclcpp::Parameter("gains", std::vector<double>{6.0}));
+  EXPECT_EQ(
+    std::vector<double>({5.0}), blackboard->get_as<std::vector<double>>("shared_gains"));
+}
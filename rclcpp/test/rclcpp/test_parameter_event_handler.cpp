@@ -16,6 +16,7 @@
 #include <memory>
 #include <string>
 #include <thread>
+#include <vector>
 
 #include "gtest/gtest.h"
 #include "rclcpp/rclcpp.hpp"
@@ -27,6 +28,18 @@ public:
   : ParameterEventHandler(node)
   {}
 
+  using ParameterEventHandler::make_node_names_content_filter;
+
+  const rclcpp::ContentFilterOptions & content_filter() const
+  {
+    return content_filter_;
+  }
+
+  bool content_filter_supported() const
+  {
+    return content_filter_supported_;
+  }
+
   void test_event(rcl_interfaces::msg::ParameterEvent::ConstSharedPtr event)
   {
     callbacks_->event_callback(*event);
@@ -438,3 +451,133 @@ TEST_F(TestNode, LastInFirstCallForParameterEventCallbacks)
   param_handler->remove_parameter_event_callback(h2);
   EXPECT_EQ(param_handler->num_event_callbacks(), 0UL);
 }
+
+TEST_F(TestNode, NodeNamesContentFilter)
+{
+  auto content_filter = TestParameterEventHandler::make_node_names_content_filter({});
+  EXPECT_TRUE(content_filter.filter_expression.empty());
+
+  content_filter = TestParameterEventHandler::make_node_names_content_filter(
+    {remote_node_name, diff_ns_name});
+  EXPECT_EQ("node = %0 OR node = %1", content_filter.filter_expression);
+  ASSERT_EQ(2u, content_filter.expression_parameters.size());
+  EXPECT_EQ("'/remote_node'", content_filter.expression_parameters[0]);
+  EXPECT_EQ("'/ns/remote_node'", content_filter.expression_parameters[1]);
+}
+
+TEST_F(TestNode, FilterByNodeNames)
+{
+  auto remote_node = std::make_shared<rclcpp::Node>("remote_node");
+  auto other_node = std::make_shared<rclcpp::Node>("other_node");
+  auto filtered_handler = std::make_shared<rclcpp::ParameterEventHandler>(
+    node, std::vector<std::string>{"remote_node"});
+
+  std::vector<std::string> received_nodes;
+  auto handle = filtered_handler->add_parameter_event_callback(
+    [&received_nodes](const rcl_interfaces::msg::ParameterEvent & event) {
+      received_nodes.push_back(event.node);
+    });
+
+  rclcpp::executors::SingleThreadedExecutor executor;
+  executor.add_node(node);
+  const auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+  while (remote_node->count_subscribers("/parameter_events") == 0 &&
+    std::chrono::steady_clock::now() < timeout)
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+
+  other_node->declare_parameter("other_parameter", 1);
+  remote_node->declare_parameter("remote_parameter", 1);
+  while (received_nodes.empty() && std::chrono::steady_clock::now() < timeout) {
+    executor.spin_some(std::chrono::milliseconds(10));
+  }
+  // Give the event of the other node a chance to be received.
+  executor.spin_some(std::chrono::milliseconds(100));
+
+  ASSERT_FALSE(received_nodes.empty());
+  for (const auto & received_node : received_nodes) {
+    EXPECT_EQ("/remote_node", received_node);
+  }
+}
+
+TEST_F(TestNode, NamespaceWildcardParameterCallbacks)
+{
+  std::vector<std::string> received;
+  auto root_cb = [&received](const rclcpp::Parameter & p) {
+      received.push_back("root:" + p.get_name());
+    };
+  auto ns_cb = [&received](const rclcpp::Parameter & p) {
+      received.push_back("ns:" + p.get_name());
+    };
+
+  auto h1 = param_handler->add_parameter_callback("my_int", root_cb, "/*");
+  auto h2 = param_handler->add_parameter_callback("my_bool", ns_cb, "/ns/*");
+
+  // Both the exact and the wildcard callbacks are called.
+  bool exact_received = false;
+  auto h3 = param_handler->add_parameter_callback(
+    "my_int", [&exact_received](const rclcpp::Parameter &) {exact_received = true;},
+    remote_node_name);
+
+  param_handler->test_event(diff_node_int);
+  param_handler->test_event(diff_ns_bool);
+  param_handler->test_event(remote_node_string);
+  EXPECT_TRUE(exact_received);
+  EXPECT_EQ((std::vector<std::string>{"root:my_int", "ns:my_bool"}), received);
+
+  // Nodes of sub namespaces are not matched.
+  received.clear();
+  auto sub_ns_bool = std::make_shared<rcl_interfaces::msg::ParameterEvent>(*diff_ns_bool);
+  sub_ns_bool->node = "/ns/sub_ns/remote_node";
+  param_handler->test_event(sub_ns_bool);
+  EXPECT_TRUE(received.empty());
+
+  param_handler->remove_parameter_callback(h1);
+  param_handler->remove_parameter_callback(h2);
+  param_handler->remove_parameter_callback(h3);
+}
+
+TEST_F(TestNode, RemoveParameterCallbackWhileCalled)
+{
+  int calls = 0;
+  rclcpp::ParameterCallbackHandle::SharedPtr h1;
+  h1 = param_handler->add_parameter_callback(
+    "my_int", [this, &calls, &h1](const rclcpp::Parameter &) {
+      ++calls;
+      param_handler->remove_parameter_callback(h1);
+    });
+
+  param_handler->test_event(same_node_int);
+  param_handler->test_event(same_node_int);
+  EXPECT_EQ(1, calls);
+}
+
+TEST_F(TestNode, ContentFilterFollowsCallbacks)
+{
+  auto cb = [](const rclcpp::Parameter &) {};
+  auto h1 = param_handler->add_parameter_callback("my_int", cb, remote_node_name);
+  if (!param_handler->content_filter_supported()) {
+    GTEST_SKIP() << "content filtering is not supported by the middleware";
+  }
+  EXPECT_EQ("node = %0", param_handler->content_filter().filter_expression);
+  auto h2 = param_handler->add_parameter_callback("my_bool", cb, diff_ns_name);
+  EXPECT_EQ("node = %0 OR node = %1", param_handler->content_filter().filter_expression);
+
+  // A wildcard needs the events of all nodes.
+  auto h3 = param_handler->add_parameter_callback("my_bool", cb, "/ns/*");
+  EXPECT_TRUE(param_handler->content_filter().filter_expression.empty());
+  param_handler->remove_parameter_callback(h3);
+  EXPECT_FALSE(param_handler->content_filter().filter_expression.empty());
+
+  // So does an event callback.
+  auto event_handle = param_handler->add_parameter_event_callback(
+    [](const rcl_interfaces::msg::ParameterEvent &) {});
+  EXPECT_TRUE(param_handler->content_filter().filter_expression.empty());
+  param_handler->remove_parameter_event_callback(event_handle);
+  EXPECT_FALSE(param_handler->content_filter().filter_expression.empty());
+
+  param_handler->remove_parameter_callback(h1);
+  param_handler->remove_parameter_callback(h2);
+  EXPECT_TRUE(param_handler->content_filter().filter_expression.empty());
+}
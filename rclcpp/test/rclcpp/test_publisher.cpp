@@ -14,9 +14,13 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
 #include <chrono>
+#include <future>
 #include <memory>
+#include <stdexcept>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -664,6 +668,286 @@ TEST_F(TestPublisher, lowest_available_ipm_capacity) {
   ASSERT_EQ(history_depth - 1u, pub_ipm_enabled->lowest_available_ipm_capacity());
 }
 
+TEST_F(TestPublisher, inter_process_subscription_matched_after_intra_process_one) {
+  initialize(rclcpp::NodeOptions().use_intra_process_comms(true));
+  using test_msgs::msg::Empty;
+
+  auto publisher = node->create_publisher<Empty>("topic", 10);
+  auto intra_process_sub = node->create_subscription<Empty>(
+    "topic", 10, [](Empty::ConstSharedPtr) {});
+  ASSERT_EQ(1u, publisher->get_intra_process_subscription_count());
+  // Only the intra-process subscription is matched, this caches the count of the middleware
+  ASSERT_NO_THROW(publisher->publish(Empty()));
+
+  bool received = false;
+  rclcpp::SubscriptionOptions options;
+  options.use_intra_process_comm = rclcpp::IntraProcessSetting::Disable;
+  auto inter_process_sub = node->create_subscription<Empty>(
+    "topic", 10, [&received](Empty::ConstSharedPtr) {received = true;}, options);
+
+  // The matched event outdates the cached count, so the message is published to the middleware
+  rclcpp::executors::SingleThreadedExecutor executor;
+  executor.add_node(node);
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+  while (!received && std::chrono::steady_clock::now() < deadline) {
+    publisher->publish(Empty());
+    executor.spin_some(std::chrono::milliseconds(10));
+  }
+  EXPECT_TRUE(received);
+}
+
+TEST_F(TestPublisher, has_any_subscribers) {
+  initialize();
+  using test_msgs::msg::Empty;
+
+  auto publisher = node->create_publisher<Empty>("topic", 10);
+  EXPECT_FALSE(publisher->has_any_subscribers());
+
+  auto subscription = node->create_subscription<Empty>(
+    "topic", 10, [](Empty::ConstSharedPtr) {});
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+  while (!publisher->has_any_subscribers() && std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  EXPECT_TRUE(publisher->has_any_subscribers());
+
+  subscription.reset();
+  while (publisher->has_any_subscribers() && std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  EXPECT_FALSE(publisher->has_any_subscribers());
+}
+
+TEST_F(TestPublisher, has_any_subscribers_intra_process) {
+  initialize(rclcpp::NodeOptions().use_intra_process_comms(true));
+  using test_msgs::msg::Empty;
+
+  auto publisher = node->create_publisher<Empty>("topic", 10);
+  EXPECT_FALSE(publisher->has_any_subscribers());
+  // Intra-process subscriptions are known as soon as they are created
+  auto subscription = node->create_subscription<Empty>(
+    "topic", 10, [](Empty::ConstSharedPtr) {});
+  EXPECT_TRUE(publisher->has_any_subscribers());
+}
+
+TEST_F(TestPublisher, publish_batch) {
+  constexpr auto history_depth = 10u;
+
+  initialize(rclcpp::NodeOptions().use_intra_process_comms(true));
+
+  std::vector<std::string> received;
+  auto sub = node->create_subscription<test_msgs::msg::Strings>(
+    "topic", history_depth,
+    [&received](std::shared_ptr<const test_msgs::msg::Strings> msg) {
+      received.push_back(msg->string_value);
+    });
+  auto publisher = node->create_publisher<test_msgs::msg::Strings>("topic", history_depth);
+  ASSERT_EQ(1, publisher->get_intra_process_subscription_count());
+
+  std::vector<test_msgs::msg::Strings> msgs(3);
+  msgs[0].string_value = "a";
+  msgs[1].string_value = "b";
+  msgs[2].string_value = "c";
+  ASSERT_NO_THROW(publisher->publish_batch(msgs));
+  ASSERT_EQ(history_depth - 3u, publisher->lowest_available_ipm_capacity());
+
+  std::vector<std::unique_ptr<test_msgs::msg::Strings>> unique_msgs;
+  unique_msgs.push_back(std::make_unique<test_msgs::msg::Strings>());
+  unique_msgs.back()->string_value = "d";
+  ASSERT_NO_THROW(publisher->publish_batch(std::move(unique_msgs)));
+  ASSERT_EQ(history_depth - 4u, publisher->lowest_available_ipm_capacity());
+
+  rclcpp::executors::SingleThreadedExecutor executor;
+  executor.add_node(node);
+  for (size_t i = 0; i < 10 && received.size() < 4u; ++i) {
+    executor.spin_some();
+  }
+  EXPECT_EQ((std::vector<std::string>{"a", "b", "c", "d"}), received);
+}
+
+TEST_F(TestPublisher, publish_from_message_pool) {
+  initialize(rclcpp::NodeOptions().use_intra_process_comms(true));
+
+  auto publisher_without_pool = node->create_publisher<test_msgs::msg::Strings>("topic", 10);
+  EXPECT_THROW(publisher_without_pool->acquire(), std::runtime_error);
+
+  std::vector<std::string> received;
+  auto sub = node->create_subscription<test_msgs::msg::Strings>(
+    "topic", 10,
+    [&received](std::shared_ptr<const test_msgs::msg::Strings> msg) {
+      received.push_back(msg->string_value);
+    });
+  rclcpp::PublisherOptions options;
+  options.message_pool_size = 1;
+  auto publisher = node->create_publisher<test_msgs::msg::Strings>("topic", 10, options);
+
+  auto msg = publisher->acquire();
+  const test_msgs::msg::Strings * pooled_msg = msg.get();
+  msg->string_value = "a";
+  ASSERT_NO_THROW(publisher->publish(std::move(msg)));
+
+  rclcpp::executors::SingleThreadedExecutor executor;
+  executor.add_node(node);
+  for (size_t i = 0; i < 10 && received.empty(); ++i) {
+    executor.spin_some();
+  }
+  EXPECT_EQ(std::vector<std::string>{"a"}, received);
+
+  // Once released by the subscription, the message returned to the pool keeping its contents
+  msg = publisher->acquire();
+  EXPECT_EQ(pooled_msg, msg.get());
+  EXPECT_EQ("a", msg->string_value);
+}
+
+TEST_F(TestPublisher, async_publish) {
+  initialize();
+  rclcpp::PublisherOptions options;
+  options.async_publish.queue_size = 2;
+  auto publisher = node->create_publisher<test_msgs::msg::Strings>("topic", 10, options);
+
+  std::vector<std::string> received;
+  auto sub = node->create_subscription<test_msgs::msg::Strings>(
+    "topic", 10,
+    [&received](std::shared_ptr<const test_msgs::msg::Strings> msg) {
+      received.push_back(msg->string_value);
+    });
+  test_msgs::msg::Strings msg;
+  msg.string_value = "a";
+  ASSERT_NO_THROW(publisher->publish(msg));
+  EXPECT_TRUE(publisher->wait_for_async_publish(std::chrono::seconds(5)));
+
+  rclcpp::executors::SingleThreadedExecutor executor;
+  executor.add_node(node);
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+  while (received.empty() && std::chrono::steady_clock::now() < deadline) {
+    executor.spin_some(std::chrono::milliseconds(10));
+  }
+  EXPECT_EQ(std::vector<std::string>{"a"}, received);
+
+  // Block the publisher thread in its first publication, to fill the queue
+  std::promise<void> release;
+  std::shared_future<void> released = release.get_future().share();
+  std::atomic_bool publishing{false};
+  std::vector<std::string> published;
+  auto mock = mocking_utils::patch(
+    "lib:rclcpp", rcl_publish,
+    [&](const rcl_publisher_t *, const void * ros_message, rmw_publisher_allocation_t *) {
+      publishing = true;
+      released.wait();
+      published.push_back(static_cast<const test_msgs::msg::Strings *>(ros_message)->string_value);
+      return RCL_RET_OK;
+    });
+  msg.string_value = "b";
+  publisher->publish(msg);
+  while (!publishing) {
+    std::this_thread::yield();
+  }
+  for (const char * value : {"c", "d", "e"}) {
+    msg.string_value = value;
+    publisher->publish(msg);
+  }
+  EXPECT_EQ(1u, publisher->get_async_publish_dropped_count());
+  EXPECT_FALSE(publisher->wait_for_async_publish(std::chrono::milliseconds(10)));
+
+  release.set_value();
+  EXPECT_TRUE(publisher->wait_for_async_publish(std::chrono::seconds(5)));
+  EXPECT_EQ((std::vector<std::string>{"b", "d", "e"}), published);
+}
+
+TEST_F(TestPublisher, max_rate) {
+  initialize();
+  rclcpp::PublisherOptions options;
+  options.max_rate = -1.0;
+  EXPECT_THROW(
+    node->create_publisher<test_msgs::msg::Empty>("topic", 10, options), std::invalid_argument);
+
+  // A single message is published during the test
+  options.max_rate = 0.1;
+  auto publisher = node->create_publisher<test_msgs::msg::Empty>("topic", 10, options);
+  size_t publications = 0;
+  auto mock = mocking_utils::patch(
+    "lib:rclcpp", rcl_publish,
+    [&publications](const rcl_publisher_t *, const void *, rmw_publisher_allocation_t *) {
+      publications++;
+      return RCL_RET_OK;
+    });
+  for (size_t i = 0; i < 3u; ++i) {
+    publisher->publish(test_msgs::msg::Empty());
+  }
+  publisher->publish(std::make_unique<test_msgs::msg::Empty>());
+  EXPECT_EQ(1u, publications);
+}
+
+TEST_F(TestPublisher, async_publish_max_rate) {
+  initialize();
+  rclcpp::PublisherOptions options;
+  options.async_publish.queue_size = 10;
+  options.max_rate = 0.1;
+  auto publisher = node->create_publisher<test_msgs::msg::Empty>("topic", 10, options);
+  std::atomic<size_t> publications{0};
+  auto mock = mocking_utils::patch(
+    "lib:rclcpp", rcl_publish,
+    [&publications](const rcl_publisher_t *, const void *, rmw_publisher_allocation_t *) {
+      publications++;
+      return RCL_RET_OK;
+    });
+
+  // The rate limiter is checked once per message, the first message is published
+  publisher->publish(test_msgs::msg::Empty());
+  EXPECT_TRUE(publisher->wait_for_async_publish(std::chrono::seconds(5)));
+  EXPECT_EQ(1u, publications.load());
+
+  // The next ones are decimated, whether they are published by copy or by unique pointer
+  for (size_t i = 0; i < 3u; ++i) {
+    publisher->publish(test_msgs::msg::Empty());
+  }
+  publisher->publish(std::make_unique<test_msgs::msg::Empty>());
+  EXPECT_TRUE(publisher->wait_for_async_publish(std::chrono::seconds(5)));
+  EXPECT_EQ(1u, publications.load());
+  EXPECT_EQ(0u, publisher->get_async_publish_dropped_count());
+}
+
+TEST_F(TestPublisher, intra_process_across_contexts) {
+  auto create_context = [](bool share_intra_process) {
+      rclcpp::InitOptions init_options;
+      init_options.share_intra_process_across_contexts = share_intra_process;
+      auto context = std::make_shared<rclcpp::Context>();
+      context->init(0, nullptr, init_options);
+      return context;
+    };
+  auto shared_context_1 = create_context(true);
+  auto shared_context_2 = create_context(true);
+  auto isolated_context = create_context(false);
+
+  auto create_node = [](const std::string & name, rclcpp::Context::SharedPtr context) {
+      return std::make_shared<rclcpp::Node>(
+        name, "ns", rclcpp::NodeOptions().context(context).use_intra_process_comms(true));
+    };
+  auto publisher_node = create_node("publisher_node", shared_context_1);
+  auto shared_node = create_node("shared_node", shared_context_2);
+  auto isolated_node = create_node("isolated_node", isolated_context);
+
+  auto do_nothing = [](std::shared_ptr<const test_msgs::msg::Strings>) {};
+  auto publisher = publisher_node->create_publisher<test_msgs::msg::Strings>("topic", 10);
+  auto shared_sub = shared_node->create_subscription<test_msgs::msg::Strings>(
+    "topic", 10, do_nothing);
+  auto isolated_sub = isolated_node->create_subscription<test_msgs::msg::Strings>(
+    "topic", 10, do_nothing);
+
+  // Only the subscription of the context sharing intra-process communication is matched
+  EXPECT_EQ(1u, publisher->get_intra_process_subscription_count());
+
+  publisher.reset();
+  shared_sub.reset();
+  isolated_sub.reset();
+  publisher_node.reset();
+  shared_node.reset();
+  isolated_node.reset();
+  shared_context_1->shutdown("test finished");
+  shared_context_2->shutdown("test finished");
+  isolated_context->shutdown("test finished");
+}
+
 INSTANTIATE_TEST_SUITE_P(
   TestWaitForAllAckedWithParm,
   TestPublisherWaitForAllAcked,
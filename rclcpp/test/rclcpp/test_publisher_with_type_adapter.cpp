@@ -20,10 +20,12 @@
 #include <string>
 #include <thread>
 #include <utility>
+#include <vector>
 
 #include "rclcpp/exceptions.hpp"
 #include "rclcpp/loaned_message.hpp"
 #include "rclcpp/rclcpp.hpp"
+#include "rclcpp/serialization.hpp"
 
 #include "rclcpp/msg/string.hpp"
 
@@ -50,9 +52,55 @@ public:
   }
 };
 
+// Custom type whose conversions are counted
+struct CountedString
+{
+  std::string data;
+  static size_t conversions;
+};
+
+size_t CountedString::conversions = 0;
+
+// Custom type serialized without being converted
+struct SerializedString
+{
+  std::string data;
+  static size_t conversions;
+  static size_t serializations;
+};
+
+size_t SerializedString::conversions = 0;
+size_t SerializedString::serializations = 0;
+
 namespace rclcpp
 {
 
+template<>
+struct TypeAdapter<CountedString, rclcpp::msg::String>
+{
+  using is_specialized = std::true_type;
+  using custom_type = CountedString;
+  using ros_message_type = rclcpp::msg::String;
+
+  static void
+  convert_to_ros_message(
+    const custom_type & source,
+    ros_message_type & destination)
+  {
+    CountedString::conversions++;
+    destination.data = source.data;
+  }
+
+  static void
+  convert_to_custom(
+    const ros_message_type & source,
+    custom_type & destination)
+  {
+    CountedString::conversions++;
+    destination.data = source.data;
+  }
+};
+
 template<>
 struct TypeAdapter<std::string, rclcpp::msg::String>
 {
@@ -77,6 +125,42 @@ struct TypeAdapter<std::string, rclcpp::msg::String>
   }
 };
 
+template<>
+struct TypeAdapter<SerializedString, rclcpp::msg::String>
+{
+  using is_specialized = std::true_type;
+  using custom_type = SerializedString;
+  using ros_message_type = rclcpp::msg::String;
+
+  static void
+  convert_to_ros_message(
+    const custom_type & source,
+    ros_message_type & destination)
+  {
+    SerializedString::conversions++;
+    destination.data = source.data;
+  }
+
+  static void
+  convert_to_custom(
+    const ros_message_type & source,
+    custom_type & destination)
+  {
+    SerializedString::conversions++;
+    destination.data = source.data;
+  }
+
+  // A real adapter would write the serialized data itself, without a ROS message
+  static void
+  serialize_to(const custom_type & source, rclcpp::SerializedMessage & destination)
+  {
+    SerializedString::serializations++;
+    ros_message_type ros_msg;
+    ros_msg.data = source.data;
+    rclcpp::Serialization<ros_message_type>().serialize_message(&ros_msg, &destination);
+  }
+};
+
 // Throws in conversion
 template<>
 struct TypeAdapter<int, rclcpp::msg::String>
@@ -152,6 +236,48 @@ TEST_F(TestPublisher, conversion_exception_is_passed_up) {
   }
 }
 
+/*
+ * Testing that a type adapted message is converted once for all the intra-process
+ * subscriptions taking the ROS message type.
+ */
+TEST_F(TestPublisher, type_adapted_message_is_converted_once_intra_process) {
+  using CountedStringTypeAdapter = rclcpp::TypeAdapter<CountedString, rclcpp::msg::String>;
+  const std::string topic_name = "topic_name";
+  auto node = rclcpp::Node::make_shared(
+    "test_intra_process",
+    rclcpp::NodeOptions().use_intra_process_comms(true));
+  auto pub = node->create_publisher<CountedStringTypeAdapter>(topic_name, 10);
+
+  size_t received = 0;
+  std::vector<rclcpp::SubscriptionBase::SharedPtr> subscriptions;
+  for (size_t i = 0; i < 2; ++i) {
+    subscriptions.push_back(
+      node->create_subscription<rclcpp::msg::String>(
+        topic_name, 1, [&received](rclcpp::msg::String::UniquePtr msg) {
+          EXPECT_EQ("data", msg->data);
+          received++;
+        }));
+    subscriptions.push_back(
+      node->create_subscription<rclcpp::msg::String>(
+        topic_name, 1, [&received](rclcpp::msg::String::ConstSharedPtr msg) {
+          EXPECT_EQ("data", msg->data);
+          received++;
+        }));
+  }
+
+  CountedString::conversions = 0;
+  pub->publish(std::make_unique<CountedString>(CountedString{"data"}));
+  EXPECT_EQ(1u, CountedString::conversions);
+
+  rclcpp::executors::SingleThreadedExecutor executor;
+  executor.add_node(node);
+  for (int i = 0; i < g_max_loops && received < subscriptions.size(); ++i) {
+    executor.spin_some();
+    std::this_thread::sleep_for(g_sleep_per_loop);
+  }
+  EXPECT_EQ(subscriptions.size(), received);
+}
+
 using UseTakeSharedMethod = bool;
 class TestPublisherFixture
   : public TestPublisher,
@@ -336,3 +462,39 @@ TEST_F(TestPublisher, check_type_adapted_message_is_sent_and_received) {
     assert_message_was_received();
   }
 }
+
+/*
+ * Testing that type adapted messages are serialized directly for inter-process publications.
+ */
+TEST_F(TestPublisher, type_adapted_message_is_serialized_directly_inter_process) {
+  using SerializedStringTypeAdapter = rclcpp::TypeAdapter<SerializedString, rclcpp::msg::String>;
+  static_assert(rclcpp::detail::has_serialize_to<SerializedStringTypeAdapter>::value);
+
+  auto node = std::make_shared<rclcpp::Node>("my_node", "/ns", rclcpp::NodeOptions());
+  auto pub = node->create_publisher<SerializedStringTypeAdapter>("topic_name", 10);
+  auto sub = node->create_subscription<rclcpp::msg::String>(
+    "topic_name", 10, [](std::shared_ptr<const rclcpp::msg::String>) {});
+  auto start = std::chrono::steady_clock::now();
+  while (pub->get_subscription_count() == 0u && std::chrono::steady_clock::now() - start < 10s) {
+    std::this_thread::sleep_for(10ms);
+  }
+
+  SerializedString::conversions = 0;
+  pub->publish(SerializedString{"a"});
+  pub->publish(std::make_unique<SerializedString>(SerializedString{"b"}));
+  EXPECT_EQ(0u, SerializedString::conversions);
+  EXPECT_EQ(2u, SerializedString::serializations);
+
+  for (const char * data : {"a", "b"}) {
+    rclcpp::msg::String msg;
+    rclcpp::MessageInfo msg_info;
+    bool message_received = false;
+    start = std::chrono::steady_clock::now();
+    do {
+      message_received = sub->take(msg, msg_info);
+      std::this_thread::sleep_for(10ms);
+    } while (!message_received && std::chrono::steady_clock::now() - start < 10s);
+    ASSERT_TRUE(message_received);
+    EXPECT_EQ(data, msg.data);
+  }
+}
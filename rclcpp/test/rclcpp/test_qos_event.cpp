@@ -599,3 +599,40 @@ TEST_F(TestQosEvent, test_sub_matched_event_by_option_event_callback)
   }
   ex.spin_until_future_complete(prom.get_future(), timeout);
 }
+
+TEST_F(TestQosEvent, test_aggregated_event_handlers)
+{
+  auto aggregating_node = std::make_shared<rclcpp::Node>(
+    "aggregating_node", rclcpp::NodeOptions().aggregate_event_handlers(true));
+
+  std::promise<void> prom;
+  rclcpp::PublisherOptions pub_options;
+  pub_options.event_callbacks.matched_callback =
+    [&prom](rmw_matched_status_t & s) {
+      if (s.current_count_change > 0) {
+        prom.set_value();
+      }
+    };
+  rclcpp::SubscriptionOptions sub_options;
+  sub_options.event_callbacks.matched_callback = [](rmw_matched_status_t &) {};
+  auto pub = aggregating_node->create_publisher<test_msgs::msg::Empty>(
+    topic_name, 10, pub_options);
+  auto sub = aggregating_node->create_subscription<test_msgs::msg::Empty>(
+    topic_name, 10, message_callback, sub_options);
+
+  // The event handlers of both entities share a single waitable
+  size_t number_of_waitables = 0;
+  aggregating_node->get_node_base_interface()->get_default_callback_group()->collect_all_ptrs(
+    [](const rclcpp::SubscriptionBase::SharedPtr &) {},
+    [](const rclcpp::ServiceBase::SharedPtr &) {},
+    [](const rclcpp::ClientBase::SharedPtr &) {},
+    [](const rclcpp::TimerBase::SharedPtr &) {},
+    [&number_of_waitables](const rclcpp::Waitable::SharedPtr &) {number_of_waitables++;});
+  EXPECT_EQ(1u, number_of_waitables);
+
+  rclcpp::executors::SingleThreadedExecutor ex;
+  ex.add_node(aggregating_node->get_node_base_interface());
+  EXPECT_EQ(
+    rclcpp::FutureReturnCode::SUCCESS,
+    ex.spin_until_future_complete(prom.get_future(), std::chrono::seconds(10)));
+}
@@ -69,6 +69,42 @@ TEST(TestQosParameters, declare) {
   rclcpp::shutdown();
 }
 
+TEST(TestQosParameters, declare_only_overridden) {
+  rclcpp::init(0, nullptr);
+  auto node = std::make_shared<rclcpp::Node>(
+    "my_node", "/ns", rclcpp::NodeOptions().parameter_overrides(
+  {
+    rclcpp::Parameter(
+      "qos_overrides./my/fully/qualified/topic_name.publisher.reliability", "best_effort"),
+  }));
+
+  auto options = rclcpp::QosOverridingOptions::with_default_policies();
+  EXPECT_FALSE(options.get_declare_only_overridden());
+  options.declare_only_overridden();
+  EXPECT_TRUE(options.get_declare_only_overridden());
+
+  rclcpp::QoS qos = rclcpp::detail::declare_qos_parameters(
+    options, node, "/my/fully/qualified/topic_name", rclcpp::QoS{rclcpp::KeepLast(10)},
+    rclcpp::detail::PublisherQosParametersTraits{});
+  EXPECT_EQ(RMW_QOS_POLICY_RELIABILITY_BEST_EFFORT, qos.get_rmw_qos_profile().reliability);
+  EXPECT_EQ(10u, qos.get_rmw_qos_profile().depth);
+  std::map<std::string, rclcpp::Parameter> qos_params;
+  EXPECT_TRUE(
+    node->get_node_parameters_interface()->get_parameters_by_prefix(
+      "qos_overrides./my/fully/qualified/topic_name.publisher", qos_params));
+  EXPECT_EQ(1u, qos_params.size());
+
+  // Nothing is declared for an entity without overrides
+  qos = rclcpp::detail::declare_qos_parameters(
+    options, node, "/my/fully/qualified/other_topic", rclcpp::QoS{rclcpp::KeepLast(5)},
+    rclcpp::detail::PublisherQosParametersTraits{});
+  EXPECT_EQ(5u, qos.get_rmw_qos_profile().depth);
+  EXPECT_FALSE(
+    node->has_parameter("qos_overrides./my/fully/qualified/other_topic.publisher.depth"));
+
+  rclcpp::shutdown();
+}
+
 TEST(TestQosParameters, declare_with_callback) {
   rclcpp::init(0, nullptr);
   auto node = std::make_shared<rclcpp::Node>(
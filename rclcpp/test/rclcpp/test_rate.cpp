@@ -14,6 +14,8 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <cstdint>
 #include <stdexcept>
 #include <string>
 
@@ -150,6 +152,46 @@ TEST_F(TestRate, wall_rate_basics) {
   EXPECT_GT(epsilon, delta);
 }
 
+TEST_F(TestRate, keep_phase) {
+  auto period = std::chrono::milliseconds(100);
+  auto epsilon = std::chrono::milliseconds(1);
+  double overrun_ratio = 1.5;
+
+  rclcpp::WallRate r(period);
+  EXPECT_EQ(rclcpp::Rate::OverrunPolicy::Reset, r.get_overrun_policy());
+  r.set_overrun_policy(rclcpp::Rate::OverrunPolicy::KeepPhase);
+  EXPECT_EQ(rclcpp::Rate::OverrunPolicy::KeepPhase, r.get_overrun_policy());
+  auto start = std::chrono::steady_clock::now();
+  r.reset();
+  ASSERT_TRUE(r.sleep());
+
+  // Overrun the second and third cycles
+  rclcpp::sleep_for(period * 2 + period / 2);
+  ASSERT_FALSE(r.sleep());
+  auto stats = r.get_statistics();
+  EXPECT_EQ(2u, stats.cycle_count);
+  EXPECT_EQ(1u, stats.overrun_count);
+  EXPECT_EQ(1u, stats.missed_cycles);
+  EXPECT_LT(period / 2, stats.max_lateness + epsilon);
+  EXPECT_EQ(1u, stats.lateness_histogram.back());
+
+  // The fourth cycle ends at four periods from the start, rather than a period after the overrun
+  ASSERT_TRUE(r.sleep());
+  auto delta = std::chrono::steady_clock::now() - start;
+  EXPECT_LT(4 * period, delta + epsilon);
+  EXPECT_GT(4 * period + period * (overrun_ratio - 1.0), delta);
+  stats = r.get_statistics();
+  EXPECT_EQ(3u, stats.cycle_count);
+  uint64_t histogram_count = 0;
+  for (uint64_t count : stats.lateness_histogram) {
+    histogram_count += count;
+  }
+  EXPECT_EQ(3u, histogram_count);
+
+  r.reset_statistics();
+  EXPECT_EQ(0u, r.get_statistics().cycle_count);
+}
+
 /*
    Basic test for the deprecated GenericRate class.
  */
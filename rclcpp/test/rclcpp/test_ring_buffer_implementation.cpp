@@ -13,8 +13,11 @@
 // limitations under the License.
 
 
+#include <chrono>
+#include <cstdint>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "gtest/gtest.h"
 
@@ -79,3 +82,65 @@ TEST(TestRingBufferImplementation, basic_usage) {
   EXPECT_EQ(false, rb.has_data());
   EXPECT_EQ(false, rb.is_full());
 }
+
+/*
+   Batch dequeue and read without consuming
+ */
+TEST(TestRingBufferImplementation, dequeue_n) {
+  rclcpp::experimental::buffers::RingBufferImplementation<char> rb(3);
+
+  rb.enqueue('a');
+  rb.enqueue('b');
+  rb.enqueue('c');
+  EXPECT_EQ(0u, rb.get_dropped_count());
+  rb.enqueue('d');
+  EXPECT_EQ(1u, rb.get_dropped_count());
+
+  std::vector<char> stored;
+  rb.for_each_data([&stored](const char & v) {stored.push_back(v);});
+  EXPECT_EQ((std::vector<char>{'b', 'c', 'd'}), stored);
+  EXPECT_EQ(true, rb.is_full());
+
+  char values[2];
+  EXPECT_EQ(2u, rb.dequeue_n(values, 2));
+  EXPECT_EQ('b', values[0]);
+  EXPECT_EQ('c', values[1]);
+
+  EXPECT_EQ(1u, rb.dequeue_n(values, 2));
+  EXPECT_EQ('d', values[0]);
+  EXPECT_EQ(false, rb.has_data());
+  EXPECT_EQ(0u, rb.dequeue_n(values, 2));
+}
+
+/*
+   Dequeue with the time the elements were enqueued at
+ */
+TEST(TestRingBufferImplementation, dequeue_timed) {
+  rclcpp::experimental::buffers::RingBufferImplementation<char> rb(2);
+
+  int64_t enqueue_time = -1;
+  rb.enqueue('a');
+  EXPECT_EQ('a', rb.dequeue_timed(enqueue_time));
+  EXPECT_EQ(0, enqueue_time);
+
+  EXPECT_TRUE(rb.record_enqueue_times());
+  const int64_t before = std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::steady_clock::now().time_since_epoch()).count();
+  rb.enqueue('b');
+  rb.enqueue('c');
+  rb.enqueue('d');
+  const int64_t after = std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::steady_clock::now().time_since_epoch()).count();
+
+  // The time of the overwritten element is dropped with it
+  EXPECT_EQ('c', rb.dequeue_timed(enqueue_time));
+  EXPECT_GE(enqueue_time, before);
+  EXPECT_LE(enqueue_time, after);
+  int64_t last_enqueue_time = 0;
+  EXPECT_EQ('d', rb.dequeue_timed(last_enqueue_time));
+  EXPECT_GE(last_enqueue_time, enqueue_time);
+  EXPECT_LE(last_enqueue_time, after);
+
+  EXPECT_EQ(0, rb.dequeue_timed(enqueue_time));
+  EXPECT_EQ(0, enqueue_time);
+}
@@ -0,0 +1,111 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+#include "rosidl_typesupport_cpp/message_type_support.hpp"
+
+#include "rclcpp/serialization.hpp"
+#include "rclcpp/serialized_field_extractor.hpp"
+#include "rclcpp/serialized_message.hpp"
+
+#include "test_msgs/msg/basic_types.hpp"
+#include "test_msgs/msg/nested.hpp"
+#include "test_msgs/msg/unbounded_sequences.hpp"
+
+template<typename MessageT>
+rclcpp::SerializedMessage
+serialize(const MessageT & message)
+{
+  rclcpp::SerializedMessage serialized_message;
+  rclcpp::Serialization<MessageT>().serialize_message(&message, &serialized_message);
+  return serialized_message;
+}
+
+TEST(TestSerializedFieldExtractor, nested_field) {
+  test_msgs::msg::Nested message;
+  message.basic_types_value.bool_value = true;
+  message.basic_types_value.int16_value = -3;
+  message.basic_types_value.float64_value = 1.25;
+  message.basic_types_value.uint64_value = 42u;
+  const auto serialized_message = serialize(message);
+
+  const std::string type = "test_msgs/msg/Nested";
+  rclcpp::SerializedFieldExtractor extractor(type, "basic_types_value.bool_value");
+  EXPECT_EQ("basic_types_value.bool_value", extractor.get_field_path());
+  EXPECT_TRUE(extractor.extract<bool>(serialized_message));
+  EXPECT_EQ(
+    -3, rclcpp::SerializedFieldExtractor(type, "basic_types_value.int16_value")
+    .extract<int16_t>(serialized_message));
+  EXPECT_EQ(
+    1.25, rclcpp::SerializedFieldExtractor(type, "basic_types_value.float64_value")
+    .extract<double>(serialized_message));
+  EXPECT_EQ(
+    42u, rclcpp::SerializedFieldExtractor(type, "basic_types_value.uint64_value")
+    .extract<uint64_t>(serialized_message));
+}
+
+TEST(TestSerializedFieldExtractor, field_after_sequences) {
+  test_msgs::msg::UnboundedSequences message;
+  message.int32_values = {1, 2, 3};
+  message.string_values = {"a", "", "abc"};
+  message.basic_types_values.resize(2);
+  message.alignment_check = 1234;
+  const auto serialized_message = serialize(message);
+
+  rclcpp::SerializedFieldExtractor extractor(
+    rosidl_typesupport_cpp::get_message_type_support_handle<test_msgs::msg::UnboundedSequences>(),
+    "alignment_check");
+  EXPECT_EQ(1234, extractor.extract<int32_t>(serialized_message));
+
+  message.string_values.push_back(std::string(100, 'x'));
+  message.alignment_check = -1;
+  EXPECT_EQ(-1, extractor.extract<int32_t>(serialize(message)));
+}
+
+TEST(TestSerializedFieldExtractor, invalid_fields) {
+  const std::string type = "test_msgs/msg/Nested";
+  EXPECT_THROW(rclcpp::SerializedFieldExtractor(type, "missing"), std::invalid_argument);
+  EXPECT_THROW(
+    rclcpp::SerializedFieldExtractor(type, "basic_types_value.missing"), std::invalid_argument);
+  // Only primitives and strings can be extracted
+  EXPECT_THROW(rclcpp::SerializedFieldExtractor(type, "basic_types_value"), std::invalid_argument);
+  EXPECT_THROW(
+    rclcpp::SerializedFieldExtractor("test_msgs/msg/UnboundedSequences", "int32_values"),
+    std::invalid_argument);
+  EXPECT_THROW(
+    rclcpp::SerializedFieldExtractor("test_msgs/msg/BasicTypes", "bool_value.nested"),
+    std::invalid_argument);
+}
+
+TEST(TestSerializedFieldExtractor, invalid_data) {
+  test_msgs::msg::BasicTypes message;
+  auto serialized_message = serialize(message);
+  rclcpp::SerializedFieldExtractor extractor("test_msgs/msg/BasicTypes", "uint64_value");
+  EXPECT_THROW(extractor.extract<int64_t>(serialized_message), std::invalid_argument);
+  EXPECT_EQ(0u, extractor.extract<uint64_t>(serialized_message));
+
+  const rclcpp::SerializedMessageView view(serialized_message);
+  EXPECT_THROW(
+    extractor.extract<uint64_t>(rclcpp::SerializedMessageView(view.data(), view.size() - 1)),
+    std::runtime_error);
+  EXPECT_THROW(
+    extractor.extract<uint64_t>(rclcpp::SerializedMessageView(view.data(), 2)),
+    std::runtime_error);
+}
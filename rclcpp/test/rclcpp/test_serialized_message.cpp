@@ -27,6 +27,7 @@
 
 #include "test_msgs/message_fixtures.hpp"
 #include "test_msgs/msg/basic_types.hpp"
+#include "test_msgs/msg/strings.hpp"
 
 TEST(TestSerializedMessage, empty_initialize) {
   rclcpp::SerializedMessage serialized_message;
@@ -166,6 +167,26 @@ TEST(TestSerializedMessage, serialization) {
   }
 }
 
+TEST(TestSerializedMessage, serialization_fixed_size) {
+  using MessageT = test_msgs::msg::BasicTypes;
+  static_assert(rosidl_generator_traits::has_fixed_size<MessageT>::value, "fixed size message");
+
+  rclcpp::Serialization<MessageT> serializer;
+  MessageT ros_msg;
+  rclcpp::SerializedMessage first_serialized_msg;
+  serializer.serialize_message(&ros_msg, &first_serialized_msg);
+  const size_t size = rclcpp::Serialization<MessageT>::get_fixed_serialized_size();
+  EXPECT_EQ(first_serialized_msg.size(), size);
+
+  // The exact size is reserved from now on
+  rclcpp::SerializedMessage serialized_msg;
+  serializer.serialize_message(&ros_msg, &serialized_msg);
+  EXPECT_EQ(size, serialized_msg.size());
+  EXPECT_EQ(size, serialized_msg.capacity());
+
+  EXPECT_EQ(0u, rclcpp::Serialization<test_msgs::msg::Strings>::get_fixed_serialized_size());
+}
+
 TEST(TestSerializedMessage, assignment_operators) {
   const std::string content = "Hello World";
   const auto content_size = content.size() + 1;  // accounting for null terminator
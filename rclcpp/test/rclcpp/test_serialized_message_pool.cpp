@@ -0,0 +1,83 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include "rclcpp/serialization.hpp"
+#include "rclcpp/serialized_message_pool.hpp"
+
+#include "test_msgs/message_fixtures.hpp"
+#include "test_msgs/msg/basic_types.hpp"
+
+TEST(TestSerializedMessagePool, reuse_buffers) {
+  rclcpp::SerializedMessagePool pool;
+  EXPECT_EQ(0u, pool.get_high_water_mark());
+  EXPECT_EQ(0u, pool.get_number_of_free_messages());
+
+  auto message = pool.acquire();
+  ASSERT_NE(nullptr, message);
+  EXPECT_EQ(0u, message->size());
+
+  auto basic_type_ros_msgs = get_messages_basic_types();
+  rclcpp::Serialization<test_msgs::msg::BasicTypes> serializer;
+  serializer.serialize_message(basic_type_ros_msgs[0].get(), message.get());
+  const size_t serialized_size = message->size();
+  ASSERT_LT(0u, serialized_size);
+  const auto * buffer = message->get_rcl_serialized_message().buffer;
+
+  // Releasing the last reference returns the message to the pool
+  message.reset();
+  EXPECT_EQ(serialized_size, pool.get_high_water_mark());
+  EXPECT_EQ(1u, pool.get_number_of_free_messages());
+
+  message = pool.acquire();
+  EXPECT_EQ(0u, pool.get_number_of_free_messages());
+  EXPECT_EQ(0u, message->size());
+  EXPECT_LE(serialized_size, message->capacity());
+  EXPECT_EQ(buffer, message->get_rcl_serialized_message().buffer);
+
+  // New messages are allocated with the high-water mark capacity
+  auto other_message = pool.acquire();
+  EXPECT_LE(serialized_size, other_message->capacity());
+
+  test_msgs::msg::BasicTypes deserialized_message;
+  serializer.serialize_message(basic_type_ros_msgs[0].get(), message.get());
+  serializer.deserialize_message(message.get(), &deserialized_message);
+  EXPECT_EQ(*basic_type_ros_msgs[0], deserialized_message);
+}
+
+TEST(TestSerializedMessagePool, max_free_messages) {
+  rclcpp::SerializedMessagePool pool(2);
+
+  std::vector<std::shared_ptr<rclcpp::SerializedMessage>> messages;
+  for (size_t i = 0; i < 4; ++i) {
+    messages.push_back(pool.acquire());
+  }
+  messages.clear();
+  EXPECT_EQ(2u, pool.get_number_of_free_messages());
+}
+
+TEST(TestSerializedMessagePool, message_outlives_pool) {
+  std::shared_ptr<rclcpp::SerializedMessage> message;
+  {
+    rclcpp::SerializedMessagePool pool;
+    message = pool.acquire();
+    message->reserve(42);
+  }
+  EXPECT_EQ(42u, message->capacity());
+  EXPECT_NO_THROW(message.reset());
+}
@@ -16,6 +16,7 @@
 
 #include <string>
 #include <memory>
+#include <stdexcept>
 #include <utility>
 
 #include "rclcpp/exceptions.hpp"
@@ -239,6 +240,55 @@ TEST_F(TestService, send_response) {
   }
 }
 
+TEST_F(TestService, max_batch_size) {
+  auto callback =
+    [](const test_msgs::srv::Empty::Request::SharedPtr,
+      test_msgs::srv::Empty::Response::SharedPtr) {};
+  auto server = node->create_service<test_msgs::srv::Empty>("service", callback);
+  EXPECT_EQ(1u, server->get_max_batch_size());
+  EXPECT_THROW(server->set_max_batch_size(0), std::invalid_argument);
+  server->set_max_batch_size(10);
+  EXPECT_EQ(10u, server->get_max_batch_size());
+}
+
+TEST_F(TestService, pooled_requests) {
+  using rcl_interfaces::srv::ListParameters;
+  size_t non_default_responses = 0;
+  auto callback =
+    [&non_default_responses](
+    const ListParameters::Request::SharedPtr, ListParameters::Response::SharedPtr response) {
+      if (!response->result.names.empty()) {
+        non_default_responses++;
+      }
+      response->result.names.push_back("name");
+    };
+  auto server = node->create_service<ListParameters>(
+    "service", callback, rclcpp::ServicesQoS(), nullptr, 2);
+
+  // Objects are reused once released, and not while they are held
+  auto request = server->create_request();
+  auto request_header = server->create_request_header();
+  const void * request_address = request.get();
+  const void * request_header_address = request_header.get();
+  EXPECT_NE(request_address, server->create_request().get());
+  request.reset();
+  request_header.reset();
+  EXPECT_EQ(request_address, server->create_request().get());
+  EXPECT_EQ(request_header_address, server->create_request_header().get());
+
+  // Requests still succeed when all the objects of the pool are held
+  auto held_request_1 = server->create_request();
+  auto held_request_2 = server->create_request();
+  EXPECT_NE(nullptr, server->create_request());
+
+  // Reused responses are reset for every request
+  auto mock = mocking_utils::patch_and_return("lib:rclcpp", rcl_send_response, RCL_RET_OK);
+  for (int i = 0; i < 3; ++i) {
+    server->handle_request(server->create_request_header(), server->create_request());
+  }
+  EXPECT_EQ(0u, non_default_responses);
+}
+
 /*
    Testing on_new_request callbacks.
  */
@@ -337,3 +337,55 @@ TEST_F(TestServiceIntrospection, service_introspection_enable_disable_event_cont
     }
   }
 }
+
+TEST_F(TestServiceIntrospection, service_introspection_sampled_asynchronous)
+{
+  rclcpp::ServiceIntrospectionOptions options;
+  options.sample_period = 2;
+  options.asynchronous = true;
+  client->configure_introspection(
+    node->get_clock(), rclcpp::SystemDefaultsQoS(), RCL_SERVICE_INTROSPECTION_CONTENTS, options);
+  service->configure_introspection(
+    node->get_clock(), rclcpp::SystemDefaultsQoS(), RCL_SERVICE_INTROSPECTION_CONTENTS, options);
+
+  auto request = std::make_shared<BasicTypes::Request>();
+  request->set__int64_value(42);
+  for (int i = 0; i < 4; ++i) {
+    auto future = client->async_send_request(request);
+    ASSERT_EQ(
+      rclcpp::FutureReturnCode::SUCCESS,
+      rclcpp::spin_until_future_complete(node, future, timeout));
+  }
+
+  // Wait for the events of the two sampled calls, and any unexpected other one
+  auto start = std::chrono::steady_clock::now();
+  while (events.size() < 8 && (std::chrono::steady_clock::now() - start) < timeout) {
+    rclcpp::spin_some(node);
+  }
+  start = std::chrono::steady_clock::now();
+  while ((std::chrono::steady_clock::now() - start) < 100ms) {
+    rclcpp::spin_some(node);
+  }
+
+  ASSERT_EQ(events.size(), 8U);
+  std::map<int64_t, std::map<uint8_t, std::shared_ptr<const BasicTypes::Event>>> calls;
+  for (auto & event : events) {
+    EXPECT_EQ(event->info.sequence_number % 2, 0);
+    calls[event->info.sequence_number][event->info.event_type] = event;
+  }
+  ASSERT_EQ(calls.size(), 2U);
+  for (auto & call : calls) {
+    ASSERT_EQ(call.second.size(), 4U);
+    ASSERT_EQ(call.second[ServiceEventInfo::REQUEST_SENT]->request.size(), 1U);
+    EXPECT_EQ(call.second[ServiceEventInfo::REQUEST_SENT]->request[0].int64_value, 42);
+    ASSERT_EQ(call.second[ServiceEventInfo::RESPONSE_SENT]->response.size(), 1U);
+    EXPECT_EQ(call.second[ServiceEventInfo::RESPONSE_SENT]->response[0].int64_value, 42);
+  }
+
+  options.sample_period = 0;
+  EXPECT_THROW(
+    client->configure_introspection(
+      node->get_clock(), rclcpp::SystemDefaultsQoS(), RCL_SERVICE_INTROSPECTION_CONTENTS,
+      options),
+    std::invalid_argument);
+}
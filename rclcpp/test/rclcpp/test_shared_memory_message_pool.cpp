@@ -0,0 +1,186 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+#include "rclcpp/experimental/shared_memory_message_pool.hpp"
+
+using rclcpp::experimental::SharedMemoryMessagePool;
+
+struct FixedSizeMessage
+{
+  uint64_t id;
+  double data[16];
+};
+
+using Pool = SharedMemoryMessagePool<FixedSizeMessage>;
+
+#ifndef _WIN32
+std::string
+unique_pool_name(const std::string & name)
+{
+  // Segments are visible to the whole host, avoid clashes with concurrent test runs
+  return "rclcpp_test_" + name + "_" + std::to_string(getpid());
+}
+
+/*
+ * Constructor
+ */
+TEST(TestSharedMemoryMessagePool, constructor) {
+  EXPECT_THROW(Pool(unique_pool_name("zero_capacity"), 0), std::invalid_argument);
+  EXPECT_THROW(Pool("", 2), std::invalid_argument);
+
+  auto name = unique_pool_name("constructor");
+  Pool pool(name, 3);
+  EXPECT_EQ(3u, pool.get_capacity());
+  EXPECT_EQ(0u, pool.get_last_sequence());
+
+  // A pool with a different capacity can't be opened on the same segment
+  EXPECT_THROW(Pool(name, 4), std::runtime_error);
+}
+
+/*
+ * Messages published through a pool are seen in place by another pool mapping the same segment
+ */
+TEST(TestSharedMemoryMessagePool, publish_take) {
+  auto name = unique_pool_name("publish_take");
+  Pool publisher_pool(name, 2);
+  Pool subscriber_pool(name, 2);
+
+  uint64_t last_sequence = 0;
+  EXPECT_EQ(nullptr, subscriber_pool.take(last_sequence));
+
+  for (uint64_t id = 1; id <= 2; ++id) {
+    auto loan = publisher_pool.borrow();
+    ASSERT_TRUE(loan.is_valid());
+    loan.get().id = id;
+    publisher_pool.publish(std::move(loan));
+    EXPECT_FALSE(loan.is_valid());
+  }
+  EXPECT_EQ(2u, subscriber_pool.get_last_sequence());
+
+  auto first = subscriber_pool.take(last_sequence);
+  ASSERT_NE(nullptr, first);
+  EXPECT_EQ(1u, first->id);
+  EXPECT_EQ(1u, last_sequence);
+  auto second = subscriber_pool.take(last_sequence);
+  ASSERT_NE(nullptr, second);
+  EXPECT_EQ(2u, second->id);
+  EXPECT_EQ(nullptr, subscriber_pool.take(last_sequence));
+
+  // Both slots are held by the subscriber, so nothing can be borrowed
+  EXPECT_FALSE(publisher_pool.borrow().is_valid());
+
+  // Once released, the slot holding the oldest message is reused first
+  first.reset();
+  auto loan = publisher_pool.borrow();
+  ASSERT_TRUE(loan.is_valid());
+  loan.get().id = 3;
+  publisher_pool.publish(std::move(loan));
+  auto third = subscriber_pool.take(last_sequence);
+  ASSERT_NE(nullptr, third);
+  EXPECT_EQ(3u, third->id);
+  EXPECT_EQ(2u, second->id);
+}
+
+/*
+ * A loan destroyed without publishing returns its slot, and old messages are overwritten
+ */
+TEST(TestSharedMemoryMessagePool, keep_last) {
+  Pool pool(unique_pool_name("keep_last"), 2);
+  {
+    auto loan = pool.borrow();
+    EXPECT_TRUE(loan.is_valid());
+    auto other_loan = pool.borrow();
+    EXPECT_TRUE(other_loan.is_valid());
+    EXPECT_FALSE(pool.borrow().is_valid());
+  }
+  EXPECT_EQ(0u, pool.get_last_sequence());
+
+  for (uint64_t id = 1; id <= 5; ++id) {
+    auto loan = pool.borrow();
+    ASSERT_TRUE(loan.is_valid());
+    loan.get().id = id;
+    pool.publish(std::move(loan));
+  }
+
+  // Only the last two messages are still available
+  uint64_t last_sequence = 0;
+  std::vector<uint64_t> ids;
+  while (auto msg = pool.take(last_sequence)) {
+    ids.push_back(msg->id);
+  }
+  EXPECT_EQ((std::vector<uint64_t>{4u, 5u}), ids);
+
+  Pool::Loan invalid_loan;
+  EXPECT_THROW(pool.publish(std::move(invalid_loan)), std::runtime_error);
+}
+
+/*
+ * A loan destroyed without publishing doesn't make the message it replaced available again
+ */
+TEST(TestSharedMemoryMessagePool, drop_loan) {
+  Pool pool(unique_pool_name("drop_loan"), 1);
+  auto loan = pool.borrow();
+  ASSERT_TRUE(loan.is_valid());
+  loan.get().id = 1;
+  pool.publish(std::move(loan));
+
+  // The slot of the published message is reused, then returned without being published
+  EXPECT_TRUE(pool.borrow().is_valid());
+  uint64_t last_sequence = 0;
+  EXPECT_EQ(nullptr, pool.take(last_sequence));
+  EXPECT_EQ(0u, last_sequence);
+}
+
+/*
+ * Taking skips the message being overwritten by a publisher, without waiting for it
+ */
+TEST(TestSharedMemoryMessagePool, take_while_writing) {
+  Pool pool(unique_pool_name("take_while_writing"), 2);
+  for (uint64_t id = 1; id <= 2; ++id) {
+    auto loan = pool.borrow();
+    ASSERT_TRUE(loan.is_valid());
+    loan.get().id = id;
+    pool.publish(std::move(loan));
+  }
+
+  // The slot of the oldest message is being written
+  auto loan = pool.borrow();
+  ASSERT_TRUE(loan.is_valid());
+  uint64_t last_sequence = 0;
+  auto msg = pool.take(last_sequence);
+  ASSERT_NE(nullptr, msg);
+  EXPECT_EQ(2u, msg->id);
+  EXPECT_EQ(2u, last_sequence);
+  EXPECT_EQ(nullptr, pool.take(last_sequence));
+
+  loan.get().id = 3;
+  pool.publish(std::move(loan));
+  msg = pool.take(last_sequence);
+  ASSERT_NE(nullptr, msg);
+  EXPECT_EQ(3u, msg->id);
+}
+#endif
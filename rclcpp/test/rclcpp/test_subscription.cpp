@@ -14,6 +14,7 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
 #include <chrono>
 #include <functional>
 #include <memory>
@@ -29,6 +30,7 @@
 #include "../mocking_utils/patch.hpp"
 #include "../utils/rclcpp_gtest_macros.hpp"
 
+#include "test_msgs/msg/basic_types.hpp"
 #include "test_msgs/msg/empty.hpp"
 
 using namespace std::chrono_literals;
@@ -244,6 +246,194 @@ TEST_F(TestSubscription, take) {
   // TODO(wjwwood): figure out a good way to test the intra-process exclusion behavior.
 }
 
+/*
+   Testing that a ready subscription delivers a batch of messages in a single execution.
+ */
+TEST_F(TestSubscription, max_batch_size) {
+  initialize();
+  size_t received_messages = 0;
+  auto callback = [&received_messages](std::shared_ptr<const test_msgs::msg::Empty>) {
+      received_messages++;
+    };
+  {
+    auto sub = node_->create_subscription<test_msgs::msg::Empty>("~/test_batch", 1, callback);
+    EXPECT_EQ(1u, sub->get_max_batch_size());
+    EXPECT_THROW(sub->set_max_batch_size(0), std::invalid_argument);
+  }
+
+  rclcpp::SubscriptionOptions so;
+  so.use_intra_process_comm = rclcpp::IntraProcessSetting::Disable;
+  so.max_batch_size = 10;
+  auto sub = node_->create_subscription<test_msgs::msg::Empty>("~/test_batch", 10, callback, so);
+  EXPECT_EQ(10u, sub->get_max_batch_size());
+  rclcpp::PublisherOptions po;
+  po.use_intra_process_comm = rclcpp::IntraProcessSetting::Disable;
+  auto pub = node_->create_publisher<test_msgs::msg::Empty>("~/test_batch", 10, po);
+
+  rclcpp::executors::SingleThreadedExecutor executor;
+  executor.add_node(node_);
+
+  // Wait for discovery before publishing, so that no message is lost
+  auto start = std::chrono::steady_clock::now();
+  while (pub->get_subscription_count() == 0u && std::chrono::steady_clock::now() - start < 10s) {
+    std::this_thread::sleep_for(10ms);
+  }
+  for (size_t i = 0; i < 5u; ++i) {
+    pub->publish(test_msgs::msg::Empty());
+  }
+  std::this_thread::sleep_for(100ms);
+
+  // All the messages available are delivered by the first execution
+  start = std::chrono::steady_clock::now();
+  while (received_messages == 0u && std::chrono::steady_clock::now() - start < 10s) {
+    executor.spin_once(100ms);
+  }
+  EXPECT_EQ(5u, received_messages);
+}
+
+/*
+   Testing that messages deserialized after the take are delivered by concurrent threads.
+ */
+TEST_F(TestSubscription, deserialize_after_take) {
+  initialize();
+  using test_msgs::msg::BasicTypes;
+  {
+    auto sub = node_->create_subscription<BasicTypes>(
+      "~/test_deserialize", 1, [](BasicTypes::ConstSharedPtr) {});
+    EXPECT_FALSE(sub->get_deserialize_after_take());
+  }
+
+  std::atomic<size_t> received_messages{0};
+  std::atomic<bool> wrong_message{false};
+  rclcpp::SubscriptionOptions so;
+  so.use_intra_process_comm = rclcpp::IntraProcessSetting::Disable;
+  so.deserialize_after_take = true;
+  so.callback_group = node_->create_callback_group(rclcpp::CallbackGroupType::Reentrant);
+  auto sub = node_->create_subscription<BasicTypes>(
+    "~/test_deserialize", 10,
+    [&](BasicTypes::ConstSharedPtr message) {
+      if (message->int32_value != 42 || message->float64_value != 2.5) {
+        wrong_message = true;
+      }
+      received_messages++;
+    }, so);
+  EXPECT_TRUE(sub->get_deserialize_after_take());
+  rclcpp::PublisherOptions po;
+  po.use_intra_process_comm = rclcpp::IntraProcessSetting::Disable;
+  auto pub = node_->create_publisher<BasicTypes>("~/test_deserialize", 10, po);
+
+  auto start = std::chrono::steady_clock::now();
+  while (pub->get_subscription_count() == 0u && std::chrono::steady_clock::now() - start < 10s) {
+    std::this_thread::sleep_for(10ms);
+  }
+  BasicTypes message;
+  message.int32_value = 42;
+  message.float64_value = 2.5;
+  for (size_t i = 0; i < 5u; ++i) {
+    pub->publish(message);
+  }
+
+  rclcpp::executors::MultiThreadedExecutor executor(rclcpp::ExecutorOptions(), 2);
+  executor.add_node(node_);
+  std::thread spinner([&executor]() {executor.spin();});
+  start = std::chrono::steady_clock::now();
+  while (received_messages < 5u && std::chrono::steady_clock::now() - start < 10s) {
+    std::this_thread::sleep_for(10ms);
+  }
+  executor.cancel();
+  spinner.join();
+  EXPECT_EQ(5u, received_messages);
+  EXPECT_FALSE(wrong_message);
+}
+
+/*
+   Testing the decimation of the messages taken from the middleware.
+ */
+TEST_F(TestSubscription, max_rate) {
+  initialize();
+  using test_msgs::msg::BasicTypes;
+  std::atomic<size_t> received_messages{0};
+  rclcpp::SubscriptionOptions so;
+  so.use_intra_process_comm = rclcpp::IntraProcessSetting::Disable;
+  // A single message is delivered during the test
+  so.max_rate = 0.1;
+  auto sub = node_->create_subscription<BasicTypes>(
+    "~/test_max_rate", 10, [&](BasicTypes::ConstSharedPtr) {received_messages++;}, so);
+  EXPECT_EQ(0.1, sub->get_max_rate());
+  EXPECT_THROW(sub->set_max_rate(-1.0), std::invalid_argument);
+  EXPECT_EQ(0.1, sub->get_max_rate());
+
+  rclcpp::PublisherOptions po;
+  po.use_intra_process_comm = rclcpp::IntraProcessSetting::Disable;
+  auto pub = node_->create_publisher<BasicTypes>("~/test_max_rate", 10, po);
+  auto start = std::chrono::steady_clock::now();
+  while (pub->get_subscription_count() == 0u && std::chrono::steady_clock::now() - start < 10s) {
+    std::this_thread::sleep_for(10ms);
+  }
+  for (size_t i = 0; i < 5u; ++i) {
+    pub->publish(BasicTypes());
+  }
+
+  rclcpp::executors::SingleThreadedExecutor executor;
+  executor.add_node(node_);
+  start = std::chrono::steady_clock::now();
+  while (received_messages == 0u && std::chrono::steady_clock::now() - start < 10s) {
+    executor.spin_some(10ms);
+  }
+  // The other messages are taken and dropped
+  executor.spin_all(100ms);
+  EXPECT_EQ(1u, received_messages);
+  BasicTypes message;
+  rclcpp::MessageInfo message_info;
+  EXPECT_FALSE(sub->take(message, message_info));
+}
+
+/*
+   Testing the message info usage and the receive stamp.
+ */
+TEST_F(TestSubscription, message_info_usage) {
+  initialize();
+  rclcpp::SubscriptionOptions so;
+  so.use_intra_process_comm = rclcpp::IntraProcessSetting::Disable;
+  {
+    auto sub = node_->create_subscription<test_msgs::msg::Empty>(
+      "~/test_message_info", 10, [](test_msgs::msg::Empty::ConstSharedPtr) {}, so);
+    EXPECT_FALSE(sub->needs_message_info());
+    EXPECT_FALSE(sub->captures_receive_stamp());
+  }
+
+  so.capture_receive_stamp = true;
+  std::chrono::steady_clock::time_point receive_stamp;
+  auto sub = node_->create_subscription<test_msgs::msg::Empty>(
+    "~/test_message_info", 10,
+    [&receive_stamp](test_msgs::msg::Empty::ConstSharedPtr, const rclcpp::MessageInfo & info) {
+      receive_stamp = info.get_receive_stamp();
+    }, so);
+  EXPECT_TRUE(sub->needs_message_info());
+  EXPECT_TRUE(sub->captures_receive_stamp());
+
+  rclcpp::PublisherOptions po;
+  po.use_intra_process_comm = rclcpp::IntraProcessSetting::Disable;
+  auto pub = node_->create_publisher<test_msgs::msg::Empty>("~/test_message_info", 10, po);
+  rclcpp::executors::SingleThreadedExecutor executor;
+  executor.add_node(node_);
+
+  auto start = std::chrono::steady_clock::now();
+  while (pub->get_subscription_count() == 0u && std::chrono::steady_clock::now() - start < 10s) {
+    std::this_thread::sleep_for(10ms);
+  }
+  const auto published = std::chrono::steady_clock::now();
+  pub->publish(test_msgs::msg::Empty());
+  start = std::chrono::steady_clock::now();
+  while (receive_stamp == std::chrono::steady_clock::time_point() &&
+    std::chrono::steady_clock::now() - start < 10s)
+  {
+    executor.spin_once(100ms);
+  }
+  EXPECT_GE(receive_stamp, published);
+  EXPECT_LE(receive_stamp, std::chrono::steady_clock::now());
+}
+
 /*
    Testing take_serialized.
  */
@@ -359,6 +549,28 @@ TEST_F(TestSubscription, handle_loaned_message) {
   EXPECT_NO_THROW(sub->handle_loaned_message(&msg, message_info));
 }
 
+TEST_F(TestSubscription, handle_shared_loaned_message) {
+  initialize();
+  std::shared_ptr<const test_msgs::msg::Empty> kept;
+  auto callback = [&kept](std::shared_ptr<const test_msgs::msg::Empty> msg) {
+      kept = std::move(msg);
+    };
+  auto sub = node_->create_subscription<test_msgs::msg::Empty>("topic", 10, callback);
+
+  // The loan is returned by the deleter, once the callback released the message
+  test_msgs::msg::Empty msg;
+  bool returned = false;
+  rclcpp::MessageInfo message_info;
+  {
+    std::shared_ptr<void> loaned_msg(&msg, [&returned](void *) {returned = true;});
+    sub->handle_shared_loaned_message(loaned_msg, message_info);
+  }
+  EXPECT_EQ(&msg, kept.get());
+  EXPECT_FALSE(returned);
+  kept.reset();
+  EXPECT_TRUE(returned);
+}
+
 /*
    Testing on_new_message callbacks.
  */
@@ -0,0 +1,204 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "rclcpp/experimental/synchronized_subscription.hpp"
+#include "rclcpp/rclcpp.hpp"
+
+#include "test_msgs/msg/builtins.hpp"
+#include "test_msgs/msg/empty.hpp"
+
+using namespace std::chrono_literals;
+using rclcpp::experimental::SyncPolicy;
+using rclcpp::experimental::SynchronizedSubscriptionOptions;
+using rclcpp::experimental::detail::StampMatcher;
+using test_msgs::msg::Builtins;
+
+namespace rclcpp
+{
+namespace experimental
+{
+
+// The test messages have no header
+template<>
+struct MessageStamp<Builtins>
+{
+  static rclcpp::Time
+  get(const Builtins & message)
+  {
+    return rclcpp::Time(message.time_value);
+  }
+};
+
+}  // namespace experimental
+}  // namespace rclcpp
+
+namespace
+{
+
+std::shared_ptr<const void>
+make_message(int value)
+{
+  return std::make_shared<int>(value);
+}
+
+// Get the values of the messages of each match
+std::vector<std::vector<int>>
+values(const std::vector<StampMatcher::Match> & matches)
+{
+  std::vector<std::vector<int>> result;
+  for (const auto & match : matches) {
+    result.emplace_back();
+    for (const auto & message : match) {
+      result.back().push_back(*std::static_pointer_cast<const int>(message));
+    }
+  }
+  return result;
+}
+
+}  // namespace
+
+TEST(TestStampMatcher, invalid_options) {
+  SynchronizedSubscriptionOptions options;
+  EXPECT_THROW(StampMatcher(1, options), std::invalid_argument);
+  options.queue_size = 0;
+  EXPECT_THROW(StampMatcher(2, options), std::invalid_argument);
+  options.queue_size = 1;
+  options.max_interval = -1ns;
+  EXPECT_THROW(StampMatcher(2, options), std::invalid_argument);
+}
+
+TEST(TestStampMatcher, exact_time) {
+  SynchronizedSubscriptionOptions options;
+  options.policy = SyncPolicy::ExactTime;
+  StampMatcher matcher(2, options);
+  EXPECT_TRUE(matcher.add(0, 10, make_message(1)).empty());
+  EXPECT_TRUE(matcher.add(0, 20, make_message(2)).empty());
+  EXPECT_EQ((std::vector<std::vector<int>>{{2, 3}}), values(matcher.add(1, 20, make_message(3))));
+  EXPECT_EQ(1u, matcher.get_dropped_count());
+
+  // Out of order messages are dropped
+  EXPECT_TRUE(matcher.add(1, 30, make_message(4)).empty());
+  EXPECT_TRUE(matcher.add(1, 25, make_message(5)).empty());
+  EXPECT_EQ((std::vector<std::vector<int>>{{6, 4}}), values(matcher.add(0, 30, make_message(6))));
+  EXPECT_EQ(2u, matcher.get_dropped_count());
+}
+
+TEST(TestStampMatcher, approximate_time) {
+  SynchronizedSubscriptionOptions options;
+  StampMatcher matcher(3, options);
+  EXPECT_TRUE(matcher.add(0, 10, make_message(1)).empty());
+  EXPECT_TRUE(matcher.add(1, 12, make_message(2)).empty());
+  EXPECT_TRUE(matcher.add(2, 30, make_message(3)).empty());
+  // Messages closer to the latest oldest stamp may still be received
+  EXPECT_TRUE(matcher.add(0, 29, make_message(4)).empty());
+  EXPECT_TRUE(matcher.add(1, 31, make_message(5)).empty());
+  EXPECT_EQ(
+    (std::vector<std::vector<int>>{{4, 5, 3}}), values(matcher.add(0, 32, make_message(6))));
+  EXPECT_EQ(2u, matcher.get_dropped_count());
+}
+
+TEST(TestStampMatcher, approximate_time_max_interval) {
+  SynchronizedSubscriptionOptions options;
+  options.max_interval = 5ns;
+  StampMatcher matcher(3, options);
+  EXPECT_TRUE(matcher.add(0, 100, make_message(1)).empty());
+  EXPECT_TRUE(matcher.add(0, 200, make_message(2)).empty());
+  EXPECT_TRUE(matcher.add(1, 121, make_message(3)).empty());
+  EXPECT_TRUE(matcher.add(2, 120, make_message(4)).empty());
+  // The first message is too old to be matched with the others
+  EXPECT_TRUE(matcher.add(2, 300, make_message(5)).empty());
+  EXPECT_EQ(1u, matcher.get_dropped_count());
+  EXPECT_TRUE(matcher.add(1, 201, make_message(6)).empty());
+  EXPECT_EQ(2u, matcher.get_dropped_count());
+  EXPECT_TRUE(matcher.add(0, 301, make_message(7)).empty());
+  EXPECT_EQ(
+    (std::vector<std::vector<int>>{{7, 8, 5}}), values(matcher.add(1, 302, make_message(8))));
+  EXPECT_EQ(5u, matcher.get_dropped_count());
+}
+
+TEST(TestStampMatcher, queue_size) {
+  SynchronizedSubscriptionOptions options;
+  options.policy = SyncPolicy::ExactTime;
+  options.queue_size = 2;
+  StampMatcher matcher(2, options);
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_TRUE(matcher.add(0, i, make_message(i)).empty());
+  }
+  EXPECT_EQ(1u, matcher.get_dropped_count());
+  EXPECT_TRUE(matcher.add(1, 0, make_message(10)).empty());
+  EXPECT_EQ((std::vector<std::vector<int>>{{1, 11}}), values(matcher.add(1, 1, make_message(11))));
+}
+
+class TestSynchronizedSubscription : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    rclcpp::init(0, nullptr);
+    node = std::make_shared<rclcpp::Node>(
+      "test_synchronized_subscription", "/ns", rclcpp::NodeOptions().use_intra_process_comms(true));
+  }
+
+  void TearDown() override
+  {
+    node.reset();
+    rclcpp::shutdown();
+  }
+
+  rclcpp::Node::SharedPtr node;
+};
+
+TEST_F(TestSynchronizedSubscription, intra_process_matches) {
+  std::vector<std::pair<const Builtins *, const Builtins *>> matches;
+  auto sync = rclcpp::experimental::create_synchronized_subscription<Builtins, Builtins>(
+    node, {"camera", "lidar"}, 10,
+    [&matches](std::shared_ptr<const Builtins> camera, std::shared_ptr<const Builtins> lidar) {
+      matches.emplace_back(camera.get(), lidar.get());
+    });
+  ASSERT_EQ(2u, sync->get_subscriptions().size());
+  auto camera_publisher = node->create_publisher<Builtins>("camera", 10);
+  auto lidar_publisher = node->create_publisher<Builtins>("lidar", 10);
+
+  auto publish = [](const rclcpp::Publisher<Builtins>::SharedPtr & publisher, int32_t sec) {
+      auto message = std::make_unique<Builtins>();
+      message->time_value.sec = sec;
+      const Builtins * address = message.get();
+      publisher->publish(std::move(message));
+      return address;
+    };
+  publish(camera_publisher, 1);
+  const Builtins * camera_message = publish(camera_publisher, 2);
+  const Builtins * lidar_message = publish(lidar_publisher, 2);
+
+  rclcpp::executors::SingleThreadedExecutor executor;
+  executor.add_node(node);
+  const auto deadline = std::chrono::steady_clock::now() + 5s;
+  while (matches.empty() && std::chrono::steady_clock::now() < deadline) {
+    executor.spin_some(10ms);
+  }
+  // The intra-process messages are delivered without copies
+  ASSERT_EQ(1u, matches.size());
+  EXPECT_EQ(camera_message, matches[0].first);
+  EXPECT_EQ(lidar_message, matches[0].second);
+  EXPECT_EQ(1u, sync->get_dropped_count());
+}
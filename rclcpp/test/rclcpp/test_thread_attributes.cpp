@@ -0,0 +1,125 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include "rclcpp/thread_attributes.hpp"
+
+using rclcpp::ThreadAttributes;
+using rclcpp::ThreadWithAttributes;
+
+TEST(TestThreadAttributes, default_attributes) {
+  std::atomic_bool executed{false};
+  ThreadWithAttributes thread(ThreadAttributes(), [&executed]() {executed = true;});
+  EXPECT_TRUE(thread.joinable());
+  thread.join();
+  EXPECT_FALSE(thread.joinable());
+  EXPECT_TRUE(executed);
+  EXPECT_THROW(thread.join(), std::runtime_error);
+}
+
+TEST(TestThreadAttributes, move) {
+  std::atomic_int executions{0};
+  ThreadWithAttributes thread(ThreadAttributes(), [&executions]() {executions++;});
+  ThreadWithAttributes other(std::move(thread));
+  EXPECT_FALSE(thread.joinable());
+  EXPECT_TRUE(other.joinable());
+  other = ThreadWithAttributes(ThreadAttributes(), [&executions]() {executions++;});
+  other.join();
+  EXPECT_EQ(2, executions.load());
+}
+
+#ifdef __linux__
+TEST(TestThreadAttributes, apply_attributes) {
+  ThreadAttributes attributes;
+  attributes.cpu_affinity = {0};
+  attributes.stack_size = 1024 * 1024;
+  attributes.name = "rclcpp_test_thread_name";
+  attributes.scheduling_policy = rclcpp::ThreadSchedulingPolicy::Other;
+
+  std::string name;
+  bool pinned = false;
+  size_t stack_size = 0;
+  int policy = -1;
+  ThreadWithAttributes thread(
+    attributes, [&]() {
+      char buffer[16] = {};
+      pthread_getname_np(pthread_self(), buffer, sizeof(buffer));
+      name = buffer;
+
+      cpu_set_t cpu_set;
+      CPU_ZERO(&cpu_set);
+      pthread_getaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set);
+      pinned = CPU_COUNT(&cpu_set) == 1 && CPU_ISSET(0, &cpu_set);
+
+      pthread_attr_t attr;
+      pthread_getattr_np(pthread_self(), &attr);
+      pthread_attr_getstacksize(&attr, &stack_size);
+      pthread_attr_destroy(&attr);
+
+      sched_param param;
+      pthread_getschedparam(pthread_self(), &policy, &param);
+    });
+  thread.join();
+
+  // The name is truncated to the maximum length supported by Linux
+  EXPECT_EQ("rclcpp_test_thr", name);
+  EXPECT_TRUE(pinned);
+  EXPECT_EQ(attributes.stack_size, stack_size);
+  EXPECT_EQ(SCHED_OTHER, policy);
+}
+
+TEST(TestThreadAttributes, invalid_attributes) {
+  ThreadAttributes attributes;
+  attributes.cpu_affinity = {CPU_SETSIZE};
+  EXPECT_THROW(ThreadWithAttributes(attributes, []() {}), std::invalid_argument);
+
+  attributes.cpu_affinity.clear();
+  attributes.scheduling_policy = rclcpp::ThreadSchedulingPolicy::Fifo;
+  attributes.priority = -1;
+  EXPECT_THROW(ThreadWithAttributes(attributes, []() {}), std::runtime_error);
+}
+#endif
+
+TEST(TestThreadAttributes, numa_node_cpus) {
+  const auto numa_node_cpus = rclcpp::get_numa_node_cpus();
+  ASSERT_FALSE(numa_node_cpus.empty());
+  for (const auto & cpus : numa_node_cpus) {
+    EXPECT_FALSE(cpus.empty());
+  }
+}
+
+TEST(TestThreadAttributes, make_numa_thread_attributes) {
+  const std::vector<std::vector<size_t>> numa_node_cpus = {{0, 1}, {2, 3}};
+  const auto attributes = rclcpp::make_numa_thread_attributes(3, numa_node_cpus);
+  ASSERT_EQ(3u, attributes.size());
+  EXPECT_EQ(numa_node_cpus[0], attributes[0].cpu_affinity);
+  EXPECT_EQ(numa_node_cpus[1], attributes[1].cpu_affinity);
+  EXPECT_EQ(numa_node_cpus[0], attributes[2].cpu_affinity);
+
+  const auto default_attributes = rclcpp::make_numa_thread_attributes(2, {});
+  ASSERT_EQ(2u, default_attributes.size());
+  EXPECT_TRUE(default_attributes[0].cpu_affinity.empty());
+}
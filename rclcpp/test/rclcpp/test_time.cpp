@@ -15,11 +15,14 @@
 #include <gtest/gtest.h>
 
 #include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <limits>
 #include <memory>
+#include <stdexcept>
 #include <string>
 #include <thread>
+#include <vector>
 
 #include "rcl/error_handling.h"
 #include "rcl/time.h"
@@ -77,6 +80,49 @@ TEST_F(TestTime, clock_jump_callback_destruction_order) {
   }
 }
 
+TEST_F(TestTime, clock_jump_callbacks_thresholds_and_removal) {
+  rclcpp::Clock ros_clock(RCL_ROS_TIME);
+  rcl_clock_t * rcl_clock = ros_clock.get_clock_handle();
+  ASSERT_EQ(RCL_RET_OK, rcl_enable_ros_time_override(rcl_clock));
+  ASSERT_EQ(RCL_RET_OK, rcl_set_ros_time_override(rcl_clock, 1000));
+
+  rcl_jump_threshold_t threshold;
+  threshold.on_clock_change = false;
+  threshold.min_backward.nanoseconds = 0;
+  threshold.min_forward.nanoseconds = 1;
+  rcl_jump_threshold_t invalid_threshold = threshold;
+  invalid_threshold.min_forward.nanoseconds = -1;
+  EXPECT_THROW(
+    ros_clock.create_jump_callback(nullptr, nullptr, invalid_threshold), std::invalid_argument);
+
+  // Handlers noticing forward jumps of increasing sizes, whose own index is recorded
+  std::vector<int> called;
+  std::vector<rclcpp::JumpHandler::SharedPtr> handlers;
+  for (int i = 0; i < 10; ++i) {
+    threshold.min_forward.nanoseconds = 10 * (i + 1);
+    handlers.push_back(
+      ros_clock.create_jump_callback(
+        nullptr, [&called, i](const rcl_time_jump_t &) {called.push_back(i);}, threshold));
+  }
+  // Removed from the front, the back and the middle of the list
+  handlers[0].reset();
+  handlers[9].reset();
+  handlers[4].reset();
+
+  ASSERT_EQ(RCL_RET_OK, rcl_set_ros_time_override(rcl_clock, 1060));
+  EXPECT_EQ((std::vector<int>{1, 2, 3, 5}), called);
+
+  called.clear();
+  handlers.clear();
+  threshold.min_forward.nanoseconds = 1;
+  auto handler = ros_clock.create_jump_callback(
+    nullptr, [&called](const rcl_time_jump_t &) {called.push_back(-1);}, threshold);
+  ASSERT_EQ(RCL_RET_OK, rcl_set_ros_time_override(rcl_clock, 1061));
+  // No backward threshold
+  ASSERT_EQ(RCL_RET_OK, rcl_set_ros_time_override(rcl_clock, 1000));
+  EXPECT_EQ((std::vector<int>{-1}), called);
+}
+
 TEST_F(TestTime, time_sources) {
   using builtin_interfaces::msg::Time;
   rclcpp::Clock ros_clock(RCL_ROS_TIME);
@@ -356,6 +402,31 @@ TEST_F(TestTime, overflows) {
   EXPECT_NO_THROW(one_time - two_time);
 }
 
+TEST_F(TestTime, saturating_arithmetic) {
+  rclcpp::Time max_time(std::numeric_limits<rcl_time_point_value_t>::max(), RCL_STEADY_TIME);
+  rclcpp::Time min_time(std::numeric_limits<rcl_time_point_value_t>::min(), RCL_STEADY_TIME);
+  rclcpp::Duration one(1ns);
+
+  static_assert(noexcept(max_time.saturating_add(one)), "saturating_add should not throw");
+
+  EXPECT_EQ(max_time, max_time.saturating_add(one));
+  EXPECT_EQ(min_time, min_time.saturating_sub(one));
+  EXPECT_EQ(RCL_STEADY_TIME, max_time.saturating_add(one).get_clock_type());
+  EXPECT_EQ(
+    std::numeric_limits<rcl_duration_value_t>::max(),
+    max_time.saturating_sub(min_time).nanoseconds());
+  EXPECT_EQ(
+    std::numeric_limits<rcl_duration_value_t>::min(),
+    min_time.saturating_sub(max_time).nanoseconds());
+
+  rclcpp::Time time(10, 0, RCL_STEADY_TIME);
+  EXPECT_EQ(rclcpp::Time(10, 1, RCL_STEADY_TIME), time.saturating_add(one));
+  EXPECT_EQ(time + one, time.saturating_add(one));
+  EXPECT_EQ(time - one, time.saturating_sub(one));
+  rclcpp::Time earlier(5, 0, RCL_STEADY_TIME);
+  EXPECT_EQ(time - earlier, time.saturating_sub(earlier));
+}
+
 TEST_F(TestTime, seconds) {
   EXPECT_DOUBLE_EQ(0.0, rclcpp::Time(0, 0).seconds());
   EXPECT_DOUBLE_EQ(4.5, rclcpp::Time(4, 500000000).seconds());
@@ -867,6 +938,61 @@ TEST_F(TestClockSleep, sleep_for_basic_ros) {
   EXPECT_TRUE(sleep_succeeded);
 }
 
+TEST_F(TestClockSleep, sleeper_repeated_sleeps_steady) {
+  const auto milliseconds = 50;
+  const auto delay = rclcpp::Duration(0, RCUTILS_MS_TO_NS(milliseconds));
+  rclcpp::ClockSleeper sleeper(std::make_shared<rclcpp::Clock>(RCL_STEADY_TIME));
+  for (int i = 0; i < 3; ++i) {
+    auto sleep_until = sleeper.get_clock()->now() + delay;
+    auto steady_start = std::chrono::steady_clock::now();
+    ASSERT_TRUE(sleeper.sleep_until(sleep_until));
+    auto steady_end = std::chrono::steady_clock::now();
+    EXPECT_GE(sleeper.get_clock()->now(), sleep_until);
+    EXPECT_GE(steady_end - steady_start, std::chrono::milliseconds(milliseconds));
+  }
+
+  RCLCPP_EXPECT_THROW_EQ(
+    sleeper.sleep_until(rclcpp::Time(12345, 0, RCL_SYSTEM_TIME)),
+    std::runtime_error("until's clock type does not match this clock's type"));
+}
+
+TEST_F(TestClockSleep, sleeper_repeated_sleeps_ros) {
+  auto clock = std::make_shared<rclcpp::Clock>(RCL_ROS_TIME);
+  rcl_clock_t * rcl_clock = clock->get_clock_handle();
+  rcl_time_point_value_t time = 1337;
+  ASSERT_EQ(RCL_RET_OK, rcl_enable_ros_time_override(rcl_clock));
+  ASSERT_EQ(RCL_RET_OK, rcl_set_ros_time_override(rcl_clock, time));
+
+  // The jump callback registered once wakes each sleep
+  rclcpp::ClockSleeper sleeper(clock);
+  for (int i = 0; i < 2; ++i) {
+    std::atomic_bool sleep_succeeded{false};
+    auto sleep_thread = std::thread(
+      [&sleeper, &sleep_succeeded]() {
+        sleep_succeeded = sleeper.sleep_for(rclcpp::Duration(0, 1u));
+      });
+
+    // yield execution long enough to let the sleep thread get to waiting on the condition variable
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    EXPECT_FALSE(sleep_succeeded);
+
+    ASSERT_EQ(RCL_RET_OK, rcl_set_ros_time_override(rcl_clock, ++time));
+    sleep_thread.join();
+    EXPECT_TRUE(sleep_succeeded);
+  }
+
+  // Disabling ROS time interrupts the sleep
+  bool sleep_succeeded = true;
+  auto sleep_thread = std::thread(
+    [&sleeper, &sleep_succeeded]() {
+      sleep_succeeded = sleeper.sleep_for(rclcpp::Duration(600, 0));
+    });
+  std::this_thread::sleep_for(std::chrono::milliseconds(200));
+  ASSERT_EQ(RCL_RET_OK, rcl_disable_ros_time_override(rcl_clock));
+  sleep_thread.join();
+  EXPECT_FALSE(sleep_succeeded);
+}
+
 class TestClockStarted : public ::testing::Test
 {
 protected:
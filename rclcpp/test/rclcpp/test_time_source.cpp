@@ -19,6 +19,7 @@
 #include <limits>
 #include <memory>
 #include <string>
+#include <thread>
 
 #include "rcl/error_handling.h"
 #include "rcl/time.h"
@@ -763,6 +764,41 @@ private:
   bool is_callback_frozen_ = true;
 };
 
+TEST_F(TestTimeSource, shared_clock_subscription) {
+  SimClockPublisherNode pub_node;
+  pub_node.SpinNode();
+
+  // The nodes aren't spun, their clocks are updated by the thread of the shared subscription
+  auto options = rclcpp::NodeOptions()
+    .use_shared_clock_subscription(true)
+    .parameter_overrides({rclcpp::Parameter("use_sim_time", true)});
+  auto first_node = std::make_shared<rclcpp::Node>("first_shared_clock_node", options);
+  auto second_node = std::make_shared<rclcpp::Node>("second_shared_clock_node", options);
+
+  auto steady_clock = rclcpp::Clock(RCL_STEADY_TIME);
+  auto start_time = steady_clock.now();
+  while (rclcpp::ok() &&
+    (first_node->now().nanoseconds() == 0 || second_node->now().nanoseconds() == 0) &&
+    (steady_clock.now() - start_time).seconds() < 5.0)
+  {
+    std::this_thread::sleep_for(10ms);
+  }
+  EXPECT_TRUE(first_node->get_clock()->ros_time_is_active());
+  EXPECT_NE(0L, first_node->now().nanoseconds());
+  EXPECT_NE(0L, second_node->now().nanoseconds());
+
+  // The subscription keeps updating the clock of the remaining node
+  first_node.reset();
+  auto last_time = second_node->now();
+  start_time = steady_clock.now();
+  while (rclcpp::ok() && second_node->now() == last_time &&
+    (steady_clock.now() - start_time).seconds() < 5.0)
+  {
+    std::this_thread::sleep_for(10ms);
+  }
+  EXPECT_GT(second_node->now(), last_time);
+}
+
 // TODO(ivanpauno): This test was using a wall timer, when it was supposed to use sim time.
 //   It was also using `use_clock_tread = false`, when it was supposed to be `true`.
 //   Fixing the test to work as originally intended makes it super flaky.
@@ -14,11 +14,15 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <exception>
 #include <memory>
+#include <stdexcept>
+#include <thread>
 #include <utility>
+#include <vector>
 
 #include "rcl/timer.h"
 
@@ -364,3 +368,113 @@ TEST_P(TestTimer, test_timer_without_autostart)
     std::chrono::nanoseconds::max().count());
   EXPECT_FALSE(timer_without_autostart->is_canceled());
 }
+
+TEST_P(TestTimer, last_call_info) {
+  EXPECT_EQ(0, timer->get_last_call_info().actual_call_time.nanoseconds());
+  EXPECT_EQ(0u, timer->get_statistics().call_count);
+
+  rclcpp::TimerInfo callback_info{};
+  bool called = false;
+  auto timer_callback = [&callback_info, &called](const rclcpp::TimerInfo & info) {
+      callback_info = info;
+      called = true;
+    };
+  switch (timer_type) {
+    case TimerType::WALL_TIMER:
+      timer = test_node->create_wall_timer(10ms, timer_callback);
+      break;
+    case TimerType::GENERIC_TIMER:
+      timer = test_node->create_timer(10ms, timer_callback);
+      break;
+  }
+  // Miss a few periods before the first call
+  std::this_thread::sleep_for(45ms);
+  auto start = std::chrono::steady_clock::now();
+  while (!called && (std::chrono::steady_clock::now() - start) < 1s) {
+    executor->spin_once(10ms);
+  }
+  ASSERT_TRUE(called);
+
+  EXPECT_LE(35ms, callback_info.lateness);
+  EXPECT_LE(3u, callback_info.missed_periods);
+  EXPECT_EQ(
+    callback_info.lateness.count(),
+    (callback_info.actual_call_time - callback_info.expected_call_time).nanoseconds());
+  const rclcpp::TimerInfo last_call_info = timer->get_last_call_info();
+  EXPECT_EQ(callback_info.actual_call_time, last_call_info.actual_call_time);
+
+  const rclcpp::TimerStatistics statistics = timer->get_statistics();
+  EXPECT_EQ(1u, statistics.call_count);
+  EXPECT_EQ(callback_info.missed_periods, statistics.missed_periods);
+  EXPECT_EQ(callback_info.lateness, statistics.max_lateness);
+
+  timer->reset_statistics();
+  EXPECT_EQ(0u, timer->get_statistics().call_count);
+  EXPECT_EQ(0ns, timer->get_statistics().max_lateness);
+}
+
+TEST_P(TestTimer, slack) {
+  EXPECT_EQ(0ns, timer->get_slack());
+  EXPECT_THROW(timer->set_slack(-1ms), std::invalid_argument);
+  // Not less than the period of the timer
+  EXPECT_THROW(timer->set_slack(100ms), std::invalid_argument);
+  EXPECT_EQ(0ns, timer->get_slack());
+
+  // The slow timer expires within its slack when the fast one is called, long before 1s
+  std::atomic_bool fast_called{false};
+  std::atomic_bool slow_called{false};
+  auto fast_timer = rclcpp::create_wall_timer(
+    200ms, [&fast_called]() {fast_called = true;}, nullptr,
+    test_node->get_node_base_interface().get(), test_node->get_node_timers_interface().get());
+  auto slow_timer = rclcpp::create_wall_timer(
+    1s, [&slow_called]() {slow_called = true;}, nullptr,
+    test_node->get_node_base_interface().get(), test_node->get_node_timers_interface().get(),
+    true, 900ms);
+  EXPECT_EQ(900ms, slow_timer->get_slack());
+  EXPECT_NE(0ns, slow_timer->time_until_trigger());
+
+  auto start = std::chrono::steady_clock::now();
+  while (!(fast_called && slow_called) && (std::chrono::steady_clock::now() - start) < 950ms) {
+    executor->spin_once(10ms);
+  }
+  EXPECT_TRUE(fast_called);
+  EXPECT_TRUE(slow_called);
+
+  // Only the timers with a slack are reported
+  std::vector<const rcl_timer_t *> timers_with_slack;
+  rclcpp::TimerBase::get_timers_with_slack(timers_with_slack);
+  const auto has_slack = [&timers_with_slack](const rclcpp::TimerBase::SharedPtr & timer) {
+      return std::find(
+        timers_with_slack.begin(), timers_with_slack.end(),
+        timer->get_timer_handle().get()) != timers_with_slack.end();
+    };
+  EXPECT_TRUE(has_slack(slow_timer));
+  EXPECT_FALSE(has_slack(fast_timer));
+  slow_timer->set_slack(0ns);
+  rclcpp::TimerBase::get_timers_with_slack(timers_with_slack);
+  EXPECT_FALSE(has_slack(slow_timer));
+}
+
+TEST_P(TestTimer, touch) {
+  std::atomic<int> watchdog_count{0};
+  auto watchdog = rclcpp::create_wall_timer(
+    100ms, [&watchdog_count]() {watchdog_count++;}, nullptr,
+    test_node->get_node_base_interface().get(), test_node->get_node_timers_interface().get());
+
+  // Touched more often than its period, the watchdog doesn't expire
+  auto start = std::chrono::steady_clock::now();
+  while ((std::chrono::steady_clock::now() - start) < 350ms) {
+    watchdog->touch();
+    executor->spin_once(20ms);
+  }
+  EXPECT_EQ(0, watchdog_count);
+  EXPECT_LE(watchdog->time_until_trigger(), 100ms);
+
+  // It expires a period after the last touch
+  start = std::chrono::steady_clock::now();
+  while (watchdog_count == 0 && (std::chrono::steady_clock::now() - start) < 1s) {
+    executor->spin_once(10ms);
+  }
+  EXPECT_EQ(1, watchdog_count);
+  EXPECT_GE(std::chrono::steady_clock::now() - start, 50ms);
+}
@@ -25,6 +25,7 @@
 using namespace std::chrono_literals;
 
 using rclcpp::experimental::TimersManager;
+using rclcpp::experimental::TimersStorageType;
 
 using CallbackT = std::function<void ()>;
 using TimerT = rclcpp::WallTimer<CallbackT>;
@@ -359,3 +360,126 @@ TEST_F(TestTimersManager, infinite_loop)
   EXPECT_LT(0u, t1_runs);
   EXPECT_LT(0u, t2_runs);
 }
+
+TEST_F(TestTimersManager, timing_wheel_head_timeout)
+{
+  auto timers_manager = std::make_shared<TimersManager>(
+    rclcpp::contexts::get_global_default_context(), nullptr, TimersStorageType::TimingWheel);
+
+  EXPECT_EQ(std::chrono::nanoseconds::max(), timers_manager->get_head_timeout());
+
+  size_t t1_runs = 0;
+  auto t1 = TimerT::make_shared(
+    10s,
+    [&t1_runs]() {
+      t1_runs++;
+    },
+    rclcpp::contexts::get_global_default_context());
+  size_t t2_runs = 0;
+  auto t2 = TimerT::make_shared(
+    20ms,
+    [&t2_runs]() {
+      t2_runs++;
+    },
+    rclcpp::contexts::get_global_default_context());
+
+  timers_manager->add_timer(t1);
+  timers_manager->add_timer(t2);
+
+  // The timeout never exceeds the time until the first timer triggers
+  auto timeout = timers_manager->get_head_timeout();
+  EXPECT_LE(timeout, 20ms);
+  EXPECT_FALSE(timers_manager->execute_head_timer());
+
+  std::this_thread::sleep_for(30ms);
+  EXPECT_EQ(1u, timers_manager->get_number_ready_timers());
+  execute_all_ready_timers(timers_manager);
+  EXPECT_EQ(0u, t1_runs);
+  EXPECT_EQ(1u, t2_runs);
+
+  // Canceled timers are never reported as ready
+  t2->cancel();
+  std::this_thread::sleep_for(30ms);
+  execute_all_ready_timers(timers_manager);
+  EXPECT_EQ(1u, t2_runs);
+
+  timers_manager->remove_timer(t2);
+  EXPECT_GT(timers_manager->get_head_timeout(), 1s);
+}
+
+TEST_F(TestTimersManager, timing_wheel_reset_timer)
+{
+  auto timers_manager = std::make_shared<TimersManager>(
+    rclcpp::contexts::get_global_default_context(), nullptr, TimersStorageType::TimingWheel);
+
+  size_t t_runs = 0;
+  auto t = TimerT::make_shared(
+    50ms,
+    [&t_runs]() {
+      t_runs++;
+    },
+    rclcpp::contexts::get_global_default_context());
+  timers_manager->add_timer(t);
+
+  // Resetting the timer moves its trigger time forward
+  std::this_thread::sleep_for(30ms);
+  t->reset();
+  std::this_thread::sleep_for(30ms);
+  execute_all_ready_timers(timers_manager);
+  EXPECT_EQ(0u, t_runs);
+
+  std::this_thread::sleep_for(40ms);
+  execute_all_ready_timers(timers_manager);
+  EXPECT_EQ(1u, t_runs);
+
+  // A canceled timer is scheduled again when it's reset
+  t->cancel();
+  t->reset();
+  std::this_thread::sleep_for(60ms);
+  execute_all_ready_timers(timers_manager);
+  EXPECT_EQ(2u, t_runs);
+}
+
+TEST_F(TestTimersManager, timing_wheel_timers_thread)
+{
+  auto timers_manager = std::make_shared<TimersManager>(
+    rclcpp::contexts::get_global_default_context(), nullptr, TimersStorageType::TimingWheel);
+
+  int t1_runs = 0;
+  auto t1 = TimerT::make_shared(
+    5ms,
+    [&t1_runs]() {
+      t1_runs++;
+    },
+    rclcpp::contexts::get_global_default_context());
+
+  int t2_runs = 0;
+  auto t2 = TimerT::make_shared(
+    5ms,
+    [&t2_runs]() {
+      t2_runs++;
+    },
+    rclcpp::contexts::get_global_default_context());
+
+  std::weak_ptr<TimerT> t2_weak = t2;
+
+  timers_manager->add_timer(t1);
+  timers_manager->add_timer(t2);
+
+  // Run timers thread for a while
+  timers_manager->start();
+  std::this_thread::sleep_for(100ms);
+  timers_manager->stop();
+
+  EXPECT_LT(1, t1_runs);
+  EXPECT_LT(1, t2_runs);
+  EXPECT_LE(std::abs(t1_runs - t2_runs), 1);
+
+  // Timers going out of scope are dropped from the wheel
+  t2.reset();
+  EXPECT_FALSE(t2_weak.lock() != nullptr);
+  timers_manager->start();
+  std::this_thread::sleep_for(20ms);
+  timers_manager->stop();
+  EXPECT_LT(1, t1_runs);
+}
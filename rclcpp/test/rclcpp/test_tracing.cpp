@@ -0,0 +1,63 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+#include "rclcpp/tracing.hpp"
+
+using rclcpp::tracing::Subsystem;
+
+class TestTracing : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    mask_ = rclcpp::tracing::get_enabled_subsystems();
+  }
+
+  void TearDown() override
+  {
+    rclcpp::tracing::set_enabled_subsystems(mask_);
+  }
+
+private:
+  uint32_t mask_;
+};
+
+TEST_F(TestTracing, all_enabled_by_default) {
+  EXPECT_EQ(static_cast<uint32_t>(Subsystem::All), rclcpp::tracing::get_enabled_subsystems());
+  EXPECT_TRUE(rclcpp::tracing::is_enabled(Subsystem::Executor));
+  EXPECT_TRUE(rclcpp::tracing::is_enabled(Subsystem::Callback));
+}
+
+TEST_F(TestTracing, enable_and_disable) {
+  rclcpp::tracing::disable(Subsystem::IntraProcess);
+  EXPECT_FALSE(rclcpp::tracing::is_enabled(Subsystem::IntraProcess));
+  EXPECT_TRUE(rclcpp::tracing::is_enabled(Subsystem::Publisher));
+
+  rclcpp::tracing::set_enabled_subsystems(static_cast<uint32_t>(Subsystem::Executor));
+  EXPECT_TRUE(rclcpp::tracing::is_enabled(Subsystem::Executor));
+  EXPECT_FALSE(rclcpp::tracing::is_enabled(Subsystem::Publisher));
+  // Disabled subsystems skip the tracepoint, including the evaluation of its arguments
+  int evaluated = 0;
+  RCLCPP_TRACEPOINT(Publisher, rclcpp_executor_wait_for_work, ++evaluated);
+  EXPECT_EQ(0, evaluated);
+
+  rclcpp::tracing::enable(Subsystem::IntraProcess);
+  EXPECT_TRUE(rclcpp::tracing::is_enabled(Subsystem::IntraProcess));
+  rclcpp::tracing::set_enabled_subsystems(0u);
+  EXPECT_FALSE(rclcpp::tracing::is_enabled(Subsystem::All));
+}
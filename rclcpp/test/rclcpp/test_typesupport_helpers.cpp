@@ -61,6 +61,34 @@ TEST(TypesupportHelpersTest, returns_c_type_info_for_valid_legacy_library) {
   }
 }
 
+TEST(TypesupportHelpersTest, caches_library_and_handle) {
+  try {
+    auto library = rclcpp::get_typesupport_library(
+      "test_msgs/msg/BasicTypes", "rosidl_typesupport_cpp");
+    // Another type of the same package uses the same library
+    auto same_library = rclcpp::get_typesupport_library(
+      "test_msgs/msg/Strings", "rosidl_typesupport_cpp");
+    EXPECT_EQ(library, same_library);
+
+    auto handle = rclcpp::get_message_typesupport_handle(
+      "test_msgs/msg/BasicTypes", "rosidl_typesupport_cpp", *library);
+    EXPECT_EQ(
+      handle, rclcpp::get_message_typesupport_handle(
+        "test_msgs/msg/BasicTypes", "rosidl_typesupport_cpp", *same_library));
+    EXPECT_NE(
+      handle, rclcpp::get_message_typesupport_handle(
+        "test_msgs/msg/Strings", "rosidl_typesupport_cpp", *library));
+
+    // The library isn't kept loaded once it's not used anymore
+    std::weak_ptr<rcpputils::SharedLibrary> weak_library = library;
+    library.reset();
+    same_library.reset();
+    EXPECT_TRUE(weak_library.expired());
+  } catch (const std::runtime_error & e) {
+    FAIL() << e.what();
+  }
+}
+
 TEST(TypesupportHelpersTest, returns_c_type_info_for_valid_library) {
   try {
     auto library = rclcpp::get_typesupport_library(
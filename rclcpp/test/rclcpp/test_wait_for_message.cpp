@@ -107,3 +107,40 @@ TEST(TestUtilities, wait_for_message_twice_one_sub) {
 
   rclcpp::shutdown();
 }
+
+TEST(TestUtilities, message_waiter) {
+  rclcpp::init(0, nullptr);
+
+  auto node = std::make_shared<rclcpp::Node>("wait_for_message_node4");
+
+  using MsgT = test_msgs::msg::Strings;
+  auto pub = node->create_publisher<MsgT>("message_waiter_topic", 10);
+  auto sub = node->create_subscription<MsgT>(
+    "message_waiter_topic", 10, [](const std::shared_ptr<const MsgT>) {});
+  rclcpp::MessageWaiter<MsgT> waiter(sub, node->get_node_options().context());
+
+  MsgT out;
+  EXPECT_FALSE(waiter.wait_for_message(out, 10ms));
+
+  for (auto i = 0u; i < 50u && pub->get_subscription_count() == 0u; ++i) {
+    std::this_thread::sleep_for(100ms);
+  }
+  ASSERT_EQ(1u, pub->get_subscription_count());
+
+  // The same waiter is reused for several waits
+  for (auto i = 0u; i < 3u; ++i) {
+    pub->publish(*get_messages_strings()[0]);
+  }
+  std::vector<MsgT> messages;
+  EXPECT_EQ(3u, waiter.wait_for_messages(messages, 3u, 5s));
+  ASSERT_EQ(3u, messages.size());
+  EXPECT_EQ(messages[2], *get_messages_strings()[0]);
+
+  // The count of messages wasn't reached before the timeout
+  pub->publish(*get_messages_strings()[0]);
+  EXPECT_EQ(1u, waiter.wait_for_messages(messages, 2u, 100ms));
+  EXPECT_EQ(4u, messages.size());
+
+  rclcpp::shutdown();
+  EXPECT_FALSE(waiter.wait_for_message(out, 5s));
+}
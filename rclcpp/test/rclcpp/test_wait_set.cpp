@@ -359,3 +359,42 @@ TEST_F(TestWaitSet, get_result_from_wait_result_not_ready_error) {
     const_result.get_wait_set(),
     std::runtime_error("cannot access wait set when the result was not ready"));
 }
+
+TEST_F(TestWaitSet, get_ready_indices_from_wait_result) {
+  rclcpp::WaitSet wait_set;
+  std::vector<rclcpp::GuardCondition::SharedPtr> guard_conditions;
+  for (size_t i = 0; i < 3; ++i) {
+    guard_conditions.push_back(std::make_shared<rclcpp::GuardCondition>());
+    wait_set.add_guard_condition(guard_conditions.back());
+  }
+  guard_conditions[1]->trigger();
+
+  rclcpp::WaitResult<rclcpp::WaitSet> result = wait_set.wait();
+  ASSERT_EQ(rclcpp::WaitResultKind::Ready, result.kind());
+  const rclcpp::ReadyEntityIndices & ready = result.get_ready_indices();
+  ASSERT_EQ(1u, ready.guard_conditions.size());
+  EXPECT_EQ(
+    &guard_conditions[1]->get_rcl_guard_condition(),
+    wait_set.get_rcl_wait_set().guard_conditions[ready.guard_conditions[0]]);
+  EXPECT_TRUE(ready.subscriptions.empty());
+  EXPECT_TRUE(ready.timers.empty());
+  EXPECT_TRUE(ready.clients.empty());
+  EXPECT_TRUE(ready.services.empty());
+  EXPECT_TRUE(ready.events.empty());
+
+  // The indices are kept by the moved result
+  const rclcpp::WaitResult<rclcpp::WaitSet> const_result(std::move(result));
+  EXPECT_EQ(1u, const_result.get_ready_indices().guard_conditions.size());
+}
+
+TEST_F(TestWaitSet, get_ready_indices_from_wait_result_not_ready_error) {
+  rclcpp::WaitSet wait_set;
+  auto guard_condition = std::make_shared<rclcpp::GuardCondition>();
+  wait_set.add_guard_condition(guard_condition);
+
+  rclcpp::WaitResult<rclcpp::WaitSet> result = wait_set.wait(std::chrono::milliseconds(10));
+  ASSERT_EQ(rclcpp::WaitResultKind::Timeout, result.kind());
+  RCLCPP_EXPECT_THROW_EQ(
+    result.get_ready_indices(),
+    std::runtime_error("cannot access wait set when the result was not ready"));
+}
@@ -0,0 +1,134 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "rclcpp/rclcpp.hpp"
+#include "rclcpp/topic_statistics/executor_backlog_statistics.hpp"
+
+#include "statistics_msgs/msg/metrics_message.hpp"
+#include "statistics_msgs/msg/statistic_data_type.hpp"
+
+#include "test_msgs/msg/empty.hpp"
+
+using rclcpp::topic_statistics::ExecutorBacklogStatistics;
+using statistics_msgs::msg::MetricsMessage;
+using statistics_msgs::msg::StatisticDataType;
+
+namespace
+{
+constexpr const char kTestNodeName[]{"test_executor_backlog_node"};
+constexpr const char kTestTopic[]{"/test_executor_backlog_topic"};
+constexpr const char kTestStatisticsTopic[]{"/test_executor_backlog_statistics"};
+
+/// Return the value of the given type of data point, or NaN if it is not present.
+double
+get_data(const MetricsMessage & message, uint8_t data_type)
+{
+  for (const auto & data_point : message.statistics) {
+    if (data_point.data_type == data_type) {
+      return data_point.data;
+    }
+  }
+  return std::nan("");
+}
+
+/// Return the message of the given metric, which is expected to be present.
+const MetricsMessage &
+get_metric(const std::vector<MetricsMessage> & messages, const std::string & metric_name)
+{
+  for (const auto & message : messages) {
+    if (message.metrics_source == metric_name) {
+      return message;
+    }
+  }
+  throw std::runtime_error("metric not found: " + metric_name);
+}
+}  // namespace
+
+class TestExecutorBacklogStatisticsFixture : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    rclcpp::init(0, nullptr);
+    node = std::make_shared<rclcpp::Node>(kTestNodeName);
+  }
+
+  void TearDown() override
+  {
+    node.reset();
+    rclcpp::shutdown();
+  }
+
+  rclcpp::Node::SharedPtr node;
+};
+
+TEST_F(TestExecutorBacklogStatisticsFixture, test_invalid_arguments)
+{
+  rclcpp::executors::SingleThreadedExecutor executor;
+  EXPECT_THROW(
+    ExecutorBacklogStatistics(kTestNodeName, executor, nullptr), std::invalid_argument);
+  auto other_publisher = node->create_publisher<test_msgs::msg::Empty>(kTestTopic, 10);
+  EXPECT_THROW(
+    ExecutorBacklogStatistics(kTestNodeName, executor, other_publisher), std::invalid_argument);
+  EXPECT_THROW(
+    rclcpp::topic_statistics::create_executor_backlog_statistics(
+      node->get_node_topics_interface().get(), executor, std::chrono::milliseconds(0)),
+    std::invalid_argument);
+}
+
+TEST_F(TestExecutorBacklogStatisticsFixture, test_generated_messages)
+{
+  rclcpp::executors::SingleThreadedExecutor executor;
+  executor.add_node(node);
+
+  rclcpp::PublisherOptions publisher_options;
+  publisher_options.use_intra_process_comm = rclcpp::IntraProcessSetting::Enable;
+  auto publisher = node->create_publisher<test_msgs::msg::Empty>(
+    kTestTopic, 10, publisher_options);
+  rclcpp::SubscriptionOptions subscription_options;
+  subscription_options.use_intra_process_comm = rclcpp::IntraProcessSetting::Enable;
+  auto subscription = node->create_subscription<test_msgs::msg::Empty>(
+    kTestTopic, 2, [](test_msgs::msg::Empty::ConstSharedPtr) {}, subscription_options);
+
+  auto statistics_publisher = node->create_publisher<MetricsMessage>(kTestStatisticsTopic, 10);
+  ExecutorBacklogStatistics statistics(kTestNodeName, executor, statistics_publisher);
+
+  for (int i = 0; i < 3; ++i) {
+    publisher->publish(test_msgs::msg::Empty());
+  }
+
+  const auto messages = statistics.generate_messages();
+  ASSERT_EQ(3u, messages.size());
+  const auto & queued =
+    get_metric(messages, rclcpp::topic_statistics::kIntraProcessQueuedMetricName);
+  EXPECT_EQ(subscription->get_topic_name(), queued.measurement_source_name);
+  EXPECT_EQ(2.0, get_data(queued, StatisticDataType::STATISTICS_DATA_TYPE_AVERAGE));
+  const auto & dropped =
+    get_metric(messages, rclcpp::topic_statistics::kIntraProcessDroppedMetricName);
+  EXPECT_EQ(1.0, get_data(dropped, StatisticDataType::STATISTICS_DATA_TYPE_SAMPLE_COUNT));
+  const auto & events_queue_size =
+    get_metric(messages, rclcpp::topic_statistics::kEventsQueueSizeMetricName);
+  EXPECT_EQ(kTestNodeName, events_queue_size.measurement_source_name);
+  EXPECT_EQ(
+    0.0, get_data(events_queue_size, StatisticDataType::STATISTICS_DATA_TYPE_AVERAGE));
+}
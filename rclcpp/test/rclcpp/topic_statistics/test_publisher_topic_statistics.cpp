@@ -0,0 +1,189 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "rclcpp/rclcpp.hpp"
+#include "rclcpp/topic_statistics/publisher_topic_statistics.hpp"
+
+#include "statistics_msgs/msg/metrics_message.hpp"
+#include "statistics_msgs/msg/statistic_data_type.hpp"
+
+#include "test_msgs/msg/empty.hpp"
+
+#include "test_topic_stats_utils.hpp"
+
+using rclcpp::topic_statistics::PublisherTopicStatistics;
+using statistics_msgs::msg::MetricsMessage;
+using statistics_msgs::msg::StatisticDataType;
+
+namespace
+{
+constexpr const char kTestNodeName[]{"test_pub_stats_node"};
+constexpr const char kTestTopic[]{"/test_pub_stats_topic"};
+constexpr const char kTestStatisticsTopic[]{"/test_pub_stats_statistics"};
+
+/// Return the value of the given type of data point, or NaN if it is not present.
+double
+get_data(const MetricsMessage & message, uint8_t data_type)
+{
+  for (const auto & data_point : message.statistics) {
+    if (data_point.data_type == data_type) {
+      return data_point.data;
+    }
+  }
+  return std::nan("");
+}
+
+/// Return the message of the given metric, which is expected to be present.
+const MetricsMessage &
+get_metric(const std::vector<MetricsMessage> & messages, const std::string & metric_name)
+{
+  for (const auto & message : messages) {
+    if (message.metrics_source == metric_name) {
+      return message;
+    }
+  }
+  throw std::runtime_error("metric not found: " + metric_name);
+}
+}  // namespace
+
+/// Wrapper class to expose the generated messages.
+class TestPublisherTopicStatistics : public PublisherTopicStatistics
+{
+public:
+  using PublisherTopicStatistics::PublisherTopicStatistics;
+  using PublisherTopicStatistics::generate_messages_and_reset_measurements;
+};
+
+class TestPublisherTopicStatisticsFixture : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    rclcpp::init(0, nullptr);
+    node = std::make_shared<rclcpp::Node>(kTestNodeName);
+  }
+
+  void TearDown() override
+  {
+    node.reset();
+    rclcpp::shutdown();
+  }
+
+  rclcpp::Node::SharedPtr node;
+};
+
+TEST_F(TestPublisherTopicStatisticsFixture, test_invalid_arguments)
+{
+  EXPECT_THROW(
+    TestPublisherTopicStatistics(kTestNodeName, nullptr), std::invalid_argument);
+  auto other_publisher = node->create_publisher<test_msgs::msg::Empty>(kTestTopic, 10);
+  EXPECT_THROW(
+    TestPublisherTopicStatistics(kTestNodeName, other_publisher), std::invalid_argument);
+
+  rclcpp::PublisherOptions options;
+  options.topic_stats_options.state = rclcpp::TopicStatisticsState::Enable;
+  options.topic_stats_options.publish_period = std::chrono::milliseconds(0);
+  EXPECT_THROW(
+    node->create_publisher<test_msgs::msg::Empty>(kTestTopic, 10, options),
+    std::invalid_argument);
+}
+
+TEST_F(TestPublisherTopicStatisticsFixture, test_generated_messages)
+{
+  auto statistics_publisher = node->create_publisher<MetricsMessage>(kTestStatisticsTopic, 10);
+  TestPublisherTopicStatistics statistics(kTestNodeName, statistics_publisher);
+
+  for (int i = 0; i < 3; ++i) {
+    PublisherTopicStatistics::PublishScope scope(&statistics);
+    // Nested publish calls are part of the outer one
+    PublisherTopicStatistics::PublishScope nested_scope(&statistics);
+    statistics.record_inter_process_publication(i == 0);
+    statistics.record_published_bytes(100);
+  }
+  statistics.record_intra_process_publication();
+
+  auto messages = statistics.generate_messages_and_reset_measurements();
+  ASSERT_EQ(5u, messages.size());
+  const auto count = StatisticDataType::STATISTICS_DATA_TYPE_SAMPLE_COUNT;
+  const auto & publish_duration =
+    get_metric(messages, rclcpp::topic_statistics::kPublishDurationMetricName);
+  EXPECT_EQ(kTestNodeName, publish_duration.measurement_source_name);
+  EXPECT_EQ("ms", publish_duration.unit);
+  EXPECT_EQ(3.0, get_data(publish_duration, count));
+  EXPECT_GE(get_data(publish_duration, StatisticDataType::STATISTICS_DATA_TYPE_MINIMUM), 0.0);
+  EXPECT_EQ(
+    1.0, get_data(
+      get_metric(messages, rclcpp::topic_statistics::kIntraProcessPublicationsMetricName),
+      count));
+  EXPECT_EQ(
+    3.0, get_data(
+      get_metric(messages, rclcpp::topic_statistics::kInterProcessPublicationsMetricName),
+      count));
+  EXPECT_EQ(
+    1.0, get_data(
+      get_metric(messages, rclcpp::topic_statistics::kLoanedPublicationsMetricName), count));
+  const auto & published_bytes_rate =
+    get_metric(messages, rclcpp::topic_statistics::kPublishedBytesRateMetricName);
+  EXPECT_EQ(3.0, get_data(published_bytes_rate, count));
+  EXPECT_GT(
+    get_data(published_bytes_rate, StatisticDataType::STATISTICS_DATA_TYPE_AVERAGE), 0.0);
+
+  // The measurements are reset for the next window
+  messages = statistics.generate_messages_and_reset_measurements();
+  for (const auto & message : messages) {
+    EXPECT_EQ(0.0, get_data(message, count)) << message.metrics_source;
+  }
+}
+
+TEST_F(TestPublisherTopicStatisticsFixture, test_publisher_statistics_are_published)
+{
+  rclcpp::PublisherOptions options;
+  options.topic_stats_options.state = rclcpp::TopicStatisticsState::Enable;
+  options.topic_stats_options.publish_topic = kTestStatisticsTopic;
+  options.topic_stats_options.publish_period = std::chrono::milliseconds(100);
+  auto publisher = node->create_publisher<test_msgs::msg::Empty>(kTestTopic, 10, options);
+  auto timer = node->create_wall_timer(
+    std::chrono::milliseconds(10), [publisher]() {publisher->publish(test_msgs::msg::Empty());});
+
+  // Two windows of the five metrics
+  auto statistics_listener = std::make_shared<rclcpp::topic_statistics::MetricsMessageSubscriber>(
+    "test_publisher_statistics_listener", kTestStatisticsTopic, 10);
+
+  rclcpp::executors::SingleThreadedExecutor executor;
+  executor.add_node(node);
+  executor.add_node(statistics_listener);
+  ASSERT_EQ(
+    rclcpp::FutureReturnCode::SUCCESS,
+    executor.spin_until_future_complete(
+      statistics_listener->GetFuture(), std::chrono::seconds(10)));
+
+  uint64_t inter_process_publications = 0;
+  for (const auto & message : statistics_listener->GetReceivedMessages()) {
+    EXPECT_EQ(kTestNodeName, message.measurement_source_name);
+    if (message.metrics_source == rclcpp::topic_statistics::kInterProcessPublicationsMetricName) {
+      inter_process_publications += static_cast<uint64_t>(
+        get_data(message, StatisticDataType::STATISTICS_DATA_TYPE_SAMPLE_COUNT));
+    }
+  }
+  EXPECT_GT(inter_process_publications, 0u);
+}
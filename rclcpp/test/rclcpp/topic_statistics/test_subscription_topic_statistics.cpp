@@ -21,6 +21,7 @@
 #include <set>
 #include <stdexcept>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -301,6 +302,113 @@ TEST_F(TestSubscriptionTopicStatisticsFixture, test_manual_construction)
   }
 }
 
+/**
+ * Handle messages from multiple threads, and verify that every one of them is measured.
+ */
+TEST_F(TestSubscriptionTopicStatisticsFixture, test_concurrent_handle_message)
+{
+  auto empty_subscriber = std::make_shared<SubscriberWithTopicStatistics<Empty>>(
+    kTestSubNodeName,
+    kTestSubStatsEmptyTopic);
+  auto topic_stats_publisher =
+    empty_subscriber->create_publisher<MetricsMessage>(kTestTopicStatisticsTopic, 10);
+  auto sub_topic_stats = std::make_unique<TestSubscriptionTopicStatistics>(
+    empty_subscriber->get_name(),
+    topic_stats_publisher);
+
+  constexpr size_t kNumThreads{4};
+  constexpr size_t kNumMessagesPerThread{1000};
+  constexpr int64_t kMessageAgeNanoseconds{2000000};
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < kNumThreads; ++i) {
+    threads.emplace_back(
+      [&sub_topic_stats]() {
+        for (size_t j = 1; j <= kNumMessagesPerThread; ++j) {
+          rmw_message_info_t message_info{};
+          message_info.source_timestamp = static_cast<int64_t>(j) * 1000000;
+          sub_topic_stats->handle_message(
+            message_info, rclcpp::Time(message_info.source_timestamp + kMessageAgeNanoseconds));
+        }
+      });
+  }
+  for (auto & thread : threads) {
+    thread.join();
+  }
+
+  const auto data = sub_topic_stats->get_current_collector_data();
+  ASSERT_EQ(2u, data.size());
+  // Message age, in milliseconds
+  EXPECT_EQ(kNumThreads * kNumMessagesPerThread, data[0].sample_count);
+  EXPECT_DOUBLE_EQ(2.0, data[0].average);
+  EXPECT_DOUBLE_EQ(2.0, data[0].min);
+  EXPECT_DOUBLE_EQ(2.0, data[0].max);
+  EXPECT_NEAR(0.0, data[0].standard_deviation, 1e-6);
+  // Message period, messages received out of order are not measured
+  EXPECT_GT(data[1].sample_count, 0u);
+  EXPECT_LT(data[1].sample_count, kNumThreads * kNumMessagesPerThread);
+  EXPECT_GE(data[1].min, 0.0);
+}
+
+/**
+ * Handle messages without a source timestamp, whose age is not measured.
+ */
+TEST_F(TestSubscriptionTopicStatisticsFixture, test_handle_message_without_source_timestamp)
+{
+  auto empty_subscriber = std::make_shared<SubscriberWithTopicStatistics<Empty>>(
+    kTestSubNodeName,
+    kTestSubStatsEmptyTopic);
+  auto topic_stats_publisher =
+    empty_subscriber->create_publisher<MetricsMessage>(kTestTopicStatisticsTopic, 10);
+  auto sub_topic_stats = std::make_unique<TestSubscriptionTopicStatistics>(
+    empty_subscriber->get_name(),
+    topic_stats_publisher);
+
+  rmw_message_info_t message_info{};
+  message_info.source_timestamp = 0;
+  sub_topic_stats->handle_message(message_info, rclcpp::Time(1000000));
+  sub_topic_stats->handle_message(message_info, rclcpp::Time(3000000));
+  // Nor is it measured without the current time
+  message_info.source_timestamp = 1000000;
+  sub_topic_stats->handle_message(message_info, rclcpp::Time(0));
+
+  const auto data = sub_topic_stats->get_current_collector_data();
+  ASSERT_EQ(2u, data.size());
+  // Message age
+  EXPECT_EQ(kNoSamples, data[0].sample_count);
+  // Message period, still measured
+  EXPECT_EQ(1u, data[1].sample_count);
+  EXPECT_DOUBLE_EQ(2.0, data[1].average);
+}
+
+/**
+ * Handle the buffer dwell time of intra-process messages, measured once it's enabled.
+ */
+TEST_F(TestSubscriptionTopicStatisticsFixture, test_buffer_dwell_time)
+{
+  auto empty_subscriber = std::make_shared<SubscriberWithTopicStatistics<Empty>>(
+    kTestSubNodeName,
+    kTestSubStatsEmptyTopic);
+  auto topic_stats_publisher =
+    empty_subscriber->create_publisher<MetricsMessage>(kTestTopicStatisticsTopic, 10);
+  auto sub_topic_stats = std::make_unique<TestSubscriptionTopicStatistics>(
+    empty_subscriber->get_name(),
+    topic_stats_publisher);
+  EXPECT_EQ(2u, sub_topic_stats->get_current_collector_data().size());
+
+  sub_topic_stats->enable_buffer_dwell_time();
+  sub_topic_stats->handle_buffer_dwell_time(std::chrono::milliseconds(1));
+  sub_topic_stats->handle_buffer_dwell_time(std::chrono::milliseconds(3));
+
+  const auto data = sub_topic_stats->get_current_collector_data();
+  ASSERT_EQ(3u, data.size());
+  EXPECT_EQ(2u, data[2].sample_count);
+  EXPECT_DOUBLE_EQ(2.0, data[2].average);
+  EXPECT_DOUBLE_EQ(1.0, data[2].min);
+  EXPECT_DOUBLE_EQ(3.0, data[2].max);
+  // Messages delivered intra-process are not measured as received messages
+  EXPECT_EQ(kNoSamples, data[0].sample_count);
+}
+
 /**
  * Publish messages that do not have a header timestamp, test that all statistics messages
  * were received, and verify the statistics message contents.
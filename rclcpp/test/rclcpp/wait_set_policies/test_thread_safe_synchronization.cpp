@@ -14,7 +14,10 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <chrono>
 #include <memory>
+#include <thread>
 #include <vector>
 
 #include "rclcpp/rclcpp.hpp"
@@ -304,3 +307,45 @@ TEST_F(TestThreadSafeStorage, wait_waitable) {
     EXPECT_EQ(rclcpp::WaitResultKind::Timeout, wait_result.kind());
   }
 }
+
+TEST_F(TestThreadSafeStorage, batch_modifications) {
+  rclcpp::ThreadSafeWaitSet wait_set;
+  auto guard_condition1 = std::make_shared<rclcpp::GuardCondition>();
+  auto guard_condition2 = std::make_shared<rclcpp::GuardCondition>();
+
+  wait_set.begin_modifications();
+  RCLCPP_EXPECT_THROW_EQ(
+    wait_set.begin_modifications(),
+    std::runtime_error("modifications of the wait set were already begun"));
+  RCLCPP_EXPECT_THROW_EQ(
+    wait_set.wait(std::chrono::milliseconds(10)),
+    std::runtime_error("cannot wait before committing the modifications of the wait set"));
+  wait_set.add_guard_condition(guard_condition1);
+  wait_set.add_guard_condition(guard_condition2);
+  guard_condition2->trigger();
+
+  // Other threads can't wait on the wait set until the modifications are committed
+  std::atomic_bool waited{false};
+  rclcpp::WaitResultKind kind = rclcpp::WaitResultKind::Empty;
+  std::thread waiter(
+    [&]() {
+      kind = wait_set.wait(std::chrono::seconds(5)).kind();
+      waited = true;
+    });
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  EXPECT_FALSE(waited);
+
+  wait_set.commit_modifications();
+  waiter.join();
+  EXPECT_EQ(rclcpp::WaitResultKind::Ready, kind);
+  RCLCPP_EXPECT_THROW_EQ(
+    wait_set.commit_modifications(),
+    std::runtime_error("modifications of the wait set weren't begun by this thread"));
+
+  // Entities can be removed in a batch too
+  wait_set.begin_modifications();
+  wait_set.remove_guard_condition(guard_condition1);
+  wait_set.remove_guard_condition(guard_condition2);
+  wait_set.commit_modifications();
+  EXPECT_EQ(rclcpp::WaitResultKind::Timeout, wait_set.wait(std::chrono::milliseconds(10)).kind());
+}
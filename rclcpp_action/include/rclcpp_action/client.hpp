@@ -17,8 +17,10 @@
 
 #include <algorithm>
 #include <chrono>
+#include <deque>
 #include <functional>
 #include <future>
+#include <limits>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -41,6 +43,7 @@
 #include "rosidl_typesupport_cpp/action_type_support.hpp"
 
 #include "rclcpp_action/client_goal_handle.hpp"
+#include "rclcpp_action/detail/goal_id_filter.hpp"
 #include "rclcpp_action/exceptions.hpp"
 #include "rclcpp_action/types.hpp"
 #include "rclcpp_action/visibility_control.hpp"
@@ -73,9 +76,15 @@ public:
     CancelClient,
     FeedbackSubscription,
     StatusSubscription,
+    IntraProcess,
   };
 
   /// Return true if there is an action server that is ready to take goal requests.
+  /**
+   * When the node uses intra-process communication by default, a server of the same process
+   * is ready as soon as it's created, and the requests of the client are handed over to it
+   * without the middleware.
+   */
   RCLCPP_ACTION_PUBLIC
   bool
   action_server_is_ready() const;
@@ -319,6 +328,11 @@ private:
     EntityType entity_type,
     std::function<void(size_t, int)> callback);
 
+  /// Get the callback handing a response of an in-process server over to the executor.
+  RCLCPP_ACTION_PUBLIC
+  ResponseCallback
+  make_intra_process_responder(EntityType entity_type, int64_t sequence_number);
+
   bool on_ready_callback_set_{false};
 };
 
@@ -449,6 +463,7 @@ public:
           new GoalHandle(goal_info, options.feedback_callback, options.result_callback));
         {
           std::lock_guard<std::mutex> guard(goal_handles_mutex_);
+          goal_id_filter_.add(goal_handle->get_goal_id());
           goal_handles_[goal_handle->get_goal_id()] = goal_handle;
         }
         promise->set_value(goal_handle);
@@ -478,6 +493,16 @@ public:
           ++goal_handle_it;
         }
       }
+      // Forget the terminal goals which were forgotten otherwise
+      terminal_goal_ids_.erase(
+        std::remove_if(
+          terminal_goal_ids_.begin(), terminal_goal_ids_.end(),
+          [this](const GoalUUID & goal_id) {return goal_handles_.count(goal_id) == 0;}),
+        terminal_goal_ids_.end());
+      // Forget the goals erased since the last cleanup in the filter too
+      goal_id_filter_.reset(
+        goal_handles_.begin(), goal_handles_.end(),
+        [](const auto & entry) -> const GoalUUID & {return entry.first;});
     }
 
     return future;
@@ -587,6 +612,34 @@ public:
     return async_cancel(cancel_request, cancel_callback);
   }
 
+  /// Set how many goal handles which reached a terminal state are remembered by this client.
+  /**
+   * The client remembers the goal handles it sent as long as the user references them.
+   * Goal handles which reached a terminal state, without waiting for a result, are forgotten
+   * beyond this number, the oldest first, so that a client sending goals for a long time
+   * doesn't grow without bound.
+   * The forgotten goal handles keep their last status, but they are then unknown to this
+   * client, as for async_get_result().
+   * By default all of them are remembered.
+   *
+   * \param[in] max_terminal_goal_handles The number of terminal goal handles remembered.
+   */
+  void
+  set_terminal_goal_handle_retention(size_t max_terminal_goal_handles)
+  {
+    std::lock_guard<std::mutex> guard(goal_handles_mutex_);
+    max_terminal_goal_handles_ = max_terminal_goal_handles;
+    prune_terminal_goal_handles();
+  }
+
+  /// Return how many goal handles which reached a terminal state are remembered.
+  size_t
+  get_terminal_goal_handle_retention()
+  {
+    std::lock_guard<std::mutex> guard(goal_handles_mutex_);
+    return max_terminal_goal_handles_;
+  }
+
   virtual
   ~Client()
   {
@@ -637,28 +690,42 @@ private:
   void
   handle_feedback_message(std::shared_ptr<void> message) override
   {
-    std::lock_guard<std::mutex> guard(goal_handles_mutex_);
     using FeedbackMessage = typename ActionT::Impl::FeedbackMessage;
     typename FeedbackMessage::SharedPtr feedback_message =
       std::static_pointer_cast<FeedbackMessage>(message);
     const GoalUUID & goal_id = feedback_message->goal_id.uuid;
-    if (goal_handles_.count(goal_id) == 0) {
+    // The clients of a shared action server receive the feedback of all the goals,
+    // the feedback of the goals of other clients is dropped without locking
+    if (!goal_id_filter_.may_contain(goal_id)) {
       RCLCPP_DEBUG(
         this->get_logger(),
         "Received feedback for unknown goal. Ignoring...");
       return;
     }
-    typename GoalHandle::SharedPtr goal_handle = goal_handles_[goal_id].lock();
-    // Forget about the goal if there are no more user references
-    if (!goal_handle) {
-      RCLCPP_DEBUG(
-        this->get_logger(),
-        "Dropping weak reference to goal handle during feedback callback");
-      goal_handles_.erase(goal_id);
-      return;
+    typename GoalHandle::SharedPtr goal_handle;
+    {
+      std::lock_guard<std::mutex> guard(goal_handles_mutex_);
+      auto goal_handle_it = goal_handles_.find(goal_id);
+      if (goal_handle_it == goal_handles_.end()) {
+        RCLCPP_DEBUG(
+          this->get_logger(),
+          "Received feedback for unknown goal. Ignoring...");
+        return;
+      }
+      goal_handle = goal_handle_it->second.lock();
+      // Forget about the goal if there are no more user references
+      if (!goal_handle) {
+        RCLCPP_DEBUG(
+          this->get_logger(),
+          "Dropping weak reference to goal handle during feedback callback");
+        goal_handles_.erase(goal_handle_it);
+        return;
+      }
     }
-    auto feedback = std::make_shared<Feedback>();
-    *feedback = feedback_message->feedback;
+    // Alias the feedback of the received message instead of copying it: the message isn't
+    // reused by take_data() while the callback keeps a reference to it.
+    // The callback is called without the lock, so it can use the client.
+    std::shared_ptr<const Feedback> feedback(feedback_message, &feedback_message->feedback);
     goal_handle->call_feedback_callback(goal_handle, feedback);
   }
 
@@ -674,27 +741,71 @@ private:
   void
   handle_status_message(std::shared_ptr<void> message) override
   {
-    std::lock_guard<std::mutex> guard(goal_handles_mutex_);
     using GoalStatusMessage = typename ActionT::Impl::GoalStatusMessage;
     auto status_message = std::static_pointer_cast<GoalStatusMessage>(message);
+    const bool may_know_any_goal = std::any_of(
+      status_message->status_list.begin(), status_message->status_list.end(),
+      [this](const GoalStatus & status) {
+        return goal_id_filter_.may_contain(status.goal_info.goal_id.uuid);
+      });
+    if (!may_know_any_goal) {
+      return;
+    }
+    std::lock_guard<std::mutex> guard(goal_handles_mutex_);
     for (const GoalStatus & status : status_message->status_list) {
       const GoalUUID & goal_id = status.goal_info.goal_id.uuid;
-      if (goal_handles_.count(goal_id) == 0) {
+      auto goal_handle_it = goal_handles_.find(goal_id);
+      if (goal_handle_it == goal_handles_.end()) {
         RCLCPP_DEBUG(
           this->get_logger(),
           "Received status for unknown goal. Ignoring...");
         continue;
       }
-      typename GoalHandle::SharedPtr goal_handle = goal_handles_[goal_id].lock();
+      typename GoalHandle::SharedPtr goal_handle = goal_handle_it->second.lock();
       // Forget about the goal if there are no more user references
       if (!goal_handle) {
         RCLCPP_DEBUG(
           this->get_logger(),
           "Dropping weak reference to goal handle during status callback");
-        goal_handles_.erase(goal_id);
+        goal_handles_.erase(goal_handle_it);
         continue;
       }
+      const bool was_terminal = is_terminal_status(goal_handle->get_status());
       goal_handle->set_status(status.status);
+      // Goals waiting for a result are forgotten when it's received
+      if (!was_terminal && is_terminal_status(status.status) && !goal_handle->is_result_aware()) {
+        terminal_goal_ids_.push_back(goal_id);
+      }
+    }
+    prune_terminal_goal_handles();
+  }
+
+  /// \internal
+  static bool
+  is_terminal_status(int8_t status)
+  {
+    return GoalStatus::STATUS_SUCCEEDED == status ||
+           GoalStatus::STATUS_CANCELED == status ||
+           GoalStatus::STATUS_ABORTED == status;
+  }
+
+  /// Forget the oldest terminal goal handles beyond the retention, with goal_handles_mutex_ held.
+  /// \internal
+  void
+  prune_terminal_goal_handles()
+  {
+    while (terminal_goal_ids_.size() > max_terminal_goal_handles_) {
+      auto goal_handle_it = goal_handles_.find(terminal_goal_ids_.front());
+      terminal_goal_ids_.pop_front();
+      if (goal_handle_it == goal_handles_.end()) {
+        continue;
+      }
+      typename GoalHandle::SharedPtr goal_handle = goal_handle_it->second.lock();
+      // Keep the goals whose result was asked for since they reached a terminal state
+      if (!goal_handle || !goal_handle->is_result_aware()) {
+        RCLCPP_DEBUG(this->get_logger(), "Forgetting goal handle in a terminal state");
+        goal_handles_.erase(goal_handle_it);
+      }
     }
   }
 
@@ -754,7 +865,12 @@ private:
     return future;
   }
 
-  std::map<GoalUUID, typename GoalHandle::WeakPtr> goal_handles_;
+  std::unordered_map<GoalUUID, typename GoalHandle::WeakPtr> goal_handles_;
+  // Superset of the ids of goal_handles_, updated with goal_handles_mutex_ held
+  detail::GoalIdFilter goal_id_filter_;
+  // Goals which reached a terminal state while not result aware, the oldest first
+  std::deque<GoalUUID> terminal_goal_ids_;
+  size_t max_terminal_goal_handles_{std::numeric_limits<size_t>::max()};
   std::mutex goal_handles_mutex_;
 };
 }  // namespace rclcpp_action
@@ -15,6 +15,7 @@
 #ifndef RCLCPP_ACTION__CREATE_SERVER_HPP_
 #define RCLCPP_ACTION__CREATE_SERVER_HPP_
 
+#include <chrono>
 #include <memory>
 #include <string>
 
@@ -52,6 +53,8 @@ namespace rclcpp_action
  * \param[in] options Options to pass to the underlying `rcl_action_server_t`.
  * \param[in] group The action server will be added to this callback group.
  *   If `nullptr`, then the action server is added to the default callback group.
+ * \param[in] feedback_publish_period If greater than zero, the feedback is conflated to at most
+ *   one message per goal per period, \sa ServerBase::set_feedback_publish_period().
  */
 template<typename ActionT>
 typename Server<ActionT>::SharedPtr
@@ -65,7 +68,8 @@ create_server(
   typename Server<ActionT>::CancelCallback handle_cancel,
   typename Server<ActionT>::AcceptedCallback handle_accepted,
   const rcl_action_server_options_t & options = rcl_action_server_get_default_options(),
-  rclcpp::CallbackGroup::SharedPtr group = nullptr)
+  rclcpp::CallbackGroup::SharedPtr group = nullptr,
+  std::chrono::nanoseconds feedback_publish_period = std::chrono::nanoseconds(0))
 {
   std::weak_ptr<rclcpp::node_interfaces::NodeWaitablesInterface> weak_node =
     node_waitables_interface;
@@ -105,6 +109,7 @@ create_server(
       handle_goal,
       handle_cancel,
       handle_accepted), deleter);
+  action_server->set_feedback_publish_period(feedback_publish_period);
 
   node_waitables_interface->add_waitable(action_server, group);
   return action_server;
@@ -126,6 +131,8 @@ create_server(
  * \param[in] options Options to pass to the underlying `rcl_action_server_t`.
  * \param[in] group The action server will be added to this callback group.
  *   If `nullptr`, then the action server is added to the default callback group.
+ * \param[in] feedback_publish_period If greater than zero, the feedback is conflated to at most
+ *   one message per goal per period, \sa ServerBase::set_feedback_publish_period().
  */
 template<typename ActionT, typename NodeT>
 typename Server<ActionT>::SharedPtr
@@ -136,7 +143,8 @@ create_server(
   typename Server<ActionT>::CancelCallback handle_cancel,
   typename Server<ActionT>::AcceptedCallback handle_accepted,
   const rcl_action_server_options_t & options = rcl_action_server_get_default_options(),
-  rclcpp::CallbackGroup::SharedPtr group = nullptr)
+  rclcpp::CallbackGroup::SharedPtr group = nullptr,
+  std::chrono::nanoseconds feedback_publish_period = std::chrono::nanoseconds(0))
 {
   return create_server<ActionT>(
     node->get_node_base_interface(),
@@ -148,7 +156,8 @@ create_server(
     handle_cancel,
     handle_accepted,
     options,
-    group);
+    group,
+    feedback_publish_period);
 }
 }  // namespace rclcpp_action
 #endif  // RCLCPP_ACTION__CREATE_SERVER_HPP_
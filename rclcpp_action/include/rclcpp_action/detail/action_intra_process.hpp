@@ -0,0 +1,206 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP_ACTION__DETAIL__ACTION_INTRA_PROCESS_HPP_
+#define RCLCPP_ACTION__DETAIL__ACTION_INTRA_PROCESS_HPP_
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "rclcpp/context.hpp"
+#include "rclcpp/experimental/intra_process_work_queue.hpp"
+#include "rclcpp/experimental/service_intra_process.hpp"
+
+#include "rosidl_runtime_c/action_type_support_struct.h"
+
+namespace rclcpp_action
+{
+namespace detail
+{
+
+/// Receiver of what the action servers of the process send to an action client.
+/**
+ * The feedback of the goals sent by the client and the status of the server are handed over
+ * by shared pointer, and handled by the executor of the client.
+ */
+class ActionClientIntraProcess : public rclcpp::experimental::IntraProcessWorkQueue
+{
+public:
+  using MessageHandler = std::function<void (std::shared_ptr<void>)>;
+
+  ActionClientIntraProcess(
+    rclcpp::Context::SharedPtr context,
+    MessageHandler feedback_handler,
+    MessageHandler status_handler)
+  : IntraProcessWorkQueue(std::move(context)),
+    feedback_handler_(std::move(feedback_handler)),
+    status_handler_(std::move(status_handler))
+  {}
+
+  /// Hand a feedback message of one of the goals of the client over to it.
+  void
+  receive_feedback(std::shared_ptr<void> feedback_message)
+  {
+    this->push(
+      [this, feedback_message = std::move(feedback_message)]() {
+        feedback_handler_(feedback_message);
+      });
+  }
+
+  /// Hand a status message, which may be shared with other clients, over to the client.
+  void
+  receive_status(std::shared_ptr<void> status_message)
+  {
+    this->push(
+      [this, status_message = std::move(status_message)]() {
+        status_handler_(status_message);
+      });
+  }
+
+private:
+  MessageHandler feedback_handler_;
+  MessageHandler status_handler_;
+};
+
+/// Receiver of the requests that the action clients of the process send to an action server.
+/**
+ * It's registered in the IntraProcessManager as a service, under the name returned by
+ * get_registration_name(), so that clients using intra-process communication find it.
+ * Requests and responses are type-erased messages of the action type of the server.
+ */
+class ActionServerIntraProcess : public rclcpp::experimental::ServiceIntraProcessBase
+{
+public:
+  using ResponseCallback = std::function<void (std::shared_ptr<void>)>;
+  using ClientWeakPtr = std::weak_ptr<ActionClientIntraProcess>;
+  using GoalRequestHandler =
+    std::function<void (std::shared_ptr<void>, ResponseCallback, ClientWeakPtr)>;
+  using RequestHandler = std::function<void (std::shared_ptr<void>, ResponseCallback)>;
+
+  /// Constructor.
+  /**
+   * The handlers are called by the executor of the server, with the callback to call with
+   * the response, which may be called later by any thread.
+   *
+   * \param[in] context the context of the server
+   * \param[in] action_name the fully qualified name of the action
+   * \param[in] type_support the type support of the action of the server
+   * \param[in] goal_handler called for each goal request, with the client sending it
+   * \param[in] cancel_handler called for each cancel request
+   * \param[in] result_handler called for each result request
+   */
+  ActionServerIntraProcess(
+    rclcpp::Context::SharedPtr context,
+    const std::string & action_name,
+    const rosidl_action_type_support_t * type_support,
+    GoalRequestHandler goal_handler,
+    RequestHandler cancel_handler,
+    RequestHandler result_handler)
+  : ServiceIntraProcessBase(std::move(context), get_registration_name(action_name)),
+    type_support_(type_support),
+    goal_handler_(std::move(goal_handler)),
+    cancel_handler_(std::move(cancel_handler)),
+    result_handler_(std::move(result_handler))
+  {}
+
+  /// Get the name under which the server of an action is registered.
+  static std::string
+  get_registration_name(const std::string & action_name)
+  {
+    // The services of the action are named after it, no service is named this way
+    return action_name + "/_action";
+  }
+
+  /// Get the type support of the action, which clients compare with theirs.
+  const rosidl_action_type_support_t *
+  get_type_support() const
+  {
+    return type_support_;
+  }
+
+  /// Count a client of the process sending its requests to the server.
+  /**
+   * The feedback subscription of each such client is matched with the feedback publisher of
+   * the server, which tells the other subscriptions apart by their number.
+   */
+  void
+  add_client()
+  {
+    clients_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  /// Stop counting a client added with add_client().
+  void
+  remove_client()
+  {
+    clients_.fetch_sub(1, std::memory_order_relaxed);
+  }
+
+  /// Get the number of clients of the process sending their requests to the server.
+  size_t
+  get_client_count() const
+  {
+    return clients_.load(std::memory_order_relaxed);
+  }
+
+  /// Hand a goal request over to the server, from the client receiving the feedback.
+  void
+  send_goal_request(std::shared_ptr<void> request, ResponseCallback respond, ClientWeakPtr client)
+  {
+    this->push(
+      [this, request = std::move(request), respond = std::move(respond),
+      client = std::move(client)]() mutable {
+        goal_handler_(std::move(request), std::move(respond), std::move(client));
+      });
+  }
+
+  /// Hand a cancel request over to the server.
+  void
+  send_cancel_request(std::shared_ptr<void> request, ResponseCallback respond)
+  {
+    push_request(cancel_handler_, std::move(request), std::move(respond));
+  }
+
+  /// Hand a result request over to the server.
+  void
+  send_result_request(std::shared_ptr<void> request, ResponseCallback respond)
+  {
+    push_request(result_handler_, std::move(request), std::move(respond));
+  }
+
+private:
+  void
+  push_request(
+    const RequestHandler & handler, std::shared_ptr<void> request, ResponseCallback respond)
+  {
+    this->push(
+      [&handler, request = std::move(request), respond = std::move(respond)]() mutable {
+        handler(std::move(request), std::move(respond));
+      });
+  }
+
+  const rosidl_action_type_support_t * type_support_;
+  std::atomic_size_t clients_{0};
+  GoalRequestHandler goal_handler_;
+  RequestHandler cancel_handler_;
+  RequestHandler result_handler_;
+};
+
+}  // namespace detail
+}  // namespace rclcpp_action
+
+#endif  // RCLCPP_ACTION__DETAIL__ACTION_INTRA_PROCESS_HPP_
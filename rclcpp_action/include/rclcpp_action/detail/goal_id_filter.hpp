@@ -0,0 +1,113 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP_ACTION__DETAIL__GOAL_ID_FILTER_HPP_
+#define RCLCPP_ACTION__DETAIL__GOAL_ID_FILTER_HPP_
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "rclcpp_action/types.hpp"
+
+namespace rclcpp_action
+{
+namespace detail
+{
+
+/// Bloom filter of goal ids, telling without locking that a goal id isn't in a set.
+/**
+ * It's used by action clients to drop the feedback and status of the goals of other clients
+ * without locking their goal handles.
+ * Goal ids are random, so their bytes are used as the hashes of the filter.
+ *
+ * add() and reset() must be serialized by the caller, but may_contain() can be called
+ * concurrently: an id added and not removed by a reset is never reported as missing.
+ */
+class GoalIdFilter
+{
+public:
+  /// Add a goal id to the set.
+  void
+  add(const GoalUUID & goal_id) noexcept
+  {
+    size_t indexes[kNumberOfHashes];
+    bit_indexes(goal_id, indexes);
+    for (size_t index : indexes) {
+      words_[index / 64].fetch_or(uint64_t(1) << (index % 64), std::memory_order_relaxed);
+    }
+  }
+
+  /// Return false if the goal id is certainly not in the set.
+  bool
+  may_contain(const GoalUUID & goal_id) const noexcept
+  {
+    size_t indexes[kNumberOfHashes];
+    bit_indexes(goal_id, indexes);
+    for (size_t index : indexes) {
+      const uint64_t word = words_[index / 64].load(std::memory_order_relaxed);
+      if (0u == (word & (uint64_t(1) << (index % 64)))) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /// Replace the set with the goal ids of a range, such as the keys of a map.
+  /**
+   * Each word of the filter is replaced at once, so the bits of the ids kept stay set.
+   */
+  template<typename IteratorT, typename GetGoalIdT>
+  void
+  reset(IteratorT begin, IteratorT end, GetGoalIdT get_goal_id) noexcept
+  {
+    std::array<uint64_t, kNumberOfWords> words {};
+    for (IteratorT it = begin; it != end; ++it) {
+      size_t indexes[kNumberOfHashes];
+      bit_indexes(get_goal_id(*it), indexes);
+      for (size_t index : indexes) {
+        words[index / 64] |= uint64_t(1) << (index % 64);
+      }
+    }
+    for (size_t i = 0; i < kNumberOfWords; ++i) {
+      words_[i].store(words[i], std::memory_order_relaxed);
+    }
+  }
+
+private:
+  static constexpr size_t kNumberOfWords = 16;
+  static constexpr size_t kNumberOfBits = kNumberOfWords * 64;
+  static constexpr size_t kNumberOfHashes = 2;
+
+  static
+  void
+  bit_indexes(const GoalUUID & goal_id, size_t (& indexes)[kNumberOfHashes]) noexcept
+  {
+    static_assert(sizeof(GoalUUID) >= kNumberOfHashes * sizeof(uint64_t), "goal ids too short");
+    for (size_t i = 0; i < kNumberOfHashes; ++i) {
+      uint64_t hash;
+      std::memcpy(&hash, goal_id.data() + i * sizeof(hash), sizeof(hash));
+      indexes[i] = static_cast<size_t>(hash % kNumberOfBits);
+    }
+  }
+
+  std::array<std::atomic<uint64_t>, kNumberOfWords> words_ {};
+};
+
+}  // namespace detail
+}  // namespace rclcpp_action
+
+#endif  // RCLCPP_ACTION__DETAIL__GOAL_ID_FILTER_HPP_
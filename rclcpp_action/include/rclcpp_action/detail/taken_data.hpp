@@ -0,0 +1,102 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP_ACTION__DETAIL__TAKEN_DATA_HPP_
+#define RCLCPP_ACTION__DETAIL__TAKEN_DATA_HPP_
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "rcl/types.h"
+#include "rmw/types.h"
+
+namespace rclcpp_action
+{
+namespace detail
+{
+
+/// Return the cached object if nothing else references it anymore, or a new cached object.
+/**
+ * Messages taken by action clients and servers are only referenced until they are handled,
+ * unless they are given to the user, so the same message (and its storage) is usually reused.
+ */
+template<typename T, typename CreateT>
+std::shared_ptr<T>
+reuse_or_create(std::shared_ptr<T> & cached, CreateT create)
+{
+  if (!cached || cached.use_count() > 1) {
+    cached = create();
+  }
+  return cached;
+}
+
+/// Data taken from the middleware by an action client or server, handled by its execute().
+struct TakenData
+{
+  rcl_ret_t ret = RCL_RET_OK;
+  // Not set for the feedback and status topics of the client
+  rmw_request_id_t request_header {};
+  std::shared_ptr<void> message;
+};
+
+/// Records of taken data reused across executions, rather than allocated by each take.
+/**
+ * A record is referenced from take_data() until the executor is done with its execute(), so
+ * there are usually no more records than threads executing the client or server.
+ *
+ * Calls must be serialized by the caller.
+ */
+class TakenDataPool
+{
+public:
+  /// Return a record which isn't referenced anymore, or a new one.
+  /**
+   * The messages of the records not referenced anymore are released first, so that the
+   * messages cached with reuse_or_create() can be reused too.
+   */
+  std::shared_ptr<TakenData>
+  acquire()
+  {
+    std::shared_ptr<TakenData> available;
+    for (const auto & record : records_) {
+      if (record.use_count() == 1) {
+        record->message.reset();
+        if (!available) {
+          available = record;
+        }
+      }
+    }
+    if (!available) {
+      records_.push_back(std::make_shared<TakenData>());
+      available = records_.back();
+    }
+    return available;
+  }
+
+  /// Return the number of records, referenced or not.
+  size_t
+  size() const
+  {
+    return records_.size();
+  }
+
+private:
+  std::vector<std::shared_ptr<TakenData>> records_;
+};
+
+}  // namespace detail
+}  // namespace rclcpp_action
+
+#endif  // RCLCPP_ACTION__DETAIL__TAKEN_DATA_HPP_
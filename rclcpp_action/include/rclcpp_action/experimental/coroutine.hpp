@@ -0,0 +1,212 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP_ACTION__EXPERIMENTAL__COROUTINE_HPP_
+#define RCLCPP_ACTION__EXPERIMENTAL__COROUTINE_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <coroutine>
+#include <future>
+#include <memory>
+#include <utility>
+
+#include "rclcpp/experimental/coroutine.hpp"
+
+#include "rclcpp_action/client.hpp"
+#include "rclcpp_action/client_goal_handle.hpp"
+
+namespace rclcpp_action
+{
+namespace experimental
+{
+
+/// Awaitable sending an action goal, resumed with the goal handle.
+/**
+ * \sa send_goal()
+ */
+template<typename ActionT>
+class SendGoalAwaitable
+{
+public:
+  using ClientT = rclcpp_action::Client<ActionT>;
+  using GoalHandleSharedPtr = typename ClientGoalHandle<ActionT>::SharedPtr;
+
+  SendGoalAwaitable(
+    typename ClientT::SharedPtr client,
+    const typename ClientT::Goal & goal,
+    const typename ClientT::SendGoalOptions & options)
+  : client_(std::move(client)), goal_(goal), options_(options)
+  {}
+
+  bool
+  await_ready() const noexcept
+  {
+    return false;
+  }
+
+  void
+  await_suspend(std::coroutine_handle<> handle)
+  {
+    state_ = std::make_shared<State>();
+    state_->handle = handle;
+    std::weak_ptr<State> weak_state = state_;
+    typename ClientT::SendGoalOptions options = options_;
+    options.goal_response_callback =
+      [weak_state, callback = options_.goal_response_callback](GoalHandleSharedPtr goal_handle) {
+        if (callback) {
+          callback(goal_handle);
+        }
+        auto state = weak_state.lock();
+        if (state) {
+          state->goal_handle = std::move(goal_handle);
+          state->handle.resume();
+        }
+      };
+    // The coroutine may be resumed before this call returns, nothing is used after it
+    client_->async_send_goal(goal_, options);
+  }
+
+  GoalHandleSharedPtr
+  await_resume()
+  {
+    return std::move(state_->goal_handle);
+  }
+
+private:
+  struct State
+  {
+    std::coroutine_handle<> handle;
+    GoalHandleSharedPtr goal_handle;
+  };
+
+  typename ClientT::SharedPtr client_;
+  typename ClientT::Goal goal_;
+  typename ClientT::SendGoalOptions options_;
+  std::shared_ptr<State> state_;
+};
+
+/// Send an action goal, and get its goal handle when the returned awaitable is awaited.
+/**
+ * The awaiting coroutine is resumed by the executor handling the goal response of the client,
+ * after the goal response callback of the options, if any, was called.
+ *
+ * \param[in] client the action client sending the goal
+ * \param[in] goal the goal to send
+ * \param[in] options the callbacks of the goal, as for Client::async_send_goal()
+ * \return an awaitable resumed with the goal handle, or nullptr if the goal was rejected
+ */
+template<typename ActionT>
+SendGoalAwaitable<ActionT>
+send_goal(
+  std::shared_ptr<rclcpp_action::Client<ActionT>> client,
+  const typename rclcpp_action::Client<ActionT>::Goal & goal,
+  const typename rclcpp_action::Client<ActionT>::SendGoalOptions & options = {})
+{
+  return SendGoalAwaitable<ActionT>(std::move(client), goal, options);
+}
+
+/// Awaitable resumed with the result of an action goal.
+/**
+ * \sa get_result()
+ */
+template<typename ActionT>
+class GetResultAwaitable
+{
+public:
+  using ClientT = rclcpp_action::Client<ActionT>;
+  using GoalHandleSharedPtr = typename ClientGoalHandle<ActionT>::SharedPtr;
+  using WrappedResult = typename ClientT::WrappedResult;
+
+  GetResultAwaitable(typename ClientT::SharedPtr client, GoalHandleSharedPtr goal_handle)
+  : client_(std::move(client)), goal_handle_(std::move(goal_handle))
+  {}
+
+  bool
+  await_ready() const noexcept
+  {
+    return false;
+  }
+
+  bool
+  await_suspend(std::coroutine_handle<> handle)
+  {
+    // Keep the state alive in this scope, the coroutine may be resumed before it returns
+    auto state = std::make_shared<State>();
+    state->handle = handle;
+    state_ = state;
+    std::weak_ptr<State> weak_state = state;
+    auto future = client_->async_get_result(
+      goal_handle_,
+      [weak_state](const WrappedResult & result) {
+        auto state = weak_state.lock();
+        if (state && !state->done.exchange(true)) {
+          state->result = result;
+          state->handle.resume();
+        }
+      });
+    // The result may have been received before the callback was set
+    if (std::future_status::ready == future.wait_for(std::chrono::seconds(0)) &&
+      !state->done.exchange(true))
+    {
+      state->result = future.get();
+      return false;
+    }
+    return true;
+  }
+
+  WrappedResult
+  await_resume()
+  {
+    return std::move(state_->result);
+  }
+
+private:
+  struct State
+  {
+    std::coroutine_handle<> handle;
+    // Whether the coroutine was resumed, or not suspended, with the result
+    std::atomic_bool done{false};
+    WrappedResult result;
+  };
+
+  typename ClientT::SharedPtr client_;
+  GoalHandleSharedPtr goal_handle_;
+  std::shared_ptr<State> state_;
+};
+
+/// Get the result of an action goal when the returned awaitable is awaited.
+/**
+ * The awaiting coroutine is resumed by the executor handling the result response of the
+ * client, or isn't suspended if the result was already received.
+ * The result callback of the goal handle is replaced, as for Client::async_get_result().
+ *
+ * \param[in] client the action client which sent the goal
+ * \param[in] goal_handle the goal handle returned when the goal was sent
+ * \return an awaitable resumed with the result of the goal
+ * \throws exceptions::UnknownGoalHandleError when awaited, if the goal is unknown
+ */
+template<typename ActionT>
+GetResultAwaitable<ActionT>
+get_result(
+  std::shared_ptr<rclcpp_action::Client<ActionT>> client,
+  typename ClientGoalHandle<ActionT>::SharedPtr goal_handle)
+{
+  return GetResultAwaitable<ActionT>(std::move(client), std::move(goal_handle));
+}
+
+}  // namespace experimental
+}  // namespace rclcpp_action
+
+#endif  // RCLCPP_ACTION__EXPERIMENTAL__COROUTINE_HPP_
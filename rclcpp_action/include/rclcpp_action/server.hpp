@@ -15,6 +15,7 @@
 #ifndef RCLCPP_ACTION__SERVER_HPP_
 #define RCLCPP_ACTION__SERVER_HPP_
 
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <mutex>
@@ -77,6 +78,7 @@ public:
     GoalService,
     ResultService,
     CancelService,
+    IntraProcess,
   };
 
   RCLCPP_ACTION_PUBLIC
@@ -157,6 +159,8 @@ public:
    * Calling it again will clear any previously set callback.
    *
    * An exception will be thrown if the callback is not callable.
+   * An exception will also be thrown if a status or feedback publish period greater than zero
+   * is set, \sa set_status_publish_period() and set_feedback_publish_period().
    *
    * This function is thread-safe.
    *
@@ -177,6 +181,55 @@ public:
   // End Waitables API
   // -----------------
 
+  /// Set the minimum period between two goal status messages.
+  /**
+   * By default the status of the goals is published whenever a goal changes state.
+   * With a period greater than zero, the first change is published right away and the
+   * following changes within the period are coalesced into the status message published at
+   * the end of it, so the status traffic is bounded no matter how many goals change state.
+   * The coalesced status is published by the executor waiting on this action server.
+   * Executors using on ready callbacks rather than waiting, e.g. the EventsExecutor, would
+   * never publish it, so a period greater than zero can't be used with them.
+   *
+   * \param[in] period the minimum period, or zero to publish every change.
+   * \throws std::invalid_argument if the period is negative.
+   * \throws std::runtime_error if the period is greater than zero while an on ready
+   *   callback is set.
+   */
+  RCLCPP_ACTION_PUBLIC
+  void
+  set_status_publish_period(std::chrono::nanoseconds period);
+
+  /// Return the minimum period between two goal status messages.
+  RCLCPP_ACTION_PUBLIC
+  std::chrono::nanoseconds
+  get_status_publish_period() const;
+
+  /// Set the period of the feedback messages of each goal.
+  /**
+   * By default every feedback message is published right away.
+   * With a period greater than zero, the feedback is conflated: only the latest feedback
+   * message of each goal is kept, and it's published once per period, so at most one
+   * feedback message per goal is published per period.
+   * The pending feedback of a goal is published before its result.
+   * The conflated feedback is published by the executor waiting on this action server,
+   * so like the status publish period, a period greater than zero can't be used with executors
+   * using on ready callbacks, e.g. the EventsExecutor.
+   *
+   * \param[in] period the period, or zero to publish every feedback message.
+   * \throws std::invalid_argument if the period is negative.
+   * \throws std::runtime_error if the period is greater than zero while an on ready
+   *   callback is set.
+   */
+  RCLCPP_ACTION_PUBLIC
+  void
+  set_feedback_publish_period(std::chrono::nanoseconds period);
+
+  /// Return the period of the feedback messages of each goal.
+  RCLCPP_ACTION_PUBLIC
+  std::chrono::nanoseconds
+  get_feedback_publish_period() const;
+
 protected:
   RCLCPP_ACTION_PUBLIC
   ServerBase(
@@ -266,11 +319,23 @@ protected:
   void
   publish_result(const GoalUUID & uuid, std::shared_ptr<void> result_msg);
 
+  /// Publish a feedback message right away.
   /// \internal
   RCLCPP_ACTION_PUBLIC
   void
   publish_feedback(std::shared_ptr<void> feedback_msg);
 
+  /// Publish a feedback message of a goal, conflated according to the feedback publish period.
+  /// \internal
+  /**
+   * The feedback of a goal sent by an action client of the process, using intra-process
+   * communication, is handed over to that client. It's only published as well when other
+   * processes subscribe to the feedback topic, e.g. tools echoing or recording it.
+   */
+  RCLCPP_ACTION_PUBLIC
+  void
+  publish_feedback(const GoalUUID & uuid, std::shared_ptr<void> feedback_msg);
+
   // End API for communication between ServerBase and Server<>
   // ---------------------------------------------------------
 
@@ -281,12 +346,25 @@ private:
   void
   execute_goal_request_received(std::shared_ptr<void> & data);
 
+  /// Handle a goal request, responding with the given function, return true if it's accepted
+  /// \internal
+  RCLCPP_ACTION_PUBLIC
+  bool
+  handle_goal_request(
+    std::shared_ptr<void> message, const std::function<void(std::shared_ptr<void>)> & respond);
+
   /// Handle a request to cancel goals on the server
   /// \internal
   RCLCPP_ACTION_PUBLIC
   void
   execute_cancel_request_received(std::shared_ptr<void> & data);
 
+  /// Handle a cancel request, return the response to send
+  /// \internal
+  RCLCPP_ACTION_PUBLIC
+  std::shared_ptr<void>
+  handle_cancel_request(std::shared_ptr<void> message);
+
   /// Handle a request to get the result of an action
   /// \internal
   RCLCPP_ACTION_PUBLIC
@@ -299,6 +377,24 @@ private:
   void
   execute_check_expired_goals();
 
+  /// Publish the status coalesced since the last status message, if any
+  /// \internal
+  RCLCPP_ACTION_PUBLIC
+  void
+  execute_publish_pending_status();
+
+  /// Publish the latest feedback of the goals since the last period
+  /// \internal
+  RCLCPP_ACTION_PUBLIC
+  void
+  execute_publish_pending_feedback();
+
+  /// Publish the status of all goals, with action_server_reentrant_mutex_ held
+  /// \internal
+  RCLCPP_ACTION_PUBLIC
+  void
+  publish_status_message();
+
   /// Private implementation
   /// \internal
   std::unique_ptr<ServerBaseImpl> pimpl_;
@@ -497,7 +593,8 @@ protected:
         if (!shared_this) {
           return;
         }
-        shared_this->publish_feedback(std::static_pointer_cast<void>(feedback_msg));
+        shared_this->publish_feedback(
+          feedback_msg->goal_id.uuid, std::static_pointer_cast<void>(feedback_msg));
       };
 
     auto request = std::static_pointer_cast<
@@ -16,7 +16,8 @@
 #define RCLCPP_ACTION__TYPES_HPP_
 
 #include <array>
-#include <climits>
+#include <cstdint>
+#include <cstring>
 #include <functional>
 #include <string>
 
@@ -69,16 +70,17 @@ struct hash<rclcpp_action::GoalUUID>
 {
   size_t operator()(const rclcpp_action::GoalUUID & uuid) const noexcept
   {
-    // TODO(sloretz) Use someone else's hash function and cite it
-    size_t result = 0;
-    for (size_t i = 0; i < uuid.size(); ++i) {
-      for (size_t b = 0; b < sizeof(size_t); ++b) {
-        size_t part = uuid[i];
-        part <<= CHAR_BIT * b;
-        result ^= part;
-      }
-    }
-    return result;
+    static_assert(UUID_SIZE == 2 * sizeof(uint64_t), "goal ids are expected to have 128 bits");
+    // Goal ids are random, folding their two halves with a multiply-xorshift mixes them enough
+    uint64_t low;
+    uint64_t high;
+    std::memcpy(&low, uuid.data(), sizeof(low));
+    std::memcpy(&high, uuid.data() + sizeof(low), sizeof(high));
+    uint64_t result = low ^ (high * 0x9e3779b97f4a7c15ull);
+    result ^= result >> 32;
+    result *= 0xd6e8feb86659fd93ull;
+    result ^= result >> 32;
+    return static_cast<size_t>(result);
   }
 };
 }  // namespace std
@@ -13,19 +13,23 @@
 // limitations under the License.
 
 #include <algorithm>
+#include <atomic>
 #include <map>
 #include <memory>
 #include <random>
 #include <string>
-#include <tuple>
 #include <utility>
 
 #include "rcl_action/action_client.h"
 #include "rcl_action/wait.h"
+#include "rclcpp/experimental/intra_process_manager.hpp"
+#include "rclcpp/future_completion.hpp"
 #include "rclcpp/node_interfaces/node_base_interface.hpp"
 #include "rclcpp/node_interfaces/node_logging_interface.hpp"
 
 #include "rclcpp_action/client.hpp"
+#include "rclcpp_action/detail/action_intra_process.hpp"
+#include "rclcpp_action/detail/taken_data.hpp"
 #include "rclcpp_action/exceptions.hpp"
 
 namespace rclcpp_action
@@ -44,7 +48,8 @@ public:
   : node_graph_(node_graph),
     node_handle(node_base->get_shared_rcl_node_handle()),
     logger(node_logging->get_logger().get_child("rclcpp_action")),
-    random_bytes_generator(std::random_device{}())
+    random_bytes_generator(std::random_device{}()),
+    type_support(type_support)
   {
     std::weak_ptr<rcl_node_t> weak_node_handle(node_handle);
     client_handle = std::shared_ptr<rcl_action_client_t>(
@@ -88,6 +93,14 @@ public:
     }
   }
 
+  ~ClientBaseImpl()
+  {
+    auto server = intra_process_server.lock();
+    if (server) {
+      server->remove_client();
+    }
+  }
+
   size_t num_subscriptions{0u};
   size_t num_guard_conditions{0u};
   size_t num_timers{0u};
@@ -99,6 +112,46 @@ public:
   bool is_goal_response_ready{false};
   bool is_cancel_response_ready{false};
   bool is_result_response_ready{false};
+  bool is_intra_process_ready{false};
+
+  /// Get the server of the process to which requests are handed over, if any.
+  std::shared_ptr<detail::ActionServerIntraProcess>
+  find_intra_process_server()
+  {
+    if (!intra_process) {
+      return nullptr;
+    }
+    auto ipm = weak_ipm.lock();
+    if (!ipm) {
+      return nullptr;
+    }
+    auto server = std::dynamic_pointer_cast<detail::ActionServerIntraProcess>(
+      ipm->get_service(intra_process_server_name));
+    if (!server || server->get_type_support() != type_support) {
+      return nullptr;
+    }
+    std::lock_guard<std::mutex> lock(intra_process_server_mutex);
+    auto previous_server = intra_process_server.lock();
+    if (previous_server != server) {
+      if (previous_server) {
+        previous_server->remove_client();
+      }
+      server->add_client();
+      intra_process_server = server;
+    }
+    return server;
+  }
+
+  /// Return true if the status of the server is received in-process.
+  bool
+  is_intra_process_server_found()
+  {
+    if (!intra_process) {
+      return false;
+    }
+    std::lock_guard<std::mutex> lock(intra_process_server_mutex);
+    return !intra_process_server.expired();
+  }
 
   rclcpp::Context::SharedPtr context_;
   rclcpp::node_interfaces::NodeGraphInterface::WeakPtr node_graph_;
@@ -120,6 +173,27 @@ public:
 
   std::independent_bits_engine<
     std::default_random_engine, 8, unsigned int> random_bytes_generator;
+
+  // Lock for the members below, used by take_data()
+  std::mutex taken_data_mutex;
+  // Messages reused by take_data(), \sa detail::reuse_or_create()
+  std::shared_ptr<void> feedback_message;
+  std::shared_ptr<void> status_message;
+  std::shared_ptr<void> goal_response;
+  std::shared_ptr<void> result_response;
+  std::shared_ptr<void> cancel_response;
+  detail::TakenDataPool taken_data_pool;
+
+  // Set when the node uses intra-process communication by default
+  std::shared_ptr<detail::ActionClientIntraProcess> intra_process;
+  std::weak_ptr<rclcpp::experimental::IntraProcessManager> weak_ipm;
+  std::string intra_process_server_name;
+  const rosidl_action_type_support_t * type_support;
+  // Negative, so that they aren't confused with the sequence numbers of the middleware
+  std::atomic<int64_t> next_intra_process_sequence_number{-1};
+  // Last server found, whose status published through the middleware is ignored meanwhile
+  std::mutex intra_process_server_mutex;
+  std::weak_ptr<detail::ActionServerIntraProcess> intra_process_server;
 };
 
 ClientBase::ClientBase(
@@ -132,6 +206,19 @@ ClientBase::ClientBase(
 : pimpl_(new ClientBaseImpl(
       node_base, node_graph, node_logging, action_name, type_support, client_options))
 {
+  if (!node_base->get_use_intra_process_default()) {
+    return;
+  }
+  auto context = node_base->get_context();
+  // The handlers are only called by the executor of this client
+  pimpl_->intra_process = std::make_shared<detail::ActionClientIntraProcess>(
+    context,
+    [this](std::shared_ptr<void> message) {this->handle_feedback_message(message);},
+    [this](std::shared_ptr<void> message) {this->handle_status_message(message);});
+  pimpl_->weak_ipm = rclcpp::experimental::IntraProcessManager::get_instance(*context);
+  pimpl_->intra_process_server_name = detail::ActionServerIntraProcess::get_registration_name(
+    rcl_action_client_get_action_name(pimpl_->client_handle.get()));
+  pimpl_->num_guard_conditions++;
 }
 
 ClientBase::~ClientBase()
@@ -141,6 +228,9 @@ ClientBase::~ClientBase()
 bool
 ClientBase::action_server_is_ready() const
 {
+  if (pimpl_->find_intra_process_server()) {
+    return true;
+  }
   bool is_ready;
   rcl_ret_t ret = rcl_action_server_is_available(
     this->pimpl_->node_handle.get(),
@@ -260,6 +350,9 @@ ClientBase::add_to_wait_set(rcl_wait_set_t * wait_set)
   if (RCL_RET_OK != ret) {
     rclcpp::exceptions::throw_from_rcl_error(ret, "ClientBase::add_to_wait_set() failed");
   }
+  if (pimpl_->intra_process) {
+    pimpl_->intra_process->add_to_wait_set(wait_set);
+  }
 }
 
 bool
@@ -276,7 +369,10 @@ ClientBase::is_ready(rcl_wait_set_t * wait_set)
     rclcpp::exceptions::throw_from_rcl_error(
       ret, "failed to check for any ready entities");
   }
+  pimpl_->is_intra_process_ready =
+    pimpl_->intra_process && pimpl_->intra_process->is_ready(wait_set);
   return
+    pimpl_->is_intra_process_ready ||
     pimpl_->is_feedback_ready ||
     pimpl_->is_status_ready ||
     pimpl_->is_goal_response_ready ||
@@ -297,11 +393,24 @@ ClientBase::handle_goal_response(
   }
   pimpl_->pending_goal_responses[sequence_number](response);
   pimpl_->pending_goal_responses.erase(sequence_number);
+  rclcpp::notify_future_completion();
 }
 
 void
 ClientBase::send_goal_request(std::shared_ptr<void> request, ResponseCallback callback)
 {
+  auto server = pimpl_->find_intra_process_server();
+  if (server) {
+    const int64_t sequence_number = pimpl_->next_intra_process_sequence_number--;
+    {
+      std::lock_guard<std::mutex> guard(pimpl_->goal_requests_mutex);
+      pimpl_->pending_goal_responses[sequence_number] = callback;
+    }
+    server->send_goal_request(
+      std::move(request), make_intra_process_responder(EntityType::GoalClient, sequence_number),
+      pimpl_->intra_process);
+    return;
+  }
   std::unique_lock<std::mutex> guard(pimpl_->goal_requests_mutex);
   int64_t sequence_number;
   rcl_ret_t ret = rcl_action_send_goal_request(
@@ -331,11 +440,23 @@ ClientBase::handle_result_response(
   }
   auto & response_callback = pending_result_response.mapped();
   response_callback(response);
+  rclcpp::notify_future_completion();
 }
 
 void
 ClientBase::send_result_request(std::shared_ptr<void> request, ResponseCallback callback)
 {
+  auto server = pimpl_->find_intra_process_server();
+  if (server) {
+    const int64_t sequence_number = pimpl_->next_intra_process_sequence_number--;
+    {
+      std::lock_guard<std::mutex> guard(pimpl_->result_requests_mutex);
+      pimpl_->pending_result_responses[sequence_number] = callback;
+    }
+    server->send_result_request(
+      std::move(request), make_intra_process_responder(EntityType::ResultClient, sequence_number));
+    return;
+  }
   std::lock_guard<std::mutex> guard(pimpl_->result_requests_mutex);
   int64_t sequence_number;
   rcl_ret_t ret = rcl_action_send_result_request(
@@ -360,11 +481,23 @@ ClientBase::handle_cancel_response(
   }
   pimpl_->pending_cancel_responses[sequence_number](response);
   pimpl_->pending_cancel_responses.erase(sequence_number);
+  rclcpp::notify_future_completion();
 }
 
 void
 ClientBase::send_cancel_request(std::shared_ptr<void> request, ResponseCallback callback)
 {
+  auto server = pimpl_->find_intra_process_server();
+  if (server) {
+    const int64_t sequence_number = pimpl_->next_intra_process_sequence_number--;
+    {
+      std::lock_guard<std::mutex> guard(pimpl_->cancel_requests_mutex);
+      pimpl_->pending_cancel_responses[sequence_number] = callback;
+    }
+    server->send_cancel_request(
+      std::move(request), make_intra_process_responder(EntityType::CancelClient, sequence_number));
+    return;
+  }
   std::lock_guard<std::mutex> guard(pimpl_->cancel_requests_mutex);
   int64_t sequence_number;
   rcl_ret_t ret = rcl_action_send_cancel_request(
@@ -376,6 +509,38 @@ ClientBase::send_cancel_request(std::shared_ptr<void> request, ResponseCallback
   pimpl_->pending_cancel_responses[sequence_number] = callback;
 }
 
+ClientBase::ResponseCallback
+ClientBase::make_intra_process_responder(EntityType entity_type, int64_t sequence_number)
+{
+  std::weak_ptr<detail::ActionClientIntraProcess> weak_intra_process = pimpl_->intra_process;
+  return
+    [this, weak_intra_process, entity_type, sequence_number](std::shared_ptr<void> response) {
+      auto intra_process = weak_intra_process.lock();
+      if (!intra_process) {
+        return;
+      }
+      // The work is only executed by this client, so it still exists then
+      intra_process->push(
+        [this, entity_type, sequence_number, response = std::move(response)]() {
+          rmw_request_id_t response_header{};
+          response_header.sequence_number = sequence_number;
+          switch (entity_type) {
+            case EntityType::GoalClient:
+              this->handle_goal_response(response_header, response);
+              break;
+            case EntityType::ResultClient:
+              this->handle_result_response(response_header, response);
+              break;
+            case EntityType::CancelClient:
+              this->handle_cancel_response(response_header, response);
+              break;
+            default:
+              break;
+          }
+        });
+    };
+}
+
 GoalUUID
 ClientBase::generate_goal_id()
 {
@@ -404,6 +569,12 @@ ClientBase::set_on_ready_callback(std::function<void(size_t, int)> callback)
   set_callback_to_entity(EntityType::CancelClient, callback);
   set_callback_to_entity(EntityType::FeedbackSubscription, callback);
   set_callback_to_entity(EntityType::StatusSubscription, callback);
+  if (pimpl_->intra_process) {
+    pimpl_->intra_process->set_on_ready_callback(
+      [callback](size_t number_of_events, int) {
+        callback(number_of_events, static_cast<int>(EntityType::IntraProcess));
+      });
+  }
 }
 
 void
@@ -543,6 +714,9 @@ ClientBase::clear_on_ready_callback()
     set_on_ready_callback(EntityType::StatusSubscription, nullptr, nullptr);
     on_ready_callback_set_ = false;
   }
+  if (pimpl_->intra_process) {
+    pimpl_->intra_process->clear_on_ready_callback();
+  }
 
   entity_type_to_on_ready_callback_.clear();
 }
@@ -550,44 +724,49 @@ ClientBase::clear_on_ready_callback()
 std::shared_ptr<void>
 ClientBase::take_data()
 {
-  if (pimpl_->is_feedback_ready) {
-    std::shared_ptr<void> feedback_message = this->create_feedback_message();
-    rcl_ret_t ret = rcl_action_take_feedback(
-      pimpl_->client_handle.get(), feedback_message.get());
-    return std::static_pointer_cast<void>(
-      std::make_shared<std::tuple<rcl_ret_t, std::shared_ptr<void>>>(
-        ret, feedback_message));
+  // Taken first: unlike the entities of the middleware, it's not ready again on the next wait
+  if (pimpl_->is_intra_process_ready) {
+    return pimpl_->intra_process->take_data();
+  } else if (pimpl_->is_feedback_ready) {
+    std::lock_guard<std::mutex> lock(pimpl_->taken_data_mutex);
+    auto taken_data = pimpl_->taken_data_pool.acquire();
+    taken_data->message = detail::reuse_or_create(
+      pimpl_->feedback_message, [this]() {return this->create_feedback_message();});
+    taken_data->ret = rcl_action_take_feedback(
+      pimpl_->client_handle.get(), taken_data->message.get());
+    return taken_data;
   } else if (pimpl_->is_status_ready) {
-    std::shared_ptr<void> status_message = this->create_status_message();
-    rcl_ret_t ret = rcl_action_take_status(
-      pimpl_->client_handle.get(), status_message.get());
-    return std::static_pointer_cast<void>(
-      std::make_shared<std::tuple<rcl_ret_t, std::shared_ptr<void>>>(
-        ret, status_message));
+    std::lock_guard<std::mutex> lock(pimpl_->taken_data_mutex);
+    auto taken_data = pimpl_->taken_data_pool.acquire();
+    taken_data->message = detail::reuse_or_create(
+      pimpl_->status_message, [this]() {return this->create_status_message();});
+    taken_data->ret = rcl_action_take_status(
+      pimpl_->client_handle.get(), taken_data->message.get());
+    return taken_data;
   } else if (pimpl_->is_goal_response_ready) {
-    rmw_request_id_t response_header;
-    std::shared_ptr<void> goal_response = this->create_goal_response();
-    rcl_ret_t ret = rcl_action_take_goal_response(
-      pimpl_->client_handle.get(), &response_header, goal_response.get());
-    return std::static_pointer_cast<void>(
-      std::make_shared<std::tuple<rcl_ret_t, rmw_request_id_t, std::shared_ptr<void>>>(
-        ret, response_header, goal_response));
+    std::lock_guard<std::mutex> lock(pimpl_->taken_data_mutex);
+    auto taken_data = pimpl_->taken_data_pool.acquire();
+    taken_data->message = detail::reuse_or_create(
+      pimpl_->goal_response, [this]() {return this->create_goal_response();});
+    taken_data->ret = rcl_action_take_goal_response(
+      pimpl_->client_handle.get(), &taken_data->request_header, taken_data->message.get());
+    return taken_data;
   } else if (pimpl_->is_result_response_ready) {
-    rmw_request_id_t response_header;
-    std::shared_ptr<void> result_response = this->create_result_response();
-    rcl_ret_t ret = rcl_action_take_result_response(
-      pimpl_->client_handle.get(), &response_header, result_response.get());
-    return std::static_pointer_cast<void>(
-      std::make_shared<std::tuple<rcl_ret_t, rmw_request_id_t, std::shared_ptr<void>>>(
-        ret, response_header, result_response));
+    std::lock_guard<std::mutex> lock(pimpl_->taken_data_mutex);
+    auto taken_data = pimpl_->taken_data_pool.acquire();
+    taken_data->message = detail::reuse_or_create(
+      pimpl_->result_response, [this]() {return this->create_result_response();});
+    taken_data->ret = rcl_action_take_result_response(
+      pimpl_->client_handle.get(), &taken_data->request_header, taken_data->message.get());
+    return taken_data;
   } else if (pimpl_->is_cancel_response_ready) {
-    rmw_request_id_t response_header;
-    std::shared_ptr<void> cancel_response = this->create_cancel_response();
-    rcl_ret_t ret = rcl_action_take_cancel_response(
-      pimpl_->client_handle.get(), &response_header, cancel_response.get());
-    return std::static_pointer_cast<void>(
-      std::make_shared<std::tuple<rcl_ret_t, rmw_request_id_t, std::shared_ptr<void>>>(
-        ret, response_header, cancel_response));
+    std::lock_guard<std::mutex> lock(pimpl_->taken_data_mutex);
+    auto taken_data = pimpl_->taken_data_pool.acquire();
+    taken_data->message = detail::reuse_or_create(
+      pimpl_->cancel_response, [this]() {return this->create_cancel_response();});
+    taken_data->ret = rcl_action_take_cancel_response(
+      pimpl_->client_handle.get(), &taken_data->request_header, taken_data->message.get());
+    return taken_data;
   } else {
     throw std::runtime_error("Taking data from action client but nothing is ready");
   }
@@ -613,6 +792,9 @@ ClientBase::take_data_by_entity_id(size_t id)
     case EntityType::StatusSubscription:
       pimpl_->is_status_ready = true;
       break;
+    case EntityType::IntraProcess:
+      pimpl_->is_intra_process_ready = true;
+      break;
   }
 
   return take_data();
@@ -621,65 +803,60 @@ ClientBase::take_data_by_entity_id(size_t id)
 void
 ClientBase::execute(std::shared_ptr<void> & data)
 {
-  if (!data) {
+  // Work may also be taken by another thread executing the client
+  if (!data && !pimpl_->is_intra_process_ready) {
     throw std::runtime_error("'data' is empty");
   }
 
-  if (pimpl_->is_feedback_ready) {
-    auto shared_ptr = std::static_pointer_cast<std::tuple<rcl_ret_t, std::shared_ptr<void>>>(data);
-    auto ret = std::get<0>(*shared_ptr);
+  if (pimpl_->is_intra_process_ready) {
+    pimpl_->is_intra_process_ready = false;
+    pimpl_->intra_process->execute(data);
+  } else if (pimpl_->is_feedback_ready) {
+    auto taken_data = std::static_pointer_cast<detail::TakenData>(data);
     pimpl_->is_feedback_ready = false;
-    if (RCL_RET_OK == ret) {
-      auto feedback_message = std::get<1>(*shared_ptr);
-      this->handle_feedback_message(feedback_message);
-    } else if (RCL_RET_ACTION_CLIENT_TAKE_FAILED != ret) {
-      rclcpp::exceptions::throw_from_rcl_error(ret, "error taking feedback");
+    if (RCL_RET_OK == taken_data->ret) {
+      // The feedback of an in-process server is received in-process, it's only published for
+      // the subscriptions of other processes
+      if (!pimpl_->is_intra_process_server_found()) {
+        this->handle_feedback_message(taken_data->message);
+      }
+    } else if (RCL_RET_ACTION_CLIENT_TAKE_FAILED != taken_data->ret) {
+      rclcpp::exceptions::throw_from_rcl_error(taken_data->ret, "error taking feedback");
     }
   } else if (pimpl_->is_status_ready) {
-    auto shared_ptr = std::static_pointer_cast<std::tuple<rcl_ret_t, std::shared_ptr<void>>>(data);
-    auto ret = std::get<0>(*shared_ptr);
+    auto taken_data = std::static_pointer_cast<detail::TakenData>(data);
     pimpl_->is_status_ready = false;
-    if (RCL_RET_OK == ret) {
-      auto status_message = std::get<1>(*shared_ptr);
-      this->handle_status_message(status_message);
-    } else if (RCL_RET_ACTION_CLIENT_TAKE_FAILED != ret) {
-      rclcpp::exceptions::throw_from_rcl_error(ret, "error taking status");
+    if (RCL_RET_OK == taken_data->ret) {
+      // The status of an in-process server is received in-process, possibly before this one
+      if (!pimpl_->is_intra_process_server_found()) {
+        this->handle_status_message(taken_data->message);
+      }
+    } else if (RCL_RET_ACTION_CLIENT_TAKE_FAILED != taken_data->ret) {
+      rclcpp::exceptions::throw_from_rcl_error(taken_data->ret, "error taking status");
     }
   } else if (pimpl_->is_goal_response_ready) {
-    auto shared_ptr = std::static_pointer_cast<
-      std::tuple<rcl_ret_t, rmw_request_id_t, std::shared_ptr<void>>>(data);
-    auto ret = std::get<0>(*shared_ptr);
+    auto taken_data = std::static_pointer_cast<detail::TakenData>(data);
     pimpl_->is_goal_response_ready = false;
-    if (RCL_RET_OK == ret) {
-      auto response_header = std::get<1>(*shared_ptr);
-      auto goal_response = std::get<2>(*shared_ptr);
-      this->handle_goal_response(response_header, goal_response);
-    } else if (RCL_RET_ACTION_CLIENT_TAKE_FAILED != ret) {
-      rclcpp::exceptions::throw_from_rcl_error(ret, "error taking goal response");
+    if (RCL_RET_OK == taken_data->ret) {
+      this->handle_goal_response(taken_data->request_header, taken_data->message);
+    } else if (RCL_RET_ACTION_CLIENT_TAKE_FAILED != taken_data->ret) {
+      rclcpp::exceptions::throw_from_rcl_error(taken_data->ret, "error taking goal response");
     }
   } else if (pimpl_->is_result_response_ready) {
-    auto shared_ptr = std::static_pointer_cast<
-      std::tuple<rcl_ret_t, rmw_request_id_t, std::shared_ptr<void>>>(data);
-    auto ret = std::get<0>(*shared_ptr);
+    auto taken_data = std::static_pointer_cast<detail::TakenData>(data);
     pimpl_->is_result_response_ready = false;
-    if (RCL_RET_OK == ret) {
-      auto response_header = std::get<1>(*shared_ptr);
-      auto result_response = std::get<2>(*shared_ptr);
-      this->handle_result_response(response_header, result_response);
-    } else if (RCL_RET_ACTION_CLIENT_TAKE_FAILED != ret) {
-      rclcpp::exceptions::throw_from_rcl_error(ret, "error taking result response");
+    if (RCL_RET_OK == taken_data->ret) {
+      this->handle_result_response(taken_data->request_header, taken_data->message);
+    } else if (RCL_RET_ACTION_CLIENT_TAKE_FAILED != taken_data->ret) {
+      rclcpp::exceptions::throw_from_rcl_error(taken_data->ret, "error taking result response");
     }
   } else if (pimpl_->is_cancel_response_ready) {
-    auto shared_ptr = std::static_pointer_cast<
-      std::tuple<rcl_ret_t, rmw_request_id_t, std::shared_ptr<void>>>(data);
-    auto ret = std::get<0>(*shared_ptr);
+    auto taken_data = std::static_pointer_cast<detail::TakenData>(data);
     pimpl_->is_cancel_response_ready = false;
-    if (RCL_RET_OK == ret) {
-      auto response_header = std::get<1>(*shared_ptr);
-      auto cancel_response = std::get<2>(*shared_ptr);
-      this->handle_cancel_response(response_header, cancel_response);
-    } else if (RCL_RET_ACTION_CLIENT_TAKE_FAILED != ret) {
-      rclcpp::exceptions::throw_from_rcl_error(ret, "error taking cancel response");
+    if (RCL_RET_OK == taken_data->ret) {
+      this->handle_cancel_response(taken_data->request_header, taken_data->message);
+    } else if (RCL_RET_ACTION_CLIENT_TAKE_FAILED != taken_data->ret) {
+      rclcpp::exceptions::throw_from_rcl_error(taken_data->ret, "error taking cancel response");
     }
   } else {
     throw std::runtime_error("Executing action client but nothing is ready");
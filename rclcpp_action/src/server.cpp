@@ -12,27 +12,50 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <map>
 #include <memory>
 #include <mutex>
+#include <stdexcept>
 #include <string>
-#include <tuple>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include "rcl/graph.h"
+#include "rcl/time.h"
 #include "rcl_action/action_server.h"
+#include "rcl_action/goal_handle.h"
 #include "rcl_action/wait.h"
 
-#include "rcpputils/scope_exit.hpp"
-
 #include "action_msgs/msg/goal_status_array.hpp"
 #include "action_msgs/srv/cancel_goal.hpp"
 #include "rclcpp/exceptions.hpp"
+#include "rclcpp/experimental/intra_process_manager.hpp"
+#include "rclcpp/lock_profiling.hpp"
+#include "rclcpp/timer.hpp"
+#include "rclcpp_action/detail/action_intra_process.hpp"
+#include "rclcpp_action/detail/taken_data.hpp"
 #include "rclcpp_action/server.hpp"
 
 using rclcpp_action::ServerBase;
 using rclcpp_action::GoalUUID;
 
+namespace
+{
+// The coalesced status and the conflated feedback are published by timers of the wait set of
+// the server, which the executors using on ready callbacks don't wait on
+constexpr const char kStatusPublishPeriodOnReadyError[] =
+  "a status publish period is not supported by executors using on ready callbacks, "
+  "e.g. the EventsExecutor";
+constexpr const char kFeedbackPublishPeriodOnReadyError[] =
+  "a feedback publish period is not supported by executors using on ready callbacks, "
+  "e.g. the EventsExecutor";
+}  // namespace
+
 namespace rclcpp_action
 {
 class ServerBaseImpl
@@ -47,7 +70,8 @@ public:
   }
 
   // Lock for action_server_
-  std::recursive_mutex action_server_reentrant_mutex_;
+  rclcpp::lock_profiling::ProfiledMutex<std::recursive_mutex> action_server_reentrant_mutex_{
+    "rclcpp_action::ServerBase::action_server_reentrant_mutex_"};
 
   rclcpp::Clock::SharedPtr clock_;
 
@@ -64,16 +88,338 @@ public:
   std::atomic<bool> cancel_request_ready_{false};
   std::atomic<bool> result_request_ready_{false};
   std::atomic<bool> goal_expired_{false};
+  std::atomic<bool> status_timer_ready_{false};
+  std::atomic<bool> feedback_timer_ready_{false};
+  std::atomic<bool> intra_process_ready_{false};
+
+  // The members below are protected by action_server_reentrant_mutex_
+
+  // Requests reused by take_data(), \sa detail::reuse_or_create()
+  std::shared_ptr<void> goal_request_;
+  std::shared_ptr<void> cancel_request_;
+  std::shared_ptr<void> result_request_;
+  detail::TakenDataPool taken_data_pool_;
+
+  // Reused by every status message, so that its storage only grows with the number of goals
+  action_msgs::msg::GoalStatusArray status_msg_;
+  // Minimum period between two status messages, zero to publish every change
+  std::chrono::nanoseconds status_publish_period_{0};
+  std::chrono::steady_clock::time_point last_status_publish_;
+  // Whether goals changed state since the last status message
+  bool status_pending_ = false;
+  // Runs until the end of the period while status_pending_, canceled otherwise
+  rclcpp::TimerBase::SharedPtr status_timer_;
+  size_t status_timer_index_ = 0;
+
+  // Lock for the feedback conflation members below, never held while locking other locks
+  // of the server
+  std::mutex feedback_mutex_;
+  // Period of the conflated feedback, zero to publish every feedback message
+  std::chrono::nanoseconds feedback_publish_period_{0};
+  // Latest feedback message of each goal, not published yet
+  std::unordered_map<GoalUUID, std::shared_ptr<void>> pending_feedback_;
+  // Runs with the period while feedback is pending, canceled otherwise
+  rclcpp::TimerBase::SharedPtr feedback_timer_;
+  size_t feedback_timer_index_ = 0;
+
+  // Return true if the timer added to the wait set at the given index is ready
+  static bool
+  is_timer_ready(
+    const rcl_wait_set_t * wait_set, const rclcpp::TimerBase::SharedPtr & timer, size_t index)
+  {
+    return index < wait_set->size_of_timers &&
+           wait_set->timers[index] == timer->get_timer_handle().get();
+  }
+
+  // State of a goal, kept until the goal expires after reaching a terminal state
+  struct GoalEntry
+  {
+    // Lock for the members below, never held while locking anything else
+    std::mutex mutex_;
+    // Result, once the goal reached a terminal state
+    std::shared_ptr<void> result_;
+    // Set once result_ is stored: it's never changed then, and is read without the lock
+    std::atomic<bool> result_ready_{false};
+    // Requests for the result are kept until it becomes available
+    std::vector<rmw_request_id_t> result_requests_;
+    // Same for the requests of the clients of the process, responded to with their callbacks
+    std::vector<detail::ActionServerIntraProcess::ResponseCallback> intra_process_result_requests_;
+
+    // The members below are protected by goals_mutex_, and set once the goal is accepted
+    GoalUUID uuid_;
+    // Time at which the goal was accepted, in nanoseconds
+    int64_t stamp_ = 0;
+    // rcl goal handle is kept so api to send result doesn't try to access freed memory
+    std::shared_ptr<rcl_action_goal_handle_t> handle_;
+  };
+
+  // Return the state of a goal, creating it if needed
+  std::shared_ptr<GoalEntry>
+  get_goal_entry(const GoalUUID & uuid)
+  {
+    std::lock_guard<std::mutex> lock(goals_mutex_);
+    auto & entry = goals_[uuid];
+    if (!entry) {
+      entry = std::make_shared<GoalEntry>();
+    }
+    return entry;
+  }
+
+  // Return the state of an accepted goal, or nullptr if the goal is unknown
+  std::shared_ptr<GoalEntry>
+  find_goal_entry(const GoalUUID & uuid)
+  {
+    std::lock_guard<std::mutex> lock(goals_mutex_);
+    auto iter = goals_.find(uuid);
+    if (iter == goals_.end() || !iter->second->handle_) {
+      return nullptr;
+    }
+    return iter->second;
+  }
+
+  // Return the state of a goal whose result is requested, or nullptr if the goal is unknown
+  std::shared_ptr<GoalEntry>
+  find_goal_entry_for_result(const GoalUUID & uuid)
+  {
+    auto entry = find_goal_entry(uuid);
+    if (!entry) {
+      // The goal may be accepted by rcl but not added to the goal table yet
+      rcl_action_goal_info_t goal_info;
+      convert(uuid, &goal_info);
+      std::lock_guard lock(action_server_reentrant_mutex_);
+      if (rcl_action_server_goal_exists(action_server_.get(), &goal_info)) {
+        entry = get_goal_entry(uuid);
+      }
+    }
+    return entry;
+  }
+
+  // Return the result of a goal if it's available, otherwise store the request for it with
+  // store_request, to be responded to when the result is published, and return nullptr
+  template<typename StoreT>
+  static std::shared_ptr<void>
+  get_result_or_store_request(GoalEntry & entry, StoreT store_request)
+  {
+    if (entry.result_ready_.load(std::memory_order_acquire)) {
+      return entry.result_;
+    }
+    std::lock_guard<std::mutex> lock(entry.mutex_);
+    if (!entry.result_) {
+      store_request(entry);
+    }
+    return entry.result_;
+  }
+
+  // Add an accepted goal to the goal table
+  void
+  add_goal(const GoalUUID & uuid, std::shared_ptr<rcl_action_goal_handle_t> handle)
+  {
+    rcl_action_goal_info_t goal_info = rcl_action_get_zero_initialized_goal_info();
+    rcl_ret_t ret = rcl_action_goal_handle_get_info(handle.get(), &goal_info);
+    if (RCL_RET_OK != ret) {
+      rclcpp::exceptions::throw_from_rcl_error(ret);
+    }
+    auto entry = get_goal_entry(uuid);
+    std::lock_guard<std::mutex> lock(goals_mutex_);
+    entry->uuid_ = uuid;
+    entry->stamp_ = RCL_S_TO_NS(static_cast<int64_t>(goal_info.stamp.sec)) +
+      goal_info.stamp.nanosec;
+    entry->handle_ = std::move(handle);
+    goals_by_stamp_.emplace(entry->stamp_, entry);
+  }
+
+  // Remove an expired goal from the goal table
+  void
+  remove_goal(const GoalUUID & uuid)
+  {
+    std::lock_guard<std::mutex> lock(goals_mutex_);
+    auto iter = goals_.find(uuid);
+    if (iter == goals_.end()) {
+      return;
+    }
+    auto range = goals_by_stamp_.equal_range(iter->second->stamp_);
+    for (auto stamp_iter = range.first; stamp_iter != range.second; ++stamp_iter) {
+      if (stamp_iter->second == iter->second) {
+        goals_by_stamp_.erase(stamp_iter);
+        break;
+      }
+    }
+    goals_.erase(iter);
+  }
+
+  // Select the goals to cancel with the same policy as rcl_action_process_cancel_request():
+  // a goal by id, every goal accepted at or before a time, both, or every goal when neither
+  // is given. Only the goals which can still be canceled are selected.
+  // Return the return code of the cancel response.
+  int8_t
+  select_goals_to_cancel(
+    const action_msgs::msg::GoalInfo & request, std::vector<action_msgs::msg::GoalInfo> & goals)
+  {
+    using CancelGoalResponse = action_msgs::srv::CancelGoal::Response;
+    const bool zero_uuid = request.goal_id.uuid == GoalUUID();
+    const bool zero_stamp = 0 == request.stamp.sec && 0u == request.stamp.nanosec;
+    const int64_t request_stamp = RCL_S_TO_NS(static_cast<int64_t>(request.stamp.sec)) +
+      request.stamp.nanosec;
+
+    auto select = [&goals](const GoalEntry & entry) {
+        if (!rcl_action_goal_handle_is_cancelable(entry.handle_.get())) {
+          return false;
+        }
+        goals.emplace_back();
+        goals.back().goal_id.uuid = entry.uuid_;
+        goals.back().stamp.sec = static_cast<int32_t>(RCL_NS_TO_S(entry.stamp_));
+        goals.back().stamp.nanosec = static_cast<uint32_t>(entry.stamp_ % RCL_S_TO_NS(1));
+        return true;
+      };
+
+    std::lock_guard<std::mutex> lock(goals_mutex_);
+    std::shared_ptr<GoalEntry> requested_goal;
+    if (!zero_uuid) {
+      auto iter = goals_.find(request.goal_id.uuid);
+      if (iter != goals_.end() && iter->second->handle_) {
+        requested_goal = iter->second;
+      }
+    }
+    if (zero_stamp && !zero_uuid) {
+      if (!requested_goal) {
+        return CancelGoalResponse::ERROR_UNKNOWN_GOAL_ID;
+      }
+      if (!select(*requested_goal)) {
+        return CancelGoalResponse::ERROR_GOAL_TERMINATED;
+      }
+      return CancelGoalResponse::ERROR_NONE;
+    }
+
+    // The goals are visited in the order they were accepted, only up to the requested time
+    auto end = zero_stamp ? goals_by_stamp_.end() : goals_by_stamp_.upper_bound(request_stamp);
+    for (auto iter = goals_by_stamp_.begin(); iter != end; ++iter) {
+      select(*iter->second);
+    }
+    if (requested_goal && requested_goal->stamp_ > request_stamp) {
+      select(*requested_goal);
+    }
+    return CancelGoalResponse::ERROR_NONE;
+  }
+
+  // Lock for the goal table only, never held while locking anything else
+  std::mutex goals_mutex_;
+  std::unordered_map<GoalUUID, std::shared_ptr<GoalEntry>> goals_;
+  // Accepted goals, ordered by the time they were accepted
+  std::multimap<int64_t, std::shared_ptr<GoalEntry>> goals_by_stamp_;
 
-  // Lock for unordered_maps
-  std::recursive_mutex unordered_map_mutex_;
+  using IntraProcessClientWeakPtr = detail::ActionServerIntraProcess::ClientWeakPtr;
 
-  // Results to be kept until the goal expires after reaching a terminal state
-  std::unordered_map<GoalUUID, std::shared_ptr<void>> goal_results_;
-  // Requests for results are kept until a result becomes available
-  std::unordered_map<GoalUUID, std::vector<rmw_request_id_t>> result_requests_;
-  // rcl goal handles are kept so api to send result doesn't try to access freed memory
-  std::unordered_map<GoalUUID, std::shared_ptr<rcl_action_goal_handle_t>> goal_handles_;
+  // Record the client of the process sending a goal, before the goal is handled
+  void
+  add_intra_process_goal(const GoalUUID & uuid, const IntraProcessClientWeakPtr & client)
+  {
+    std::lock_guard<std::mutex> lock(intra_process_mutex_);
+    intra_process_goal_clients_[uuid] = client;
+    bool known = false;
+    auto end = std::remove_if(
+      intra_process_clients_.begin(), intra_process_clients_.end(),
+      [&client, &known](const IntraProcessClientWeakPtr & other) {
+        known = known || (!other.owner_before(client) && !client.owner_before(other));
+        return other.expired();
+      });
+    intra_process_clients_.erase(end, intra_process_clients_.end());
+    if (!known) {
+      intra_process_clients_.push_back(client);
+    }
+  }
+
+  // Forget the client of the process which sent a goal, if any
+  void
+  remove_intra_process_goal(const GoalUUID & uuid)
+  {
+    if (!intra_process_) {
+      return;
+    }
+    std::lock_guard<std::mutex> lock(intra_process_mutex_);
+    intra_process_goal_clients_.erase(uuid);
+  }
+
+  // Hand the feedback of a goal over to the client of the process which sent it, if any.
+  // Return false if the feedback must be published as well: the goal was sent through the
+  // middleware, or other processes subscribe to the feedback, e.g. tools recording it.
+  bool
+  send_intra_process_feedback(const GoalUUID & uuid, const std::shared_ptr<void> & feedback_msg)
+  {
+    if (!intra_process_) {
+      return false;
+    }
+    std::shared_ptr<detail::ActionClientIntraProcess> client;
+    {
+      std::lock_guard<std::mutex> lock(intra_process_mutex_);
+      auto iter = intra_process_goal_clients_.find(uuid);
+      if (iter == intra_process_goal_clients_.end()) {
+        return false;
+      }
+      client = iter->second.lock();
+    }
+    // Dropped if the client no longer exists
+    if (client) {
+      client->receive_feedback(feedback_msg);
+    }
+    return !has_inter_process_feedback_subscriptions();
+  }
+
+  // Return true if the feedback topic has subscriptions other than the ones of the clients of
+  // the process, which receive the feedback in-process
+  bool
+  has_inter_process_feedback_subscriptions()
+  {
+    size_t subscription_count = 0;
+    rcl_ret_t ret = rcl_count_subscribers(
+      node_handle_.get(), feedback_topic_name_.c_str(), &subscription_count);
+    if (RCL_RET_OK != ret) {
+      rclcpp::exceptions::throw_from_rcl_error(ret, "failed to count feedback subscriptions");
+    }
+    return subscription_count > intra_process_->get_client_count();
+  }
+
+  // Hand a copy of the status message over to the clients of the process
+  void
+  send_intra_process_status(const action_msgs::msg::GoalStatusArray & status_msg)
+  {
+    if (!intra_process_) {
+      return;
+    }
+    std::vector<std::shared_ptr<detail::ActionClientIntraProcess>> clients;
+    {
+      std::lock_guard<std::mutex> lock(intra_process_mutex_);
+      for (const auto & weak_client : intra_process_clients_) {
+        auto client = weak_client.lock();
+        if (client) {
+          clients.push_back(std::move(client));
+        }
+      }
+    }
+    if (clients.empty()) {
+      return;
+    }
+    // status_msg_ is reused, the clients share a copy which they don't modify
+    auto shared_status = std::make_shared<action_msgs::msg::GoalStatusArray>(status_msg);
+    for (const auto & client : clients) {
+      client->receive_status(shared_status);
+    }
+  }
+
+  // Set when the node uses intra-process communication by default
+  std::shared_ptr<detail::ActionServerIntraProcess> intra_process_;
+  // Node of the server and fully qualified name of its feedback topic, to count the
+  // subscriptions to the feedback
+  std::shared_ptr<const rcl_node_t> node_handle_;
+  std::string feedback_topic_name_;
+  std::weak_ptr<rclcpp::experimental::IntraProcessManager> weak_ipm_;
+  uint64_t intra_process_id_ = 0;
+
+  // Lock for the clients of the process below, never held while locking anything else
+  std::mutex intra_process_mutex_;
+  // Client of each goal sent without the middleware, until the result of the goal
+  std::unordered_map<GoalUUID, IntraProcessClientWeakPtr> intra_process_goal_clients_;
+  // Clients which sent goals, to which the status is handed over
+  std::vector<IntraProcessClientWeakPtr> intra_process_clients_;
 
   rclcpp::Logger logger_;
 };
@@ -128,10 +474,69 @@ ServerBase::ServerBase(
   if (RCL_RET_OK != ret) {
     rclcpp::exceptions::throw_from_rcl_error(ret);
   }
+
+  // The timers publishing the coalesced status and the conflated feedback are waited on
+  // along with the action server, they're executed by execute() rather than by a callback.
+  pimpl_->status_timer_ = std::make_shared<rclcpp::WallTimer<rclcpp::VoidCallbackType>>(
+    std::chrono::nanoseconds(0), []() {}, node_base->get_context(), false);
+  pimpl_->feedback_timer_ = std::make_shared<rclcpp::WallTimer<rclcpp::VoidCallbackType>>(
+    std::chrono::nanoseconds(0), []() {}, node_base->get_context(), false);
+  pimpl_->num_timers_ += 2;
+
+  if (!node_base->get_use_intra_process_default()) {
+    return;
+  }
+  using IntraProcess = detail::ActionServerIntraProcess;
+  auto context = node_base->get_context();
+  // The handlers are only called by the executor of this server
+  pimpl_->intra_process_ = std::make_shared<IntraProcess>(
+    context, rcl_action_server_get_action_name(pimpl_->action_server_.get()), type_support,
+    [this](
+      std::shared_ptr<void> request, IntraProcess::ResponseCallback respond,
+      IntraProcess::ClientWeakPtr client)
+    {
+      // Known before the goal is accepted, since feedback may be published right away then
+      GoalUUID uuid = get_goal_id_from_goal_request(request.get());
+      pimpl_->add_intra_process_goal(uuid, client);
+      if (!handle_goal_request(std::move(request), respond)) {
+        pimpl_->remove_intra_process_goal(uuid);
+      }
+    },
+    [this](std::shared_ptr<void> request, IntraProcess::ResponseCallback respond) {
+      respond(handle_cancel_request(std::move(request)));
+    },
+    [this](std::shared_ptr<void> request, IntraProcess::ResponseCallback respond) {
+      GoalUUID uuid = get_goal_id_from_result_request(request.get());
+      std::shared_ptr<void> result_response;
+      auto entry = pimpl_->find_goal_entry_for_result(uuid);
+      if (!entry) {
+        result_response = create_result_response(action_msgs::msg::GoalStatus::STATUS_UNKNOWN);
+      } else {
+        result_response = ServerBaseImpl::get_result_or_store_request(
+          *entry, [&respond](ServerBaseImpl::GoalEntry & goal) {
+            goal.intra_process_result_requests_.push_back(std::move(respond));
+          });
+      }
+      if (result_response) {
+        respond(result_response);
+      }
+    });
+  pimpl_->node_handle_ = node_base->get_shared_rcl_node_handle();
+  pimpl_->feedback_topic_name_ =
+    std::string(rcl_action_server_get_action_name(pimpl_->action_server_.get())) +
+    "/_action/feedback";
+  auto ipm = rclcpp::experimental::IntraProcessManager::get_instance(*context);
+  pimpl_->intra_process_id_ = ipm->add_service(pimpl_->intra_process_);
+  pimpl_->weak_ipm_ = ipm;
+  pimpl_->num_guard_conditions_++;
 }
 
 ServerBase::~ServerBase()
 {
+  auto ipm = pimpl_->weak_ipm_.lock();
+  if (ipm) {
+    ipm->remove_service(pimpl_->intra_process_id_);
+  }
 }
 
 size_t
@@ -167,12 +572,28 @@ ServerBase::get_number_of_ready_guard_conditions()
 void
 ServerBase::add_to_wait_set(rcl_wait_set_t * wait_set)
 {
-  std::lock_guard<std::recursive_mutex> lock(pimpl_->action_server_reentrant_mutex_);
+  std::lock_guard lock(pimpl_->action_server_reentrant_mutex_);
   rcl_ret_t ret = rcl_action_wait_set_add_action_server(
     wait_set, pimpl_->action_server_.get(), NULL);
   if (RCL_RET_OK != ret) {
     rclcpp::exceptions::throw_from_rcl_error(ret, "ServerBase::add_to_wait_set() failed");
   }
+
+  ret = rcl_wait_set_add_timer(
+    wait_set, pimpl_->status_timer_->get_timer_handle().get(), &pimpl_->status_timer_index_);
+  if (RCL_RET_OK != ret) {
+    rclcpp::exceptions::throw_from_rcl_error(ret, "ServerBase::add_to_wait_set() failed");
+  }
+
+  ret = rcl_wait_set_add_timer(
+    wait_set, pimpl_->feedback_timer_->get_timer_handle().get(), &pimpl_->feedback_timer_index_);
+  if (RCL_RET_OK != ret) {
+    rclcpp::exceptions::throw_from_rcl_error(ret, "ServerBase::add_to_wait_set() failed");
+  }
+
+  if (pimpl_->intra_process_) {
+    pimpl_->intra_process_->add_to_wait_set(wait_set);
+  }
 }
 
 bool
@@ -184,7 +605,7 @@ ServerBase::is_ready(rcl_wait_set_t * wait_set)
   bool goal_expired;
   rcl_ret_t ret;
   {
-    std::lock_guard<std::recursive_mutex> lock(pimpl_->action_server_reentrant_mutex_);
+    std::lock_guard lock(pimpl_->action_server_reentrant_mutex_);
     ret = rcl_action_server_wait_set_get_entities_ready(
       wait_set,
       pimpl_->action_server_.get(),
@@ -192,6 +613,12 @@ ServerBase::is_ready(rcl_wait_set_t * wait_set)
       &cancel_request_ready,
       &result_request_ready,
       &goal_expired);
+    pimpl_->status_timer_ready_ = RCL_RET_OK == ret &&
+      ServerBaseImpl::is_timer_ready(
+      wait_set, pimpl_->status_timer_, pimpl_->status_timer_index_);
+    pimpl_->feedback_timer_ready_ = RCL_RET_OK == ret &&
+      ServerBaseImpl::is_timer_ready(
+      wait_set, pimpl_->feedback_timer_, pimpl_->feedback_timer_index_);
   }
 
   pimpl_->goal_request_ready_ = goal_request_ready;
@@ -203,64 +630,52 @@ ServerBase::is_ready(rcl_wait_set_t * wait_set)
     rclcpp::exceptions::throw_from_rcl_error(ret);
   }
 
-  return pimpl_->goal_request_ready_.load() ||
+  pimpl_->intra_process_ready_ =
+    pimpl_->intra_process_ && pimpl_->intra_process_->is_ready(wait_set);
+
+  return pimpl_->intra_process_ready_.load() ||
+         pimpl_->goal_request_ready_.load() ||
          pimpl_->cancel_request_ready_.load() ||
          pimpl_->result_request_ready_.load() ||
-         pimpl_->goal_expired_.load();
+         pimpl_->goal_expired_.load() ||
+         pimpl_->status_timer_ready_.load() ||
+         pimpl_->feedback_timer_ready_.load();
 }
 
 std::shared_ptr<void>
 ServerBase::take_data()
 {
-  if (pimpl_->goal_request_ready_.load()) {
-    rcl_ret_t ret;
-    rcl_action_goal_info_t goal_info = rcl_action_get_zero_initialized_goal_info();
-    rmw_request_id_t request_header;
-
-    std::lock_guard<std::recursive_mutex> lock(pimpl_->action_server_reentrant_mutex_);
-
-    std::shared_ptr<void> message = create_goal_request();
-    ret = rcl_action_take_goal_request(
-      pimpl_->action_server_.get(),
-      &request_header,
-      message.get());
-
-    return std::static_pointer_cast<void>(
-      std::make_shared
-      <std::tuple<rcl_ret_t, rcl_action_goal_info_t, rmw_request_id_t, std::shared_ptr<void>>>(
-        ret,
-        goal_info,
-        request_header, message));
+  // Taken first: unlike the entities of the middleware, it's not ready again on the next wait
+  if (pimpl_->intra_process_ready_.load()) {
+    return pimpl_->intra_process_->take_data();
+  } else if (pimpl_->goal_request_ready_.load()) {
+    std::lock_guard lock(pimpl_->action_server_reentrant_mutex_);
+    auto taken_data = pimpl_->taken_data_pool_.acquire();
+    taken_data->message = detail::reuse_or_create(
+      pimpl_->goal_request_, [this]() {return this->create_goal_request();});
+    taken_data->ret = rcl_action_take_goal_request(
+      pimpl_->action_server_.get(), &taken_data->request_header, taken_data->message.get());
+    return taken_data;
   } else if (pimpl_->cancel_request_ready_.load()) {
-    rcl_ret_t ret;
-    rmw_request_id_t request_header;
-
-    // Initialize cancel request
-    auto request = std::make_shared<action_msgs::srv::CancelGoal::Request>();
-
-    std::lock_guard<std::recursive_mutex> lock(pimpl_->action_server_reentrant_mutex_);
-    ret = rcl_action_take_cancel_request(
-      pimpl_->action_server_.get(),
-      &request_header,
-      request.get());
-
-    return std::static_pointer_cast<void>(
-      std::make_shared
-      <std::tuple<rcl_ret_t, std::shared_ptr<action_msgs::srv::CancelGoal::Request>,
-      rmw_request_id_t>>(ret, request, request_header));
+    std::lock_guard lock(pimpl_->action_server_reentrant_mutex_);
+    auto taken_data = pimpl_->taken_data_pool_.acquire();
+    taken_data->message = detail::reuse_or_create(
+      pimpl_->cancel_request_,
+      []() {return std::make_shared<action_msgs::srv::CancelGoal::Request>();});
+    taken_data->ret = rcl_action_take_cancel_request(
+      pimpl_->action_server_.get(), &taken_data->request_header, taken_data->message.get());
+    return taken_data;
   } else if (pimpl_->result_request_ready_.load()) {
-    rcl_ret_t ret;
-    // Get the result request message
-    rmw_request_id_t request_header;
-    std::shared_ptr<void> result_request = create_result_request();
-    std::lock_guard<std::recursive_mutex> lock(pimpl_->action_server_reentrant_mutex_);
-    ret = rcl_action_take_result_request(
-      pimpl_->action_server_.get(), &request_header, result_request.get());
-
-    return std::static_pointer_cast<void>(
-      std::make_shared<std::tuple<rcl_ret_t, std::shared_ptr<void>, rmw_request_id_t>>(
-        ret, result_request, request_header));
-  } else if (pimpl_->goal_expired_.load()) {
+    std::lock_guard lock(pimpl_->action_server_reentrant_mutex_);
+    auto taken_data = pimpl_->taken_data_pool_.acquire();
+    taken_data->message = detail::reuse_or_create(
+      pimpl_->result_request_, [this]() {return this->create_result_request();});
+    taken_data->ret = rcl_action_take_result_request(
+      pimpl_->action_server_.get(), &taken_data->request_header, taken_data->message.get());
+    return taken_data;
+  } else if (pimpl_->goal_expired_.load() || pimpl_->status_timer_ready_.load() ||
+    pimpl_->feedback_timer_ready_.load())
+  {
     return nullptr;
   } else {
     throw std::runtime_error("Taking data from action server but nothing is ready");
@@ -281,6 +696,9 @@ ServerBase::take_data_by_entity_id(size_t id)
     case EntityType::CancelService:
       pimpl_->cancel_request_ready_ = true;
       break;
+    case EntityType::IntraProcess:
+      pimpl_->intra_process_ready_ = true;
+      break;
   }
 
   return take_data();
@@ -289,11 +707,17 @@ ServerBase::take_data_by_entity_id(size_t id)
 void
 ServerBase::execute(std::shared_ptr<void> & data)
 {
-  if (!data && !pimpl_->goal_expired_.load()) {
+  // The work of the intra-process queue may also be taken by another thread
+  if (!data && !pimpl_->goal_expired_.load() && !pimpl_->status_timer_ready_.load() &&
+    !pimpl_->feedback_timer_ready_.load() && !pimpl_->intra_process_ready_.load())
+  {
     throw std::runtime_error("'data' is empty");
   }
 
-  if (pimpl_->goal_request_ready_.load()) {
+  if (pimpl_->intra_process_ready_.load()) {
+    pimpl_->intra_process_ready_ = false;
+    pimpl_->intra_process_->execute(data);
+  } else if (pimpl_->goal_request_ready_.load()) {
     execute_goal_request_received(data);
   } else if (pimpl_->cancel_request_ready_.load()) {
     execute_cancel_request_received(data);
@@ -301,6 +725,10 @@ ServerBase::execute(std::shared_ptr<void> & data)
     execute_result_request_received(data);
   } else if (pimpl_->goal_expired_.load()) {
     execute_check_expired_goals();
+  } else if (pimpl_->status_timer_ready_.load()) {
+    execute_publish_pending_status();
+  } else if (pimpl_->feedback_timer_ready_.load()) {
+    execute_publish_pending_feedback();
   } else {
     throw std::runtime_error("Executing action server but nothing is ready");
   }
@@ -309,9 +737,8 @@ ServerBase::execute(std::shared_ptr<void> & data)
 void
 ServerBase::execute_goal_request_received(std::shared_ptr<void> & data)
 {
-  auto shared_ptr = std::static_pointer_cast
-    <std::tuple<rcl_ret_t, rcl_action_goal_info_t, rmw_request_id_t, std::shared_ptr<void>>>(data);
-  rcl_ret_t ret = std::get<0>(*shared_ptr);
+  auto taken_data = std::static_pointer_cast<detail::TakenData>(data);
+  rcl_ret_t ret = taken_data->ret;
   if (RCL_RET_ACTION_SERVER_TAKE_FAILED == ret) {
     // Ignore take failure because connext fails if it receives a sample without valid data.
     // This happens when a client shuts down and connext receives a sample saying the client is
@@ -320,32 +747,41 @@ ServerBase::execute_goal_request_received(std::shared_ptr<void> & data)
   } else if (RCL_RET_OK != ret) {
     rclcpp::exceptions::throw_from_rcl_error(ret);
   }
-  rcl_action_goal_info_t goal_info = std::get<1>(*shared_ptr);
-  rmw_request_id_t request_header = std::get<2>(*shared_ptr);
-  std::shared_ptr<void> message = std::get<3>(*shared_ptr);
+  rmw_request_id_t request_header = taken_data->request_header;
+  std::shared_ptr<void> message = taken_data->message;
 
   bool expected = true;
   if (!pimpl_->goal_request_ready_.compare_exchange_strong(expected, false)) {
     return;
   }
 
+  handle_goal_request(
+    std::move(message),
+    [this, &request_header](std::shared_ptr<void> response) {
+      rcl_ret_t rcl_ret;
+      {
+        std::lock_guard lock(pimpl_->action_server_reentrant_mutex_);
+        rcl_ret = rcl_action_send_goal_response(
+          pimpl_->action_server_.get(), &request_header, response.get());
+      }
+      if (RCL_RET_OK != rcl_ret) {
+        rclcpp::exceptions::throw_from_rcl_error(rcl_ret);
+      }
+    });
+  data.reset();
+}
+
+bool
+ServerBase::handle_goal_request(
+  std::shared_ptr<void> message, const std::function<void(std::shared_ptr<void>)> & respond)
+{
   GoalUUID uuid = get_goal_id_from_goal_request(message.get());
+  rcl_action_goal_info_t goal_info = rcl_action_get_zero_initialized_goal_info();
   convert(uuid, &goal_info);
 
   // Call user's callback, getting the user's response and a ros message to send back
   auto response_pair = call_handle_goal_callback(uuid, message);
-
-  {
-    std::lock_guard<std::recursive_mutex> lock(pimpl_->action_server_reentrant_mutex_);
-    ret = rcl_action_send_goal_response(
-      pimpl_->action_server_.get(),
-      &request_header,
-      response_pair.second.get());
-  }
-
-  if (RCL_RET_OK != ret) {
-    rclcpp::exceptions::throw_from_rcl_error(ret);
-  }
+  respond(response_pair.second);
 
   const auto status = response_pair.first;
 
@@ -367,7 +803,7 @@ ServerBase::execute_goal_request_received(std::shared_ptr<void> & data)
       };
     rcl_action_goal_handle_t * rcl_handle;
     {
-      std::lock_guard<std::recursive_mutex> lock(pimpl_->action_server_reentrant_mutex_);
+      std::lock_guard lock(pimpl_->action_server_reentrant_mutex_);
       rcl_handle = rcl_action_accept_new_goal(pimpl_->action_server_.get(), &goal_info);
     }
     if (!rcl_handle) {
@@ -378,14 +814,11 @@ ServerBase::execute_goal_request_received(std::shared_ptr<void> & data)
     // Copy out goal handle since action server storage disappears when it is fini'd
     *handle = *rcl_handle;
 
-    {
-      std::lock_guard<std::recursive_mutex> lock(pimpl_->unordered_map_mutex_);
-      pimpl_->goal_handles_[uuid] = handle;
-    }
+    pimpl_->add_goal(uuid, handle);
 
     if (GoalResponse::ACCEPT_AND_EXECUTE == status) {
       // Change status to executing
-      ret = rcl_action_update_goal_state(handle.get(), GOAL_EVENT_EXECUTE);
+      rcl_ret_t ret = rcl_action_update_goal_state(handle.get(), GOAL_EVENT_EXECUTE);
       if (RCL_RET_OK != ret) {
         rclcpp::exceptions::throw_from_rcl_error(ret);
       }
@@ -395,17 +828,16 @@ ServerBase::execute_goal_request_received(std::shared_ptr<void> & data)
 
     // Tell user to start executing action
     call_goal_accepted_callback(handle, uuid, message);
+    return true;
   }
-  data.reset();
+  return false;
 }
 
 void
 ServerBase::execute_cancel_request_received(std::shared_ptr<void> & data)
 {
-  auto shared_ptr = std::static_pointer_cast
-    <std::tuple<rcl_ret_t, std::shared_ptr<action_msgs::srv::CancelGoal::Request>,
-      rmw_request_id_t>>(data);
-  auto ret = std::get<0>(*shared_ptr);
+  auto taken_data = std::static_pointer_cast<detail::TakenData>(data);
+  auto ret = taken_data->ret;
   if (RCL_RET_ACTION_SERVER_TAKE_FAILED == ret) {
     // Ignore take failure because connext fails if it receives a sample without valid data.
     // This happens when a client shuts down and connext receives a sample saying the client is
@@ -414,61 +846,46 @@ ServerBase::execute_cancel_request_received(std::shared_ptr<void> & data)
   } else if (RCL_RET_OK != ret) {
     rclcpp::exceptions::throw_from_rcl_error(ret);
   }
-  auto request = std::get<1>(*shared_ptr);
-  auto request_header = std::get<2>(*shared_ptr);
+  auto request = taken_data->message;
+  auto request_header = taken_data->request_header;
   pimpl_->cancel_request_ready_ = false;
 
-  // Convert c++ message to C message
-  rcl_action_cancel_request_t cancel_request = rcl_action_get_zero_initialized_cancel_request();
-  convert(request->goal_info.goal_id.uuid, &cancel_request.goal_info);
-  cancel_request.goal_info.stamp.sec = request->goal_info.stamp.sec;
-  cancel_request.goal_info.stamp.nanosec = request->goal_info.stamp.nanosec;
-
-  // Get a list of goal info that should be attempted to be cancelled
-  rcl_action_cancel_response_t cancel_response = rcl_action_get_zero_initialized_cancel_response();
+  auto response = handle_cancel_request(std::move(request));
 
   {
-    std::lock_guard<std::recursive_mutex> lock(pimpl_->action_server_reentrant_mutex_);
-    ret = rcl_action_process_cancel_request(
-      pimpl_->action_server_.get(),
-      &cancel_request,
-      &cancel_response);
+    std::lock_guard lock(pimpl_->action_server_reentrant_mutex_);
+    ret = rcl_action_send_cancel_response(
+      pimpl_->action_server_.get(), &request_header, response.get());
   }
 
   if (RCL_RET_OK != ret) {
     rclcpp::exceptions::throw_from_rcl_error(ret);
   }
+  data.reset();
+}
 
-  RCPPUTILS_SCOPE_EXIT(
-  {
-    ret = rcl_action_cancel_response_fini(&cancel_response);
-    if (RCL_RET_OK != ret) {
-      RCLCPP_ERROR(pimpl_->logger_, "Failed to fini cancel response");
-    }
-  });
+std::shared_ptr<void>
+ServerBase::handle_cancel_request(std::shared_ptr<void> message)
+{
+  auto request = std::static_pointer_cast<action_msgs::srv::CancelGoal::Request>(message);
 
+  // Get a list of goal info that should be attempted to be cancelled, from the goal table
+  // rather than from the rcl server, so that the other goals aren't visited
+  std::vector<action_msgs::msg::GoalInfo> goals;
   auto response = std::make_shared<action_msgs::srv::CancelGoal::Response>();
+  response->return_code = pimpl_->select_goals_to_cancel(request->goal_info, goals);
 
-  response->return_code = cancel_response.msg.return_code;
-  auto & goals = cancel_response.msg.goals_canceling;
   // For each canceled goal, call cancel callback
-  for (size_t i = 0; i < goals.size; ++i) {
-    const rcl_action_goal_info_t & goal_info = goals.data[i];
-    GoalUUID uuid;
-    convert(goal_info, &uuid);
-    auto response_code = call_handle_cancel_callback(uuid);
+  for (auto & goal_info : goals) {
+    auto response_code = call_handle_cancel_callback(goal_info.goal_id.uuid);
     if (CancelResponse::ACCEPT == response_code) {
-      action_msgs::msg::GoalInfo cpp_info;
-      cpp_info.goal_id.uuid = uuid;
-      cpp_info.stamp.sec = goal_info.stamp.sec;
-      cpp_info.stamp.nanosec = goal_info.stamp.nanosec;
-      response->goals_canceling.push_back(cpp_info);
+      response->goals_canceling.push_back(std::move(goal_info));
     }
   }
 
   // If the user rejects all individual requests to cancel goals,
   // then we consider the top-level cancel request as rejected.
-  if (goals.size >= 1u && 0u == response->goals_canceling.size()) {
+  if (!goals.empty() && response->goals_canceling.empty()) {
     response->return_code = action_msgs::srv::CancelGoal::Response::ERROR_REJECTED;
   }
 
@@ -476,25 +893,14 @@ ServerBase::execute_cancel_request_received(std::shared_ptr<void> & data)
     // at least one goal state changed, publish a new status message
     publish_status();
   }
-
-  {
-    std::lock_guard<std::recursive_mutex> lock(pimpl_->action_server_reentrant_mutex_);
-    ret = rcl_action_send_cancel_response(
-      pimpl_->action_server_.get(), &request_header, response.get());
-  }
-
-  if (RCL_RET_OK != ret) {
-    rclcpp::exceptions::throw_from_rcl_error(ret);
-  }
-  data.reset();
+  return response;
 }
 
 void
 ServerBase::execute_result_request_received(std::shared_ptr<void> & data)
 {
-  auto shared_ptr = std::static_pointer_cast
-    <std::tuple<rcl_ret_t, std::shared_ptr<void>, rmw_request_id_t>>(data);
-  auto ret = std::get<0>(*shared_ptr);
+  auto taken_data = std::static_pointer_cast<detail::TakenData>(data);
+  auto ret = taken_data->ret;
   if (RCL_RET_ACTION_SERVER_TAKE_FAILED == ret) {
     // Ignore take failure because connext fails if it receives a sample without valid data.
     // This happens when a client shuts down and connext receives a sample saying the client is
@@ -503,39 +909,29 @@ ServerBase::execute_result_request_received(std::shared_ptr<void> & data)
   } else if (RCL_RET_OK != ret) {
     rclcpp::exceptions::throw_from_rcl_error(ret);
   }
-  auto result_request = std::get<1>(*shared_ptr);
-  auto request_header = std::get<2>(*shared_ptr);
+  auto result_request = taken_data->message;
+  auto request_header = taken_data->request_header;
 
   pimpl_->result_request_ready_ = false;
   std::shared_ptr<void> result_response;
 
   // check if the goal exists
   GoalUUID uuid = get_goal_id_from_result_request(result_request.get());
-  rcl_action_goal_info_t goal_info;
-  convert(uuid, &goal_info);
-  bool goal_exists;
-  {
-    std::lock_guard<std::recursive_mutex> lock(pimpl_->action_server_reentrant_mutex_);
-    goal_exists = rcl_action_server_goal_exists(pimpl_->action_server_.get(), &goal_info);
-  }
-  if (!goal_exists) {
+  auto entry = pimpl_->find_goal_entry_for_result(uuid);
+  if (!entry) {
     // Goal does not exists
     result_response = create_result_response(action_msgs::msg::GoalStatus::STATUS_UNKNOWN);
   } else {
-    // Goal exists, check if a result is already available
-    std::lock_guard<std::recursive_mutex> lock(pimpl_->unordered_map_mutex_);
-    auto iter = pimpl_->goal_results_.find(uuid);
-    if (iter != pimpl_->goal_results_.end()) {
-      result_response = iter->second;
-    } else {
-      // Store the request so it can be responded to later
-      pimpl_->result_requests_[uuid].push_back(request_header);
-    }
+    // Goal exists, store the request so it can be responded to later if there's no result yet
+    result_response = ServerBaseImpl::get_result_or_store_request(
+      *entry, [&request_header](ServerBaseImpl::GoalEntry & goal) {
+        goal.result_requests_.push_back(request_header);
+      });
   }
 
   if (result_response) {
     // Send the result now
-    std::lock_guard<std::recursive_mutex> lock(pimpl_->action_server_reentrant_mutex_);
+    std::lock_guard lock(pimpl_->action_server_reentrant_mutex_);
     rcl_ret_t rcl_ret = rcl_action_send_result_response(
       pimpl_->action_server_.get(), &request_header, result_response.get());
     if (RCL_RET_OK != rcl_ret) {
@@ -548,41 +944,91 @@ ServerBase::execute_result_request_received(std::shared_ptr<void> & data)
 void
 ServerBase::execute_check_expired_goals()
 {
-  // Allocate expecting only one goal to expire at a time
-  rcl_action_goal_info_t expired_goals[1];
-  size_t num_expired = 1;
+  // rcl visits every goal to find the expired ones, so they're all expired by a single call
+  // sized for every known goal, rather than by a call for each expired goal
+  size_t capacity;
+  {
+    std::lock_guard<std::mutex> lock(pimpl_->goals_mutex_);
+    capacity = std::max<size_t>(pimpl_->goals_.size(), 1u);
+  }
+  std::vector<rcl_action_goal_info_t> expired_goals(capacity);
+  size_t num_expired = capacity;
 
-  // Loop in case more than 1 goal expired
-  while (num_expired > 0u) {
+  // Loop in case more goals expired than were known
+  while (num_expired == expired_goals.size()) {
     rcl_ret_t ret;
     {
-      std::lock_guard<std::recursive_mutex> lock(pimpl_->action_server_reentrant_mutex_);
-      ret = rcl_action_expire_goals(pimpl_->action_server_.get(), expired_goals, 1, &num_expired);
+      std::lock_guard lock(pimpl_->action_server_reentrant_mutex_);
+      ret = rcl_action_expire_goals(
+        pimpl_->action_server_.get(), expired_goals.data(), expired_goals.size(), &num_expired);
     }
     if (RCL_RET_OK != ret) {
       rclcpp::exceptions::throw_from_rcl_error(ret);
-    } else if (num_expired) {
-      // A goal expired!
+    }
+    for (size_t i = 0; i < num_expired; ++i) {
       GoalUUID uuid;
-      convert(expired_goals[0], &uuid);
+      convert(expired_goals[i], &uuid);
       RCLCPP_DEBUG(pimpl_->logger_, "Expired goal %s", to_string(uuid).c_str());
-      std::lock_guard<std::recursive_mutex> lock(pimpl_->unordered_map_mutex_);
-      pimpl_->goal_results_.erase(uuid);
-      pimpl_->result_requests_.erase(uuid);
-      pimpl_->goal_handles_.erase(uuid);
+      pimpl_->remove_goal(uuid);
+      pimpl_->remove_intra_process_goal(uuid);
     }
   }
 }
 
+void
+ServerBase::execute_publish_pending_status()
+{
+  pimpl_->status_timer_ready_ = false;
+  std::lock_guard lock(pimpl_->action_server_reentrant_mutex_);
+  // Acknowledge the timer, it's restarted by the next change
+  if (!pimpl_->status_timer_->call()) {
+    return;
+  }
+  pimpl_->status_timer_->cancel();
+  if (pimpl_->status_pending_) {
+    publish_status_message();
+  }
+}
+
 void
 ServerBase::publish_status()
+{
+  std::lock_guard lock(pimpl_->action_server_reentrant_mutex_);
+
+  const auto period = pimpl_->status_publish_period_;
+  if (period <= std::chrono::nanoseconds(0)) {
+    publish_status_message();
+    return;
+  }
+
+  const auto elapsed = std::chrono::steady_clock::now() - pimpl_->last_status_publish_;
+  if (elapsed >= period) {
+    pimpl_->status_timer_->cancel();
+    publish_status_message();
+  } else if (!pimpl_->status_pending_) {
+    // Publish the changes from now on when the period ends
+    pimpl_->status_pending_ = true;
+    int64_t old_period = 0;
+    rcl_ret_t ret = rcl_timer_exchange_period(
+      pimpl_->status_timer_->get_timer_handle().get(),
+      std::chrono::duration_cast<std::chrono::nanoseconds>(period - elapsed).count(),
+      &old_period);
+    if (RCL_RET_OK != ret) {
+      rclcpp::exceptions::throw_from_rcl_error(ret);
+    }
+    pimpl_->status_timer_->reset();
+  }
+}
+
+void
+ServerBase::publish_status_message()
 {
   rcl_ret_t ret;
 
-  // We need to hold the lock across this entire method because
+  // The lock is held across this entire method because
   // rcl_action_server_get_goal_handles() returns an internal pointer to the
   // goal data.
-  std::lock_guard<std::recursive_mutex> lock(pimpl_->action_server_reentrant_mutex_);
+  std::lock_guard lock(pimpl_->action_server_reentrant_mutex_);
 
   // Get all goal handles known to C action server
   rcl_action_goal_handle_t ** goal_handles = NULL;
@@ -594,95 +1040,135 @@ ServerBase::publish_status()
     rclcpp::exceptions::throw_from_rcl_error(ret);
   }
 
-  auto status_msg = std::make_shared<action_msgs::msg::GoalStatusArray>();
-  status_msg->status_list.reserve(num_goals);
-  // Populate a c++ status message with the goals and their statuses
-  rcl_action_goal_status_array_t c_status_array =
-    rcl_action_get_zero_initialized_goal_status_array();
-  ret = rcl_action_get_goal_status_array(pimpl_->action_server_.get(), &c_status_array);
-  if (RCL_RET_OK != ret) {
-    rclcpp::exceptions::throw_from_rcl_error(ret);
-  }
-
-  RCPPUTILS_SCOPE_EXIT(
-  {
-    ret = rcl_action_goal_status_array_fini(&c_status_array);
+  // Populate the reused c++ status message with the goals and their statuses,
+  // directly from the goal handles rather than from an allocated C status array
+  auto & status_msg = pimpl_->status_msg_;
+  status_msg.status_list.clear();
+  status_msg.status_list.reserve(num_goals);
+  for (size_t i = 0; i < num_goals; ++i) {
+    rcl_action_goal_info_t c_goal_info = rcl_action_get_zero_initialized_goal_info();
+    ret = rcl_action_goal_handle_get_info(goal_handles[i], &c_goal_info);
     if (RCL_RET_OK != ret) {
-      RCLCPP_ERROR(pimpl_->logger_, "Failed to fini status array message");
+      rclcpp::exceptions::throw_from_rcl_error(ret);
+    }
+    rcl_action_goal_state_t c_status;
+    ret = rcl_action_goal_handle_get_status(goal_handles[i], &c_status);
+    if (RCL_RET_OK != ret) {
+      rclcpp::exceptions::throw_from_rcl_error(ret);
     }
-  });
-
-  for (size_t i = 0; i < c_status_array.msg.status_list.size; ++i) {
-    auto & c_status_msg = c_status_array.msg.status_list.data[i];
 
-    action_msgs::msg::GoalStatus msg;
-    msg.status = c_status_msg.status;
+    status_msg.status_list.emplace_back();
+    action_msgs::msg::GoalStatus & msg = status_msg.status_list.back();
+    msg.status = c_status;
     // Convert C goal info to C++ goal info
-    convert(c_status_msg.goal_info, &msg.goal_info.goal_id.uuid);
-    msg.goal_info.stamp.sec = c_status_msg.goal_info.stamp.sec;
-    msg.goal_info.stamp.nanosec = c_status_msg.goal_info.stamp.nanosec;
-
-    status_msg->status_list.push_back(msg);
+    convert(c_goal_info, &msg.goal_info.goal_id.uuid);
+    msg.goal_info.stamp.sec = c_goal_info.stamp.sec;
+    msg.goal_info.stamp.nanosec = c_goal_info.stamp.nanosec;
   }
 
   // Publish the message through the status publisher
-  ret = rcl_action_publish_status(pimpl_->action_server_.get(), status_msg.get());
+  ret = rcl_action_publish_status(pimpl_->action_server_.get(), &status_msg);
 
   if (RCL_RET_OK != ret) {
     rclcpp::exceptions::throw_from_rcl_error(ret);
   }
+
+  // The clients of the process get it without the middleware, as they ignore the one above
+  pimpl_->send_intra_process_status(status_msg);
+
+  pimpl_->status_pending_ = false;
+  pimpl_->last_status_publish_ = std::chrono::steady_clock::now();
 }
 
 void
-ServerBase::publish_result(const GoalUUID & uuid, std::shared_ptr<void> result_msg)
+ServerBase::set_status_publish_period(std::chrono::nanoseconds period)
 {
-  // Check that the goal exists
-  rcl_action_goal_info_t goal_info;
-  convert(uuid, &goal_info);
-  bool goal_exists;
-  {
-    std::lock_guard<std::recursive_mutex> lock(pimpl_->action_server_reentrant_mutex_);
-    goal_exists = rcl_action_server_goal_exists(pimpl_->action_server_.get(), &goal_info);
+  if (period < std::chrono::nanoseconds(0)) {
+    throw std::invalid_argument("the status publish period must not be negative");
   }
+  std::lock_guard lock(pimpl_->action_server_reentrant_mutex_);
+  if (period > std::chrono::nanoseconds(0)) {
+    std::lock_guard<std::recursive_mutex> listener_lock(listener_mutex_);
+    if (on_ready_callback_set_) {
+      throw std::runtime_error(kStatusPublishPeriodOnReadyError);
+    }
+  }
+  pimpl_->status_publish_period_ = period;
+  if (pimpl_->status_pending_) {
+    // Don't delay the pending status according to the previous period
+    pimpl_->status_timer_->cancel();
+    publish_status_message();
+  }
+}
 
-  if (!goal_exists) {
+std::chrono::nanoseconds
+ServerBase::get_status_publish_period() const
+{
+  std::lock_guard lock(pimpl_->action_server_reentrant_mutex_);
+  return pimpl_->status_publish_period_;
+}
+
+void
+ServerBase::publish_result(const GoalUUID & uuid, std::shared_ptr<void> result_msg)
+{
+  // Check that the goal exists
+  auto entry = pimpl_->find_goal_entry(uuid);
+  if (!entry) {
     throw std::runtime_error("Asked to publish result for goal that does not exist");
   }
 
+  // The conflated feedback of the goal comes before its result
+  std::shared_ptr<void> pending_feedback;
   {
-    /**
-    * NOTE: There is a potential deadlock issue if both unordered_map_mutex_ and
-    * action_server_reentrant_mutex_ locked in other block scopes. Unless using
-    * std::scoped_lock, locking order must be consistent with the current.
-    *
-    * Current locking order:
-    *
-    *   1. unordered_map_mutex_
-    *   2. action_server_reentrant_mutex_
-    *
-    */
-    std::lock_guard<std::recursive_mutex> unordered_map_lock(pimpl_->unordered_map_mutex_);
-    pimpl_->goal_results_[uuid] = result_msg;
-
-    // if there are clients who already asked for the result, send it to them
-    auto iter = pimpl_->result_requests_.find(uuid);
-    if (iter != pimpl_->result_requests_.end()) {
-      std::lock_guard<std::recursive_mutex> lock(pimpl_->action_server_reentrant_mutex_);
-      for (auto & request_header : iter->second) {
-        rcl_ret_t ret = rcl_action_send_result_response(
-          pimpl_->action_server_.get(), &request_header, result_msg.get());
-        if (RCL_RET_OK != ret) {
-          rclcpp::exceptions::throw_from_rcl_error(ret);
-        }
+    std::lock_guard<std::mutex> lock(pimpl_->feedback_mutex_);
+    auto iter = pimpl_->pending_feedback_.find(uuid);
+    if (iter != pimpl_->pending_feedback_.end()) {
+      pending_feedback = std::move(iter->second);
+      pimpl_->pending_feedback_.erase(iter);
+    }
+  }
+  if (pending_feedback && !pimpl_->send_intra_process_feedback(uuid, pending_feedback)) {
+    publish_feedback(pending_feedback);
+  }
+  // No feedback comes after the result
+  pimpl_->remove_intra_process_goal(uuid);
+
+  // Store the result, and take the requests of the clients who already asked for it.
+  // They are answered once the goal's lock is released, so that the rcl server state
+  // is never locked while holding it.
+  std::vector<rmw_request_id_t> result_requests;
+  std::vector<detail::ActionServerIntraProcess::ResponseCallback> intra_process_result_requests;
+  {
+    std::lock_guard<std::mutex> lock(entry->mutex_);
+    if (entry->result_) {
+      throw std::runtime_error("Asked to publish result for goal that already has one");
+    }
+    entry->result_ = result_msg;
+    entry->result_ready_.store(true, std::memory_order_release);
+    result_requests.swap(entry->result_requests_);
+    intra_process_result_requests.swap(entry->intra_process_result_requests_);
+  }
+
+  // Every response is sent from the same shared message, under a single lock of the server
+  if (!result_requests.empty()) {
+    std::lock_guard lock(pimpl_->action_server_reentrant_mutex_);
+    for (auto & request_header : result_requests) {
+      rcl_ret_t ret = rcl_action_send_result_response(
+        pimpl_->action_server_.get(), &request_header, result_msg.get());
+      if (RCL_RET_OK != ret) {
+        rclcpp::exceptions::throw_from_rcl_error(ret);
       }
     }
   }
+  for (auto & respond : intra_process_result_requests) {
+    respond(result_msg);
+  }
 }
 
 void
 ServerBase::notify_goal_terminal_state()
 {
-  std::lock_guard<std::recursive_mutex> lock(pimpl_->action_server_reentrant_mutex_);
+  std::lock_guard lock(pimpl_->action_server_reentrant_mutex_);
   rcl_ret_t ret = rcl_action_notify_goal_done(pimpl_->action_server_.get());
   if (RCL_RET_OK != ret) {
     rclcpp::exceptions::throw_from_rcl_error(ret);
@@ -692,13 +1178,97 @@ ServerBase::notify_goal_terminal_state()
 void
 ServerBase::publish_feedback(std::shared_ptr<void> feedback_msg)
 {
-  std::lock_guard<std::recursive_mutex> lock(pimpl_->action_server_reentrant_mutex_);
+  // Publishing is thread-safe and doesn't change the rcl server state, so the feedback of
+  // concurrent goals doesn't contend on action_server_reentrant_mutex_.
   rcl_ret_t ret = rcl_action_publish_feedback(pimpl_->action_server_.get(), feedback_msg.get());
   if (RCL_RET_OK != ret) {
     rclcpp::exceptions::throw_from_rcl_error(ret, "Failed to publish feedback");
   }
 }
 
+void
+ServerBase::publish_feedback(const GoalUUID & uuid, std::shared_ptr<void> feedback_msg)
+{
+  {
+    std::lock_guard<std::mutex> lock(pimpl_->feedback_mutex_);
+    if (pimpl_->feedback_publish_period_ > std::chrono::nanoseconds(0)) {
+      // The latest feedback wins, it's published by the feedback timer
+      pimpl_->pending_feedback_[uuid] = std::move(feedback_msg);
+      if (pimpl_->feedback_timer_->is_canceled()) {
+        pimpl_->feedback_timer_->reset();
+      }
+      return;
+    }
+  }
+  if (!pimpl_->send_intra_process_feedback(uuid, feedback_msg)) {
+    publish_feedback(feedback_msg);
+  }
+}
+
+void
+ServerBase::execute_publish_pending_feedback()
+{
+  pimpl_->feedback_timer_ready_ = false;
+  std::unordered_map<GoalUUID, std::shared_ptr<void>> pending_feedback;
+  {
+    std::lock_guard<std::mutex> lock(pimpl_->feedback_mutex_);
+    if (!pimpl_->feedback_timer_->call()) {
+      return;
+    }
+    pending_feedback.swap(pimpl_->pending_feedback_);
+    if (pending_feedback.empty()) {
+      // No feedback during the last period, wait for the next one
+      pimpl_->feedback_timer_->cancel();
+    }
+  }
+  for (auto & goal_feedback : pending_feedback) {
+    if (!pimpl_->send_intra_process_feedback(goal_feedback.first, goal_feedback.second)) {
+      publish_feedback(goal_feedback.second);
+    }
+  }
+}
+
+void
+ServerBase::set_feedback_publish_period(std::chrono::nanoseconds period)
+{
+  if (period < std::chrono::nanoseconds(0)) {
+    throw std::invalid_argument("the feedback publish period must not be negative");
+  }
+  std::unordered_map<GoalUUID, std::shared_ptr<void>> pending_feedback;
+  {
+    std::lock_guard<std::recursive_mutex> listener_lock(listener_mutex_);
+    if (period > std::chrono::nanoseconds(0) && on_ready_callback_set_) {
+      throw std::runtime_error(kFeedbackPublishPeriodOnReadyError);
+    }
+    std::lock_guard<std::mutex> lock(pimpl_->feedback_mutex_);
+    pimpl_->feedback_publish_period_ = period;
+    if (period > std::chrono::nanoseconds(0)) {
+      int64_t old_period = 0;
+      rcl_ret_t ret = rcl_timer_exchange_period(
+        pimpl_->feedback_timer_->get_timer_handle().get(), period.count(), &old_period);
+      if (RCL_RET_OK != ret) {
+        rclcpp::exceptions::throw_from_rcl_error(ret);
+      }
+    } else {
+      // Feedback is no longer conflated, publish what's pending right away
+      pimpl_->feedback_timer_->cancel();
+      pending_feedback.swap(pimpl_->pending_feedback_);
+    }
+  }
+  for (auto & goal_feedback : pending_feedback) {
+    if (!pimpl_->send_intra_process_feedback(goal_feedback.first, goal_feedback.second)) {
+      publish_feedback(goal_feedback.second);
+    }
+  }
+}
+
+std::chrono::nanoseconds
+ServerBase::get_feedback_publish_period() const
+{
+  std::lock_guard<std::mutex> lock(pimpl_->feedback_mutex_);
+  return pimpl_->feedback_publish_period_;
+}
+
 void
 ServerBase::set_on_ready_callback(std::function<void(size_t, int)> callback)
 {
@@ -708,9 +1278,28 @@ ServerBase::set_on_ready_callback(std::function<void(size_t, int)> callback)
             "is not callable.");
   }
 
+  // Held until the callbacks are set, so that no publish period is set meanwhile
+  std::lock_guard lock(pimpl_->action_server_reentrant_mutex_);
+  std::lock_guard<std::recursive_mutex> listener_lock(listener_mutex_);
+  if (pimpl_->status_publish_period_ > std::chrono::nanoseconds(0)) {
+    throw std::runtime_error(kStatusPublishPeriodOnReadyError);
+  }
+  {
+    std::lock_guard<std::mutex> feedback_lock(pimpl_->feedback_mutex_);
+    if (pimpl_->feedback_publish_period_ > std::chrono::nanoseconds(0)) {
+      throw std::runtime_error(kFeedbackPublishPeriodOnReadyError);
+    }
+  }
+
   set_callback_to_entity(EntityType::GoalService, callback);
   set_callback_to_entity(EntityType::ResultService, callback);
   set_callback_to_entity(EntityType::CancelService, callback);
+  if (pimpl_->intra_process_) {
+    pimpl_->intra_process_->set_on_ready_callback(
+      [callback](size_t number_of_events, int) {
+        callback(number_of_events, static_cast<int>(EntityType::IntraProcess));
+      });
+  }
 }
 
 void
@@ -830,6 +1419,9 @@ ServerBase::clear_on_ready_callback()
     set_on_ready_callback(EntityType::CancelService, nullptr, nullptr);
     on_ready_callback_set_ = false;
   }
+  if (pimpl_->intra_process_) {
+    pimpl_->intra_process_->clear_on_ready_callback();
+  }
 
   entity_type_to_on_ready_callback_.clear();
 }
@@ -0,0 +1,343 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "performance_test_fixture/performance_test_fixture.hpp"
+#include "rclcpp_action/rclcpp_action.hpp"
+#include "rclcpp/rclcpp.hpp"
+#include "test_msgs/action/fibonacci.hpp"
+
+using namespace std::chrono_literals;
+using performance_test_fixture::PerformanceTest;
+
+using Fibonacci = test_msgs::action::Fibonacci;
+using ServerGoalHandle = rclcpp_action::ServerGoalHandle<Fibonacci>;
+using ClientGoalHandle = rclcpp_action::ClientGoalHandle<Fibonacci>;
+using GoalUUID = rclcpp_action::GoalUUID;
+
+constexpr char fibonacci_action_name[] = "fibonacci_scaling";
+
+/// Executors compared by the benchmarks, selected by the first argument.
+enum ExecutorKind
+{
+  SingleThreaded = 0,
+  MultiThreaded,
+};
+
+/// Measure the action server and client with many concurrent goals.
+/**
+ * The action server and client nodes are spun by the same executor, in another thread.
+ * Arguments are: the executor kind and the number of concurrent goals of every iteration.
+ */
+class ActionScalingPerformanceTest : public PerformanceTest
+{
+public:
+  void SetUp(benchmark::State & st)
+  {
+    rclcpp::init(0, nullptr);
+    server_node = std::make_shared<rclcpp::Node>("action_scaling_server", "ns");
+    client_node = std::make_shared<rclcpp::Node>("action_scaling_client", "ns");
+    number_of_goals = static_cast<size_t>(st.range(1));
+
+    // Forget the results quickly, so that the server doesn't grow with the iterations
+    rcl_action_server_options_t server_options = rcl_action_server_get_default_options();
+    server_options.result_timeout.nanoseconds = RCL_S_TO_NS(1);
+    action_server = rclcpp_action::create_server<Fibonacci>(
+      server_node, fibonacci_action_name,
+      [](const GoalUUID &, std::shared_ptr<const Fibonacci::Goal>) {
+        return rclcpp_action::GoalResponse::ACCEPT_AND_EXECUTE;
+      },
+      [](std::shared_ptr<ServerGoalHandle>) {
+        return rclcpp_action::CancelResponse::ACCEPT;
+      },
+      [this](std::shared_ptr<ServerGoalHandle> goal_handle) {
+        std::lock_guard<std::mutex> lock(server_goal_handles_mutex);
+        server_goal_handles.push_back(goal_handle);
+      },
+      server_options);
+    action_client = rclcpp_action::create_client<Fibonacci>(client_node, fibonacci_action_name);
+
+    if (MultiThreaded == st.range(0)) {
+      executor = std::make_unique<rclcpp::executors::MultiThreadedExecutor>();
+    } else {
+      executor = std::make_unique<rclcpp::executors::SingleThreadedExecutor>();
+    }
+    executor->add_node(server_node);
+    executor->add_node(client_node);
+    spin_thread = std::thread([this]() {executor->spin();});
+
+    if (!action_client->wait_for_action_server(10s)) {
+      st.SkipWithError("Action server was not available");
+    }
+
+    PerformanceTest::SetUp(st);
+  }
+
+  void TearDown(benchmark::State & st)
+  {
+    PerformanceTest::TearDown(st);
+    executor->cancel();
+    spin_thread.join();
+    executor.reset();
+    server_goal_handles.clear();
+    action_client.reset();
+    action_server.reset();
+    client_node.reset();
+    server_node.reset();
+    rclcpp::shutdown();
+  }
+
+  /// Send the goals and wait until all of them are accepted.
+  bool
+  send_goals(
+    std::vector<ClientGoalHandle::SharedPtr> & goal_handles,
+    const rclcpp_action::Client<Fibonacci>::SendGoalOptions & options = {})
+  {
+    Fibonacci::Goal goal;
+    goal.order = 1;
+    std::vector<std::shared_future<ClientGoalHandle::SharedPtr>> futures;
+    futures.reserve(number_of_goals);
+    for (size_t i = 0; i < number_of_goals; ++i) {
+      futures.push_back(action_client->async_send_goal(goal, options));
+    }
+    const auto deadline = std::chrono::steady_clock::now() + 10s;
+    goal_handles.clear();
+    for (auto & future : futures) {
+      if (std::future_status::ready != future.wait_until(deadline) || !future.get()) {
+        return false;
+      }
+      goal_handles.push_back(future.get());
+    }
+    return wait_for([this]() {return server_goal_handles_size() == number_of_goals;});
+  }
+
+  /// Terminate all the goals on the server side, and forget them.
+  void
+  abort_goals()
+  {
+    std::lock_guard<std::mutex> lock(server_goal_handles_mutex);
+    for (auto & goal_handle : server_goal_handles) {
+      if (goal_handle->is_active()) {
+        goal_handle->abort(std::make_shared<Fibonacci::Result>());
+      }
+    }
+    server_goal_handles.clear();
+  }
+
+  size_t
+  server_goal_handles_size()
+  {
+    std::lock_guard<std::mutex> lock(server_goal_handles_mutex);
+    return server_goal_handles.size();
+  }
+
+  /// Wait until the predicate is true, return false after a timeout.
+  template<typename PredicateT>
+  static bool
+  wait_for(PredicateT predicate)
+  {
+    const auto deadline = std::chrono::steady_clock::now() + 10s;
+    while (!predicate()) {
+      if (std::chrono::steady_clock::now() > deadline) {
+        return false;
+      }
+      std::this_thread::yield();
+    }
+    return true;
+  }
+
+protected:
+  rclcpp::Node::SharedPtr server_node;
+  rclcpp::Node::SharedPtr client_node;
+  rclcpp_action::Server<Fibonacci>::SharedPtr action_server;
+  rclcpp_action::Client<Fibonacci>::SharedPtr action_client;
+  std::unique_ptr<rclcpp::Executor> executor;
+  std::thread spin_thread;
+  size_t number_of_goals{0};
+
+  std::vector<std::shared_ptr<ServerGoalHandle>> server_goal_handles;
+  std::mutex server_goal_handles_mutex;
+};
+
+BENCHMARK_DEFINE_F(ActionScalingPerformanceTest, accept_goals)(benchmark::State & st)
+{
+  std::vector<ClientGoalHandle::SharedPtr> goal_handles;
+  reset_heap_counters();
+  for (auto _ : st) {
+    (void)_;
+    if (!send_goals(goal_handles)) {
+      st.SkipWithError("Goals were not accepted");
+      break;
+    }
+    st.PauseTiming();
+    abort_goals();
+    goal_handles.clear();
+    st.ResumeTiming();
+  }
+  st.counters["goals_per_second"] = benchmark::Counter(
+    static_cast<double>(st.iterations() * number_of_goals), benchmark::Counter::kIsRate);
+}
+
+BENCHMARK_DEFINE_F(ActionScalingPerformanceTest, cancel_goals)(benchmark::State & st)
+{
+  std::vector<ClientGoalHandle::SharedPtr> goal_handles;
+  std::vector<std::shared_future<Fibonacci::Impl::CancelGoalService::Response::SharedPtr>>
+  cancel_futures;
+  reset_heap_counters();
+  for (auto _ : st) {
+    (void)_;
+    st.PauseTiming();
+    if (!send_goals(goal_handles)) {
+      st.SkipWithError("Goals were not accepted");
+      break;
+    }
+    st.ResumeTiming();
+
+    cancel_futures.clear();
+    for (auto & goal_handle : goal_handles) {
+      cancel_futures.push_back(action_client->async_cancel_goal(goal_handle));
+    }
+    const auto deadline = std::chrono::steady_clock::now() + 10s;
+    for (auto & future : cancel_futures) {
+      if (std::future_status::ready != future.wait_until(deadline)) {
+        st.SkipWithError("Cancel requests were not answered");
+        return;
+      }
+    }
+
+    st.PauseTiming();
+    {
+      std::lock_guard<std::mutex> lock(server_goal_handles_mutex);
+      for (auto & goal_handle : server_goal_handles) {
+        goal_handle->canceled(std::make_shared<Fibonacci::Result>());
+      }
+      server_goal_handles.clear();
+    }
+    goal_handles.clear();
+    st.ResumeTiming();
+  }
+  st.counters["cancels_per_second"] = benchmark::Counter(
+    static_cast<double>(st.iterations() * number_of_goals), benchmark::Counter::kIsRate);
+}
+
+BENCHMARK_DEFINE_F(ActionScalingPerformanceTest, feedback_throughput)(benchmark::State & st)
+{
+  std::atomic_size_t received_feedback{0};
+  rclcpp_action::Client<Fibonacci>::SendGoalOptions options;
+  options.feedback_callback = [&received_feedback](
+    ClientGoalHandle::SharedPtr, const std::shared_ptr<const Fibonacci::Feedback>) {
+      received_feedback++;
+    };
+  std::vector<ClientGoalHandle::SharedPtr> goal_handles;
+  if (!send_goals(goal_handles, options)) {
+    st.SkipWithError("Goals were not accepted");
+    return;
+  }
+  auto feedback = std::make_shared<Fibonacci::Feedback>();
+  feedback->sequence = {0, 1, 1, 2, 3, 5, 8};
+
+  // Every goal publishes one feedback message per iteration, all of them are received
+  reset_heap_counters();
+  for (auto _ : st) {
+    (void)_;
+    const size_t expected_feedback = received_feedback + number_of_goals;
+    {
+      std::lock_guard<std::mutex> lock(server_goal_handles_mutex);
+      for (auto & goal_handle : server_goal_handles) {
+        goal_handle->publish_feedback(feedback);
+      }
+    }
+    if (!wait_for([&]() {return received_feedback >= expected_feedback;})) {
+      st.SkipWithError("Feedback was not received");
+      break;
+    }
+  }
+  st.counters["feedback_per_second"] = benchmark::Counter(
+    static_cast<double>(received_feedback), benchmark::Counter::kIsRate);
+
+  abort_goals();
+}
+
+BENCHMARK_DEFINE_F(ActionScalingPerformanceTest, result_delivery)(benchmark::State & st)
+{
+  std::atomic_size_t received_results{0};
+  rclcpp_action::Client<Fibonacci>::SendGoalOptions options;
+  options.result_callback = [&received_results](const ClientGoalHandle::WrappedResult &) {
+      received_results++;
+    };
+  auto result = std::make_shared<Fibonacci::Result>();
+  result->sequence = {0, 1, 1, 2, 3, 5, 8};
+
+  std::vector<ClientGoalHandle::SharedPtr> goal_handles;
+  reset_heap_counters();
+  for (auto _ : st) {
+    (void)_;
+    st.PauseTiming();
+    if (!send_goals(goal_handles, options)) {
+      st.SkipWithError("Goals were not accepted");
+      break;
+    }
+    const size_t expected_results = received_results + number_of_goals;
+    st.ResumeTiming();
+
+    {
+      std::lock_guard<std::mutex> lock(server_goal_handles_mutex);
+      for (auto & goal_handle : server_goal_handles) {
+        goal_handle->succeed(result);
+      }
+      server_goal_handles.clear();
+    }
+    if (!wait_for([&]() {return received_results >= expected_results;})) {
+      st.SkipWithError("Results were not received");
+      break;
+    }
+
+    st.PauseTiming();
+    goal_handles.clear();
+    st.ResumeTiming();
+  }
+  st.counters["results_per_second"] = benchmark::Counter(
+    static_cast<double>(received_results), benchmark::Counter::kIsRate);
+}
+
+static void
+ActionScalingArguments(benchmark::internal::Benchmark * b)
+{
+  b->ArgNames({"executor", "goals"});
+  for (int64_t executor : {SingleThreaded, MultiThreaded}) {
+    for (int64_t goals : {1, 100, 1000}) {
+      b->Args({executor, goals});
+    }
+  }
+}
+
+BENCHMARK_REGISTER_F(ActionScalingPerformanceTest, accept_goals)
+->Apply(ActionScalingArguments)
+->UseRealTime();
+BENCHMARK_REGISTER_F(ActionScalingPerformanceTest, cancel_goals)
+->Apply(ActionScalingArguments)
+->UseRealTime();
+BENCHMARK_REGISTER_F(ActionScalingPerformanceTest, feedback_throughput)
+->Apply(ActionScalingArguments)
+->UseRealTime();
+BENCHMARK_REGISTER_F(ActionScalingPerformanceTest, result_delivery)
+->Apply(ActionScalingArguments)
+->UseRealTime();
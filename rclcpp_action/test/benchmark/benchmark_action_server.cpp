@@ -14,6 +14,8 @@
 
 #include <memory>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "performance_test_fixture/performance_test_fixture.hpp"
 #include "rclcpp_action/rclcpp_action.hpp"
@@ -324,3 +326,60 @@ BENCHMARK_F(ActionServerPerformanceTest, action_server_abort)(benchmark::State &
     server_goal_handle->abort(result);
   }
 }
+
+BENCHMARK_DEFINE_F(
+  ActionServerPerformanceTest, action_server_publish_feedback_concurrent)(benchmark::State & state)
+{
+  const size_t num_goals = static_cast<size_t>(state.range(0));
+  constexpr size_t feedback_per_goal = 100;
+  std::vector<std::shared_ptr<GoalHandle>> server_goal_handles;
+  auto action_server = rclcpp_action::create_server<Fibonacci>(
+    node, fibonacci_action_name,
+    [](const GoalUUID &, std::shared_ptr<const Fibonacci::Goal>) {
+      return rclcpp_action::GoalResponse::ACCEPT_AND_EXECUTE;
+    },
+    [](std::shared_ptr<GoalHandle>) {
+      return rclcpp_action::CancelResponse::ACCEPT;
+    },
+    [&server_goal_handles](std::shared_ptr<GoalHandle> goal_handle) {
+      server_goal_handles.push_back(goal_handle);
+    });
+
+  for (size_t i = 0; i < num_goals; ++i) {
+    auto client_goal_handle_future = AsyncSendGoalOfOrder(1);
+    rclcpp::spin_until_future_complete(node, client_goal_handle_future);
+    if (!client_goal_handle_future.get()) {
+      state.SkipWithError("Valid goal was not accepted");
+      return;
+    }
+  }
+  auto feedback = std::make_shared<Fibonacci::Feedback>();
+  feedback->sequence = {0, 1, 1, 2, 3, 5, 8};
+
+  // Each goal publishes its feedback from its own thread
+  reset_heap_counters();
+  for (auto _ : state) {
+    (void)_;
+    std::vector<std::thread> threads;
+    for (auto & server_goal_handle : server_goal_handles) {
+      threads.emplace_back(
+        [&server_goal_handle, &feedback]() {
+          for (size_t i = 0; i < feedback_per_goal; ++i) {
+            server_goal_handle->publish_feedback(feedback);
+          }
+        });
+    }
+    for (auto & thread : threads) {
+      thread.join();
+    }
+  }
+  state.SetItemsProcessed(
+    static_cast<int64_t>(state.iterations() * num_goals * feedback_per_goal));
+
+  for (auto & server_goal_handle : server_goal_handles) {
+    server_goal_handle->abort(std::make_shared<Fibonacci::Result>());
+  }
+}
+BENCHMARK_REGISTER_F(ActionServerPerformanceTest, action_server_publish_feedback_concurrent)
+->ArgName("goals")->Arg(1)->Arg(2)->Arg(4)->Arg(8)->Arg(16)
+->UseRealTime();
@@ -0,0 +1,82 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include "performance_test_fixture/performance_test_fixture.hpp"
+#include "rclcpp_action/types.hpp"
+
+using performance_test_fixture::PerformanceTest;
+
+using GoalUUID = rclcpp_action::GoalUUID;
+
+/// Measure the lookup of goal ids in the unordered maps used by action servers and clients.
+/**
+ * The argument is the number of goals in the map, all of them are looked up by an iteration.
+ */
+class GoalUUIDHashPerformanceTest : public PerformanceTest
+{
+public:
+  void SetUp(benchmark::State & st)
+  {
+    // Goal ids are random, as the ones generated by action clients
+    std::mt19937_64 generator(42);
+    const size_t number_of_goals = static_cast<size_t>(st.range(0));
+    goal_ids.resize(number_of_goals);
+    for (size_t i = 0; i < number_of_goals; ++i) {
+      const uint64_t words[2] = {generator(), generator()};
+      std::memcpy(goal_ids[i].data(), words, sizeof(words));
+      goals[goal_ids[i]] = std::make_shared<int>(0);
+    }
+    PerformanceTest::SetUp(st);
+  }
+
+  void TearDown(benchmark::State & st)
+  {
+    PerformanceTest::TearDown(st);
+    goals.clear();
+    goal_ids.clear();
+  }
+
+protected:
+  std::vector<GoalUUID> goal_ids;
+  std::unordered_map<GoalUUID, std::shared_ptr<int>> goals;
+};
+
+BENCHMARK_DEFINE_F(GoalUUIDHashPerformanceTest, find)(benchmark::State & st)
+{
+  reset_heap_counters();
+  for (auto _ : st) {
+    (void)_;
+    for (const auto & goal_id : goal_ids) {
+      auto it = goals.find(goal_id);
+      benchmark::DoNotOptimize(it);
+    }
+  }
+  st.counters["lookups_per_second"] = benchmark::Counter(
+    static_cast<double>(st.iterations() * goal_ids.size()), benchmark::Counter::kIsRate);
+  // Collisions of the hash make the buckets grow
+  size_t max_bucket_size = 0;
+  for (size_t bucket = 0; bucket < goals.bucket_count(); ++bucket) {
+    max_bucket_size = std::max(max_bucket_size, goals.bucket_size(bucket));
+  }
+  st.counters["max_bucket_size"] = static_cast<double>(max_bucket_size);
+}
+BENCHMARK_REGISTER_F(GoalUUIDHashPerformanceTest, find)->Arg(100)->Arg(10000);
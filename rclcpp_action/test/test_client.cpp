@@ -14,10 +14,12 @@
 
 #include <future>
 #include <map>
+#include <limits>
 #include <memory>
 #include <string>
 #include <utility>
 #include <thread>
+#include <vector>
 #include <chrono>
 
 #include "gtest/gtest.h"
@@ -570,6 +572,35 @@ TEST_F(TestClientAgainstServer, async_send_goal_with_feedback_callback_wait_for_
   EXPECT_EQ(5, feedback_count);
 }
 
+TEST_F(TestClientAgainstServer, async_send_goal_keep_feedback)
+{
+  auto action_client = rclcpp_action::create_client<ActionType>(client_node, action_name);
+  ASSERT_TRUE(action_client->wait_for_action_server(WAIT_FOR_SERVER_TIMEOUT));
+
+  ActionGoal goal;
+  goal.order = 4;
+  std::vector<std::shared_ptr<const ActionFeedback>> feedbacks;
+  auto send_goal_ops = rclcpp_action::Client<ActionType>::SendGoalOptions();
+  send_goal_ops.feedback_callback =
+    [&feedbacks](
+    typename ActionGoalHandle::SharedPtr,
+    const std::shared_ptr<const ActionFeedback> feedback)
+    {
+      feedbacks.push_back(feedback);
+    };
+  auto future_goal_handle = action_client->async_send_goal(goal, send_goal_ops);
+  dual_spin_until_future_complete(future_goal_handle);
+  auto goal_handle = future_goal_handle.get();
+  auto future_result = action_client->async_get_result(goal_handle);
+  dual_spin_until_future_complete(future_result);
+
+  // Feedback kept by the callback isn't overwritten by the next feedback messages
+  ASSERT_EQ(5u, feedbacks.size());
+  for (size_t i = 0; i < feedbacks.size(); ++i) {
+    EXPECT_EQ(i + 1, feedbacks[i]->sequence.size());
+  }
+}
+
 TEST_F(TestClientAgainstServer, async_send_goal_with_result_callback_wait_for_result)
 {
   auto action_client = rclcpp_action::create_client<ActionType>(client_node, action_name);
@@ -728,6 +759,42 @@ TEST_F(TestClientAgainstServer, async_cancel_all_goals)
   EXPECT_EQ(rclcpp_action::GoalStatus::STATUS_CANCELED, goal_handle1->get_status());
 }
 
+TEST_F(TestClientAgainstServer, terminal_goal_handle_retention)
+{
+  auto action_client = rclcpp_action::create_client<ActionType>(client_node, action_name);
+  ASSERT_TRUE(action_client->wait_for_action_server(WAIT_FOR_SERVER_TIMEOUT));
+  EXPECT_EQ(
+    std::numeric_limits<size_t>::max(), action_client->get_terminal_goal_handle_retention());
+  action_client->set_terminal_goal_handle_retention(1u);
+  EXPECT_EQ(1u, action_client->get_terminal_goal_handle_retention());
+
+  ActionGoal goal;
+  goal.order = 6;
+  auto future_goal_handle0 = action_client->async_send_goal(goal);
+  dual_spin_until_future_complete(future_goal_handle0);
+  auto goal_handle0 = future_goal_handle0.get();
+
+  goal.order = 8;
+  auto future_goal_handle1 = action_client->async_send_goal(goal);
+  dual_spin_until_future_complete(future_goal_handle1);
+  auto goal_handle1 = future_goal_handle1.get();
+
+  // Both goals are canceled in the order of their ids
+  if (goal_handle1->get_goal_id() < goal_handle0->get_goal_id()) {
+    goal_handle0.swap(goal_handle1);
+  }
+
+  auto future_cancel_all = action_client->async_cancel_all_goals();
+  dual_spin_until_future_complete(future_cancel_all);
+  EXPECT_EQ(rclcpp_action::GoalStatus::STATUS_CANCELED, goal_handle0->get_status());
+  EXPECT_EQ(rclcpp_action::GoalStatus::STATUS_CANCELED, goal_handle1->get_status());
+
+  // Only the latest terminal goal handle is still known
+  using rclcpp_action::exceptions::UnknownGoalHandleError;
+  EXPECT_THROW(action_client->async_get_result(goal_handle0), UnknownGoalHandleError);
+  EXPECT_NO_THROW(action_client->async_get_result(goal_handle1));
+}
+
 TEST_F(TestClientAgainstServer, async_cancel_all_goals_with_callback)
 {
   auto action_client = rclcpp_action::create_client<ActionType>(client_node, action_name);
@@ -0,0 +1,120 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+
+#include "rclcpp/rclcpp.hpp"
+#include "rclcpp_action/experimental/coroutine.hpp"
+#include "rclcpp_action/rclcpp_action.hpp"
+
+#include "test_msgs/action/fibonacci.hpp"
+
+using namespace std::chrono_literals;
+using Fibonacci = test_msgs::action::Fibonacci;
+using ClientGoalHandle = rclcpp_action::ClientGoalHandle<Fibonacci>;
+using ServerGoalHandle = rclcpp_action::ServerGoalHandle<Fibonacci>;
+using rclcpp::experimental::Task;
+
+class TestCoroutine : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    rclcpp::init(0, nullptr);
+    node = std::make_shared<rclcpp::Node>("test_action_coroutine_node", "/ns");
+    // Odd orders are rejected, accepted goals succeed with their order as sequence
+    server = rclcpp_action::create_server<Fibonacci>(
+      node, "fibonacci",
+      [](const rclcpp_action::GoalUUID &, std::shared_ptr<const Fibonacci::Goal> goal) {
+        return goal->order % 2 ? rclcpp_action::GoalResponse::REJECT :
+        rclcpp_action::GoalResponse::ACCEPT_AND_EXECUTE;
+      },
+      [](std::shared_ptr<ServerGoalHandle>) {
+        return rclcpp_action::CancelResponse::ACCEPT;
+      },
+      [](std::shared_ptr<ServerGoalHandle> goal_handle) {
+        auto result = std::make_shared<Fibonacci::Result>();
+        result->sequence.push_back(goal_handle->get_goal()->order);
+        goal_handle->succeed(result);
+      });
+    client = rclcpp_action::create_client<Fibonacci>(node, "fibonacci");
+    executor.add_node(node);
+  }
+
+  void TearDown() override
+  {
+    executor.remove_node(node);
+    client.reset();
+    server.reset();
+    node.reset();
+    rclcpp::shutdown();
+  }
+
+  rclcpp::Node::SharedPtr node;
+  rclcpp_action::Server<Fibonacci>::SharedPtr server;
+  rclcpp_action::Client<Fibonacci>::SharedPtr client;
+  rclcpp::executors::SingleThreadedExecutor executor;
+};
+
+namespace
+{
+
+struct Outcome
+{
+  bool rejected = false;
+  rclcpp_action::ResultCode code = rclcpp_action::ResultCode::UNKNOWN;
+  int32_t sequence_value = -1;
+  bool done = false;
+};
+
+Task<void>
+run_goals(rclcpp_action::Client<Fibonacci>::SharedPtr client, Outcome & outcome)
+{
+  Fibonacci::Goal goal;
+  goal.order = 1;
+  auto goal_handle = co_await rclcpp_action::experimental::send_goal(client, goal);
+  outcome.rejected = !goal_handle;
+
+  goal.order = 4;
+  goal_handle = co_await rclcpp_action::experimental::send_goal(client, goal);
+  if (goal_handle) {
+    auto result = co_await rclcpp_action::experimental::get_result(client, goal_handle);
+    outcome.code = result.code;
+    if (!result.result->sequence.empty()) {
+      outcome.sequence_value = result.result->sequence.front();
+    }
+  }
+  outcome.done = true;
+}
+
+}  // namespace
+
+TEST_F(TestCoroutine, send_goal_and_get_result) {
+  ASSERT_TRUE(client->wait_for_action_server(5s));
+
+  Outcome outcome;
+  rclcpp::experimental::spawn(run_goals(client, outcome));
+  const auto deadline = std::chrono::steady_clock::now() + 5s;
+  while (!outcome.done && std::chrono::steady_clock::now() < deadline) {
+    executor.spin_once(10ms);
+  }
+  ASSERT_TRUE(outcome.done);
+  EXPECT_TRUE(outcome.rejected);
+  EXPECT_EQ(rclcpp_action::ResultCode::SUCCEEDED, outcome.code);
+  EXPECT_EQ(4, outcome.sequence_value);
+}
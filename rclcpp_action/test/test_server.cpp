@@ -25,6 +25,7 @@
 
 #include "rcl_action/action_server.h"
 #include "rcl_action/wait.h"
+#include "rclcpp_action/create_client.hpp"
 #include "rclcpp_action/create_server.hpp"
 #include "rclcpp_action/server.hpp"
 #include "mocking_utils/patch.hpp"
@@ -72,7 +73,8 @@ protected:
   CancelResponse::SharedPtr
   send_cancel_request(
     rclcpp::Node::SharedPtr node, GoalUUID uuid,
-    std::chrono::milliseconds timeout = std::chrono::milliseconds(-1))
+    std::chrono::milliseconds timeout = std::chrono::milliseconds(-1),
+    builtin_interfaces::msg::Time stamp = builtin_interfaces::msg::Time())
   {
     auto cancel_client = node->create_client<Fibonacci::Impl::CancelGoalService>(
       "fibonacci/_action/cancel_goal");
@@ -81,6 +83,7 @@ protected:
     }
     auto request = std::make_shared<Fibonacci::Impl::CancelGoalService::Request>();
     request->goal_info.goal_id.uuid = uuid;
+    request->goal_info.stamp = stamp;
     auto future = cancel_client->async_send_request(request);
     auto return_code = rclcpp::spin_until_future_complete(node, future, timeout);
     if (rclcpp::FutureReturnCode::SUCCESS == return_code) {
@@ -474,6 +477,62 @@ TEST_F(TestServer, handle_cancel_terminated_goal)
   EXPECT_EQ(CancelResponse::ERROR_GOAL_TERMINATED, response_ptr->return_code);
 }
 
+TEST_F(TestServer, handle_cancel_by_stamp_and_all)
+{
+  auto node = std::make_shared<rclcpp::Node>("handle_cancel_node", "/rclcpp_action/handle_cancel");
+  const GoalUUID uuid1{{1, 20, 30, 40, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}};
+  const GoalUUID uuid2{{2, 20, 30, 40, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}};
+
+  auto handle_goal = [](
+    const GoalUUID &, std::shared_ptr<const Fibonacci::Goal>)
+    {
+      return rclcpp_action::GoalResponse::ACCEPT_AND_EXECUTE;
+    };
+
+  using GoalHandle = rclcpp_action::ServerGoalHandle<Fibonacci>;
+
+  auto handle_cancel = [](std::shared_ptr<GoalHandle>)
+    {
+      return rclcpp_action::CancelResponse::ACCEPT;
+    };
+
+  std::vector<std::shared_ptr<GoalHandle>> received_handles;
+  auto handle_accepted = [&received_handles](std::shared_ptr<GoalHandle> handle)
+    {
+      received_handles.push_back(handle);
+    };
+
+  auto as = rclcpp_action::create_server<Fibonacci>(
+    node, "fibonacci",
+    handle_goal,
+    handle_cancel,
+    handle_accepted);
+  (void)as;
+
+  send_goal_request(node, uuid1);
+  rclcpp::sleep_for(std::chrono::milliseconds(10));
+  const builtin_interfaces::msg::Time between_goals = node->now();
+  rclcpp::sleep_for(std::chrono::milliseconds(10));
+  send_goal_request(node, uuid2);
+  ASSERT_EQ(2u, received_handles.size());
+
+  // Only the goals accepted at or before the stamp are canceled
+  auto response_ptr = send_cancel_request(
+    node, GoalUUID(), std::chrono::milliseconds(-1), between_goals);
+  EXPECT_EQ(CancelResponse::ERROR_NONE, response_ptr->return_code);
+  ASSERT_EQ(1u, response_ptr->goals_canceling.size());
+  EXPECT_EQ(uuid1, response_ptr->goals_canceling[0].goal_id.uuid);
+  EXPECT_TRUE(received_handles[0]->is_canceling());
+  EXPECT_FALSE(received_handles[1]->is_canceling());
+
+  // Canceling goals aren't canceled again
+  response_ptr = send_cancel_request(node, GoalUUID());
+  EXPECT_EQ(CancelResponse::ERROR_NONE, response_ptr->return_code);
+  ASSERT_EQ(1u, response_ptr->goals_canceling.size());
+  EXPECT_EQ(uuid2, response_ptr->goals_canceling[0].goal_id.uuid);
+  EXPECT_TRUE(received_handles[1]->is_canceling());
+}
+
 TEST_F(TestServer, publish_status_accepted)
 {
   auto node = std::make_shared<rclcpp::Node>("status_accept_node", "/rclcpp_action/status_accept");
@@ -767,6 +826,110 @@ TEST_F(TestServer, publish_status_aborted)
   EXPECT_EQ(uuid, msg->status_list.at(0).goal_info.goal_id.uuid);
 }
 
+TEST_F(TestServer, publish_status_coalesced)
+{
+  auto node = std::make_shared<rclcpp::Node>("status_coalesced", "/rclcpp_action/coalesced");
+  const GoalUUID uuid{{10, 2, 30, 4, 50, 6, 70, 8, 90, 1, 11, 12, 13, 14, 15, 16}};
+
+  auto handle_goal = [](
+    const GoalUUID &, std::shared_ptr<const Fibonacci::Goal>)
+    {
+      return rclcpp_action::GoalResponse::ACCEPT_AND_DEFER;
+    };
+
+  using GoalHandle = rclcpp_action::ServerGoalHandle<Fibonacci>;
+
+  auto handle_cancel = [](std::shared_ptr<GoalHandle>)
+    {
+      return rclcpp_action::CancelResponse::REJECT;
+    };
+
+  std::shared_ptr<GoalHandle> received_handle;
+  auto handle_accepted = [&received_handle](std::shared_ptr<GoalHandle> handle)
+    {
+      received_handle = handle;
+    };
+
+  auto as = rclcpp_action::create_server<Fibonacci>(
+    node, "fibonacci",
+    handle_goal,
+    handle_cancel,
+    handle_accepted);
+
+  EXPECT_EQ(std::chrono::nanoseconds(0), as->get_status_publish_period());
+  EXPECT_THROW(
+    as->set_status_publish_period(std::chrono::milliseconds(-1)), std::invalid_argument);
+  as->set_status_publish_period(std::chrono::milliseconds(500));
+  EXPECT_EQ(std::chrono::milliseconds(500), as->get_status_publish_period());
+
+  // Subscribe to status messages
+  std::vector<action_msgs::msg::GoalStatusArray::ConstSharedPtr> received_msgs;
+  auto subscriber = node->create_subscription<action_msgs::msg::GoalStatusArray>(
+    "fibonacci/_action/status", 10,
+    [&received_msgs](action_msgs::msg::GoalStatusArray::ConstSharedPtr list)
+    {
+      received_msgs.push_back(list);
+    });
+
+  // The acceptance is published right away, the next changes at the end of the period
+  send_goal_request(node, uuid);
+  ASSERT_TRUE(received_handle);
+  received_handle->execute();
+  received_handle->succeed(std::make_shared<Fibonacci::Result>());
+
+  auto succeeded = [&received_msgs]() {
+      return !received_msgs.empty() && 1u == received_msgs.back()->status_list.size() &&
+             action_msgs::msg::GoalStatus::STATUS_SUCCEEDED ==
+             received_msgs.back()->status_list.at(0).status;
+    };
+  // 10 seconds
+  const size_t max_tries = 10 * 1000 / 100;
+  for (size_t retry = 0; retry < max_tries && !succeeded(); ++retry) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    rclcpp::spin_some(node);
+  }
+
+  ASSERT_TRUE(succeeded());
+  EXPECT_LE(received_msgs.size(), 2u);
+  for (auto & msg : received_msgs) {
+    ASSERT_EQ(1u, msg->status_list.size());
+    EXPECT_EQ(uuid, msg->status_list.at(0).goal_info.goal_id.uuid);
+    EXPECT_NE(action_msgs::msg::GoalStatus::STATUS_EXECUTING, msg->status_list.at(0).status);
+  }
+}
+
+TEST_F(TestServer, publish_status_coalesced_on_ready_callback)
+{
+  auto node = std::make_shared<rclcpp::Node>(
+    "status_coalesced_on_ready", "/rclcpp_action/coalesced_on_ready");
+
+  using GoalHandle = rclcpp_action::ServerGoalHandle<Fibonacci>;
+  auto as = rclcpp_action::create_server<Fibonacci>(
+    node, "fibonacci",
+    [](const GoalUUID &, std::shared_ptr<const Fibonacci::Goal>) {
+      return rclcpp_action::GoalResponse::REJECT;
+    },
+    [](std::shared_ptr<GoalHandle>) {
+      return rclcpp_action::CancelResponse::REJECT;
+    },
+    [](std::shared_ptr<GoalHandle>) {});
+
+  // The coalesced status would never be published by an executor using on ready callbacks
+  auto on_ready = [](size_t, int) {};
+  as->set_status_publish_period(std::chrono::milliseconds(500));
+  EXPECT_THROW(as->set_on_ready_callback(on_ready), std::runtime_error);
+
+  as->set_status_publish_period(std::chrono::nanoseconds(0));
+  as->set_on_ready_callback(on_ready);
+  EXPECT_THROW(
+    as->set_status_publish_period(std::chrono::milliseconds(500)), std::runtime_error);
+  EXPECT_EQ(std::chrono::nanoseconds(0), as->get_status_publish_period());
+
+  as->clear_on_ready_callback();
+  as->set_status_publish_period(std::chrono::milliseconds(500));
+  EXPECT_EQ(std::chrono::milliseconds(500), as->get_status_publish_period());
+}
+
 TEST_F(TestServer, publish_feedback)
 {
   auto node = std::make_shared<rclcpp::Node>("pub_feedback", "/rclcpp_action/pub_feedback");
@@ -825,6 +988,116 @@ TEST_F(TestServer, publish_feedback)
   ASSERT_EQ(sent_message->sequence, msg->feedback.sequence);
 }
 
+TEST_F(TestServer, publish_feedback_conflated)
+{
+  auto node = std::make_shared<rclcpp::Node>("pub_feedback", "/rclcpp_action/conflated");
+  const GoalUUID uuid{{1, 20, 30, 4, 5, 6, 70, 8, 9, 1, 11, 120, 13, 14, 15, 161}};
+
+  auto handle_goal = [](
+    const GoalUUID &, std::shared_ptr<const Fibonacci::Goal>)
+    {
+      return rclcpp_action::GoalResponse::ACCEPT_AND_EXECUTE;
+    };
+
+  using GoalHandle = rclcpp_action::ServerGoalHandle<Fibonacci>;
+
+  auto handle_cancel = [](std::shared_ptr<GoalHandle>)
+    {
+      return rclcpp_action::CancelResponse::REJECT;
+    };
+
+  std::shared_ptr<GoalHandle> received_handle;
+  auto handle_accepted = [&received_handle](std::shared_ptr<GoalHandle> handle)
+    {
+      received_handle = handle;
+    };
+
+  auto as = rclcpp_action::create_server<Fibonacci>(
+    node, "fibonacci",
+    handle_goal,
+    handle_cancel,
+    handle_accepted,
+    rcl_action_server_get_default_options(),
+    nullptr,
+    std::chrono::milliseconds(200));
+  EXPECT_EQ(std::chrono::milliseconds(200), as->get_feedback_publish_period());
+  EXPECT_THROW(
+    as->set_feedback_publish_period(std::chrono::milliseconds(-1)), std::invalid_argument);
+
+  // Subscribe to feedback messages
+  using FeedbackT = Fibonacci::Impl::FeedbackMessage;
+  std::vector<FeedbackT::ConstSharedPtr> received_msgs;
+  auto subscriber = node->create_subscription<FeedbackT>(
+    "fibonacci/_action/feedback", 10, [&received_msgs](FeedbackT::ConstSharedPtr msg)
+    {
+      received_msgs.push_back(msg);
+    });
+
+  send_goal_request(node, uuid);
+
+  // Only the latest feedback of the period is published
+  auto sent_message = std::make_shared<Fibonacci::Feedback>();
+  for (int i = 0; i < 5; ++i) {
+    sent_message->sequence.push_back(i);
+    received_handle->publish_feedback(sent_message);
+  }
+
+  // 10 seconds
+  const size_t max_tries = 10 * 1000 / 100;
+  for (size_t retry = 0; retry < max_tries && received_msgs.size() < 1u; ++retry) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    rclcpp::spin_some(node);
+  }
+
+  ASSERT_EQ(1u, received_msgs.size());
+  EXPECT_EQ(uuid, received_msgs.back()->goal_id.uuid);
+  EXPECT_EQ(sent_message->sequence, received_msgs.back()->feedback.sequence);
+
+  // The pending feedback is published when the period is reset to zero
+  sent_message->sequence = {42};
+  received_handle->publish_feedback(sent_message);
+  as->set_feedback_publish_period(std::chrono::nanoseconds(0));
+  for (size_t retry = 0; retry < max_tries && received_msgs.size() < 2u; ++retry) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    rclcpp::spin_some(node);
+  }
+
+  ASSERT_EQ(2u, received_msgs.size());
+  EXPECT_EQ(sent_message->sequence, received_msgs.back()->feedback.sequence);
+}
+
+TEST_F(TestServer, publish_feedback_conflated_on_ready_callback)
+{
+  auto node = std::make_shared<rclcpp::Node>(
+    "pub_feedback_on_ready", "/rclcpp_action/conflated_on_ready");
+
+  using GoalHandle = rclcpp_action::ServerGoalHandle<Fibonacci>;
+  auto as = rclcpp_action::create_server<Fibonacci>(
+    node, "fibonacci",
+    [](const GoalUUID &, std::shared_ptr<const Fibonacci::Goal>) {
+      return rclcpp_action::GoalResponse::REJECT;
+    },
+    [](std::shared_ptr<GoalHandle>) {
+      return rclcpp_action::CancelResponse::REJECT;
+    },
+    [](std::shared_ptr<GoalHandle>) {});
+
+  // The conflated feedback would never be published by an executor using on ready callbacks
+  auto on_ready = [](size_t, int) {};
+  as->set_feedback_publish_period(std::chrono::milliseconds(100));
+  EXPECT_THROW(as->set_on_ready_callback(on_ready), std::runtime_error);
+
+  as->set_feedback_publish_period(std::chrono::nanoseconds(0));
+  as->set_on_ready_callback(on_ready);
+  EXPECT_THROW(
+    as->set_feedback_publish_period(std::chrono::milliseconds(100)), std::runtime_error);
+  EXPECT_EQ(std::chrono::nanoseconds(0), as->get_feedback_publish_period());
+
+  as->clear_on_ready_callback();
+  as->set_feedback_publish_period(std::chrono::milliseconds(100));
+  EXPECT_EQ(std::chrono::milliseconds(100), as->get_feedback_publish_period());
+}
+
 TEST_F(TestServer, get_result)
 {
   auto node = std::make_shared<rclcpp::Node>("get_result", "/rclcpp_action/get_result");
@@ -1004,6 +1277,127 @@ TEST_F(TestServer, deferred_execution)
   EXPECT_TRUE(received_handle->is_executing());
 }
 
+TEST_F(TestServer, intra_process_client)
+{
+  auto node = std::make_shared<rclcpp::Node>(
+    "intra_process", "/rclcpp_action/intra_process",
+    rclcpp::NodeOptions().use_intra_process_comms(true));
+
+  auto handle_goal = [](
+    const GoalUUID &, std::shared_ptr<const Fibonacci::Goal>)
+    {
+      return rclcpp_action::GoalResponse::ACCEPT_AND_EXECUTE;
+    };
+
+  using GoalHandle = rclcpp_action::ServerGoalHandle<Fibonacci>;
+
+  auto handle_cancel = [](std::shared_ptr<GoalHandle>)
+    {
+      return rclcpp_action::CancelResponse::ACCEPT;
+    };
+
+  std::shared_ptr<GoalHandle> received_handle;
+  auto handle_accepted = [&received_handle](std::shared_ptr<GoalHandle> handle)
+    {
+      received_handle = handle;
+    };
+
+  auto as = rclcpp_action::create_server<Fibonacci>(
+    node, "fibonacci",
+    handle_goal,
+    handle_cancel,
+    handle_accepted);
+  (void)as;
+
+  // The server of the process is ready without waiting for discovery
+  auto ac = rclcpp_action::create_client<Fibonacci>(node, "fibonacci");
+  EXPECT_TRUE(ac->action_server_is_ready());
+
+  using ClientGoalHandle = rclcpp_action::ClientGoalHandle<Fibonacci>;
+  std::vector<std::shared_ptr<const Fibonacci::Feedback>> received_feedback;
+  rclcpp_action::Client<Fibonacci>::SendGoalOptions options;
+  options.feedback_callback = [&received_feedback](
+    ClientGoalHandle::SharedPtr, const std::shared_ptr<const Fibonacci::Feedback> feedback)
+    {
+      received_feedback.push_back(feedback);
+    };
+  Fibonacci::Goal goal;
+  goal.order = 4;
+  auto goal_future = ac->async_send_goal(goal, options);
+  ASSERT_EQ(
+    rclcpp::FutureReturnCode::SUCCESS,
+    rclcpp::spin_until_future_complete(node, goal_future, std::chrono::seconds(10)));
+  auto goal_handle = goal_future.get();
+  ASSERT_TRUE(goal_handle);
+  ASSERT_TRUE(received_handle);
+  EXPECT_EQ(goal_handle->get_goal_id(), received_handle->get_goal_id());
+
+  // The feedback of the goals of the process isn't published without other subscriptions
+  auto sent_feedback = std::make_shared<Fibonacci::Feedback>();
+  sent_feedback->sequence = {0, 1, 1, 2};
+  const size_t max_tries = 10 * 1000 / 100;
+  {
+    size_t published_feedback = 0;
+    auto mock = mocking_utils::patch(
+      "lib:rclcpp_action", rcl_action_publish_feedback,
+      [&published_feedback](const rcl_action_server_t *, void *) {
+        published_feedback++;
+        return RCL_RET_OK;
+      });
+    received_handle->publish_feedback(sent_feedback);
+    for (size_t retry = 0; retry < max_tries && received_feedback.empty(); ++retry) {
+      rclcpp::spin_some(node);
+      std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+    EXPECT_EQ(0u, published_feedback);
+  }
+  ASSERT_EQ(1u, received_feedback.size());
+  EXPECT_EQ(sent_feedback->sequence, received_feedback[0]->sequence);
+
+  // It's published for the subscriptions of other processes, e.g. tools echoing it, and the
+  // client doesn't receive it twice
+  using FeedbackT = Fibonacci::Impl::FeedbackMessage;
+  size_t published_feedback = 0;
+  auto echo_node = std::make_shared<rclcpp::Node>("echo", "/rclcpp_action/intra_process");
+  auto subscriber = echo_node->create_subscription<FeedbackT>(
+    "fibonacci/_action/feedback", 10, [&published_feedback](FeedbackT::ConstSharedPtr)
+    {
+      published_feedback++;
+    });
+  for (size_t retry = 0; retry < max_tries &&
+    node->count_subscribers("fibonacci/_action/feedback") < 2u; ++retry)
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  }
+  received_handle->publish_feedback(sent_feedback);
+  for (size_t retry = 0; retry < max_tries && published_feedback == 0u; ++retry) {
+    rclcpp::spin_some(node);
+    rclcpp::spin_some(echo_node);
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  }
+  EXPECT_EQ(1u, published_feedback);
+  rclcpp::spin_some(node);
+  EXPECT_EQ(2u, received_feedback.size());
+
+  auto cancel_future = ac->async_cancel_goal(goal_handle);
+  ASSERT_EQ(
+    rclcpp::FutureReturnCode::SUCCESS,
+    rclcpp::spin_until_future_complete(node, cancel_future, std::chrono::seconds(10)));
+  EXPECT_EQ(CancelResponse::ERROR_NONE, cancel_future.get()->return_code);
+  EXPECT_TRUE(received_handle->is_canceling());
+
+  auto result = std::make_shared<Fibonacci::Result>();
+  result->sequence = {0, 1, 1, 2, 3};
+  received_handle->canceled(result);
+  auto result_future = ac->async_get_result(goal_handle);
+  ASSERT_EQ(
+    rclcpp::FutureReturnCode::SUCCESS,
+    rclcpp::spin_until_future_complete(node, result_future, std::chrono::seconds(10)));
+  auto wrapped_result = result_future.get();
+  EXPECT_EQ(rclcpp_action::ResultCode::CANCELED, wrapped_result.code);
+  EXPECT_EQ(result->sequence, wrapped_result.result->sequence);
+}
+
 class TestBasicServer : public TestServer
 {
 public:
@@ -1155,10 +1549,10 @@ TEST_F(TestGoalRequestServer, publish_status_server_get_goal_handles_errors)
   EXPECT_THROW(SendClientGoalRequest(), rclcpp::exceptions::RCLError);
 }
 
-TEST_F(TestGoalRequestServer, publish_status_get_goal_status_array_errors)
+TEST_F(TestGoalRequestServer, publish_status_goal_handle_get_status_errors)
 {
   auto mock = mocking_utils::patch_and_return(
-    "lib:rclcpp_action", rcl_action_get_goal_status_array, RCL_RET_ERROR);
+    "lib:rclcpp_action", rcl_action_goal_handle_get_status, RCL_RET_ERROR);
 
   EXPECT_THROW(SendClientGoalRequest(), rclcpp::exceptions::RCLError);
 }
@@ -1223,14 +1617,6 @@ TEST_F(TestCancelRequestServer, execute_cancel_request_received_take_failed)
   }
 }
 
-TEST_F(TestCancelRequestServer, publish_status_rcl_errors)
-{
-  auto mock = mocking_utils::patch_and_return(
-    "lib:rclcpp_action", rcl_action_process_cancel_request, RCL_RET_ERROR);
-
-  EXPECT_THROW(SendClientCancelRequest(), rclcpp::exceptions::RCLError);
-}
-
 TEST_F(TestCancelRequestServer, publish_status_send_cancel_response_errors)
 {
   auto mock = mocking_utils::patch_and_return(
@@ -0,0 +1,68 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include "rclcpp_action/detail/taken_data.hpp"
+
+using rclcpp_action::detail::TakenDataPool;
+using rclcpp_action::detail::reuse_or_create;
+
+TEST(TestTakenData, reuse_or_create) {
+  std::shared_ptr<void> cached;
+  auto create = []() {return std::make_shared<int>(0);};
+  auto message = reuse_or_create(cached, create);
+  ASSERT_NE(nullptr, message);
+  EXPECT_EQ(cached, message);
+
+  // Referenced elsewhere, a new message is created
+  auto other_message = reuse_or_create(cached, create);
+  EXPECT_NE(message, other_message);
+
+  // Only cached, the message is reused
+  message.reset();
+  other_message.reset();
+  const void * cached_message = cached.get();
+  EXPECT_EQ(cached_message, reuse_or_create(cached, create).get());
+}
+
+TEST(TestTakenData, pool_reuses_records) {
+  TakenDataPool pool;
+  std::shared_ptr<void> cached;
+  auto create = []() {return std::make_shared<int>(0);};
+
+  auto taken_data = pool.acquire();
+  taken_data->message = reuse_or_create(cached, create);
+  const auto record = taken_data.get();
+  const auto message = taken_data->message.get();
+  taken_data.reset();
+
+  // The record and its message are reused once they aren't referenced anymore
+  taken_data = pool.acquire();
+  EXPECT_EQ(record, taken_data.get());
+  EXPECT_EQ(nullptr, taken_data->message);
+  EXPECT_EQ(message, reuse_or_create(cached, create).get());
+  EXPECT_EQ(1u, pool.size());
+
+  // Records still referenced aren't
+  auto other_taken_data = pool.acquire();
+  EXPECT_NE(taken_data, other_taken_data);
+  EXPECT_EQ(2u, pool.size());
+  taken_data.reset();
+  other_taken_data.reset();
+  pool.acquire();
+  EXPECT_EQ(2u, pool.size());
+}
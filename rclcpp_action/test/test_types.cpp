@@ -14,7 +14,13 @@
 
 #include <gtest/gtest.h>
 
+#include <cstdint>
+#include <cstring>
 #include <limits>
+#include <map>
+#include <unordered_set>
+
+#include "rclcpp_action/detail/goal_id_filter.hpp"
 #include "rclcpp_action/types.hpp"
 
 TEST(TestActionTypes, goal_uuid_to_string) {
@@ -59,3 +65,56 @@ TEST(TestActionTypes, rcl_action_goal_info_to_goal_uuid) {
     EXPECT_EQ(goal_info.goal_id.uuid[i], goal_id[i]);
   }
 }
+
+TEST(TestActionTypes, goal_id_filter) {
+  std::map<rclcpp_action::GoalUUID, int> goal_ids;
+  rclcpp_action::GoalUUID goal_id;
+  for (int goal = 0; goal < 4; ++goal) {
+    for (uint8_t i = 0; i < UUID_SIZE; ++i) {
+      goal_id[i] = static_cast<uint8_t>(goal * 37 + i * 11);
+    }
+    goal_ids[goal_id] = goal;
+  }
+
+  rclcpp_action::detail::GoalIdFilter filter;
+  for (const auto & entry : goal_ids) {
+    EXPECT_FALSE(filter.may_contain(entry.first));
+    filter.add(entry.first);
+    EXPECT_TRUE(filter.may_contain(entry.first));
+  }
+
+  // The remaining ids are kept by a reset, the empty set contains nothing
+  const rclcpp_action::GoalUUID removed = goal_ids.begin()->first;
+  goal_ids.erase(goal_ids.begin());
+  auto get_goal_id = [](const auto & entry) -> const rclcpp_action::GoalUUID & {
+      return entry.first;
+    };
+  filter.reset(goal_ids.begin(), goal_ids.end(), get_goal_id);
+  for (const auto & entry : goal_ids) {
+    EXPECT_TRUE(filter.may_contain(entry.first));
+  }
+  goal_ids.clear();
+  filter.reset(goal_ids.begin(), goal_ids.end(), get_goal_id);
+  EXPECT_FALSE(filter.may_contain(removed));
+}
+
+TEST(TestActionTypes, goal_uuid_hash) {
+  // Ids differing in a few bytes, or by the order of their bytes, get distinct hashes
+  std::hash<rclcpp_action::GoalUUID> hash;
+  std::unordered_set<size_t> hashes;
+  rclcpp_action::GoalUUID goal_id;
+  constexpr uint32_t number_of_ids = 10000;
+  for (uint32_t i = 0; i < number_of_ids; ++i) {
+    goal_id.fill(0);
+    std::memcpy(goal_id.data() + 5, &i, sizeof(i));
+    hashes.insert(hash(goal_id));
+  }
+  EXPECT_EQ(number_of_ids, hashes.size());
+
+  rclcpp_action::GoalUUID reversed;
+  for (uint8_t i = 0; i < UUID_SIZE; ++i) {
+    goal_id[i] = i;
+    reversed[UUID_SIZE - 1 - i] = i;
+  }
+  EXPECT_NE(hash(goal_id), hash(reversed));
+}
@@ -41,9 +41,16 @@
 #ifndef RCLCPP_COMPONENTS__COMPONENT_MANAGER_HPP__
 #define RCLCPP_COMPONENTS__COMPONENT_MANAGER_HPP__
 
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -93,6 +100,19 @@ public:
    * Initializes the component manager. It creates the services: load node, unload node
    * and list nodes.
    *
+   * When the read-only parameter "load_threads" is overridden with a positive value, that
+   * many threads are started to construct the loaded components, so that independent
+   * components are constructed concurrently instead of one at a time by the executor.
+   * The libraries are still loaded one at a time.
+   *
+   * When the read-only parameter "use_intra_process_comms" is overridden with true, the
+   * components use intra-process comms unless their load request disables it.
+   * A component whose publishers or subscriptions have a QoS incompatible with intra-process
+   * comms, e.g. a keep all history, is then constructed again without them, unless the load
+   * request enables them.
+   * Entities created after the construction, e.g. by a lifecycle transition, aren't covered,
+   * so the default can't be enabled for components creating such entities later.
+   *
    * \param executor the executor which will spin the node.
    * \param node_name the name of the node that the data originates from.
    * \param node_options additional options to control creation of the node.
@@ -124,6 +144,9 @@ public:
 
   /// Instantiate a component from a dynamic library.
   /**
+   * The libraries and the factories are cached, loading a component again reuses them.
+   * This function is thread-safe.
+   *
    * \param resource a component resource (class name + library path)
    * \return a NodeFactory interface
    */
@@ -139,6 +162,105 @@ public:
   virtual void
   set_executor(const std::weak_ptr<rclcpp::Executor> executor);
 
+  /// Number of publishers and subscriptions of a topic, in this container or not.
+  struct TopicEndpointCounts
+  {
+    std::string topic_name;
+    /// Endpoints of the component nodes and of the component manager
+    size_t local_publishers {0};
+    size_t local_subscriptions {0};
+    /// Endpoints of the other nodes
+    size_t remote_publishers {0};
+    size_t remote_subscriptions {0};
+  };
+
+  /// Count the local and remote endpoints of each topic of the ROS graph.
+  /**
+   * Only messages between local endpoints of components using intra-process comms avoid
+   * the middleware, so this tells which topics can be zero-copy.
+   * The counts are those discovered so far, endpoints may be missing right after creation.
+   *
+   * \return the endpoint counts of each topic, sorted by topic name
+   */
+  RCLCPP_COMPONENTS_PUBLIC
+  std::vector<TopicEndpointCounts>
+  get_topic_endpoint_counts();
+
+  /// Outcome of the lifecycle transition of a component.
+  struct TransitionResult
+  {
+    /// Unique id of the component, as returned when it was loaded
+    uint64_t unique_id {0};
+    /// Fully qualified name of the component node, empty if there is no such component
+    std::string full_node_name;
+    /// Whether the transition callback succeeded
+    bool success {false};
+    /// Id of the state of the node after the transition
+    uint8_t state_id {0};
+    /// Why the transition couldn't be triggered, empty if it was
+    std::string error_message;
+  };
+
+  /// Trigger a lifecycle transition of many lifecycle components at once.
+  /**
+   * The transitions run in-process on a pool of threads, instead of one service round trip
+   * after the other through the executor of the container, e.g. to configure and then
+   * activate all the components when bringing a system up.
+   * A transition handled by an asynchronous callback may still be in progress when this
+   * returns, it's reported as successful so far.
+   *
+   * This function is thread-safe, but the transition callbacks of the components run
+   * concurrently with their other callbacks.
+   *
+   * \param[in] transition_id the id of the transition, as in lifecycle_msgs/msg/Transition
+   * \param[in] unique_ids the components to transition, all the lifecycle components if empty
+   * \param[in] number_of_threads size of the pool, the number of cores if zero
+   * \return the result of each transition, in the order of the unique ids: components which
+   *   aren't lifecycle nodes, or not found, are reported with an error message
+   */
+  RCLCPP_COMPONENTS_PUBLIC
+  std::vector<TransitionResult>
+  transition_components(
+    uint8_t transition_id,
+    const std::vector<uint64_t> & unique_ids = {},
+    size_t number_of_threads = 0);
+
+  /// Time spent by each phase of the loading of a component, and memory it used.
+  struct LoadProfile
+  {
+    /// Unique id of the component, as returned when it was loaded
+    uint64_t unique_id {0};
+    /// Fully qualified name of the component node
+    std::string full_node_name;
+    /// Plugin name of the component, as in the load request
+    std::string plugin_name;
+    /// Finding the library of the component in the ament index
+    std::chrono::nanoseconds resource_lookup {0};
+    /// Loading the library and creating the factory of the component, unless they were cached
+    std::chrono::nanoseconds factory_creation {0};
+    /// Constructing the component node, including its parameters, entities and discovery
+    std::chrono::nanoseconds node_construction {0};
+    /// Adding the component node to the executor
+    std::chrono::nanoseconds executor_add {0};
+    /// Growth of the resident memory of the process while the component was loaded
+    /**
+     * It includes the memory used meanwhile by the other threads of the process, e.g. by
+     * components loaded concurrently, and is zero where the resident memory isn't known.
+     */
+    int64_t resident_memory_delta {0};
+  };
+
+  /// Get how long the components currently loaded took to load.
+  /**
+   * A summary is also logged once each component is loaded.
+   * This function is thread-safe.
+   *
+   * \return the load profile of each loaded component, sorted by unique id
+   */
+  RCLCPP_COMPONENTS_PUBLIC
+  std::vector<LoadProfile>
+  get_load_profiles();
+
 protected:
   /// Create node options for loaded component
   /**
@@ -165,11 +287,23 @@ protected:
   virtual void
   remove_node_from_executor(uint64_t node_id);
 
+  /// Stop the threads constructing components, waiting for the constructions in progress.
+  /**
+   * The destructor stops them, derived classes overriding add_node_to_executor() with their
+   * own members must call it first in their destructor.
+   * The requests which weren't handled yet don't get a response.
+   */
+  RCLCPP_COMPONENTS_PUBLIC
+  void
+  stop_loader_threads();
+
   /// Service callback to load a new node in the component
   /**
    * This function allows to add parameters, remap rules, a specific node, name a namespace
    * and/or additional arguments.
    *
+   * With loader threads, this function is called by one of them and must be thread-safe.
+   *
    * \param request_header unused
    * \param request information with the node to load
    * \param response
@@ -261,11 +395,29 @@ protected:
 
   uint64_t unique_id_ {1};
   std::map<std::string, std::unique_ptr<class_loader::ClassLoader>> loaders_;
+  // Declared after the loaders, the factories must be destroyed before their library
+  std::map<ComponentResource, std::shared_ptr<rclcpp_components::NodeFactory>> factories_;
   std::map<uint64_t, rclcpp_components::NodeInstanceWrapper> node_wrappers_;
+  std::map<uint64_t, LoadProfile> load_profiles_;
+  /// Protects loaders_ and factories_, held while loading a library
+  std::mutex loaders_mutex_;
+  /// Protects unique_id_, node_wrappers_ and load_profiles_, held while adding or removing
+  /// a node
+  std::mutex node_wrappers_mutex_;
 
   rclcpp::Service<LoadNode>::SharedPtr loadNode_srv_;
   rclcpp::Service<UnloadNode>::SharedPtr unloadNode_srv_;
   rclcpp::Service<ListNodes>::SharedPtr listNodes_srv_;
+
+private:
+  void
+  run_loader_thread();
+
+  std::vector<std::thread> loader_threads_;
+  std::deque<std::function<void()>> load_queue_;
+  std::mutex load_queue_mutex_;
+  std::condition_variable load_queue_cv_;
+  bool loader_threads_stopped_ {false};
 };
 
 }  // namespace rclcpp_components
@@ -16,8 +16,10 @@
 #ifndef RCLCPP_COMPONENTS__COMPONENT_MANAGER_ISOLATED_HPP__
 #define RCLCPP_COMPONENTS__COMPONENT_MANAGER_ISOLATED_HPP__
 
+#include <algorithm>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -29,6 +31,10 @@
 namespace rclcpp_components
 {
 /// ComponentManagerIsolated uses dedicated single-threaded executors for each components.
+/**
+ * With an executor pool, the components are rather distributed over a bounded number of
+ * executors, each spun by its own thread, to limit the number of threads and wait sets.
+ */
 template<typename ExecutorT = rclcpp::executors::SingleThreadedExecutor>
 class ComponentManagerIsolated : public rclcpp_components::ComponentManager
 {
@@ -39,6 +45,8 @@ class ComponentManagerIsolated : public rclcpp_components::ComponentManager
     std::shared_ptr<rclcpp::Executor> executor;
     std::thread thread;
     std::atomic_bool thread_initialized;
+    /// Number of component nodes added to the executor
+    size_t node_count {0};
 
     /// Constructor for the wrapper.
     /// This is necessary as atomic variables don't have copy/move operators
@@ -53,12 +61,31 @@ class ComponentManagerIsolated : public rclcpp_components::ComponentManager
 public:
   ~ComponentManagerIsolated()
   {
-    if (node_wrappers_.size()) {
-      for (auto & executor_wrapper : dedicated_executor_wrappers_) {
-        cancel_executor(executor_wrapper.second);
-      }
-      node_wrappers_.clear();
+    // Loader threads add nodes to the dedicated executors
+    stop_loader_threads();
+    for (auto & executor_wrapper : dedicated_executor_wrappers_) {
+      cancel_executor(*executor_wrapper.second);
+    }
+    for (auto & executor_wrapper : executor_pool_) {
+      cancel_executor(*executor_wrapper);
     }
+    node_wrappers_.clear();
+  }
+
+  /// Set the number of executors shared by the components, 0 for one executor per component.
+  /**
+   * Up to that many executors are started as components are loaded, each component is then
+   * added to the executor with the fewest components: the components keep their callback
+   * groups, but share the threads spinning the executors.
+   * It should be called before loading components, executors already started are kept.
+   *
+   * \param size the maximum number of shared executors, 0 by default
+   */
+  void
+  set_executor_pool_size(size_t size)
+  {
+    std::lock_guard<std::mutex> lock(node_wrappers_mutex_);
+    executor_pool_size_ = size;
   }
 
 protected:
@@ -69,19 +96,29 @@ protected:
   void
   add_node_to_executor(uint64_t node_id) override
   {
-    auto exec = std::make_shared<ExecutorT>();
-    exec->add_node(node_wrappers_[node_id].get_node_base_interface());
-
-    // Emplace rather than std::move since move operations are deleted for atomics
-    auto result = dedicated_executor_wrappers_.emplace(std::make_pair(node_id, exec));
-    DedicatedExecutorWrapper & wrapper = result.first->second;
-    wrapper.executor = exec;
-    auto & thread_initialized = wrapper.thread_initialized;
-    wrapper.thread = std::thread(
-      [exec, &thread_initialized]() {
-        thread_initialized = true;
-        exec->spin();
-      });
+    auto node = node_wrappers_[node_id].get_node_base_interface();
+    std::shared_ptr<DedicatedExecutorWrapper> wrapper;
+    if (executor_pool_size_ > 0 && executor_pool_.size() >= executor_pool_size_) {
+      wrapper = *std::min_element(
+        executor_pool_.begin(), executor_pool_.end(),
+        [](const auto & lhs, const auto & rhs) {return lhs->node_count < rhs->node_count;});
+      wrapper->executor->add_node(node);
+    } else {
+      auto exec = std::make_shared<ExecutorT>();
+      exec->add_node(node);
+      wrapper = std::make_shared<DedicatedExecutorWrapper>(exec);
+      auto & thread_initialized = wrapper->thread_initialized;
+      wrapper->thread = std::thread(
+        [exec, &thread_initialized]() {
+          thread_initialized = true;
+          exec->spin();
+        });
+      if (executor_pool_size_ > 0) {
+        executor_pool_.push_back(wrapper);
+      }
+    }
+    wrapper->node_count++;
+    dedicated_executor_wrappers_.emplace(node_id, std::move(wrapper));
   }
   /// Remove component node from executor model, it's invoked in on_unload_node()
   /**
@@ -92,8 +129,17 @@ protected:
   {
     auto executor_wrapper = dedicated_executor_wrappers_.find(node_id);
     if (executor_wrapper != dedicated_executor_wrappers_.end()) {
-      cancel_executor(executor_wrapper->second);
+      auto wrapper = std::move(executor_wrapper->second);
       dedicated_executor_wrappers_.erase(executor_wrapper);
+      wrapper->node_count--;
+      if (std::find(executor_pool_.begin(), executor_pool_.end(), wrapper) ==
+        executor_pool_.end())
+      {
+        cancel_executor(*wrapper);
+      } else {
+        // Shared executors keep spinning the other components
+        wrapper->executor->remove_node(node_wrappers_[node_id].get_node_base_interface());
+      }
     }
   }
 
@@ -104,6 +150,11 @@ private:
    */
   void cancel_executor(DedicatedExecutorWrapper & executor_wrapper)
   {
+    // Shared executors are referenced by several components
+    if (!executor_wrapper.thread.joinable()) {
+      return;
+    }
+
     // Verify that the executor thread has begun spinning.
     // If it has not, then wait until the thread starts to ensure
     // that cancel() will fully stop the execution
@@ -128,7 +179,11 @@ private:
     executor_wrapper.thread.join();
   }
 
-  std::unordered_map<uint64_t, DedicatedExecutorWrapper> dedicated_executor_wrappers_;
+  /// Executor of each component node, shared with other components for a pool executor
+  std::unordered_map<uint64_t, std::shared_ptr<DedicatedExecutorWrapper>>
+  dedicated_executor_wrappers_;
+  std::vector<std::shared_ptr<DedicatedExecutorWrapper>> executor_pool_;
+  size_t executor_pool_size_ {0};
 };
 
 }  // namespace rclcpp_components
@@ -15,14 +15,33 @@
 #ifndef RCLCPP_COMPONENTS__NODE_FACTORY_TEMPLATE_HPP__
 #define RCLCPP_COMPONENTS__NODE_FACTORY_TEMPLATE_HPP__
 
+#include <cstdint>
 #include <functional>
 #include <memory>
+#include <type_traits>
+#include <utility>
 
 #include "rclcpp_components/node_factory.hpp"
 
 namespace rclcpp_components
 {
 
+namespace detail
+{
+
+/// Whether NodeT has the lifecycle transitions of rclcpp_lifecycle::LifecycleNode.
+template<typename NodeT, typename = void>
+struct has_lifecycle_transitions : std::false_type {};
+
+template<typename NodeT>
+struct has_lifecycle_transitions<
+  NodeT, std::void_t<decltype(
+    std::declval<NodeT &>().trigger_transition(
+      std::declval<uint8_t>(), std::declval<typename NodeT::CallbackReturn &>()).id())>>
+  : std::true_type {};
+
+}  // namespace detail
+
 /// NodeFactoryTemplate is a convenience class for instantiating components.
 /**
  * The NodeFactoryTemplate class can be used to provide the NodeFactory interface for
@@ -44,8 +63,24 @@ public:
   {
     auto node = std::make_shared<NodeT>(options);
 
-    return NodeInstanceWrapper(
-      node, std::bind(&NodeT::get_node_base_interface, node));
+    if constexpr (detail::has_lifecycle_transitions<NodeT>::value) {
+      // Lifecycle nodes can be transitioned by the component manager, without it depending
+      // on rclcpp_lifecycle
+      return NodeInstanceWrapper(
+        node, std::bind(&NodeT::get_node_base_interface, node),
+        [](const std::shared_ptr<void> & node_instance, uint8_t transition_id) {
+          typename NodeT::CallbackReturn cb_return_code;
+          auto & state = std::static_pointer_cast<NodeT>(node_instance)->trigger_transition(
+            transition_id, cb_return_code);
+          NodeInstanceWrapper::TransitionOutcome outcome;
+          outcome.success = (cb_return_code == NodeT::CallbackReturn::SUCCESS);
+          outcome.state_id = state.id();
+          return outcome;
+        });
+    } else {
+      return NodeInstanceWrapper(
+        node, std::bind(&NodeT::get_node_base_interface, node));
+    }
   }
 };
 }  // namespace rclcpp_components
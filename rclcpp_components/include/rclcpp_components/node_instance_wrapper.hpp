@@ -15,8 +15,10 @@
 #ifndef RCLCPP_COMPONENTS__NODE_INSTANCE_WRAPPER_HPP__
 #define RCLCPP_COMPONENTS__NODE_INSTANCE_WRAPPER_HPP__
 
+#include <cstdint>
 #include <functional>
 #include <memory>
+#include <stdexcept>
 
 #include "rclcpp/node_interfaces/node_base_interface.hpp"
 
@@ -29,6 +31,19 @@ public:
   using NodeBaseInterfaceGetter = std::function<
     rclcpp::node_interfaces::NodeBaseInterface::SharedPtr(const std::shared_ptr<void> &)>;
 
+  /// Outcome of a lifecycle transition of the node.
+  struct TransitionOutcome
+  {
+    /// Whether the transition callback succeeded
+    bool success {false};
+    /// Id of the state of the node after the transition
+    uint8_t state_id {0};
+  };
+
+  /// Trigger a lifecycle transition of the node instance, given the transition id.
+  using TransitionTrigger =
+    std::function<TransitionOutcome(const std::shared_ptr<void> &, uint8_t)>;
+
   NodeInstanceWrapper()
   : node_instance_(nullptr)
   {}
@@ -39,6 +54,15 @@ public:
   : node_instance_(node_instance), node_base_interface_getter_(node_base_interface_getter)
   {}
 
+  /// Wrap a lifecycle node, whose transitions can be triggered.
+  NodeInstanceWrapper(
+    std::shared_ptr<void> node_instance,
+    NodeBaseInterfaceGetter node_base_interface_getter,
+    TransitionTrigger transition_trigger)
+  : node_instance_(node_instance), node_base_interface_getter_(node_base_interface_getter),
+    transition_trigger_(transition_trigger)
+  {}
+
   /// Get a type-erased pointer to the original Node instance
   /**
    * This is only for debugging and special cases.
@@ -62,9 +86,32 @@ public:
     return node_base_interface_getter_(node_instance_);
   }
 
+  /// Return true if the encapsulated Node instance is a lifecycle node.
+  bool
+  is_lifecycle_node() const
+  {
+    return static_cast<bool>(transition_trigger_);
+  }
+
+  /// Trigger a lifecycle transition of the encapsulated Node instance.
+  /**
+   * \param[in] transition_id the id of the transition, as in lifecycle_msgs/msg/Transition
+   * \return whether the transition succeeded, and the state of the node after it
+   * \throws std::runtime_error if the Node instance isn't a lifecycle node
+   */
+  TransitionOutcome
+  trigger_transition(uint8_t transition_id)
+  {
+    if (!transition_trigger_) {
+      throw std::runtime_error("Node instance is not a lifecycle node");
+    }
+    return transition_trigger_(node_instance_, transition_id);
+  }
+
 private:
   std::shared_ptr<void> node_instance_;
   NodeBaseInterfaceGetter node_base_interface_getter_;
+  TransitionTrigger transition_trigger_;
 };
 }  // namespace rclcpp_components
 
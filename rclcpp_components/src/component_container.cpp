@@ -13,6 +13,8 @@
 // limitations under the License.
 
 #include <memory>
+#include <string>
+#include <vector>
 
 #include "rclcpp/rclcpp.hpp"
 
@@ -22,7 +24,20 @@ int main(int argc, char * argv[])
 {
   /// Component container with a single-threaded executor.
   rclcpp::init(argc, argv);
-  auto exec = std::make_shared<rclcpp::executors::SingleThreadedExecutor>();
+  // parse arguments
+  bool use_events_executor{false};
+  std::vector<std::string> args = rclcpp::remove_ros_arguments(argc, argv);
+  for (auto & arg : args) {
+    if (arg == std::string("--use_events_executor")) {
+      use_events_executor = true;
+    }
+  }
+  std::shared_ptr<rclcpp::Executor> exec;
+  if (use_events_executor) {
+    exec = std::make_shared<rclcpp::experimental::executors::EventsExecutor>();
+  } else {
+    exec = std::make_shared<rclcpp::executors::SingleThreadedExecutor>();
+  }
   auto node = std::make_shared<rclcpp_components::ComponentManager>(exec);
   exec->add_node(node);
   exec->spin();
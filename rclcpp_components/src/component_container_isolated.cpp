@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <cstddef>
 #include <memory>
 #include <vector>
 #include <string>
@@ -26,23 +27,45 @@ int main(int argc, char * argv[])
   rclcpp::init(argc, argv);
   // parse arguments
   bool use_multi_threaded_executor{false};
+  bool use_events_executor{false};
+  // Number of executors shared by the components, 0 for one executor per component
+  size_t executor_pool_size{0};
   std::vector<std::string> args = rclcpp::remove_ros_arguments(argc, argv);
-  for (auto & arg : args) {
-    if (arg == std::string("--use_multi_threaded_executor")) {
+  for (size_t i = 0; i < args.size(); ++i) {
+    if (args[i] == std::string("--use_multi_threaded_executor")) {
       use_multi_threaded_executor = true;
+    } else if (args[i] == std::string("--use_events_executor")) {
+      use_events_executor = true;
+    } else if (args[i] == std::string("--executor_pool_size") && i + 1 < args.size()) {
+      executor_pool_size = std::stoul(args[++i]);
     }
   }
   // create executor and component manager
-  auto exec = std::make_shared<rclcpp::executors::SingleThreadedExecutor>();
+  std::shared_ptr<rclcpp::Executor> exec;
+  if (use_events_executor) {
+    exec = std::make_shared<rclcpp::experimental::executors::EventsExecutor>();
+  } else {
+    exec = std::make_shared<rclcpp::executors::SingleThreadedExecutor>();
+  }
   rclcpp::Node::SharedPtr node;
-  if (use_multi_threaded_executor) {
+  if (use_events_executor) {
+    using ComponentManagerIsolated =
+      rclcpp_components::ComponentManagerIsolated<rclcpp::experimental::executors::EventsExecutor>;
+    auto manager = std::make_shared<ComponentManagerIsolated>(exec);
+    manager->set_executor_pool_size(executor_pool_size);
+    node = manager;
+  } else if (use_multi_threaded_executor) {
     using ComponentManagerIsolated =
       rclcpp_components::ComponentManagerIsolated<rclcpp::executors::MultiThreadedExecutor>;
-    node = std::make_shared<ComponentManagerIsolated>(exec);
+    auto manager = std::make_shared<ComponentManagerIsolated>(exec);
+    manager->set_executor_pool_size(executor_pool_size);
+    node = manager;
   } else {
     using ComponentManagerIsolated =
       rclcpp_components::ComponentManagerIsolated<rclcpp::executors::SingleThreadedExecutor>;
-    node = std::make_shared<ComponentManagerIsolated>(exec);
+    auto manager = std::make_shared<ComponentManagerIsolated>(exec);
+    manager->set_executor_pool_size(executor_pool_size);
+    node = manager;
   }
   exec->add_node(node);
   exec->spin();
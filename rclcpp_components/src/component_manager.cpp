@@ -14,9 +14,16 @@
 
 #include "rclcpp_components/component_manager.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
 #include <functional>
 #include <memory>
+#include <mutex>
+#include <set>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -25,11 +32,48 @@
 #include "rcpputils/filesystem_helper.hpp"
 #include "rcpputils/split.hpp"
 
+#ifdef __linux__
+#include <unistd.h>
+#endif
+
 using namespace std::placeholders;
 
 namespace rclcpp_components
 {
 
+namespace
+{
+
+/// Return the resident memory of the process in bytes, or zero where it isn't known.
+int64_t
+get_resident_memory()
+{
+#ifdef __linux__
+  std::ifstream statm("/proc/self/statm");
+  int64_t size = 0;
+  int64_t resident_pages = 0;
+  if (statm >> size >> resident_pages) {
+    return resident_pages * static_cast<int64_t>(sysconf(_SC_PAGESIZE));
+  }
+#endif
+  return 0;
+}
+
+std::chrono::nanoseconds
+elapsed_since(std::chrono::steady_clock::time_point start)
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::steady_clock::now() - start);
+}
+
+double
+to_ms(std::chrono::nanoseconds duration)
+{
+  return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+}  // namespace
+
 ComponentManager::ComponentManager(
   std::weak_ptr<rclcpp::Executor> executor,
   std::string node_name,
@@ -37,10 +81,52 @@ ComponentManager::ComponentManager(
 : Node(std::move(node_name), node_options),
   executor_(executor)
 {
-  loadNode_srv_ = create_service<LoadNode>(
-    "~/_container/load_node",
-    std::bind(&ComponentManager::on_load_node, this, _1, _2, _3),
-    rclcpp::ServicesQoS().keep_last(200));
+  int64_t load_threads = 0;
+  {
+    rcl_interfaces::msg::ParameterDescriptor desc{};
+    desc.description = "Number of threads constructing the loaded components, 0 for none";
+    rcl_interfaces::msg::IntegerRange range{};
+    range.from_value = 0;
+    range.to_value = std::thread::hardware_concurrency();
+    desc.integer_range.push_back(range);
+    desc.read_only = true;
+    load_threads = this->declare_parameter("load_threads", static_cast<int64_t>(0), desc);
+  }
+  {
+    rcl_interfaces::msg::ParameterDescriptor desc{};
+    desc.description =
+      "Whether components use intra-process comms, unless their load request sets it";
+    desc.read_only = true;
+    this->declare_parameter("use_intra_process_comms", false, desc);
+  }
+
+  if (load_threads > 0) {
+    // The response is sent by the loader thread once the component is constructed
+    loadNode_srv_ = create_service<LoadNode>(
+      "~/_container/load_node",
+      [this](
+        std::shared_ptr<rclcpp::Service<LoadNode>> service,
+        std::shared_ptr<rmw_request_id_t> request_header,
+        std::shared_ptr<LoadNode::Request> request)
+      {
+        {
+          std::lock_guard<std::mutex> lock(load_queue_mutex_);
+          load_queue_.push_back(
+            [this, service, request_header, request]() {
+              auto response = std::make_shared<LoadNode::Response>();
+              on_load_node(request_header, request, response);
+              service->send_response(*request_header, *response);
+            });
+        }
+        load_queue_cv_.notify_one();
+      },
+      rclcpp::ServicesQoS().keep_last(200));
+  } else {
+    loadNode_srv_ = create_service<LoadNode>(
+      "~/_container/load_node",
+      std::bind(&ComponentManager::on_load_node, this, _1, _2, _3),
+      rclcpp::ServicesQoS().keep_last(200));
+  }
   unloadNode_srv_ = create_service<UnloadNode>(
     "~/_container/unload_node",
     std::bind(&ComponentManager::on_unload_node, this, _1, _2, _3),
@@ -60,10 +146,15 @@ ComponentManager::ComponentManager(
     this->declare_parameter(
       "thread_num", static_cast<int64_t>(std::thread::hardware_concurrency()), desc);
   }
+
+  for (int64_t i = 0; i < load_threads; ++i) {
+    loader_threads_.emplace_back(&ComponentManager::run_loader_thread, this);
+  }
 }
 
 ComponentManager::~ComponentManager()
 {
+  stop_loader_threads();
   if (node_wrappers_.size()) {
     RCLCPP_DEBUG(get_logger(), "Removing components from executor");
     if (auto exec = executor_.lock()) {
@@ -111,9 +202,17 @@ ComponentManager::create_component_factory(const ComponentResource & resource)
   std::string class_name = resource.first;
   std::string fq_class_name = "rclcpp_components::NodeFactoryTemplate<" + class_name + ">";
 
+  // Libraries are loaded one at a time, class_loader doesn't support loading them concurrently
+  std::lock_guard<std::mutex> lock(loaders_mutex_);
+  auto cached_factory = factories_.find(resource);
+  if (cached_factory != factories_.end()) {
+    return cached_factory->second;
+  }
+
   class_loader::ClassLoader * loader;
   if (loaders_.find(library_path) == loaders_.end()) {
     RCLCPP_INFO(get_logger(), "Load Library: %s", library_path.c_str());
+    const auto start = std::chrono::steady_clock::now();
     try {
       loaders_[library_path] = std::make_unique<class_loader::ClassLoader>(library_path);
     } catch (const std::exception & ex) {
@@ -121,6 +220,10 @@ ComponentManager::create_component_factory(const ComponentResource & resource)
     } catch (...) {
       throw ComponentManagerException("Failed to load library");
     }
+    // Told apart from the creation of the factory, which is included in the load profiles
+    RCLCPP_INFO(
+      get_logger(), "Loaded library in %.3f ms: %s", to_ms(elapsed_since(start)),
+      library_path.c_str());
   }
   loader = loaders_[library_path].get();
 
@@ -129,7 +232,9 @@ ComponentManager::create_component_factory(const ComponentResource & resource)
     RCLCPP_INFO(get_logger(), "Found class: %s", clazz.c_str());
     if (clazz == class_name || clazz == fq_class_name) {
       RCLCPP_INFO(get_logger(), "Instantiate class: %s", clazz.c_str());
-      return loader->createInstance<rclcpp_components::NodeFactory>(clazz);
+      auto factory = loader->createInstance<rclcpp_components::NodeFactory>(clazz);
+      factories_[resource] = factory;
+      return factory;
     }
   }
   return {};
@@ -164,7 +269,8 @@ ComponentManager::create_node_options(const std::shared_ptr<LoadNode::Request> r
   auto options = rclcpp::NodeOptions()
     .use_global_arguments(false)
     .parameter_overrides(parameters)
-    .arguments(remap_rules);
+    .arguments(remap_rules)
+    .use_intra_process_comms(get_parameter("use_intra_process_comms").as_bool());
 
   for (const auto & a : request->extra_arguments) {
     const rclcpp::Parameter extra_argument = rclcpp::Parameter::from_parameter_msg(a);
@@ -198,6 +304,121 @@ ComponentManager::set_executor(const std::weak_ptr<rclcpp::Executor> executor)
   executor_ = executor;
 }
 
+std::vector<ComponentManager::TopicEndpointCounts>
+ComponentManager::get_topic_endpoint_counts()
+{
+  auto full_name = [](const std::string & node_namespace, const std::string & node_name) {
+      if (!node_namespace.empty() && node_namespace.back() == '/') {
+        return node_namespace + node_name;
+      }
+      return node_namespace + "/" + node_name;
+    };
+
+  std::set<std::string> local_nodes = {get_fully_qualified_name()};
+  {
+    std::lock_guard<std::mutex> lock(node_wrappers_mutex_);
+    for (auto & wrapper : node_wrappers_) {
+      local_nodes.insert(wrapper.second.get_node_base_interface()->get_fully_qualified_name());
+    }
+  }
+
+  std::vector<TopicEndpointCounts> counts;
+  // Topic names of the map are sorted
+  for (const auto & topic : get_topic_names_and_types()) {
+    TopicEndpointCounts topic_counts;
+    topic_counts.topic_name = topic.first;
+    for (const auto & info : get_publishers_info_by_topic(topic.first)) {
+      if (local_nodes.count(full_name(info.node_namespace(), info.node_name()))) {
+        topic_counts.local_publishers++;
+      } else {
+        topic_counts.remote_publishers++;
+      }
+    }
+    for (const auto & info : get_subscriptions_info_by_topic(topic.first)) {
+      if (local_nodes.count(full_name(info.node_namespace(), info.node_name()))) {
+        topic_counts.local_subscriptions++;
+      } else {
+        topic_counts.remote_subscriptions++;
+      }
+    }
+    counts.push_back(std::move(topic_counts));
+  }
+  return counts;
+}
+
+std::vector<ComponentManager::TransitionResult>
+ComponentManager::transition_components(
+  uint8_t transition_id,
+  const std::vector<uint64_t> & unique_ids,
+  size_t number_of_threads)
+{
+  // The wrappers are copied, so that components unloaded meanwhile stay alive
+  std::vector<TransitionResult> results;
+  std::vector<NodeInstanceWrapper> wrappers;
+  {
+    std::lock_guard<std::mutex> lock(node_wrappers_mutex_);
+    if (unique_ids.empty()) {
+      for (auto & wrapper : node_wrappers_) {
+        if (wrapper.second.is_lifecycle_node()) {
+          results.emplace_back();
+          results.back().unique_id = wrapper.first;
+          wrappers.push_back(wrapper.second);
+        }
+      }
+    } else {
+      for (uint64_t unique_id : unique_ids) {
+        results.emplace_back();
+        results.back().unique_id = unique_id;
+        auto wrapper = node_wrappers_.find(unique_id);
+        if (wrapper == node_wrappers_.end()) {
+          results.back().error_message = "No node found with unique_id: " +
+            std::to_string(unique_id);
+          wrappers.emplace_back();
+        } else {
+          wrappers.push_back(wrapper->second);
+        }
+      }
+    }
+  }
+
+  std::atomic_size_t next_index {0};
+  auto transition_next = [&]() {
+      for (size_t i = next_index++; i < wrappers.size(); i = next_index++) {
+        TransitionResult & result = results[i];
+        if (!result.error_message.empty()) {
+          continue;
+        }
+        result.full_node_name =
+          wrappers[i].get_node_base_interface()->get_fully_qualified_name();
+        if (!wrappers[i].is_lifecycle_node()) {
+          result.error_message = "Component is not a lifecycle node";
+          continue;
+        }
+        try {
+          auto outcome = wrappers[i].trigger_transition(transition_id);
+          result.success = outcome.success;
+          result.state_id = outcome.state_id;
+        } catch (const std::exception & ex) {
+          result.error_message = std::string("Failed to trigger transition: ") + ex.what();
+        }
+      }
+    };
+
+  if (0u == number_of_threads) {
+    number_of_threads = std::max(1u, std::thread::hardware_concurrency());
+  }
+  // This thread is one of the pool
+  std::vector<std::thread> threads;
+  for (size_t i = 1; i < std::min(number_of_threads, wrappers.size()); ++i) {
+    threads.emplace_back(transition_next);
+  }
+  transition_next();
+  for (auto & thread : threads) {
+    thread.join();
+  }
+  return results;
+}
+
 void
 ComponentManager::add_node_to_executor(uint64_t node_id)
 {
@@ -214,6 +435,43 @@ ComponentManager::remove_node_from_executor(uint64_t node_id)
   }
 }
 
+void
+ComponentManager::stop_loader_threads()
+{
+  {
+    std::lock_guard<std::mutex> lock(load_queue_mutex_);
+    loader_threads_stopped_ = true;
+    load_queue_.clear();
+  }
+  load_queue_cv_.notify_all();
+  for (auto & thread : loader_threads_) {
+    thread.join();
+  }
+  loader_threads_.clear();
+}
+
+void
+ComponentManager::run_loader_thread()
+{
+  std::unique_lock<std::mutex> lock(load_queue_mutex_);
+  while (true) {
+    load_queue_cv_.wait(lock, [this]() {return loader_threads_stopped_ || !load_queue_.empty();});
+    if (loader_threads_stopped_) {
+      return;
+    }
+    auto load = std::move(load_queue_.front());
+    load_queue_.pop_front();
+    lock.unlock();
+    try {
+      load();
+    } catch (const std::exception & ex) {
+      RCLCPP_ERROR(get_logger(), "Failed to load a component: %s", ex.what());
+    }
+    load = nullptr;
+    lock.lock();
+  }
+}
+
 void
 ComponentManager::on_load_node(
   const std::shared_ptr<rmw_request_id_t> request_header,
@@ -222,21 +480,32 @@ ComponentManager::on_load_node(
 {
   (void) request_header;
 
+  LoadProfile profile;
+  profile.plugin_name = request->plugin_name;
+  const int64_t resident_memory_before = get_resident_memory();
   try {
+    auto start = std::chrono::steady_clock::now();
     auto resources = get_component_resources(request->package_name);
+    profile.resource_lookup = elapsed_since(start);
 
     for (const auto & resource : resources) {
       if (resource.first != request->plugin_name) {
         continue;
       }
+      start = std::chrono::steady_clock::now();
       auto factory = create_component_factory(resource);
+      profile.factory_creation = elapsed_since(start);
 
       if (factory == nullptr) {
         continue;
       }
 
       auto options = create_node_options(request);
-      auto node_id = unique_id_++;
+      uint64_t node_id;
+      {
+        std::lock_guard<std::mutex> lock(node_wrappers_mutex_);
+        node_id = unique_id_++;
+      }
 
       if (0 == node_id) {
         // This puts a technical limit on the number of times you can add a component.
@@ -249,25 +518,77 @@ ComponentManager::on_load_node(
         throw std::overflow_error("exhausted the unique ids for components in this process");
       }
 
+      // Intra-process comms enabled by the manager rather than by the request are only used
+      // by compatible components, e.g. those not publishing with a keep all history
+      const bool intra_process_comms_by_default = options.use_intra_process_comms() &&
+        std::none_of(
+        request->extra_arguments.begin(), request->extra_arguments.end(),
+        [](const auto & extra_argument) {return extra_argument.name == "use_intra_process_comms";});
+
+      auto create_node_instance = [&factory](
+        const rclcpp::NodeOptions & options, bool rethrow_intra_process_errors) {
+          try {
+            return factory->create_node_instance(options);
+          } catch (const rclcpp::exceptions::IntraProcessQoSIncompatibleError & ex) {
+            if (rethrow_intra_process_errors) {
+              // Handled by constructing the component again without intra-process comms
+              throw;
+            }
+            throw ComponentManagerException(
+                    "Component constructor threw an exception: " + std::string(ex.what()));
+          } catch (const std::exception & ex) {
+            // In the case that the component constructor throws an exception,
+            // rethrow into the following catch block.
+            throw ComponentManagerException(
+                    "Component constructor threw an exception: " + std::string(ex.what()));
+          } catch (...) {
+            // In the case that the component constructor throws an exception,
+            // rethrow into the following catch block.
+            throw ComponentManagerException("Component constructor threw an exception");
+          }
+        };
+
+      // Constructed without holding a lock, components can be constructed concurrently
+      start = std::chrono::steady_clock::now();
+      rclcpp_components::NodeInstanceWrapper node_wrapper;
       try {
-        node_wrappers_[node_id] = factory->create_node_instance(options);
-      } catch (const std::exception & ex) {
-        // In the case that the component constructor throws an exception,
-        // rethrow into the following catch block.
-        throw ComponentManagerException(
-                "Component constructor threw an exception: " + std::string(ex.what()));
-      } catch (...) {
-        // In the case that the component constructor throws an exception,
-        // rethrow into the following catch block.
-        throw ComponentManagerException("Component constructor threw an exception");
+        node_wrapper = create_node_instance(options, intra_process_comms_by_default);
+      } catch (const rclcpp::exceptions::IntraProcessQoSIncompatibleError & ex) {
+        RCLCPP_WARN(
+          get_logger(), "Component incompatible with intra-process comms (%s), "
+          "constructing it again without them", ex.what());
+        node_wrapper = create_node_instance(options.use_intra_process_comms(false), false);
       }
+      profile.node_construction = elapsed_since(start);
 
+      std::lock_guard<std::mutex> lock(node_wrappers_mutex_);
+      node_wrappers_[node_id] = std::move(node_wrapper);
+      start = std::chrono::steady_clock::now();
       add_node_to_executor(node_id);
+      profile.executor_add = elapsed_since(start);
 
       auto node = node_wrappers_[node_id].get_node_base_interface();
       response->full_node_name = node->get_fully_qualified_name();
       response->unique_id = node_id;
       response->success = true;
+
+      profile.unique_id = node_id;
+      profile.full_node_name = response->full_node_name;
+      if (resident_memory_before > 0) {
+        profile.resident_memory_delta = get_resident_memory() - resident_memory_before;
+      }
+      RCLCPP_INFO(
+        get_logger(), "Loaded component '%s' in %.3f ms: resource lookup %.3f ms, "
+        "factory creation %.3f ms, node construction %.3f ms, executor add %.3f ms, "
+        "resident memory %+.1f KiB",
+        profile.full_node_name.c_str(),
+        to_ms(
+          profile.resource_lookup + profile.factory_creation + profile.node_construction +
+          profile.executor_add),
+        to_ms(profile.resource_lookup), to_ms(profile.factory_creation),
+        to_ms(profile.node_construction), to_ms(profile.executor_add),
+        static_cast<double>(profile.resident_memory_delta) / 1024.0);
+      load_profiles_[node_id] = std::move(profile);
       return;
     }
     RCLCPP_ERROR(
@@ -291,6 +612,7 @@ ComponentManager::on_unload_node(
 {
   (void) request_header;
 
+  std::lock_guard<std::mutex> lock(node_wrappers_mutex_);
   auto wrapper = node_wrappers_.find(request->unique_id);
 
   if (wrapper == node_wrappers_.end()) {
@@ -302,10 +624,23 @@ ComponentManager::on_unload_node(
   } else {
     remove_node_from_executor(request->unique_id);
     node_wrappers_.erase(wrapper);
+    load_profiles_.erase(request->unique_id);
     response->success = true;
   }
 }
 
+std::vector<ComponentManager::LoadProfile>
+ComponentManager::get_load_profiles()
+{
+  std::lock_guard<std::mutex> lock(node_wrappers_mutex_);
+  std::vector<LoadProfile> profiles;
+  profiles.reserve(load_profiles_.size());
+  for (const auto & profile : load_profiles_) {
+    profiles.push_back(profile.second);
+  }
+  return profiles;
+}
+
 void
 ComponentManager::on_list_nodes(
   const std::shared_ptr<rmw_request_id_t> request_header,
@@ -315,6 +650,7 @@ ComponentManager::on_list_nodes(
   (void) request_header;
   (void) request;
 
+  std::lock_guard<std::mutex> lock(node_wrappers_mutex_);
   for (auto & wrapper : node_wrappers_) {
     response->unique_ids.push_back(wrapper.first);
     response->full_node_names.push_back(
@@ -16,12 +16,24 @@
 
 #include <rcutils/logging.h>
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
 
+#include "composition_interfaces/srv/load_node.hpp"
+#include "composition_interfaces/srv/unload_node.hpp"
 #include "rclcpp_components/component_manager.hpp"
 
+// Exposes the service callbacks, so that loading isn't measured with a service round trip
+class BenchmarkComponentManager : public rclcpp_components::ComponentManager
+{
+public:
+  using rclcpp_components::ComponentManager::ComponentManager;
+  using rclcpp_components::ComponentManager::on_load_node;
+  using rclcpp_components::ComponentManager::on_unload_node;
+};
+
 class ComponentTest : public benchmark::Fixture
 {
 public:
@@ -46,7 +58,7 @@ public:
 
     executor = std::make_shared<rclcpp::executors::SingleThreadedExecutor>(exec_options);
 
-    manager = std::make_shared<rclcpp_components::ComponentManager>(
+    manager = std::make_shared<BenchmarkComponentManager>(
       executor, component_manager_name, rclcpp::NodeOptions().context(context));
     executor->add_node(manager);
   }
@@ -68,7 +80,31 @@ public:
 protected:
   rclcpp::Context::SharedPtr context;
   rclcpp::executors::SingleThreadedExecutor::SharedPtr executor;
-  std::shared_ptr<rclcpp_components::ComponentManager> manager;
+  std::shared_ptr<BenchmarkComponentManager> manager;
+
+  /// Load the first test component, and return its unique id, or 0 if it failed.
+  uint64_t
+  load_node()
+  {
+    auto request = std::make_shared<composition_interfaces::srv::LoadNode::Request>();
+    request->package_name = "rclcpp_components";
+    request->plugin_name = "test_rclcpp_components::TestComponentFoo";
+    request->node_name = "benchmark_component";
+    auto response = std::make_shared<composition_interfaces::srv::LoadNode::Response>();
+    manager->on_load_node(nullptr, request, response);
+    return response->success ? response->unique_id : 0u;
+  }
+
+  /// Unload a component, and return whether it succeeded.
+  bool
+  unload_node(uint64_t unique_id)
+  {
+    auto request = std::make_shared<composition_interfaces::srv::UnloadNode::Request>();
+    request->unique_id = unique_id;
+    auto response = std::make_shared<composition_interfaces::srv::UnloadNode::Response>();
+    manager->on_unload_node(nullptr, request, response);
+    return response->success;
+  }
 };
 
 BENCHMARK_F(ComponentTest, get_component_resources)(benchmark::State & state)
@@ -122,3 +158,37 @@ BENCHMARK_F(ComponentTest, create_node_instance)(benchmark::State & state)
     benchmark::ClobberMemory();
   }
 }
+
+// Loading goes through the whole path of the load service: the resource lookup, the library
+// and factory cached after the first load, the construction and the addition to the executor.
+BENCHMARK_F(ComponentTest, load_node)(benchmark::State & state)
+{
+  for (auto _ : state) {
+    (void)_;
+    const uint64_t unique_id = load_node();
+    state.PauseTiming();
+    if (0u == unique_id || !unload_node(unique_id)) {
+      state.SkipWithError("Failed to load and unload the component");
+      break;
+    }
+    state.ResumeTiming();
+  }
+}
+
+BENCHMARK_F(ComponentTest, unload_node)(benchmark::State & state)
+{
+  for (auto _ : state) {
+    (void)_;
+    state.PauseTiming();
+    const uint64_t unique_id = load_node();
+    if (0u == unique_id) {
+      state.SkipWithError("Failed to load the component");
+      break;
+    }
+    state.ResumeTiming();
+    if (!unload_node(unique_id)) {
+      state.SkipWithError("Failed to unload the component");
+      break;
+    }
+  }
+}
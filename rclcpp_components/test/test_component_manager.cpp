@@ -14,12 +14,18 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <memory>
+#include <thread>
 
 #include "rclcpp_components/component_manager.hpp"
 
 #include "rcpputils/filesystem_helper.hpp"
 
+using namespace std::chrono_literals;
+
 class TestComponentManager : public ::testing::Test
 {
 protected:
@@ -95,3 +101,117 @@ TEST_F(TestComponentManager, create_component_factory_invalid)
     auto resources = manager->get_component_resources("invalid_rclcpp_components"),
     rclcpp_components::ComponentManagerException);
 }
+
+class ComponentManagerWithNodeOptions : public rclcpp_components::ComponentManager
+{
+public:
+  using rclcpp_components::ComponentManager::ComponentManager;
+  using rclcpp_components::ComponentManager::create_node_options;
+};
+
+TEST_F(TestComponentManager, create_node_options_intra_process_comms)
+{
+  auto exec = std::make_shared<rclcpp::executors::SingleThreadedExecutor>();
+  auto request = std::make_shared<rclcpp_components::ComponentManager::LoadNode::Request>();
+  {
+    auto manager = std::make_shared<ComponentManagerWithNodeOptions>(exec);
+    EXPECT_FALSE(manager->create_node_options(request).use_intra_process_comms());
+  }
+
+  auto manager = std::make_shared<ComponentManagerWithNodeOptions>(
+    exec, "ComponentManager",
+    rclcpp::NodeOptions()
+    .start_parameter_services(false)
+    .start_parameter_event_publisher(false)
+    .parameter_overrides({{"use_intra_process_comms", true}}));
+  EXPECT_TRUE(manager->create_node_options(request).use_intra_process_comms());
+
+  // The request overrides the default of the manager
+  request->extra_arguments.push_back(
+    rclcpp::Parameter("use_intra_process_comms", false).to_parameter_msg());
+  EXPECT_FALSE(manager->create_node_options(request).use_intra_process_comms());
+}
+
+TEST_F(TestComponentManager, get_topic_endpoint_counts)
+{
+  auto exec = std::make_shared<rclcpp::executors::SingleThreadedExecutor>();
+  auto manager = std::make_shared<rclcpp_components::ComponentManager>(exec);
+  // Not a component, its endpoints are remote ones
+  auto node = std::make_shared<rclcpp::Node>("test_remote_node");
+
+  // Both nodes publish to /rosout, wait for them to be discovered
+  rclcpp_components::ComponentManager::TopicEndpointCounts rosout_counts;
+  const auto deadline = std::chrono::steady_clock::now() + 5s;
+  while (std::chrono::steady_clock::now() < deadline) {
+    for (const auto & counts : manager->get_topic_endpoint_counts()) {
+      if (counts.topic_name == "/rosout") {
+        rosout_counts = counts;
+      }
+    }
+    if (rosout_counts.local_publishers > 0 && rosout_counts.remote_publishers > 0) {
+      break;
+    }
+    std::this_thread::sleep_for(10ms);
+  }
+  EXPECT_EQ(1u, rosout_counts.local_publishers);
+  EXPECT_LE(1u, rosout_counts.remote_publishers);
+  EXPECT_EQ(0u, rosout_counts.local_subscriptions);
+}
+
+class ComponentManagerWithWrappers : public rclcpp_components::ComponentManager
+{
+public:
+  using rclcpp_components::ComponentManager::ComponentManager;
+  using rclcpp_components::ComponentManager::node_wrappers_;
+};
+
+TEST_F(TestComponentManager, transition_components)
+{
+  using rclcpp_components::NodeInstanceWrapper;
+  auto exec = std::make_shared<rclcpp::executors::SingleThreadedExecutor>();
+  auto manager = std::make_shared<ComponentManagerWithWrappers>(exec);
+
+  auto get_node_base_interface = [](const std::shared_ptr<void> & node) {
+      return std::static_pointer_cast<rclcpp::Node>(node)->get_node_base_interface();
+    };
+  // The lifecycle component moves to the state whose id is the transition id
+  std::atomic_int transitions {0};
+  manager->node_wrappers_[1] = NodeInstanceWrapper(
+    std::make_shared<rclcpp::Node>("test_lifecycle_component"), get_node_base_interface,
+    [&transitions](const std::shared_ptr<void> &, uint8_t transition_id) {
+      transitions++;
+      NodeInstanceWrapper::TransitionOutcome outcome;
+      outcome.success = true;
+      outcome.state_id = transition_id;
+      return outcome;
+    });
+  manager->node_wrappers_[2] = NodeInstanceWrapper(
+    std::make_shared<rclcpp::Node>("test_component"), get_node_base_interface);
+  EXPECT_TRUE(manager->node_wrappers_[1].is_lifecycle_node());
+  EXPECT_FALSE(manager->node_wrappers_[2].is_lifecycle_node());
+
+  // All the lifecycle components
+  auto results = manager->transition_components(3);
+  ASSERT_EQ(1u, results.size());
+  EXPECT_EQ(1u, results[0].unique_id);
+  EXPECT_EQ("/test_lifecycle_component", results[0].full_node_name);
+  EXPECT_TRUE(results[0].success);
+  EXPECT_EQ(3u, results[0].state_id);
+  EXPECT_TRUE(results[0].error_message.empty());
+
+  // A subset, with components which can't be transitioned
+  results = manager->transition_components(4, {2, 1, 5}, 2);
+  ASSERT_EQ(3u, results.size());
+  EXPECT_EQ("/test_component", results[0].full_node_name);
+  EXPECT_FALSE(results[0].success);
+  EXPECT_FALSE(results[0].error_message.empty());
+  EXPECT_TRUE(results[1].success);
+  EXPECT_EQ(4u, results[1].state_id);
+  EXPECT_EQ(5u, results[2].unique_id);
+  EXPECT_TRUE(results[2].full_node_name.empty());
+  EXPECT_FALSE(results[2].error_message.empty());
+  EXPECT_EQ(2, transitions);
+
+  // The components weren't added to the executor, don't remove them from it
+  manager->node_wrappers_.clear();
+}
@@ -15,7 +15,9 @@
 #include <gtest/gtest.h>
 
 #include <memory>
+#include <set>
 #include <string>
+#include <vector>
 
 #include "composition_interfaces/srv/load_node.hpp"
 #include "composition_interfaces/srv/unload_node.hpp"
@@ -37,15 +39,17 @@ protected:
 
 // TODO(hidmic): split up tests once Node bring up/tear down races
 //               are solved https://github.com/ros2/rclcpp/issues/863
-void test_components_api(bool use_dedicated_executor)
+template<typename ExecutorT = rclcpp::executors::SingleThreadedExecutor>
+void test_components_api(bool use_dedicated_executor, size_t executor_pool_size = 0)
 {
-  auto exec = std::make_shared<rclcpp::executors::SingleThreadedExecutor>();
+  auto exec = std::make_shared<ExecutorT>();
   auto node = rclcpp::Node::make_shared("test_component_manager");
   std::shared_ptr<rclcpp_components::ComponentManager> manager;
   if (use_dedicated_executor) {
-    using ComponentManagerIsolated =
-      rclcpp_components::ComponentManagerIsolated<rclcpp::executors::SingleThreadedExecutor>;
-    manager = std::make_shared<ComponentManagerIsolated>(exec);
+    using ComponentManagerIsolated = rclcpp_components::ComponentManagerIsolated<ExecutorT>;
+    auto isolated_manager = std::make_shared<ComponentManagerIsolated>(exec);
+    isolated_manager->set_executor_pool_size(executor_pool_size);
+    manager = isolated_manager;
   } else {
     manager = std::make_shared<rclcpp_components::ComponentManager>(exec);
   }
@@ -387,4 +391,116 @@ TEST_F(TestComponentManager, components_api)
     SCOPED_TRACE("ComponentManagerIsolated");
     test_components_api(true);
   }
+  {
+    SCOPED_TRACE("ComponentManagerIsolated with an executor pool");
+    test_components_api(true, 2);
+  }
+  {
+    SCOPED_TRACE("ComponentManager with EventsExecutor");
+    test_components_api<rclcpp::experimental::executors::EventsExecutor>(false);
+  }
+  {
+    SCOPED_TRACE("ComponentManagerIsolated with EventsExecutor");
+    test_components_api<rclcpp::experimental::executors::EventsExecutor>(true);
+  }
+}
+
+TEST_F(TestComponentManager, components_api_load_threads)
+{
+  auto exec = std::make_shared<rclcpp::executors::SingleThreadedExecutor>();
+  auto node = rclcpp::Node::make_shared("test_component_manager");
+  auto manager = std::make_shared<rclcpp_components::ComponentManager>(
+    exec, "ComponentManager",
+    rclcpp::NodeOptions()
+    .start_parameter_services(false)
+    .start_parameter_event_publisher(false)
+    .parameter_overrides({{"load_threads", 2}}));
+
+  exec->add_node(manager);
+  exec->add_node(node);
+
+  auto composition_client = node->create_client<composition_interfaces::srv::LoadNode>(
+    "/ComponentManager/_container/load_node");
+
+  if (!composition_client->wait_for_service(20s)) {
+    ASSERT_TRUE(false) << "service not available after waiting";
+  }
+
+  // The requests are sent at once, the components are constructed concurrently
+  const size_t component_count = 4;
+  std::vector<rclcpp::Client<composition_interfaces::srv::LoadNode>::SharedFuture> futures;
+  for (size_t i = 0; i < component_count; ++i) {
+    auto request = std::make_shared<composition_interfaces::srv::LoadNode::Request>();
+    request->package_name = "rclcpp_components";
+    request->plugin_name = "test_rclcpp_components::TestComponentFoo";
+    request->node_name = "test_component_" + std::to_string(i);
+    futures.push_back(composition_client->async_send_request(request).future.share());
+  }
+
+  std::set<uint64_t> unique_ids;
+  std::set<std::string> node_names;
+  for (auto & future : futures) {
+    auto ret = exec->spin_until_future_complete(future, 5s);  // Wait for the result.
+    ASSERT_EQ(ret, rclcpp::FutureReturnCode::SUCCESS);
+    auto result = future.get();
+    EXPECT_EQ(result->success, true);
+    EXPECT_EQ(result->error_message, "");
+    unique_ids.insert(result->unique_id);
+    node_names.insert(result->full_node_name);
+  }
+  EXPECT_EQ(unique_ids, std::set<uint64_t>({1u, 2u, 3u, 4u}));
+  const std::set<std::string> expected_node_names = {
+    "/test_component_0", "/test_component_1", "/test_component_2", "/test_component_3"};
+  EXPECT_EQ(node_names, expected_node_names);
+
+  auto list_client = node->create_client<composition_interfaces::srv::ListNodes>(
+    "/ComponentManager/_container/list_nodes");
+  ASSERT_TRUE(list_client->wait_for_service(20s));
+  auto future = list_client->async_send_request(
+    std::make_shared<composition_interfaces::srv::ListNodes::Request>());
+  ASSERT_EQ(exec->spin_until_future_complete(future, 5s), rclcpp::FutureReturnCode::SUCCESS);
+  EXPECT_EQ(future.get()->unique_ids.size(), component_count);
+}
+
+TEST_F(TestComponentManager, load_profiles)
+{
+  auto exec = std::make_shared<rclcpp::executors::SingleThreadedExecutor>();
+  auto node = rclcpp::Node::make_shared("test_component_manager");
+  auto manager = std::make_shared<rclcpp_components::ComponentManager>(exec);
+  exec->add_node(manager);
+  exec->add_node(node);
+
+  auto load_client = node->create_client<composition_interfaces::srv::LoadNode>(
+    "/ComponentManager/_container/load_node");
+  ASSERT_TRUE(load_client->wait_for_service(20s));
+  auto request = std::make_shared<composition_interfaces::srv::LoadNode::Request>();
+  request->package_name = "rclcpp_components";
+  request->plugin_name = "test_rclcpp_components::TestComponentFoo";
+  auto load_future = load_client->async_send_request(request);
+  ASSERT_EQ(
+    exec->spin_until_future_complete(load_future, 5s), rclcpp::FutureReturnCode::SUCCESS);
+  auto load_result = load_future.get();
+  ASSERT_TRUE(load_result->success);
+
+  auto profiles = manager->get_load_profiles();
+  ASSERT_EQ(1u, profiles.size());
+  EXPECT_EQ(load_result->unique_id, profiles[0].unique_id);
+  EXPECT_EQ("/test_component_foo", profiles[0].full_node_name);
+  EXPECT_EQ(request->plugin_name, profiles[0].plugin_name);
+  EXPECT_GT(profiles[0].node_construction, 0ns);
+  EXPECT_GE(profiles[0].resource_lookup, 0ns);
+  EXPECT_GE(profiles[0].factory_creation, 0ns);
+  EXPECT_GE(profiles[0].executor_add, 0ns);
+
+  // The profile is removed with the component
+  auto unload_client = node->create_client<composition_interfaces::srv::UnloadNode>(
+    "/ComponentManager/_container/unload_node");
+  ASSERT_TRUE(unload_client->wait_for_service(20s));
+  auto unload_request = std::make_shared<composition_interfaces::srv::UnloadNode::Request>();
+  unload_request->unique_id = load_result->unique_id;
+  auto unload_future = unload_client->async_send_request(unload_request);
+  ASSERT_EQ(
+    exec->spin_until_future_complete(unload_future, 5s), rclcpp::FutureReturnCode::SUCCESS);
+  EXPECT_TRUE(unload_future.get()->success);
+  EXPECT_TRUE(manager->get_load_profiles().empty());
 }
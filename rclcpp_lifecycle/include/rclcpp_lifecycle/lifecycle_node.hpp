@@ -128,6 +128,19 @@ class LifecycleNode : public node_interfaces::LifecycleNodeInterface,
 public:
   RCLCPP_SMART_PTR_DEFINITIONS(LifecycleNode)
 
+  /// Function completing an asynchronous transition with the result of its callback.
+  using TransitionCompletion = std::function<void (LifecycleNodeInterface::CallbackReturn)>;
+
+  /// Asynchronous transition callback, taking the previous state and the transition completion.
+  /**
+   * The callback may return before the work of the transition is done, e.g. to load a model
+   * in another thread, and the transition completes when the completion is called, from any
+   * thread. The node is in the transition state meanwhile, and other transitions fail.
+   * The completion must be called once, while the node exists; if the callback throws
+   * before calling it, the transition completes with an error.
+   */
+  using AsyncTransitionCallback = std::function<void (const State &, TransitionCompletion)>;
+
   /// Create a new lifecycle node with the specified name.
   /**
    * \param[in] node_name Name of the node.
@@ -204,6 +217,27 @@ public:
     rclcpp::CallbackGroupType group_type,
     bool automatically_add_to_executor_with_node = true);
 
+  /// Create and return a callback group only enabled while the node is active.
+  /**
+   * The subscriptions, timers and other entities of the group are left out of the wait
+   * sets of the executors while the node isn't active, so an inactive node doesn't take,
+   * deserialize or handle messages.
+   * The group is enabled on activation and disabled on deactivation, by the default
+   * on_activate() and on_deactivate() callbacks, as the lifecycle publishers.
+   *
+   * \sa rclcpp::CallbackGroup::set_enabled()
+   * \param[in] group_type callback group type to create by this method.
+   * \param[in] automatically_add_to_executor_with_node A boolean that
+   *   determines whether a callback group is automatically added to an executor
+   *   with the node with which it is associated.
+   * \return a callback group, enabled if the node is currently active
+   */
+  RCLCPP_LIFECYCLE_PUBLIC
+  rclcpp::CallbackGroup::SharedPtr
+  create_managed_callback_group(
+    rclcpp::CallbackGroupType group_type,
+    bool automatically_add_to_executor_with_node = true);
+
   /// Iterate over the callback groups in the node, calling func on each valid one.
   RCLCPP_LIFECYCLE_PUBLIC
   void
@@ -298,6 +332,8 @@ public:
    * \param[in] service_name The name on which the service is accessible.
    * \param[in] qos Quality of service profile for client.
    * \param[in] group Callback group to handle the reply to service calls.
+   * \param[in] pool_size Number of response objects reused by the client,
+   *   zero to allocate them for every response.
    * \return Shared pointer to the created client.
    */
   template<typename ServiceT>
@@ -305,7 +341,8 @@ public:
   create_client(
     const std::string & service_name,
     const rclcpp::QoS & qos = rclcpp::ServicesQoS(),
-    rclcpp::CallbackGroup::SharedPtr group = nullptr);
+    rclcpp::CallbackGroup::SharedPtr group = nullptr,
+    size_t pool_size = 0);
 
   /// Create and return a Service.
   /**
@@ -331,7 +368,8 @@ public:
     const std::string & service_name,
     CallbackT && callback,
     const rclcpp::QoS & qos = rclcpp::ServicesQoS(),
-    rclcpp::CallbackGroup::SharedPtr group = nullptr);
+    rclcpp::CallbackGroup::SharedPtr group = nullptr,
+    size_t pool_size = 0);
 
   /// Create and return a GenericPublisher.
   /**
@@ -362,6 +400,22 @@ public:
     )
   );
 
+  /// Create and return a GenericSubscription delivering views of the serialized messages.
+  /**
+   * \sa rclcpp::Node::create_generic_subscription
+   */
+  template<typename AllocatorT = std::allocator<void>>
+  std::shared_ptr<rclcpp::GenericSubscription> create_generic_subscription(
+    const std::string & topic_name,
+    const std::string & topic_type,
+    const rclcpp::QoS & qos,
+    std::function<void(
+      const rclcpp::SerializedMessageView &, const rclcpp::MessageInfo &)> view_callback,
+    const rclcpp::SubscriptionOptionsWithAllocator<AllocatorT> & options = (
+      rclcpp::SubscriptionOptionsWithAllocator<AllocatorT>()
+    )
+  );
+
   /// Declare and initialize a parameter, return the effective value.
   /**
    * \sa rclcpp::Node::declare_parameter
@@ -513,6 +567,14 @@ public:
     ParameterT & value,
     const ParameterT & alternative_value) const;
 
+  /// Return a handle to read the value of a declared parameter without locking.
+  /**
+   * \sa rclcpp::Node::get_parameter_handle
+   */
+  RCLCPP_LIFECYCLE_PUBLIC
+  rclcpp::node_interfaces::ParameterHandle::SharedPtr
+  get_parameter_handle(const std::string & name);
+
   /// Return the parameters by the given parameter names.
   /**
    * \sa rclcpp::Node::get_parameters
@@ -899,6 +961,21 @@ public:
   std::vector<Transition>
   get_transition_graph() const;
 
+  /// Create the lifecycle services and the transition event publisher, if not created yet.
+  /**
+   * A node created without its communication interface, such as one of the many components
+   * of a container, can create it on demand, once it's managed remotely.
+   * The services and the topic have the same names as when created with the node.
+   */
+  RCLCPP_LIFECYCLE_PUBLIC
+  void
+  enable_communication_interface();
+
+  /// Return true if the lifecycle services and the transition event publisher exist.
+  RCLCPP_LIFECYCLE_PUBLIC
+  bool
+  is_communication_interface_enabled() const;
+
   /// Trigger the specified transition.
   /*
    * \return the new state after this transition
@@ -1081,6 +1158,74 @@ public:
   bool
   register_on_error(std::function<LifecycleNodeInterface::CallbackReturn(const State &)> fcn);
 
+  /// Register an asynchronous configure callback, replacing the configure callback
+  /**
+   * The response of the change state service is sent once the transition completes, so the
+   * executor isn't blocked by the transition.
+   * The synchronous trigger_transition() functions return the transition state while the
+   * transition is in progress.
+   *
+   * \param[in] fcn callback function to call
+   * \return always true
+   */
+  RCLCPP_LIFECYCLE_PUBLIC
+  bool
+  register_async_on_configure(AsyncTransitionCallback fcn);
+
+  /// Register an asynchronous cleanup callback, replacing the cleanup callback
+  /**
+   * \sa register_async_on_configure()
+   * \param[in] fcn callback function to call
+   * \return always true
+   */
+  RCLCPP_LIFECYCLE_PUBLIC
+  bool
+  register_async_on_cleanup(AsyncTransitionCallback fcn);
+
+  /// Register an asynchronous shutdown callback, replacing the shutdown callback
+  /**
+   * \sa register_async_on_configure()
+   * \param[in] fcn callback function to call
+   * \return always true
+   */
+  RCLCPP_LIFECYCLE_PUBLIC
+  bool
+  register_async_on_shutdown(AsyncTransitionCallback fcn);
+
+  /// Register an asynchronous activate callback, replacing the activate callback
+  /**
+   * The managed entities are activated by on_activate(), which the callback should call.
+   *
+   * \sa register_async_on_configure()
+   * \param[in] fcn callback function to call
+   * \return always true
+   */
+  RCLCPP_LIFECYCLE_PUBLIC
+  bool
+  register_async_on_activate(AsyncTransitionCallback fcn);
+
+  /// Register an asynchronous deactivate callback, replacing the deactivate callback
+  /**
+   * The managed entities are deactivated by on_deactivate(), which the callback should call.
+   *
+   * \sa register_async_on_configure()
+   * \param[in] fcn callback function to call
+   * \return always true
+   */
+  RCLCPP_LIFECYCLE_PUBLIC
+  bool
+  register_async_on_deactivate(AsyncTransitionCallback fcn);
+
+  /// Register an asynchronous error callback, replacing the error callback
+  /**
+   * \sa register_async_on_configure()
+   * \param[in] fcn callback function to call
+   * \return always true
+   */
+  RCLCPP_LIFECYCLE_PUBLIC
+  bool
+  register_async_on_error(AsyncTransitionCallback fcn);
+
   RCLCPP_LIFECYCLE_PUBLIC
   CallbackReturn
   on_activate(const State & previous_state) override;
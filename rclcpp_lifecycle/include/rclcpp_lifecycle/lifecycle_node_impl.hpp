@@ -137,11 +137,12 @@ typename rclcpp::Client<ServiceT>::SharedPtr
 LifecycleNode::create_client(
   const std::string & service_name,
   const rclcpp::QoS & qos,
-  rclcpp::CallbackGroup::SharedPtr group)
+  rclcpp::CallbackGroup::SharedPtr group,
+  size_t pool_size)
 {
   return rclcpp::create_client<ServiceT>(
     node_base_, node_graph_, node_services_,
-    service_name, qos, group);
+    service_name, qos, group, pool_size);
 }
 
 template<typename ServiceT, typename CallbackT>
@@ -163,11 +164,12 @@ LifecycleNode::create_service(
   const std::string & service_name,
   CallbackT && callback,
   const rclcpp::QoS & qos,
-  rclcpp::CallbackGroup::SharedPtr group)
+  rclcpp::CallbackGroup::SharedPtr group,
+  size_t pool_size)
 {
   return rclcpp::create_service<ServiceT, CallbackT>(
     node_base_, node_services_,
-    service_name, std::forward<CallbackT>(callback), qos, group);
+    service_name, std::forward<CallbackT>(callback), qos, group, pool_size);
 }
 
 template<typename AllocatorT>
@@ -210,6 +212,28 @@ LifecycleNode::create_generic_subscription(
   );
 }
 
+template<typename AllocatorT>
+std::shared_ptr<rclcpp::GenericSubscription>
+LifecycleNode::create_generic_subscription(
+  const std::string & topic_name,
+  const std::string & topic_type,
+  const rclcpp::QoS & qos,
+  std::function<void(
+    const rclcpp::SerializedMessageView &, const rclcpp::MessageInfo &)> view_callback,
+  const rclcpp::SubscriptionOptionsWithAllocator<AllocatorT> & options)
+{
+  return rclcpp::create_generic_subscription(
+    node_topics_,
+    // TODO(karsten1987): LifecycleNode is currently not supporting subnamespaces
+    // see https://github.com/ros2/rclcpp/issues/1614
+    topic_name,
+    topic_type,
+    qos,
+    std::move(view_callback),
+    options
+  );
+}
+
 template<typename ParameterT>
 auto
 LifecycleNode::declare_parameter(
@@ -15,6 +15,7 @@
 #ifndef RCLCPP_LIFECYCLE__LIFECYCLE_PUBLISHER_HPP_
 #define RCLCPP_LIFECYCLE__LIFECYCLE_PUBLISHER_HPP_
 
+#include <atomic>
 #include <memory>
 #include <string>
 #include <utility>
@@ -59,6 +60,25 @@ public:
 
   ~LifecyclePublisher() {}
 
+  /// Check whether a message published now would be published.
+  /**
+   * Messages published while the publisher is not activated are dropped, so this can be
+   * checked before building an expensive message, e.g.:
+   *
+   * ```cpp
+   * if (publisher->can_publish()) {
+   *   publisher->publish(build_point_cloud());
+   * }
+   * ```
+   *
+   * \return true if the publisher is activated
+   */
+  bool
+  can_publish() const
+  {
+    return this->is_activated();
+  }
+
   /// LifecyclePublisher publish function
   /**
    * The publish function checks whether the communication
@@ -113,7 +133,7 @@ public:
   on_activate() override
   {
     SimpleManagedEntity::on_activate();
-    should_log_ = true;
+    should_log_.store(true, std::memory_order_relaxed);
   }
 
 private:
@@ -124,8 +144,9 @@ private:
    */
   void log_publisher_not_enabled()
   {
-    // Nothing to do if we are not meant to log
-    if (!should_log_) {
+    // Nothing to do if we are not meant to log, and we stop logging until the flag gets
+    // enabled again
+    if (!should_log_.exchange(false, std::memory_order_relaxed)) {
       return;
     }
 
@@ -134,12 +155,10 @@ private:
       logger_,
       "Trying to publish message on the topic '%s', but the publisher is not activated",
       this->get_topic_name());
-
-    // We stop logging until the flag gets enabled again
-    should_log_ = false;
   }
 
-  bool should_log_ = true;
+  // Atomic, publish() may be called from several threads
+  std::atomic<bool> should_log_ = true;
   rclcpp::Logger logger_;
 };
 
@@ -56,9 +56,16 @@ public:
   void
   on_deactivate() override;
 
+  /// Check whether the entity is activated, with a relaxed atomic read.
+  /**
+   * It's inlined, being checked by every publish() of the lifecycle publishers.
+   */
   RCLCPP_LIFECYCLE_PUBLIC
   bool
-  is_activated() const;
+  is_activated() const
+  {
+    return activated_.load(std::memory_order_relaxed);
+  }
 
 private:
   std::atomic<bool> activated_ = false;
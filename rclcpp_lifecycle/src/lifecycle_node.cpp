@@ -25,11 +25,13 @@
 
 #include "lifecycle_msgs/msg/state.hpp"
 #include "lifecycle_msgs/msg/transition.hpp"
+#include "lifecycle_msgs/msg/transition_event.hpp"
 
 #include "rcl_interfaces/msg/list_parameters_result.hpp"
 #include "rcl_interfaces/msg/parameter_descriptor.hpp"
 #include "rcl_interfaces/msg/set_parameters_result.hpp"
 
+#include "rclcpp/create_publisher.hpp"
 #include "rclcpp/exceptions.hpp"
 #include "rclcpp/graph_listener.hpp"
 #include "rclcpp/logger.hpp"
@@ -79,7 +81,8 @@ LifecycleNode::LifecycleNode(
   node_graph_(new rclcpp::node_interfaces::NodeGraph(node_base_.get())),
   node_logging_(new rclcpp::node_interfaces::NodeLogging(node_base_)),
   node_timers_(new rclcpp::node_interfaces::NodeTimers(node_base_.get())),
-  node_topics_(new rclcpp::node_interfaces::NodeTopics(node_base_.get(), node_timers_.get())),
+  node_topics_(new rclcpp::node_interfaces::NodeTopics(
+      node_base_.get(), node_timers_.get(), options.aggregate_event_handlers())),
   node_services_(new rclcpp::node_interfaces::NodeServices(node_base_.get())),
   node_clock_(new rclcpp::node_interfaces::NodeClock(
       node_base_,
@@ -101,7 +104,9 @@ LifecycleNode::LifecycleNode(
       options.parameter_event_qos(),
       options.parameter_event_publisher_options(),
       options.allow_undeclared_parameters(),
-      options.automatically_declare_parameters_from_overrides()
+      options.automatically_declare_parameters_from_overrides(),
+      node_timers_,
+      options.parameter_event_coalescing_period()
     )),
   node_time_source_(new rclcpp::node_interfaces::NodeTimeSource(
       node_base_,
@@ -112,13 +117,16 @@ LifecycleNode::LifecycleNode(
       node_clock_,
       node_parameters_,
       options.clock_qos(),
-      options.use_clock_thread()
+      options.use_clock_thread(),
+      options.use_shared_clock_subscription()
     )),
   node_type_descriptions_(new rclcpp::node_interfaces::NodeTypeDescriptions(
       node_base_,
       node_logging_,
       node_parameters_,
-      node_services_
+      node_services_,
+      options.start_type_description_service(),
+      options.share_type_description_service()
     )),
   node_waitables_(new rclcpp::node_interfaces::NodeWaitables(node_base_.get())),
   node_options_(options),
@@ -196,6 +204,19 @@ LifecycleNode::create_callback_group(
   return node_base_->create_callback_group(group_type, automatically_add_to_executor_with_node);
 }
 
+rclcpp::CallbackGroup::SharedPtr
+LifecycleNode::create_managed_callback_group(
+  rclcpp::CallbackGroupType group_type,
+  bool automatically_add_to_executor_with_node)
+{
+  auto group = node_base_->create_callback_group(
+    group_type, automatically_add_to_executor_with_node);
+  group->set_enabled(
+    get_current_state().id() == lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE);
+  impl_->add_managed_callback_group(group);
+  return group;
+}
+
 const rclcpp::ParameterValue &
 LifecycleNode::declare_parameter(
   const std::string & name,
@@ -253,6 +274,12 @@ LifecycleNode::set_parameters_atomically(
   return node_parameters_->set_parameters_atomically(parameters);
 }
 
+rclcpp::node_interfaces::ParameterHandle::SharedPtr
+LifecycleNode::get_parameter_handle(const std::string & name)
+{
+  return node_parameters_->get_parameter_handle(name);
+}
+
 std::vector<rclcpp::Parameter>
 LifecycleNode::get_parameters(
   const std::vector<std::string> & names) const
@@ -570,6 +597,48 @@ LifecycleNode::register_on_error(
     lifecycle_msgs::msg::State::TRANSITION_STATE_ERRORPROCESSING, fcn);
 }
 
+bool
+LifecycleNode::register_async_on_configure(AsyncTransitionCallback fcn)
+{
+  return impl_->register_async_callback(
+    lifecycle_msgs::msg::State::TRANSITION_STATE_CONFIGURING, fcn);
+}
+
+bool
+LifecycleNode::register_async_on_cleanup(AsyncTransitionCallback fcn)
+{
+  return impl_->register_async_callback(
+    lifecycle_msgs::msg::State::TRANSITION_STATE_CLEANINGUP, fcn);
+}
+
+bool
+LifecycleNode::register_async_on_shutdown(AsyncTransitionCallback fcn)
+{
+  return impl_->register_async_callback(
+    lifecycle_msgs::msg::State::TRANSITION_STATE_SHUTTINGDOWN, fcn);
+}
+
+bool
+LifecycleNode::register_async_on_activate(AsyncTransitionCallback fcn)
+{
+  return impl_->register_async_callback(
+    lifecycle_msgs::msg::State::TRANSITION_STATE_ACTIVATING, fcn);
+}
+
+bool
+LifecycleNode::register_async_on_deactivate(AsyncTransitionCallback fcn)
+{
+  return impl_->register_async_callback(
+    lifecycle_msgs::msg::State::TRANSITION_STATE_DEACTIVATING, fcn);
+}
+
+bool
+LifecycleNode::register_async_on_error(AsyncTransitionCallback fcn)
+{
+  return impl_->register_async_callback(
+    lifecycle_msgs::msg::State::TRANSITION_STATE_ERRORPROCESSING, fcn);
+}
+
 const State &
 LifecycleNode::get_current_state() const
 {
@@ -594,6 +663,24 @@ LifecycleNode::get_transition_graph() const
   return impl_->get_transition_graph();
 }
 
+void
+LifecycleNode::enable_communication_interface()
+{
+  if (impl_->is_communication_interface_enabled()) {
+    return;
+  }
+  // The default QoS of the publisher created by rcl
+  impl_->enable_communication_interface(
+    rclcpp::create_publisher<lifecycle_msgs::msg::TransitionEvent>(
+      node_parameters_, node_topics_, "~/transition_event", rclcpp::QoS(10)));
+}
+
+bool
+LifecycleNode::is_communication_interface_enabled() const
+{
+  return impl_->is_communication_interface_enabled();
+}
+
 const State &
 LifecycleNode::trigger_transition(const Transition & transition)
 {
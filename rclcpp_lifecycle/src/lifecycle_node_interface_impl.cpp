@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <atomic>
 #include <functional>
 #include <memory>
 #include <mutex>
@@ -49,6 +50,23 @@
 namespace rclcpp_lifecycle
 {
 
+namespace
+{
+
+const char *
+get_label_for_return_code(node_interfaces::LifecycleNodeInterface::CallbackReturn cb_return_code)
+{
+  auto cb_id = static_cast<uint8_t>(cb_return_code);
+  if (cb_id == lifecycle_msgs::msg::Transition::TRANSITION_CALLBACK_SUCCESS) {
+    return rcl_lifecycle_transition_success_label;
+  } else if (cb_id == lifecycle_msgs::msg::Transition::TRANSITION_CALLBACK_FAILURE) {
+    return rcl_lifecycle_transition_failure_label;
+  }
+  return rcl_lifecycle_transition_error_label;
+}
+
+}  // namespace
+
 LifecycleNode::LifecycleNodeInterfaceImpl::LifecycleNodeInterfaceImpl(
   std::shared_ptr<rclcpp::node_interfaces::NodeBaseInterface> node_base_interface,
   std::shared_ptr<rclcpp::node_interfaces::NodeServicesInterface> node_services_interface,
@@ -111,88 +129,106 @@ LifecycleNode::LifecycleNodeInterfaceImpl::init(bool enable_communication_interf
   current_state_ = State(state_machine_.current_state);
 
   if (enable_communication_interface) {
-    { // change_state
-      auto cb = std::bind(
-        &LifecycleNode::LifecycleNodeInterfaceImpl::on_change_state, this,
-        std::placeholders::_1, std::placeholders::_2, std::placeholders::_3);
-      rclcpp::AnyServiceCallback<ChangeStateSrv> any_cb;
-      any_cb.set(std::move(cb));
-
-      srv_change_state_ = std::make_shared<rclcpp::Service<ChangeStateSrv>>(
-        node_base_interface_->get_shared_rcl_node_handle(),
-        &state_machine_.com_interface.srv_change_state,
-        any_cb);
-      node_services_interface_->add_service(
-        std::dynamic_pointer_cast<rclcpp::ServiceBase>(srv_change_state_),
-        nullptr);
-    }
+    create_services(true);
+    communication_interface_enabled_ = true;
+  }
+}
 
-    { // get_state
-      auto cb = std::bind(
-        &LifecycleNode::LifecycleNodeInterfaceImpl::on_get_state, this,
-        std::placeholders::_1, std::placeholders::_2, std::placeholders::_3);
-      rclcpp::AnyServiceCallback<GetStateSrv> any_cb;
-      any_cb.set(std::move(cb));
-
-      srv_get_state_ = std::make_shared<rclcpp::Service<GetStateSrv>>(
-        node_base_interface_->get_shared_rcl_node_handle(),
-        &state_machine_.com_interface.srv_get_state,
-        any_cb);
-      node_services_interface_->add_service(
-        std::dynamic_pointer_cast<rclcpp::ServiceBase>(srv_get_state_),
-        nullptr);
-    }
+bool
+LifecycleNode::LifecycleNodeInterfaceImpl::is_communication_interface_enabled() const
+{
+  std::lock_guard<std::recursive_mutex> lock(state_machine_mutex_);
+  return communication_interface_enabled_;
+}
 
-    { // get_available_states
-      auto cb = std::bind(
-        &LifecycleNode::LifecycleNodeInterfaceImpl::on_get_available_states, this,
-        std::placeholders::_1, std::placeholders::_2, std::placeholders::_3);
-      rclcpp::AnyServiceCallback<GetAvailableStatesSrv> any_cb;
-      any_cb.set(std::move(cb));
-
-      srv_get_available_states_ = std::make_shared<rclcpp::Service<GetAvailableStatesSrv>>(
-        node_base_interface_->get_shared_rcl_node_handle(),
-        &state_machine_.com_interface.srv_get_available_states,
-        any_cb);
-      node_services_interface_->add_service(
-        std::dynamic_pointer_cast<rclcpp::ServiceBase>(srv_get_available_states_),
-        nullptr);
-    }
+void
+LifecycleNode::LifecycleNodeInterfaceImpl::enable_communication_interface(
+  rclcpp::Publisher<TransitionEventMsg>::SharedPtr pub_transition_event)
+{
+  std::lock_guard<std::recursive_mutex> lock(state_machine_mutex_);
+  if (communication_interface_enabled_) {
+    return;
+  }
+  // rcl only creates its communication interface with the state machine, so rclcpp
+  // creates the services and publisher with the same names instead
+  create_services(false);
+  pub_transition_event_ = std::move(pub_transition_event);
+  communication_interface_enabled_ = true;
+}
 
-    { // get_available_transitions
-      auto cb = std::bind(
-        &LifecycleNode::LifecycleNodeInterfaceImpl::on_get_available_transitions, this,
-        std::placeholders::_1, std::placeholders::_2, std::placeholders::_3);
-      rclcpp::AnyServiceCallback<GetAvailableTransitionsSrv> any_cb;
-      any_cb.set(std::move(cb));
-
-      srv_get_available_transitions_ =
-        std::make_shared<rclcpp::Service<GetAvailableTransitionsSrv>>(
-        node_base_interface_->get_shared_rcl_node_handle(),
-        &state_machine_.com_interface.srv_get_available_transitions,
-        any_cb);
-      node_services_interface_->add_service(
-        std::dynamic_pointer_cast<rclcpp::ServiceBase>(srv_get_available_transitions_),
-        nullptr);
-    }
+template<typename ServiceT, typename CallbackT>
+std::shared_ptr<rclcpp::Service<ServiceT>>
+LifecycleNode::LifecycleNodeInterfaceImpl::add_service(
+  rcl_service_t * service_handle, const char * service_name, CallbackT && callback)
+{
+  rclcpp::AnyServiceCallback<ServiceT> any_cb;
+  any_cb.set(std::forward<CallbackT>(callback));
+
+  std::shared_ptr<rclcpp::Service<ServiceT>> service;
+  if (service_handle) {
+    service = std::make_shared<rclcpp::Service<ServiceT>>(
+      node_base_interface_->get_shared_rcl_node_handle(), service_handle, any_cb);
+  } else {
+    rcl_service_options_t service_options = rcl_service_get_default_options();
+    service = std::make_shared<rclcpp::Service<ServiceT>>(
+      node_base_interface_->get_shared_rcl_node_handle(),
+      std::string("~/") + service_name, any_cb, service_options);
+  }
+  node_services_interface_->add_service(
+    std::dynamic_pointer_cast<rclcpp::ServiceBase>(service), nullptr);
+  return service;
+}
 
-    { // get_transition_graph
-      auto cb = std::bind(
-        &LifecycleNode::LifecycleNodeInterfaceImpl::on_get_transition_graph, this,
-        std::placeholders::_1, std::placeholders::_2, std::placeholders::_3);
-      rclcpp::AnyServiceCallback<GetAvailableTransitionsSrv> any_cb;
-      any_cb.set(std::move(cb));
-
-      srv_get_transition_graph_ =
-        std::make_shared<rclcpp::Service<GetAvailableTransitionsSrv>>(
-        node_base_interface_->get_shared_rcl_node_handle(),
-        &state_machine_.com_interface.srv_get_transition_graph,
-        any_cb);
-      node_services_interface_->add_service(
-        std::dynamic_pointer_cast<rclcpp::ServiceBase>(srv_get_transition_graph_),
-        nullptr);
-    }
+void
+LifecycleNode::LifecycleNodeInterfaceImpl::create_services(bool use_rcl_services)
+{
+  using std::placeholders::_1;
+  using std::placeholders::_2;
+  using std::placeholders::_3;
+  rcl_lifecycle_com_interface_t & com_interface = state_machine_.com_interface;
+
+  // The response is deferred until the transition completes
+  srv_change_state_ = add_service<ChangeStateSrv>(
+    use_rcl_services ? &com_interface.srv_change_state : nullptr, "change_state",
+    std::bind(&LifecycleNode::LifecycleNodeInterfaceImpl::on_change_state, this, _1, _2));
+
+  srv_get_state_ = add_service<GetStateSrv>(
+    use_rcl_services ? &com_interface.srv_get_state : nullptr, "get_state",
+    std::bind(&LifecycleNode::LifecycleNodeInterfaceImpl::on_get_state, this, _1, _2, _3));
+
+  srv_get_available_states_ = add_service<GetAvailableStatesSrv>(
+    use_rcl_services ? &com_interface.srv_get_available_states : nullptr,
+    "get_available_states",
+    std::bind(
+      &LifecycleNode::LifecycleNodeInterfaceImpl::on_get_available_states, this, _1, _2, _3));
+
+  srv_get_available_transitions_ = add_service<GetAvailableTransitionsSrv>(
+    use_rcl_services ? &com_interface.srv_get_available_transitions : nullptr,
+    "get_available_transitions",
+    std::bind(
+      &LifecycleNode::LifecycleNodeInterfaceImpl::on_get_available_transitions, this,
+      _1, _2, _3));
+
+  srv_get_transition_graph_ = add_service<GetAvailableTransitionsSrv>(
+    use_rcl_services ? &com_interface.srv_get_transition_graph : nullptr,
+    "get_transition_graph",
+    std::bind(
+      &LifecycleNode::LifecycleNodeInterfaceImpl::on_get_transition_graph, this, _1, _2, _3));
+}
+
+void
+LifecycleNode::LifecycleNodeInterfaceImpl::publish_transition_event(
+  const rcl_lifecycle_state_t * start_state) const
+{
+  if (!pub_transition_event_) {
+    return;
   }
+  TransitionEventMsg msg;
+  msg.start_state.id = static_cast<uint8_t>(start_state->id);
+  msg.start_state.label = start_state->label;
+  msg.goal_state.id = static_cast<uint8_t>(state_machine_.current_state->id);
+  msg.goal_state.label = state_machine_.current_state->label;
+  pub_transition_event_->publish(msg);
 }
 
 bool
@@ -200,17 +236,26 @@ LifecycleNode::LifecycleNodeInterfaceImpl::register_callback(
   std::uint8_t lifecycle_transition,
   std::function<node_interfaces::LifecycleNodeInterface::CallbackReturn(const State &)> & cb)
 {
+  async_cb_map_.erase(lifecycle_transition);
   cb_map_[lifecycle_transition] = cb;
   return true;
 }
 
+bool
+LifecycleNode::LifecycleNodeInterfaceImpl::register_async_callback(
+  std::uint8_t lifecycle_transition,
+  LifecycleNode::AsyncTransitionCallback & cb)
+{
+  cb_map_.erase(lifecycle_transition);
+  async_cb_map_[lifecycle_transition] = cb;
+  return true;
+}
+
 void
 LifecycleNode::LifecycleNodeInterfaceImpl::on_change_state(
   const std::shared_ptr<rmw_request_id_t> header,
-  const std::shared_ptr<ChangeStateSrv::Request> req,
-  std::shared_ptr<ChangeStateSrv::Response> resp)
+  const std::shared_ptr<ChangeStateSrv::Request> req)
 {
-  (void)header;
   std::uint8_t transition_id;
   {
     std::lock_guard<std::recursive_mutex> lock(state_machine_mutex_);
@@ -231,21 +276,30 @@ LifecycleNode::LifecycleNodeInterfaceImpl::on_change_state(
       auto rcl_transition = rcl_lifecycle_get_transition_by_label(
         state_machine_.current_state, req->transition.label.c_str());
       if (rcl_transition == nullptr) {
-        resp->success = false;
+        ChangeStateSrv::Response resp;
+        resp.success = false;
+        srv_change_state_->send_response(*header, resp);
         return;
       }
       transition_id = static_cast<std::uint8_t>(rcl_transition->id);
     }
   }
 
-  node_interfaces::LifecycleNodeInterface::CallbackReturn cb_return_code;
-  auto ret = change_state(transition_id, cb_return_code);
-  (void) ret;
-  // TODO(karsten1987): Lifecycle msgs have to be extended to keep both returns
-  // 1. return is the actual transition
-  // 2. return is whether an error occurred or not
-  resp->success =
-    (cb_return_code == node_interfaces::LifecycleNodeInterface::CallbackReturn::SUCCESS);
+  // Asynchronous transition callbacks may complete the transition from another thread
+  change_state_async(
+    transition_id,
+    [this, header](
+      rcl_ret_t ret, node_interfaces::LifecycleNodeInterface::CallbackReturn cb_return_code)
+    {
+      (void) ret;
+      // TODO(karsten1987): Lifecycle msgs have to be extended to keep both returns
+      // 1. return is the actual transition
+      // 2. return is whether an error occurred or not
+      ChangeStateSrv::Response resp;
+      resp.success =
+        (cb_return_code == node_interfaces::LifecycleNodeInterface::CallbackReturn::SUCCESS);
+      srv_change_state_->send_response(*header, resp);
+    });
 }
 
 void
@@ -393,6 +447,29 @@ rcl_ret_t
 LifecycleNode::LifecycleNodeInterfaceImpl::change_state(
   std::uint8_t transition_id,
   node_interfaces::LifecycleNodeInterface::CallbackReturn & cb_return_code)
+{
+  struct Result
+  {
+    rcl_ret_t ret = RCL_RET_OK;
+    node_interfaces::LifecycleNodeInterface::CallbackReturn cb_return_code =
+      node_interfaces::LifecycleNodeInterface::CallbackReturn::SUCCESS;
+  };
+  // Shared, an asynchronous callback may complete the transition after this returns
+  auto result = std::make_shared<Result>();
+  change_state_async(
+    transition_id,
+    [result](rcl_ret_t ret, node_interfaces::LifecycleNodeInterface::CallbackReturn code) {
+      result->ret = ret;
+      result->cb_return_code = code;
+    });
+  // A transition still in progress is reported as successful so far
+  cb_return_code = result->cb_return_code;
+  return result->ret;
+}
+
+void
+LifecycleNode::LifecycleNodeInterfaceImpl::change_state_async(
+  std::uint8_t transition_id, ChangeStateDone done)
 {
   constexpr bool publish_update = true;
   State initial_state;
@@ -405,12 +482,16 @@ LifecycleNode::LifecycleNodeInterfaceImpl::change_state(
         node_logging_interface_->get_logger(),
         "Unable to change state for state machine for %s: %s",
         node_base_interface_->get_name(), rcl_get_error_string().str);
-      return RCL_RET_ERROR;
+      done(RCL_RET_ERROR, node_interfaces::LifecycleNodeInterface::CallbackReturn::ERROR);
+      return;
     }
 
     // keep the initial state to pass to a transition callback
     initial_state = State(state_machine_.current_state);
+    const rcl_lifecycle_state_t * start_state = state_machine_.current_state;
 
+    // This fails while another transition is in progress, its transition state having
+    // no valid transition to start
     if (
       rcl_lifecycle_trigger_transition_by_id(
         &state_machine_, transition_id, publish_update) != RCL_RET_OK)
@@ -420,30 +501,39 @@ LifecycleNode::LifecycleNodeInterfaceImpl::change_state(
         "Unable to start transition %u from current state %s: %s",
         transition_id, state_machine_.current_state->label, rcl_get_error_string().str);
       rcutils_reset_error();
-      return RCL_RET_ERROR;
+      done(RCL_RET_ERROR, node_interfaces::LifecycleNodeInterface::CallbackReturn::ERROR);
+      return;
     }
+    publish_transition_event(start_state);
     current_state_id = state_machine_.current_state->id;
   }
 
   // Update the internal current_state_
   current_state_ = State(state_machine_.current_state);
 
-  auto get_label_for_return_code =
-    [](node_interfaces::LifecycleNodeInterface::CallbackReturn cb_return_code) -> const char *{
-      auto cb_id = static_cast<uint8_t>(cb_return_code);
-      if (cb_id == lifecycle_msgs::msg::Transition::TRANSITION_CALLBACK_SUCCESS) {
-        return rcl_lifecycle_transition_success_label;
-      } else if (cb_id == lifecycle_msgs::msg::Transition::TRANSITION_CALLBACK_FAILURE) {
-        return rcl_lifecycle_transition_failure_label;
-      }
-      return rcl_lifecycle_transition_error_label;
-    };
+  execute_callback_async(
+    current_state_id, initial_state,
+    [this, transition_id, initial_state, done = std::move(done)](
+      node_interfaces::LifecycleNodeInterface::CallbackReturn cb_return_code)
+    {
+      finish_transition(transition_id, initial_state, cb_return_code, done);
+    });
+}
 
-  cb_return_code = execute_callback(current_state_id, initial_state);
+void
+LifecycleNode::LifecycleNodeInterfaceImpl::finish_transition(
+  std::uint8_t transition_id,
+  const State & initial_state,
+  node_interfaces::LifecycleNodeInterface::CallbackReturn cb_return_code,
+  ChangeStateDone done)
+{
+  constexpr bool publish_update = true;
+  unsigned int current_state_id;
   auto transition_label = get_label_for_return_code(cb_return_code);
 
   {
     std::lock_guard<std::recursive_mutex> lock(state_machine_mutex_);
+    const rcl_lifecycle_state_t * start_state = state_machine_.current_state;
     if (
       rcl_lifecycle_trigger_transition_by_label(
         &state_machine_, transition_label, publish_update) != RCL_RET_OK)
@@ -453,8 +543,10 @@ LifecycleNode::LifecycleNodeInterfaceImpl::change_state(
         "Failed to finish transition %u. Current state is now: %s (%s)",
         transition_id, state_machine_.current_state->label, rcl_get_error_string().str);
       rcutils_reset_error();
-      return RCL_RET_ERROR;
+      done(RCL_RET_ERROR, cb_return_code);
+      return;
     }
+    publish_transition_event(start_state);
     current_state_id = state_machine_.current_state->id;
   }
 
@@ -463,33 +555,47 @@ LifecycleNode::LifecycleNodeInterfaceImpl::change_state(
 
   // error handling ?!
   // TODO(karsten1987): iterate over possible ret value
-  if (cb_return_code == node_interfaces::LifecycleNodeInterface::CallbackReturn::ERROR) {
-    RCLCPP_WARN(
-      node_logging_interface_->get_logger(),
-      "Error occurred while doing error handling.");
+  if (cb_return_code != node_interfaces::LifecycleNodeInterface::CallbackReturn::ERROR) {
+    // This true holds in both cases where the actual callback
+    // was successful or not, since at this point we have a valid transistion
+    // to a new primary state
+    done(RCL_RET_OK, cb_return_code);
+    return;
+  }
 
-    auto error_cb_code = execute_callback(current_state_id, initial_state);
-    auto error_cb_label = get_label_for_return_code(error_cb_code);
-    std::lock_guard<std::recursive_mutex> lock(state_machine_mutex_);
-    if (
-      rcl_lifecycle_trigger_transition_by_label(
-        &state_machine_, error_cb_label, publish_update) != RCL_RET_OK)
+  RCLCPP_WARN(
+    node_logging_interface_->get_logger(),
+    "Error occurred while doing error handling.");
+
+  execute_callback_async(
+    current_state_id, initial_state,
+    [this, cb_return_code, done = std::move(done)](
+      node_interfaces::LifecycleNodeInterface::CallbackReturn error_cb_code)
     {
-      RCLCPP_ERROR(
-        node_logging_interface_->get_logger(),
-        "Failed to call cleanup on error state: %s", rcl_get_error_string().str);
-      rcutils_reset_error();
-      return RCL_RET_ERROR;
-    }
-  }
+      auto error_cb_label = get_label_for_return_code(error_cb_code);
+      {
+        std::lock_guard<std::recursive_mutex> lock(state_machine_mutex_);
+        const rcl_lifecycle_state_t * start_state = state_machine_.current_state;
+        if (
+          rcl_lifecycle_trigger_transition_by_label(
+            &state_machine_, error_cb_label, publish_update) != RCL_RET_OK)
+        {
+          RCLCPP_ERROR(
+            node_logging_interface_->get_logger(),
+            "Failed to call cleanup on error state: %s", rcl_get_error_string().str);
+          rcutils_reset_error();
+          done(RCL_RET_ERROR, cb_return_code);
+          return;
+        }
+        publish_transition_event(start_state);
+      }
 
-  // Update the internal current_state_
-  current_state_ = State(state_machine_.current_state);
+      // Update the internal current_state_
+      current_state_ = State(state_machine_.current_state);
 
-  // This true holds in both cases where the actual callback
-  // was successful or not, since at this point we have a valid transistion
-  // to either a new primary state or error state
-  return RCL_RET_OK;
+      // At this point we have a valid transistion to the state chosen by error handling
+      done(RCL_RET_OK, cb_return_code);
+    });
 }
 
 node_interfaces::LifecycleNodeInterface::CallbackReturn
@@ -517,6 +623,41 @@ LifecycleNode::LifecycleNodeInterfaceImpl::execute_callback(
   return cb_success;
 }
 
+void
+LifecycleNode::LifecycleNodeInterfaceImpl::execute_callback_async(
+  unsigned int cb_id, const State & previous_state,
+  std::function<void(node_interfaces::LifecycleNodeInterface::CallbackReturn)> done) const
+{
+  auto it = async_cb_map_.find(static_cast<uint8_t>(cb_id));
+  if (it == async_cb_map_.end()) {
+    done(execute_callback(cb_id, previous_state));
+    return;
+  }
+
+  // Only the first completion is used, e.g. if the callback throws after completing
+  auto completed = std::make_shared<std::atomic_bool>(false);
+  LifecycleNode::TransitionCompletion complete =
+    [completed, done = std::move(done)](
+    node_interfaces::LifecycleNodeInterface::CallbackReturn cb_return_code)
+    {
+      if (!completed->exchange(true)) {
+        done(cb_return_code);
+      }
+    };
+  auto callback = it->second;
+  try {
+    callback(State(previous_state), complete);
+  } catch (const std::exception & e) {
+    RCLCPP_ERROR(
+      node_logging_interface_->get_logger(),
+      "Caught exception in callback for transition %d", it->first);
+    RCLCPP_ERROR(
+      node_logging_interface_->get_logger(),
+      "Original error: %s", e.what());
+    complete(node_interfaces::LifecycleNodeInterface::CallbackReturn::ERROR);
+  }
+}
+
 const State & LifecycleNode::LifecycleNodeInterfaceImpl::trigger_transition(
   const char * transition_label)
 {
@@ -573,6 +714,13 @@ LifecycleNode::LifecycleNodeInterfaceImpl::add_timer_handle(
   weak_timers_.push_back(timer);
 }
 
+void
+LifecycleNode::LifecycleNodeInterfaceImpl::add_managed_callback_group(
+  std::weak_ptr<rclcpp::CallbackGroup> callback_group)
+{
+  weak_managed_callback_groups_.push_back(callback_group);
+}
+
 void
 LifecycleNode::LifecycleNodeInterfaceImpl::on_activate() const
 {
@@ -582,6 +730,12 @@ LifecycleNode::LifecycleNodeInterfaceImpl::on_activate() const
       entity->on_activate();
     }
   }
+  for (const auto & weak_group : weak_managed_callback_groups_) {
+    auto group = weak_group.lock();
+    if (group) {
+      group->set_enabled(true);
+    }
+  }
 }
 
 void
@@ -593,6 +747,12 @@ LifecycleNode::LifecycleNodeInterfaceImpl::on_deactivate() const
       entity->on_deactivate();
     }
   }
+  for (const auto & weak_group : weak_managed_callback_groups_) {
+    auto group = weak_group.lock();
+    if (group) {
+      group->set_enabled(false);
+    }
+  }
 }
 
 }  // namespace rclcpp_lifecycle
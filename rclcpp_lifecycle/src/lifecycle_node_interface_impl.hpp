@@ -34,6 +34,7 @@
 #include "rclcpp/node_interfaces/node_base_interface.hpp"
 #include "rclcpp/node_interfaces/node_logging_interface.hpp"
 #include "rclcpp/node_interfaces/node_services_interface.hpp"
+#include "rclcpp/publisher.hpp"
 
 #include "rclcpp_lifecycle/node_interfaces/lifecycle_node_interface.hpp"
 
@@ -61,11 +62,23 @@ public:
   void
   init(bool enable_communication_interface = true);
 
+  bool
+  is_communication_interface_enabled() const;
+
+  void
+  enable_communication_interface(
+    rclcpp::Publisher<TransitionEventMsg>::SharedPtr pub_transition_event);
+
   bool
   register_callback(
     std::uint8_t lifecycle_transition,
     std::function<node_interfaces::LifecycleNodeInterface::CallbackReturn(const State &)> & cb);
 
+  bool
+  register_async_callback(
+    std::uint8_t lifecycle_transition,
+    LifecycleNode::AsyncTransitionCallback & cb);
+
   const State &
   get_current_state() const;
 
@@ -104,14 +117,32 @@ public:
   void
   add_timer_handle(std::shared_ptr<rclcpp::TimerBase> timer);
 
+  void
+  add_managed_callback_group(std::weak_ptr<rclcpp::CallbackGroup> callback_group);
+
 private:
   RCLCPP_DISABLE_COPY(LifecycleNodeInterfaceImpl)
 
+  /// Create the lifecycle services, using the service handles of rcl if use_rcl_services.
+  void
+  create_services(bool use_rcl_services);
+
+  template<typename ServiceT, typename CallbackT>
+  std::shared_ptr<rclcpp::Service<ServiceT>>
+  add_service(rcl_service_t * service_handle, const char * service_name, CallbackT && callback);
+
+  /// Publish the transition from start_state to the current state, unless rcl publishes it.
+  void
+  publish_transition_event(const rcl_lifecycle_state_t * start_state) const;
+
+  /// Called once a transition completed, with whether it did and the callback result.
+  using ChangeStateDone =
+    std::function<void (rcl_ret_t, node_interfaces::LifecycleNodeInterface::CallbackReturn)>;
+
   void
   on_change_state(
     const std::shared_ptr<rmw_request_id_t> header,
-    const std::shared_ptr<ChangeStateSrv::Request> req,
-    std::shared_ptr<ChangeStateSrv::Response> resp);
+    const std::shared_ptr<ChangeStateSrv::Request> req);
 
   void
   on_get_state(
@@ -142,15 +173,34 @@ private:
     std::uint8_t transition_id,
     node_interfaces::LifecycleNodeInterface::CallbackReturn & cb_return_code);
 
+  /// Start a transition, done is called once its callback completed, possibly later.
+  void
+  change_state_async(std::uint8_t transition_id, ChangeStateDone done);
+
+  void
+  finish_transition(
+    std::uint8_t transition_id,
+    const State & initial_state,
+    node_interfaces::LifecycleNodeInterface::CallbackReturn cb_return_code,
+    ChangeStateDone done);
+
   node_interfaces::LifecycleNodeInterface::CallbackReturn
   execute_callback(unsigned int cb_id, const State & previous_state) const;
 
+  /// Execute the callback, asynchronous or not, of a transition state, then call done.
+  void
+  execute_callback_async(
+    unsigned int cb_id, const State & previous_state,
+    std::function<void(node_interfaces::LifecycleNodeInterface::CallbackReturn)> done) const;
+
   mutable std::recursive_mutex state_machine_mutex_;
   rcl_lifecycle_state_machine_t state_machine_;
   State current_state_;
   std::map<
     std::uint8_t,
     std::function<node_interfaces::LifecycleNodeInterface::CallbackReturn(const State &)>> cb_map_;
+  // A transition state has either a callback of cb_map_ or an asynchronous one
+  std::map<std::uint8_t, LifecycleNode::AsyncTransitionCallback> async_cb_map_;
 
   using NodeBasePtr = std::shared_ptr<rclcpp::node_interfaces::NodeBaseInterface>;
   using NodeServicesPtr = std::shared_ptr<rclcpp::node_interfaces::NodeServicesInterface>;
@@ -172,10 +222,14 @@ private:
   GetAvailableStatesSrvPtr srv_get_available_states_;
   GetAvailableTransitionsSrvPtr srv_get_available_transitions_;
   GetTransitionGraphSrvPtr srv_get_transition_graph_;
+  bool communication_interface_enabled_ = false;
+  // Only used when the communication interface is enabled after init, rcl publishes otherwise
+  rclcpp::Publisher<TransitionEventMsg>::SharedPtr pub_transition_event_;
 
   // to controllable things
   std::vector<std::weak_ptr<rclcpp_lifecycle::ManagedEntityInterface>> weak_managed_entities_;
   std::vector<std::weak_ptr<rclcpp::TimerBase>> weak_timers_;
+  std::vector<std::weak_ptr<rclcpp::CallbackGroup>> weak_managed_callback_groups_;
 };
 
 }  // namespace rclcpp_lifecycle
@@ -27,9 +27,4 @@ void SimpleManagedEntity::on_deactivate()
   activated_.store(false);
 }
 
-bool SimpleManagedEntity::is_activated() const
-{
-  return activated_.load();
-}
-
 }  // namespace rclcpp_lifecycle
@@ -0,0 +1,128 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "lifecycle_msgs/msg/state.hpp"
+#include "lifecycle_msgs/msg/transition.hpp"
+#include "performance_test_fixture/performance_test_fixture.hpp"
+#include "rclcpp/rclcpp.hpp"
+#include "rclcpp_lifecycle/lifecycle_node.hpp"
+#include "rclcpp_lifecycle/lifecycle_publisher.hpp"
+#include "test_msgs/msg/empty.hpp"
+
+/**
+ * Benchmarks for evaluating the overhead of rclcpp_lifecycle::LifecyclePublisher over
+ * rclcpp::Publisher, and the cost of activating the managed entities of a lifecycle node.
+ */
+
+class BenchmarkLifecyclePublisher : public performance_test_fixture::PerformanceTest
+{
+public:
+  void SetUp(benchmark::State & state)
+  {
+    rclcpp::init(0, nullptr);
+    node = std::make_shared<rclcpp_lifecycle::LifecycleNode>("node", "ns");
+    performance_test_fixture::PerformanceTest::SetUp(state);
+  }
+
+  void TearDown(benchmark::State & state)
+  {
+    performance_test_fixture::PerformanceTest::TearDown(state);
+    node.reset();
+    rclcpp::shutdown();
+  }
+
+protected:
+  std::shared_ptr<rclcpp_lifecycle::LifecycleNode> node;
+};
+
+// The baseline for the publish benchmarks below, through the same node.
+BENCHMARK_F(BenchmarkLifecyclePublisher, publisher_publish)(benchmark::State & state) {
+  auto publisher = rclcpp::create_publisher<test_msgs::msg::Empty>(node, "empty", 10);
+  const test_msgs::msg::Empty message;
+
+  reset_heap_counters();
+  for (auto _ : state) {
+    (void)_;
+    publisher->publish(message);
+  }
+}
+
+BENCHMARK_F(BenchmarkLifecyclePublisher, lifecycle_publisher_publish)(benchmark::State & state) {
+  auto publisher = node->create_publisher<test_msgs::msg::Empty>("empty", 10);
+  publisher->on_activate();
+  const test_msgs::msg::Empty message;
+
+  reset_heap_counters();
+  for (auto _ : state) {
+    (void)_;
+    publisher->publish(message);
+  }
+}
+
+// Messages are dropped, after the warning logged for the first one.
+BENCHMARK_F(BenchmarkLifecyclePublisher, lifecycle_publisher_publish_inactive)(
+  benchmark::State & state)
+{
+  auto publisher = node->create_publisher<test_msgs::msg::Empty>("empty", 10);
+  const test_msgs::msg::Empty message;
+  publisher->publish(message);
+
+  reset_heap_counters();
+  for (auto _ : state) {
+    (void)_;
+    publisher->publish(message);
+  }
+}
+
+// The transitions activate and deactivate the managed publishers of the node.
+BENCHMARK_DEFINE_F(BenchmarkLifecyclePublisher, transition_managed_publishers)(
+  benchmark::State & state)
+{
+  std::vector<rclcpp_lifecycle::LifecyclePublisher<test_msgs::msg::Empty>::SharedPtr> publishers;
+  for (int64_t i = 0; i < state.range(0); ++i) {
+    publishers.push_back(
+      node->create_publisher<test_msgs::msg::Empty>("empty_" + std::to_string(i), 10));
+  }
+  const auto & configured =
+    node->trigger_transition(lifecycle_msgs::msg::Transition::TRANSITION_CONFIGURE);
+  if (configured.id() != lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE) {
+    state.SkipWithError("Transition to configured state failed");
+    return;
+  }
+
+  reset_heap_counters();
+  for (auto _ : state) {
+    (void)_;
+    const auto & active =
+      node->trigger_transition(lifecycle_msgs::msg::Transition::TRANSITION_ACTIVATE);
+    if (active.id() != lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE) {
+      state.SkipWithError("Transition to active state failed");
+      break;
+    }
+    const auto & inactive =
+      node->trigger_transition(lifecycle_msgs::msg::Transition::TRANSITION_DEACTIVATE);
+    if (inactive.id() != lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE) {
+      state.SkipWithError("Transition to inactive state failed");
+      break;
+    }
+  }
+}
+BENCHMARK_REGISTER_F(BenchmarkLifecyclePublisher, transition_managed_publishers)
+->RangeMultiplier(10)->Range(1, 1000);
@@ -17,12 +17,14 @@
 #include <map>
 #include <memory>
 #include <set>
+#include <stdexcept>
 #include <string>
 #include <vector>
 #include <utility>
 
 #include "lifecycle_msgs/msg/state.hpp"
 #include "lifecycle_msgs/msg/transition.hpp"
+#include "lifecycle_msgs/msg/transition_event.hpp"
 
 #include "rcl_lifecycle/rcl_lifecycle.h"
 #include "rcl_interfaces/srv/get_logger_levels.hpp"
@@ -303,6 +305,55 @@ TEST_F(TestDefaultStateMachine, trigger_transition) {
       rclcpp_lifecycle::Transition(Transition::TRANSITION_UNCONFIGURED_SHUTDOWN)).id());
 }
 
+TEST_F(TestDefaultStateMachine, async_transition_callback) {
+  using CallbackReturn = rclcpp_lifecycle::node_interfaces::LifecycleNodeInterface::CallbackReturn;
+  auto test_node = std::make_shared<EmptyLifecycleNode>("testnode");
+
+  rclcpp_lifecycle::LifecycleNode::TransitionCompletion complete_configure;
+  test_node->register_async_on_configure(
+    [&complete_configure](
+      const rclcpp_lifecycle::State & previous_state,
+      rclcpp_lifecycle::LifecycleNode::TransitionCompletion complete)
+    {
+      EXPECT_EQ(State::PRIMARY_STATE_UNCONFIGURED, previous_state.id());
+      complete_configure = complete;
+    });
+
+  // The transition is in progress until it's completed
+  EXPECT_EQ(
+    State::TRANSITION_STATE_CONFIGURING, test_node->trigger_transition(
+      rclcpp_lifecycle::Transition(Transition::TRANSITION_CONFIGURE)).id());
+  ASSERT_TRUE(complete_configure);
+  EXPECT_EQ(
+    State::TRANSITION_STATE_CONFIGURING, test_node->trigger_transition(
+      rclcpp_lifecycle::Transition(Transition::TRANSITION_ACTIVATE)).id());
+
+  complete_configure(CallbackReturn::SUCCESS);
+  EXPECT_EQ(State::PRIMARY_STATE_INACTIVE, test_node->get_current_state().id());
+  // Completing again has no effect
+  complete_configure(CallbackReturn::FAILURE);
+  EXPECT_EQ(State::PRIMARY_STATE_INACTIVE, test_node->get_current_state().id());
+
+  // A callback throwing before completing completes with an error
+  test_node->register_async_on_activate(
+    [](const rclcpp_lifecycle::State &, rclcpp_lifecycle::LifecycleNode::TransitionCompletion) {
+      throw std::runtime_error("activation failed");
+    });
+  CallbackReturn ret = CallbackReturn::SUCCESS;
+  EXPECT_EQ(
+    State::PRIMARY_STATE_UNCONFIGURED, test_node->trigger_transition(
+      rclcpp_lifecycle::Transition(Transition::TRANSITION_ACTIVATE), ret).id());
+  EXPECT_EQ(CallbackReturn::ERROR, ret);
+
+  // A synchronous callback replaces the asynchronous one
+  test_node->register_on_configure(
+    [](const rclcpp_lifecycle::State &) {return CallbackReturn::FAILURE;});
+  EXPECT_EQ(
+    State::PRIMARY_STATE_UNCONFIGURED, test_node->trigger_transition(
+      rclcpp_lifecycle::Transition(Transition::TRANSITION_CONFIGURE), ret).id());
+  EXPECT_EQ(CallbackReturn::FAILURE, ret);
+}
+
 TEST_F(TestDefaultStateMachine, trigger_transition_rcl_errors) {
   auto test_node = std::make_shared<EmptyLifecycleNode>("testnode");
 
@@ -769,6 +820,49 @@ TEST_F(TestDefaultStateMachine, test_graph_services_by_node) {
     "lifecycle_msgs/srv/GetAvailableTransitions");
 }
 
+TEST_F(TestDefaultStateMachine, enable_communication_interface) {
+  auto test_node = std::make_shared<rclcpp_lifecycle::LifecycleNode>(
+    "testnode", rclcpp::NodeOptions(), false);
+  EXPECT_FALSE(test_node->is_communication_interface_enabled());
+  EXPECT_EQ(0u, test_node->count_services("/testnode/change_state"));
+  EXPECT_EQ(0u, test_node->count_publishers("/testnode/transition_event"));
+
+  test_node->enable_communication_interface();
+  EXPECT_TRUE(test_node->is_communication_interface_enabled());
+  // Enabling it again creates nothing
+  test_node->enable_communication_interface();
+  ASSERT_TRUE(wait_for_service(test_node, "/testnode/change_state"));
+  ASSERT_TRUE(wait_for_service(test_node, "/testnode/get_available_states"));
+  ASSERT_TRUE(wait_for_service(test_node, "/testnode/get_available_transitions"));
+  ASSERT_TRUE(wait_for_service(test_node, "/testnode/get_state"));
+  ASSERT_TRUE(wait_for_service(test_node, "/testnode/get_transition_graph"));
+  ASSERT_TRUE(wait_for_topic(test_node, "/testnode/transition_event"));
+  EXPECT_EQ(1u, test_node->count_services("/testnode/change_state"));
+  EXPECT_EQ(1u, test_node->count_publishers("/testnode/transition_event"));
+
+  // Transitions are published by the publisher created on demand
+  std::vector<lifecycle_msgs::msg::TransitionEvent> events;
+  auto subscription = test_node->create_subscription<lifecycle_msgs::msg::TransitionEvent>(
+    "/testnode/transition_event", 10,
+    [&events](const lifecycle_msgs::msg::TransitionEvent & event) {events.push_back(event);});
+  ASSERT_TRUE(
+    wait_for_event(
+      test_node,
+      [test_node]() {return test_node->count_subscribers("/testnode/transition_event") == 1u;},
+      DEFAULT_EVENT_TIMEOUT, DEFAULT_EVENT_SLEEP_PERIOD));
+  EXPECT_EQ(State::PRIMARY_STATE_INACTIVE, test_node->configure().id());
+
+  const auto deadline = std::chrono::steady_clock::now() + DEFAULT_EVENT_TIMEOUT;
+  while (events.size() < 2u && std::chrono::steady_clock::now() < deadline) {
+    rclcpp::spin_some(test_node->get_node_base_interface());
+  }
+  ASSERT_EQ(2u, events.size());
+  EXPECT_EQ(State::PRIMARY_STATE_UNCONFIGURED, events[0].start_state.id);
+  EXPECT_EQ(State::TRANSITION_STATE_CONFIGURING, events[0].goal_state.id);
+  EXPECT_EQ(State::TRANSITION_STATE_CONFIGURING, events[1].start_state.id);
+  EXPECT_EQ(State::PRIMARY_STATE_INACTIVE, events[1].goal_state.id);
+}
+
 TEST_F(TestDefaultStateMachine, test_callback_groups) {
   auto test_node = std::make_shared<EmptyLifecycleNode>("testnode");
   size_t num_groups = 0;
@@ -794,6 +888,28 @@ TEST_F(TestDefaultStateMachine, test_callback_groups) {
   EXPECT_EQ(num_groups, 2u);
 }
 
+TEST_F(TestDefaultStateMachine, test_managed_callback_groups) {
+  auto test_node = std::make_shared<EmptyLifecycleNode>("testnode");
+  auto group = test_node->create_managed_callback_group(
+    rclcpp::CallbackGroupType::MutuallyExclusive);
+  ASSERT_NE(nullptr, group);
+  EXPECT_FALSE(group->is_enabled());
+
+  test_node->trigger_transition(rclcpp_lifecycle::Transition(Transition::TRANSITION_CONFIGURE));
+  EXPECT_FALSE(group->is_enabled());
+  test_node->trigger_transition(rclcpp_lifecycle::Transition(Transition::TRANSITION_ACTIVATE));
+  EXPECT_TRUE(group->is_enabled());
+
+  // Created while active
+  auto active_group = test_node->create_managed_callback_group(
+    rclcpp::CallbackGroupType::Reentrant);
+  EXPECT_TRUE(active_group->is_enabled());
+
+  test_node->trigger_transition(rclcpp_lifecycle::Transition(Transition::TRANSITION_DEACTIVATE));
+  EXPECT_FALSE(group->is_enabled());
+  EXPECT_FALSE(active_group->is_enabled());
+}
+
 TEST_F(TestDefaultStateMachine, wait_for_graph_change)
 {
   auto test_node = std::make_shared<EmptyLifecycleNode>("testnode");
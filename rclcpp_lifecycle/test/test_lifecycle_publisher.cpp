@@ -153,6 +153,15 @@ TEST_P(TestLifecyclePublisher, publish_managed_by_node) {
   }
 }
 
+TEST_P(TestLifecyclePublisher, can_publish) {
+  node_->publisher()->on_deactivate();
+  EXPECT_FALSE(node_->publisher()->can_publish());
+  node_->publisher()->on_activate();
+  EXPECT_TRUE(node_->publisher()->can_publish());
+  node_->publisher()->on_deactivate();
+  EXPECT_FALSE(node_->publisher()->can_publish());
+}
+
 TEST_P(TestLifecyclePublisher, publish) {
   // transition via LifecyclePublisher
   node_->publisher()->on_deactivate();